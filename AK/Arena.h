@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BumpAllocator.h>
+#include <AK/Noncopyable.h>
+#include <AK/Span.h>
+#include <AK/StdLibExtras.h>
+#include <AK/TypedTransfer.h>
+
+namespace AK {
+
+// Owns objects of any type for the duration of a phase of work, and frees them all at once when it goes away.
+// Allocations are bumped out of large chunks, so there is no per-object malloc/free and objects made together stay
+// close together in memory. Objects that need destruction are destroyed in reverse order of creation, like locals.
+// Allocations too large for a chunk get their own block, which is freed along with everything else.
+template<size_t chunk_size = 16 * KiB>
+class Arena {
+    AK_MAKE_NONCOPYABLE(Arena);
+    AK_MAKE_NONMOVABLE(Arena);
+
+public:
+    Arena() = default;
+
+    ~Arena()
+    {
+        clear();
+    }
+
+    template<typename T, typename... Args>
+    [[nodiscard]] T& make(Args&&... args)
+    {
+        auto* object = new (allocate(sizeof(T), alignof(T))) T(forward<Args>(args)...);
+        if constexpr (!IsTriviallyDestructible<T>) {
+            auto* destructor_node = new (allocate(sizeof(DestructorNode), alignof(DestructorNode))) DestructorNode;
+            destructor_node->object = object;
+            destructor_node->destroy = [](void* object) { static_cast<T*>(object)->~T(); };
+            destructor_node->next = m_destructors;
+            m_destructors = destructor_node;
+        }
+        return *object;
+    }
+
+    // Returns a copy of the given values that lives as long as the arena.
+    template<typename T>
+    requires(IsTriviallyDestructible<T>) [[nodiscard]] Span<T> copy(ReadonlySpan<T> values)
+    {
+        if (values.is_empty())
+            return {};
+        auto* data = static_cast<T*>(allocate(values.size() * sizeof(T), alignof(T)));
+        TypedTransfer<T>::copy(data, values.data(), values.size());
+        return { data, values.size() };
+    }
+
+    // Raw, uninitialized storage that lives as long as the arena.
+    [[nodiscard]] void* allocate(size_t size, size_t alignment)
+    {
+        if (size + alignment > large_allocation_threshold)
+            return allocate_large(size, alignment);
+        auto* pointer = m_allocator.allocate(size, alignment);
+        VERIFY(pointer);
+        return pointer;
+    }
+
+    // Destroys every object in the arena and releases its memory, leaving the arena ready for reuse.
+    void clear()
+    {
+        for (auto* node = m_destructors; node; node = node->next)
+            node->destroy(node->object);
+        m_destructors = nullptr;
+
+        for (auto* block = m_large_blocks; block;) {
+            auto* next = block->next;
+            kfree(block);
+            block = next;
+        }
+        m_large_blocks = nullptr;
+
+        m_allocator.deallocate_all();
+    }
+
+private:
+    struct DestructorNode {
+        void* object { nullptr };
+        void (*destroy)(void*) { nullptr };
+        DestructorNode* next { nullptr };
+    };
+
+    struct LargeBlockHeader {
+        LargeBlockHeader* next { nullptr };
+    };
+
+    // Anything bigger than this would waste most of a chunk, so it gets a block of its own.
+    static constexpr size_t large_allocation_threshold = chunk_size / 4;
+
+    void* allocate_large(size_t size, size_t alignment)
+    {
+        auto header_size = align_up_to(sizeof(LargeBlockHeader), alignment);
+        auto* block = static_cast<LargeBlockHeader*>(kmalloc(header_size + size + alignment));
+        VERIFY(block);
+        block->next = m_large_blocks;
+        m_large_blocks = block;
+        return reinterpret_cast<void*>(align_up_to(reinterpret_cast<FlatPtr>(block) + header_size, alignment));
+    }
+
+    BumpAllocator<false, chunk_size> m_allocator;
+    DestructorNode* m_destructors { nullptr };
+    LargeBlockHeader* m_large_blocks { nullptr };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::Arena;
+#endif
@@ -90,6 +90,9 @@ public:
                 kfree_sized((void*)chunk, m_chunk_size);
             }
         });
+        m_head_chunk = 0;
+        m_current_chunk = 0;
+        m_byte_offset_into_current_chunk = 0;
     }
 
 protected:
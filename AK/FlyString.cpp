@@ -5,7 +5,7 @@
  */
 
 #include <AK/FlyString.h>
-#include <AK/HashTable.h>
+#include <AK/InternTable.h>
 #include <AK/Singleton.h>
 #include <AK/String.h>
 #include <AK/StringData.h>
@@ -22,18 +22,33 @@ struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
 
 static auto& all_fly_strings()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
+    static Singleton<Detail::InternTable<Detail::StringData, FlyStringTableHashTraits>> table;
     return *table;
 }
 
+Optional<FlyString> FlyString::find_fly_string(u32 hash, StringView string)
+{
+    return all_fly_strings().with_shard(hash, [&](auto& table) -> Optional<FlyString> {
+        auto it = table.find(hash, [&](auto& entry) { return entry->bytes_as_string_view() == string; });
+        if (it == table.end())
+            return {};
+
+        // NB: The entry's last reference may have just been dropped on another thread, in which case it will be removed
+        //     from the table as soon as we release the lock.
+        if (!(*it)->try_ref())
+            return {};
+        return FlyString { Detail::StringBase(adopt_ref(**it)) };
+    });
+}
+
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
 {
     if (string.is_empty())
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto fly_string = find_fly_string(string.hash(), string); fly_string.has_value())
+        return fly_string.release_value();
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -43,8 +58,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto fly_string = find_fly_string(StringView(string).hash(), StringView(string)); fly_string.has_value())
+        return fly_string.release_value();
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -62,15 +77,19 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_impl.data);
-    if (it == all_fly_strings().end()) {
+    all_fly_strings().with_shard(string.m_impl.data->hash(), [&](auto& table) {
+        auto it = table.find(string.m_impl.data);
+        if (it != table.end() && (*it)->try_ref()) {
+            m_data.m_impl.data = *it;
+            return;
+        }
+
+        // NB: If an entry exists, it is being destroyed on another thread. Replacing it is fine, as entries are removed
+        //     by identity.
         m_data = string;
-        all_fly_strings().set(string.m_impl.data);
+        table.set(string.m_impl.data);
         string.m_impl.data->set_fly_string(true);
-    } else {
-        m_data.m_impl.data = *it;
-        m_data.m_impl.data->ref();
-    }
+    });
 }
 
 FlyString& FlyString::operator=(String const& string)
@@ -209,7 +228,10 @@ namespace Detail {
 
 void did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
 {
-    all_fly_strings().remove(&string_data);
+    all_fly_strings().with_shard(string_data.hash(), [&](auto& table) {
+        if (auto it = table.find(string_data.hash(), [&](auto const* entry) { return entry == &string_data; }); it != table.end())
+            table.remove(it);
+    });
 }
 
 }
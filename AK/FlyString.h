@@ -96,6 +96,8 @@ private:
     {
     }
 
+    static Optional<FlyString> find_fly_string(u32 hash, StringView);
+
     Detail::StringBase m_data;
 
     constexpr bool is_invalid() const { return m_data.raw(Badge<FlyString> {}) == 0; }
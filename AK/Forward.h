@@ -104,12 +104,18 @@ class HashTable;
 template<typename T, typename TraitsForT = Traits<T>>
 using OrderedHashTable = HashTable<T, TraitsForT, true>;
 
-template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false>
+template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
+class SwissHashTable;
+
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>, bool IsOrdered = false, template<typename, typename, bool> typename HashTableTemplate = HashTable>
 class HashMap;
 
 template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
 using OrderedHashMap = HashMap<K, V, KeyTraits, ValueTraits, true>;
 
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
+using SwissHashMap = HashMap<K, V, KeyTraits, ValueTraits, false, SwissHashTable>;
+
 template<typename T>
 class Badge;
 
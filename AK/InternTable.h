@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/HashTable.h>
+#include <AK/Noncopyable.h>
+
+namespace AK::Detail {
+
+// The set of interned string data backing FlyString and Utf16FlyString. Any thread may intern strings, so the set is
+// split into shards by hash, each behind its own lock. Threads interning unrelated strings then rarely touch the same
+// lock, and every critical section is a single hash table operation, so a spin lock is enough.
+template<typename T, typename TraitsForT>
+class InternTable {
+    AK_MAKE_NONCOPYABLE(InternTable);
+    AK_MAKE_NONMOVABLE(InternTable);
+
+public:
+    using Table = HashTable<T const*, TraitsForT>;
+
+    InternTable() = default;
+
+    // Runs the callback with the table of the shard that the given hash belongs to, which is locked meanwhile.
+    template<typename Callback>
+    decltype(auto) with_shard(u32 hash, Callback callback)
+    {
+        auto& shard = shard_for(hash);
+        Locker locker { shard };
+        return callback(shard.table);
+    }
+
+    size_t size()
+    {
+        size_t size = 0;
+        for (auto& shard : m_shards) {
+            Locker locker { shard };
+            size += shard.table.size();
+        }
+        return size;
+    }
+
+private:
+    static constexpr size_t shard_count = 16;
+
+    struct Shard {
+        Atomic<bool> locked { false };
+        Table table;
+    };
+
+    class Locker {
+    public:
+        explicit Locker(Shard& shard)
+            : m_shard(shard)
+        {
+            while (m_shard.locked.exchange(true, AK::MemoryOrder::memory_order_acquire)) {
+                while (m_shard.locked.load(AK::MemoryOrder::memory_order_relaxed))
+                    atomic_pause();
+            }
+        }
+
+        ~Locker()
+        {
+            m_shard.locked.store(false, AK::MemoryOrder::memory_order_release);
+        }
+
+    private:
+        Shard& m_shard;
+    };
+
+    // NB: HashTable picks buckets with the low bits of the hash, so pick shards with the high bits to keep each shard's
+    //     buckets evenly used.
+    Shard& shard_for(u32 hash) { return m_shards[hash >> 28]; }
+    static_assert(shard_count == 16);
+
+    Array<Shard, shard_count> m_shards;
+};
+
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/StdLibExtras.h>
+
+namespace AK {
+
+// A lock-free, unbounded queue for handing values from any number of threads to a single consumer thread.
+// Producers push onto an atomic list with a single compare-and-swap. The consumer detaches the whole list at once and
+// walks it oldest first, so it never contends with producers beyond that one exchange, and there is no ABA hazard.
+template<typename T>
+class MultiProducerQueue {
+    AK_MAKE_NONCOPYABLE(MultiProducerQueue);
+    AK_MAKE_NONMOVABLE(MultiProducerQueue);
+
+public:
+    MultiProducerQueue() = default;
+
+    ~MultiProducerQueue()
+    {
+        (void)take_all([](T&&) { });
+    }
+
+    // May be called from any thread. Returns true if the queue was empty, so producers can skip redundant wakeups.
+    template<typename... Args>
+    bool push(Args&&... args)
+    {
+        auto* node = new Node(forward<Args>(args)...);
+        auto* head = m_head.load(AK::MemoryOrder::memory_order_relaxed);
+        do {
+            node->next = head;
+        } while (!m_head.compare_exchange_strong(head, node, AK::MemoryOrder::memory_order_seq_cst));
+        return head == nullptr;
+    }
+
+    // NB: push() and is_empty() are sequentially consistent, so that a consumer can go to sleep by bumping a waiter count
+    //     and then checking is_empty(), while producers check the waiter count after pushing, without losing a wakeup.
+    bool is_empty() const { return m_head.load(AK::MemoryOrder::memory_order_seq_cst) == nullptr; }
+
+    // Must only be called from the consumer thread. Hands every value pushed so far to the callback, oldest first, and
+    // returns how many there were. Values pushed while the callback runs are left for the next call.
+    template<typename Callback>
+    size_t take_all(Callback callback)
+    {
+        auto* node = m_head.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+
+        Node* oldest = nullptr;
+        while (node) {
+            auto* next = node->next;
+            node->next = oldest;
+            oldest = node;
+            node = next;
+        }
+
+        size_t count = 0;
+        while (oldest) {
+            auto* next = oldest->next;
+            callback(move(oldest->value));
+            delete oldest;
+            oldest = next;
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    struct Node {
+        template<typename... Args>
+        explicit Node(Args&&... args)
+            : value(forward<Args>(args)...)
+        {
+        }
+
+        T value;
+        Node* next { nullptr };
+    };
+
+    Atomic<Node*> m_head { nullptr };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::MultiProducerQueue;
+#endif
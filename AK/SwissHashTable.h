@@ -0,0 +1,650 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/SIMD.h>
+#include <AK/Vector.h>
+
+namespace AK {
+
+namespace Detail {
+
+// A set of slots within a group, found by matching control bytes. Every slot is represented by 1 << Shift bits.
+template<typename MaskType, size_t Shift>
+struct SwissGroupMask {
+    explicit operator bool() const { return mask != 0; }
+    size_t lowest_index() const { return count_trailing_zeroes(mask) >> Shift; }
+    void clear_lowest() { mask &= mask - 1; }
+
+    MaskType mask;
+};
+
+// Control bytes describe the slot at the same index: either Empty, Deleted, or Full with the low 7 bits of its hash.
+static constexpr u8 swiss_control_empty = 0x80;
+static constexpr u8 swiss_control_deleted = 0xFE;
+
+#if defined(__SSE2__)
+// Compares 16 control bytes at a time with a single instruction.
+struct SwissGroup {
+    static constexpr size_t width = 16;
+    using Mask = SwissGroupMask<u32, 0>;
+
+    explicit SwissGroup(u8 const* control)
+    {
+        __builtin_memcpy(&m_control, control, sizeof(m_control));
+    }
+
+    Mask match(u8 h2) const { return { mask_from(m_control == static_cast<i8>(h2)) }; }
+    Mask match_empty() const { return { mask_from(m_control == static_cast<i8>(swiss_control_empty)) }; }
+    // Empty and Deleted are the only negative control bytes.
+    Mask match_empty_or_deleted() const { return { mask_from(m_control < 0) }; }
+
+private:
+    static u32 mask_from(SIMD::i8x16 comparison) { return static_cast<u32>(__builtin_ia32_pmovmskb128(reinterpret_cast<SIMD::c8x16>(comparison))); }
+
+    SIMD::i8x16 m_control;
+};
+#else
+// Compares 8 control bytes at a time with plain 64-bit arithmetic, which also serves ARM well.
+struct SwissGroup {
+    static constexpr size_t width = 8;
+    using Mask = SwissGroupMask<u64, 3>;
+
+    static constexpr u64 lsbs = 0x0101010101010101ull;
+    static constexpr u64 msbs = 0x8080808080808080ull;
+
+    explicit SwissGroup(u8 const* control)
+    {
+        __builtin_memcpy(&m_control, control, sizeof(m_control));
+    }
+
+    // NB: This may report false positives in the byte following a true match, which the caller's equality check weeds out.
+    Mask match(u8 h2) const
+    {
+        auto x = m_control ^ (lsbs * h2);
+        return { (x - lsbs) & ~x & msbs };
+    }
+    // Empty is the only control byte with the high bit set and bit 1 clear.
+    Mask match_empty() const { return { m_control & ~(m_control << 6) & msbs }; }
+    // Empty and Deleted are the only control bytes with the high bit set and bit 0 clear.
+    Mask match_empty_or_deleted() const { return { m_control & ~(m_control << 7) & msbs }; }
+
+private:
+    u64 m_control;
+};
+#endif
+
+}
+
+template<typename TableType, typename T>
+class SwissHashTableIterator {
+    friend TableType;
+
+public:
+    bool operator==(SwissHashTableIterator const& other) const { return m_slot == other.m_slot; }
+    bool operator!=(SwissHashTableIterator const& other) const { return m_slot != other.m_slot; }
+    T& operator*() { return *m_slot; }
+    T* operator->() { return m_slot; }
+    void operator++() { skip_to_next(); }
+
+private:
+    void skip_to_next()
+    {
+        if (!m_slot)
+            return;
+        do {
+            ++m_slot;
+            ++m_control;
+            if (m_slot == m_end_slot) {
+                m_slot = nullptr;
+                return;
+            }
+        } while (*m_control & 0x80);
+    }
+
+    SwissHashTableIterator(T* slot, u8 const* control, T* end_slot)
+        : m_slot(slot)
+        , m_control(control)
+        , m_end_slot(end_slot)
+    {
+    }
+
+    T* m_slot { nullptr };
+    u8 const* m_control { nullptr };
+    T* m_end_slot { nullptr };
+};
+
+// An open-addressing hash set in the style of Abseil's SwissTable, with the same interface as an unordered HashTable.
+// Each slot has a one-byte control entry, kept in an array apart from the slots, which holds 7 bits of the slot's hash.
+// Lookups compare a whole group of control entries against the hash at once and only ever look at the slots whose
+// control entry matched, so probing rarely touches the slots themselves and long probe sequences stay cheap.
+// Removed slots become tombstones rather than shifting their neighbors, which keeps iterators and references to other
+// entries stable across removals.
+template<typename T, typename TraitsForT, bool IsOrdered>
+class SwissHashTable {
+    static_assert(!IsOrdered, "SwissHashTable doesn't support ordered iteration, use OrderedHashTable instead");
+
+    using Group = Detail::SwissGroup;
+    static constexpr size_t minimum_capacity = 16;
+    static_assert(minimum_capacity % Group::width == 0);
+
+public:
+    SwissHashTable() = default;
+    explicit SwissHashTable(size_t capacity) { ensure_capacity(capacity); }
+
+    ~SwissHashTable()
+    {
+        if (!m_slots)
+            return;
+        destroy_all_slots();
+        kfree_sized(m_slots, size_in_bytes(m_capacity));
+    }
+
+    SwissHashTable(SwissHashTable const& other)
+    {
+        ensure_capacity(other.size());
+        for (auto& it : other)
+            set(it);
+    }
+
+    SwissHashTable& operator=(SwissHashTable const& other)
+    {
+        SwissHashTable temporary(other);
+        swap(*this, temporary);
+        return *this;
+    }
+
+    SwissHashTable(SwissHashTable&& other) noexcept
+        : m_slots(exchange(other.m_slots, nullptr))
+        , m_control(exchange(other.m_control, nullptr))
+        , m_size(exchange(other.m_size, 0))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_growth_left(exchange(other.m_growth_left, 0))
+    {
+    }
+
+    SwissHashTable& operator=(SwissHashTable&& other) noexcept
+    {
+        SwissHashTable temporary { move(other) };
+        swap(*this, temporary);
+        return *this;
+    }
+
+    friend void swap(SwissHashTable& a, SwissHashTable& b) noexcept
+    {
+        swap(a.m_slots, b.m_slots);
+        swap(a.m_control, b.m_control);
+        swap(a.m_size, b.m_size);
+        swap(a.m_capacity, b.m_capacity);
+        swap(a.m_growth_left, b.m_growth_left);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    template<typename U, size_t N>
+    ErrorOr<void> try_set_from(U (&from_array)[N])
+    {
+        for (size_t i = 0; i < N; ++i)
+            TRY(try_set(from_array[i]));
+        return {};
+    }
+    template<typename U, size_t N>
+    void set_from(U (&from_array)[N])
+    {
+        MUST(try_set_from(from_array));
+    }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        if (capacity <= m_size + m_growth_left)
+            return {};
+        return try_rehash(capacity_for_size(capacity));
+    }
+    void ensure_capacity(size_t capacity)
+    {
+        MUST(try_ensure_capacity(capacity));
+    }
+
+    [[nodiscard]] bool contains(T const& value) const
+    {
+        return find(value) != end();
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] bool contains(K const& value) const
+    {
+        return find(value) != end();
+    }
+
+    using Iterator = SwissHashTableIterator<SwissHashTable, T>;
+    using ConstIterator = SwissHashTableIterator<SwissHashTable const, T const>;
+
+    [[nodiscard]] Iterator begin()
+    {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (is_full(m_control[i]))
+                return Iterator(&m_slots[i], &m_control[i], m_slots + m_capacity);
+        }
+        return end();
+    }
+
+    [[nodiscard]] Iterator end()
+    {
+        return Iterator(nullptr, nullptr, nullptr);
+    }
+
+    [[nodiscard]] ConstIterator begin() const
+    {
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (is_full(m_control[i]))
+                return ConstIterator(&m_slots[i], &m_control[i], m_slots + m_capacity);
+        }
+        return end();
+    }
+
+    [[nodiscard]] ConstIterator end() const
+    {
+        return ConstIterator(nullptr, nullptr, nullptr);
+    }
+
+    void clear()
+    {
+        *this = SwissHashTable();
+    }
+
+    void clear_with_capacity()
+    {
+        if (m_capacity == 0)
+            return;
+        destroy_all_slots();
+        __builtin_memset(m_control, Detail::swiss_control_empty, control_size(m_capacity));
+        m_size = 0;
+        m_growth_left = growth_limit(m_capacity);
+    }
+
+    template<typename U = T>
+    ErrorOr<HashSetResult> try_set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        TRY(try_make_room_for_insertion());
+        return write_value(forward<U>(value), existing_entry_behavior);
+    }
+    template<typename U = T>
+    HashSetResult set(U&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace)
+    {
+        return MUST(try_set(forward<U>(value), existing_entry_behavior));
+    }
+
+    template<typename TUnaryPredicate, typename InitializationCallback>
+    [[nodiscard]] T& ensure(unsigned hash, TUnaryPredicate predicate, InitializationCallback initialization_callback, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        MUST(try_make_room_for_insertion());
+
+        auto [result, slot] = lookup_for_writing(hash, move(predicate), existing_entry_behavior);
+        switch (result) {
+        case HashSetResult::InsertedNewEntry:
+            new (&slot) T(initialization_callback());
+            break;
+        case HashSetResult::ReplacedExistingEntry:
+            slot = T(initialization_callback());
+            break;
+        case HashSetResult::KeptExistingEntry:
+            break;
+        default:
+            __builtin_unreachable();
+        }
+        return slot;
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        return iterator_for(lookup_with_hash(hash, move(predicate)));
+    }
+
+    [[nodiscard]] Iterator find(T const& value)
+    {
+        if (is_empty())
+            return end();
+        return find(TraitsForT::hash(value), [&](auto& entry) { return TraitsForT::equals(entry, value); });
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        return iterator_for(lookup_with_hash(hash, move(predicate)));
+    }
+
+    [[nodiscard]] ConstIterator find(T const& value) const
+    {
+        if (is_empty())
+            return end();
+        return find(TraitsForT::hash(value), [&](auto& entry) { return TraitsForT::equals(entry, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value)
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), [&](auto& entry) { return Traits<T>::equals(entry, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K, typename TUnaryPredicate>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] Iterator find(K const& value, TUnaryPredicate predicate)
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), move(predicate));
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value) const
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), [&](auto& entry) { return Traits<T>::equals(entry, value); });
+    }
+
+    template<Concepts::HashCompatible<T> K, typename TUnaryPredicate>
+    requires(IsSame<TraitsForT, Traits<T>>) [[nodiscard]] ConstIterator find(K const& value, TUnaryPredicate predicate) const
+    {
+        if (is_empty())
+            return end();
+        return find(Traits<K>::hash(value), move(predicate));
+    }
+
+    bool remove(T const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    template<Concepts::HashCompatible<T> K>
+    requires(IsSame<TraitsForT, Traits<T>>) bool remove(K const& value)
+    {
+        auto it = find(value);
+        if (it != end()) {
+            remove(it);
+            return true;
+        }
+        return false;
+    }
+
+    // This invalidates the iterator
+    void remove(Iterator& iterator)
+    {
+        VERIFY(iterator.m_slot);
+        delete_slot(iterator.m_slot - m_slots);
+        iterator.m_slot = nullptr;
+    }
+
+    template<typename TUnaryPredicate>
+    bool remove_all_matching(TUnaryPredicate const& predicate)
+    {
+        bool has_removed_anything = false;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (!is_full(m_control[i]) || !predicate(m_slots[i]))
+                continue;
+            delete_slot(i);
+            has_removed_anything = true;
+        }
+        return has_removed_anything;
+    }
+
+    template<typename TUnaryPredicate>
+    Vector<T> take_all_matching(TUnaryPredicate const& predicate)
+    {
+        Vector<T> values;
+        for (size_t i = 0; i < m_capacity; ++i) {
+            if (!is_full(m_control[i]) || !predicate(m_slots[i]))
+                continue;
+            values.append(move(m_slots[i]));
+            delete_slot(i);
+        }
+        return values;
+    }
+
+    [[nodiscard]] Vector<T> values() const
+    {
+        Vector<T> list;
+        list.ensure_capacity(size());
+        for (auto& value : *this)
+            list.unchecked_append(value);
+        return list;
+    }
+
+private:
+    struct SplitHash {
+        size_t h1;
+        u8 h2;
+    };
+
+    // NB: Traits hashes are only 32 bits and often weak in their low bits, so mix them before splitting off the 7 bits
+    //     that go into the control bytes from the bits that pick where to start probing.
+    static SplitHash split_hash(u32 hash)
+    {
+        u64 mixed = static_cast<u64>(hash) * 0x9E3779B97F4A7C15ull;
+        return { static_cast<size_t>(mixed >> 32), static_cast<u8>((mixed >> 25) & 0x7F) };
+    }
+
+    // Visits groups at triangular offsets, which reaches every group since the capacity is a power of two.
+    struct ProbeSequence {
+        ProbeSequence(size_t h1, size_t mask)
+            : mask(mask)
+            , offset(h1 & mask)
+        {
+        }
+
+        void next()
+        {
+            index += Group::width;
+            offset = (offset + index) & mask;
+        }
+
+        size_t mask { 0 };
+        size_t offset { 0 };
+        size_t index { 0 };
+    };
+
+    static constexpr bool is_full(u8 control) { return (control & 0x80) == 0; }
+
+    // Keep at least an eighth of the slots empty, so that every probe sequence ends quickly.
+    static constexpr size_t growth_limit(size_t capacity) { return capacity - capacity / 8; }
+
+    static constexpr size_t capacity_for_size(size_t size)
+    {
+        size_t capacity = minimum_capacity;
+        while (growth_limit(capacity) < size)
+            capacity *= 2;
+        return capacity;
+    }
+
+    // The control bytes of the first group are mirrored after the last slot, so that a group can be loaded starting at
+    // any slot without wrapping around.
+    static constexpr size_t control_size(size_t capacity) { return capacity + Group::width - 1; }
+    static constexpr size_t size_in_bytes(size_t capacity) { return sizeof(T) * capacity + control_size(capacity); }
+
+    void set_control(size_t index, u8 control)
+    {
+        m_control[index] = control;
+        if (index < Group::width - 1)
+            m_control[m_capacity + index] = control;
+    }
+
+    void destroy_all_slots()
+    {
+        if constexpr (!IsTriviallyDestructible<T>) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (is_full(m_control[i]))
+                    m_slots[i].~T();
+            }
+        }
+    }
+
+    Iterator iterator_for(T* slot)
+    {
+        if (!slot)
+            return end();
+        return Iterator(slot, &m_control[slot - m_slots], m_slots + m_capacity);
+    }
+
+    ConstIterator iterator_for(T* slot) const
+    {
+        if (!slot)
+            return end();
+        return ConstIterator(slot, &m_control[slot - m_slots], m_slots + m_capacity);
+    }
+
+    ErrorOr<void> try_make_room_for_insertion()
+    {
+        if (m_growth_left > 0)
+            return {};
+
+        // If most of the used up growth went to tombstones, cleaning those out is enough.
+        if (m_capacity > 0 && m_size * 32 <= m_capacity * 25)
+            return try_rehash(m_capacity);
+        return try_rehash(max(m_capacity * 2, minimum_capacity));
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        VERIFY(is_power_of_two(new_capacity));
+        VERIFY(growth_limit(new_capacity) >= m_size);
+
+        auto* new_slots = static_cast<T*>(kmalloc(size_in_bytes(new_capacity)));
+        if (!new_slots)
+            return Error::from_errno(ENOMEM);
+
+        auto* old_slots = m_slots;
+        auto* old_control = m_control;
+        auto old_capacity = m_capacity;
+
+        m_slots = new_slots;
+        m_control = reinterpret_cast<u8*>(new_slots + new_capacity);
+        m_capacity = new_capacity;
+        m_growth_left = growth_limit(new_capacity) - m_size;
+        __builtin_memset(m_control, Detail::swiss_control_empty, control_size(new_capacity));
+
+        if (!old_slots)
+            return {};
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!is_full(old_control[i]))
+                continue;
+            auto [h1, h2] = split_hash(TraitsForT::hash(old_slots[i]));
+            auto index = find_insert_index(h1);
+            set_control(index, h2);
+            new (&m_slots[index]) T(move(old_slots[i]));
+            old_slots[i].~T();
+        }
+
+        kfree_sized(old_slots, size_in_bytes(old_capacity));
+        return {};
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] T* lookup_with_hash(unsigned hash, TUnaryPredicate predicate) const
+    {
+        if (is_empty())
+            return nullptr;
+
+        auto [h1, h2] = split_hash(hash);
+        for (ProbeSequence probe(h1, m_capacity - 1);; probe.next()) {
+            Group group { m_control + probe.offset };
+            for (auto match = group.match(h2); match; match.clear_lowest()) {
+                auto index = (probe.offset + match.lowest_index()) & probe.mask;
+                if (predicate(m_slots[index]))
+                    return &m_slots[index];
+            }
+            if (group.match_empty())
+                return nullptr;
+        }
+    }
+
+    size_t find_insert_index(size_t h1) const
+    {
+        for (ProbeSequence probe(h1, m_capacity - 1);; probe.next()) {
+            if (auto match = Group { m_control + probe.offset }.match_empty_or_deleted())
+                return (probe.offset + match.lowest_index()) & probe.mask;
+        }
+    }
+
+    struct LookupForWritingResult {
+        HashSetResult result;
+        T& slot;
+    };
+
+    template<typename TUnaryPredicate>
+    LookupForWritingResult lookup_for_writing(u32 hash, TUnaryPredicate predicate, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        if (auto* existing_slot = lookup_with_hash(hash, move(predicate))) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Replace)
+                return { HashSetResult::ReplacedExistingEntry, *existing_slot };
+            return { HashSetResult::KeptExistingEntry, *existing_slot };
+        }
+
+        auto [h1, h2] = split_hash(hash);
+        auto index = find_insert_index(h1);
+
+        // Reusing a tombstone doesn't bring us any closer to having to grow.
+        if (m_control[index] == Detail::swiss_control_empty)
+            --m_growth_left;
+        set_control(index, h2);
+        ++m_size;
+        return { HashSetResult::InsertedNewEntry, m_slots[index] };
+    }
+
+    template<typename U = T>
+    HashSetResult write_value(U&& value, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        u32 const hash = TraitsForT::hash(value);
+        auto [result, slot] = lookup_for_writing(hash, [&](auto& candidate) { return TraitsForT::equals(candidate, static_cast<T const&>(value)); }, existing_entry_behavior);
+        switch (result) {
+        case HashSetResult::ReplacedExistingEntry:
+            slot = forward<U>(value);
+            break;
+        case HashSetResult::InsertedNewEntry:
+            new (&slot) T(forward<U>(value));
+            break;
+        case HashSetResult::KeptExistingEntry:
+            break;
+        default:
+            __builtin_unreachable();
+        }
+        return result;
+    }
+
+    void delete_slot(size_t index)
+    {
+        VERIFY(is_full(m_control[index]));
+        m_slots[index].~T();
+        set_control(index, Detail::swiss_control_deleted);
+        --m_size;
+    }
+
+    T* m_slots { nullptr };
+    u8* m_control { nullptr };
+    size_t m_size { 0 };
+    size_t m_capacity { 0 };
+    size_t m_growth_left { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::SwissHashMap;
+using AK::SwissHashTable;
+#endif
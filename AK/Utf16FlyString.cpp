@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/HashTable.h>
+#include <AK/InternTable.h>
 #include <AK/Singleton.h>
 #include <AK/Utf16FlyString.h>
 
@@ -18,7 +18,7 @@ struct Utf16FlyStringTableHashTraits : public Traits<Detail::Utf16StringData con
 
 static auto& all_utf16_fly_strings()
 {
-    static Singleton<HashTable<Detail::Utf16StringData const*, Utf16FlyStringTableHashTraits>> table;
+    static Singleton<Detail::InternTable<Detail::Utf16StringData, Utf16FlyStringTableHashTraits>> table;
     return *table;
 }
 
@@ -26,7 +26,10 @@ namespace Detail {
 
 void did_destroy_utf16_fly_string_data(Badge<Detail::Utf16StringData>, Detail::Utf16StringData const& data)
 {
-    all_utf16_fly_strings().remove(&data);
+    all_utf16_fly_strings().with_shard(data.hash(), [&](auto& table) {
+        if (auto it = table.find(data.hash(), [&](auto const* entry) { return entry == &data; }); it != table.end())
+            table.remove(it);
+    });
 }
 
 }
@@ -45,10 +48,18 @@ Optional<Utf16FlyString> Utf16FlyString::create_fly_string_from_cache(ViewType c
             return Utf16String::from_utf16(string);
     }
 
-    if (auto it = all_utf16_fly_strings().find(string.hash(), [&](auto const& entry) { return *entry == string; }); it != all_utf16_fly_strings().end())
-        return Utf16FlyString { Detail::Utf16StringBase(**it) };
-
-    return {};
+    auto hash = string.hash();
+    return all_utf16_fly_strings().with_shard(hash, [&](auto& table) -> Optional<Utf16FlyString> {
+        auto it = table.find(hash, [&](auto const& entry) { return *entry == string; });
+        if (it == table.end())
+            return {};
+
+        // NB: The entry's last reference may have just been dropped on another thread, in which case it will be removed
+        //     from the table as soon as we release the lock.
+        if (!(*it)->try_ref())
+            return {};
+        return Utf16FlyString { Detail::Utf16StringBase(adopt_ref(**it)) };
+    });
 }
 
 Utf16FlyString Utf16FlyString::from_utf8(StringView string)
@@ -86,14 +97,19 @@ Utf16FlyString::Utf16FlyString(Utf16String const& string)
         return;
     }
 
-    if (auto it = all_utf16_fly_strings().find(data); it == all_utf16_fly_strings().end()) {
+    all_utf16_fly_strings().with_shard(data->hash(), [&](auto& table) {
+        if (auto it = table.find(data); it != table.end() && (*it)->try_ref()) {
+            m_data = Detail::Utf16StringBase(adopt_ref(**it));
+            return;
+        }
+
+        // NB: If an entry exists, it is being destroyed on another thread. Replacing it is fine, as entries are removed
+        //     by identity.
         m_data = string;
 
-        all_utf16_fly_strings().set(data);
+        table.set(data);
         data->mark_as_fly_string({});
-    } else {
-        m_data.set_data({}, *it);
-    }
+    });
 }
 
 size_t Utf16FlyString::number_of_utf16_fly_strings()
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/NumericLimits.h>
 #include <AK/RefCounted.h>
@@ -18,7 +19,9 @@ namespace AK::Detail {
 
 void did_destroy_utf16_fly_string_data(Badge<Detail::Utf16StringData>, Detail::Utf16StringData const&);
 
-class Utf16StringData final : public RefCounted<Utf16StringData> {
+// NB: The reference count is atomic, as interned string data may be looked up on one thread while its last reference
+//     is dropped on another.
+class Utf16StringData final : public AtomicRefCounted<Utf16StringData> {
 public:
     enum class StorageType : u8 {
         ASCII,
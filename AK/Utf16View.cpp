@@ -266,6 +266,35 @@ Optional<size_t> Utf16View::find_code_unit_offset(char16_t needle, size_t start_
     return result - start + start_offset;
 }
 
+Optional<size_t> Utf16View::find_code_unit_offset_by_scanning_for_first_code_unit(Utf16View const& needle, size_t start_offset) const
+{
+    Checked maximum_offset { start_offset };
+    maximum_offset += needle.length_in_code_units();
+    if (maximum_offset.has_overflow() || maximum_offset.value() > length_in_code_units())
+        return {};
+
+    if (needle.is_empty())
+        return start_offset;
+
+    // OPTIMIZATION: Use the vectorized single code unit search to skip ahead to candidates that start with the
+    //               needle's first code unit, and only compare the whole needle at those offsets.
+    auto first_code_unit = needle.code_unit_at(0);
+    auto last_candidate_offset = length_in_code_units() - needle.length_in_code_units();
+
+    for (auto offset = start_offset; offset <= last_candidate_offset;) {
+        auto candidate_offset = find_code_unit_offset(first_code_unit, offset);
+        if (!candidate_offset.has_value() || *candidate_offset > last_candidate_offset)
+            return {};
+
+        if (substring_view(*candidate_offset, needle.length_in_code_units()) == needle)
+            return candidate_offset;
+
+        offset = *candidate_offset + 1;
+    }
+
+    return {};
+}
+
 Optional<size_t> Utf16View::find_last_code_point_offset(u32 needle, size_t end_offset) const
 {
     if (end_offset == 0)
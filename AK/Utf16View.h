@@ -489,6 +489,9 @@ public:
 
     constexpr Optional<size_t> find_code_unit_offset(Utf16View const& needle, size_t start_offset = 0) const
     {
+        if (!is_constant_evaluated())
+            return find_code_unit_offset_by_scanning_for_first_code_unit(needle, start_offset);
+
         if (has_ascii_storage() && needle.has_ascii_storage())
             return ascii_span().index_of(needle.ascii_span(), start_offset);
         if (!has_ascii_storage() && !needle.has_ascii_storage())
@@ -666,6 +669,7 @@ private:
     }
 
     [[nodiscard]] size_t calculate_length_in_code_points() const;
+    Optional<size_t> find_code_unit_offset_by_scanning_for_first_code_unit(Utf16View const& needle, size_t start_offset) const;
 
     union {
         char const* ascii;
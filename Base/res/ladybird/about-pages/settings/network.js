@@ -70,9 +70,10 @@ function updateDnsSettings() {
         return;
     }
 
-    dnsPort.placeholder = dnsType.value === "tls" ? "853" : "53";
+    const previousPlaceholder = dnsPort.placeholder;
+    dnsPort.placeholder = { tls: "853", https: "443" }[dnsType.value] || "53";
 
-    if ((dnsPort.value || 0) === 0) {
+    if ((dnsPort.value || 0) === 0 || dnsPort.value === previousPlaceholder) {
         dnsPort.value = dnsPort.placeholder;
     }
 
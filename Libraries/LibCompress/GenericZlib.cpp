@@ -68,6 +68,23 @@ GenericZlibDecompressor::~GenericZlibDecompressor()
 }
 
 ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
+{
+    auto result = TRY(inflate_available_input(bytes));
+
+    // We got Z_BUF_ERROR (no progress was possible), no more input, stream is EOF and no output was produced.
+    // There is no way to get out of this loop, error out.
+    if (!result.made_progress && m_zstream->avail_in == 0 && m_stream->is_eof())
+        return Error::from_string_literal("No decompression progress on EOF stream");
+
+    return result.output;
+}
+
+ErrorOr<Bytes> GenericZlibDecompressor::decompress_available_input(Bytes bytes)
+{
+    return TRY(inflate_available_input(bytes)).output;
+}
+
+ErrorOr<GenericZlibDecompressor::InflateResult> GenericZlibDecompressor::inflate_available_input(Bytes bytes)
 {
     m_zstream->avail_out = bytes.size();
     m_zstream->next_out = bytes.data();
@@ -83,10 +100,8 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
     if (ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
         return handle_zlib_error(ret);
 
-    // We got Z_BUF_ERROR (no progress was possible), no more input, stream is EOF and no output was produced.
-    // There is no way to get out of this loop, error out.
-    if (ret == Z_BUF_ERROR && m_zstream->avail_in == 0 && m_stream->is_eof() && bytes.size() == m_zstream->avail_out)
-        return Error::from_string_literal("No decompression progress on EOF stream");
+    auto output = bytes.slice(0, bytes.size() - m_zstream->avail_out);
+    auto made_progress = ret != Z_BUF_ERROR || !output.is_empty();
 
     if (ret == Z_STREAM_END) {
         inflateReset(m_zstream);
@@ -94,7 +109,7 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
             m_eof = true;
     }
 
-    return bytes.slice(0, bytes.size() - m_zstream->avail_out);
+    return InflateResult { output, made_progress };
 }
 
 ErrorOr<size_t> GenericZlibDecompressor::write_some(ReadonlyBytes)
@@ -36,12 +36,22 @@ public:
     virtual bool is_open() const override;
     virtual void close() override;
 
+    // Decompresses as much of the currently available input as fits in the given buffer. Unlike read_some, running out
+    // of input is not an error, as the underlying stream may be fed more data later.
+    ErrorOr<Bytes> decompress_available_input(Bytes);
+
 protected:
     GenericZlibDecompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
 
     static ErrorOr<z_stream*> new_z_stream(int window_bits);
 
 private:
+    struct InflateResult {
+        Bytes output;
+        bool made_progress { false };
+    };
+    ErrorOr<InflateResult> inflate_available_input(Bytes);
+
     MaybeOwned<Stream> m_stream;
     z_stream* m_zstream;
 
@@ -22,6 +22,16 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+// Where the kernel offers a persistent interest list, use it so that waiting costs time proportional to the number of
+// ready file descriptors rather than the number of registered notifiers. poll() remains the portable fallback.
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USE_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_BSD_GENERIC) && !defined(AK_OS_SOLARIS)
+#    define EVENT_LOOP_USE_KQUEUE
+#    include <sys/event.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -34,6 +44,7 @@ Threading::RWLock s_thread_data_lock;
 thread_local pthread_t s_thread_id;
 thread_local OwnPtr<ThreadData> s_this_thread_data;
 
+#if !defined(EVENT_LOOP_USE_EPOLL) && !defined(EVENT_LOOP_USE_KQUEUE)
 short notification_type_to_poll_events(NotificationType type)
 {
     short events = 0;
@@ -48,6 +59,45 @@ bool has_flag(int value, int flag)
 {
     return (value & flag) == flag;
 }
+#endif
+
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+static constexpr size_t max_events_per_wait = 64;
+
+NotificationType combined_notification_type(Vector<Notifier*, 1> const& notifiers)
+{
+    NotificationType type = NotificationType::None;
+    for (auto* notifier : notifiers)
+        type |= notifier->type();
+    return type;
+}
+#endif
+
+#if defined(EVENT_LOOP_USE_EPOLL)
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+
+NotificationType epoll_events_to_notification_type(u32 events)
+{
+    NotificationType type = NotificationType::None;
+    if (events & EPOLLIN)
+        type |= NotificationType::Read;
+    if (events & EPOLLOUT)
+        type |= NotificationType::Write;
+    if (events & EPOLLHUP)
+        type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+    if (events & EPOLLERR)
+        type |= NotificationType::Error;
+    return type;
+}
+#endif
 
 class EventLoopTimeout {
 public:
@@ -256,25 +306,372 @@ struct ThreadData {
 
         wake_pipe_fds = result.release_value();
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        create_event_queue();
+
+        static auto const fork_handler_registered = [] {
+            pthread_atfork(nullptr, nullptr, [] {
+                if (s_this_thread_data)
+                    s_this_thread_data->recreate_event_queue_after_fork();
+            });
+            return true;
+        }();
+        (void)fork_handler_registered;
+#else
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifiers.append(nullptr);
+#endif
     }
 
     ~ThreadData()
     {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        if (event_queue_fd >= 0)
+            close(event_queue_fd);
+#endif
+
         Threading::RWLockLocker<Threading::LockMode::Write> locker(s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
     }
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    void create_event_queue()
+    {
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        event_queue_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (event_queue_fd < 0) {
+            warnln("\033[31;1mFailed to create event loop epoll instance:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+        epoll_event wake_event {};
+        wake_event.events = EPOLLIN;
+        wake_event.data.fd = wake_pipe_fds[0];
+        if (epoll_ctl(event_queue_fd, EPOLL_CTL_ADD, wake_pipe_fds[0], &wake_event) < 0) {
+            warnln("\033[31;1mFailed to watch event loop pipe:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+#    elif defined(EVENT_LOOP_USE_KQUEUE)
+        event_queue_fd = kqueue();
+        if (event_queue_fd < 0) {
+            warnln("\033[31;1mFailed to create event loop kqueue:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        // NB: Not every system that we support has kqueue1(), so close-on-exec is set separately.
+        if (fcntl(event_queue_fd, F_SETFD, FD_CLOEXEC) < 0) {
+            warnln("\033[31;1mFailed to make event loop kqueue close-on-exec:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+        struct kevent wake_event;
+        EV_SET(&wake_event, wake_pipe_fds[0], EVFILT_READ, EV_ADD, 0, 0, nullptr);
+        if (kevent(event_queue_fd, &wake_event, 1, nullptr, 0, nullptr) < 0) {
+            warnln("\033[31;1mFailed to watch event loop pipe:\033[0m {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+#    endif
+    }
+
+    // A child process shares its parent's epoll instance, so any change it makes would also affect the parent, while a
+    // kqueue is not inherited at all. Either way, the child needs an event queue of its own, with the file descriptors
+    // of its notifiers registered again.
+    void recreate_event_queue_after_fork()
+    {
+        pid = getpid();
+
+#    if defined(EVENT_LOOP_USE_EPOLL)
+        close(event_queue_fd);
+        always_ready_fds.clear();
+#    endif
+        create_event_queue();
+
+        for (auto const& [fd, fd_notifiers] : notifiers_by_fd)
+            update_watched_fd(fd, {}, combined_notification_type(fd_notifiers));
+    }
+#endif
+
+    void add_notifier(Notifier& notifier)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        // Several notifiers may watch the same file descriptor (e.g. one for reading and one for writing), but the kernel
+        // only keeps one registration per descriptor. Register the union of what they are interested in.
+        auto& fd_notifiers = notifiers_by_fd.ensure(notifier.fd());
+        Optional<NotificationType> previous_type;
+        if (!fd_notifiers.is_empty())
+            previous_type = combined_notification_type(fd_notifiers);
+
+        fd_notifiers.append(&notifier);
+        update_watched_fd(notifier.fd(), previous_type, combined_notification_type(fd_notifiers));
+#else
+        notifier_to_index.set(&notifier, poll_fds.size());
+        notifiers.append(&notifier);
+
+        auto events = notification_type_to_poll_events(notifier.type());
+        poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+#endif
+    }
+
+    void remove_notifier(Notifier& notifier)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+        auto it = notifiers_by_fd.find(notifier.fd());
+        VERIFY(it != notifiers_by_fd.end());
+
+        auto previous_type = combined_notification_type(it->value);
+        VERIFY(it->value.remove_first_matching([&](auto* fd_notifier) { return fd_notifier == &notifier; }));
+
+        if (it->value.is_empty()) {
+            notifiers_by_fd.remove(it);
+            update_watched_fd(notifier.fd(), previous_type, {});
+        } else {
+            update_watched_fd(notifier.fd(), previous_type, combined_notification_type(it->value));
+        }
+#else
+        auto notifier_index = notifier_to_index.take(&notifier).release_value();
+
+        if (notifier_index + 1 < poll_fds.size()) {
+            swap(notifiers[notifier_index], notifiers.last());
+            swap(poll_fds[notifier_index], poll_fds.last());
+
+            auto* swapped_notifier = notifiers[notifier_index];
+            notifier_to_index.set(swapped_notifier, notifier_index);
+        }
+
+        notifiers.take_last();
+        poll_fds.take_last();
+#endif
+    }
+
+    // Waits for file descriptor activity and returns the number of ready entries.
+    ErrorOr<size_t> wait_for_ready_fds(int timeout_ms)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL)
+        // epoll does not accept regular files, which poll() would always report as ready.
+        if (!always_ready_fds.is_empty())
+            timeout_ms = 0;
+
+        auto count = epoll_wait(event_queue_fd, ready_events.data(), static_cast<int>(ready_events.size()), timeout_ms);
+        if (count < 0)
+            return Error::from_errno(errno);
+        return static_cast<size_t>(count);
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        timespec timeout {};
+        if (timeout_ms >= 0) {
+            timeout.tv_sec = timeout_ms / 1000;
+            timeout.tv_nsec = (timeout_ms % 1000) * 1'000'000;
+        }
+
+        auto count = kevent(event_queue_fd, nullptr, 0, ready_events.data(), static_cast<int>(ready_events.size()), timeout_ms >= 0 ? &timeout : nullptr);
+        if (count < 0)
+            return Error::from_errno(errno);
+        return static_cast<size_t>(count);
+#else
+        return static_cast<size_t>(TRY(System::poll(poll_fds, timeout_ms)));
+#endif
+    }
+
+    bool has_wake_event(size_t ready_count) const
+    {
+#if defined(EVENT_LOOP_USE_EPOLL)
+        for (size_t i = 0; i < ready_count; ++i) {
+            if (ready_events[i].data.fd == wake_pipe_fds[0] && (ready_events[i].events & EPOLLIN))
+                return true;
+        }
+        return false;
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        for (size_t i = 0; i < ready_count; ++i) {
+            if (static_cast<int>(ready_events[i].ident) == wake_pipe_fds[0] && ready_events[i].filter == EVFILT_READ)
+                return true;
+        }
+        return false;
+#else
+        (void)ready_count;
+        return has_flag(poll_fds[0].revents, POLLIN);
+#endif
+    }
+
+    // Turns file system activity into normal events.
+    void post_notifier_activations(size_t ready_count)
+    {
+#if defined(EVENT_LOOP_USE_EPOLL)
+        auto post_activations = [&](int fd, NotificationType type) {
+            auto it = notifiers_by_fd.find(fd);
+            if (it == notifiers_by_fd.end())
+                return;
+            for (auto* notifier : it->value) {
+                if ((type & notifier->type()) != NotificationType::None)
+                    ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
+            }
+        };
+
+        for (size_t i = 0; i < ready_count; ++i) {
+            auto fd = ready_events[i].data.fd;
+            if (fd == wake_pipe_fds[0])
+                continue;
+            post_activations(fd, epoll_events_to_notification_type(ready_events[i].events));
+        }
+
+        for (auto fd : always_ready_fds)
+            post_activations(fd, NotificationType::Read | NotificationType::Write);
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+        // Reading and writing are separate filters, so one file descriptor may show up twice. Merge them so that each
+        // notifier is activated at most once per wait, like it would be with poll().
+        ready_types_by_fd.clear_with_capacity();
+        for (size_t i = 0; i < ready_count; ++i) {
+            auto const& event = ready_events[i];
+            auto fd = static_cast<int>(event.ident);
+            if (fd == wake_pipe_fds[0])
+                continue;
+
+            NotificationType type = NotificationType::None;
+            if (event.filter == EVFILT_READ)
+                type |= NotificationType::Read;
+            if (event.filter == EVFILT_WRITE)
+                type |= NotificationType::Write;
+            if (event.flags & EV_EOF)
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (event.flags & EV_ERROR)
+                type |= NotificationType::Error;
+
+            ready_types_by_fd.ensure(fd, [] { return NotificationType::None; }) |= type;
+        }
+
+        for (auto const& ready : ready_types_by_fd) {
+            auto it = notifiers_by_fd.find(ready.key);
+            if (it == notifiers_by_fd.end())
+                continue;
+            for (auto* notifier : it->value) {
+                if ((ready.value & notifier->type()) != NotificationType::None)
+                    ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
+            }
+        }
+#else
+        if (ready_count == 0)
+            return;
+
+        for (size_t i = 1; i < poll_fds.size(); ++i) {
+            auto& notifier = *notifiers[i];
+
+#    ifdef AK_OS_ANDROID
+            // FIXME: Make the check work under Android, perhaps use ALooper.
+            ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
+#    else
+            auto revents = poll_fds[i].revents;
+
+            NotificationType type = NotificationType::None;
+            if (has_flag(revents, POLLIN))
+                type |= NotificationType::Read;
+            if (has_flag(revents, POLLOUT))
+                type |= NotificationType::Write;
+            if (has_flag(revents, POLLHUP))
+                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
+            if (has_flag(revents, POLLERR))
+                type |= NotificationType::Error;
+
+            type &= notifier.type();
+
+            if (type != NotificationType::None)
+                ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
+#    endif
+        }
+#endif
+    }
+
+#if defined(EVENT_LOOP_USE_EPOLL)
+    // An empty type still watches for hangups and errors, which epoll always reports.
+    void update_watched_fd(int fd, Optional<NotificationType> previous_type, Optional<NotificationType> type)
+    {
+        if (!type.has_value()) {
+            // NB: The registration belongs to the open file description rather than to the file descriptor, so it outlives
+            //     a close() if the description is still open elsewhere (e.g. after dup() or fork()). Notifiers must
+            //     therefore be disabled before their file descriptor is closed, and failing to unregister is a bug.
+            auto was_always_ready = always_ready_fds.remove(fd);
+            if (!was_always_ready && epoll_ctl(event_queue_fd, EPOLL_CTL_DEL, fd, nullptr) < 0)
+                dbgln("EventLoopImplementationUnix: Unable to stop watching fd {}: {}", fd, Error::from_errno(errno));
+            return;
+        }
+
+        if (always_ready_fds.contains(fd))
+            return;
+
+        epoll_event event {};
+        event.events = notification_type_to_epoll_events(*type);
+        event.data.fd = fd;
+
+        auto operation = previous_type.has_value() ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+        if (epoll_ctl(event_queue_fd, operation, fd, &event) == 0)
+            return;
+
+        // Our view of the interest list is stale if a file descriptor was closed and its number reused while a notifier
+        // was still enabled for it. That is a bug in the notifier's owner, but we can still watch the new file.
+        if (errno == ENOENT && operation == EPOLL_CTL_MOD) {
+            if (epoll_ctl(event_queue_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+                return;
+        } else if (errno == EEXIST && operation == EPOLL_CTL_ADD) {
+            if (epoll_ctl(event_queue_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+                return;
+        }
+
+        if (errno == EPERM) {
+            always_ready_fds.set(fd);
+            return;
+        }
+
+        dbgln("EventLoopImplementationUnix: Unable to watch fd {}: {}", fd, Error::from_errno(errno));
+    }
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+    // Hangups and errors are reported through the read filter, so watch for reading unless only writing was asked for.
+    static bool wants_read_filter(NotificationType type) { return has_flag(type, NotificationType::Read) || !has_flag(type, NotificationType::Write); }
+    static bool wants_write_filter(NotificationType type) { return has_flag(type, NotificationType::Write); }
+
+    void update_watched_fd(int fd, Optional<NotificationType> previous_type, Optional<NotificationType> type)
+    {
+        auto update_filter = [&](short filter, bool was_watched, bool is_watched) {
+            if (was_watched == is_watched)
+                return;
+
+            struct kevent change;
+            EV_SET(&change, fd, filter, is_watched ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+
+            if (kevent(event_queue_fd, &change, 1, nullptr, 0, nullptr) == 0)
+                return;
+
+            // NB: Notifiers must be disabled before their file descriptor is closed, so failing to delete a filter is a bug.
+            if (is_watched)
+                dbgln("EventLoopImplementationUnix: Unable to watch fd {}: {}", fd, Error::from_errno(errno));
+            else
+                dbgln("EventLoopImplementationUnix: Unable to stop watching fd {}: {}", fd, Error::from_errno(errno));
+        };
+
+        update_filter(EVFILT_READ, previous_type.has_value() && wants_read_filter(*previous_type), type.has_value() && wants_read_filter(*type));
+        update_filter(EVFILT_WRITE, previous_type.has_value() && wants_write_filter(*previous_type), type.has_value() && wants_write_filter(*type));
+    }
+#endif
+
     Threading::Mutex mutex;
 
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
+#if defined(EVENT_LOOP_USE_EPOLL) || defined(EVENT_LOOP_USE_KQUEUE)
+    int event_queue_fd { -1 };
+    HashMap<int, Vector<Notifier*, 1>> notifiers_by_fd;
+#endif
+#if defined(EVENT_LOOP_USE_EPOLL)
+    Array<epoll_event, max_events_per_wait> ready_events;
+    HashTable<int> always_ready_fds;
+#elif defined(EVENT_LOOP_USE_KQUEUE)
+    Array<struct kevent, max_events_per_wait> ready_events;
+    HashMap<int, NotificationType> ready_types_by_fd;
+#else
     HashMap<Notifier*, size_t> notifier_to_index;
     Vector<Notifier*, 32> notifiers;
     Vector<pollfd, 32> poll_fds;
+#endif
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -349,8 +746,8 @@ retry:
     }
 
 try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+    // Wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    auto error_or_marked_fd_count = thread_data.wait_for_ready_fds(should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
     // Because POSIX, we might spuriously return from select() with EINTR; just select again.
     if (error_or_marked_fd_count.is_error()) {
@@ -362,7 +759,7 @@ try_select_again:
 
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (thread_data.has_wake_event(error_or_marked_fd_count.value())) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -391,34 +788,7 @@ try_select_again:
             goto retry;
     }
 
-    if (error_or_marked_fd_count.value() != 0) {
-        // Handle file system notifiers by making them normal events.
-        for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
-            auto& notifier = *thread_data.notifiers[i];
-
-#ifdef AK_OS_ANDROID
-            // FIXME: Make the check work under Android, perhaps use ALooper.
-            ThreadEventQueue::current().post_event(notifier, Core::Event::Type::NotifierActivation);
-#else
-            auto revents = thread_data.poll_fds[i].revents;
-
-            NotificationType type = NotificationType::None;
-            if (has_flag(revents, POLLIN))
-                type |= NotificationType::Read;
-            if (has_flag(revents, POLLOUT))
-                type |= NotificationType::Write;
-            if (has_flag(revents, POLLHUP))
-                type |= NotificationType::Read | NotificationType::Write | NotificationType::HangUp;
-            if (has_flag(revents, POLLERR))
-                type |= NotificationType::Error;
-
-            type &= notifier.type();
-
-            if (type != NotificationType::None)
-                ThreadEventQueue::current().post_event(&notifier, Core::Event::Type::NotifierActivation);
-#endif
-        }
-    }
+    thread_data.post_notifier_activations(error_or_marked_fd_count.value());
 
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
@@ -641,11 +1011,7 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
     auto& thread_data = ThreadData::the();
     Threading::MutexLocker locker(thread_data.mutex);
 
-    thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
-    thread_data.notifiers.append(&notifier);
-
-    auto events = notification_type_to_poll_events(notifier.type());
-    thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+    thread_data.add_notifier(notifier);
 
     notifier.set_owner_thread(s_thread_id);
 }
@@ -658,18 +1024,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
         return;
     Threading::MutexLocker thread_data_content_locker(thread_data->mutex);
 
-    auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
-
-    if (notifier_index + 1 < thread_data->poll_fds.size()) {
-        swap(thread_data->notifiers[notifier_index], thread_data->notifiers.last());
-        swap(thread_data->poll_fds[notifier_index], thread_data->poll_fds.last());
-
-        auto* swapped_notifier = thread_data->notifiers[notifier_index];
-        thread_data->notifier_to_index.set(swapped_notifier, notifier_index);
-    }
-
-    thread_data->notifiers.take_last();
-    thread_data->poll_fds.take_last();
+    thread_data->remove_notifier(notifier);
 }
 
 void EventLoopManagerUnix::did_post_event()
@@ -25,6 +25,8 @@ LocalServer::LocalServer() = default;
 
 LocalServer::~LocalServer()
 {
+    if (m_notifier)
+        m_notifier->close();
     if (m_fd >= 0)
         ::close(m_fd);
 }
@@ -36,6 +36,8 @@ TCPServer::TCPServer(int fd)
 
 TCPServer::~TCPServer()
 {
+    if (m_notifier)
+        m_notifier->close();
     MUST(Core::System::close(m_fd));
 }
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/MultiProducerQueue.h>
 #include <AK/Vector.h>
 #include <LibCore/EventLoopImplementation.h>
 #include <LibCore/EventReceiver.h>
@@ -40,8 +41,11 @@ struct ThreadEventQueue::Private {
         u8 event_type { Event::Type::Invalid };
     };
 
+    // OPTIMIZATION: Events are posted from other threads all the time (IPC, background actions), so they go through a
+    //               lock-free queue instead of contending with the event loop for a mutex.
+    MultiProducerQueue<QueuedEvent> queued_events;
+
     Threading::Mutex mutex;
-    Vector<QueuedEvent> queued_events;
     Vector<NonnullRefPtr<Promise<NonnullRefPtr<EventReceiver>>>, 16> pending_promises;
 };
 
@@ -79,19 +83,13 @@ ThreadEventQueue::~ThreadEventQueue() = default;
 
 void ThreadEventQueue::post_event(Core::EventReceiver* receiver, Core::Event::Type event_type)
 {
-    {
-        Threading::MutexLocker lock(m_private->mutex);
-        m_private->queued_events.empend(receiver, event_type);
-    }
+    m_private->queued_events.push(receiver, event_type);
     Core::EventLoopManager::the().did_post_event();
 }
 
 void ThreadEventQueue::deferred_invoke(Function<void()>&& invokee)
 {
-    {
-        Threading::MutexLocker lock(m_private->mutex);
-        m_private->queued_events.empend(move(invokee));
-    }
+    m_private->queued_events.push(move(invokee));
     Core::EventLoopManager::the().did_post_event();
 }
 
@@ -112,14 +110,12 @@ void ThreadEventQueue::cancel_all_pending_jobs()
 
 size_t ThreadEventQueue::process()
 {
-    decltype(m_private->queued_events) events;
     {
         Threading::MutexLocker locker(m_private->mutex);
-        events = move(m_private->queued_events);
         m_private->pending_promises.remove_all_matching([](auto& job) { return job->is_resolved() || job->is_rejected(); });
     }
 
-    for (auto& queued_event : events) {
+    return m_private->queued_events.take_all([](Private::QueuedEvent&& queued_event) {
         if (auto receiver = queued_event.receiver.strong_ref()) {
             switch (queued_event.event_type) {
             case Event::Type::Timer: {
@@ -142,14 +138,11 @@ size_t ThreadEventQueue::process()
                 // Receiver gone, drop the event.
             }
         }
-    }
-
-    return events.size();
+    });
 }
 
 bool ThreadEventQueue::has_pending_events() const
 {
-    Threading::MutexLocker locker(m_private->mutex);
     return !m_private->queued_events.is_empty();
 }
 
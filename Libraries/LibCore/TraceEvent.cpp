@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCore/Environment.h>
+#include <LibCore/Process.h>
+#include <LibCore/System.h>
+#include <LibCore/TraceEvent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace Core {
+
+namespace Detail {
+
+Atomic<u32> g_enabled_trace_categories { 0 };
+
+}
+
+namespace {
+
+// A spin lock is enough here, since every critical section is short and the locks are almost never contended: each
+// thread only ever records into its own buffer, and the buffers are only read when flushing.
+class SpinLock {
+public:
+    void lock()
+    {
+        while (m_locked.exchange(true, AK::MemoryOrder::memory_order_acquire)) {
+            while (m_locked.load(AK::MemoryOrder::memory_order_relaxed))
+                atomic_pause();
+        }
+    }
+
+    void unlock() { m_locked.store(false, AK::MemoryOrder::memory_order_release); }
+
+private:
+    Atomic<bool> m_locked { false };
+};
+
+class SpinLocker {
+public:
+    explicit SpinLocker(SpinLock& lock)
+        : m_lock(lock)
+    {
+        m_lock.lock();
+    }
+
+    ~SpinLocker() { m_lock.unlock(); }
+
+private:
+    SpinLock& m_lock;
+};
+
+struct TraceEvent {
+    char const* name { nullptr };
+    TraceCategory category { TraceCategory::None };
+    i64 start_nanoseconds { 0 };
+    i64 duration_nanoseconds { 0 };
+    Optional<u64> async_id;
+};
+
+// The events of one thread. Once it is full, the oldest events are overwritten, so a long session keeps its most recent
+// events without growing without bound.
+struct ThreadTraceBuffer {
+    static constexpr size_t capacity = 64 * KiB;
+
+    SpinLock lock;
+    u32 thread_id { 0 };
+    Vector<TraceEvent> events;
+    size_t next_index { 0 };
+};
+
+struct TraceState {
+    SpinLock lock;
+    Vector<NonnullOwnPtr<ThreadTraceBuffer>> buffers;
+    ByteString path;
+};
+
+}
+
+// NB: This is deliberately leaked, so that the events are still around when they are flushed while the process exits.
+static TraceState& trace_state()
+{
+    static auto* state = new TraceState;
+    return *state;
+}
+
+static thread_local ThreadTraceBuffer* t_buffer = nullptr;
+
+static ThreadTraceBuffer& buffer_for_current_thread()
+{
+    if (t_buffer)
+        return *t_buffer;
+
+    auto& state = trace_state();
+    SpinLocker locker { state.lock };
+
+    auto buffer = make<ThreadTraceBuffer>();
+    buffer->thread_id = state.buffers.size() + 1;
+    buffer->events.ensure_capacity(ThreadTraceBuffer::capacity);
+
+    t_buffer = buffer.ptr();
+    state.buffers.append(move(buffer));
+    return *t_buffer;
+}
+
+static StringView category_name(TraceCategory category)
+{
+    switch (category) {
+    case TraceCategory::Style:
+        return "style"sv;
+    case TraceCategory::Layout:
+        return "layout"sv;
+    case TraceCategory::Painting:
+        return "painting"sv;
+    case TraceCategory::GC:
+        return "gc"sv;
+    case TraceCategory::IPC:
+        return "ipc"sv;
+    case TraceCategory::Network:
+        return "network"sv;
+    case TraceCategory::ImageDecoding:
+        return "image-decoding"sv;
+    default:
+        return "unknown"sv;
+    }
+}
+
+static TraceCategory categories_from_string(StringView string)
+{
+    auto categories = TraceCategory::None;
+    string.for_each_split_view(',', SplitBehavior::Nothing, [&](StringView name) {
+        name = name.trim_whitespace();
+        for (u32 bit = 1; bit & to_underlying(TraceCategory::All); bit <<= 1) {
+            if (category_name(static_cast<TraceCategory>(bit)) == name)
+                categories |= static_cast<TraceCategory>(bit);
+        }
+        if (name == "all"sv)
+            categories |= TraceCategory::All;
+    });
+    return categories;
+}
+
+void enable_tracing(TraceCategory categories)
+{
+    Detail::g_enabled_trace_categories.store(to_underlying(categories), AK::MemoryOrder::memory_order_relaxed);
+}
+
+static void record(TraceEvent const& event)
+{
+    auto& buffer = buffer_for_current_thread();
+
+    SpinLocker locker { buffer.lock };
+    if (buffer.events.size() < ThreadTraceBuffer::capacity)
+        buffer.events.unchecked_append(event);
+    else
+        buffer.events[buffer.next_index] = event;
+    buffer.next_index = (buffer.next_index + 1) % ThreadTraceBuffer::capacity;
+}
+
+void record_trace_event(TraceCategory category, char const* name, MonotonicTime start, MonotonicTime end)
+{
+    record({
+        .name = name,
+        .category = category,
+        .start_nanoseconds = start.nanoseconds(),
+        .duration_nanoseconds = (end - start).to_nanoseconds(),
+    });
+}
+
+void record_async_trace_event(TraceCategory category, char const* name, u64 id, MonotonicTime start, MonotonicTime end)
+{
+    record({
+        .name = name,
+        .category = category,
+        .start_nanoseconds = start.nanoseconds(),
+        .duration_nanoseconds = (end - start).to_nanoseconds(),
+        .async_id = id,
+    });
+}
+
+static void append_microseconds(StringBuilder& builder, i64 nanoseconds)
+{
+    builder.appendff("{}.{:03}", nanoseconds / 1000, nanoseconds % 1000);
+}
+
+void flush_trace_events()
+{
+    auto& state = trace_state();
+    if (state.path.is_empty())
+        return;
+
+    auto pid = System::getpid();
+
+    StringBuilder builder;
+    builder.appendff("{{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":{},\"tid\":0,\"args\":{{\"name\":\"", pid);
+    auto process_name = Process::get_name();
+    builder.append_escaped_for_json(process_name.is_error() ? "Unknown"sv : process_name.value().bytes_as_string_view());
+    builder.append("\"}},\n"sv);
+
+    {
+        SpinLocker state_locker { state.lock };
+        for (auto& buffer : state.buffers) {
+            SpinLocker buffer_locker { buffer->lock };
+
+            // NB: Once the buffer has wrapped around, its oldest event is the one about to be overwritten next.
+            auto event_count = buffer->events.size();
+            auto first_index = event_count < ThreadTraceBuffer::capacity ? 0 : buffer->next_index;
+
+            for (size_t i = 0; i < event_count; ++i) {
+                auto const& event = buffer->events[(first_index + i) % event_count];
+
+                auto append_event = [&](StringView phase, i64 timestamp_nanoseconds) {
+                    builder.append("{\"name\":\""sv);
+                    builder.append_escaped_for_json({ event.name, strlen(event.name) });
+                    builder.appendff("\",\"cat\":\"{}\",\"ph\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":", category_name(event.category), phase, pid, buffer->thread_id);
+                    append_microseconds(builder, timestamp_nanoseconds);
+                };
+
+                if (event.async_id.has_value()) {
+                    // Async events are written as a pair of begin and end events.
+                    append_event("b"sv, event.start_nanoseconds);
+                    builder.appendff(",\"id\":{}}},\n", *event.async_id);
+                    append_event("e"sv, event.start_nanoseconds + event.duration_nanoseconds);
+                    builder.appendff(",\"id\":{}}},\n", *event.async_id);
+                } else {
+                    append_event("X"sv, event.start_nanoseconds);
+                    builder.append(",\"dur\":"sv);
+                    append_microseconds(builder, event.duration_nanoseconds);
+                    builder.append("},\n"sv);
+                }
+            }
+
+            buffer->events.clear_with_capacity();
+            buffer->next_index = 0;
+        }
+    }
+
+    // NB: Every process appends to the same file. The trace format allows leaving the array unterminated, so a process
+    //     that exits last doesn't have to close it. Writing everything at once keeps events of concurrently exiting
+    //     processes from interleaving.
+    auto fd = System::open(state.path, O_WRONLY | O_APPEND | O_CREAT, 0644);
+    if (fd.is_error()) {
+        warnln("Unable to open trace file {}: {}", state.path, fd.error());
+        return;
+    }
+
+    auto bytes = builder.string_view().bytes();
+    while (!bytes.is_empty()) {
+        auto nwritten = System::write(fd.value(), bytes);
+        if (nwritten.is_error())
+            break;
+        bytes = bytes.slice(nwritten.value());
+    }
+    (void)System::close(fd.value());
+}
+
+static void initialize_tracing_from_environment()
+{
+    auto path = Environment::get("LADYBIRD_TRACE_FILE"sv);
+    if (!path.has_value() || path->is_empty())
+        return;
+
+    auto categories = TraceCategory::All;
+    if (auto category_list = Environment::get("LADYBIRD_TRACE_CATEGORIES"sv); category_list.has_value())
+        categories = categories_from_string(*category_list);
+
+    trace_state().path = *path;
+
+    // The process that starts a tracing session replaces any file left over from an earlier session with one that only
+    // opens the array of events, which all processes then append to. The processes it spawns inherit the marker it
+    // leaves in the environment, so that they append to the file instead of starting it over.
+    static constexpr auto session_variable = "LADYBIRD_TRACE_SESSION_FILE"sv;
+    if (Environment::get(session_variable) != path) {
+        if (auto fd = System::open(*path, O_WRONLY | O_CREAT | O_TRUNC, 0644); !fd.is_error()) {
+            (void)System::write(fd.value(), "[\n"sv.bytes());
+            (void)System::close(fd.value());
+        } else {
+            warnln("Unable to create trace file {}: {}", *path, fd.error());
+        }
+        (void)Environment::set(session_variable, *path, Environment::Overwrite::Yes);
+    }
+
+    enable_tracing(categories);
+    atexit(flush_trace_events);
+}
+
+// NB: Tracing is configured as soon as LibCore is loaded, so that every process picks it up without further setup.
+static struct TraceEventInitializer {
+    TraceEventInitializer() { initialize_tracing_from_environment(); }
+} s_trace_event_initializer;
+
+}
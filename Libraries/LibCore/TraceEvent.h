@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/EnumBits.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Time.h>
+
+namespace Core {
+
+// Trace events record how long a piece of work took, so that work done by different processes can be laid out on one
+// timeline. Tracing is enabled by pointing the LADYBIRD_TRACE_FILE environment variable at a file, which every process
+// then appends its events to when it exits. LADYBIRD_TRACE_CATEGORIES optionally takes a comma-separated list of the
+// categories to record. The result is a trace in the Chrome JSON format, which Perfetto and chrome://tracing can load.
+//
+// While tracing is disabled, a trace event costs a single relaxed atomic load.
+enum class TraceCategory : u32 {
+    None = 0,
+    Style = 1 << 0,
+    Layout = 1 << 1,
+    Painting = 1 << 2,
+    GC = 1 << 3,
+    IPC = 1 << 4,
+    Network = 1 << 5,
+    ImageDecoding = 1 << 6,
+    All = (1 << 7) - 1,
+};
+
+AK_ENUM_BITWISE_OPERATORS(TraceCategory);
+
+namespace Detail {
+
+extern Atomic<u32> g_enabled_trace_categories;
+
+}
+
+ALWAYS_INLINE bool is_tracing_enabled(TraceCategory category)
+{
+    return (Detail::g_enabled_trace_categories.load(AK::MemoryOrder::memory_order_relaxed) & to_underlying(category)) != 0;
+}
+
+void enable_tracing(TraceCategory);
+
+// Records an event for work that started and ended at the given times. The name has to outlive the process, which any
+// string literal does.
+void record_trace_event(TraceCategory, char const* name, MonotonicTime start, MonotonicTime end);
+
+// Like record_trace_event(), but for work that overlaps with other work on the same thread without being nested in it,
+// such as the phases of concurrent network requests. Events with the same ID are shown on their own track.
+void record_async_trace_event(TraceCategory, char const* name, u64 id, MonotonicTime start, MonotonicTime end);
+
+// Writes the recorded events to the trace file, and forgets them.
+void flush_trace_events();
+
+class ScopedTraceEvent {
+    AK_MAKE_NONCOPYABLE(ScopedTraceEvent);
+    AK_MAKE_NONMOVABLE(ScopedTraceEvent);
+
+public:
+    ALWAYS_INLINE ScopedTraceEvent(TraceCategory category, char const* name)
+    {
+        if (is_tracing_enabled(category)) [[unlikely]] {
+            m_category = category;
+            m_name = name;
+            m_start = MonotonicTime::now();
+        }
+    }
+
+    ALWAYS_INLINE ~ScopedTraceEvent()
+    {
+        if (m_start.has_value()) [[unlikely]]
+            record_trace_event(m_category, m_name, *m_start, MonotonicTime::now());
+    }
+
+private:
+    TraceCategory m_category { TraceCategory::None };
+    char const* m_name { nullptr };
+    Optional<MonotonicTime> m_start;
+};
+
+#define __TRACE_EVENT_CONCAT(a, b) a##b
+#define __TRACE_EVENT_VARIABLE(line) __TRACE_EVENT_CONCAT(__trace_event_, line)
+
+#define TRACE_EVENT(category, name) \
+    Core::ScopedTraceEvent __TRACE_EVENT_VARIABLE(__LINE__) { Core::TraceCategory::category, name }
+
+}
@@ -36,6 +36,8 @@ UDPServer::UDPServer()
 
 UDPServer::~UDPServer()
 {
+    if (m_notifier)
+        m_notifier->close();
     ::close(m_fd);
 }
 
@@ -9,12 +9,22 @@
 #include <math.h>
 #include <tommath.h>
 
+#include <AK/Checked.h>
 #include <AK/StringBuilder.h>
 #include <LibCrypto/BigInt/SignedBigInteger.h>
 #include <LibCrypto/BigInt/Tommath.h>
 
 namespace Crypto {
 
+// OPTIMIZATION: Most BigInts in practice are small, but libtommath's algorithms are built for large numbers. Values that
+//               fit into a single digit leave enough headroom to do arithmetic on them with native integers, and the
+//               result then only needs the smallest allocation libtommath makes.
+static_assert(MP_DIGIT_BIT <= 62);
+static ALWAYS_INLINE bool is_small(mp_int const& value)
+{
+    return value.used <= 1;
+}
+
 SignedBigInteger::SignedBigInteger(UnsignedBigInteger&& unsigned_data, bool sign)
 {
     MP_MUST(mp_init_copy(&m_mp, &unsigned_data.m_mp));
@@ -42,7 +52,8 @@ SignedBigInteger::SignedBigInteger(double value)
 
 SignedBigInteger::SignedBigInteger(i64 value)
 {
-    MP_MUST(mp_init(&m_mp));
+    // NB: The smallest size libtommath allocates always has room for a 64-bit value.
+    MP_MUST(mp_init_size(&m_mp, 0));
     mp_set_i64(&m_mp, value);
 }
 
@@ -208,6 +219,9 @@ size_t SignedBigInteger::byte_length() const
 
 FLATTEN SignedBigInteger SignedBigInteger::plus(SignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp))
+        return SignedBigInteger { mp_get_i64(&m_mp) + mp_get_i64(&other.m_mp) };
+
     SignedBigInteger result;
     MP_MUST(mp_add(&m_mp, &other.m_mp, &result.m_mp));
     return result;
@@ -215,6 +229,9 @@ FLATTEN SignedBigInteger SignedBigInteger::plus(SignedBigInteger const& other) c
 
 FLATTEN SignedBigInteger SignedBigInteger::minus(SignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp))
+        return SignedBigInteger { mp_get_i64(&m_mp) - mp_get_i64(&other.m_mp) };
+
     SignedBigInteger result;
     MP_MUST(mp_sub(&m_mp, &other.m_mp, &result.m_mp));
     return result;
@@ -253,7 +270,7 @@ FLATTEN SignedDivisionResult SignedBigInteger::divided_by(UnsignedBigInteger con
     SignedBigInteger quotient;
     SignedBigInteger remainder;
     MP_MUST(mp_div(&m_mp, &divisor.m_mp, &quotient.m_mp, &remainder.m_mp));
-    return SignedDivisionResult { quotient, remainder };
+    return SignedDivisionResult { move(quotient), move(remainder) };
 }
 
 FLATTEN SignedBigInteger SignedBigInteger::bitwise_or(SignedBigInteger const& other) const
@@ -336,6 +353,13 @@ FLATTEN ErrorOr<SignedBigInteger> SignedBigInteger::mod_power_of_two(size_t powe
 
 FLATTEN SignedBigInteger SignedBigInteger::multiplied_by(SignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp)) {
+        auto lhs = mp_get_i64(&m_mp);
+        auto rhs = mp_get_i64(&other.m_mp);
+        if (!Checked<i64>::multiplication_would_overflow(lhs, rhs))
+            return SignedBigInteger { lhs * rhs };
+    }
+
     SignedBigInteger result;
     MP_MUST(mp_mul(&m_mp, &other.m_mp, &result.m_mp));
     return result;
@@ -343,10 +367,17 @@ FLATTEN SignedBigInteger SignedBigInteger::multiplied_by(SignedBigInteger const&
 
 FLATTEN SignedDivisionResult SignedBigInteger::divided_by(SignedBigInteger const& divisor) const
 {
+    if (is_small(m_mp) && is_small(divisor.m_mp) && !divisor.is_zero()) {
+        // NB: Like mp_div(), C++ division truncates towards zero, and the remainder takes the sign of the dividend.
+        auto dividend = mp_get_i64(&m_mp);
+        auto divisor_value = mp_get_i64(&divisor.m_mp);
+        return SignedDivisionResult { SignedBigInteger { dividend / divisor_value }, SignedBigInteger { dividend % divisor_value } };
+    }
+
     SignedBigInteger quotient;
     SignedBigInteger remainder;
     MP_MUST(mp_div(&m_mp, &divisor.m_mp, &quotient.m_mp, &remainder.m_mp));
-    return SignedDivisionResult { quotient, remainder };
+    return SignedDivisionResult { move(quotient), move(remainder) };
 }
 
 FLATTEN SignedBigInteger SignedBigInteger::pow(u32 exponent) const
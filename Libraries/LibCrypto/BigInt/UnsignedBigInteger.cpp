@@ -10,6 +10,7 @@
 #include <tommath.h>
 
 #include <AK/BuiltinWrappers.h>
+#include <AK/Checked.h>
 #include <AK/FloatingPoint.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StringBuilder.h>
@@ -18,6 +19,15 @@
 
 namespace Crypto {
 
+// OPTIMIZATION: Most BigInts in practice are small, but libtommath's algorithms are built for large numbers. Values that
+//               fit into a single digit leave enough headroom to do arithmetic on them with native integers, and the
+//               result then only needs the smallest allocation libtommath makes.
+static_assert(MP_DIGIT_BIT <= 62);
+static ALWAYS_INLINE bool is_small(mp_int const& value)
+{
+    return value.used <= 1;
+}
+
 UnsignedBigInteger::UnsignedBigInteger(ReadonlyBytes data)
 {
     MP_MUST(mp_init(&m_mp));
@@ -45,7 +55,8 @@ UnsignedBigInteger::UnsignedBigInteger(double value)
 
 UnsignedBigInteger::UnsignedBigInteger(u64 value)
 {
-    MP_MUST(mp_init(&m_mp));
+    // NB: The smallest size libtommath allocates always has room for a 64-bit value.
+    MP_MUST(mp_init_size(&m_mp, 0));
     mp_set_u64(&m_mp, value);
 }
 
@@ -254,6 +265,9 @@ size_t UnsignedBigInteger::one_based_index_of_highest_set_bit() const
 
 FLATTEN UnsignedBigInteger UnsignedBigInteger::plus(UnsignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp))
+        return UnsignedBigInteger { mp_get_u64(&m_mp) + mp_get_u64(&other.m_mp) };
+
     UnsignedBigInteger result;
     MP_MUST(mp_add(&m_mp, &other.m_mp, &result.m_mp));
     return result;
@@ -261,6 +275,14 @@ FLATTEN UnsignedBigInteger UnsignedBigInteger::plus(UnsignedBigInteger const& ot
 
 FLATTEN ErrorOr<UnsignedBigInteger> UnsignedBigInteger::minus(UnsignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp)) {
+        auto lhs = mp_get_u64(&m_mp);
+        auto rhs = mp_get_u64(&other.m_mp);
+        if (lhs < rhs)
+            return Error::from_string_literal("Substraction produced a negative result");
+        return UnsignedBigInteger { lhs - rhs };
+    }
+
     UnsignedBigInteger result;
     MP_MUST(mp_sub(&m_mp, &other.m_mp, &result.m_mp));
     if (mp_isneg(&result.m_mp))
@@ -323,6 +345,13 @@ FLATTEN UnsignedBigInteger UnsignedBigInteger::shift_right(size_t num_bits) cons
 
 FLATTEN UnsignedBigInteger UnsignedBigInteger::multiplied_by(UnsignedBigInteger const& other) const
 {
+    if (is_small(m_mp) && is_small(other.m_mp)) {
+        auto lhs = mp_get_u64(&m_mp);
+        auto rhs = mp_get_u64(&other.m_mp);
+        if (!Checked<u64>::multiplication_would_overflow(lhs, rhs))
+            return UnsignedBigInteger { lhs * rhs };
+    }
+
     UnsignedBigInteger result;
     MP_MUST(mp_mul(&m_mp, &other.m_mp, &result.m_mp));
     return result;
@@ -330,10 +359,16 @@ FLATTEN UnsignedBigInteger UnsignedBigInteger::multiplied_by(UnsignedBigInteger
 
 FLATTEN UnsignedDivisionResult UnsignedBigInteger::divided_by(UnsignedBigInteger const& divisor) const
 {
+    if (is_small(m_mp) && is_small(divisor.m_mp) && !divisor.is_zero()) {
+        auto dividend = mp_get_u64(&m_mp);
+        auto divisor_value = mp_get_u64(&divisor.m_mp);
+        return UnsignedDivisionResult { UnsignedBigInteger { dividend / divisor_value }, UnsignedBigInteger { dividend % divisor_value } };
+    }
+
     UnsignedBigInteger quotient;
     UnsignedBigInteger remainder;
     MP_MUST(mp_div(&m_mp, &divisor.m_mp, &quotient.m_mp, &remainder.m_mp));
-    return UnsignedDivisionResult { quotient, remainder };
+    return UnsignedDivisionResult { move(quotient), move(remainder) };
 }
 
 FLATTEN UnsignedBigInteger UnsignedBigInteger::pow(u32 exponent) const
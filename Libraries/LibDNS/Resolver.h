@@ -105,6 +105,30 @@ public:
             m_valid = false;
     }
 
+    // RFC 2308 section 5: A name error is cached for the lesser of the TTL of the SOA record in the authority section
+    //                     and its MINIMUM field. Without an SOA record, the name error must not be cached at all.
+    void did_receive_name_error(Vector<Messages::ResourceRecord> const& authorities)
+    {
+        // NB: RFC 2308 section 5 suggests capping negative answers at a few hours, we prefer to notice new names sooner.
+        static constexpr u32 maximum_negative_ttl_in_seconds = 60 * 60;
+
+        for (auto const& authority : authorities) {
+            auto const* soa = authority.record.get_pointer<Messages::Records::SOA>();
+            if (!soa)
+                continue;
+
+            auto ttl = min(min(authority.ttl, soa->minimum), maximum_negative_ttl_in_seconds);
+            if (ttl > 0)
+                m_name_does_not_exist_until = AK::UnixDateTime::now() + AK::Duration::from_seconds(ttl);
+            return;
+        }
+    }
+
+    bool is_known_to_not_exist() const
+    {
+        return m_name_does_not_exist_until.has_value() && m_name_does_not_exist_until.value() >= AK::UnixDateTime::now();
+    }
+
     void add_record(Messages::ResourceRecord record)
     {
         m_valid = true;
@@ -163,12 +187,14 @@ public:
     }
 
     void will_add_record_of_type(Messages::ResourceType type) { m_desired_types.set(type); }
+    void set_is_complete_answer_for_desired_types() { m_is_complete_answer_for_desired_types = true; }
+    bool is_complete_answer_for_desired_types() const { return m_is_complete_answer_for_desired_types; }
     void finished_request() { m_request_done = true; }
 
     void set_id(u16 id) { m_id = id; }
     u16 id() { return m_id; }
 
-    bool can_be_removed() const { return !m_valid && m_request_done; }
+    bool can_be_removed() const { return !m_valid && m_request_done && !is_known_to_not_exist(); }
     bool is_done() const { return m_request_done; }
     bool is_empty() const { return m_cached_records.is_empty(); }
     void set_dnssec_validated(bool validated) { m_dnssec_validated = validated; }
@@ -189,7 +215,9 @@ private:
     bool m_request_done { false };
     bool m_dnssec_validated { false };
     bool m_being_dnssec_validated { false };
+    bool m_is_complete_answer_for_desired_types { false };
     Messages::DomainName m_name;
+    Optional<AK::UnixDateTime> m_name_does_not_exist_until;
 
     struct RecordWithExpiration {
         Messages::ResourceRecord record;
@@ -232,6 +260,9 @@ public:
         ConnectionMode mode;
     };
 
+    // Sends a wire-format query to a DNS-over-HTTPS server (RFC 8484) and hands its wire-format response to the callback.
+    using HTTPSTransport = Function<void(ByteBuffer query, Function<void(ErrorOr<ByteBuffer>)> on_response)>;
+
     Resolver(Function<ErrorOr<SocketResult>()> create_socket)
         : m_pending_lookups(make<RedBlackTree<u16, PendingLookup>>())
         , m_create_socket(move(create_socket))
@@ -273,6 +304,13 @@ public:
         m_socket.with_write_locked([&](auto& socket) { socket = {}; });
     }
 
+    // While an HTTPS transport is set, queries are sent through it instead of over a socket. Its answers go through the
+    // same pending lookups and cache as answers that arrive over a socket.
+    void set_https_transport(HTTPSTransport transport)
+    {
+        m_https_transport = move(transport);
+    }
+
     NonnullRefPtr<LookupResult const> expect_cached(StringView name, Messages::Class class_ = Messages::Class::IN)
     {
         return expect_cached(name, class_, Array { Messages::ResourceType::A, Messages::ResourceType::AAAA });
@@ -299,8 +337,14 @@ public:
                 return {};
 
             auto& result = *it->value;
+
+            // OPTIMIZATION: A cached name error answers the lookup for every record type, sparing us a round trip to a
+            //               resolver that will just tell us the same thing again.
+            if (result.is_known_to_not_exist())
+                return result;
+
             for (auto const& type : desired_types) {
-                if (!result.has_record_of_type(type))
+                if (!result.has_record_of_type(type, result.is_complete_answer_for_desired_types()))
                     return {};
             }
 
@@ -400,9 +444,18 @@ public:
                 return promise;
             }
 
+            // OPTIMIZATION: Every trip through the system resolver blocks us for as long as it takes to answer, so we keep
+            //               its answers in our cache as well. It doesn't tell us their TTLs, so they are kept for a
+            //               short, fixed amount of time instead.
+            if (auto result = lookup_in_cache(name, class_, desired_types)) {
+                dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache (system resolver)", name);
+                promise->resolve(result.release_nonnull());
+                return promise;
+            }
+
             // Use system resolver
             // FIXME: Use an underlying resolver instead.
-            dbgln_if(DNS_DEBUG, "Not ready to resolve, using system resolver and skipping cache for {}", name);
+            dbgln_if(DNS_DEBUG, "Not ready to resolve, using system resolver for {}", name);
             auto record_or_error = Core::Socket::resolve_host(name, Core::Socket::SocketType::Stream);
             if (record_or_error.is_error()) {
                 promise->reject(record_or_error.release_error());
@@ -414,13 +467,23 @@ public:
             for (auto const& record : records) {
                 record.visit(
                     [&](IPv4Address const& address) {
-                        result->add_record({ .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::A { address }, .raw = {} });
+                        result->add_record({ .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = system_resolver_ttl_in_seconds, .record = Messages::Records::A { address }, .raw = {} });
                     },
                     [&](IPv6Address const& address) {
-                        result->add_record({ .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::AAAA { address }, .raw = {} });
+                        result->add_record({ .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = system_resolver_ttl_in_seconds, .record = Messages::Records::AAAA { address }, .raw = {} });
                     });
             }
             result->finished_request();
+
+            // NB: A name that only has one kind of address must not make every later lookup miss the cache, so the entry
+            //     counts as the full answer for each type we asked the system resolver about.
+            for (auto const& type : desired_types)
+                result->will_add_record_of_type(type);
+            result->set_is_complete_answer_for_desired_types();
+
+            if (!result->is_empty())
+                m_cache.with_write_locked([&](auto& cache) { cache.set(name, result); });
+
             promise->resolve(result);
             return promise;
         }
@@ -585,6 +648,31 @@ public:
         ByteBuffer query_bytes;
         MUST(query.to_raw(query_bytes));
 
+        // NB: RFC 8484 suggests a query ID of 0 to make GET responses cacheable. We POST our queries and match responses
+        //     to their lookups by ID, so we keep the ID we picked.
+        if (m_https_transport) {
+            // NB: The transport may answer right away, which removes the pending lookup, so its timer is started first.
+            pending_lookup->repeat_timer->start();
+
+            m_https_transport(move(query_bytes), [this](ErrorOr<ByteBuffer> response) {
+                if (response.is_error()) {
+                    dbgln_if(DNS_DEBUG, "DNS: DNS-over-HTTPS query failed: {}", response.error());
+                    return;
+                }
+
+                FixedMemoryStream stream { response.value().bytes() };
+                auto message = Messages::Message::from_raw(stream);
+                if (message.is_error()) {
+                    dbgln("DNS: Failed to parse DNS-over-HTTPS response: {}", message.error());
+                    return;
+                }
+
+                process_incoming_message(message.release_value());
+            });
+
+            return promise;
+        }
+
         if (m_mode == ConnectionMode::TCP) {
             auto original_query_bytes = query_bytes;
             query_bytes = MUST(ByteBuffer::create_uninitialized(query_bytes.size() + sizeof(u16)));
@@ -639,50 +727,57 @@ private:
                 break;
             }
 
-            auto message = message_or_err.release_value();
-            auto result = m_pending_lookups.with_write_locked([&](auto& lookups) -> ErrorOr<void> {
-                auto* lookup = lookups->find(message.header.id);
-                if (!lookup)
-                    return Error::from_string_literal("No pending lookup found for this message");
+            process_incoming_message(message_or_err.release_value());
+        }
+    }
 
-                if (lookup->result.is_null()) {
-                    dbgln_if(DNS_DEBUG, "DNS: Received a message with no pending lookup (id={})", message.header.id);
-                    return {}; // Message is a response to a lookup that's been purged from the cache, ignore it
-                }
+    void process_incoming_message(Messages::Message message)
+    {
+        auto result = m_pending_lookups.with_write_locked([&](auto& lookups) -> ErrorOr<void> {
+            auto* lookup = lookups->find(message.header.id);
+            if (!lookup)
+                return Error::from_string_literal("No pending lookup found for this message");
+
+            if (lookup->result.is_null()) {
+                dbgln_if(DNS_DEBUG, "DNS: Received a message with no pending lookup (id={})", message.header.id);
+                return {}; // Message is a response to a lookup that's been purged from the cache, ignore it
+            }
 
-                lookup->repeat_timer->stop();
-
-                auto result = lookup->result.strong_ref();
-                if (result->is_dnssec_validated())
-                    return validate_dnssec(move(message), *lookup, *result);
-
-                if constexpr (DNS_DEBUG) {
-                    switch (message.header.options.response_code()) {
-                    case Messages::Options::ResponseCode::FormatError:
-                        dbgln("DNS: Received FormatError response code");
-                        break;
-                    case Messages::Options::ResponseCode::ServerFailure:
-                        dbgln("DNS: Received ServerFailure response code");
-                        break;
-                    case Messages::Options::ResponseCode::NameError:
-                        dbgln("DNS: Received NameError response code");
-                        break;
-                    default:
-                        break;
-                    }
+            lookup->repeat_timer->stop();
+
+            auto result = lookup->result.strong_ref();
+            if (result->is_dnssec_validated())
+                return validate_dnssec(move(message), *lookup, *result);
+
+            if constexpr (DNS_DEBUG) {
+                switch (message.header.options.response_code()) {
+                case Messages::Options::ResponseCode::FormatError:
+                    dbgln("DNS: Received FormatError response code");
+                    break;
+                case Messages::Options::ResponseCode::ServerFailure:
+                    dbgln("DNS: Received ServerFailure response code");
+                    break;
+                case Messages::Options::ResponseCode::NameError:
+                    dbgln("DNS: Received NameError response code");
+                    break;
+                default:
+                    break;
                 }
+            }
 
-                for (auto& record : message.answers)
-                    result->add_record(move(record));
+            for (auto& record : message.answers)
+                result->add_record(move(record));
 
-                result->finished_request();
-                lookup->promise->resolve(*result);
-                lookups->remove(message.header.id);
-                return {};
-            });
-            if (result.is_error())
-                dbgln_if(DNS_DEBUG, "DNS: Received a message with no pending lookup: {}", result.error());
-        }
+            if (message.header.options.response_code() == Messages::Options::ResponseCode::NameError)
+                result->did_receive_name_error(message.authorities);
+
+            result->finished_request();
+            lookup->promise->resolve(*result);
+            lookups->remove(message.header.id);
+            return {};
+        });
+        if (result.is_error())
+            dbgln_if(DNS_DEBUG, "DNS: Received a message with no pending lookup: {}", result.error());
     }
 
     using RRSet = Vector<Messages::ResourceRecord>;
@@ -1151,6 +1246,9 @@ private:
 
     bool has_connection(bool attempt_restart = true)
     {
+        if (m_https_transport)
+            return true;
+
         auto result = m_socket.with_read_locked(
             [&](auto& socket) { return socket.has_value() && (*socket)->is_open(); });
 
@@ -1201,10 +1299,13 @@ private:
         });
     }
 
+    static constexpr u32 system_resolver_ttl_in_seconds = 60;
+
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
     Function<ErrorOr<SocketResult>()> m_create_socket;
+    HTTPSTransport m_https_transport;
     bool m_attempting_restart { false };
     ConnectionMode m_mode { ConnectionMode::UDP };
     Vector<NonnullRefPtr<Core::Promise<Empty>>> m_socket_ready_promises;
@@ -62,6 +62,10 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Set once a cell has been found live by a garbage collection, i.e. it has left the young generation.
+    bool has_survived_collection() const { return m_survived_collection; }
+    void set_has_survived_collection(bool b) { m_survived_collection = b; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -220,6 +224,7 @@ protected:
 private:
     bool m_mark { false };
     State m_state { State::Live };
+    bool m_survived_collection { false };
 } SWIFT_UNSAFE_REFERENCE;
 
 }
@@ -25,6 +25,10 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    // Sweep blocks left over from the last collection until one of them has room, before growing the heap.
+    while (m_usable_blocks.is_empty() && !m_blocks_pending_sweep.is_empty())
+        sweep_pending_block(*m_blocks_pending_sweep.first(), ReleaseEmptyBlock::No);
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name, m_overrides_must_survive_garbage_collection, m_overrides_finalize);
         auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
@@ -57,4 +61,35 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::defer_sweeping_of_all_blocks(Badge<Heap>)
+{
+    VERIFY(m_blocks_pending_sweep.is_empty());
+    while (!m_full_blocks.is_empty())
+        m_blocks_pending_sweep.append(*m_full_blocks.first());
+    while (!m_usable_blocks.is_empty())
+        m_blocks_pending_sweep.append(*m_usable_blocks.first());
+}
+
+void CellAllocator::sweep_next_pending_block(Badge<Heap>)
+{
+    VERIFY(!m_blocks_pending_sweep.is_empty());
+    sweep_pending_block(*m_blocks_pending_sweep.first(), ReleaseEmptyBlock::Yes);
+}
+
+void CellAllocator::sweep_pending_block(HeapBlock& block, ReleaseEmptyBlock release_empty_block)
+{
+    // NOTE: Appending to another list removes the block from the pending list.
+    auto result = block.sweep();
+    if (!result.live_cells && release_empty_block == ReleaseEmptyBlock::Yes) {
+        block.m_list_node.remove();
+        block.~HeapBlock();
+        m_block_allocator.deallocate_block(&block);
+        return;
+    }
+    if (block.is_full())
+        m_full_blocks.append(block);
+    else
+        m_usable_blocks.append(block);
+}
+
 }
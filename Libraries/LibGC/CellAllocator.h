@@ -51,12 +51,22 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_pending_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
 
+    // Lazy sweeping: after marking, every block is parked on a pending list and swept one at a time,
+    // either when we need a free cell or when the heap finishes sweeping (during idle time or before the next GC).
+    void defer_sweeping_of_all_blocks(Badge<Heap>);
+    bool has_blocks_pending_sweep() const { return !m_blocks_pending_sweep.is_empty(); }
+    void sweep_next_pending_block(Badge<Heap>);
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
@@ -70,9 +80,16 @@ private:
 
     BlockAllocator m_block_allocator;
 
+    enum class ReleaseEmptyBlock {
+        No,
+        Yes,
+    };
+    void sweep_pending_block(HeapBlock&, ReleaseEmptyBlock);
+
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    BlockList m_blocks_pending_sweep;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
     bool m_overrides_must_survive_garbage_collection { false };
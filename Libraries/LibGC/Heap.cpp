@@ -6,15 +6,18 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/BinarySearch.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -67,29 +70,84 @@ void Heap::will_allocate(size_t size)
     }
 
     m_allocated_bytes_since_last_gc += size;
+    ++m_allocated_cells_since_last_gc;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+struct PossiblePointer {
+    FlatPtr value { 0 };
+    HeapRoot origin;
+};
+
+// A flat, sorted set of the addresses of all live heap blocks. This is much cheaper to build on every collection
+// than a hash table, and looking up a possible pointer is a binary search after the min/max range check.
+class LiveHeapBlockSet {
+public:
+    void add(HeapBlock& block) { m_blocks.append(&block); }
+
+    void seal()
+    {
+        quick_sort(m_blocks);
+    }
+
+    bool contains(HeapBlock* block) const
+    {
+        return binary_search(m_blocks, block) != nullptr;
+    }
+
+private:
+    Vector<HeapBlock*> m_blocks;
+};
+
+static ALWAYS_INLINE bool possible_pointer_from_value(FlatPtr data, FlatPtr min_block_address, FlatPtr max_block_address, FlatPtr& possible_pointer)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
         // match any pointer-backed tag, in that case we have to extract the pointer to its
         // canonical form and add that as a possible pointer.
-        FlatPtr possible_pointer;
         if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
             possible_pointer = NanBoxedValue::extract_pointer_bits(data);
         else
             possible_pointer = data;
-        if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
-        if (data < min_block_address || data > max_block_address)
-            return;
         // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
         // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
+        possible_pointer = data;
+    }
+    // Fast reject: most words on the stack don't point anywhere near the heap.
+    return possible_pointer >= min_block_address && possible_pointer <= max_block_address;
+}
+
+static void add_possible_value(Vector<PossiblePointer>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+{
+    FlatPtr possible_pointer;
+    if (!possible_pointer_from_value(data, min_block_address, max_block_address, possible_pointer))
+        return;
+    possible_pointers.append({ possible_pointer, move(origin) });
+}
+
+static ALWAYS_INLINE Cell* find_cell_for_possible_pointer(LiveHeapBlockSet const& all_live_heap_blocks, FlatPtr possible_pointer)
+{
+    if (!possible_pointer)
+        return nullptr;
+    auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+    if (!all_live_heap_blocks.contains(possible_heap_block))
+        return nullptr;
+    return possible_heap_block->cell_from_possible_pointer(possible_pointer);
+}
+
+// Calls the callback for every cell that one of the given raw values might point to.
+// NOTE: The same cell may be reported more than once.
+template<typename Callback>
+static void for_each_cell_among_possible_values(LiveHeapBlockSet const& all_live_heap_blocks, ReadonlyBytes bytes, FlatPtr min_block_address, FlatPtr max_block_address, Callback callback)
+{
+    auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+    for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+        FlatPtr possible_pointer;
+        if (!possible_pointer_from_value(raw_pointer_sized_values[i], min_block_address, max_block_address, possible_pointer))
+            continue;
+        if (auto* cell = find_cell_for_possible_pointer(all_live_heap_blocks, possible_pointer))
+            callback(cell);
     }
 }
 
@@ -103,19 +161,13 @@ void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_a
     }
 }
 
-template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+void Heap::gather_live_heap_blocks(LiveHeapBlockSet& all_live_heap_blocks)
 {
-    for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
-            callback(cell, possible_pointer);
-        }
-    }
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.add(block);
+        return IterationDecision::Continue;
+    });
+    all_live_heap_blocks.seal();
 }
 
 class GraphConstructorVisitor final : public Cell::Visitor {
@@ -124,10 +176,7 @@ public:
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
+        m_heap.gather_live_heap_blocks(m_all_live_heap_blocks);
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -158,13 +207,7 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
-        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_values(m_all_live_heap_blocks, bytes, m_min_block_address, m_max_block_address, [&](Cell* cell) {
             if (cell->state() != Cell::State::Live)
                 return;
 
@@ -247,15 +290,17 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    LiveHeapBlockSet m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    finish_lazy_sweeping();
+
     HashMap<Cell*, HeapRoot> roots;
-    HashTable<HeapBlock*> all_live_heap_blocks;
+    LiveHeapBlockSet all_live_heap_blocks;
     gather_roots(roots, all_live_heap_blocks);
     GraphConstructorVisitor visitor(*this, roots);
     visitor.visit_all_cells();
@@ -273,19 +318,51 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         if (print_report)
             collection_measurement_timer.start();
 
+        if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+            m_should_gc_when_deferral_ends = true;
+            return;
+        }
+
+        TRACE_EVENT(GC, "Heap::collect_garbage");
+
+        CollectionTimings timings;
+        auto phase_start = MonotonicTime::now();
+        auto end_phase = [&](AK::Duration& phase_duration, char const* trace_event_name) {
+            auto now = MonotonicTime::now();
+            phase_duration += now - phase_start;
+            if (Core::is_tracing_enabled(Core::TraceCategory::GC))
+                Core::record_trace_event(Core::TraceCategory::GC, trace_event_name, phase_start, now);
+            phase_start = now;
+        };
+
+        // Mark bits and cell states can't be trusted until every block left over from the previous collection has been swept.
+        finish_lazy_sweeping();
+        end_phase(timings.sweep, "GC: finish lazy sweeping");
+
         if (collection_type == CollectionType::CollectGarbage) {
-            if (m_gc_deferrals) {
-                m_should_gc_when_deferral_ends = true;
-                return;
-            }
             HashMap<Cell*, HeapRoot> roots;
-            HashTable<HeapBlock*> all_live_heap_blocks;
+            LiveHeapBlockSet all_live_heap_blocks;
             gather_roots(roots, all_live_heap_blocks);
             mark_live_cells(roots, all_live_heap_blocks);
         }
+        end_phase(timings.mark, "GC: mark");
+
         finalize_unmarked_cells();
+        end_phase(timings.finalize, "GC: finalize");
+
         sweep_weak_blocks();
-        sweep_dead_cells(print_report, collection_measurement_timer);
+        remove_dead_cells_from_weak_containers();
+
+        // The GC report needs exact numbers, so only sweep lazily when nobody is looking.
+        if (collection_type == CollectionType::CollectGarbage && !print_report)
+            defer_sweeping_of_dead_cells();
+        else
+            sweep_dead_cells(print_report, collection_measurement_timer);
+        end_phase(timings.sweep, "GC: sweep");
+
+        ++m_collection_count;
+        m_last_collection_timings = timings;
+        ++m_pause_histogram[HeapStatistics::pause_histogram_bucket_for(timings.total())];
 
         if (print_report)
             dump_allocators();
@@ -369,15 +446,50 @@ void Heap::dump_allocators()
     dbgln("Total wasted on fragmentation: {} KiB", total_waste / KiB);
 }
 
+HeapStatistics Heap::statistics()
+{
+    finish_lazy_sweeping();
+
+    HeapStatistics statistics;
+    statistics.collection_count = m_collection_count;
+    statistics.last_collection = m_last_collection_timings;
+    statistics.pause_histogram = m_pause_histogram;
+
+    for (auto& allocator : m_all_cell_allocators) {
+        CellAllocatorStatistics allocator_statistics {
+            .class_name = allocator.class_name(),
+            .cell_size = allocator.cell_size(),
+            .reserved_block_count = allocator.block_allocator().blocks().size(),
+        };
+
+        allocator.for_each_block([&](HeapBlock& heap_block) {
+            ++allocator_statistics.block_count;
+            size_t live_cells_in_block = 0;
+            heap_block.for_each_cell_in_state<Cell::State::Live>([&](Cell*) {
+                ++live_cells_in_block;
+            });
+            allocator_statistics.live_cells += live_cells_in_block;
+            allocator_statistics.free_cells += heap_block.cell_count() - live_cells_in_block;
+            return IterationDecision::Continue;
+        });
+
+        if (allocator_statistics.block_count == 0 && allocator_statistics.reserved_block_count == 0)
+            continue;
+        statistics.allocators.append(allocator_statistics);
+    }
+
+    return statistics;
+}
+
 void Heap::enqueue_post_gc_task(AK::Function<void()> task)
 {
     m_post_gc_tasks.append(move(task));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*>& all_live_heap_blocks)
+void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet& all_live_heap_blocks)
 {
     for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
+        all_live_heap_blocks.add(block);
 
         if (block.overrides_must_survive_garbage_collection()) {
             block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
@@ -389,6 +501,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*>&
 
         return IterationDecision::Continue;
     });
+    all_live_heap_blocks.seal();
 
     m_gather_embedder_roots(roots);
     gather_conservative_roots(roots, all_live_heap_blocks);
@@ -410,7 +523,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*>&
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(Vector<PossiblePointer>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -426,12 +539,12 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(Vector<PossiblePointer>&, FlatPtr, FlatPtr, FlatPtr)
 {
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     FlatPtr dummy;
 
@@ -440,7 +553,7 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
+    Vector<PossiblePointer> possible_pointers;
 
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
@@ -464,23 +577,27 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         }
     }
 
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
+    for (auto const& possible_pointer : possible_pointers) {
+        auto* cell = find_cell_for_possible_pointer(all_live_heap_blocks, possible_pointer.value);
+        if (!cell)
+            continue;
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
+            roots.set(cell, possible_pointer.origin);
         } else {
             dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
         }
-    });
+    }
 }
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
         : m_heap(heap)
         , m_all_live_heap_blocks(all_live_heap_blocks)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
+        m_work_queue.ensure_capacity(roots.size());
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -493,6 +610,7 @@ public:
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
+        m_marked_cell_bytes += HeapBlock::from_cell(&cell)->cell_size();
         m_work_queue.append(cell);
     }
 
@@ -509,24 +627,20 @@ public:
             dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
             cell.set_marked(true);
+            m_marked_cell_bytes += HeapBlock::from_cell(&cell)->cell_size();
             m_work_queue.unchecked_append(cell);
         }
     }
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
-        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
+        for_each_cell_among_possible_values(m_all_live_heap_blocks, bytes, m_min_block_address, m_max_block_address, [&](Cell* cell) {
             if (cell->is_marked())
                 return;
             if (cell->state() != Cell::State::Live)
                 return;
             cell->set_marked(true);
+            m_marked_cell_bytes += HeapBlock::from_cell(cell)->cell_size();
             m_work_queue.append(*cell);
         });
     }
@@ -534,24 +648,33 @@ public:
     void mark_all_live_cells()
     {
         while (!m_work_queue.is_empty()) {
-            m_work_queue.take_last()->visit_edges(*this);
+            auto cell = m_work_queue.take_last();
+            // Marking is dominated by cache misses on the cells we are about to trace. Start pulling the
+            // next cell's header (and therefore its vtable pointer) into cache while we visit this one.
+            if (!m_work_queue.is_empty())
+                __builtin_prefetch(m_work_queue.last().ptr(), /* read */ 0, /* high temporal locality */ 3);
+            cell->visit_edges(*this);
         }
     }
 
+    size_t marked_cell_bytes() const { return m_marked_cell_bytes; }
+
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+    size_t m_marked_cell_bytes { 0 };
+    LiveHeapBlockSet const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
     MarkingVisitor visitor(*this, roots, all_live_heap_blocks);
     visitor.mark_all_live_cells();
+    m_marked_cell_bytes = visitor.marked_cell_bytes();
 
     for (auto& inverse_root : m_uprooted_cells)
         inverse_root->set_marked(false);
@@ -572,6 +695,12 @@ void Heap::finalize_unmarked_cells()
     });
 }
 
+void Heap::remove_dead_cells_from_weak_containers()
+{
+    for (auto& weak_container : m_weak_containers)
+        weak_container.remove_dead_cells({});
+}
+
 void Heap::sweep_weak_blocks()
 {
     for (auto& weak_block : m_usable_weak_blocks) {
@@ -599,32 +728,27 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
+    // Cells that survive their first collection are what a nursery would have to promote, so keeping track
+    // of them tells us how well the allocation pattern fits the generational hypothesis.
+    size_t young_surviving_cells = 0;
+    size_t young_surviving_cell_bytes = 0;
+
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
-        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked()) {
-                dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
-                ++collected_cells;
-                collected_cell_bytes += block.cell_size();
-            } else {
-                cell->set_marked(false);
-                block_has_live_cells = true;
-                ++live_cells;
-                live_cell_bytes += block.cell_size();
-            }
-        });
-        if (!block_has_live_cells)
+        auto result = block.sweep();
+        collected_cells += result.collected_cells;
+        collected_cell_bytes += result.collected_cells * block.cell_size();
+        live_cells += result.live_cells;
+        live_cell_bytes += result.live_cells * block.cell_size();
+        young_surviving_cells += result.young_surviving_cells;
+        young_surviving_cell_bytes += result.young_surviving_cells * block.cell_size();
+        if (!result.live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
             full_blocks_that_became_usable.append(&block);
         return IterationDecision::Continue;
     });
 
-    for (auto& weak_container : m_weak_containers)
-        weak_container.remove_dead_cells({});
-
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
         block->cell_allocator().block_did_become_empty({}, *block);
@@ -657,10 +781,48 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
+        dbgln("Young survivors: {} of {} allocated since last GC ({} bytes)", young_surviving_cells, m_allocated_cells_since_last_gc, young_surviving_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::BLOCK_SIZE);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::BLOCK_SIZE);
         dbgln("=============================================");
     }
+
+    m_allocated_cells_since_last_gc = 0;
+}
+
+void Heap::defer_sweeping_of_dead_cells()
+{
+    dbgln_if(HEAP_DEBUG, "defer_sweeping_of_dead_cells:");
+
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.defer_sweeping_of_all_blocks({});
+
+    // We haven't swept anything yet, so use the number of bytes found live while marking instead.
+    m_gc_bytes_threshold = max(m_marked_cell_bytes, GC_MIN_BYTES_THRESHOLD);
+    m_allocated_cells_since_last_gc = 0;
+}
+
+void Heap::sweep_lazily(AK::Duration time_budget)
+{
+    if (m_collecting_garbage)
+        return;
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (auto& allocator : m_all_cell_allocators) {
+        while (allocator.has_blocks_pending_sweep()) {
+            if (timer.elapsed_time() >= time_budget)
+                return;
+            allocator.sweep_next_pending_block({});
+        }
+    }
+}
+
+void Heap::finish_lazy_sweeping()
+{
+    for (auto& allocator : m_all_cell_allocators) {
+        while (allocator.has_blocks_pending_sweep())
+            allocator.sweep_next_pending_block({});
+    }
 }
 
 void Heap::defer_gc()
@@ -13,6 +13,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -21,6 +22,7 @@
 #include <LibGC/ConservativeVector.h>
 #include <LibGC/Forward.h>
 #include <LibGC/HeapRoot.h>
+#include <LibGC/HeapStatistics.h>
 #include <LibGC/Internals.h>
 #include <LibGC/Root.h>
 #include <LibGC/RootHashMap.h>
@@ -30,6 +32,9 @@
 
 namespace GC {
 
+class LiveHeapBlockSet;
+struct PossiblePointer;
+
 class GC_API Heap {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -58,6 +63,13 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Sweeps blocks left over from the last collection until the time budget runs out. Meant to be called
+    // by the embedder when it is idle; anything left over is swept on demand by the cell allocators.
+    void sweep_lazily(AK::Duration time_budget);
+
+    // Per-allocator cell counts and collection pause times. Finishes any pending lazy sweeping so the counts are exact.
+    HeapStatistics statistics();
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -122,12 +134,16 @@ private:
     void will_allocate(size_t);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*>& all_live_heap_blocks);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, HashTable<HeapBlock*> const& all_live_heap_blocks);
+    void gather_live_heap_blocks(LiveHeapBlockSet&);
+    void gather_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet& all_live_heap_blocks);
+    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet const& all_live_heap_blocks);
+    void gather_asan_fake_stack_roots(Vector<PossiblePointer>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, LiveHeapBlockSet const& all_live_heap_blocks);
     void finalize_unmarked_cells();
+    void remove_dead_cells_from_weak_containers();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void defer_sweeping_of_dead_cells();
+    void finish_lazy_sweeping();
     void sweep_weak_blocks();
     void run_post_gc_tasks();
 
@@ -154,6 +170,8 @@ private:
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_allocated_cells_since_last_gc { 0 };
+    size_t m_marked_cell_bytes { 0 };
 
     bool m_should_collect_on_every_allocation { false };
 
@@ -172,6 +190,10 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+
+    size_t m_collection_count { 0 };
+    CollectionTimings m_last_collection_timings;
+    Array<size_t, HeapStatistics::pause_histogram_bucket_count> m_pause_histogram {};
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
 
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Debug.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Platform.h>
 #include <LibGC/Heap.h>
@@ -61,4 +62,24 @@ void HeapBlock::deallocate(Cell* cell)
 #endif
 }
 
+HeapBlock::SweepResult HeapBlock::sweep()
+{
+    SweepResult result;
+    for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked()) {
+            dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            deallocate(cell);
+            ++result.collected_cells;
+            return;
+        }
+        cell->set_marked(false);
+        if (!cell->has_survived_collection()) {
+            cell->set_has_survived_collection(true);
+            ++result.young_surviving_cells;
+        }
+        ++result.live_cells;
+    });
+    return result;
+}
+
 }
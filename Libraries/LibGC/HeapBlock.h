@@ -50,6 +50,15 @@ public:
 
     void deallocate(Cell*);
 
+    struct SweepResult {
+        size_t live_cells { 0 };
+        size_t collected_cells { 0 };
+        size_t young_surviving_cells { 0 };
+    };
+
+    // Deallocates every unmarked live cell and clears the mark bit of the survivors.
+    SweepResult sweep();
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace GC {
+
+struct CellAllocatorStatistics {
+    // Null for the size-based allocators shared by all cell types of a similar size.
+    StringView class_name;
+    size_t cell_size { 0 };
+    size_t live_cells { 0 };
+    size_t free_cells { 0 };
+    size_t block_count { 0 };
+    size_t reserved_block_count { 0 };
+
+    size_t live_bytes() const { return live_cells * cell_size; }
+};
+
+struct CollectionTimings {
+    AK::Duration mark;
+    AK::Duration finalize;
+    AK::Duration sweep;
+
+    AK::Duration total() const { return mark + finalize + sweep; }
+};
+
+struct HeapStatistics {
+    // Pause times are bucketed by powers of two, in milliseconds: [0, 1), [1, 2), [2, 4), ..., [128, ∞).
+    static constexpr size_t pause_histogram_bucket_count = 9;
+    static size_t pause_histogram_bucket_for(AK::Duration pause)
+    {
+        auto milliseconds = pause.to_milliseconds();
+        size_t bucket = 0;
+        while (bucket + 1 < pause_histogram_bucket_count && milliseconds >= (1ll << bucket))
+            ++bucket;
+        return bucket;
+    }
+
+    Vector<CellAllocatorStatistics> allocators;
+    size_t collection_count { 0 };
+    CollectionTimings last_collection;
+    Array<size_t, pause_histogram_bucket_count> pause_histogram {};
+};
+
+}
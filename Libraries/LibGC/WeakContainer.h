@@ -16,6 +16,7 @@ public:
     explicit WeakContainer(Heap&);
     virtual ~WeakContainer();
 
+    // Called after marking and before any cells are swept. Cells that aren't marked at this point are dead.
     virtual void remove_dead_cells(Badge<Heap>) = 0;
 
 protected:
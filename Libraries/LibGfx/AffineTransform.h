@@ -41,6 +41,8 @@ public:
         return m_values[1] == 0 && m_values[2] == 0;
     }
 
+    bool operator==(AffineTransform const&) const = default;
+
     void map(float unmapped_x, float unmapped_y, float& mapped_x, float& mapped_y) const;
 
     template<Arithmetic T>
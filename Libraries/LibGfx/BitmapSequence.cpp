@@ -130,9 +130,15 @@ ErrorOr<Gfx::BitmapSequence> decode(Decoder& decoder)
             if (size_check.has_overflow() || size_check.value() > bytes.size())
                 return Error::from_string_literal("IPC: Invalid Gfx::BitmapSequence buffer data");
 
-            auto slice = bytes.slice(bytes_read, size_in_bytes);
+            auto pitch = Gfx::Bitmap::minimum_pitch(metadata.size.width(), metadata.format);
+            if (Gfx::Bitmap::size_in_bytes(pitch, metadata.size.height()) != size_in_bytes)
+                return Error::from_string_literal("IPC: Invalid Gfx::BitmapSequence bitmap size");
+
+            // OPTIMIZATION: Wrap the bitmap's pixels where they are in the shared buffer instead of copying them out.
+            //               Every bitmap keeps the whole buffer alive for as long as it's around.
+            auto* data = collated_buffer.data<u8>() + bytes_read;
             bytes_read += size_in_bytes;
-            bitmap = TRY(Gfx::Bitmap::create_with_raw_data(metadata.format, metadata.alpha_type, slice, metadata.size));
+            bitmap = TRY(Gfx::Bitmap::create_wrapper(metadata.format, metadata.alpha_type, metadata.size, pitch, data, [collated_buffer] { }));
         }
 
         bitmaps.append(bitmap);
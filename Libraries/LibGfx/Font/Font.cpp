@@ -148,10 +148,43 @@ Font::ShapingCache::~ShapingCache()
     clear();
 }
 
+hb_buffer_t* Font::ShapingCache::find(Utf16View const& text, u8 text_type)
+{
+    auto it = map.find(pair_int_hash(text.hash(), text_type), [&](auto& candidate) {
+        return candidate.key.text_type == text_type && candidate.key.text == text;
+    });
+    if (it == map.end())
+        return nullptr;
+
+    // Keep the most recently used entries at the end of the list, so eviction can take from the front.
+    auto& entry = *it->value;
+    lru_list.remove(entry);
+    lru_list.append(entry);
+    return entry.buffer;
+}
+
+void Font::ShapingCache::set(Utf16View const& text, u8 text_type, hb_buffer_t* buffer)
+{
+    if (map.size() >= max_entries) {
+        auto* least_recently_used = lru_list.take_first();
+        hb_buffer_destroy(least_recently_used->buffer);
+        auto evicted_key = least_recently_used->key;
+        map.remove(evicted_key);
+    }
+
+    auto entry = make<Entry>();
+    entry->key = { Utf16String::from_utf16(text), text_type };
+    entry->buffer = buffer;
+    lru_list.append(*entry);
+    auto key = entry->key;
+    map.set(move(key), move(entry));
+}
+
 void Font::ShapingCache::clear()
 {
+    lru_list.clear();
     for (auto& it : map) {
-        hb_buffer_destroy(it.value);
+        hb_buffer_destroy(it.value->buffer);
     }
     map.clear();
     for (auto& buffer : single_ascii_character_map) {
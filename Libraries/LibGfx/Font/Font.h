@@ -10,6 +10,10 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/HashFunctions.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/Typeface.h>
@@ -85,7 +89,32 @@ public:
     ShapeFeatures const& features() const { return m_shape_features; }
 
     struct ShapingCache {
-        HashMap<Utf16String, hb_buffer_t*> map;
+        struct Key {
+            Utf16String text;
+            // The GlyphRun::TextType that the text was shaped with, as it decides the direction of non-ASCII text.
+            u8 text_type { 0 };
+
+            bool operator==(Key const&) const = default;
+        };
+
+        struct KeyTraits : public DefaultTraits<Key> {
+            static unsigned hash(Key const& key) { return pair_int_hash(key.text.hash(), key.text_type); }
+        };
+
+        struct Entry {
+            Key key;
+            hb_buffer_t* buffer { nullptr };
+            IntrusiveListNode<Entry> lru_list_node;
+        };
+
+        // Once this many strings are cached, the least recently used one is evicted for every new one.
+        static constexpr size_t max_entries = 4096;
+
+        hb_buffer_t* find(Utf16View const&, u8 text_type);
+        void set(Utf16View const&, u8 text_type, hb_buffer_t*);
+
+        HashMap<Key, NonnullOwnPtr<Entry>, KeyTraits> map;
+        IntrusiveList<&Entry::lru_list_node> lru_list;
         hb_buffer_t* single_ascii_character_map[128] { nullptr };
 
         ~ShapingCache();
@@ -74,6 +74,35 @@ void FontDatabase::for_each_typeface_with_family_name(FlyString const& family_na
     m_system_font_provider->for_each_typeface_with_family_name(family_name, move(callback));
 }
 
+void FontDatabase::purge_caches()
+{
+    if (m_system_font_provider) {
+        m_system_font_provider->for_each_typeface([](Typeface const& typeface) {
+            typeface.purge_cached_fonts();
+        });
+    }
+
+    for (auto const& it : m_code_point_fallback_cache) {
+        if (it.value.typeface)
+            it.value.typeface->purge_cached_fonts();
+    }
+    m_code_point_fallback_cache.clear();
+}
+
+FontDatabase::CacheStatistics FontDatabase::cache_statistics()
+{
+    CacheStatistics statistics;
+    statistics.code_point_fallback_count = m_code_point_fallback_cache.size();
+
+    if (m_system_font_provider) {
+        m_system_font_provider->for_each_typeface([&](Typeface const& typeface) {
+            statistics.cached_font_count += typeface.cached_font_count();
+        });
+    }
+
+    return statistics;
+}
+
 ErrorOr<Vector<String>> FontDatabase::font_directories()
 {
 #if defined(USE_FONTCONFIG)
@@ -38,6 +38,7 @@ public:
     virtual StringView name() const = 0;
     virtual RefPtr<Gfx::Font> get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope, Optional<FontVariationSettings> const& font_variation_settings = {}, Optional<Gfx::ShapeFeatures> const& shape_features = {}) = 0;
     virtual void for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)>) = 0;
+    virtual void for_each_typeface(Function<void(Typeface const&)>) = 0;
 };
 
 class FontDatabase {
@@ -50,6 +51,15 @@ public:
     void for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)>);
     [[nodiscard]] StringView system_font_provider_name() const;
 
+    // Releases cached fonts, shaping results and code point fallbacks. Everything is recreated on demand.
+    void purge_caches();
+
+    struct CacheStatistics {
+        size_t cached_font_count { 0 };
+        size_t code_point_fallback_count { 0 };
+    };
+    CacheStatistics cache_statistics();
+
     static ErrorOr<Vector<String>> font_directories();
 
 private:
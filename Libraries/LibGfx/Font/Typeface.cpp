@@ -48,6 +48,16 @@ Typeface::~Typeface()
         hb_blob_destroy(m_harfbuzz_blob);
 }
 
+void Typeface::purge_cached_fonts() const
+{
+    m_fonts.remove_all_matching([](auto const&, auto const& font) {
+        if (font->ref_count() == 1)
+            return true;
+        font->shaping_cache().clear();
+        return false;
+    });
+}
+
 NonnullRefPtr<Font> Typeface::font(float point_size, FontVariationSettings const& variations, Gfx::ShapeFeatures const& shape_features) const
 {
     FontCacheKey key { point_size, variations.to_sorted_list(), shape_features };
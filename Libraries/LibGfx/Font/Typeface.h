@@ -78,6 +78,10 @@ public:
 
     hb_face_t* harfbuzz_typeface() const;
 
+    // Drops cached fonts that are not in use elsewhere, and the shaping caches of those that are.
+    void purge_cached_fonts() const;
+    size_t cached_font_count() const { return m_fonts.size(); }
+
     template<typename T>
     bool fast_is() const = delete;
 
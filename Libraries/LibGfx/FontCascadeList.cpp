@@ -10,11 +10,13 @@ namespace Gfx {
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font)
 {
+    invalidate_code_point_cache();
     m_fonts.append({ move(font), {} });
 }
 
 void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> unicode_ranges)
 {
+    invalidate_code_point_cache();
     if (unicode_ranges.is_empty()) {
         m_fonts.append({ move(font), {} });
         return;
@@ -36,32 +38,67 @@ void FontCascadeList::add(NonnullRefPtr<Font const> font, Vector<UnicodeRange> u
 
 void FontCascadeList::extend(FontCascadeList const& other)
 {
+    invalidate_code_point_cache();
     m_fonts.extend(other.m_fonts);
 }
 
+FontCascadeList::CodePointPage& FontCascadeList::code_point_page(u32 code_point) const
+{
+    return *m_code_point_pages.ensure(code_point / code_point_page_size, [] {
+        auto page = make<CodePointPage>();
+        page->fill(0);
+        return page;
+    });
+}
+
 Gfx::Font const& FontCascadeList::font_for_code_point(u32 code_point) const
 {
-    for (auto const& entry : m_fonts) {
+    auto slot = code_point_page(code_point)[code_point % code_point_page_size];
+    if (slot == last_resort_font_slot)
+        return *m_last_resort_font;
+    if (slot != 0)
+        return *m_fonts[slot - 1].font;
+
+    auto font_index = find_font_index_for_code_point(code_point);
+
+    // NB: Finding a system fallback font adds it to the list and so clears the cache, which is why we look up the page
+    //     again here.
+    if (!font_index.has_value())
+        slot = last_resort_font_slot;
+    else if (*font_index <= max_cacheable_font_index)
+        slot = static_cast<u8>(*font_index + 1);
+    code_point_page(code_point)[code_point % code_point_page_size] = slot;
+
+    if (!font_index.has_value())
+        return *m_last_resort_font;
+    return *m_fonts[*font_index].font;
+}
+
+Optional<size_t> FontCascadeList::find_font_index_for_code_point(u32 code_point) const
+{
+    for (size_t i = 0; i < m_fonts.size(); ++i) {
+        auto const& entry = m_fonts[i];
         if (entry.range_data.has_value()) {
             if (!entry.range_data->enclosing_range.contains(code_point))
                 continue;
             for (auto const& range : entry.range_data->unicode_ranges) {
                 if (range.contains(code_point) && entry.font->contains_glyph(code_point))
-                    return entry.font;
+                    return i;
             }
         } else if (entry.font->contains_glyph(code_point)) {
-            return entry.font;
+            return i;
         }
     }
 
     if (m_system_font_fallback_callback) {
         if (auto fallback = m_system_font_fallback_callback(code_point, first())) {
+            invalidate_code_point_cache();
             m_fonts.append({ fallback.release_nonnull(), {} });
-            return *m_fonts.last().font;
+            return m_fonts.size() - 1;
         }
     }
 
-    return *m_last_resort_font;
+    return {};
 }
 
 bool FontCascadeList::equals(FontCascadeList const& other) const
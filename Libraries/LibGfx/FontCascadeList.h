@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/UnicodeRange.h>
 
@@ -53,7 +56,12 @@ public:
     };
 
     void set_last_resort_font(NonnullRefPtr<Font> font) { m_last_resort_font = move(font); }
-    void set_system_font_fallback_callback(SystemFontFallbackCallback callback) { m_system_font_fallback_callback = move(callback); }
+    void set_system_font_fallback_callback(SystemFontFallbackCallback callback)
+    {
+        // NB: Code points that only the last-resort font could render may have a system fallback font now.
+        invalidate_code_point_cache();
+        m_system_font_fallback_callback = move(callback);
+    }
 
     Font const& first_text_face() const
     {
@@ -64,8 +72,24 @@ public:
     }
 
 private:
+    Optional<size_t> find_font_index_for_code_point(u32 code_point) const;
+
+    // Remembers which font renders each code point that has been looked up, as checking each font in turn for a glyph
+    // (and asking the system for a fallback font when none has one) is expensive. Code points are grouped into pages of
+    // 256, which is about the size of a Unicode block, so text in any one script only needs a few pages.
+    // Each slot holds the index of the font in m_fonts plus one, 0 if the code point hasn't been looked up yet, or
+    // last_resort_font_slot if no font other than the last-resort one has a glyph for it.
+    static constexpr size_t code_point_page_size = 256;
+    static constexpr u8 last_resort_font_slot = 0xff;
+    static constexpr size_t max_cacheable_font_index = last_resort_font_slot - 2;
+    using CodePointPage = Array<u8, code_point_page_size>;
+
+    CodePointPage& code_point_page(u32 code_point) const;
+    void invalidate_code_point_cache() const { m_code_point_pages.clear(); }
+
     RefPtr<Font const> m_last_resort_font;
     mutable Vector<Entry> m_fonts;
+    mutable HashMap<u32, NonnullOwnPtr<CodePointPage>> m_code_point_pages;
     SystemFontFallbackCallback m_system_font_fallback_callback;
 };
 
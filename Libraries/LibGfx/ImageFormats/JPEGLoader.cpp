@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <LibGfx/CMYKBitmap.h>
 #include <LibGfx/ImageFormats/JPEGLoader.h>
 #include <jpeglib.h>
@@ -26,19 +27,79 @@ struct JPEGLoadingContext {
     ReadonlyBytes data;
     Vector<u8> icc_data;
 
+    IntSize natural_size;
+    // The ideal size the bitmaps were decoded for, if they were scaled down while decoding.
+    Optional<IntSize> decoded_ideal_size;
+
     JPEGLoadingContext(ReadonlyBytes data)
         : data(data)
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+// NB: The products only depend on one 8-bit component each, so we compute them once up front. This keeps the results
+//     identical to evaluating the expressions per pixel.
+struct YCCKTables {
+    Array<float, 256> cr_to_r;
+    Array<float, 256> cb_to_g;
+    Array<float, 256> cr_to_g;
+    Array<float, 256> cb_to_b;
+};
+
+static YCCKTables const& ycck_tables()
+{
+    static YCCKTables const tables = [] {
+        YCCKTables tables;
+        for (int i = 0; i < 256; ++i) {
+            tables.cr_to_r[i] = 1.402f * (i - 128);
+            tables.cb_to_g[i] = 0.3441f * (i - 128);
+            tables.cr_to_g[i] = 0.7141f * (i - 128);
+            tables.cb_to_b[i] = 1.772f * (i - 128);
+        }
+        return tables;
+    }();
+    return tables;
+}
+
+// If image is in YCCK color space, we convert it to CMYK
+// and then CMYK code path will handle the rest
+static void convert_ycck_row_to_cmyk(Span<CMYK> row)
+{
+    auto const& tables = ycck_tables();
+    for (auto& pixel : row) {
+        auto y = pixel.c;
+        auto cb = pixel.m;
+        auto cr = pixel.y;
+
+        int r = y + tables.cr_to_r[cr];
+        int g = y - tables.cb_to_g[cb] - tables.cr_to_g[cr];
+        int b = y + tables.cb_to_b[cb];
+
+        pixel = {
+            static_cast<u8>(clamp(r, 0, 255)),
+            static_cast<u8>(clamp(g, 0, 255)),
+            static_cast<u8>(clamp(b, 0, 255)),
+            static_cast<u8>(255 - pixel.k),
+        };
+    }
+}
+
+static void invert_cmyk_row(Span<CMYK> row)
+{
+    // NB: Inverting all four components at once lets the compiler vectorize this loop.
+    static_assert(sizeof(CMYK) == sizeof(u32));
+    auto* pixels = reinterpret_cast<u32*>(row.data());
+    for (size_t i = 0; i < row.size(); ++i)
+        pixels[i] = ~pixels[i];
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
 {
     struct jpeg_decompress_struct cinfo;
     ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
@@ -81,6 +142,24 @@ ErrorOr<void> JPEGLoadingContext::decode()
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    natural_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+
+    // OPTIMIZATION: libjpeg can scale the image down in steps of 1/8 while decoding it, which saves us from decoding and
+    //               storing every one of its pixels when only a smaller version of it is wanted. Pick the smallest scale
+    //               that still covers the ideal size.
+    decoded_ideal_size.clear();
+    if (ideal_size.has_value() && !ideal_size->is_empty() && ideal_size->width() < natural_size.width() && ideal_size->height() < natural_size.height()) {
+        cinfo.scale_denom = 8;
+        for (unsigned scale_num = 1; scale_num < 8; ++scale_num) {
+            if (ceil_div(cinfo.image_width * scale_num, 8u) >= static_cast<unsigned>(ideal_size->width())
+                && ceil_div(cinfo.image_height * scale_num, 8u) >= static_cast<unsigned>(ideal_size->height())) {
+                cinfo.scale_num = scale_num;
+                decoded_ideal_size = ideal_size;
+                break;
+            }
+        }
+    }
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -104,67 +183,28 @@ ErrorOr<void> JPEGLoadingContext::decode()
             }
         }
     } else {
+        // Photoshop writes inverted CMYK data (i.e. Photoshop's 0 should be 255). We convert this
+        // to expected values.
+        bool should_invert_cmyk = cinfo.jpeg_color_space == JCS_CMYK
+            && (!cinfo.saw_Adobe_marker || cinfo.Adobe_transform == 0);
+
         cmyk_bitmap = TRY(CMYKBitmap::create_with_size({ static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
         while (cinfo.output_scanline < cinfo.output_height) {
-            auto* row_ptr = (u8*)cmyk_bitmap->scanline(cinfo.output_scanline);
+            auto* line = cmyk_bitmap->scanline(cinfo.output_scanline);
+            auto* row_ptr = (u8*)line;
             auto out_size = jpeg_read_scanlines(&cinfo, &row_ptr, 1);
             if (cinfo.output_scanline < cinfo.output_height && out_size == 0) {
                 dbgln("JPEG Warning: Decoding produced no more scanlines in scanline {}/{}.", cinfo.output_scanline, cinfo.output_height);
                 could_read_all_scanlines = false;
                 break;
             }
-        }
 
-        // If image is in YCCK color space, we convert it to CMYK
-        // and then CMYK code path will handle the rest
-        if (cinfo.out_color_space == JCS_YCCK) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = cmyk_bitmap->scanline(i)[j];
-
-                    auto y = cmyk.c;
-                    auto cb = cmyk.m;
-                    auto cr = cmyk.y;
-                    auto k = cmyk.k;
-
-                    int r = y + 1.402f * (cr - 128);
-                    int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
-                    int b = y + 1.772f * (cb - 128);
-
-                    y = clamp(r, 0, 255);
-                    cb = clamp(g, 0, 255);
-                    cr = clamp(b, 0, 255);
-                    k = 255 - k;
-
-                    cmyk_bitmap->scanline(i)[j] = {
-                        y,
-                        cb,
-                        cr,
-                        k,
-                    };
-                }
-            }
-        }
-
-        // Photoshop writes inverted CMYK data (i.e. Photoshop's 0 should be 255). We convert this
-        // to expected values.
-        bool should_invert_cmyk = cinfo.jpeg_color_space == JCS_CMYK
-            && (!cinfo.saw_Adobe_marker || cinfo.Adobe_transform == 0);
-
-        if (should_invert_cmyk) {
-            for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                auto* line = cmyk_bitmap->scanline(i);
-
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = line[j];
-                    line[j] = {
-                        static_cast<u8>(255 - cmyk.c),
-                        static_cast<u8>(255 - cmyk.m),
-                        static_cast<u8>(255 - cmyk.y),
-                        static_cast<u8>(255 - cmyk.k),
-                    };
-                }
-            }
+            // OPTIMIZATION: Fix up each row right after decoding it, while it's still in cache, instead of walking the
+            //               whole bitmap again afterwards.
+            if (cinfo.out_color_space == JCS_YCCK)
+                convert_ycck_row_to_cmyk({ line, cinfo.output_width });
+            else if (should_invert_cmyk)
+                invert_cmyk_row({ line, cinfo.output_width });
         }
     }
 
@@ -201,11 +241,7 @@ IntSize JPEGImageDecoderPlugin::size()
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->natural_size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -221,7 +257,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -229,8 +265,16 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
+    // NB: Bitmaps that were scaled down for one ideal size can't be reused for another.
+    if (m_context->state == JPEGLoadingContext::State::Decoded && m_context->decoded_ideal_size.has_value() && m_context->decoded_ideal_size != ideal_size) {
+        m_context->rgb_bitmap = nullptr;
+        m_context->cmyk_bitmap = nullptr;
+        m_context->icc_data.clear();
+        m_context->state = JPEGLoadingContext::State::NotDecoded;
+    }
+
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+        if (auto result = m_context->decode(ideal_size); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -162,6 +162,12 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
 
     png_set_error_fn(m_context->png_ptr, nullptr, log_png_error, log_png_warning);
 
+    // OPTIMIZATION: Skip verifying the zlib stream's Adler-32 checksum, which costs an extra pass over every inflated byte.
+    //               Each chunk is still covered by its own CRC, so corrupted data is caught regardless.
+#ifdef PNG_IGNORE_ADLER32
+    png_set_option(m_context->png_ptr, PNG_IGNORE_ADLER32, PNG_OPTION_ON);
+#endif
+
     png_read_info(m_context->png_ptr, m_context->info_ptr);
 
     u32 width = 0;
@@ -44,6 +44,12 @@ ErrorOr<ByteBuffer> PNGWriter::encode(Gfx::Bitmap const& bitmap, Options options
         png_set_iCCP(png_ptr, info_ptr, "embedded profile", 0, options.icc_data->data(), options.icc_data->size());
     }
 
+    if (options.compression_level.has_value()) {
+        png_set_compression_level(png_ptr, *options.compression_level);
+        if (*options.compression_level <= 1)
+            png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+    }
+
     if (bitmap.format() == BitmapFormat::BGRA8888 || bitmap.format() == BitmapFormat::BGRx8888) {
         png_set_bgr(png_ptr);
     }
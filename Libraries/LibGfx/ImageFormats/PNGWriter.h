@@ -18,6 +18,11 @@ struct PNGWriterOptions {
     // Data for the iCCP chunk.
     // FIXME: Allow writing cICP, sRGB, or gAMA instead too.
     Optional<ReadonlyBytes> icc_data;
+
+    // The zlib compression level, from 0 (no compression) to 9 (smallest output). Uses zlib's default if not given.
+    // At level 1 and below, rows are also filtered with a single fixed filter instead of trying every filter on each row,
+    // which makes encoding several times faster for images that only need to be written and read once.
+    Optional<int> compression_level;
 };
 
 class PNGWriter {
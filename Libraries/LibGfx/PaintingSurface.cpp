@@ -9,6 +9,7 @@
 #include <LibGfx/SkiaUtils.h>
 
 #include <core/SkColorSpace.h>
+#include <core/SkPixmap.h>
 #include <core/SkSurface.h>
 #include <gpu/ganesh/GrBackendSurface.h>
 #include <gpu/ganesh/GrDirectContext.h>
@@ -124,6 +125,20 @@ NonnullRefPtr<PaintingSurface> PaintingSurface::wrap_bitmap(Bitmap& bitmap)
     return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, size, surface, bitmap)));
 }
 
+RefPtr<PaintingSurface> PaintingSurface::raster_subsurface(IntRect const& rect) const
+{
+    SkPixmap pixmap;
+    if (!m_impl->surface->peekPixels(&pixmap))
+        return nullptr;
+    SkPixmap subset;
+    if (!pixmap.extractSubset(&subset, SkIRect::MakeXYWH(rect.x(), rect.y(), rect.width(), rect.height())))
+        return nullptr;
+    auto surface = SkSurfaces::WrapPixels(subset.info(), subset.writable_addr(), subset.rowBytes());
+    if (!surface)
+        return nullptr;
+    return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, IntSize { subset.width(), subset.height() }, surface, nullptr)));
+}
+
 #ifdef AK_OS_MACOS
 NonnullRefPtr<PaintingSurface> PaintingSurface::create_from_iosurface(Core::IOSurfaceHandle&& iosurface_handle, NonnullRefPtr<SkiaBackendContext> context, Origin origin)
 {
@@ -155,14 +170,14 @@ PaintingSurface::~PaintingSurface()
     unlock_context();
 }
 
-void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
+void PaintingSurface::read_into_bitmap(Bitmap& bitmap, IntPoint source_position)
 {
     lock_context();
     auto color_type = to_skia_color_type(bitmap.format());
     auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
     auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
     SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
-    m_impl->surface->readPixels(pixmap, 0, 0);
+    m_impl->surface->readPixels(pixmap, source_position.x(), source_position.y());
     unlock_context();
 }
 
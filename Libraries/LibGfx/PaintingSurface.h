@@ -43,7 +43,13 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_vkimage(NonnullRefPtr<SkiaBackendContext> context, NonnullRefPtr<VulkanImage> vulkan_image, Origin origin);
 #endif
 
-    void read_into_bitmap(Bitmap&);
+    // Returns a surface that draws directly into the given part of this surface's pixels, or null if this surface isn't
+    // CPU-backed. The returned surface must not outlive this one.
+    RefPtr<PaintingSurface> raster_subsurface(IntRect const&) const;
+
+    // Reads the pixels of the bitmap-sized rect at the given position. Pixels of the bitmap that fall outside of this
+    // surface are left untouched. Conversions between pixel formats and alpha types happen as part of the read.
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
     void write_from_bitmap(Bitmap const&);
 
     void notify_content_will_change();
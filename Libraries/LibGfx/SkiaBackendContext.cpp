@@ -27,6 +27,20 @@
 
 namespace Gfx {
 
+void SkiaBackendContext::set_resource_cache_limit(size_t bytes)
+{
+    Threading::MutexLocker const locker { m_mutex };
+    if (auto* context = sk_context())
+        context->setResourceCacheLimit(bytes);
+}
+
+void SkiaBackendContext::purge_unused_resources()
+{
+    Threading::MutexLocker const locker { m_mutex };
+    if (auto* context = sk_context())
+        context->freeGpuResources();
+}
+
 #ifdef USE_VULKAN
 class SkiaVulkanBackendContext final : public SkiaBackendContext {
     AK_MAKE_NONCOPYABLE(SkiaVulkanBackendContext);
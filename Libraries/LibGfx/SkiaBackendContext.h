@@ -48,6 +48,13 @@ public:
     virtual MetalContext& metal_context() = 0;
     virtual VulkanContext const& vulkan_context() = 0;
 
+    // Limits how many bytes of GPU memory Skia may keep around for textures it can recreate, e.g. uploaded glyphs
+    // and scratch render targets.
+    void set_resource_cache_limit(size_t bytes);
+
+    // Frees every GPU resource Skia is holding onto that isn't in use, e.g. when nothing is being shown.
+    void purge_unused_resources();
+
     void lock() { m_mutex.lock(); }
     void unlock() { m_mutex.unlock(); }
 
@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/Debug.h>
 #include <AK/HashFunctions.h>
+#include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <LibCore/System.h>
 #include <LibFileSystem/FileSystem.h>
@@ -229,8 +231,13 @@ ErrorOr<NonnullOwnPtr<CacheEntryReader>> CacheEntryReader::create(DiskCache& dis
     Optional<String> reason_phrase;
 
     auto result = [&]() -> ErrorOr<void> {
-        cache_header = TRY(file->read_value<CacheHeader>());
-        cache_header_size = TRY(file->tell());
+        // OPTIMIZATION: The file is unbuffered, so read the header in one go rather than with one syscall per field.
+        Array<u8, CacheHeader::SERIALIZED_SIZE> header_bytes;
+        TRY(file->read_until_filled(header_bytes.span()));
+
+        FixedMemoryStream header_stream { header_bytes.span() };
+        cache_header = TRY(header_stream.read_value<CacheHeader>());
+        cache_header_size = header_bytes.size();
 
         if (cache_header.magic != CacheHeader::CACHE_MAGIC)
             return Error::from_string_literal("Magic value mismatch");
@@ -27,6 +27,7 @@ struct CacheHeader {
     u32 hash() const;
 
     static constexpr auto CACHE_MAGIC = 0xcafef00du;
+    static constexpr size_t SERIALIZED_SIZE = 8 * sizeof(u32);
 
     u32 magic { CACHE_MAGIC };
     u32 version { CACHE_VERSION };
@@ -119,6 +120,10 @@ public:
     RevalidationType revalidation_type() const { return m_revalidation_type; }
     void set_revalidation_type(RevalidationType revalidation_type) { m_revalidation_type = revalidation_type; }
 
+    // Whether this entry may be served if revalidating it fails with a network error or a server error.
+    bool may_serve_stale_on_error() const { return m_may_serve_stale_on_error; }
+    void set_may_serve_stale_on_error(bool may_serve_stale_on_error) { m_may_serve_stale_on_error = may_serve_stale_on_error; }
+
     void revalidation_succeeded(HeaderList const&);
     void revalidation_failed();
 
@@ -152,6 +157,7 @@ private:
     NonnullRefPtr<HeaderList> m_response_headers;
 
     RevalidationType m_revalidation_type { RevalidationType::None };
+    bool m_may_serve_stale_on_error { false };
 
     u64 const m_data_offset { 0 };
     u64 const m_data_size { 0 };
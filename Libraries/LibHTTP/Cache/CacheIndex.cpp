@@ -14,6 +14,11 @@ namespace HTTP {
 
 static constexpr u32 CACHE_METADATA_KEY = 12389u;
 
+// OPTIMIZATION: Each SQLite write is its own transaction, which is far more expensive than serving a small cache hit.
+//               We instead write access times in a single transaction once enough of them have accumulated.
+static constexpr size_t MAX_PENDING_LAST_ACCESS_TIMES = 64uz;
+static constexpr auto MAX_LAST_ACCESS_TIME_FLUSH_DELAY = AK::Duration::from_seconds(5);
+
 static ByteString serialize_headers(HeaderList const& headers)
 {
     StringBuilder builder;
@@ -99,12 +104,21 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database)
     statements.insert_entry = TRY(database.prepare_statement("INSERT OR REPLACE INTO CacheIndex VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.remove_entry = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE cache_key = ? AND vary_key = ?;"sv));
     statements.remove_entries_accessed_since = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE last_access_time >= ? RETURNING cache_key, vary_key;"sv));
+    statements.remove_least_recently_accessed_entries = TRY(database.prepare_statement(R"#(
+        DELETE FROM CacheIndex WHERE rowid IN (SELECT rowid FROM CacheIndex ORDER BY last_access_time ASC LIMIT ?)
+        RETURNING cache_key, vary_key, data_size + OCTET_LENGTH(response_headers);
+    )#"sv));
     statements.select_entries = TRY(database.prepare_statement("SELECT * FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.update_response_headers = TRY(database.prepare_statement("UPDATE CacheIndex SET response_headers = ? WHERE cache_key = ? AND vary_key = ?;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ? WHERE cache_key = ? AND vary_key = ?;"sv));
     statements.estimate_cache_size_accessed_since = TRY(database.prepare_statement("SELECT SUM(data_size) + SUM(OCTET_LENGTH(response_headers)) FROM CacheIndex WHERE last_access_time >= ?;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+
+    CacheIndex index { database, statements };
+    index.m_estimated_total_size = index.estimate_cache_size_accessed_since(UnixDateTime::earliest()).total;
 
-    return CacheIndex { database, statements };
+    return index;
 }
 
 CacheIndex::CacheIndex(Database::Database& database, Statements statements)
@@ -113,6 +127,11 @@ CacheIndex::CacheIndex(Database::Database& database, Statements statements)
 {
 }
 
+CacheIndex::~CacheIndex()
+{
+    flush_pending_last_access_times();
+}
+
 void CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time)
 {
     auto now = UnixDateTime::now();
@@ -137,7 +156,10 @@ void CacheIndex::create_entry(u64 cache_key, u64 vary_key, String url, NonnullRe
         .last_access_time = now,
     };
 
-    m_database->execute_statement(m_statements.insert_entry, {}, cache_key, vary_key, entry.url, serialize_headers(entry.request_headers), serialize_headers(entry.response_headers), entry.data_size, entry.request_time, entry.response_time, entry.last_access_time);
+    auto serialized_response_headers = serialize_headers(entry.response_headers);
+    m_estimated_total_size += entry.data_size + serialized_response_headers.length();
+
+    m_database->execute_statement(m_statements.insert_entry, {}, cache_key, vary_key, entry.url, serialize_headers(entry.request_headers), serialized_response_headers, entry.data_size, entry.request_time, entry.response_time, entry.last_access_time);
     m_entries.ensure(cache_key).append(move(entry));
 }
 
@@ -149,24 +171,67 @@ void CacheIndex::remove_entry(u64 cache_key, u64 vary_key)
 
 void CacheIndex::remove_entries_accessed_since(UnixDateTime since, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
 {
+    flush_pending_last_access_times();
+
     m_database->execute_statement(
         m_statements.remove_entries_accessed_since,
         [&](auto statement_id) {
             auto cache_key = m_database->result_column<u64>(statement_id, 0);
             auto vary_key = m_database->result_column<u64>(statement_id, 1);
 
-            if (auto entries = m_entries.get(cache_key); entries.has_value()) {
-                entries->remove_first_matching([&](auto const& entry) { return entry.vary_key == vary_key; });
-
-                if (entries->is_empty())
-                    m_entries.remove(cache_key);
-
+            if (m_entries.contains(cache_key)) {
+                remove_entry_from_memory(cache_key, vary_key);
                 on_entry_removed(cache_key, vary_key);
             }
         },
         since);
 }
 
+void CacheIndex::remove_least_recently_accessed_entries(u64 target_size, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed)
+{
+    static constexpr u32 ENTRIES_REMOVED_PER_BATCH = 8u;
+
+    flush_pending_last_access_times();
+
+    auto total_size = estimate_cache_size_accessed_since(UnixDateTime::earliest()).total;
+
+    while (total_size > target_size) {
+        auto removed_entries = 0u;
+
+        m_database->execute_statement(
+            m_statements.remove_least_recently_accessed_entries,
+            [&](auto statement_id) {
+                auto cache_key = m_database->result_column<u64>(statement_id, 0);
+                auto vary_key = m_database->result_column<u64>(statement_id, 1);
+                auto entry_size = m_database->result_column<u64>(statement_id, 2);
+
+                total_size -= min(entry_size, total_size);
+                ++removed_entries;
+
+                remove_entry_from_memory(cache_key, vary_key);
+                on_entry_removed(cache_key, vary_key);
+            },
+            ENTRIES_REMOVED_PER_BATCH);
+
+        if (removed_entries == 0)
+            break;
+    }
+
+    m_estimated_total_size = total_size;
+}
+
+void CacheIndex::remove_entry_from_memory(u64 cache_key, u64 vary_key)
+{
+    auto entries = m_entries.get(cache_key);
+    if (!entries.has_value())
+        return;
+
+    entries->remove_first_matching([&](auto const& entry) { return entry.vary_key == vary_key; });
+
+    if (entries->is_empty())
+        m_entries.remove(cache_key);
+}
+
 void CacheIndex::update_response_headers(u64 cache_key, u64 vary_key, NonnullRefPtr<HeaderList> response_headers)
 {
     auto entry = get_entry(cache_key, vary_key);
@@ -184,9 +249,36 @@ void CacheIndex::update_last_access_time(u64 cache_key, u64 vary_key)
         return;
 
     auto now = UnixDateTime::now();
-
-    m_database->execute_statement(m_statements.update_last_access_time, {}, now, cache_key, vary_key);
     entry->last_access_time = now;
+
+    auto pending = m_pending_last_access_times.find_if([&](auto const& pending) {
+        return pending.cache_key == cache_key && pending.vary_key == vary_key;
+    });
+
+    if (pending.is_end()) {
+        if (m_pending_last_access_times.is_empty())
+            m_oldest_pending_last_access_time = now;
+        m_pending_last_access_times.append({ cache_key, vary_key, now });
+    } else {
+        pending->last_access_time = now;
+    }
+
+    if (m_pending_last_access_times.size() >= MAX_PENDING_LAST_ACCESS_TIMES || now - m_oldest_pending_last_access_time >= MAX_LAST_ACCESS_TIME_FLUSH_DELAY)
+        flush_pending_last_access_times();
+}
+
+void CacheIndex::flush_pending_last_access_times()
+{
+    if (m_pending_last_access_times.is_empty())
+        return;
+
+    m_database->execute_statement(m_statements.begin_transaction, {});
+
+    for (auto const& pending : m_pending_last_access_times)
+        m_database->execute_statement(m_statements.update_last_access_time, {}, pending.last_access_time, pending.cache_key, pending.vary_key);
+
+    m_database->execute_statement(m_statements.commit_transaction, {});
+    m_pending_last_access_times.clear_with_capacity();
 }
 
 Optional<CacheIndex::Entry const&> CacheIndex::find_entry(u64 cache_key, HeaderList const& request_headers)
@@ -231,6 +323,8 @@ Optional<CacheIndex::Entry&> CacheIndex::get_entry(u64 cache_key, u64 vary_key)
 
 Requests::CacheSizes CacheIndex::estimate_cache_size_accessed_since(UnixDateTime since)
 {
+    flush_pending_last_access_times();
+
     Requests::CacheSizes sizes;
 
     m_database->execute_statement(
@@ -36,10 +36,22 @@ class CacheIndex {
 public:
     static ErrorOr<CacheIndex> create(Database::Database&);
 
+    CacheIndex(CacheIndex&&) = default;
+    CacheIndex& operator=(CacheIndex&&) = default;
+
+    ~CacheIndex();
+
     void create_entry(u64 cache_key, u64 vary_key, String url, NonnullRefPtr<HeaderList> request_headers, NonnullRefPtr<HeaderList> response_headers, u64 data_size, UnixDateTime request_time, UnixDateTime response_time);
     void remove_entry(u64 cache_key, u64 vary_key);
     void remove_entries_accessed_since(UnixDateTime, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
 
+    // Removes the least recently accessed entries until the size of the cache is at most the given size.
+    void remove_least_recently_accessed_entries(u64 target_size, Function<void(u64 cache_key, u64 vary_key)> on_entry_removed);
+
+    // An upper bound of the size of the cache, which is cheap to query after every write. Use estimate_cache_size_accessed_since
+    // for the actual size.
+    u64 estimated_total_size() const { return m_estimated_total_size; }
+
     Optional<Entry const&> find_entry(u64 cache_key, HeaderList const& request_headers);
 
     void update_response_headers(u64 cache_key, u64 vary_key, NonnullRefPtr<HeaderList>);
@@ -52,20 +64,39 @@ private:
         Database::StatementID insert_entry { 0 };
         Database::StatementID remove_entry { 0 };
         Database::StatementID remove_entries_accessed_since { 0 };
+        Database::StatementID remove_least_recently_accessed_entries { 0 };
         Database::StatementID select_entries { 0 };
         Database::StatementID update_response_headers { 0 };
         Database::StatementID update_last_access_time { 0 };
         Database::StatementID estimate_cache_size_accessed_since { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     CacheIndex(Database::Database&, Statements);
 
     Optional<Entry&> get_entry(u64 cache_key, u64 vary_key);
+    void remove_entry_from_memory(u64 cache_key, u64 vary_key);
+
+    void flush_pending_last_access_times();
 
     NonnullRawPtr<Database::Database> m_database;
     Statements m_statements;
 
     HashMap<u64, Vector<Entry>> m_entries;
+
+    // NB: This only grows as entries are written. It is recomputed whenever we have to evict entries.
+    u64 m_estimated_total_size { 0 };
+
+    // Every cache hit updates its entry's last access time. These updates are only needed to decide which entries to
+    // evict or clear, so they are applied to the in-memory entries immediately and written to the database in batches.
+    struct PendingLastAccessTime {
+        u64 cache_key { 0 };
+        u64 vary_key { 0 };
+        UnixDateTime last_access_time;
+    };
+    Vector<PendingLastAccessTime> m_pending_last_access_times;
+    UnixDateTime m_oldest_pending_last_access_time;
 };
 
 }
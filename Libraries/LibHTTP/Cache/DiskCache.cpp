@@ -34,18 +34,19 @@ static ByteString cache_directory_for_mode(DiskCache::Mode mode)
     VERIFY_NOT_REACHED();
 }
 
-ErrorOr<DiskCache> DiskCache::create(Mode mode)
+ErrorOr<DiskCache> DiskCache::create(Mode mode, u64 maximum_size)
 {
     auto cache_directory = LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, cache_directory_for_mode(mode));
 
     auto database = TRY(Database::Database::create(cache_directory.string(), INDEX_DATABASE));
     auto index = TRY(CacheIndex::create(database));
 
-    return DiskCache { mode, move(database), move(cache_directory), move(index) };
+    return DiskCache { mode, maximum_size, move(database), move(cache_directory), move(index) };
 }
 
-DiskCache::DiskCache(Mode mode, NonnullRefPtr<Database::Database> database, LexicalPath cache_directory, CacheIndex index)
+DiskCache::DiskCache(Mode mode, u64 maximum_size, NonnullRefPtr<Database::Database> database, LexicalPath cache_directory, CacheIndex index)
     : m_mode(mode)
+    , m_maximum_size(maximum_size)
     , m_database(move(database))
     , m_cache_directory(move(cache_directory))
     , m_index(move(index))
@@ -53,6 +54,8 @@ DiskCache::DiskCache(Mode mode, NonnullRefPtr<Database::Database> database, Lexi
     // Start with a clean slate in non-normal modes.
     if (m_mode != Mode::Normal)
         remove_entries_accessed_since(UnixDateTime::earliest());
+    else
+        remove_entries_if_over_maximum_size();
 }
 
 DiskCache::DiskCache(DiskCache&&) = default;
@@ -141,6 +144,7 @@ Variant<Optional<CacheEntryReader&>, DiskCache::CacheHasOpenEntry> DiskCache::op
 
         dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[36;1mMust revalidate cache entry for\033[0m {} (lifetime={}s age={}s)", url, freshness_lifetime.to_seconds(), current_age.to_seconds());
         cache_entry.value()->set_revalidation_type(CacheEntryReader::RevalidationType::MustRevalidate);
+        cache_entry.value()->set_may_serve_stale_on_error(stale_if_error_permits_reuse(request_headers, response_headers, freshness_lifetime, current_age));
         return {};
     };
 
@@ -248,15 +252,48 @@ void DiskCache::remove_entries_accessed_since(UnixDateTime since)
     });
 }
 
+size_t DiskCache::open_entry_count() const
+{
+    size_t count = 0;
+    for (auto const& it : m_open_cache_entries)
+        count += it.value.size();
+    return count;
+}
+
+void DiskCache::remove_entries_if_over_maximum_size()
+{
+    if (m_index.estimated_total_size() <= m_maximum_size)
+        return;
+
+    // Evict a bit more than we need to, so that we are not evicting an entry for every entry we write once the cache
+    // has filled up.
+    auto target_size = m_maximum_size - (m_maximum_size / 10);
+
+    m_index.remove_least_recently_accessed_entries(target_size, [&](auto cache_key, auto vary_key) {
+        dbgln_if(HTTP_DISK_CACHE_DEBUG, "\033[36m[disk]\033[0m \033[33;1mEvicting cache entry\033[0m {}:{}", cache_key, vary_key);
+
+        // NB: Unlike clearing the cache, we do not mark open entries for deletion here. A reader that is still sending
+        //     an evicted entry keeps its file descriptor, and may finish serving the response.
+        auto cache_path = path_for_cache_entry(m_cache_directory, cache_key, vary_key);
+        (void)FileSystem::remove(cache_path.string(), FileSystem::RecursionMode::Disallowed);
+    });
+}
+
 void DiskCache::cache_entry_closed(Badge<CacheEntry>, CacheEntry const& cache_entry)
 {
     auto cache_key = cache_entry.cache_key();
+    auto was_writer = is<CacheEntryWriter>(cache_entry);
 
     auto open_entries = m_open_cache_entries.get(cache_key);
     if (!open_entries.has_value())
         return;
 
+    // NB: This destroys the cache entry.
     open_entries->remove_first_matching([&](auto const& open_entry) { return open_entry.entry.ptr() == &cache_entry; });
+
+    if (was_writer)
+        remove_entries_if_over_maximum_size();
+
     if (open_entries->size() > 0)
         return;
 
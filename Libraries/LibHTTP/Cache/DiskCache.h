@@ -34,7 +34,8 @@ public:
         // response headers will include some status on how the request was handled.
         Testing,
     };
-    static ErrorOr<DiskCache> create(Mode);
+    static constexpr u64 DEFAULT_MAXIMUM_SIZE = 1 * GiB;
+    static ErrorOr<DiskCache> create(Mode, u64 maximum_size = DEFAULT_MAXIMUM_SIZE);
 
     DiskCache(DiskCache&&);
     DiskCache& operator=(DiskCache&&);
@@ -56,11 +57,13 @@ public:
     void remove_entries_accessed_since(UnixDateTime since);
 
     LexicalPath const& cache_directory() const { return m_cache_directory; }
+    u64 estimated_total_size() const { return m_index.estimated_total_size(); }
+    size_t open_entry_count() const;
 
     void cache_entry_closed(Badge<CacheEntry>, CacheEntry const&);
 
 private:
-    DiskCache(Mode, NonnullRefPtr<Database::Database>, LexicalPath cache_directory, CacheIndex);
+    DiskCache(Mode, u64 maximum_size, NonnullRefPtr<Database::Database>, LexicalPath cache_directory, CacheIndex);
 
     enum class CheckReaderEntries {
         No,
@@ -68,7 +71,10 @@ private:
     };
     bool check_if_cache_has_open_entry(CacheRequest&, u64 cache_key, URL::URL const&, CheckReaderEntries);
 
+    void remove_entries_if_over_maximum_size();
+
     Mode m_mode;
+    u64 m_maximum_size { DEFAULT_MAXIMUM_SIZE };
 
     NonnullRefPtr<Database::Database> m_database;
 
@@ -139,4 +139,20 @@ void MemoryCache::finalize_entry(URL::URL const& url, StringView method, HeaderL
     }
 }
 
+MemoryCache::Statistics MemoryCache::statistics() const
+{
+    Statistics statistics;
+
+    for (auto const& it : m_pending_entries)
+        statistics.pending_entry_count += it.value.size();
+
+    for (auto const& it : m_complete_entries) {
+        statistics.entry_count += it.value.size();
+        for (auto const& entry : it.value)
+            statistics.body_size += entry.response_body.size();
+    }
+
+    return statistics;
+}
+
 }
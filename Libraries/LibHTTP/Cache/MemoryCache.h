@@ -39,6 +39,13 @@ public:
     void create_entry(URL::URL const&, StringView method, HeaderList const& request_headers, UnixDateTime request_time, u32 status_code, ByteString reason_phrase, HeaderList const& response_headers);
     void finalize_entry(URL::URL const&, StringView method, HeaderList const& request_headers, u32 status_code, HeaderList const& response_headers, ByteBuffer response_body);
 
+    struct Statistics {
+        size_t entry_count { 0 };
+        size_t pending_entry_count { 0 };
+        size_t body_size { 0 };
+    };
+    Statistics statistics() const;
+
 private:
     HashMap<u64, Vector<Entry>> m_pending_entries;
     HashMap<u64, Vector<Entry>> m_complete_entries;
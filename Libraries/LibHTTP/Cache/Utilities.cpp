@@ -384,6 +384,40 @@ AK::Duration calculate_stale_while_revalidate_lifetime(HeaderList const& headers
     return {};
 }
 
+// https://httpwg.org/specs/rfc5861.html#n-the-stale-if-error-cache-control-extension
+bool stale_if_error_permits_reuse(HeaderList const& request_headers, HeaderList const& response_headers, AK::Duration freshness_lifetime, AK::Duration current_age)
+{
+    auto response_cache_control = response_headers.get("Cache-Control"sv);
+    if (!response_cache_control.has_value())
+        return false;
+
+    // https://httpwg.org/specs/rfc9111.html#serving.stale.responses
+    // A cache MUST NOT generate a stale response if it is prohibited by an explicit in-protocol directive (e.g., by a
+    // no-cache response directive, a must-revalidate response directive, or an applicable s-maxage or proxy-revalidate
+    // response directive).
+    if (contains_cache_control_directive(*response_cache_control, "no-cache"sv) || contains_cache_control_directive(*response_cache_control, "must-revalidate"sv))
+        return false;
+
+    // The stale-if-error Cache-Control extension indicates that when an error is encountered, a cached stale response
+    // MAY be used to satisfy the request, regardless of other freshness information.
+    //
+    // When used as a request Cache-Control extension, its scope of application is the request it appears in; when used
+    // as a response Cache-Control extension, its scope is any request applicable to the cached response in which it
+    // occurs.
+    auto stale_if_error = extract_cache_control_duration_directive(*response_cache_control, "stale-if-error"sv);
+
+    if (auto request_cache_control = request_headers.get("Cache-Control"sv); request_cache_control.has_value()) {
+        if (auto request_stale_if_error = extract_cache_control_duration_directive(*request_cache_control, "stale-if-error"sv); request_stale_if_error.has_value())
+            stale_if_error = request_stale_if_error;
+    }
+
+    // Its value indicates the upper limit to staleness; when the cached response is more stale than the indicated
+    // amount, the cached response SHOULD NOT be used to satisfy the request, absent other information.
+    if (!stale_if_error.has_value())
+        return false;
+    return freshness_lifetime + *stale_if_error > current_age;
+}
+
 CacheLifetimeStatus cache_lifetime_status(HeaderList const& request_headers, HeaderList const& response_headers, AK::Duration freshness_lifetime, AK::Duration current_age)
 {
     auto revalidation_status = [&](auto revalidation_type) {
@@ -463,6 +497,11 @@ CacheLifetimeStatus cache_lifetime_status(HeaderList const& request_headers, Hea
     if (contains_cache_control_directive(*response_cache_control, "must-revalidate"sv))
         return revalidation_status(CacheLifetimeStatus::MustRevalidate);
 
+    // NB: A response that may be served when the origin fails must be revalidated rather than fetched anew, otherwise we
+    //     would have discarded the stale response by the time we learn that the origin has failed.
+    if (stale_if_error_permits_reuse(request_headers, response_headers, freshness_lifetime, current_age))
+        return revalidation_status(CacheLifetimeStatus::MustRevalidate);
+
     return CacheLifetimeStatus::Expired;
 }
 
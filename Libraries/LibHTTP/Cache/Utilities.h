@@ -41,6 +41,7 @@ enum class CacheLifetimeStatus {
     StaleWhileRevalidate,
 };
 CacheLifetimeStatus cache_lifetime_status(HeaderList const& request_headers, HeaderList const& response_headers, AK::Duration freshness_lifetime, AK::Duration current_age);
+bool stale_if_error_permits_reuse(HeaderList const& request_headers, HeaderList const& response_headers, AK::Duration freshness_lifetime, AK::Duration current_age);
 
 struct RevalidationAttributes {
     static RevalidationAttributes create(HeaderList const&);
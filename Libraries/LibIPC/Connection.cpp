@@ -8,6 +8,7 @@
 
 #include <AK/Vector.h>
 #include <LibCore/Socket.h>
+#include <LibCore/TraceEvent.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
@@ -21,7 +22,7 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> t
 {
     m_transport->set_up_read_hook([this] {
         NonnullRefPtr protect = *this;
-        drain_messages_from_peer();
+        drain_messages_from_peer(ShouldScheduleMessageHandling::No);
         handle_messages();
     });
 }
@@ -35,6 +36,7 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
+    Core::ScopedTraceEvent trace_event { Core::TraceCategory::IPC, message.message_name() };
     return post_message(TRY(message.encode()));
 }
 
@@ -72,6 +74,7 @@ void ConnectionBase::handle_messages()
         if (!is_open())
             dbgln("Handling message while connection closed: {}", message->message_name());
 
+        Core::ScopedTraceEvent trace_event { Core::TraceCategory::IPC, message->message_name() };
         auto handler_result = m_local_stub.handle(move(message));
         if (handler_result.is_error()) {
             dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
@@ -81,8 +84,8 @@ void ConnectionBase::handle_messages()
         if (!is_open())
             continue;
 
-        if (auto response = handler_result.release_value()) {
-            if (auto post_result = post_message(*response); post_result.is_error())
+        if (auto response = handler_result.release_value(); response.has_value()) {
+            if (auto post_result = post_message(response.release_value()); post_result.is_error())
                 dbgln("IPC::ConnectionBase::handle_messages: {}", post_result.error());
         }
     }
@@ -93,7 +96,7 @@ void ConnectionBase::wait_for_transport_to_become_readable()
     m_transport->wait_until_readable();
 }
 
-ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
+ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer(ShouldScheduleMessageHandling should_schedule_message_handling)
 {
     bool parse_error = false;
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
@@ -110,7 +113,8 @@ ConnectionBase::PeerEOF ConnectionBase::drain_messages_from_peer()
         schedule_shutdown = Transport::ShouldShutdown::Yes;
     }
 
-    if (!m_unprocessed_messages.is_empty()) {
+    // NB: The read hook handles the drained messages right away, so it doesn't need to schedule that for later.
+    if (!m_unprocessed_messages.is_empty() && should_schedule_message_handling == ShouldScheduleMessageHandling::Yes) {
         deferred_invoke([this] {
             handle_messages();
         });
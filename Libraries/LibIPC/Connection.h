@@ -45,7 +45,11 @@ protected:
         No,
         Yes
     };
-    PeerEOF drain_messages_from_peer();
+    enum class ShouldScheduleMessageHandling {
+        No,
+        Yes
+    };
+    PeerEOF drain_messages_from_peer(ShouldScheduleMessageHandling = ShouldScheduleMessageHandling::Yes);
 
     void handle_messages();
 
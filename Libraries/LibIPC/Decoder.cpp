@@ -8,14 +8,17 @@
 #include <AK/IPv4Address.h>
 #include <AK/IPv6Address.h>
 #include <AK/JsonValue.h>
+#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AK/Types.h>
 #include <AK/Utf16String.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
+#include <LibCore/System.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/File.h>
+#include <LibIPC/Limits.h>
 #include <LibURL/Parser.h>
 #include <LibURL/URL.h>
 
@@ -33,11 +36,56 @@ ErrorOr<size_t> Decoder::decode_size()
     return size;
 }
 
+ErrorOr<Decoder::PayloadSize> Decoder::decode_payload_size()
+{
+    auto encoded_size = TRY(decode<u32>());
+
+    PayloadSize size {
+        .element_count = static_cast<size_t>(encoded_size & ~SHARED_MEMORY_PAYLOAD_FLAG),
+        .is_in_shared_memory = (encoded_size & SHARED_MEMORY_PAYLOAD_FLAG) != 0,
+    };
+    if (size.element_count > MAX_DECODED_SIZE)
+        return Error::from_string_literal("IPC decode: Size exceeds maximum allowed");
+    return size;
+}
+
+ErrorOr<Core::AnonymousBuffer> Decoder::decode_shared_memory_payload(size_t byte_count)
+{
+    auto file = TRY(decode<IPC::File>());
+
+#if !defined(AK_OS_WINDOWS)
+    // NB: Mapping more bytes than the peer actually allocated would fault as soon as we touched them.
+    auto stat = TRY(Core::System::fstat(file.fd()));
+    if (stat.st_size < 0 || static_cast<size_t>(stat.st_size) < byte_count)
+        return Error::from_string_literal("IPC decode: Shared memory payload is smaller than its encoded size");
+#endif
+
+    return Core::AnonymousBuffer::create_from_anon_fd(file.take_fd(), byte_count);
+}
+
+ErrorOr<void> Decoder::decode_payload_into(PayloadSize size, Bytes bytes)
+{
+    if (!size.is_in_shared_memory)
+        return decode_into(bytes);
+
+    auto buffer = TRY(decode_shared_memory_payload(bytes.size()));
+    buffer.bytes().copy_to(bytes);
+    return {};
+}
+
 template<>
 ErrorOr<String> decode(Decoder& decoder)
 {
-    auto length = TRY(decoder.decode_size());
-    return String::from_stream(decoder.stream(), length);
+    auto size = TRY(decoder.decode_payload_size());
+    if (size.is_in_shared_memory) {
+        auto buffer = TRY(decoder.decode_shared_memory_payload(size.element_count));
+
+        // NB: The peer can still write to the shared memory, so we must validate our own copy of the payload rather
+        //     than the mapping itself.
+        FixedMemoryStream stream { buffer.bytes() };
+        return String::from_stream(stream, size.element_count);
+    }
+    return String::from_stream(decoder.stream(), size.element_count);
 }
 
 template<>
@@ -52,12 +100,12 @@ ErrorOr<Utf16String> decode(Decoder& decoder)
 template<>
 ErrorOr<ByteString> decode(Decoder& decoder)
 {
-    auto length = TRY(decoder.decode_size());
-    if (length == 0)
+    auto size = TRY(decoder.decode_payload_size());
+    if (size.element_count == 0)
         return ByteString::empty();
 
-    return ByteString::create_and_overwrite(length, [&](Bytes bytes) -> ErrorOr<void> {
-        TRY(decoder.decode_into(bytes));
+    return ByteString::create_and_overwrite(size.element_count, [&](Bytes bytes) -> ErrorOr<void> {
+        TRY(decoder.decode_payload_into(size, bytes));
         return {};
     });
 }
@@ -65,14 +113,14 @@ ErrorOr<ByteString> decode(Decoder& decoder)
 template<>
 ErrorOr<ByteBuffer> decode(Decoder& decoder)
 {
-    auto length = TRY(decoder.decode_size());
-    if (length == 0)
+    auto size = TRY(decoder.decode_payload_size());
+    if (size.element_count == 0)
         return ByteBuffer {};
 
-    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+    auto buffer = TRY(ByteBuffer::create_uninitialized(size.element_count));
     auto bytes = buffer.bytes();
 
-    TRY(decoder.decode_into(bytes));
+    TRY(decoder.decode_payload_into(size, bytes));
     return buffer;
 }
 
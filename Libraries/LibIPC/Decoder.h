@@ -62,6 +62,18 @@ public:
 
     ErrorOr<size_t> decode_size();
 
+    // Decodes the element count of a payload written by Encoder::encode_payload(). If the payload was transferred through
+    // shared memory, shared_memory_payload_bytes() must be used to get at its bytes, otherwise they follow in the stream.
+    struct PayloadSize {
+        size_t element_count { 0 };
+        bool is_in_shared_memory { false };
+    };
+    ErrorOr<PayloadSize> decode_payload_size();
+    ErrorOr<Core::AnonymousBuffer> decode_shared_memory_payload(size_t byte_count);
+
+    // Decodes the bytes of a payload into the given buffer, wherever they were transferred.
+    ErrorOr<void> decode_payload_into(PayloadSize, Bytes);
+
     Stream& stream() { return m_stream; }
     Queue<File>& files() { return m_files; }
 
@@ -146,11 +158,17 @@ template<Concepts::Array T>
 ErrorOr<T> decode(Decoder& decoder)
 {
     T array {};
-    auto size = TRY(decoder.decode_size());
-    if (size != array.size())
+    auto size = TRY(decoder.decode_payload_size());
+    if (size.element_count != array.size())
         return Error::from_string_literal("Array size mismatch");
-    for (size_t i = 0; i < array.size(); ++i)
-        array[i] = TRY(decoder.decode<typename T::ValueType>());
+
+    // NB: Arrays of arithmetic values are encoded as a single payload, which may have been moved into shared memory.
+    if constexpr (IsArithmetic<typename T::ValueType>) {
+        TRY(decoder.decode_payload_into(size, { reinterpret_cast<u8*>(array.data()), array.size() * sizeof(typename T::ValueType) }));
+    } else {
+        for (size_t i = 0; i < array.size(); ++i)
+            array[i] = TRY(decoder.decode<typename T::ValueType>());
+    }
     return array;
 }
 
@@ -176,11 +194,11 @@ requires(IsArithmetic<typename T::ValueType>)
 ErrorOr<T> decode(Decoder& decoder)
 {
     T vector;
-    auto size = TRY(decoder.decode_size());
-    if (Checked<size_t>::multiplication_would_overflow(size, sizeof(typename T::ValueType)))
+    auto size = TRY(decoder.decode_payload_size());
+    if (Checked<size_t>::multiplication_would_overflow(size.element_count, sizeof(typename T::ValueType)))
         return Error::from_string_literal("IPC decode: Vector size would overflow");
-    TRY(vector.try_resize(size));
-    TRY(decoder.decode_into({ reinterpret_cast<u8*>(vector.data()), size * sizeof(typename T::ValueType) }));
+    TRY(vector.try_resize(size.element_count));
+    TRY(decoder.decode_payload_into(size, { reinterpret_cast<u8*>(vector.data()), size.element_count * sizeof(typename T::ValueType) }));
     return vector;
 }
 
@@ -22,6 +22,7 @@
 #include <LibCore/System.h>
 #include <LibIPC/Encoder.h>
 #include <LibIPC/File.h>
+#include <LibIPC/Limits.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 
@@ -33,6 +34,26 @@ ErrorOr<void> Encoder::encode_size(size_t size)
     return encode(static_cast<u32>(size));
 }
 
+ErrorOr<void> Encoder::encode_payload(size_t element_count, ReadonlyBytes bytes)
+{
+    VERIFY(element_count < SHARED_MEMORY_PAYLOAD_FLAG);
+
+    if (bytes.size() < SHARED_MEMORY_PAYLOAD_THRESHOLD) {
+        TRY(encode_size(element_count));
+        TRY(append(bytes.data(), bytes.size()));
+        return {};
+    }
+
+    // OPTIMIZATION: Copying the payload into shared memory once is much cheaper than pushing it through the socket,
+    //               which copies it into the send queue, splits it across many writes, and copies it again on receipt.
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(bytes.size()));
+    memcpy(buffer.data<void>(), bytes.data(), bytes.size());
+
+    TRY(encode(static_cast<u32>(element_count) | SHARED_MEMORY_PAYLOAD_FLAG));
+    TRY(encode(TRY(IPC::File::clone_fd(buffer.fd()))));
+    return {};
+}
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, float const& value)
 {
@@ -54,9 +75,7 @@ ErrorOr<void> encode(Encoder& encoder, String const& value)
 template<>
 ErrorOr<void> encode(Encoder& encoder, StringView const& value)
 {
-    TRY(encoder.encode_size(value.length()));
-    TRY(encoder.append(reinterpret_cast<u8 const*>(value.characters_without_null_termination()), value.length()));
-    return {};
+    return encoder.encode_payload(value.length(), value.bytes());
 }
 
 template<>
@@ -90,9 +109,7 @@ ErrorOr<void> encode(Encoder& encoder, ByteString const& value)
 template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
-    TRY(encoder.encode_size(value.size()));
-    TRY(encoder.append(value.data(), value.size()));
-    return {};
+    return encoder.encode_payload(value.size(), value.bytes());
 }
 
 template<>
@@ -59,6 +59,10 @@ public:
 
     ErrorOr<void> encode_size(size_t size);
 
+    // Encodes the element count of a run of trivially copyable values, followed by their bytes. Large payloads are
+    // moved into shared memory, and only a file descriptor for it is sent along with the message.
+    ErrorOr<void> encode_payload(size_t element_count, ReadonlyBytes);
+
 private:
     MessageBuffer& m_buffer;
 };
@@ -161,12 +165,8 @@ template<Concepts::Span T>
 requires(IsArithmetic<typename T::ElementType>)
 ErrorOr<void> encode(Encoder& encoder, T const& span)
 {
-    TRY(encoder.encode_size(span.size()));
-
     VERIFY(!Checked<size_t>::multiplication_would_overflow(span.size(), sizeof(typename T::ElementType)));
-    TRY(encoder.append(reinterpret_cast<u8 const*>(span.data()), span.size() * sizeof(typename T::ElementType)));
-
-    return {};
+    return encoder.encode_payload(span.size(), { reinterpret_cast<u8 const*>(span.data()), span.size() * sizeof(typename T::ElementType) });
 }
 
 template<typename T, size_t N>
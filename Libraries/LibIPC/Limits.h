@@ -16,4 +16,10 @@ static constexpr size_t MAX_MESSAGE_PAYLOAD_SIZE = 64 * MiB;
 // Maximum number of file descriptors per message
 static constexpr size_t MAX_MESSAGE_FD_COUNT = 128;
 
+// Byte payloads of at least this size are transferred through shared memory instead of inline in the message
+static constexpr size_t SHARED_MEMORY_PAYLOAD_THRESHOLD = 256 * KiB;
+
+// Set in the encoded size of a payload that was transferred through shared memory
+static constexpr u32 SHARED_MEMORY_PAYLOAD_FLAG = 1u << 31;
+
 }
@@ -8,8 +8,10 @@
 #pragma once
 
 #include <AK/ByteString.h>
+#include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <LibIPC/Forward.h>
+#include <LibIPC/Message.h>
 
 namespace AK {
 
@@ -25,7 +27,7 @@ public:
 
     virtual u32 magic() const = 0;
     virtual ByteString name() const = 0;
-    virtual ErrorOr<OwnPtr<MessageBuffer>> handle(NonnullOwnPtr<Message>) = 0;
+    virtual ErrorOr<Optional<MessageBuffer>> handle(NonnullOwnPtr<Message>) = 0;
 
 protected:
     Stub() = default;
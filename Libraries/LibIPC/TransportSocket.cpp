@@ -16,34 +16,76 @@
 
 namespace IPC {
 
-void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds)
+// OPTIMIZATION: Queued messages are sent together in chunks of up to this many bytes, so that a burst of small messages
+//               costs a single syscall.
+static constexpr size_t SEND_BUFFER_SIZE = 64 * KiB;
+
+// Amount of bytes we try to receive from the socket at once.
+static constexpr size_t RECEIVE_CHUNK_SIZE = 64 * KiB;
+
+void SendQueue::enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, ReadonlySpan<int> fds)
+{
+    auto bytes = MUST(ByteBuffer::create_uninitialized(header.size() + payload.size()));
+    header.copy_to(bytes.bytes());
+    payload.copy_to(bytes.bytes().slice(header.size()));
+
+    Vector<int, 1> message_fds;
+    message_fds.append(fds.data(), fds.size());
+
+    m_enqueued_messages.push(EnqueuedMessage { move(bytes), move(message_fds) });
+}
+
+void SendQueue::take_enqueued_messages()
+{
+    m_enqueued_messages.take_all([this](EnqueuedMessage&& message) {
+        if (!message.bytes.is_empty())
+            m_pending_bytes.append(move(message.bytes));
+        m_pending_fds.extend(message.fds);
+    });
+}
+
+bool SendQueue::is_empty()
 {
-    Threading::MutexLocker locker(m_mutex);
-    VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
-    m_fds.append(fds.data(), fds.size());
+    take_enqueued_messages();
+    return m_pending_bytes.is_empty() && m_pending_fds.is_empty();
 }
 
-SendQueue::BytesAndFds SendQueue::peek(size_t max_bytes)
+ReadonlyBytes SendQueue::peek(Bytes buffer, Vector<int>& fds)
 {
-    Threading::MutexLocker locker(m_mutex);
-    BytesAndFds result;
-    auto bytes_to_send = min(max_bytes, m_stream.used_buffer_size());
-    result.bytes.resize(bytes_to_send);
-    m_stream.peek_some(result.bytes);
-
-    if (m_fds.size() > 0) {
-        auto fds_to_send = min(m_fds.size(), Core::LocalSocket::MAX_TRANSFER_FDS);
-        result.fds = Vector<int> { m_fds.span().slice(0, fds_to_send) };
-        // NOTE: This relies on a subsequent call to discard to actually remove the fds from m_fds
+    take_enqueued_messages();
+
+    size_t offset = m_first_pending_bytes_offset;
+    size_t copied = 0;
+    for (auto const& bytes : m_pending_bytes) {
+        if (copied == buffer.size())
+            break;
+        copied += bytes.bytes().slice(offset).copy_trimmed_to(buffer.slice(copied));
+        offset = 0;
+    }
+
+    fds.clear_with_capacity();
+    if (m_pending_fds.size() > 0) {
+        auto fds_to_send = min(m_pending_fds.size(), Core::LocalSocket::MAX_TRANSFER_FDS);
+        fds.append(m_pending_fds.data(), fds_to_send);
+        // NOTE: This relies on a subsequent call to discard to actually remove the fds from m_pending_fds
     }
-    return result;
+    return buffer.trim(copied);
 }
 
 void SendQueue::discard(size_t bytes_count, size_t fds_count)
 {
-    Threading::MutexLocker locker(m_mutex);
-    MUST(m_stream.discard(bytes_count));
-    m_fds.remove(0, fds_count);
+    while (bytes_count > 0) {
+        auto& first = m_pending_bytes.first();
+        auto remaining_in_first = first.size() - m_first_pending_bytes_offset;
+        if (bytes_count < remaining_in_first) {
+            m_first_pending_bytes_offset += bytes_count;
+            break;
+        }
+        bytes_count -= remaining_in_first;
+        m_first_pending_bytes_offset = 0;
+        (void)m_pending_bytes.take_first();
+    }
+    m_pending_fds.remove(0, fds_count);
 }
 
 TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
@@ -53,6 +95,7 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
     (void)Core::System::setsockopt(m_socket->fd().value(), SOL_SOCKET, SO_RCVBUF, &SOCKET_BUFFER_SIZE, sizeof(SOCKET_BUFFER_SIZE));
 
     m_send_queue = adopt_ref(*new SendQueue);
+    m_send_buffer = MUST(ByteBuffer::create_uninitialized(SEND_BUFFER_SIZE));
 
     {
         auto fds = MUST(Core::System::pipe2(O_CLOEXEC | O_NONBLOCK));
@@ -74,10 +117,7 @@ intptr_t TransportSocket::io_thread_loop()
 {
     Array<struct pollfd, 2> pollfds;
     for (;;) {
-        auto want_to_write = [&] {
-            auto [bytes, fds] = m_send_queue->peek(1);
-            return !bytes.is_empty() || !fds.is_empty();
-        }();
+        auto want_to_write = !m_send_queue->is_empty();
 
         auto state = m_io_thread_state.load();
         if (state == IOThreadState::Stopped)
@@ -123,23 +163,24 @@ intptr_t TransportSocket::io_thread_loop()
             break;
         }
 
-        if (pollfds[0].revents & POLLOUT) {
-            auto [bytes, fds] = m_send_queue->peek(4096);
-            if (!bytes.is_empty() || !fds.is_empty()) {
-                ReadonlyBytes remaining = bytes;
-                if (transfer_data(remaining, fds) == TransferState::SocketClosed) {
-                    m_io_thread_state = IOThreadState::Stopped;
-                }
-            }
-        }
+        if (pollfds[0].revents & POLLOUT)
+            send_pending_messages();
     }
 
     VERIFY(m_io_thread_state == IOThreadState::Stopped);
     m_peer_eof = true;
-    m_incoming_cv.broadcast();
+    wake_incoming_waiters();
     return 0;
 }
 
+void TransportSocket::wake_incoming_waiters()
+{
+    if (m_incoming_waiter_count.load() == 0)
+        return;
+    Threading::MutexLocker locker(m_incoming_mutex);
+    m_incoming_cv.broadcast();
+}
+
 void TransportSocket::wake_io_thread()
 {
     Array<u8, 1> bytes = { 0 };
@@ -173,12 +214,9 @@ void TransportSocket::set_up_read_hook(Function<void()> hook)
             m_on_read_hook();
     };
 
-    {
-        Threading::MutexLocker locker(m_incoming_mutex);
-        if (!m_incoming_messages.is_empty()) {
-            Array<u8, 1> bytes = { 0 };
-            MUST(Core::System::write(m_notify_hook_write_fd->value(), bytes));
-        }
+    if (!m_incoming_batches.is_empty()) {
+        Array<u8, 1> bytes = { 0 };
+        MUST(Core::System::write(m_notify_hook_write_fd->value(), bytes));
     }
 }
 
@@ -201,10 +239,17 @@ void TransportSocket::close_after_sending_all_pending_messages()
 
 void TransportSocket::wait_until_readable()
 {
-    Threading::MutexLocker lock(m_incoming_mutex);
-    while (m_incoming_messages.is_empty() && m_io_thread_state == IOThreadState::Running) {
-        m_incoming_cv.wait();
+    if (!m_incoming_batches.is_empty())
+        return;
+
+    m_incoming_waiter_count.fetch_add(1);
+    {
+        Threading::MutexLocker lock(m_incoming_mutex);
+        while (m_incoming_batches.is_empty() && m_io_thread_state == IOThreadState::Running) {
+            m_incoming_cv.wait();
+        }
     }
+    m_incoming_waiter_count.fetch_sub(1);
 }
 
 // Maximum size of accumulated unprocessed bytes before we disconnect the peer
@@ -221,28 +266,17 @@ struct MessageHeader {
     Type type { Type::Payload };
     u32 payload_size { 0 };
     u32 fd_count { 0 };
-
-    static Vector<u8> encode_with_payload(MessageHeader header, ReadonlyBytes payload)
-    {
-        Vector<u8> message_buffer;
-        message_buffer.resize(sizeof(MessageHeader) + payload.size());
-        memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
-        memcpy(message_buffer.data() + sizeof(MessageHeader), payload.data(), payload.size());
-        return message_buffer;
-    }
 };
 
 void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
 {
     auto num_fds_to_transfer = fds.size();
 
-    auto message_buffer = MessageHeader::encode_with_payload(
-        {
-            .type = MessageHeader::Type::Payload,
-            .payload_size = static_cast<u32>(bytes_to_write.size()),
-            .fd_count = static_cast<u32>(num_fds_to_transfer),
-        },
-        bytes_to_write);
+    MessageHeader header {
+        .type = MessageHeader::Type::Payload,
+        .payload_size = static_cast<u32>(bytes_to_write.size()),
+        .fd_count = static_cast<u32>(num_fds_to_transfer),
+    };
 
     {
         Threading::MutexLocker locker(m_fds_retained_until_received_by_peer_mutex);
@@ -258,7 +292,9 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
         }
     }
 
-    m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
+    // NB: The send queue copies the header and payload into a single buffer, which is handed over to the IO thread.
+    m_send_queue->enqueue_message({ &header, sizeof(MessageHeader) }, bytes_to_write, raw_fds);
+    m_messages_sent.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
     wake_io_thread();
 }
 
@@ -308,16 +344,53 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     if (written_byte_count > 0 || written_fd_count > 0)
         m_send_queue->discard(written_byte_count, written_fd_count);
 
+    m_send_calls.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    m_bytes_sent.fetch_add(written_byte_count, AK::MemoryOrder::memory_order_relaxed);
+
     return TransferState::Continue;
 }
 
+void TransportSocket::send_pending_messages()
+{
+    while (true) {
+        auto bytes = m_send_queue->peek(m_send_buffer.bytes(), m_send_fds);
+        if (bytes.is_empty() && m_send_fds.is_empty())
+            return;
+
+        if (transfer_data(bytes, m_send_fds) == TransferState::SocketClosed) {
+            m_io_thread_state = IOThreadState::Stopped;
+            return;
+        }
+
+        // NB: If not everything was written, the socket buffer is full and we'll be woken up again once it drains.
+        if (!bytes.is_empty())
+            return;
+    }
+}
+
 void TransportSocket::read_incoming_messages()
 {
-    Vector<NonnullOwnPtr<Message>> batch;
     while (m_socket->is_open()) {
-        u8 buffer[4096];
+        // OPTIMIZATION: Receive straight into the buffer of unprocessed bytes, rather than into a temporary one.
+        auto previous_size = m_unprocessed_bytes.size();
+        auto bytes_to_receive = min(RECEIVE_CHUNK_SIZE, MAX_UNPROCESSED_BUFFER_SIZE - previous_size);
+        if (bytes_to_receive == 0) {
+            dbgln("TransportSocket: Unprocessed buffer would exceed {} bytes, disconnecting peer", MAX_UNPROCESSED_BUFFER_SIZE);
+            m_peer_eof = true;
+            break;
+        }
+
+        auto buffer = m_unprocessed_bytes.get_bytes_for_writing(bytes_to_receive);
+        if (buffer.is_error()) {
+            dbgln("TransportSocket: Failed to append to unprocessed_bytes buffer");
+            m_peer_eof = true;
+            break;
+        }
+
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        auto maybe_bytes_read = m_socket->receive_message(buffer.value(), MSG_DONTWAIT, received_fds);
+        m_unprocessed_bytes.trim(previous_size + (maybe_bytes_read.is_error() ? 0 : maybe_bytes_read.value().size()), false);
+
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
@@ -341,16 +414,9 @@ void TransportSocket::read_incoming_messages()
             break;
         }
 
-        if (m_unprocessed_bytes.size() + bytes_read.size() > MAX_UNPROCESSED_BUFFER_SIZE) {
-            dbgln("TransportSocket: Unprocessed buffer would exceed {} bytes, disconnecting peer", MAX_UNPROCESSED_BUFFER_SIZE);
-            m_peer_eof = true;
-            break;
-        }
-        if (m_unprocessed_bytes.try_append(bytes_read.data(), bytes_read.size()).is_error()) {
-            dbgln("TransportSocket: Failed to append to unprocessed_bytes buffer");
-            m_peer_eof = true;
-            break;
-        }
+        m_receive_calls.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        m_bytes_received.fetch_add(bytes_read.size(), AK::MemoryOrder::memory_order_relaxed);
+
         if (m_unprocessed_fds.size() + received_fds.size() > MAX_UNPROCESSED_FDS) {
             dbgln("TransportSocket: Unprocessed FDs would exceed {}, disconnecting peer", MAX_UNPROCESSED_FDS);
             m_peer_eof = true;
@@ -361,6 +427,8 @@ void TransportSocket::read_incoming_messages()
         }
     }
 
+    auto batch = make<IncomingMessageBatch>();
+
     Checked<u32> received_fd_count = 0;
     Checked<u32> acknowledged_fd_count = 0;
     size_t index = 0;
@@ -384,21 +452,20 @@ void TransportSocket::read_incoming_messages()
                 break;
             if (header.fd_count > m_unprocessed_fds.size())
                 break;
-            auto message = make<Message>();
             received_fd_count += header.fd_count;
             if (received_fd_count.has_overflow()) {
                 dbgln("TransportSocket: received_fd_count would overflow");
                 m_peer_eof = true;
                 break;
             }
+            IncomingMessage message { .offset = index + sizeof(MessageHeader), .size = header.payload_size, .fds = {} };
             for (size_t i = 0; i < header.fd_count; ++i)
-                message->fds.enqueue(m_unprocessed_fds.dequeue());
-            if (message->bytes.try_append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size).is_error()) {
-                dbgln("TransportSocket: Failed to allocate message buffer for payload_size {}", header.payload_size);
+                message.fds.enqueue(m_unprocessed_fds.dequeue());
+            if (batch->messages.try_append(move(message)).is_error()) {
+                dbgln("TransportSocket: Failed to allocate message for payload_size {}", header.payload_size);
                 m_peer_eof = true;
                 break;
             }
-            batch.append(move(message));
         } else if (header.type == MessageHeader::Type::FileDescriptorAcknowledgement) {
             if (header.payload_size != 0) {
                 dbgln("TransportSocket: FileDescriptorAcknowledgement with non-zero payload_size {}", header.payload_size);
@@ -441,27 +508,25 @@ void TransportSocket::read_incoming_messages()
     }
 
     if (received_fd_count > 0u) {
-        Vector<u8> message_buffer;
-        message_buffer.resize(sizeof(MessageHeader));
         MessageHeader header;
         header.payload_size = 0;
         header.fd_count = received_fd_count.value();
         header.type = MessageHeader::Type::FileDescriptorAcknowledgement;
-        memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
-        m_send_queue->enqueue_message(move(message_buffer), {});
+        m_send_queue->enqueue_message({ &header, sizeof(MessageHeader) }, {}, {});
         wake_io_thread();
     }
 
-    if (index < m_unprocessed_bytes.size()) {
+    // NB: The batch takes over the buffer of unprocessed bytes, only a trailing partial message has to be copied out.
+    if (index > 0) {
         auto remaining_bytes_or_error = ByteBuffer::copy(m_unprocessed_bytes.span().slice(index));
         if (remaining_bytes_or_error.is_error()) {
             dbgln("TransportSocket: Failed to copy remaining bytes");
             m_peer_eof = true;
         } else {
+            if (!batch->messages.is_empty())
+                batch->bytes = move(m_unprocessed_bytes);
             m_unprocessed_bytes = remaining_bytes_or_error.release_value();
         }
-    } else {
-        m_unprocessed_bytes.clear();
     }
 
     auto notify_read_available = [&] {
@@ -469,31 +534,40 @@ void TransportSocket::read_incoming_messages()
         (void)Core::System::write(m_notify_hook_write_fd->value(), bytes);
     };
 
-    if (!batch.is_empty()) {
-        Threading::MutexLocker locker(m_incoming_mutex);
-        m_incoming_messages.extend(move(batch));
-        m_incoming_cv.broadcast();
+    if (!batch->messages.is_empty() && !batch->bytes.is_empty()) {
+        m_messages_received.fetch_add(batch->messages.size(), AK::MemoryOrder::memory_order_relaxed);
+        m_incoming_batches.push(move(batch));
+        wake_incoming_waiters();
         notify_read_available();
     }
 
     if (m_peer_eof) {
-        m_incoming_cv.broadcast();
+        wake_incoming_waiters();
         notify_read_available();
     }
 }
 
 TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&& callback)
 {
-    Vector<NonnullOwnPtr<Message>> messages;
-    {
-        Threading::MutexLocker locker(m_incoming_mutex);
-        messages = move(m_incoming_messages);
-    }
-    for (auto& message : messages)
-        callback(move(*message));
+    m_incoming_batches.take_all([&](NonnullOwnPtr<IncomingMessageBatch>&& batch) {
+        for (auto& message : batch->messages)
+            callback({ .bytes = batch->bytes.span().slice(message.offset, message.size), .fds = move(message.fds) });
+    });
     return m_peer_eof ? ShouldShutdown::Yes : ShouldShutdown::No;
 }
 
+TransportSocket::Statistics TransportSocket::statistics() const
+{
+    return {
+        .messages_sent = m_messages_sent.load(AK::MemoryOrder::memory_order_relaxed),
+        .messages_received = m_messages_received.load(AK::MemoryOrder::memory_order_relaxed),
+        .bytes_sent = m_bytes_sent.load(AK::MemoryOrder::memory_order_relaxed),
+        .bytes_received = m_bytes_received.load(AK::MemoryOrder::memory_order_relaxed),
+        .send_calls = m_send_calls.load(AK::MemoryOrder::memory_order_relaxed),
+        .receive_calls = m_receive_calls.load(AK::MemoryOrder::memory_order_relaxed),
+    };
+}
+
 ErrorOr<int> TransportSocket::release_underlying_transport_for_transfer()
 {
     stop_io_thread(IOThreadState::SendPendingMessagesAndStop);
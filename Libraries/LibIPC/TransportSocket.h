@@ -7,8 +7,11 @@
 
 #pragma once
 
-#include <AK/MemoryStream.h>
+#include <AK/Atomic.h>
+#include <AK/ByteBuffer.h>
+#include <AK/MultiProducerQueue.h>
 #include <AK/Queue.h>
+#include <AK/SinglyLinkedList.h>
 #include <LibCore/Socket.h>
 #include <LibIPC/AutoCloseFileDescriptor.h>
 #include <LibIPC/File.h>
@@ -21,18 +24,32 @@ namespace IPC {
 
 class SendQueue : public AtomicRefCounted<SendQueue> {
 public:
-    void enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds);
-    struct BytesAndFds {
-        Vector<u8> bytes;
-        Vector<int> fds;
-    };
-    BytesAndFds peek(size_t max_bytes);
+    // May be called from any thread.
+    void enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, ReadonlySpan<int> fds);
+
+    // NB: Everything below must only be called from the IO thread, which is the only consumer.
+    bool is_empty();
+
+    // Copies as many pending bytes as fit into the buffer, along with the file descriptors that have to be sent with
+    // them. Nothing is removed from the queue until discard() is called.
+    ReadonlyBytes peek(Bytes buffer, Vector<int>& fds);
     void discard(size_t bytes_count, size_t fds_count);
 
 private:
-    AllocatingMemoryStream m_stream;
-    Vector<int> m_fds;
-    Threading::Mutex m_mutex;
+    struct EnqueuedMessage {
+        ByteBuffer bytes;
+        Vector<int, 1> fds;
+    };
+    void take_enqueued_messages();
+
+    // OPTIMIZATION: Messages are posted from any thread while the IO thread is sending, so they are handed over through
+    //               a lock-free queue rather than a mutex that both sides would contend for.
+    MultiProducerQueue<EnqueuedMessage> m_enqueued_messages;
+
+    // Messages the IO thread has taken over, and how much of the first one has been sent already.
+    SinglyLinkedList<ByteBuffer> m_pending_bytes;
+    size_t m_first_pending_bytes_offset { 0 };
+    Vector<int> m_pending_fds;
 };
 
 class TransportSocket {
@@ -59,12 +76,23 @@ public:
         No,
         Yes,
     };
+    // NB: The bytes of a message are only valid for the duration of the callback that receives it.
     struct Message {
-        Vector<u8> bytes;
+        ReadonlyBytes bytes;
         Queue<File> fds;
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
 
+    struct Statistics {
+        u64 messages_sent { 0 };
+        u64 messages_received { 0 };
+        u64 bytes_sent { 0 };
+        u64 bytes_received { 0 };
+        u64 send_calls { 0 };
+        u64 receive_calls { 0 };
+    };
+    Statistics statistics() const;
+
     // Obnoxious name to make it clear that this is a dangerous operation.
     ErrorOr<int> release_underlying_transport_for_transfer();
 
@@ -87,6 +115,7 @@ private:
     intptr_t io_thread_loop();
     void stop_io_thread(IOThreadState desired_state);
     void wake_io_thread();
+    void send_pending_messages();
     void read_incoming_messages();
 
     NonnullOwnPtr<Core::LocalSocket> m_socket;
@@ -101,11 +130,37 @@ private:
     RefPtr<SendQueue> m_send_queue;
     Atomic<IOThreadState> m_io_thread_state { IOThreadState::Running };
     Atomic<bool> m_peer_eof { false };
+
+    // NB: These are only accessed from the IO thread.
+    ByteBuffer m_send_buffer;
+    Vector<int> m_send_fds;
     ByteBuffer m_unprocessed_bytes;
     Queue<File> m_unprocessed_fds;
+
+    // OPTIMIZATION: Every message received in one go shares a single buffer, rather than each one owning a copy.
+    struct IncomingMessage {
+        size_t offset { 0 };
+        size_t size { 0 };
+        Queue<File> fds;
+    };
+    struct IncomingMessageBatch {
+        ByteBuffer bytes;
+        Vector<IncomingMessage> messages;
+    };
+    MultiProducerQueue<NonnullOwnPtr<IncomingMessageBatch>> m_incoming_batches;
+
+    // NB: The mutex is only taken to put wait_until_readable() to sleep and to wake it, never to hand over messages.
+    void wake_incoming_waiters();
     Threading::Mutex m_incoming_mutex;
     Threading::ConditionVariable m_incoming_cv { m_incoming_mutex };
-    Vector<NonnullOwnPtr<Message>> m_incoming_messages;
+    Atomic<u32> m_incoming_waiter_count { 0 };
+
+    Atomic<u64> m_messages_sent { 0 };
+    Atomic<u64> m_messages_received { 0 };
+    Atomic<u64> m_bytes_sent { 0 };
+    Atomic<u64> m_bytes_received { 0 };
+    Atomic<u64> m_send_calls { 0 };
+    Atomic<u64> m_receive_calls { 0 };
 
     RefPtr<AutoCloseFileDescriptor> m_wakeup_io_thread_read_fd;
     RefPtr<AutoCloseFileDescriptor> m_wakeup_io_thread_write_fd;
@@ -20,6 +20,11 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+
+    // NB: Streamed animations wait for their frames before they ask for more, so they have to learn that none will come.
+    auto animation_frames_callbacks = move(m_animation_frames_callbacks);
+    for (auto& [_, callback] : animation_frames_callbacks)
+        callback(0, Error::from_string_literal("ImageDecoder disconnected"));
 }
 
 NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
@@ -57,7 +62,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, bool is_streamed)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
@@ -75,9 +80,15 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
+    if (is_streamed) {
+        image.streamed_image_id = image_id;
+        image.streamed_frame_durations = durations;
+    }
     for (size_t i = 0; i < bitmaps.size(); ++i) {
         if (!bitmaps[i]) {
             dbgln("ImageDecoderClient: Invalid bitmap for request {} at index {}", image_id, i);
+            if (is_streamed)
+                async_stop_streaming_animation(image_id);
             promise->reject(Error::from_string_literal("Invalid bitmap"));
             return;
         }
@@ -88,6 +99,40 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     promise->resolve(move(image));
 }
 
+void Client::request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count, AnimationFramesCallback callback)
+{
+    if (!is_open()) {
+        callback(first_frame_index, Error::from_string_literal("ImageDecoder disconnected"));
+        return;
+    }
+
+    m_animation_frames_callbacks.set(image_id, move(callback));
+    async_request_animation_frames(image_id, first_frame_index, frame_count);
+}
+
+void Client::stop_streaming_animation(i64 image_id)
+{
+    m_animation_frames_callbacks.remove(image_id);
+    if (is_open())
+        async_stop_streaming_animation(image_id);
+}
+
+void Client::did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence)
+{
+    auto it = m_animation_frames_callbacks.find(image_id);
+    if (it == m_animation_frames_callbacks.end())
+        return;
+    it->value(first_frame_index, move(bitmap_sequence.bitmaps));
+}
+
+void Client::did_fail_to_decode_animation_frames(i64 image_id, u32 first_frame_index)
+{
+    auto it = m_animation_frames_callbacks.find(image_id);
+    if (it == m_animation_frames_callbacks.end())
+        return;
+    it->value(first_frame_index, Error::from_string_literal("Animation frames could not be decoded"));
+}
+
 void Client::did_fail_to_decode_image(i64 image_id, String error_message)
 {
     auto maybe_promise = m_pending_decoded_images.take(image_id);
@@ -26,6 +26,11 @@ struct DecodedImage {
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if only the first few frames were sent. The rest have to be requested with Client::request_animation_frames(),
+    // passing in the image ID.
+    Optional<i64> streamed_image_id;
+    Vector<u32> streamed_frame_durations;
 };
 
 class Client final
@@ -40,15 +45,24 @@ public:
 
     NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
 
+    // Called once for every request, with an error if the frames couldn't be decoded (e.g. because ImageDecoder died).
+    // If ImageDecoder is already gone, it is called right away.
+    using AnimationFramesCallback = Function<void(u32 first_frame_index, ErrorOr<Vector<RefPtr<Gfx::Bitmap>>>)>;
+    void request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count, AnimationFramesCallback);
+    void stop_streaming_animation(i64 image_id);
+
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, bool is_streamed) override;
+    virtual void did_decode_animation_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence) override;
+    virtual void did_fail_to_decode_animation_frames(i64 image_id, u32 first_frame_index) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
 
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    HashMap<i64, AnimationFramesCallback> m_animation_frames_callbacks;
 };
 
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/OwnPtr.h>
@@ -759,7 +760,9 @@ struct FunctionParameter {
     bool is_rest { false };
 };
 
-class FunctionParameters : public RefCounted<FunctionParameters> {
+// NB: The reference count is atomic, as the parser hands out a shared empty instance, and scripts may be parsed on
+//     background threads.
+class FunctionParameters : public AtomicRefCounted<FunctionParameters> {
 public:
     static NonnullRefPtr<FunctionParameters> create(Vector<FunctionParameter> parameters)
     {
@@ -802,6 +805,7 @@ struct FunctionParsingInsights {
     bool uses_this_from_environment { false };
     bool contains_direct_call_to_eval { false };
     bool might_need_arguments_object { false };
+    bool may_reference_function_name { true };
 };
 
 class JS_API FunctionNode {
@@ -535,6 +535,10 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> Identifier::generate_by
     if (is_local()) {
         auto local_index = this->local_index();
         auto local = generator.local(local_index);
+        if (auto lazy_arguments_object = generator.lazy_arguments_object_for(*this); lazy_arguments_object.has_value()) {
+            generator.emit<Bytecode::Op::CreateLazyArguments>(local, lazy_arguments_object->kind);
+            return local;
+        }
         if (!generator.is_local_initialized(local_index)) {
             if (local_index.is_argument()) {
                 // Arguments are initialized to undefined by default, so here we need to replace it with the empty value to
@@ -1390,6 +1394,22 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ArrayExpression::genera
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> MemberExpression::generate_bytecode(Bytecode::Generator& generator, Optional<ScopedOperand> preferred_dst) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
+
+    if (auto lazy_arguments_object = generator.lazy_arguments_object_for(*m_object); lazy_arguments_object.has_value()) {
+        auto arguments = generator.local(lazy_arguments_object->local);
+        if (is_computed()) {
+            auto property = TRY(m_property->generate_bytecode(generator)).value();
+            auto dst = choose_dst(generator, preferred_dst);
+            generator.emit<Bytecode::Op::GetArgumentsElement>(dst, arguments, property, lazy_arguments_object->kind);
+            return dst;
+        }
+        if (is<Identifier>(*m_property) && static_cast<Identifier const&>(*m_property).string() == "length"sv) {
+            auto dst = choose_dst(generator, preferred_dst);
+            generator.emit<Bytecode::Op::GetArgumentsLength>(dst, arguments);
+            return dst;
+        }
+    }
+
     auto reference = TRY(generator.emit_load_from_reference(*this, preferred_dst));
     return reference.loaded_value;
 }
@@ -1409,10 +1429,12 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> FunctionDeclaration::ge
 Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> FunctionExpression::generate_bytecode_with_lhs_name(Bytecode::Generator& generator, Optional<Bytecode::IdentifierTableIndex> lhs_name, Optional<ScopedOperand> preferred_dst, bool is_method) const
 {
     Bytecode::Generator::SourceLocationScope scope(generator, *this);
-    bool has_name = !name().is_empty();
+    // OPTIMIZATION: The scope holding the name binding of a named function expression is only needed if something
+    //               inside the function may read that name. Otherwise, skip allocating an environment for it.
+    bool needs_name_binding = !name().is_empty() && parsing_insights().may_reference_function_name;
     Optional<Bytecode::IdentifierTableIndex> name_identifier;
 
-    if (has_name) {
+    if (needs_name_binding) {
         generator.begin_variable_scope();
 
         name_identifier = generator.intern_identifier(name());
@@ -1422,7 +1444,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> FunctionExpression::gen
     auto new_function = choose_dst(generator, preferred_dst);
     generator.emit_new_function(new_function, *this, lhs_name, is_method);
 
-    if (has_name) {
+    if (needs_name_binding) {
         generator.emit<Bytecode::Op::InitializeLexicalBinding>(*name_identifier, new_function);
         generator.end_variable_scope();
     }
@@ -1880,7 +1902,9 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
         }
         if (identifier.is_local()) {
             auto local = generator.local(identifier.local_index());
-            if (!generator.is_local_initialized(local.operand().index())) {
+            if (auto lazy_arguments_object = generator.lazy_arguments_object_for(identifier); lazy_arguments_object.has_value()) {
+                generator.emit<Bytecode::Op::CreateLazyArguments>(local, lazy_arguments_object->kind);
+            } else if (!generator.is_local_initialized(local.operand().index())) {
                 generator.emit<Bytecode::Op::ThrowIfTDZ>(local);
             }
             original_callee = local;
@@ -5,6 +5,7 @@
  */
 
 #include <AK/BinarySearch.h>
+#include <AK/Debug.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
@@ -47,7 +48,56 @@ Executable::Executable(
     object_shape_caches.resize(number_of_object_shape_caches);
 }
 
-Executable::~Executable() = default;
+Executable::~Executable()
+{
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+    dump_property_lookup_cache_statistics();
+#endif
+}
+
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+void Executable::dump_property_lookup_cache_statistics() const
+{
+    PropertyLookupCache::Statistics totals;
+
+    // The number of GetById sites by how many of their cache entries are in use. Sites that use all of them also
+    // consult the megamorphic cache.
+    AK::Array<size_t, PropertyLookupCache::max_number_of_shapes_to_remember + 1> sites_by_depth {};
+
+    for (auto const& cache : property_lookup_caches) {
+        auto const& statistics = cache.statistics;
+        if (statistics.hits == 0 && statistics.megamorphic_hits == 0 && statistics.misses == 0)
+            continue;
+
+        totals.hits += statistics.hits;
+        totals.megamorphic_hits += statistics.megamorphic_hits;
+        totals.misses += statistics.misses;
+
+        size_t depth = 0;
+        for (auto const& entry : cache.entries) {
+            if (entry.shape)
+                ++depth;
+        }
+        ++sites_by_depth[depth];
+    }
+
+    auto lookup_count = totals.hits + totals.megamorphic_hits + totals.misses;
+    if (lookup_count == 0)
+        return;
+
+    dbgln("Property lookup caches of \"{}\": {} lookups, {} hits ({}%), {} megamorphic hits ({}%), {} misses ({}%)",
+        name,
+        lookup_count,
+        totals.hits, totals.hits * 100 / lookup_count,
+        totals.megamorphic_hits, totals.megamorphic_hits * 100 / lookup_count,
+        totals.misses, totals.misses * 100 / lookup_count);
+
+    for (size_t depth = 0; depth < sites_by_depth.size(); ++depth) {
+        if (sites_by_depth[depth] != 0)
+            dbgln("    {} sites with {} shapes{}", sites_by_depth[depth], depth, depth == PropertyLookupCache::max_number_of_shapes_to_remember ? " (megamorphic)"sv : ""sv);
+    }
+}
+#endif
 
 void Executable::dump() const
 {
@@ -96,8 +146,6 @@ void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(constants);
-    for (auto& cache : template_object_caches)
-        visitor.visit(cache.cached_template_object);
     property_key_table->visit_edges(visitor);
 }
 
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/Debug.h>
+#include <AK/HashFunctions.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/Utf16FlyString.h>
@@ -60,6 +62,37 @@ struct PropertyLookupCache {
 
     AK::Array<Entry::Type, max_number_of_shapes_to_remember> types;
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+    // How often GetById found its property in this cache, in the megamorphic cache, or had to do a full lookup.
+    struct Statistics {
+        u64 hits { 0 };
+        u64 megamorphic_hits { 0 };
+        u64 misses { 0 };
+    };
+    Statistics statistics;
+#endif
+};
+
+// A direct-mapped cache keyed on (shape, property name) that is shared by every property access site in a VM.
+// Sites that have seen more shapes than their own PropertyLookupCache can remember (i.e. megamorphic sites)
+// fall back to this cache before doing a full property lookup.
+struct MegamorphicPropertyLookupCache {
+    static constexpr size_t number_of_entries = 512;
+    static_assert(is_power_of_two(number_of_entries));
+
+    struct Entry {
+        Utf16FlyString property_name;
+        PropertyLookupCache::Entry cache_entry;
+    };
+
+    Entry& entry_for(Shape const& shape, Utf16FlyString const& property_name)
+    {
+        auto index = pair_int_hash(ptr_hash(&shape), property_name.hash()) & (number_of_entries - 1);
+        return entries[index];
+    }
+
+    AK::Array<Entry, number_of_entries> entries;
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -70,9 +103,9 @@ struct GlobalVariableCache : public PropertyLookupCache {
 };
 
 // https://tc39.es/ecma262/#sec-gettemplateobject
-// Template objects are cached at the call site.
+// Template objects are cached at the call site. The realm's [[TemplateMap]] keeps them alive.
 struct TemplateObjectCache {
-    GC::Ptr<Array> cached_template_object;
+    GC::Weak<Array> cached_template_object;
 };
 
 // Cache for object literal shapes.
@@ -172,6 +205,10 @@ public:
 
     void dump() const;
 
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+    void dump_property_lookup_cache_statistics() const;
+#endif
+
     [[nodiscard]] Operand original_operand_from_raw(u32) const;
 
 private:
@@ -19,6 +19,9 @@
 
 namespace JS::Bytecode {
 
+bool g_disable_jump_threading = false;
+bool g_disable_unreachable_block_elimination = false;
+
 Generator::Generator(VM& vm, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled)
     : m_vm(vm)
     , m_string_table(make<StringTable>())
@@ -64,10 +67,17 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(S
         if (local_var_index.has_value())
             dst = local(Identifier::Local::variable(local_var_index.value()));
 
-        if (shared_function_instance_data.m_strict || !shared_function_instance_data.m_has_simple_parameter_list) {
-            emit<Op::CreateArguments>(dst, Op::ArgumentsKind::Unmapped, shared_function_instance_data.m_strict);
+        auto kind = shared_function_instance_data.m_strict || !shared_function_instance_data.m_has_simple_parameter_list
+            ? Op::ArgumentsKind::Unmapped
+            : Op::ArgumentsKind::Mapped;
+
+        // OPTIMIZATION: Without formal parameters, nothing can change the passed arguments or map them to bindings, so
+        //               creating the arguments object later is unobservable. If it lives in a local, we leave that local
+        //               empty and only create the object when something needs more than its length or elements.
+        if (local_var_index.has_value() && shared_function_instance_data.m_formal_parameters->size() == 0) {
+            m_lazy_arguments_object = LazyArgumentsObject { Identifier::Local::variable(local_var_index.value()), kind };
         } else {
-            emit<Op::CreateArguments>(dst, Op::ArgumentsKind::Mapped, shared_function_instance_data.m_strict);
+            emit<Op::CreateArguments>(dst, kind, shared_function_instance_data.m_strict);
         }
 
         if (local_var_index.has_value())
@@ -271,9 +281,27 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         }
     }
 
+    // Pass: Retarget jumps to blocks that do nothing but jump somewhere else.
+    if (!g_disable_jump_threading)
+        generator.thread_jumps();
+
+    // Pass: Figure out which blocks can actually be reached, so we don't emit any dead code.
+    auto reachable_blocks = generator.find_reachable_blocks();
+
+    // NOTE: Since unreachable blocks are skipped, the block that follows a given block in the final bytecode
+    //       is not necessarily the one with the next index.
+    Vector<size_t> next_reachable_block_index;
+    next_reachable_block_index.resize(generator.m_root_basic_blocks.size());
+    for (size_t i = generator.m_root_basic_blocks.size(), next_index = generator.m_root_basic_blocks.size(); i > 0; --i) {
+        next_reachable_block_index[i - 1] = next_index;
+        if (reachable_blocks[i - 1])
+            next_index = i - 1;
+    }
+
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
-        size_needed += block->size();
+        if (reachable_blocks[block->index()])
+            size_needed += block->size();
     }
 
     Vector<u8> bytecode;
@@ -348,6 +376,9 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         undefined_constant.value().operand().offset_index_by(number_of_registers + number_of_locals);
 
     for (auto& block : generator.m_root_basic_blocks) {
+        if (!reachable_blocks[block->index()])
+            continue;
+
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
             unlinked_exception_handlers.append({
@@ -373,7 +404,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
                 // OPTIMIZATION: Don't emit jumps that just jump to the next block.
-                if (jump.target().basic_block_index() == block->index() + 1) {
+                if (jump.target().basic_block_index() == next_reachable_block_index[block->index()]) {
                     if (basic_block_start_offsets.last() == bytecode.size()) {
                         // This block is empty, just skip it.
                         basic_block_start_offsets.take_last();
@@ -410,7 +441,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
             //               we can emit a `JumpTrue` or `JumpFalse` (to the other block) instead.
             if (instruction.type() == Instruction::Type::JumpIf) {
                 auto& jump = static_cast<Bytecode::Op::JumpIf&>(instruction);
-                if (jump.true_target().basic_block_index() == block->index() + 1) {
+                if (jump.true_target().basic_block_index() == next_reachable_block_index[block->index()]) {
                     Op::JumpFalse jump_false(jump.condition(), Label { jump.false_target() });
                     auto& label = jump_false.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_false));
@@ -419,7 +450,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                     ++it;
                     continue;
                 }
-                if (jump.false_target().basic_block_index() == block->index() + 1) {
+                if (jump.false_target().basic_block_index() == next_reachable_block_index[block->index()]) {
                     Op::JumpTrue jump_true(jump.condition(), Label { jump.true_target() });
                     auto& label = jump_true.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_true));
@@ -966,6 +997,19 @@ CodeGenerationErrorOr<Optional<ScopedOperand>> Generator::emit_delete_reference(
     return add_constant(Value(true));
 }
 
+Optional<Generator::LazyArgumentsObject> Generator::lazy_arguments_object_for(Expression const& expression) const
+{
+    if (!m_lazy_arguments_object.has_value() || !is<Identifier>(expression))
+        return {};
+    auto const& identifier = static_cast<Identifier const&>(expression);
+    if (!identifier.is_local())
+        return {};
+    auto local_index = identifier.local_index();
+    if (!local_index.is_variable() || local_index.index != m_lazy_arguments_object->local.index)
+        return {};
+    return m_lazy_arguments_object;
+}
+
 void Generator::emit_set_variable(JS::Identifier const& identifier, ScopedOperand value, Bytecode::Op::BindingInitializationMode initialization_mode, Bytecode::Op::EnvironmentMode environment_mode)
 {
     if (identifier.is_local()) {
@@ -1398,9 +1442,99 @@ bool Generator::fuse_compare_and_jump(ScopedOperand const& condition, Label true
     JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP);
 #undef HANDLE_COMPARISON_OP
 
+    // OPTIMIZATION: Jumping on the negation of a value is the same as jumping on the value itself with the targets
+    //               swapped, which saves computing the negation in conditions like `if (!x)` and `while (!done)`.
+    if (last_instruction.type() == Instruction::Type::Not) {
+        auto& negation = static_cast<Op::Not const&>(last_instruction);
+        VERIFY(negation.dst() == condition);
+        auto src = negation.src();
+        m_current_basic_block->rewind();
+        emit<Op::JumpIf>(src, false_target, true_target);
+        return true;
+    }
+
     return false;
 }
 
+void Generator::thread_jumps()
+{
+    // If a block consists of nothing but an unconditional jump, remember where it jumps to.
+    Vector<Optional<size_t>> forwarded_targets;
+    forwarded_targets.resize(m_root_basic_blocks.size());
+    for (auto& block : m_root_basic_blocks) {
+        if (!block->is_terminated() || block->last_instruction_start_offset() != 0)
+            continue;
+        auto const& instruction = *reinterpret_cast<Instruction const*>(block->data());
+        if (instruction.type() != Instruction::Type::Jump)
+            continue;
+        forwarded_targets[block->index()] = static_cast<Op::Jump const&>(instruction).target().basic_block_index();
+    }
+
+    auto final_target = [&](size_t block_index) {
+        // NOTE: Bound the number of hops, since a chain of jump-only blocks may form a cycle.
+        for (size_t hops = 0; hops < forwarded_targets.size(); ++hops) {
+            auto target = forwarded_targets[block_index];
+            if (!target.has_value() || *target == block_index)
+                break;
+            block_index = *target;
+        }
+        return block_index;
+    };
+
+    // NOTE: Jumps can't throw, so skipping over a jump-only block is fine even if it's covered by a different exception handler.
+    for (auto& block : m_root_basic_blocks) {
+        InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                auto target = final_target(label.basic_block_index());
+                if (target != label.basic_block_index())
+                    label = Label { static_cast<u32>(target) };
+            });
+            ++it;
+        }
+    }
+}
+
+Vector<bool> Generator::find_reachable_blocks() const
+{
+    Vector<bool> reachable_blocks;
+    reachable_blocks.resize(m_root_basic_blocks.size());
+
+    if (g_disable_unreachable_block_elimination) {
+        reachable_blocks.fill(true);
+        return reachable_blocks;
+    }
+
+    Vector<size_t> work_list;
+    auto mark_reachable = [&](size_t block_index) {
+        if (reachable_blocks[block_index])
+            return;
+        reachable_blocks[block_index] = true;
+        work_list.append(block_index);
+    };
+
+    mark_reachable(0);
+    while (!work_list.is_empty()) {
+        auto& block = *m_root_basic_blocks[work_list.take_last()];
+        if (block.handler())
+            mark_reachable(block.handler()->index());
+        if (block.finalizer())
+            mark_reachable(block.finalizer()->index());
+
+        InstructionStreamIterator it(block.instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                mark_reachable(label.basic_block_index());
+            });
+            ++it;
+        }
+    }
+
+    return reachable_blocks;
+}
+
 void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target, Label false_target)
 {
     if (condition.operand().is_constant()) {
@@ -19,6 +19,7 @@
 #include <LibJS/Bytecode/PutKind.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Runtime/FunctionKind.h>
 #include <LibRegex/Regex.h>
@@ -167,6 +168,14 @@ public:
 
     void emit_set_variable(JS::Identifier const& identifier, ScopedOperand value, Bytecode::Op::BindingInitializationMode initialization_mode = Bytecode::Op::BindingInitializationMode::Set, Bytecode::Op::EnvironmentMode mode = Bytecode::Op::EnvironmentMode::Lexical);
 
+    // The arguments object of a function without formal parameters is only created once something needs the object
+    // itself. Until then, arguments.length and arguments[i] read the passed arguments directly.
+    struct LazyArgumentsObject {
+        Identifier::Local local;
+        Op::ArgumentsKind kind;
+    };
+    [[nodiscard]] Optional<LazyArgumentsObject> lazy_arguments_object_for(Expression const&) const;
+
     void push_home_object(ScopedOperand);
     void pop_home_object();
     void emit_new_function(ScopedOperand dst, JS::FunctionExpression const&, Optional<IdentifierTableIndex> lhs_name, bool is_method);
@@ -403,6 +412,10 @@ private:
     // Returns true if a fused instruction was emitted.
     [[nodiscard]] bool fuse_compare_and_jump(ScopedOperand const& condition, Label true_target, Label false_target);
 
+    // Optimization passes that run over the finished basic blocks, before they are linked into an Executable.
+    void thread_jumps();
+    [[nodiscard]] Vector<bool> find_reachable_blocks() const;
+
     struct LabelableScope {
         Label bytecode_target;
         Vector<FlyString> language_label_set;
@@ -454,8 +467,13 @@ private:
     bool m_builtin_abstract_operations_enabled { false };
 
     GC::Ptr<SharedFunctionInstanceData const> m_shared_function_instance_data;
+    Optional<LazyArgumentsObject> m_lazy_arguments_object;
 
     Optional<PropertyKeyTableIndex> m_length_identifier;
 };
 
+// These allow individual optimization passes to be turned off, e.g. for benchmarking or debugging.
+JS_API extern bool g_disable_jump_threading;
+JS_API extern bool g_disable_unreachable_block_elimination;
+
 }
@@ -57,6 +57,9 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value src1
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers directly, which also handles NaN and ±0 correctly.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -66,6 +69,9 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_equals(VM& vm, Value src1,
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers directly, which also handles NaN and ±0 correctly.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -75,6 +81,9 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_inequals(VM&, Value src1, Va
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers directly, which also handles NaN and ±0 correctly.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !is_strictly_equal(src1, src2);
 }
 
@@ -84,6 +93,9 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_equals(VM&, Value src1, Valu
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers directly, which also handles NaN and ±0 correctly.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return is_strictly_equal(src1, src2);
 }
 
@@ -310,6 +322,9 @@ void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
+            // NB: Every loop jumps back to its start, so this is one of the sampling profiler's safepoints.
+            if (instruction.target().address() <= program_counter && vm().is_profiler_sample_requested()) [[unlikely]]
+                vm().take_profiler_sample();
             program_counter = instruction.target().address();
             goto start;
         }
@@ -490,6 +505,7 @@ void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateDataPropertyOrThrow);
             HANDLE_INSTRUCTION(CreateImmutableBinding);
             HANDLE_INSTRUCTION(CreateMutableBinding);
+            HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateLazyArguments);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateLexicalEnvironment);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateVariableEnvironment);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreatePrivateEnvironment);
@@ -505,6 +521,8 @@ void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(Div);
             HANDLE_INSTRUCTION(EnterObjectEnvironment);
             HANDLE_INSTRUCTION(Exp);
+            HANDLE_INSTRUCTION(GetArgumentsElement);
+            HANDLE_INSTRUCTION(GetArgumentsLength);
             HANDLE_INSTRUCTION(GetById);
             HANDLE_INSTRUCTION(GetByIdWithThis);
             HANDLE_INSTRUCTION(GetByValue);
@@ -674,6 +692,9 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
         values[executable.registers_and_locals_count + i] = executable.constants.data()[i];
     }
 
+    if (vm().is_profiler_sample_requested()) [[unlikely]]
+        vm().take_profiler_sample();
+
     run_bytecode(entry_point.value_or(0));
 
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {}", context.executable);
@@ -1854,18 +1875,31 @@ void NewPrimitiveArray::execute_impl(Bytecode::Interpreter& interpreter) const
 void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto& cache = interpreter.current_executable().template_object_caches[m_cache_index];
+    auto& executable = interpreter.current_executable();
+    auto& cache = executable.template_object_caches[m_cache_index];
 
     // 1. Let realm be the current Realm Record.
     auto& realm = *vm.current_realm();
 
+    // OPTIMIZATION: The call site remembers the template object it produced last, which is almost always for this realm.
+    //               We only need to search the template registry if the same executable has been run in another realm.
+    if (auto cached_template_object = cache.cached_template_object.ptr(); cached_template_object && &cached_template_object->shape().realm() == &realm) [[likely]] {
+        interpreter.set(dst(), cached_template_object);
+        return;
+    }
+
     // 2. Let templateRegistry be realm.[[TemplateMap]].
+    auto& template_registry = realm.template_map();
+
     // 3. For each element e of templateRegistry, do
-    //    a. If e.[[Site]] is the same Parse Node as templateLiteral, then
-    //       i. Return e.[[Array]].
-    if (cache.cached_template_object) {
-        interpreter.set(dst(), cache.cached_template_object);
-        return;
+    for (auto const& record : template_registry) {
+        // a. If e.[[Site]] is the same Parse Node as templateLiteral, then
+        if (record.site_executable.ptr() == &executable && record.site_cache_index == m_cache_index) {
+            // i. Return e.[[Array]].
+            cache.cached_template_object = *record.array;
+            interpreter.set(dst(), record.array);
+            return;
+        }
     }
 
     // 4. Let rawStrings be the TemplateStrings of templateLiteral with argument true.
@@ -1913,7 +1947,8 @@ void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
     MUST(template_object->set_integrity_level(Object::IntegrityLevel::Frozen));
 
     // 16. Append the Record { [[Site]]: templateLiteral, [[Array]]: template } to realm.[[TemplateMap]].
-    cache.cached_template_object = template_object;
+    template_registry.append({ executable, m_cache_index, template_object });
+    cache.cached_template_object = *template_object;
 
     // 17. Return template.
     interpreter.set(dst(), template_object);
@@ -1979,7 +2014,8 @@ void NewObject::execute_impl(Bytecode::Interpreter& interpreter) const
     if (m_cache_index != NumericLimits<u32>::max()) {
         auto& cache = interpreter.current_executable().object_shape_caches[m_cache_index];
         auto cached_shape = cache.shape.ptr();
-        if (cached_shape) {
+        // NOTE: The executable may be shared between realms, and the cached shape must have this realm's %Object.prototype%.
+        if (cached_shape && &cached_shape->realm() == &realm) {
             interpreter.set(dst(), Object::create_with_premade_shape(*cached_shape));
             return;
         }
@@ -1998,9 +2034,10 @@ void NewObjectWithNoPrototype::execute_impl(Bytecode::Interpreter& interpreter)
 void CacheObjectShape::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& cache = interpreter.current_executable().object_shape_caches[m_cache_index];
-    if (!cache.shape) {
-        auto& object = interpreter.get(m_object).as_object();
+    auto& object = interpreter.get(m_object).as_object();
+    if (!cache.shape || &cache.shape->realm() != &object.shape().realm()) {
         cache.shape = &object.shape();
+        cache.property_offsets.clear();
     }
 }
 
@@ -2325,19 +2362,22 @@ void CreateRestParams::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(m_dst, array);
 }
 
-void CreateArguments::execute_impl(Bytecode::Interpreter& interpreter) const
+static Object* create_arguments_object(Bytecode::Interpreter& interpreter, ArgumentsKind kind)
 {
     auto const& function = interpreter.running_execution_context().function;
     auto const arguments = interpreter.running_execution_context().arguments;
     auto const& environment = interpreter.running_execution_context().lexical_environment;
 
     auto passed_arguments = ReadonlySpan<Value> { arguments.data(), interpreter.running_execution_context().passed_argument_count };
-    Object* arguments_object;
-    if (m_kind == ArgumentsKind::Mapped) {
-        arguments_object = create_mapped_arguments_object(interpreter.vm(), *function, function->formal_parameters(), passed_arguments, *environment);
-    } else {
-        arguments_object = create_unmapped_arguments_object(interpreter.vm(), passed_arguments);
-    }
+    if (kind == ArgumentsKind::Mapped)
+        return create_mapped_arguments_object(interpreter.vm(), *function, function->formal_parameters(), passed_arguments, *environment);
+    return create_unmapped_arguments_object(interpreter.vm(), passed_arguments);
+}
+
+void CreateArguments::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto const& environment = interpreter.running_execution_context().lexical_environment;
+    auto* arguments_object = create_arguments_object(interpreter, m_kind);
 
     if (m_dst.has_value()) {
         interpreter.set(*m_dst, arguments_object);
@@ -2352,6 +2392,45 @@ void CreateArguments::execute_impl(Bytecode::Interpreter& interpreter) const
     MUST(environment->initialize_binding(interpreter.vm(), interpreter.vm().names.arguments.as_string(), arguments_object, Environment::InitializeBindingHint::Normal));
 }
 
+void CreateLazyArguments::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    // NB: The arguments local is empty until something needs the arguments object itself, see
+    //     Generator::emit_function_declaration_instantiation().
+    if (!interpreter.get(m_arguments).is_special_empty_value())
+        return;
+    interpreter.set(m_arguments, create_arguments_object(interpreter, m_kind));
+}
+
+ThrowCompletionOr<void> GetArgumentsElement::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto arguments_value = interpreter.get(m_arguments);
+    auto property = interpreter.get(m_property);
+
+    if (arguments_value.is_special_empty_value()) {
+        auto const& context = interpreter.running_execution_context();
+        if (property.is_non_negative_int32() && static_cast<size_t>(property.as_i32()) < context.passed_argument_count) [[likely]] {
+            interpreter.set(dst(), context.arguments[property.as_i32()]);
+            return {};
+        }
+        arguments_value = create_arguments_object(interpreter, m_kind);
+        interpreter.set(m_arguments, arguments_value);
+    }
+
+    interpreter.set(dst(), TRY(get_by_value(interpreter.vm(), {}, arguments_value, property, interpreter.current_executable())));
+    return {};
+}
+
+ThrowCompletionOr<void> GetArgumentsLength::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto arguments_value = interpreter.get(m_arguments);
+    if (arguments_value.is_special_empty_value()) [[likely]] {
+        interpreter.set(dst(), Value(interpreter.running_execution_context().passed_argument_count));
+        return {};
+    }
+    interpreter.set(dst(), TRY(arguments_value.get(interpreter.vm(), interpreter.vm().names.length)));
+    return {};
+}
+
 template<EnvironmentMode environment_mode, BindingInitializationMode initialization_mode>
 static ThrowCompletionOr<void> initialize_or_set_binding(Interpreter& interpreter, IdentifierTableIndex identifier_index, Strict strict, Value value, EnvironmentCoordinate& cache)
 {
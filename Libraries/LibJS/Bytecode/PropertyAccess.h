@@ -68,6 +68,30 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, get_base_identifier, get_property_name);
 }
 
+// Returns the object whose storage holds the cached property if the cache entry is still valid for an object with the given shape.
+ALWAYS_INLINE Object* object_holding_cached_property(Object& base_obj, Shape& shape, PropertyLookupCache::Entry const& cache_entry)
+{
+    if (&shape != cache_entry.shape)
+        return nullptr;
+
+    if (shape.is_dictionary()) {
+        if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation) [[unlikely]]
+            return nullptr;
+    }
+
+    auto cached_prototype = cache_entry.prototype.ptr();
+    if (!cached_prototype)
+        return &base_obj;
+
+    // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+    auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
+    if (!cached_prototype_chain_validity) [[unlikely]]
+        return nullptr;
+    if (!cached_prototype_chain_validity->is_valid()) [[unlikely]]
+        return nullptr;
+    return cached_prototype;
+}
+
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
@@ -89,54 +113,47 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     auto& shape = base_obj->shape();
 
     for (auto& cache_entry : cache.entries) {
-        auto cached_prototype = cache_entry.prototype.ptr();
-        if (cached_prototype) {
-            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-            bool can_use_cache = [&]() -> bool {
-                if (&shape != cache_entry.shape) [[unlikely]]
-                    return false;
-
-                if (shape.is_dictionary()) {
-                    if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation) [[unlikely]] {
-                        return false;
-                    }
-                }
-
-                auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
-                if (!cached_prototype_chain_validity) [[unlikely]]
-                    return false;
-                if (!cached_prototype_chain_validity->is_valid()) [[unlikely]]
-                    return false;
-                return true;
-            }();
-            if (can_use_cache) [[likely]] {
-                auto value = cached_prototype->get_direct(cache_entry.property_offset);
-                if (value.is_accessor())
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
-                return value;
-            }
-        } else if (&shape == cache_entry.shape) {
-            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-            bool can_use_cache = true;
-            if (shape.is_dictionary()) {
-                if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation) [[unlikely]] {
-                    can_use_cache = false;
-                }
-            }
+        if (auto holder = object_holding_cached_property(*base_obj, shape, cache_entry)) [[likely]] {
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+            ++cache.statistics.hits;
+#endif
+            auto value = holder->get_direct(cache_entry.property_offset);
+            if (value.is_accessor())
+                return TRY(call(vm, value.as_accessor().getter(), this_value));
+            return value;
+        }
+    }
 
-            if (can_use_cache) [[likely]] {
-                auto value = base_obj->get_direct(cache_entry.property_offset);
-                if (value.is_accessor()) {
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
+    // OPTIMIZATION: If this site has already seen more shapes than it can remember, consult the VM-wide
+    //               megamorphic cache before falling back to a full property lookup.
+    MegamorphicPropertyLookupCache::Entry* megamorphic_entry = nullptr;
+    if (cache.entries.last().shape) {
+        auto const& property_name = get_property_name();
+        if (property_name.is_string()) {
+            megamorphic_entry = &vm.megamorphic_property_lookup_cache().entry_for(shape, property_name.as_string());
+            if (megamorphic_entry->property_name == property_name.as_string()) {
+                auto& cache_entry = megamorphic_entry->cache_entry;
+                if (auto holder = object_holding_cached_property(*base_obj, shape, cache_entry)) {
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+                    ++cache.statistics.megamorphic_hits;
+#endif
+                    auto value = holder->get_direct(cache_entry.property_offset);
+                    if (value.is_accessor())
+                        return TRY(call(vm, value.as_accessor().getter(), this_value));
+                    return value;
                 }
-                return value;
             }
         }
     }
+
     GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
 
+#if JS_PROPERTY_LOOKUP_CACHE_DEBUG
+    ++cache.statistics.misses;
+#endif
+
     CacheableGetPropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(get_property_name(), this_value, &cacheable_metadata));
 
@@ -170,6 +187,11 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
                 entry.shape_dictionary_generation = shape.dictionary_generation();
             }
         }
+
+        if (megamorphic_entry && cacheable_metadata.type != CacheableGetPropertyMetadata::Type::NotCacheable) {
+            megamorphic_entry->property_name = get_property_name().as_string();
+            megamorphic_entry->cache_entry = cache.entries[0];
+        }
     }
 
     return value;
@@ -209,6 +209,7 @@ struct ModuleRequest;
 class NativeFunction;
 class NativeJavaScriptBackedFunction;
 class ObjectEnvironment;
+class ParseTreeCache;
 class Parser;
 struct ParserError;
 class PrimitiveString;
@@ -220,6 +221,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -338,6 +340,7 @@ class Executable;
 class Generator;
 class Instruction;
 class Interpreter;
+struct MegamorphicPropertyLookupCache;
 class Operand;
 struct PropertyLookupCache;
 class RegexTable;
@@ -231,7 +231,8 @@ Lexer::Lexer(NonnullRefPtr<SourceCode const> source_code, size_t line_number, si
     , m_line_number(line_number)
     , m_line_column(line_column)
 {
-    if (s_keywords.is_empty()) {
+    // NB: Scripts may be parsed on background threads, so the keyword table must be filled in exactly once.
+    static bool const keywords_initialized = [] {
         s_keywords.set("async"_utf16_fly_string, TokenType::Async);
         s_keywords.set("await"_utf16_fly_string, TokenType::Await);
         s_keywords.set("break"_utf16_fly_string, TokenType::Break);
@@ -272,7 +273,9 @@ Lexer::Lexer(NonnullRefPtr<SourceCode const> source_code, size_t line_number, si
         s_keywords.set("while"_utf16_fly_string, TokenType::While);
         s_keywords.set("with"_utf16_fly_string, TokenType::With);
         s_keywords.set("yield"_utf16_fly_string, TokenType::Yield);
-    }
+        return true;
+    }();
+    (void)keywords_initialized;
 
     consume();
 }
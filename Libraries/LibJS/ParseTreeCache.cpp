@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/AST.h>
+#include <LibJS/ParseTreeCache.h>
+#include <LibJS/SourceCode.h>
+
+namespace JS {
+
+ParseTreeCache::ParseTreeCache() = default;
+ParseTreeCache::~ParseTreeCache() = default;
+
+RefPtr<Program> ParseTreeCache::find(StringView filename, Utf16String const& source_text, size_t line_number_offset)
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto& entry = m_entries[i];
+        if (entry.line_number_offset != line_number_offset || entry.filename != filename)
+            continue;
+        if (entry.program->source_code().code() != source_text)
+            continue;
+
+        auto program = entry.program;
+        if (i != 0)
+            m_entries.prepend(m_entries.take(i));
+        return program;
+    }
+    return nullptr;
+}
+
+void ParseTreeCache::add(StringView filename, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    auto source_length = program->source_code().length_in_code_units();
+    if (filename.is_empty() || source_length > max_total_source_length)
+        return;
+
+    auto filename_string = String::from_utf8(filename);
+    if (filename_string.is_error())
+        return;
+
+    // NOTE: A script that changed (e.g. after an edit and reload) replaces its own stale entry.
+    m_entries.remove_all_matching([&](auto const& entry) {
+        if (entry.line_number_offset != line_number_offset || entry.filename != filename)
+            return false;
+        m_total_source_length -= entry.program->source_code().length_in_code_units();
+        return true;
+    });
+
+    while (!m_entries.is_empty() && m_total_source_length + source_length > max_total_source_length) {
+        auto evicted_entry = m_entries.take_last();
+        m_total_source_length -= evicted_entry.program->source_code().length_in_code_units();
+    }
+
+    m_entries.prepend({ filename_string.release_value(), line_number_offset, move(program) });
+    m_total_source_length += source_length;
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// Keeps the parse trees of recently parsed scripts around, so that parsing the exact same source text again
+// (e.g. when a page is reloaded or navigated back to) can skip the parser entirely. Since functions cache their
+// SharedFunctionInstanceData on the parse tree, any bytecode that was already generated is reused as well.
+class ParseTreeCache {
+public:
+    ParseTreeCache();
+    ~ParseTreeCache();
+
+    RefPtr<Program> find(StringView filename, Utf16String const& source_text, size_t line_number_offset);
+    void add(StringView filename, size_t line_number_offset, NonnullRefPtr<Program>);
+
+private:
+    static constexpr size_t max_total_source_length = 16 * MiB;
+
+    struct Entry {
+        String filename;
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+    };
+
+    // NOTE: Entries are kept in most-recently-used order.
+    Vector<Entry> m_entries;
+    size_t m_total_source_length { 0 };
+};
+
+}
@@ -242,6 +242,12 @@ public:
         return m_lexical_names.contains(name) || m_var_names.contains(name) || m_functions_to_hoist.contains([&name](auto& function) { return function->name() == name; });
     }
 
+    // Whether a name bound by this scope (e.g. the name of a function expression) may be read by anything inside it.
+    [[nodiscard]] bool may_reference_bound_name(Utf16FlyString const& name) const
+    {
+        return m_identifier_groups.contains(name) || m_contains_direct_call_to_eval || m_screwed_by_eval_in_scope_chain;
+    }
+
     bool contains_direct_call_to_eval() const { return m_contains_direct_call_to_eval; }
     void set_contains_direct_call_to_eval()
     {
@@ -3089,7 +3095,10 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
 
         consume(TokenType::CurlyOpen);
 
-        return parse_function_body(*parameters, function_kind, parsing_insights);
+        auto function_body = parse_function_body(*parameters, function_kind, parsing_insights);
+        if (name)
+            parsing_insights.may_reference_function_name = function_scope.may_reference_bound_name(name->string());
+        return function_body;
     }();
 
     auto local_variables_names = body->local_variables_names();
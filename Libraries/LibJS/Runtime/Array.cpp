@@ -168,8 +168,86 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
     return true;
 }
 
-// 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+// Stably sorts items, where sorts_after(x, y) tells whether x has to be placed after y. Runs of a few elements are
+// sorted in place with a binary insertion sort, and are then merged bottom-up through a single scratch buffer that is at
+// least as large as items. This keeps the number of comparisons (which may call into JS) close to the minimum and
+// avoids allocating at every level.
+template<typename T, typename SortsAfter>
+static ThrowCompletionOr<void> merge_sort(Span<T> items, Span<T> scratch, SortsAfter const& sorts_after)
+{
+    static constexpr size_t run_length = 16;
+    auto size = items.size();
+
+    for (size_t run_start = 0; run_start < size; run_start += run_length) {
+        auto run_end = min(run_start + run_length, size);
+        for (size_t i = run_start + 1; i < run_end; ++i) {
+            // NB: The item stays in place until every comparison involving it is done, so it stays reachable if one of
+            //     them ends up running a garbage collection.
+            auto item = items[i];
+            if (!TRY(sorts_after(items[i - 1], item)))
+                continue;
+
+            // Find the first element that sorts after the item, so that equal elements keep their order.
+            auto low = run_start;
+            auto high = i - 1;
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (TRY(sorts_after(items[middle], item)))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+
+            for (auto j = i; j > low; --j)
+                items[j] = items[j - 1];
+            items[low] = item;
+        }
+    }
+
+    for (auto width = run_length; width < size; width *= 2) {
+        for (size_t low = 0; low + width < size; low += 2 * width) {
+            auto middle = low + width;
+            auto high = min(middle + width, size);
+
+            // Neighbouring runs that are already in order need no merging, which makes sorting sorted input cheap.
+            if (!TRY(sorts_after(items[middle - 1], items[middle])))
+                continue;
+
+            auto left_size = items.slice(low, width).copy_to(scratch);
+            size_t left = 0;
+            auto right = middle;
+            auto out = low;
+
+            while (left < left_size && right < high) {
+                if (TRY(sorts_after(scratch[left], items[right])))
+                    items[out++] = items[right++];
+                else
+                    items[out++] = scratch[left++];
+            }
+
+            while (left < left_size)
+                items[out++] = scratch[left++];
+        }
+    }
+
+    return {};
+}
+
+ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+{
+    if (arr_to_sort.size() <= 1)
+        return {};
+
+    GC::RootVector<Value> scratch(vm.heap());
+    scratch.resize(arr_to_sort.size());
+
+    return merge_sort(arr_to_sort.span(), scratch.span(), [&](Value x, Value y) -> ThrowCompletionOr<bool> {
+        return TRY(compare_func(x, y)) > 0;
+    });
+}
+
+// Steps 1-3 of SortIndexedProperties.
+static ThrowCompletionOr<GC::RootVector<Value>> collect_indexed_properties(VM& vm, Object const& object, size_t length, Holes holes)
 {
     // 1. Let items be a new empty List.
     auto items = GC::RootVector<Value> { vm.heap() };
@@ -208,19 +286,88 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
         // e. Set k to k + 1.
     }
 
-    // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
+    return items;
+}
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
+// 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+{
+    // 1-3. Let items be the list of the values of obj's indexed properties, read according to holes.
+    auto items = TRY(collect_indexed_properties(vm, object, length, holes));
+
+    // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
+    // NB: The spec requires Array.prototype.sort() to be stable, so this is a merge sort.
     TRY(array_merge_sort(vm, sort_compare, items));
 
     // 5. Return items.
     return items;
 }
 
+// OPTIMIZATION: Without a comparefn, CompareArrayElements orders elements by their ToString(), which it would otherwise
+//     compute twice per comparison. ToString() has no side effects on primitives other than Symbols (where it throws),
+//     so when every item is one of those, converting each item only once up front is indistinguishable.
+static Optional<GC::RootVector<Value>> sort_primitives_by_string_keys(VM& vm, GC::RootVector<Value> const& items)
+{
+    for (auto item : items) {
+        if (item.is_object() || item.is_symbol())
+            return {};
+    }
+
+    Vector<Utf16String> keys;
+    keys.ensure_capacity(items.size());
+
+    Vector<size_t> order;
+    order.ensure_capacity(items.size());
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items[i].is_undefined()) {
+            keys.unchecked_append({});
+            continue;
+        }
+        keys.unchecked_append(MUST(items[i].to_utf16_string(vm)));
+        order.unchecked_append(i);
+    }
+
+    Vector<size_t> scratch;
+    scratch.resize(order.size());
+
+    MUST(merge_sort(order.span(), scratch.span(), [&](size_t x, size_t y) -> ThrowCompletionOr<bool> {
+        return keys[y].utf16_view().is_code_unit_less_than(keys[x].utf16_view());
+    }));
+
+    GC::RootVector<Value> sorted_items { vm.heap() };
+    sorted_items.ensure_capacity(items.size());
+    for (auto index : order)
+        sorted_items.unchecked_append(items[index]);
+
+    // NB: CompareArrayElements places undefined after everything else.
+    while (sorted_items.size() < items.size())
+        sorted_items.unchecked_append(js_undefined());
+
+    return sorted_items;
+}
+
+// SortIndexedProperties with CompareArrayElements(x, y, comparefn) as SortCompare, as used by Array.prototype.sort() and Array.prototype.toSorted().
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, FunctionObject* comparefn, Holes holes)
+{
+    if (comparefn == nullptr) {
+        auto items = TRY(collect_indexed_properties(vm, object, length, holes));
+        if (auto sorted_items = sort_primitives_by_string_keys(vm, items); sorted_items.has_value())
+            return sorted_items.release_value();
+
+        Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+            return TRY(compare_array_elements(vm, x, y, nullptr));
+        };
+        TRY(array_merge_sort(vm, sort_compare, items));
+        return items;
+    }
+
+    Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+        return TRY(compare_array_elements(vm, x, y, comparefn));
+    };
+    return sort_indexed_properties(vm, object, length, sort_compare, holes);
+}
+
 // 23.1.3.30.2 CompareArrayElements ( x, y, comparefn ), https://tc39.es/ecma262/#sec-comparearrayelements
 ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, FunctionObject* comparefn)
 {
@@ -721,6 +721,22 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// OPTIMIZATION: If this object is an Array that:
+// - is not a proxy target, which means has/get will not trap.
+// - has intact prototype chain, which means holes can't be backed by getters or indexed properties on a prototype.
+// - has simple storage type, which means all elements are plain data properties.
+// then reading its elements has no side effects, and we can look at the indexed storage directly.
+static SimpleIndexedPropertyStorage const* storage_for_side_effect_free_element_reads(Object const& object)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -744,6 +760,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = storage_for_side_effect_free_element_reads(*this_object)) {
+        auto const& elements = storage->elements();
+        for (u64 i = from_index; i < min<u64>(length, elements.size()); ++i) {
+            auto element = elements[i];
+            // NOTE: Holes read as undefined.
+            if (element.is_special_empty_value())
+                element = js_undefined();
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        // NOTE: The array may have been shrunk by ToIntegerOrInfinity(fromIndex), in which case the rest reads as undefined.
+        return Value(value_to_find.is_undefined() && length > max<u64>(from_index, elements.size()));
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -797,6 +828,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = storage_for_side_effect_free_element_reads(*object)) {
+        auto const& elements = storage->elements();
+        for (; k < min<size_t>(length, elements.size()); ++k) {
+            // NOTE: Holes are skipped, since HasProperty() would return false for them.
+            if (!elements[k].is_special_empty_value() && is_strictly_equal(search_element, elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -908,6 +949,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto const* storage = storage_for_side_effect_free_element_reads(*object)) {
+        auto const& elements = storage->elements();
+        for (; k >= 0; --k) {
+            // NOTE: Holes (and elements past the end, if the array was shrunk) are skipped, since HasProperty() would return false for them.
+            auto index = static_cast<size_t>(k);
+            if (index < elements.size() && !elements[index].is_special_empty_value() && is_strictly_equal(search_element, elements[index]))
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -1354,62 +1406,6 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
-{
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
-        return {};
-
-    GC::RootVector<Value> left(vm.heap());
-    GC::RootVector<Value> right(vm.heap());
-
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
-
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
-        }
-    }
-
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
-
-    arr_to_sort.clear();
-
-    size_t left_index = 0, right_index = 0;
-
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
-
-        double comparison_result = TRY(compare_func(x, y));
-
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
-        }
-    }
-
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
-    }
-
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
-    }
-
-    return {};
-}
-
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
 {
@@ -1425,13 +1421,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     auto length = TRY(length_of_array_like(vm, object));
 
     // 4. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
-    Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
-        // a. Return ? CompareArrayElements(x, y, comparefn).
-        return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
-    };
-
+    //     a. Return ? CompareArrayElements(x, y, comparefn).
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, comparefn.is_undefined() ? nullptr : &comparefn.as_function(), Holes::SkipHoles));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1733,13 +1725,9 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     auto array = TRY(Array::create(realm, length));
 
     // 5. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
-    Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
-        // a. Return ? CompareArrayElements(x, y, comparefn).
-        return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
-    };
-
+    //     a. Return ? CompareArrayElements(x, y, comparefn).
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, comparefn.is_undefined() ? nullptr : &comparefn.as_function(), Holes::ReadThroughHoles));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
@@ -10,6 +10,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -107,9 +108,16 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     if (!m_on_rejected)
         m_on_rejected = NativeFunction::create(realm, move(rejected_closure), 1);
 
+    // OPTIMIZATION: The reactions PerformPromiseThen would create are identical for every await in this function, so we
+    //               create them once instead of allocating two job callbacks and two reactions per await.
+    if (!m_on_fulfilled_reaction) {
+        m_on_fulfilled_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, {}, vm.host_make_job_callback(*m_on_fulfilled));
+        m_on_rejected_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, {}, vm.host_make_job_callback(*m_on_rejected));
+    }
+
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
+    m_current_promise->perform_then(*m_on_fulfilled_reaction, *m_on_rejected_reaction, {});
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -180,6 +188,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
         m_suspended_execution_context->visit_edges(visitor);
     visitor.visit(m_on_fulfilled);
     visitor.visit(m_on_rejected);
+    visitor.visit(m_on_fulfilled_reaction);
+    visitor.visit(m_on_rejected_reaction);
 }
 
 }
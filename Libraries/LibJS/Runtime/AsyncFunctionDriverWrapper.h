@@ -37,6 +37,8 @@ private:
 
     GC::Ptr<NativeFunction> m_on_fulfilled;
     GC::Ptr<NativeFunction> m_on_rejected;
+    GC::Ptr<PromiseReaction> m_on_fulfilled_reaction;
+    GC::Ptr<PromiseReaction> m_on_rejected_reaction;
 };
 
 }
@@ -15,6 +15,8 @@
 #include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
+#include <AK/NumericLimits.h>
+#include <AK/Time.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
@@ -22,6 +24,7 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Runtime/WaiterLists.h>
 
 namespace JS {
 
@@ -146,6 +149,16 @@ enum class WaitMode {
     Async,
 };
 
+static Value create_async_wait_result(VM& vm, Value value)
+{
+    auto& realm = *vm.current_realm();
+
+    auto result_object = Object::create(realm, realm.intrinsics().object_prototype());
+    MUST(result_object->create_data_property_or_throw(vm.names.async, Value { false }));
+    MUST(result_object->create_data_property_or_throw(vm.names.value, value));
+    return result_object;
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index, Value expected_value, Value timeout_value)
 {
@@ -189,12 +202,76 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
     if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)value;
-    (void)timeout;
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    // 12. Let offset be typedArray.[[ByteOffset]].
+    // 13. Let byteIndexInBuffer be (i × elementSize) + offset.
+    // 14. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    auto const* waiter_list = buffer->buffer().data() + byte_index_in_buffer;
+
+    // 15. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+    // 16. Else,
+    //     a. Let promiseCapability be ! NewPromiseCapability(%Promise%).
+    //     b. Let resultObject be OrdinaryObjectCreate(%Object.prototype%).
+    // NOTE: The result object is created by create_async_wait_result() below, once we know what it contains.
+
+    // 17. Perform EnterCriticalSection(WL).
+    // NOTE: The critical section is left whenever `locker` goes out of scope.
+    auto& waiter_lists = WaiterLists::the();
+    Threading::MutexLocker locker { waiter_lists.critical_section() };
+
+    // 18. Let elementType be TypedArrayElementType(typedArray).
+    // 19. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, seq-cst).
+    auto current_value = typed_array.get_value_from_buffer(byte_index_in_buffer, ArrayBuffer::Order::SeqCst, true);
+    auto current = current_value.is_bigint() ? MUST(current_value.to_bigint_int64(vm)) : static_cast<i64>(current_value.as_double());
+
+    // 20. If v ≠ w, then
+    if (value != current) {
+        // a. Perform LeaveCriticalSection(WL).
+        // b. If mode is sync, return "not-equal".
+        if (mode == WaitMode::Sync)
+            return PrimitiveString::create(vm, "not-equal"_string);
+
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "not-equal").
+        // e. Return resultObject.
+        return create_async_wait_result(vm, PrimitiveString::create(vm, "not-equal"_string));
+    }
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 21. If t is 0 and mode is async, then
+    if (timeout == 0 && mode == WaitMode::Async) {
+        // a. NOTE: There is no special handling of synchronous immediate timeouts. Asynchronous immediate timeouts
+        //    have special handling in order to fail fast and avoid unnecessary Promise jobs.
+        // b. Perform LeaveCriticalSection(WL).
+        // c. Perform ! CreateDataPropertyOrThrow(resultObject, "async", false).
+        // d. Perform ! CreateDataPropertyOrThrow(resultObject, "value", "timed-out").
+        // e. Return resultObject.
+        return create_async_wait_result(vm, PrimitiveString::create(vm, "timed-out"_string));
+    }
+
+    // FIXME: Implement steps 30, 33 and 34 once we have a way to enqueue the timeout job for asynchronous waiters.
+    if (mode == WaitMode::Async)
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Atomics.waitAsync"sv);
+
+    // 22. Let thisAgent be AgentSignifier().
+    // 23. Let now be the time value (UTC) identifying the current time.
+    // 24. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 25. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 26. NOTE: When t is +∞, timeoutTime is also +∞.
+    Optional<UnixDateTime> timeout_time;
+    if (isfinite(timeout))
+        timeout_time = UnixDateTime::now() + AK::Duration::from_seconds_f64(timeout / 1000.0);
+
+    // 27. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    // 28. Perform AddWaiter(WL, waiterRecord).
+    // 29. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    auto result = waiter_lists.add_waiter_and_suspend(waiter_list, timeout_time);
+
+    // 31. Perform LeaveCriticalSection(WL).
+    // 32. If mode is sync, return waiterRecord.[[Result]].
+    return PrimitiveString::create(vm, result == WaiterLists::WaitResult::Ok ? "ok"_string : "timed-out"_string);
 }
 
 template<typename T, typename AtomicFunction>
@@ -582,12 +659,22 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    auto const* waiter_list = block.data() + byte_index_in_buffer;
+
+    // 8. Perform EnterCriticalSection(WL).
+    auto& waiter_lists = WaiterLists::the();
+    Threading::MutexLocker locker { waiter_lists.critical_section() };
+
+    // 9. Let S be RemoveWaiters(WL, c).
+    // 10. For each element W of S, do
+    //     a. Perform NotifyWaiter(WL, W).
+    auto waiters_to_notify = waiter_lists.notify_waiters(waiter_list, isinf(count) ? NumericLimits<size_t>::max() : static_cast<size_t>(count));
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { waiters_to_notify };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
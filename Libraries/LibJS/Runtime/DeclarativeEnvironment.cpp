@@ -15,6 +15,14 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 
+// NOTE: Serial numbers are unique across all environments, so that a bytecode cache keyed on a serial number
+//       can never mistake one environment for another, even if the bytecode is run in more than one realm.
+static u64 next_environment_serial_number()
+{
+    static u64 s_next_environment_serial_number = 0;
+    return ++s_next_environment_serial_number;
+}
+
 DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_bindings(Badge<ForStatement>, DeclarativeEnvironment& other, size_t bindings_size)
 {
     auto bindings = other.m_bindings.span().slice(0, bindings_size);
@@ -79,7 +87,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, Utf1
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -102,7 +110,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Ut
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -212,7 +220,7 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, Utf16FlyStri
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 4. Return true.
     return true;
@@ -52,9 +52,13 @@ bool FinalizationRegistry::remove_by_token(Cell& unregister_token)
 
 void FinalizationRegistry::remove_dead_cells(Badge<GC::Heap>)
 {
+    // NOTE: If this registry is about to be swept itself, there's nobody left to run the cleanup callbacks.
+    if (!is_marked())
+        return;
+
     auto any_cells_were_removed = false;
     for (auto& record : m_records) {
-        if (!record.target || record.target->state() == Cell::State::Live)
+        if (!record.target || record.target->is_marked())
             continue;
         record.target = nullptr;
         any_cells_were_removed = true;
@@ -357,9 +357,6 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
     m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 
     array_prototype()->convert_to_prototype_if_needed();
@@ -422,6 +419,10 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        /* %Date.now% is captured along with the Date constructor instead of at realm creation. */                                                       \
+        if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>)                                                                               \
+            m_date_constructor_now_function = &m_##snake_namespace##snake_name##_constructor->get_without_side_effects(vm.names.now).as_function();      \
     }                                                                                                                                                    \
                                                                                                                                                          \
     GC::Ref<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                          \
@@ -455,16 +456,44 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                              \
-    GC::Ref<ClassName> Intrinsics::snake_name##_object()                   \
-    {                                                                      \
-        if (!m_##snake_name##_object)                                      \
-            m_##snake_name##_object = m_realm->create<ClassName>(m_realm); \
-        return *m_##snake_name##_object;                                   \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                     \
+    GC::Ref<ClassName> Intrinsics::snake_name##_object()                                                                          \
+    {                                                                                                                             \
+        if (!m_##snake_name##_object) {                                                                                           \
+            m_##snake_name##_object = m_realm->create<ClassName>(m_realm);                                                        \
+                                                                                                                                  \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                                        \
+                auto& vm = this->vm();                                                                                            \
+                m_json_parse_function = &m_##snake_name##_object->get_without_side_effects(vm.names.parse).as_function();         \
+                m_json_stringify_function = &m_##snake_name##_object->get_without_side_effects(vm.names.stringify).as_function(); \
+            }                                                                                                                     \
+        }                                                                                                                         \
+        return *m_##snake_name##_object;                                                                                          \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+GC::Ref<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    if (!m_date_constructor_now_function)
+        (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_parse_function()
+{
+    if (!m_json_parse_function)
+        (void)json_object();
+    return *m_json_parse_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_stringify_function()
+{
+    if (!m_json_stringify_function)
+        (void)json_object();
+    return *m_json_stringify_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
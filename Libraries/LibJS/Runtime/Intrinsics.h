@@ -104,9 +104,9 @@ public:
 
     // Namespace/constructor object functions
     GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    GC::Ref<FunctionObject> date_constructor_now_function();
+    GC::Ref<FunctionObject> json_parse_function();
+    GC::Ref<FunctionObject> json_stringify_function();
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
@@ -6,6 +6,7 @@
 
 #include <AK/Function.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
@@ -136,6 +137,20 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::stringify)
     return PrimitiveString::create(vm, maybe_string.release_value());
 }
 
+// OPTIMIZATION: Plain data objects (and everything on their prototype chain) store all of their named properties in
+//               their shape, so we can answer "is there a toJSON property?" without going through [[Get]]. Objects with
+//               an exotic [[Get]], like WindowProxy, may find properties elsewhere, so they always take the slow path.
+static bool prototype_chain_lacks_to_json(VM& vm, Object const& object)
+{
+    for (auto const* current = &object; current; current = current->prototype()) {
+        if (!current->eligible_for_own_property_enumeration_fast_path() || current->has_exotic_internal_get())
+            return false;
+        if (current->shape().lookup(vm.names.toJSON).has_value())
+            return false;
+    }
+    return true;
+}
+
 // 25.5.2.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/ecma262/#sec-serializejsonproperty
 // 1.4.1 SerializeJSONProperty ( state, key, holder ), https://tc39.es/proposal-json-parse-with-source/#sec-serializejsonproperty
 // Returns true if a value was serialized, false if the value was undefined (should be omitted).
@@ -147,7 +162,7 @@ ThrowCompletionOr<bool> JSONObject::serialize_json_property(VM& vm, StringifySta
     auto value = TRY(holder->get(key));
 
     // 2. If Type(value) is Object or BigInt, then
-    if (value.is_object() || value.is_bigint()) {
+    if ((value.is_object() && !prototype_chain_lacks_to_json(vm, value.as_object())) || value.is_bigint()) {
         // a. Let toJSON be ? GetV(value, "toJSON").
         auto to_json = TRY(value.get(vm, vm.names.toJSON));
 
@@ -577,7 +592,18 @@ static ALWAYS_INLINE ThrowCompletionOr<void> ensure_simdjson_fully_parsed(VM& vm
     return {};
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM&, simdjson::ondemand::value);
+namespace {
+
+struct JSONParseState {
+    // OPTIMIZATION: Documents tend to repeat the same handful of keys (e.g. arrays of records with the same shape), so we
+    //               remember the property key for each raw key we've seen to avoid unescaping and re-interning it.
+    static constexpr size_t max_cached_keys = 1024;
+    HashMap<StringView, PropertyKey> cached_keys;
+};
+
+}
+
+static ThrowCompletionOr<Value> parse_simdjson_value(VM&, JSONParseState&, simdjson::ondemand::value);
 
 template<typename T>
 static ThrowCompletionOr<Value> parse_simdjson_number(VM& vm, T& value, StringView raw_sv)
@@ -640,7 +666,7 @@ static ThrowCompletionOr<Value> parse_simdjson_string(VM& vm, T& value)
 }
 
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, JSONParseState& state, T& value)
 {
     auto& realm = *vm.current_realm();
 
@@ -655,7 +681,7 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
         simdjson::ondemand::value element_value;
         if (element.get(element_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, element_value));
+        auto parsed = TRY(parse_simdjson_value(vm, state, element_value));
         array->define_direct_property(index++, parsed, default_attributes);
     }
 
@@ -664,7 +690,7 @@ static ThrowCompletionOr<Value> parse_simdjson_array(VM& vm, T& value)
 }
 
 template<typename T>
-static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
+static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, JSONParseState& state, T& value)
 {
     auto& realm = *vm.current_realm();
 
@@ -679,21 +705,28 @@ static ThrowCompletionOr<Value> parse_simdjson_object(VM& vm, T& value)
         std::string_view raw_key;
         if (field.escaped_key().get(raw_key))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto unescaped_key = unescape_json_string({ raw_key.data(), raw_key.size() });
-        if (!unescaped_key.has_value())
-            return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+        StringView raw_key_view { raw_key.data(), raw_key.size() };
+        Optional<PropertyKey> key = state.cached_keys.get(raw_key_view);
+        if (!key.has_value()) {
+            auto unescaped_key = unescape_json_string(raw_key_view);
+            if (!unescaped_key.has_value())
+                return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            key = PropertyKey { unescaped_key.release_value() };
+            if (state.cached_keys.size() < JSONParseState::max_cached_keys)
+                state.cached_keys.set(raw_key_view, *key);
+        }
         simdjson::ondemand::value field_value;
         if (field.value().get(field_value))
             return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-        auto parsed = TRY(parse_simdjson_value(vm, field_value));
-        object->define_direct_property(unescaped_key.release_value(), parsed, default_attributes);
+        auto parsed = TRY(parse_simdjson_value(vm, state, field_value));
+        object->define_direct_property(key.release_value(), parsed, default_attributes);
     }
 
     TRY(ensure_simdjson_fully_parsed(vm, value));
     return object;
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand::value value)
+static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, JSONParseState& state, simdjson::ondemand::value value)
 {
     simdjson::ondemand::json_type type;
     if (value.type().get(type))
@@ -716,9 +749,9 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, value);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, value);
+        return parse_simdjson_array(vm, state, value);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, value);
+        return parse_simdjson_object(vm, state, value);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -726,7 +759,7 @@ static ThrowCompletionOr<Value> parse_simdjson_value(VM& vm, simdjson::ondemand:
     VERIFY_NOT_REACHED();
 }
 
-static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondemand::document& document)
+static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, JSONParseState& state, simdjson::ondemand::document& document)
 {
     simdjson::ondemand::json_type type;
     if (document.type().get(type))
@@ -760,9 +793,9 @@ static ThrowCompletionOr<Value> parse_simdjson_document(VM& vm, simdjson::ondema
     case simdjson::ondemand::json_type::string:
         return parse_simdjson_string(vm, document);
     case simdjson::ondemand::json_type::array:
-        return parse_simdjson_array(vm, document);
+        return parse_simdjson_array(vm, state, document);
     case simdjson::ondemand::json_type::object:
-        return parse_simdjson_object(vm, document);
+        return parse_simdjson_object(vm, state, document);
     case simdjson::ondemand::json_type::unknown:
         return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
     }
@@ -794,7 +827,8 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = TRY(parse_simdjson_document(vm, document));
+    JSONParseState state;
+    auto result = TRY(parse_simdjson_document(vm, state, document));
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
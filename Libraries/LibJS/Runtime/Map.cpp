@@ -17,77 +17,142 @@ GC::Ref<Map> Map::create(Realm& realm)
 
 Map::Map(Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
+    , m_storage(adopt_ref(*new Storage))
 {
 }
 
+size_t Map::Storage::index_in_successor(size_t index) const
+{
+    if (was_cleared)
+        return 0;
+
+    // Every removed entry before the given index shifts it down by one.
+    size_t low = 0;
+    size_t high = removed_indices.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (removed_indices[middle] < index)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return index - low;
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
-    m_entries.clear();
+    m_indices.clear();
+    m_hole_count = 0;
+
+    if (m_storage->ref_count() == 1) {
+        m_storage->entries.clear();
+        return;
+    }
+
+    // NB: Iterators still refer to the current entries, so leave a trail for them to follow.
+    auto cleared_storage = adopt_ref(*new Storage);
+    m_storage->entries.clear();
+    m_storage->was_cleared = true;
+    m_storage->successor = cleared_storage;
+    m_storage = move(cleared_storage);
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
+    auto it = m_indices.find(key);
+    if (it == m_indices.end())
+        return false;
 
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
+    m_storage->entries[it->value] = { js_special_empty_value(), js_special_empty_value() };
+    m_indices.remove(it);
+    ++m_hole_count;
+
+    static constexpr size_t minimum_hole_count_for_compaction = 8;
+    if (m_hole_count >= minimum_hole_count_for_compaction && m_hole_count * 2 >= m_storage->entries.size())
+        compact_entries();
+    return true;
+}
+
+void Map::compact_entries()
+{
+    auto& entries = m_storage->entries;
+
+    // OPTIMIZATION: Without iterators to fix up, the entries can be compacted in place.
+    if (m_storage->ref_count() == 1) {
+        size_t live_count = 0;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (entries[i].key.is_special_empty_value())
+                continue;
+            if (live_count != i) {
+                m_indices.find(entries[i].key)->value = live_count;
+                entries[live_count] = entries[i];
+            }
+            ++live_count;
         }
+        entries.shrink(live_count);
+        m_hole_count = 0;
+        return;
     }
 
-    if (!index.has_value())
-        return false;
+    auto compacted_storage = adopt_ref(*new Storage);
+    compacted_storage->entries.ensure_capacity(m_indices.size());
+    m_storage->removed_indices.ensure_capacity(m_hole_count);
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    return true;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].key.is_special_empty_value()) {
+            m_storage->removed_indices.unchecked_append(i);
+            continue;
+        }
+        m_indices.find(entries[i].key)->value = compacted_storage->entries.size();
+        compacted_storage->entries.unchecked_append(entries[i]);
+    }
+
+    entries.clear();
+    m_storage->successor = compacted_storage;
+    m_storage = move(compacted_storage);
+    m_hole_count = 0;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto it = m_indices.find(key); it != m_indices.end())
+        return m_storage->entries[it->value].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return m_indices.contains(key);
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-    }
+    auto result = m_indices.ensure(key, [&] {
+        m_storage->entries.append({ key, js_undefined() });
+        return m_storage->entries.size() - 1;
+    });
+    m_storage->entries[result].value = value;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_indices.size();
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_storage->entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+    // NOTE: The keys in m_indices are already visited by the walk over the entries above.
+    visitor.ignore(m_indices);
 }
 
 }
@@ -7,7 +7,8 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -34,6 +35,27 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
+    // The entries of a map in insertion order. Removed entries are left behind as holes (with an empty key) until
+    // enough of them accumulate, at which point the entries are compacted. If iterators still point into the old
+    // entries at that time, they move to the compacted ones the next time they are used, with the help of the
+    // successor and removed_indices fields.
+    class Storage final : public RefCounted<Storage> {
+    public:
+        Vector<Entry> entries;
+
+        // Set once this storage has been replaced by a compacted or cleared one.
+        RefPtr<Storage> successor;
+        bool was_cleared { false };
+        Vector<size_t> removed_indices;
+
+        size_t index_in_successor(size_t index) const;
+    };
+
     struct EndIterator {
     };
 
@@ -41,8 +63,8 @@ public:
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_index >= m_storage->entries.size();
         }
 
         IteratorImpl& operator++()
@@ -54,16 +76,21 @@ public:
         decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return static_cast<Conditional<IsConst, Entry const&, Entry&>>(m_storage->entries[m_index]);
         }
 
         decltype(auto) operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return static_cast<Entry const&>(m_storage->entries[m_index]);
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const
+        {
+            ensure_next_element();
+            other.ensure_next_element();
+            return m_index == other.m_index && m_map.ptr() == other.m_map.ptr();
+        }
         bool operator==(EndIterator const&) const { return is_end(); }
 
         void visit_edges(Cell::Visitor& visitor)
@@ -76,34 +103,31 @@ public:
         IteratorImpl(Map const& map)
         requires(IsConst)
             : m_map(map)
+            , m_storage(map.m_storage)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
+            , m_storage(map.m_storage)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
         }
 
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            while (m_storage->successor) {
+                m_index = m_storage->index_in_successor(m_index);
+                m_storage = *m_storage->successor;
+            }
+
+            auto const& entries = m_storage->entries;
+            while (m_index < entries.size() && entries[m_index].key.is_special_empty_value())
+                ++m_index;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
+        mutable NonnullRefPtr<Storage> m_storage;
         mutable size_t m_index { 0 };
     };
 
@@ -118,9 +142,11 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    void compact_entries();
+
+    NonnullRefPtr<Storage> m_storage;
+    HashMap<Value, size_t, ValueTraits> m_indices;
+    size_t m_hole_count { 0 };
 };
 
 template<>
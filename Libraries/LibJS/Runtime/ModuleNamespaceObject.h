@@ -33,6 +33,7 @@ public:
     virtual void initialize(Realm&) override;
 
     virtual bool eligible_for_own_property_enumeration_fast_path() const final { return false; }
+    virtual bool has_exotic_internal_get() const final { return true; }
 
 private:
     ModuleNamespaceObject(Realm&, Module* module, Vector<Utf16FlyString> exports);
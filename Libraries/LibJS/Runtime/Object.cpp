@@ -33,6 +33,8 @@ GC_DEFINE_ALLOCATOR(Object);
 
 static HashMap<GC::Ptr<Object const>, HashMap<Utf16FlyString, Object::IntrinsicAccessor>> s_intrinsics;
 
+static constexpr size_t max_transitions_before_converting_to_dictionary = 64;
+
 // 10.1.12 OrdinaryObjectCreate ( proto [ , additionalInternalSlotsList ] ), https://tc39.es/ecma262/#sec-ordinaryobjectcreate
 GC::Ref<Object> Object::create(Realm& realm, Object* prototype)
 {
@@ -1275,7 +1277,6 @@ Optional<u32> Object::storage_set(PropertyKey const& property_key, ValueAndAttri
     auto metadata = shape().lookup(property_key);
 
     if (!metadata.has_value()) {
-        static constexpr size_t max_transitions_before_converting_to_dictionary = 64;
         if (!m_shape->is_dictionary() && m_shape->property_count() >= max_transitions_before_converting_to_dictionary)
             set_shape(m_shape->create_dictionary_transition());
 
@@ -1318,6 +1319,17 @@ void Object::storage_delete(PropertyKey const& property_key)
         m_storage.remove(metadata->offset);
         return;
     }
+
+    // OPTIMIZATION: Deleting anything other than the most recently added property is a strong hint that this object is
+    //               being used as a hash map. Switch it to a dictionary shape right away instead of growing a new chain
+    //               of delete and put transitions that no other object is ever going to share.
+    if (!m_shape->is_prototype_shape() && !m_shape->is_put_transition_for(property_key)) {
+        set_shape(m_shape->create_dictionary_transition());
+        m_shape->remove_property_without_transition(property_key, metadata->offset);
+        m_storage.remove(metadata->offset);
+        return;
+    }
+
     m_shape = m_shape->create_delete_transition(property_key);
     m_storage.remove(metadata->offset);
 }
@@ -1366,6 +1378,25 @@ void Object::define_intrinsic_accessor(PropertyKey const& property_key, Property
     intrinsics.set(property_key.as_string(), move(accessor));
 }
 
+// Global objects define hundreds of intrinsic accessors in a row. Growing everything up front avoids
+// rehashing and reallocating for each of them, and skips the put transitions that would otherwise be
+// created for the first properties before the object switches to a dictionary shape anyway.
+void Object::ensure_intrinsic_accessor_capacity(size_t count)
+{
+    auto property_count = m_shape->property_count() + count;
+
+    if (!m_shape->is_dictionary() && property_count >= max_transitions_before_converting_to_dictionary)
+        set_shape(m_shape->create_dictionary_transition());
+    if (m_shape->is_dictionary())
+        m_shape->ensure_property_table_capacity(property_count);
+
+    m_storage.ensure_capacity(m_storage.size() + count);
+
+    m_has_intrinsic_accessors = true;
+    auto& intrinsics = s_intrinsics.ensure(this);
+    intrinsics.ensure_capacity(intrinsics.size() + count);
+}
+
 ThrowCompletionOr<void> Object::for_each_own_property_with_enumerability(Function<ThrowCompletionOr<void>(PropertyKey const&, bool)>&& callback) const
 {
     auto& vm = this->vm();
@@ -207,6 +207,7 @@ public:
 
     using IntrinsicAccessor = Value (*)(Realm&);
     void define_intrinsic_accessor(PropertyKey const&, PropertyAttributes attributes, IntrinsicAccessor accessor);
+    void ensure_intrinsic_accessor_capacity(size_t count);
 
     void define_native_function(Realm&, PropertyKey const&, ESCAPING Function<ThrowCompletionOr<Value>(VM&)>, i32 length, PropertyAttributes attributes, Optional<Bytecode::Builtin> builtin = {});
     void define_native_accessor(Realm&, PropertyKey const&, ESCAPING Function<ThrowCompletionOr<Value>(VM&)> getter, ESCAPING Function<ThrowCompletionOr<Value>(VM&)> setter, PropertyAttributes attributes);
@@ -252,6 +253,9 @@ public:
 
     virtual bool eligible_for_own_property_enumeration_fast_path() const { return true; }
 
+    // Objects whose [[Get]] does more than look up their own properties and then their prototype's.
+    virtual bool has_exotic_internal_get() const { return false; }
+
     virtual BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined([[maybe_unused]] Value next_method) { return nullptr; }
 
     virtual bool is_array_iterator_prototype() const { return false; }
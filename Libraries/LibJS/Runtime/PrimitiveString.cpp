@@ -25,8 +25,17 @@ namespace JS {
 // Longer strings are not cached to avoid excessive hashing and lookup costs.
 static constexpr size_t MAX_LENGTH_FOR_STRING_CACHE = 256;
 
+// Substrings longer than this are created as slices that share the code units of the string they were taken from.
+// Shorter substrings are cheap to copy, and are deduplicated through the string cache anyway.
+static constexpr size_t MIN_LENGTH_FOR_SLICE_STRING = MAX_LENGTH_FOR_STRING_CACHE;
+
+// To avoid a small slice keeping a much larger string alive, a slice must cover at least this fraction of the
+// string it was taken from. Smaller substrings are copied instead.
+static constexpr size_t MAX_UNDERLYING_STRING_TO_SLICE_LENGTH_RATIO = 16;
+
 GC_DEFINE_ALLOCATOR(PrimitiveString);
 GC_DEFINE_ALLOCATOR(RopeString);
+GC_DEFINE_ALLOCATOR(SliceString);
 
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String const& string)
 {
@@ -130,6 +139,32 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, P
     return vm.heap().allocate<RopeString>(lhs, rhs);
 }
 
+GC::Ref<PrimitiveString> PrimitiveString::create_substring(VM& vm, PrimitiveString& string, size_t start, size_t length)
+{
+    auto view = string.utf16_string_view();
+    VERIFY(start + length <= view.length_in_code_units());
+
+    if (length == view.length_in_code_units())
+        return string;
+
+    if (length <= MIN_LENGTH_FOR_SLICE_STRING)
+        return create(vm, view.substring_view(start, length));
+
+    // NOTE: A slice of a slice shares the code units of the original string.
+    GC::Ref<PrimitiveString> underlying_string = string;
+    auto underlying_start = start;
+    if (string.m_is_slice) {
+        auto& slice_string = static_cast<SliceString&>(string);
+        underlying_string = slice_string.m_underlying_string;
+        underlying_start += slice_string.m_start;
+    }
+
+    if (length * MAX_UNDERLYING_STRING_TO_SLICE_LENGTH_RATIO < underlying_string->length_in_utf16_code_units())
+        return create(vm, view.substring_view(start, length));
+
+    return vm.heap().allocate<SliceString>(underlying_string, underlying_start, length);
+}
+
 PrimitiveString::PrimitiveString(Utf16String string)
     : m_utf16_string(move(string))
 {
@@ -159,8 +194,8 @@ void PrimitiveString::finalize()
 
 bool PrimitiveString::is_empty() const
 {
-    if (m_is_rope) {
-        // NOTE: We never make an empty rope string.
+    if (m_is_rope || m_is_slice) {
+        // NOTE: We never make an empty rope or slice string.
         return false;
     }
 
@@ -174,6 +209,7 @@ bool PrimitiveString::is_empty() const
 String PrimitiveString::utf8_string() const
 {
     resolve_rope_if_needed(EncodingPreference::UTF8);
+    resolve_slice_if_needed();
 
     if (!has_utf8_string()) {
         VERIFY(has_utf16_string());
@@ -183,6 +219,17 @@ String PrimitiveString::utf8_string() const
     return *m_utf8_string;
 }
 
+FlyString PrimitiveString::utf8_fly_string() const
+{
+    FlyString fly_string { utf8_string() };
+
+    // OPTIMIZATION: Hold on to the interned string itself, so that converting this string to a FlyString again doesn't
+    //               have to look it up in the set of all fly strings.
+    m_utf8_string = fly_string.to_string();
+
+    return fly_string;
+}
+
 StringView PrimitiveString::utf8_string_view() const
 {
     if (!has_utf8_string())
@@ -193,6 +240,7 @@ StringView PrimitiveString::utf8_string_view() const
 Utf16String PrimitiveString::utf16_string() const
 {
     resolve_rope_if_needed(EncodingPreference::UTF16);
+    resolve_slice_if_needed();
 
     if (!has_utf16_string()) {
         VERIFY(has_utf8_string());
@@ -204,6 +252,10 @@ Utf16String PrimitiveString::utf16_string() const
 
 Utf16View PrimitiveString::utf16_string_view() const
 {
+    // OPTIMIZATION: Slices can be viewed without copying their code units out of the underlying string.
+    if (m_is_slice)
+        return static_cast<SliceString const&>(*this).view();
+
     if (!has_utf16_string())
         (void)utf16_string();
     return *m_utf16_string;
@@ -218,6 +270,8 @@ bool PrimitiveString::operator==(PrimitiveString const& other) const
 {
     if (this == &other)
         return true;
+    if (m_is_slice || other.m_is_slice)
+        return utf16_string_view() == other.utf16_string_view();
     if (m_utf8_string.has_value() && other.m_utf8_string.has_value())
         return m_utf8_string->bytes_as_string_view() == other.m_utf8_string->bytes_as_string_view();
     if (m_utf16_string.has_value() && other.m_utf16_string.has_value())
@@ -256,6 +310,15 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     rope_string.resolve(preference);
 }
 
+void PrimitiveString::resolve_slice_if_needed() const
+{
+    if (!m_is_slice)
+        return;
+
+    auto const& slice_string = static_cast<SliceString const&>(*this);
+    slice_string.resolve();
+}
+
 void RopeString::resolve(EncodingPreference preference) const
 {
 
@@ -292,7 +355,7 @@ void RopeString::resolve(EncodingPreference preference) const
         StringBuilder builder(StringBuilder::Mode::UTF16, length_in_utf16_code_units);
 
         for (auto const* current : pieces) {
-            if (current->has_utf16_string())
+            if (current->has_utf16_string() || current->m_is_slice)
                 builder.append(current->utf16_string_view());
             else
                 builder.append(current->utf8_string_view());
@@ -389,4 +452,26 @@ void RopeString::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_rhs);
 }
 
+SliceString::SliceString(GC::Ref<PrimitiveString> underlying_string, size_t start, size_t length)
+    : PrimitiveString(SliceTag::Slice)
+    , m_underlying_string(underlying_string)
+    , m_start(start)
+    , m_length(length)
+{
+}
+
+SliceString::~SliceString() = default;
+
+void SliceString::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_underlying_string);
+}
+
+void SliceString::resolve() const
+{
+    m_utf16_string = Utf16String::from_utf16(view());
+    m_is_slice = false;
+}
+
 }
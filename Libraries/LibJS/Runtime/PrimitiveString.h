@@ -37,6 +37,9 @@ public:
 
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, PrimitiveString&, PrimitiveString&);
 
+    // Creates a string with the given range of UTF-16 code units of another string, sharing its storage where possible.
+    [[nodiscard]] static GC::Ref<PrimitiveString> create_substring(VM&, PrimitiveString&, size_t start, size_t length);
+
     [[nodiscard]] static GC::Ref<PrimitiveString> create_from_unsigned_integer(VM&, u64);
 
     virtual ~PrimitiveString() override;
@@ -47,6 +50,7 @@ public:
     bool is_empty() const;
 
     [[nodiscard]] String utf8_string() const;
+    [[nodiscard]] FlyString utf8_fly_string() const;
     [[nodiscard]] StringView utf8_string_view() const;
     bool has_utf8_string() const { return m_utf8_string.has_value(); }
 
@@ -67,7 +71,14 @@ protected:
     {
     }
 
+    enum class SliceTag { Slice };
+    explicit PrimitiveString(SliceTag)
+        : m_is_slice(true)
+    {
+    }
+
     mutable bool m_is_rope { false };
+    mutable bool m_is_slice { false };
 
     mutable Optional<String> m_utf8_string;
     mutable Optional<Utf16String> m_utf16_string;
@@ -79,6 +90,7 @@ protected:
 
 private:
     friend class RopeString;
+    friend class SliceString;
 
     virtual void finalize() override;
 
@@ -86,6 +98,7 @@ private:
     explicit PrimitiveString(String);
 
     void resolve_rope_if_needed(EncodingPreference) const;
+    void resolve_slice_if_needed() const;
 };
 
 class RopeString final : public PrimitiveString {
@@ -108,4 +121,28 @@ private:
     mutable GC::Ptr<PrimitiveString> m_rhs;
 };
 
+class SliceString final : public PrimitiveString {
+    GC_CELL(SliceString, PrimitiveString);
+    GC_DECLARE_ALLOCATOR(SliceString);
+
+public:
+    virtual ~SliceString() override;
+
+private:
+    friend class PrimitiveString;
+
+    explicit SliceString(GC::Ref<PrimitiveString> underlying_string, size_t start, size_t length);
+
+    virtual void visit_edges(Visitor&) override;
+
+    Utf16View view() const { return m_underlying_string->utf16_string_view().substring_view(m_start, m_length); }
+    void resolve() const;
+
+    // NOTE: The underlying string is always a flat string with a UTF-16 representation. We hold on to it even after
+    //       the slice has been resolved, since views handed out earlier may still point into its storage.
+    GC::Ref<PrimitiveString> m_underlying_string;
+    size_t m_start { 0 };
+    size_t m_length { 0 };
+};
+
 }
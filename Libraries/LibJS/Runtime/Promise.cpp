@@ -324,6 +324,16 @@ Value Promise::perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<Promi
     // 8. Let rejectReaction be the PromiseReaction { [[Capability]]: resultCapability, [[Type]]: Reject, [[Handler]]: onRejectedJobCallback }.
     auto reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, result_capability, move(on_rejected_job_callback));
 
+    return perform_then(fulfill_reaction, reject_reaction, result_capability);
+}
+
+// 27.2.5.4.1 PerformPromiseThen ( promise, onFulfilled, onRejected [ , resultCapability ] ), https://tc39.es/ecma262/#sec-performpromisethen
+// NOTE: This performs steps 9-14 with already created reactions, which lets callers that repeatedly attach the same
+//       handlers (like Await) create their reactions once and reuse them.
+Value Promise::perform_then(GC::Ref<PromiseReaction> fulfill_reaction, GC::Ref<PromiseReaction> reject_reaction, GC::Ptr<PromiseCapability> result_capability)
+{
+    auto& vm = this->vm();
+
     switch (m_state) {
     // 9. If promise.[[PromiseState]] is pending, then
     case Promise::State::Pending:
@@ -45,6 +45,7 @@ public:
     void fulfill(Value value);
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<PromiseCapability> result_capability);
+    Value perform_then(GC::Ref<PromiseReaction> fulfill_reaction, GC::Ref<PromiseReaction> reject_reaction, GC::Ptr<PromiseCapability> result_capability);
 
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
@@ -56,6 +56,7 @@ private:
     virtual bool is_function() const override { return m_target->is_function(); }
     virtual bool is_proxy_object() const final { return true; }
     virtual bool eligible_for_own_property_enumeration_fast_path() const override final { return false; }
+    virtual bool has_exotic_internal_get() const override final { return true; }
 
     virtual ThrowCompletionOr<void> get_stack_frame_size(size_t& registers_and_locals_count, size_t& constants_count, size_t& argument_count) override;
 
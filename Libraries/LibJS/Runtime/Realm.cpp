@@ -99,6 +99,8 @@ void Realm::visit_edges(Visitor& visitor)
     visitor.visit(m_intrinsics);
     visitor.visit(m_global_object);
     visitor.visit(m_global_environment);
+    for (auto& record : m_template_map)
+        visitor.visit(record.array);
     if (m_host_defined)
         m_host_defined->visit_edges(visitor);
 }
@@ -13,6 +13,7 @@
 #include <AK/Weakable.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
+#include <LibGC/Weak.h>
 #include <LibJS/Bytecode/Builtins.h>
 #include <LibJS/Export.h>
 #include <LibJS/Heap/Cell.h>
@@ -68,6 +69,14 @@ public:
 
     void set_host_defined(OwnPtr<HostDefined> host_defined) { m_host_defined = move(host_defined); }
 
+    // NOTE: The template literal's "site" is identified by the executable and template object cache index it was compiled to.
+    struct TemplateRecord {
+        GC::Weak<Bytecode::Executable> site_executable; // [[Site]]
+        u32 site_cache_index { 0 };                     // [[Site]]
+        GC::Ref<Array> array;                           // [[Array]]
+    };
+    Vector<TemplateRecord>& template_map() { return m_template_map; }
+
 private:
     Realm() = default;
 
@@ -77,6 +86,7 @@ private:
     GC::Ptr<Object> m_global_object;                 // [[GlobalObject]]
     GC::Ptr<GlobalEnvironment> m_global_environment; // [[GlobalEnv]]
     OwnPtr<HostDefined> m_host_defined;              // [[HostDefined]]
+    Vector<TemplateRecord> m_template_map;           // [[TemplateMap]]
 };
 
 }
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration interval)
+    : m_vm(vm)
+    , m_interval(interval)
+{
+    m_nodes.append({});
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    if (is_running())
+        return;
+
+    VERIFY(!m_vm.sampling_profiler());
+    m_vm.set_sampling_profiler(this);
+
+    if (m_samples.is_empty())
+        m_start_time = MonotonicTime::now();
+    m_should_stop = false;
+
+    m_thread = Threading::Thread::construct("JS Profiler"sv, [this] {
+        Threading::MutexLocker locker { m_mutex };
+        while (!m_should_stop) {
+            if (!m_condition.wait_until(UnixDateTime::now() + m_interval))
+                m_vm.request_profiler_sample();
+        }
+        return static_cast<intptr_t>(0);
+    });
+    m_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    {
+        Threading::MutexLocker locker { m_mutex };
+        m_should_stop = true;
+        m_condition.signal();
+    }
+    (void)m_thread->join();
+    m_thread = nullptr;
+
+    m_vm.set_sampling_profiler(nullptr);
+    m_end_time = MonotonicTime::now();
+}
+
+size_t SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    void const* key = context.executable ? static_cast<void const*>(context.executable.ptr()) : context.function.ptr();
+    if (auto index = m_frame_indices.get(key); index.has_value())
+        return *index;
+
+    Frame frame;
+    if (context.function)
+        frame.function_name = context.function->name_for_call_stack();
+    else if (context.executable)
+        frame.function_name = context.executable->name.to_utf16_string();
+
+    if (context.executable)
+        frame.executable = GC::make_root(*context.executable);
+    else if (context.function)
+        frame.native_function = GC::make_root(*context.function);
+
+    m_frames.append(move(frame));
+    m_frame_indices.set(key, m_frames.size() - 1);
+    return m_frames.size() - 1;
+}
+
+size_t SamplingProfiler::child_node_for(size_t parent_index, size_t frame_index)
+{
+    for (auto child_index : m_nodes[parent_index].children) {
+        if (m_nodes[child_index].frame_index == frame_index)
+            return child_index;
+    }
+
+    m_nodes.append({ .frame_index = frame_index });
+    auto child_index = m_nodes.size() - 1;
+    m_nodes[parent_index].children.append(child_index);
+    return child_index;
+}
+
+void SamplingProfiler::take_sample()
+{
+    size_t node_index = 0;
+    for (auto const* context : m_vm.execution_context_stack())
+        node_index = child_node_for(node_index, frame_index_for(*context));
+
+    auto& node = m_nodes[node_index];
+    ++node.hit_count;
+    if (!m_vm.execution_context_stack().is_empty()) {
+        auto program_counter = m_vm.running_execution_context().program_counter;
+        node.hits_by_program_counter.ensure(program_counter, [] { return 0; })++;
+    }
+
+    m_samples.append({ node_index, MonotonicTime::now() });
+}
+
+// https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+JsonObject SamplingProfiler::to_cpu_profile() const
+{
+    HashMap<String, size_t> script_ids;
+
+    auto source_range_at = [](Bytecode::Executable const& executable, u32 program_counter) -> Optional<SourceRange> {
+        auto source_range = executable.source_range_at(program_counter);
+        if (!source_range.source_code)
+            return {};
+        return source_range.realize();
+    };
+
+    JsonArray nodes;
+    for (size_t node_index = 0; node_index < m_nodes.size(); ++node_index) {
+        auto const& node = m_nodes[node_index];
+
+        // NB: Profile positions are 0-based, while ours start at 1.
+        String function_name = "(root)"_string;
+        String url;
+        i64 line_number = -1;
+        i64 column_number = -1;
+        size_t script_id = 0;
+
+        Bytecode::Executable const* executable = nullptr;
+        if (node.frame_index.has_value()) {
+            auto const& frame = m_frames[*node.frame_index];
+            executable = frame.executable.ptr();
+            function_name = frame.function_name.to_utf8();
+
+            if (executable) {
+                url = executable->source_code->filename();
+                script_id = script_ids.ensure(url, [&] { return script_ids.size() + 1; });
+                if (auto source_range = source_range_at(*executable, 0); source_range.has_value()) {
+                    line_number = static_cast<i64>(source_range->start.line) - 1;
+                    column_number = static_cast<i64>(source_range->start.column) - 1;
+                }
+            }
+        }
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, move(function_name));
+        call_frame.set("scriptId"sv, String::number(script_id));
+        call_frame.set("url"sv, move(url));
+        call_frame.set("lineNumber"sv, line_number);
+        call_frame.set("columnNumber"sv, column_number);
+
+        JsonObject json_node;
+        json_node.set("id"sv, node_index + 1);
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, node.hit_count);
+
+        if (!node.children.is_empty()) {
+            JsonArray children;
+            for (auto child_index : node.children)
+                children.must_append(child_index + 1);
+            json_node.set("children"sv, move(children));
+        }
+
+        if (executable && !node.hits_by_program_counter.is_empty()) {
+            HashMap<u32, u32> hits_by_line;
+            for (auto const& [program_counter, hits] : node.hits_by_program_counter) {
+                if (auto source_range = source_range_at(*executable, program_counter); source_range.has_value())
+                    hits_by_line.ensure(source_range->start.line, [] { return 0; }) += hits;
+            }
+
+            JsonArray position_ticks;
+            for (auto const& [line, hits] : hits_by_line) {
+                JsonObject position_tick;
+                position_tick.set("line"sv, line);
+                position_tick.set("ticks"sv, hits);
+                position_ticks.must_append(move(position_tick));
+            }
+            json_node.set("positionTicks"sv, move(position_ticks));
+        }
+
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node_index + 1);
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    auto end_time = is_running() ? MonotonicTime::now() : m_end_time;
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, end_time.nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+}
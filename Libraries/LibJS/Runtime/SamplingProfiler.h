@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Time.h>
+#include <AK/Utf16String.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Forward.h>
+#include <LibThreading/Mutex.h>
+
+namespace JS {
+
+// Periodically samples the JS call stack of a VM. A timer thread only requests the samples, and the interpreter takes
+// them at its next safepoint (on function entry or on a loop back edge), where the execution context stack is always
+// consistent and it's safe to inspect it.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    explicit SamplingProfiler(VM&, AK::Duration interval = AK::Duration::from_milliseconds(1));
+    ~SamplingProfiler();
+
+    void start();
+    void stop();
+    bool is_running() const { return m_thread; }
+
+    // Called by the VM at a safepoint after a sample was requested.
+    void take_sample();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // Returns the collected samples in the .cpuprofile format, which Chrome's DevTools and most profile viewers load.
+    JsonObject to_cpu_profile() const;
+
+private:
+    struct Frame {
+        Utf16String function_name;
+
+        // NB: Frames are looked up by the address of their executable or native function, so these keep them alive
+        //     until the profile is discarded, to make sure that address is never reused for different code.
+        GC::Root<Bytecode::Executable> executable;
+        GC::Root<FunctionObject> native_function;
+    };
+
+    struct Node {
+        Optional<size_t> frame_index;
+        Vector<size_t> children;
+        u32 hit_count { 0 };
+
+        // Hits while this node was at the top of the stack, by bytecode offset. These are mapped to source lines only
+        // when the profile is exported.
+        HashMap<u32, u32> hits_by_program_counter;
+    };
+
+    struct Sample {
+        size_t node_index;
+        MonotonicTime time;
+    };
+
+    size_t frame_index_for(ExecutionContext const&);
+    size_t child_node_for(size_t parent_index, size_t frame_index);
+
+    VM& m_vm;
+    AK::Duration m_interval;
+
+    Vector<Frame> m_frames;
+    HashMap<void const*, size_t> m_frame_indices;
+
+    // The first node is the root, which doesn't correspond to any frame.
+    Vector<Node> m_nodes;
+
+    Vector<Sample> m_samples;
+    MonotonicTime m_start_time { MonotonicTime::now() };
+    MonotonicTime m_end_time { MonotonicTime::now() };
+
+    RefPtr<Threading::Thread> m_thread;
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    bool m_should_stop { false };
+};
+
+}
@@ -32,8 +32,7 @@ GC::Ref<Set> Set::copy() const
 {
     auto& vm = this->vm();
     auto& realm = *vm.current_realm();
-    // FIXME: This is very inefficient, but there's no better way to do this at the moment, as the underlying Map
-    //  implementation of m_values uses a non-copyable RedBlackTree.
+    // NOTE: Copying entry by entry leaves out any holes left behind by removed entries in the underlying Map.
     auto result = Set::create(realm);
     for (auto const& entry : *this)
         result->set_add(entry.key);
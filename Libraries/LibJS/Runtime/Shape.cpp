@@ -267,6 +267,10 @@ void Shape::ensure_property_table() const
 
 GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
 {
+    // OPTIMIZATION: Deleting the most recently added property leaves exactly the layout of the shape we came from.
+    if (is_put_transition_for(property_key))
+        return *m_previous;
+
     if (auto existing_shape = get_or_prune_cached_delete_transition(property_key))
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, TransitionType::Delete);
@@ -277,6 +281,11 @@ GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
     return new_shape;
 }
 
+bool Shape::is_put_transition_for(PropertyKey const& property_key) const
+{
+    return m_transition_type == TransitionType::Put && m_previous && !m_is_prototype_shape && m_property_key.has_value() && *m_property_key == property_key;
+}
+
 void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
 {
     invalidate_prototype_if_needed_for_change_without_transition();
@@ -288,6 +297,13 @@ void Shape::add_property_without_transition(PropertyKey const& property_key, Pro
     }
 }
 
+void Shape::ensure_property_table_capacity(size_t capacity)
+{
+    VERIFY(is_dictionary());
+    ensure_property_table();
+    m_property_table->ensure_capacity(capacity);
+}
+
 void Shape::set_property_attributes_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
 {
     invalidate_prototype_if_needed_for_change_without_transition();
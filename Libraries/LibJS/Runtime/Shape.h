@@ -84,9 +84,13 @@ public:
 
     void remove_property_without_transition(PropertyKey const&, u32 offset);
     void set_property_attributes_without_transition(PropertyKey const&, PropertyAttributes);
+    void ensure_property_table_capacity(size_t);
 
     [[nodiscard]] bool is_dictionary() const { return m_dictionary; }
 
+    // Returns true if this shape was reached by adding the given property to the previous shape.
+    [[nodiscard]] bool is_put_transition_for(PropertyKey const&) const;
+
     [[nodiscard]] u32 dictionary_generation() const { return m_dictionary_generation; }
 
     [[nodiscard]] bool is_prototype_shape() const { return m_is_prototype_shape; }
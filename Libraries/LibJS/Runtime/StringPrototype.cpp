@@ -82,17 +82,11 @@ Optional<size_t> string_index_of(Utf16View const& string, Utf16View const& searc
         return {};
 
     // 4. For each integer i such that fromIndex ≤ i ≤ len - searchLen, in ascending order, do
-    for (size_t i = from_index; i <= string_length - search_length; ++i) {
-        // a. Let candidate be the substring of string from i to i + searchLen.
-        auto candidate = string.substring_view(i, search_length);
-
-        // b. If candidate is searchValue, return i.
-        if (candidate == search_value)
-            return i;
-    }
-
+    //     a. Let candidate be the substring of string from i to i + searchLen.
+    //     b. If candidate is searchValue, return i.
     // 5. Return -1.
-    return {};
+    // OPTIMIZATION: Utf16View's search skips ahead to candidates starting with the first code unit of searchValue.
+    return string.find_code_unit_offset(search_value, from_index);
 }
 
 // 6.1.4.2 StringLastIndexOf ( string, searchValue, fromIndex ),
@@ -1147,7 +1141,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::slice)
         return PrimitiveString::create(vm, String {});
 
     // 13. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create_substring(vm, string, int_start, int_end - int_start);
 }
 
 // 22.1.3.23 String.prototype.split ( separator, limit ), https://tc39.es/ecma262/#sec-string.prototype.split
@@ -1232,10 +1226,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
             ++position;
             continue;
         }
-        auto segment = string->utf16_string_view().substring_view(start, position - start);
+        auto segment = PrimitiveString::create_substring(vm, string, start, position - start);
 
         // b. Append T to substrings.
-        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, segment)));
+        MUST(array->create_data_property_or_throw(array_length, segment));
         ++array_length;
 
         // c. If the number of elements in substrings is lim, return CreateArrayFromList(substrings).
@@ -1250,10 +1244,10 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
     }
 
     // 15. Let T be the substring of S from i.
-    auto rest = string->utf16_string_view().substring_view(start);
+    auto rest = PrimitiveString::create_substring(vm, string, start, string_length - start);
 
     // 16. Append T to substrings.
-    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, rest)));
+    MUST(array->create_data_property_or_throw(array_length, rest));
 
     // 17. Return CreateArrayFromList(substrings).
     return array;
@@ -1345,7 +1339,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substring)
     size_t to = max(final_start, final_end);
 
     // 10. Return the substring of S from from to to.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(from, to - from));
+    return PrimitiveString::create_substring(vm, string, from, to - from);
 }
 
 enum class TargetCase {
@@ -1588,7 +1582,7 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::substr)
         return PrimitiveString::create(vm, String {});
 
     // 11. Return the substring of S from intStart to intEnd.
-    return PrimitiveString::create(vm, string->utf16_string_view().substring_view(int_start, int_end - int_start));
+    return PrimitiveString::create_substring(vm, string, int_start, int_end - int_start);
 }
 
 // B.2.2.2.1 CreateHTML ( string, tag, attribute, value ), https://tc39.es/ecma262/#sec-createhtml
@@ -86,6 +86,7 @@ private:
     virtual bool is_typed_array_base() const final { return true; }
     virtual void visit_edges(Visitor&) override;
     virtual bool eligible_for_own_property_enumeration_fast_path() const final override { return false; }
+    virtual bool has_exotic_internal_get() const final override { return true; }
 };
 
 template<>
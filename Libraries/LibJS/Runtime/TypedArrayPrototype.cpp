@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -14,6 +15,8 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/TypedArrayPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <math.h>
+#include <string.h>
 
 namespace JS {
 
@@ -475,6 +478,108 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
+enum class NaNMatchesNaN {
+    No,
+    Yes,
+};
+
+// OPTIMIZATION: Searching a number TypedArray for a number can compare the needle against the elements in the buffer
+//               directly, instead of reading every element into a Value first. Returns false if the caller has to
+//               fall back to the generic search, which is the case if the TypedArray shrank below end.
+template<typename T>
+static bool fast_typed_array_index_of(TypedArrayBase& typed_array, u32 begin, u32 end, Value needle, NaNMatchesNaN nan_matches_nan, Optional<u32>& found_index)
+{
+    using ElementType = typename TypedArray<T>::UnderlyingBufferDataType;
+
+    auto data = static_cast<TypedArray<T>&>(typed_array).data();
+    if (data.size() < end)
+        return false;
+
+    found_index = {};
+
+    // NB: Every element is a Number, which never equals a needle of any other type.
+    if (!needle.is_number())
+        return true;
+
+    auto number = needle.as_double();
+
+    if constexpr (IsFloatingPoint<ElementType>) {
+        if (isnan(number)) {
+            if (nan_matches_nan == NaNMatchesNaN::No)
+                return true;
+            // NB: Only NaN compares unequal to itself. This also works for f16, which isnan() doesn't take.
+            for (auto i = begin; i < end; ++i) {
+                if (data[i] != data[i]) {
+                    found_index = i;
+                    return true;
+                }
+            }
+            return true;
+        }
+    }
+
+    // NB: An element can only equal the needle if the needle is representable in the element type. Note that -0 and
+    //     +0 are equal both under IsStrictlyEqual and SameValueZero, and so they are here.
+    ElementType element;
+    if constexpr (IsFloatingPoint<ElementType>) {
+        element = static_cast<ElementType>(number);
+        if (static_cast<double>(element) != number)
+            return true;
+    } else {
+        if (isnan(number) || number < NumericLimits<ElementType>::min() || number > NumericLimits<ElementType>::max() || trunc(number) != number)
+            return true;
+        element = static_cast<ElementType>(number);
+    }
+
+    if constexpr (sizeof(ElementType) == 1) {
+        if (begin >= end)
+            return true;
+        auto const* match = static_cast<ElementType const*>(memchr(data.offset_pointer(begin), static_cast<u8>(element), end - begin));
+        if (match)
+            found_index = static_cast<u32>(match - data.data());
+        return true;
+    }
+
+    for (auto i = begin; i < end; ++i) {
+        if (data[i] == element) {
+            found_index = i;
+            return true;
+        }
+    }
+    return true;
+}
+
+static bool fast_typed_array_index_of(TypedArrayBase& typed_array, u32 begin, u32 end, Value needle, NaNMatchesNaN nan_matches_nan, Optional<u32>& found_index)
+{
+    switch (typed_array.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+        return fast_typed_array_index_of<u8>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        return fast_typed_array_index_of<ClampedU8>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Uint16Array:
+        return fast_typed_array_index_of<u16>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Uint32Array:
+        return fast_typed_array_index_of<u32>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Int8Array:
+        return fast_typed_array_index_of<i8>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Int16Array:
+        return fast_typed_array_index_of<i16>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Int32Array:
+        return fast_typed_array_index_of<i32>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Float16Array:
+        return fast_typed_array_index_of<f16>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Float32Array:
+        return fast_typed_array_index_of<float>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::Float64Array:
+        return fast_typed_array_index_of<double>(typed_array, begin, end, needle, nan_matches_nan, found_index);
+    case TypedArrayBase::Kind::BigInt64Array:
+    case TypedArrayBase::Kind::BigUint64Array:
+        // NB: BigInt elements are compared as BigInts, which the generic search takes care of.
+        return false;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // NOTE: This function assumes that the index is valid within the TypedArray,
 //       and that the TypedArray is not detached.
 template<typename T>
@@ -923,6 +1028,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    if (Optional<u32> found_index; fast_typed_array_index_of(*typed_array, k, length, search_element, NaNMatchesNaN::Yes, found_index))
+        return Value { found_index.has_value() };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -992,6 +1100,9 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    if (Optional<u32> found_index; fast_typed_array_index_of(*typed_array, k, length, search_element, NaNMatchesNaN::No, found_index))
+        return found_index.has_value() ? Value { *found_index } : Value { -1 };
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1356,6 +1467,20 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
     // 3. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Reversing the elements in the buffer preserves their bit-level encoding, just like getting and setting
+    //               them does, so we can skip converting every element to a Value and back.
+    switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)            \
+    case TypedArrayBase::Kind::ClassName:                                                      \
+        if (auto data = static_cast<ClassName&>(*typed_array).data(); data.size() == length) { \
+            data.reverse();                                                                    \
+            return typed_array;                                                                \
+        }                                                                                      \
+        break;
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+
     // 4. Let middle be floor(len / 2).
     auto middle = length / 2;
 
@@ -1831,6 +1956,31 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// OPTIMIZATION: Without a comparefn, CompareTypedArrayElements is a total order on Numbers (NaN last, -0 before +0)
+//     under which equal elements are indistinguishable. The sort therefore doesn't have to be stable, and can run on
+//     the raw doubles instead of calling through SortCompare for every comparison.
+static Vector<double> sorted_numbers_of_typed_array(TypedArrayBase const& typed_array, size_t length)
+{
+    VERIFY(typed_array.content_type() == TypedArrayBase::ContentType::Number);
+
+    Vector<double> values;
+    values.ensure_capacity(length);
+    for (size_t k = 0; k < length; ++k)
+        values.unchecked_append(MUST(typed_array.get(k)).as_double());
+
+    if (values.size() > 1) {
+        quick_sort(values, [](double x, double y) {
+            if (isnan(y))
+                return !isnan(x);
+            if (x < y)
+                return true;
+            return x == 0 && y == 0 && signbit(x) && !signbit(y);
+        });
+    }
+
+    return values;
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1849,6 +1999,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    if (compare_function.is_undefined() && typed_array->content_type() == TypedArrayBase::ContentType::Number) {
+        auto sorted_values = sorted_numbers_of_typed_array(*typed_array, length);
+        for (size_t j = 0; j < length; ++j)
+            MUST(typed_array->set(j, Value(sorted_values[j]), Object::ShouldThrowExceptions::Yes));
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2087,6 +2244,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    if (compare_function.is_undefined() && typed_array->content_type() == TypedArrayBase::ContentType::Number) {
+        auto sorted_values = sorted_numbers_of_typed_array(*typed_array, length);
+        for (size_t j = 0; j < length; ++j)
+            MUST(array->set(j, Value(sorted_values[j]), Object::ShouldThrowExceptions::Yes));
+        return array;
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -15,6 +15,7 @@
 #include <AK/Time.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
+#include <LibJS/ParseTreeCache.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -29,6 +30,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -79,6 +81,8 @@ VM::VM(ErrorMessages error_messages)
 {
     s_the = this;
     m_bytecode_interpreter = make<Bytecode::Interpreter>();
+    m_megamorphic_property_lookup_cache = make<Bytecode::MegamorphicPropertyLookupCache>();
+    m_parse_tree_cache = make<ParseTreeCache>();
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
@@ -810,6 +814,13 @@ static GC::Ptr<CachedSourceRange> get_source_range(ExecutionContext* context)
     return context->rare_data()->cached_source_range;
 }
 
+void VM::take_profiler_sample()
+{
+    m_profiler_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    if (m_sampling_profiler)
+        m_sampling_profiler->take_sample();
+}
+
 GC::ConservativeVector<StackTraceElement> VM::stack_trace() const
 {
     GC::ConservativeVector<StackTraceElement> stack_trace(heap());
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -63,6 +64,9 @@ public:
     GC::Heap& heap() const { return const_cast<GC::Heap&>(m_heap); }
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
+    Bytecode::MegamorphicPropertyLookupCache& megamorphic_property_lookup_cache() { return *m_megamorphic_property_lookup_cache; }
+
+    ParseTreeCache& parse_tree_cache() { return *m_parse_tree_cache; }
 
     void dump_backtrace() const;
 
@@ -283,6 +287,14 @@ public:
 
     void set_dynamic_imports_allowed(bool value) { m_dynamic_imports_allowed = value; }
 
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler; }
+    void set_sampling_profiler(SamplingProfiler* profiler) { m_sampling_profiler = profiler; }
+
+    // Set from the sampling profiler's timer thread. The interpreter checks this at its safepoints and takes the sample.
+    bool is_profiler_sample_requested() const { return m_profiler_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void request_profiler_sample() { m_profiler_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed); }
+    void take_profiler_sample();
+
     Function<void(Promise&, Promise::RejectionOperation)> host_promise_rejection_tracker;
     Function<ThrowCompletionOr<Value>(JobCallback&, Value, ReadonlySpan<Value>)> host_call_job_callback;
     Function<void(FinalizationRegistry&)> host_enqueue_finalization_registry_cleanup_job;
@@ -364,8 +376,14 @@ private:
     OwnPtr<Agent> m_agent;
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
+    OwnPtr<Bytecode::MegamorphicPropertyLookupCache> m_megamorphic_property_lookup_cache;
+
+    OwnPtr<ParseTreeCache> m_parse_tree_cache;
 
     bool m_dynamic_imports_allowed { false };
+
+    SamplingProfiler* m_sampling_profiler { nullptr };
+    Atomic<bool> m_profiler_sample_requested { false };
 };
 
 template<typename GlobalObjectType, typename... Args>
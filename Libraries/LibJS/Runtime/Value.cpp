@@ -104,6 +104,18 @@ void number_to_string(StringBuilder& builder, double d, NumberToStringMode mode)
         return;
     }
 
+    // OPTIMIZATION: Integral numbers in the safe integer range have at most 16 digits and no trailing zeros to drop,
+    //               so their shortest round-trip representation is just their decimal digits.
+    if (auto magnitude = fabs(d); magnitude <= MAX_ARRAY_LIKE_INDEX && trunc(magnitude) == magnitude) {
+        AK::Array<char, 20> digits;
+        i32 length = 0;
+        convert_to_decimal_digits_array(static_cast<u64>(magnitude), digits, length);
+        if (d < 0)
+            builder.append('-');
+        builder.append(digits.data(), length);
+        return;
+    }
+
     // 5. Let n, k, and s be integers such that k ≥ 1, radix ^ (k - 1) ≤ s < radix ^ k,
     // 𝔽(s × radix ^ (n - k)) is x, and k is as small as possible. Note that k is the number of
     // digits in the representation of s using radix radix, that s is not divisible by radix, and
@@ -744,6 +756,15 @@ static Optional<NumberParseResult> parse_number_text(StringView text)
 // 7.1.4.1.1 StringToNumber ( str ), https://tc39.es/ecma262/#sec-stringtonumber
 double string_to_number(StringView string)
 {
+    // OPTIMIZATION: Short strings of ASCII digits, like array indices or numbers from attributes and JSON, are the most
+    //               common input by far, and can be converted without any trimming or general-purpose parsing.
+    if (!string.is_empty() && string.length() <= 15 && all_of(string, is_ascii_digit)) {
+        u64 value = 0;
+        for (auto digit : string)
+            value = value * 10 + parse_ascii_digit(digit);
+        return static_cast<double>(value);
+    }
+
     // 1. Let text be StringToCodePoints(str).
     auto text = Utf8View(string).trim(whitespace_characters, AK::TrimMode::Both).as_string();
 
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/WaiterLists.h>
+#include <LibThreading/ConditionVariable.h>
+
+namespace JS {
+
+// 25.4.3.2 Waiter Record, https://tc39.es/ecma262/#sec-waiter-record
+struct WaiterLists::WaiterRecord {
+    explicit WaiterRecord(Threading::Mutex& critical_section)
+        : condition(critical_section)
+    {
+    }
+
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+WaiterLists& WaiterLists::the()
+{
+    static WaiterLists waiter_lists;
+    return waiter_lists;
+}
+
+WaiterLists::WaitResult WaiterLists::add_waiter_and_suspend(void const* waiter_list, Optional<UnixDateTime> timeout_time)
+{
+    WaiterRecord waiter_record { m_critical_section };
+
+    // 25.4.3.8 AddWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-addwaiter
+    m_lists.ensure(waiter_list).append(&waiter_record);
+
+    // 25.4.3.11 SuspendThisAgent ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-suspendthisagent
+    // 7. Perform LeaveCriticalSection(WL) and suspend the surrounding agent until the time is waiterRecord.[[TimeoutTime]],
+    //    performing the combined operation in such a way that a notification that arrives after the critical section is
+    //    exited but before the suspension takes effect is not lost. The surrounding agent can only wake from suspension
+    //    due to a timeout or due to another agent calling NotifyWaiter with arguments WL and thisAgent.
+    // 8. Perform EnterCriticalSection(WL).
+    // NOTE: Waiting on the condition variable atomically releases and reacquires the critical section. We loop to
+    //       guard against spurious wakeups.
+    while (!waiter_record.notified) {
+        if (!timeout_time.has_value()) {
+            waiter_record.condition.wait();
+            continue;
+        }
+        if (!waiter_record.condition.wait_until(*timeout_time))
+            break;
+    }
+
+    // NOTE: A notification removes the waiter from its list. If we timed out instead, we are still on it.
+    if (waiter_record.notified)
+        return WaitResult::Ok;
+
+    auto& waiters = m_lists.find(waiter_list)->value;
+    waiters.remove_first_matching([&](auto* waiter) { return waiter == &waiter_record; });
+    if (waiters.is_empty())
+        m_lists.remove(waiter_list);
+    return WaitResult::TimedOut;
+}
+
+size_t WaiterLists::notify_waiters(void const* waiter_list, size_t count)
+{
+    auto it = m_lists.find(waiter_list);
+    if (it == m_lists.end())
+        return 0;
+    auto& waiters = it->value;
+
+    // 25.4.3.10 RemoveWaiters ( WL, c ), https://tc39.es/ecma262/#sec-removewaiters
+    auto waiters_to_notify = min(count, waiters.size());
+
+    // 25.4.3.12 NotifyWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-notifywaiter
+    for (size_t i = 0; i < waiters_to_notify; ++i) {
+        waiters[i]->notified = true;
+        waiters[i]->condition.signal();
+    }
+
+    waiters.remove(0, waiters_to_notify);
+    if (waiters.is_empty())
+        m_lists.remove(it);
+    return waiters_to_notify;
+}
+
+size_t WaiterLists::waiter_count(void const* waiter_list) const
+{
+    auto waiters = m_lists.get(waiter_list);
+    return waiters.has_value() ? waiters->size() : 0;
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibThreading/Mutex.h>
+
+namespace JS {
+
+// 25.4.3.1 WaiterList Records, https://tc39.es/ecma262/#sec-waiterlist-records
+// The waiter lists behind Atomics.wait() and Atomics.notify(). A WaiterList is identified by the address of the element
+// being waited on, and a single critical section guards all of them, which the spec allows.
+// NB: Waiters can only be notified by agents in the same process. Every agent currently runs in a process of its own, and
+//     a SharedArrayBuffer posted to another agent is copied rather than mapped into it (see StructuredSerialize.cpp), so
+//     for now no other agent is able to wake a waiting agent.
+class JS_API WaiterLists {
+    AK_MAKE_NONCOPYABLE(WaiterLists);
+    AK_MAKE_NONMOVABLE(WaiterLists);
+
+public:
+    static WaiterLists& the();
+
+    // 25.4.3.6 EnterCriticalSection ( WL ), https://tc39.es/ecma262/#sec-entercriticalsection
+    // 25.4.3.7 LeaveCriticalSection ( WL ), https://tc39.es/ecma262/#sec-leavecriticalsection
+    Threading::Mutex& critical_section() { return m_critical_section; }
+
+    enum class WaitResult {
+        Ok,
+        TimedOut,
+    };
+
+    // Performs AddWaiter(WL, waiterRecord) and SuspendThisAgent(WL, waiterRecord). Must be called in the critical
+    // section, which is left while the calling thread is suspended and entered again before this returns.
+    WaitResult add_waiter_and_suspend(void const* waiter_list, Optional<UnixDateTime> timeout_time);
+
+    // Performs RemoveWaiters(WL, count) and NotifyWaiter(WL, W) for each removed waiter, and returns how many waiters were
+    // notified. Must be called in the critical section.
+    size_t notify_waiters(void const* waiter_list, size_t count);
+
+    // Must be called in the critical section.
+    size_t waiter_count(void const* waiter_list) const;
+
+private:
+    WaiterLists() = default;
+
+    struct WaiterRecord;
+
+    Threading::Mutex m_critical_section;
+    HashMap<void const*, Vector<WaiterRecord*>> m_lists;
+};
+
+}
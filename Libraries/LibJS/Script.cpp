@@ -6,6 +6,7 @@
 
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
+#include <LibJS/ParseTreeCache.h>
 #include <LibJS/Parser.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
@@ -15,15 +16,53 @@ namespace JS {
 GC_DEFINE_ALLOCATOR(Script);
 
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
-Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
+Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset, UseParseTreeCache use_parse_tree_cache)
 {
+    auto source_code = Utf16String::from_utf8(source_text);
+
+    // OPTIMIZATION: If we've parsed this exact script before, reuse its parse tree (and any bytecode generated for it).
+    if (use_parse_tree_cache == UseParseTreeCache::Yes) {
+        if (auto program = realm.vm().parse_tree_cache().find(filename, source_code, line_number_offset))
+            return realm.heap().allocate<Script>(realm, filename, program.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
-    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text)), line_number_offset));
-    auto script = parser.parse_program();
+    auto script = parse_text(move(source_code), filename, line_number_offset);
 
     // 2. If script is a List of errors, return body.
+    if (script.is_error())
+        return script.release_error();
+
+    if (use_parse_tree_cache == UseParseTreeCache::Yes)
+        realm.vm().parse_tree_cache().add(filename, line_number_offset, script.value());
+
+    // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
+    return realm.heap().allocate<Script>(realm, filename, script.release_value(), host_defined);
+}
+
+Script::ParsedText Script::parse_text(Utf16String source_text, StringView filename, size_t line_number_offset)
+{
+    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), move(source_text)), line_number_offset));
+    auto script = parser.parse_program();
     if (parser.has_errors())
         return parser.errors();
+    return script;
+}
+
+Result<GC::Ref<Script>, Vector<ParserError>> Script::create_from_parsed_text(ParsedText parsed_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset, UseParseTreeCache use_parse_tree_cache)
+{
+    // 2. If script is a List of errors, return body.
+    if (parsed_text.is_error())
+        return parsed_text.release_error();
+    auto script = parsed_text.release_value();
+
+    // OPTIMIZATION: If we've parsed this exact script before, prefer the cached parse tree, as functions that already
+    //               ran have their bytecode cached on it.
+    if (use_parse_tree_cache == UseParseTreeCache::Yes) {
+        if (auto program = realm.vm().parse_tree_cache().find(filename, script->source_code().code(), line_number_offset))
+            return realm.heap().allocate<Script>(realm, filename, program.release_nonnull(), host_defined);
+        realm.vm().parse_tree_cache().add(filename, line_number_offset, script);
+    }
 
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
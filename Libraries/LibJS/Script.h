@@ -35,8 +35,21 @@ public:
         virtual bool is_javascript_module_script() const { return false; }
     };
 
+    enum class UseParseTreeCache {
+        No,
+        Yes,
+    };
+
+    using ParsedText = Result<NonnullRefPtr<Program>, Vector<ParserError>>;
+
     virtual ~Script() override;
-    static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
+    static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1, UseParseTreeCache = UseParseTreeCache::No);
+
+    // Step 1 of ParseScript. This doesn't touch the heap, so unlike parse() it may be called on any thread.
+    static ParsedText parse_text(Utf16String source_text, StringView filename = {}, size_t line_number_offset = 1);
+
+    // The remaining steps of ParseScript, given the result of parse_text().
+    static Result<GC::Ref<Script>, Vector<ParserError>> create_from_parsed_text(ParsedText, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1, UseParseTreeCache = UseParseTreeCache::No);
 
     Realm& realm() { return *m_realm; }
     Program const& parse_node() const { return *m_parse_node; }
@@ -132,12 +132,24 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
     // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text))), Program::Type::Module);
-    auto body = parser.parse_program();
+    return create_from_parsed_text(parse_text(Utf16String::from_utf8(source_text), filename), realm, filename, host_defined);
+}
 
-    // 2. If body is a List of errors, return body.
+Script::ParsedText SourceTextModule::parse_text(Utf16String source_text, StringView filename)
+{
+    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), move(source_text))), Program::Type::Module);
+    auto body = parser.parse_program();
     if (parser.has_errors())
         return parser.errors();
+    return body;
+}
+
+Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::create_from_parsed_text(Script::ParsedText parsed_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
+{
+    // 2. If body is a List of errors, return body.
+    if (parsed_text.is_error())
+        return parsed_text.release_error();
+    auto body = parsed_text.release_value();
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
@@ -24,6 +24,12 @@ public:
 
     static Result<GC::Ref<SourceTextModule>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, Script::HostDefined* host_defined = nullptr);
 
+    // Step 1 of ParseModule. This doesn't touch the heap, so unlike parse() it may be called on any thread.
+    static Script::ParsedText parse_text(Utf16String source_text, StringView filename = {});
+
+    // The remaining steps of ParseModule, given the result of parse_text().
+    static Result<GC::Ref<SourceTextModule>, Vector<ParserError>> create_from_parsed_text(Script::ParsedText, Realm&, StringView filename = {}, Script::HostDefined* host_defined = nullptr);
+
     Program const& parse_node() const { return *m_ecmascript_code; }
 
     virtual Vector<Utf16FlyString> get_exported_names(VM& vm, HashTable<Module const*>& export_star_set) override;
@@ -12,10 +12,61 @@
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+static constexpr AVHWDeviceType hardware_device_type()
+{
+#if defined(AK_OS_MACOS) || defined(AK_OS_IOS)
+    return AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_WINDOWS)
+    return AV_HWDEVICE_TYPE_D3D11VA;
+#elif defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+    return AV_HWDEVICE_TYPE_VAAPI;
+#else
+    return AV_HWDEVICE_TYPE_NONE;
+#endif
+}
+
+// Sets up the codec context to decode on the GPU, if this platform's video acceleration API supports the codec.
+// Returns the pixel format that hardware decoded frames will have, or AV_PIX_FMT_NONE to decode in software.
+static AVPixelFormat try_set_up_hardware_decoding(AVCodecContext* codec_context, AVCodec const* codec)
 {
+    auto device_type = hardware_device_type();
+    if (device_type == AV_HWDEVICE_TYPE_NONE)
+        return AV_PIX_FMT_NONE;
+
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (!config)
+            return AV_PIX_FMT_NONE;
+        if (config->device_type != device_type || (config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0)
+            continue;
+
+        // This fails if there is no usable GPU or driver, in which case we just decode in software.
+        AVBufferRef* device_context = nullptr;
+        if (av_hwdevice_ctx_create(&device_context, device_type, nullptr, nullptr, 0) < 0)
+            return AV_PIX_FMT_NONE;
+        codec_context->hw_device_ctx = device_context;
+        return config->pix_fmt;
+    }
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
+{
+    auto hardware_pixel_format = static_cast<AVPixelFormat>(reinterpret_cast<intptr_t>(codec_context->opaque));
+    if (hardware_pixel_format != AV_PIX_FMT_NONE) {
+        for (auto const* format = formats; *format >= 0; format++) {
+            if (*format == hardware_pixel_format)
+                return hardware_pixel_format;
+        }
+    }
+
+    // FFmpeg offers software formats after hardware ones, and falls back to them if hardware decoding fails to
+    // initialize for a stream, so fall through to picking one of those.
     while (*formats >= 0) {
         switch (*formats) {
         case AV_PIX_FMT_YUV420P:
@@ -39,16 +90,61 @@ static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat cons
     return AV_PIX_FMT_NONE;
 }
 
+// Copies an NV12 or P010 frame into separate Y, U and V planes. P010 keeps its 10 bits in the high bits of each
+// sample, so those are widened to the full 16-bit unorm range by replicating them into the low bits.
+static void copy_semi_planar_frame(AVFrame const& frame, size_t bit_depth, Gfx::Size<size_t> y_plane_size, Gfx::Size<size_t> uv_plane_size, Bytes (&buffers)[3])
+{
+    auto widen = [&](u16 sample) -> u16 {
+        return sample | (sample >> bit_depth);
+    };
+
+    auto const* y_source = frame.data[0];
+    for (size_t row = 0; row < y_plane_size.height(); row++) {
+        auto const* source_row = y_source + (row * frame.linesize[0]);
+        if (bit_depth > 8) {
+            auto* destination_row = reinterpret_cast<u16*>(buffers[0].data()) + (row * y_plane_size.width());
+            for (size_t i = 0; i < y_plane_size.width(); i++)
+                destination_row[i] = widen(reinterpret_cast<u16 const*>(source_row)[i]);
+        } else {
+            memcpy(buffers[0].data() + (row * y_plane_size.width()), source_row, y_plane_size.width());
+        }
+    }
+
+    auto const* uv_source = frame.data[1];
+    for (size_t row = 0; row < uv_plane_size.height(); row++) {
+        auto const* source_row = uv_source + (row * frame.linesize[1]);
+        auto row_offset = row * uv_plane_size.width();
+        if (bit_depth > 8) {
+            auto const* samples = reinterpret_cast<u16 const*>(source_row);
+            auto* u_row = reinterpret_cast<u16*>(buffers[1].data()) + row_offset;
+            auto* v_row = reinterpret_cast<u16*>(buffers[2].data()) + row_offset;
+            for (size_t i = 0; i < uv_plane_size.width(); i++) {
+                u_row[i] = widen(samples[i * 2]);
+                v_row[i] = widen(samples[(i * 2) + 1]);
+            }
+        } else {
+            auto* u_row = buffers[1].data() + row_offset;
+            auto* v_row = buffers[2].data() + row_offset;
+            for (size_t i = 0; i < uv_plane_size.width(); i++) {
+                u_row[i] = source_row[i * 2];
+                v_row[i] = source_row[(i * 2) + 1];
+            }
+        }
+    }
+}
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* transfer_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&transfer_frame);
         }
     };
 
@@ -61,6 +157,10 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!codec_context)
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
+    // OPTIMIZATION: Software decoding of high resolution video can keep several cores busy, so offload it to the GPU
+    //               where possible.
+    auto hardware_pixel_format = try_set_up_hardware_decoding(codec_context, codec);
+    codec_context->opaque = reinterpret_cast<void*>(static_cast<intptr_t>(hardware_pixel_format));
     codec_context->get_format = negotiate_output_format;
     codec_context->time_base = { 1, 1'000'000 };
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
@@ -88,14 +188,21 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    if (hardware_pixel_format != AV_PIX_FMT_NONE) {
+        transfer_frame = av_frame_alloc();
+        if (!transfer_frame)
+            return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+    }
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, transfer_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -103,6 +210,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -150,11 +258,22 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
 
     switch (result) {
     case 0: {
-        auto color_primaries = static_cast<ColorPrimaries>(m_frame->color_primaries);
-        auto transfer_characteristics = static_cast<TransferCharacteristics>(m_frame->color_trc);
-        auto matrix_coefficients = static_cast<MatrixCoefficients>(m_frame->colorspace);
+        auto* frame = m_frame;
+        if (m_frame->hw_frames_ctx) {
+            // FIXME: Hand the decoded surface to Skia as a texture instead of reading it back to system memory.
+            av_frame_unref(m_transfer_frame);
+            if (av_hwframe_transfer_data(m_transfer_frame, m_frame, 0) < 0 || av_frame_copy_props(m_transfer_frame, m_frame) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to transfer a hardware decoded frame to memory"sv);
+            if (m_transfer_frame->format != AV_PIX_FMT_NV12 && m_transfer_frame->format != AV_PIX_FMT_P010)
+                return DecoderError::format(DecoderErrorCategory::NotImplemented, "Hardware decoded frames in pixel format {} are not supported", m_transfer_frame->format);
+            frame = m_transfer_frame;
+        }
+
+        auto color_primaries = static_cast<ColorPrimaries>(frame->color_primaries);
+        auto transfer_characteristics = static_cast<TransferCharacteristics>(frame->color_trc);
+        auto matrix_coefficients = static_cast<MatrixCoefficients>(frame->colorspace);
         auto color_range = [&] {
-            switch (m_frame->color_range) {
+            switch (frame->color_range) {
             case AVColorRange::AVCOL_RANGE_MPEG:
                 return VideoFullRangeFlag::Studio;
             case AVColorRange::AVCOL_RANGE_JPEG:
@@ -185,14 +304,16 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         }
 
         size_t bit_depth = [&] {
-            switch (m_frame->format) {
+            switch (frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
             case AV_PIX_FMT_YUVJ420P:
             case AV_PIX_FMT_YUVJ422P:
             case AV_PIX_FMT_YUVJ444P:
+            case AV_PIX_FMT_NV12:
                 return 8;
+            case AV_PIX_FMT_P010:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
@@ -207,11 +328,13 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         }();
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUVJ420P:
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
                 return { true, true };
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV422P10:
@@ -228,11 +351,11 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             }
         }();
 
-        auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
-        auto gfx_size = Gfx::IntSize { m_frame->width, m_frame->height };
+        auto size = Gfx::Size<u32> { frame->width, frame->height };
+        auto gfx_size = Gfx::IntSize { frame->width, frame->height };
 
-        auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
-        auto duration = AK::Duration::from_microseconds(m_frame->duration);
+        auto timestamp = AK::Duration::from_microseconds(frame->pts);
+        auto duration = AK::Duration::from_microseconds(frame->duration);
 
         auto yuv_data = DECODER_TRY_ALLOC(Gfx::YUVData::create(gfx_size, bit_depth, subsampling, cicp));
 
@@ -240,15 +363,22 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto uv_plane_size = subsampling.subsampled_size(size).to_type<size_t>();
 
         Bytes buffers[] = { yuv_data->y_data(), yuv_data->u_data(), yuv_data->v_data() };
+
+        // Hardware decoders hand us semi-planar frames, where the U and V samples are interleaved in a single plane.
+        if (frame->format == AV_PIX_FMT_NV12 || frame->format == AV_PIX_FMT_P010) {
+            copy_semi_planar_frame(*frame, bit_depth, y_plane_size, uv_plane_size, buffers);
+            auto bitmap = DECODER_TRY_ALLOC(Gfx::ImmutableBitmap::create_from_yuv(move(yuv_data)));
+            return DECODER_TRY_ALLOC(try_make<VideoFrame>(timestamp, duration, size, bit_depth, cicp, move(bitmap)));
+        }
         Gfx::Size<size_t> plane_sizes[] = { y_plane_size, uv_plane_size, uv_plane_size };
 
         for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+            VERIFY(frame->linesize[plane] != 0);
+            if (frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
 
             auto plane_size = plane_sizes[plane];
-            auto const* source = m_frame->data[plane];
+            auto const* source = frame->data[plane];
             VERIFY(source != nullptr);
             auto destination = buffers[plane];
 
@@ -258,7 +388,7 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 auto const shift = 16 - bit_depth;
                 auto const inverse_shift = bit_depth - shift;
                 auto samples_per_row = plane_size.width();
-                auto source_stride = m_frame->linesize[plane];
+                auto source_stride = frame->linesize[plane];
 
                 for (size_t row = 0; row < plane_size.height(); row++) {
                     auto const* src_row = reinterpret_cast<u16 const*>(source + (row * source_stride));
@@ -268,12 +398,12 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 }
             } else {
                 auto output_line_size = plane_size.width();
-                VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
+                VERIFY(output_line_size <= static_cast<size_t>(frame->linesize[plane]));
 
                 auto* dest_ptr = destination.data();
                 for (size_t row = 0; row < plane_size.height(); row++) {
                     memcpy(dest_ptr, source, output_line_size);
-                    source += m_frame->linesize[plane];
+                    source += frame->linesize[plane];
                     dest_ptr += output_line_size;
                 }
             }
@@ -14,6 +14,21 @@ static constexpr u64 PRECEDING_DATA_SIZE = 1 * KiB;
 static constexpr u64 FORWARD_REQUEST_THRESHOLD = 1 * MiB;
 static constexpr AK::Duration CURSOR_ACTIVE_TIME = AK::Duration::from_milliseconds(50);
 
+// Once this much data is buffered, data that every cursor has moved past is discarded.
+static constexpr u64 MAXIMUM_BUFFERED_SIZE = 128 * MiB;
+// Data just behind the cursors is kept, so that short seeks backwards don't have to fetch it again.
+static constexpr u64 PLAYED_BACK_DATA_TO_KEEP = 16 * MiB;
+// The start of the stream holds the container's headers, which demuxers return to, so it is always kept.
+static constexpr u64 HEADER_DATA_TO_KEEP = 1 * MiB;
+// Only whole blocks of data are freed, so there is no point in discarding less than a few of them at a time.
+static constexpr u64 MINIMUM_DATA_TO_DISCARD = 8 * MiB;
+// Once this much data is buffered ahead of the furthest cursor, the request for more data is stopped.
+static constexpr u64 MAXIMUM_READ_AHEAD_SIZE = 64 * MiB;
+// Once a cursor gets this close to the end of the buffered data again, the request for more data is restarted.
+static constexpr u64 READ_AHEAD_RESUME_THRESHOLD = 16 * MiB;
+// The size of the blocks that make up the data of a chunk.
+static constexpr size_t DATA_BLOCK_SIZE = 1 * MiB;
+
 NonnullRefPtr<IncrementallyPopulatedStream> IncrementallyPopulatedStream::create_empty()
 {
     return adopt_ref(*new IncrementallyPopulatedStream());
@@ -44,6 +59,19 @@ void IncrementallyPopulatedStream::set_data_request_callback(DataRequestCallback
     m_data_request_callback = move(callback);
 }
 
+void IncrementallyPopulatedStream::set_read_ahead_limit_callback(ReadAheadLimitCallback callback)
+{
+    Threading::MutexLocker locker { m_mutex };
+    m_callback_event_loop = Core::EventLoop::current_weak();
+    m_read_ahead_limit_callback = move(callback);
+}
+
+void IncrementallyPopulatedStream::set_data_can_be_requested_again(bool data_can_be_requested_again)
+{
+    Threading::MutexLocker locker { m_mutex };
+    m_data_can_be_requested_again = data_can_be_requested_again;
+}
+
 void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
 {
     VERIFY(!data.is_null());
@@ -57,24 +85,24 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
 
     // Add a new chunk to the collection if there are none.
     if (previous_chunk_iter.is_end() || previous_chunk_iter->end() < offset) {
-        DataChunk new_chunk { offset, MUST(ByteBuffer::copy(data)) };
+        DataChunk new_chunk { offset, data };
         m_chunks.insert(offset, move(new_chunk));
+        discard_played_back_data_while_locked();
+        stop_reading_ahead_if_needed_while_locked(new_chunk_end);
         m_state_changed.broadcast();
         return;
     }
 
     auto& chunk = *previous_chunk_iter;
-    auto& buffer = chunk.data();
 
-    if (chunk.size() >= new_chunk_end) {
+    if (chunk.end() >= new_chunk_end) {
         // The chunk is fully covered by the existing chunk, skip until after it.
         begin_new_request_while_locked(chunk.end());
         return;
     }
 
     // Expand the existing chunk to contain this new data.
-    buffer.resize(new_chunk_end - chunk.offset());
-    data.copy_to(buffer.bytes().slice(offset - chunk.offset()));
+    chunk.append(data.slice(chunk.end() - offset));
 
     // Join the chunk to the next one if they intersect.
     auto next_chunk_iter = previous_chunk_iter;
@@ -83,17 +111,158 @@ void IncrementallyPopulatedStream::add_chunk_at(u64 offset, ReadonlyBytes data)
     if (!next_chunk_iter.is_end() && next_chunk_iter->offset() <= previous_chunk_iter->end()) {
         auto& next_chunk = *next_chunk_iter;
 
-        buffer.resize(next_chunk.end() - chunk.offset());
-        next_chunk.data().bytes().copy_to(buffer.bytes().slice(next_chunk.offset() - chunk.offset()));
+        if (next_chunk.end() > chunk.end())
+            chunk.append_from(next_chunk, chunk.end());
 
         VERIFY(m_chunks.remove(next_chunk.offset()));
 
         begin_new_request_while_locked(chunk.end());
     }
 
+    auto buffered_end = chunk.end();
+    discard_played_back_data_while_locked();
+    stop_reading_ahead_if_needed_while_locked(buffered_end);
     m_state_changed.broadcast();
 }
 
+void IncrementallyPopulatedStream::DataChunk::append(ReadonlyBytes data)
+{
+    while (!data.is_empty()) {
+        if (m_blocks.is_empty() || m_blocks.last().size() == DATA_BLOCK_SIZE) {
+            m_blocks.append({});
+            m_blocks.last().ensure_capacity(DATA_BLOCK_SIZE);
+        }
+
+        auto& block = m_blocks.last();
+        auto size_to_append = min(data.size(), DATA_BLOCK_SIZE - block.size());
+        block.append(data.trim(size_to_append));
+        data = data.slice(size_to_append);
+        m_size += size_to_append;
+    }
+}
+
+void IncrementallyPopulatedStream::DataChunk::append_from(DataChunk const& other, u64 position)
+{
+    VERIFY(position >= other.offset() && position <= other.end());
+
+    auto position_in_blocks = other.m_start_in_first_block + (position - other.m_offset);
+    auto first_block_index = position_in_blocks / DATA_BLOCK_SIZE;
+    for (auto block_index = first_block_index; block_index < other.m_blocks.size(); ++block_index) {
+        auto block = other.m_blocks[block_index].bytes();
+        if (block_index == first_block_index)
+            block = block.slice(position_in_blocks % DATA_BLOCK_SIZE);
+        append(block);
+    }
+}
+
+void IncrementallyPopulatedStream::DataChunk::read(u64 position, Bytes bytes) const
+{
+    VERIFY(position >= m_offset && position + bytes.size() <= end());
+
+    auto position_in_blocks = m_start_in_first_block + (position - m_offset);
+    while (!bytes.is_empty()) {
+        auto const& block = m_blocks[position_in_blocks / DATA_BLOCK_SIZE];
+        auto offset_in_block = position_in_blocks % DATA_BLOCK_SIZE;
+        auto copied_size = block.bytes().slice(offset_in_block).copy_trimmed_to(bytes);
+        bytes = bytes.slice(copied_size);
+        position_in_blocks += copied_size;
+    }
+}
+
+void IncrementallyPopulatedStream::DataChunk::discard_before(u64 position)
+{
+    VERIFY(position >= m_offset && position <= end());
+
+    auto position_in_blocks = m_start_in_first_block + (position - m_offset);
+    auto blocks_to_remove = position_in_blocks / DATA_BLOCK_SIZE;
+    m_blocks.remove(0, blocks_to_remove);
+
+    m_start_in_first_block = position_in_blocks % DATA_BLOCK_SIZE;
+    m_size -= position - m_offset;
+    m_offset = position;
+}
+
+void IncrementallyPopulatedStream::discard_played_back_data_while_locked()
+{
+    if (!m_data_can_be_requested_again || m_cursors.is_empty())
+        return;
+
+    u64 buffered_size = 0;
+    for (auto const& chunk : m_chunks)
+        buffered_size += chunk.size();
+    if (buffered_size <= MAXIMUM_BUFFERED_SIZE)
+        return;
+
+    // NB: Inactive cursors are included here, since they may be resumed at any point, e.g. when an audio track is
+    //     re-enabled.
+    u64 earliest_cursor_position = NumericLimits<u64>::max();
+    for (auto const& cursor : m_cursors)
+        earliest_cursor_position = min(earliest_cursor_position, cursor.m_position);
+    if (earliest_cursor_position <= HEADER_DATA_TO_KEEP + PLAYED_BACK_DATA_TO_KEEP)
+        return;
+    auto discard_end = earliest_cursor_position - PLAYED_BACK_DATA_TO_KEEP;
+
+    Vector<u64> chunks_to_trim;
+    u64 discardable_size = 0;
+    for (auto const& chunk : m_chunks) {
+        if (chunk.offset() >= discard_end)
+            break;
+        auto discard_start = max(chunk.offset(), HEADER_DATA_TO_KEEP);
+        auto chunk_discard_end = min(chunk.end(), discard_end);
+        if (discard_start >= chunk_discard_end)
+            continue;
+        chunks_to_trim.append(chunk.offset());
+        discardable_size += chunk_discard_end - discard_start;
+    }
+    if (discardable_size < MINIMUM_DATA_TO_DISCARD)
+        return;
+
+    // Split each chunk into what comes before and after the discarded range. The chunk at the start of the stream must
+    // never go away entirely, as reads only request missing data when there is an earlier chunk to continue from.
+    for (auto offset : chunks_to_trim) {
+        auto* chunk_in_tree = m_chunks.find(offset);
+        VERIFY(chunk_in_tree);
+        auto chunk = move(*chunk_in_tree);
+        VERIFY(m_chunks.remove(offset));
+
+        auto discard_start = max(chunk.offset(), HEADER_DATA_TO_KEEP);
+        auto chunk_discard_end = min(chunk.end(), discard_end);
+
+        // NB: Only the header data is copied out into a chunk of its own, and it is small.
+        if (discard_start > offset) {
+            auto header_data = MUST(ByteBuffer::create_uninitialized(discard_start - offset));
+            chunk.read(offset, header_data.bytes());
+            m_chunks.insert(offset, DataChunk { offset, header_data.bytes() });
+        }
+        if (chunk.end() > chunk_discard_end) {
+            chunk.discard_before(chunk_discard_end);
+            m_chunks.insert(chunk_discard_end, move(chunk));
+        }
+    }
+}
+
+void IncrementallyPopulatedStream::stop_reading_ahead_if_needed_while_locked(u64 buffered_end)
+{
+    if (!m_data_can_be_requested_again || m_read_ahead_stopped || !m_read_ahead_limit_callback || m_cursors.is_empty())
+        return;
+
+    u64 furthest_cursor_position = 0;
+    for (auto const& cursor : m_cursors)
+        furthest_cursor_position = max(furthest_cursor_position, cursor.m_position);
+    if (buffered_end <= furthest_cursor_position + MAXIMUM_READ_AHEAD_SIZE)
+        return;
+
+    m_read_ahead_stopped = true;
+
+    auto event_loop = m_callback_event_loop->take();
+    if (!event_loop)
+        return;
+    event_loop->deferred_invoke([stream = NonnullRefPtr(*this)] {
+        if (stream->m_read_ahead_limit_callback)
+            stream->m_read_ahead_limit_callback();
+    });
+}
+
 void IncrementallyPopulatedStream::reached_end_of_body()
 {
     Threading::MutexLocker locker { m_mutex };
@@ -125,10 +294,12 @@ Optional<u64> IncrementallyPopulatedStream::expected_size() const
 
 void IncrementallyPopulatedStream::begin_new_request_while_locked(u64 position)
 {
-    if (position == m_currently_requested_position)
+    // NB: If reading ahead was stopped, the request for the current position is no longer running.
+    if (position == m_currently_requested_position && !m_read_ahead_stopped)
         return;
 
     m_currently_requested_position = position;
+    m_read_ahead_stopped = false;
     m_last_chunk_end = position;
 
     if (m_expected_size.has_value() && position >= m_expected_size.value())
@@ -158,6 +329,10 @@ bool IncrementallyPopulatedStream::check_if_data_is_available_or_begin_request_w
 
     VERIFY(position >= chunk->offset());
 
+    // Continue reading ahead once a cursor gets close to the end of the data that was buffered before it stopped.
+    if (m_read_ahead_stopped && chunk->end() <= position + READ_AHEAD_RESUME_THRESHOLD)
+        begin_new_request_while_locked(chunk->end());
+
     auto potential_request_position = adjust_request_position(position);
     potential_request_position = max(chunk->end(), position);
     for (size_t i = 0; i < m_cursors.size(); i++) {
@@ -197,9 +372,7 @@ size_t IncrementallyPopulatedStream::read_from_chunks_while_locked(u64 position,
         copy_size = end - position;
     }
 
-    u64 offset_in_chunk = position - chunk.offset();
-    auto source = chunk.data().span().slice(offset_in_chunk, copy_size);
-    source.copy_to(bytes);
+    chunk.read(position, bytes.trim(copy_size));
     return copy_size;
 }
 
@@ -8,6 +8,7 @@
 
 #include <AK/Atomic.h>
 #include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
 #include <AK/Forward.h>
 #include <AK/Function.h>
 #include <AK/RedBlackTree.h>
@@ -37,8 +38,17 @@ public:
     using DataRequestCallback = Function<void(u64 offset)>;
     void set_data_request_callback(DataRequestCallback);
 
+    // Callback invoked when enough data has been buffered ahead of the cursors that the current request should stop.
+    // Once the cursors catch up, the data request callback is invoked to continue where the buffered data ends.
+    using ReadAheadLimitCallback = Function<void()>;
+    void set_read_ahead_limit_callback(ReadAheadLimitCallback);
+
     void add_chunk_at(u64 offset, ReadonlyBytes);
 
+    // Whether data can be requested again after it has been discarded. Until this is set, every byte received is kept
+    // for the lifetime of the stream.
+    void set_data_can_be_requested_again(bool);
+
     void reached_end_of_body();
 
     u64 size();
@@ -73,25 +83,33 @@ public:
     };
 
 private:
+    // NB: A chunk's data is kept in fixed-size blocks, so that played-back data can be discarded from its start without
+    //     copying what remains of it.
     class DataChunk {
     public:
-        DataChunk(u64 offset, ByteBuffer&& data)
+        DataChunk(u64 offset, ReadonlyBytes data)
             : m_offset(offset)
-            , m_data(move(data))
         {
+            append(data);
         }
 
         u64 offset() const { return m_offset; }
-        u64 size() const { return m_data.size(); }
+        u64 size() const { return m_size; }
         u64 end() const { return offset() + size(); }
-        ByteBuffer& data() { return m_data; }
-        ByteBuffer const& data() const { return m_data; }
         bool contains(u64 position) const { return position >= m_offset && position < end(); }
         bool overlaps(DataChunk const& chunk) const { return offset() < chunk.end() && chunk.offset() < end(); }
 
+        void append(ReadonlyBytes);
+        void append_from(DataChunk const&, u64 position);
+        void read(u64 position, Bytes) const;
+        void discard_before(u64 position);
+
     private:
-        size_t m_offset { 0 };
-        ByteBuffer m_data;
+        u64 m_offset { 0 };
+        u64 m_size { 0 };
+        // Where the chunk's first byte is within the first block.
+        size_t m_start_in_first_block { 0 };
+        Vector<ByteBuffer> m_blocks;
     };
 
     IncrementallyPopulatedStream();
@@ -105,6 +123,8 @@ private:
     void begin_new_request_while_locked(u64 position);
     bool check_if_data_is_available_or_begin_request_while_locked(MonotonicTime now, u64 position, u64 length);
     size_t read_from_chunks_while_locked(u64 position, Bytes& bytes) const;
+    void discard_played_back_data_while_locked();
+    void stop_reading_ahead_if_needed_while_locked(u64 buffered_end);
 
     mutable Threading::Mutex m_mutex;
     Vector<Cursor&> m_cursors;
@@ -116,8 +136,11 @@ private:
 
     RefPtr<Core::WeakEventLoopReference> m_callback_event_loop;
     DataRequestCallback m_data_request_callback;
+    ReadAheadLimitCallback m_read_ahead_limit_callback;
+    bool m_read_ahead_stopped { false };
     u64 m_currently_requested_position { 0 };
     u64 m_last_chunk_end { 0 };
+    bool m_data_can_be_requested_again { false };
 };
 
 }
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/Time.h>
 #include <LibMedia/Audio/PlaybackStream.h>
 #include <LibMedia/Providers/AudioDataProvider.h>
@@ -12,6 +14,23 @@
 
 namespace Media {
 
+// OPTIMIZATION: This runs for every sample of every track on the audio thread, and indexing through the spans would
+//               bounds-check each sample, so add four samples at a time instead.
+static void mix_samples_into(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() == source.size());
+
+    auto* destination_data = destination.data();
+    auto const* source_data = source.data();
+    size_t i = 0;
+    for (; i + 4 <= destination.size(); i += 4) {
+        auto sum = AK::SIMD::load_unaligned<AK::SIMD::f32x4>(destination_data + i) + AK::SIMD::load_unaligned<AK::SIMD::f32x4>(source_data + i);
+        AK::SIMD::store_unaligned(destination_data + i, sum);
+    }
+    for (; i < destination.size(); i++)
+        destination_data[i] += source_data[i];
+}
+
 ErrorOr<NonnullRefPtr<AudioMixingSink>> AudioMixingSink::try_create()
 {
     auto weak_ref = TRY(try_make_ref_counted<AudioMixingSinkWeakReference>());
@@ -165,8 +184,7 @@ ReadonlySpan<float> AudioMixingSink::write_audio_data_to_playback_stream(Span<fl
             VERIFY(index_in_buffer + write_count <= buffer.size());
             VERIFY(write_count % channel_count == 0);
 
-            for (size_t i = 0; i < write_count; i++)
-                buffer[index_in_buffer + i] += current_block.data()[index_in_block + i];
+            mix_samples_into(buffer.slice(index_in_buffer, write_count), current_block.data().span().slice(index_in_block, write_count));
 
             auto write_end = index_in_block + write_count;
             if (write_end == current_block.data_count()) {
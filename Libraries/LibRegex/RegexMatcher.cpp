@@ -225,6 +225,15 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // OPTIMIZATION: If the pattern is (or starts with) a literal string, jump straight to its next occurrence instead
+    //               of attempting a match at every position in between.
+    Optional<Utf16View> substring_to_scan_for;
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    if (auto const& needle = optimization_data.pure_substring_search.has_value() ? optimization_data.pure_substring_search : optimization_data.literal_prefix; needle.has_value() && !needle->is_empty()) {
+        if (continue_search && !only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Insensitive))
+            substring_to_scan_for = Utf16View { bit_cast<char16_t const*>(needle->data()), needle->size() };
+    }
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -312,6 +321,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            if (substring_to_scan_for.has_value() && input.view.is_u16_view() && !input.view.unicode()) {
+                auto next_occurrence = input.view.u16_view().find_code_unit_offset(*substring_to_scan_for, view_index);
+                if (!next_occurrence.has_value())
+                    break;
+                view_index = *next_occurrence;
+            }
+
             auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
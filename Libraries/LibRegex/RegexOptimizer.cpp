@@ -537,6 +537,26 @@ static bool interpret_compares(Vector<CompareTypeAndValuePair> const& lhs, Stati
     return true;
 }
 
+static Optional<Vector<u16>> literal_from_compares(ByteCode const& bytecode, Vector<CompareTypeAndValuePair> const& flat_compares)
+{
+    Vector<u16> code_units;
+    for (auto const& compare : flat_compares) {
+        if (compare.type == CharacterCompareType::Char) {
+            (void)AK::UnicodeUtils::code_point_to_utf16(compare.value, [&](auto code_unit) { code_units.append(code_unit); });
+        } else if (compare.type == CharacterCompareType::String) {
+            auto string = bytecode.get_u16_string(compare.value);
+            for (size_t i = 0; i < string.length_in_code_units(); ++i)
+                code_units.append(string.code_unit_at(i));
+        } else {
+            return {};
+        }
+    }
+
+    if (code_units.is_empty())
+        return {};
+    return code_units;
+}
+
 template<class Parser>
 void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
 {
@@ -559,6 +579,8 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             for (auto const& range : parser_result.optimization_data.starting_ranges)
                 dbgln("  - starting range: {}-{}", range.from, range.to);
             dbgln("; - only start of line: {}", parser_result.optimization_data.only_start_of_line);
+            if (parser_result.optimization_data.literal_prefix.has_value())
+                dbgln("; - literal prefix of {} code units", parser_result.optimization_data.literal_prefix->size());
         }
     };
 
@@ -574,6 +596,8 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             if (compare.arguments_count() == 0)
                 return; // This matches 'nothing', so there are no starting ranges that can satisfy it.
             auto flat_compares = compare.flat_compares();
+            if (auto literal = literal_from_compares(bytecode, flat_compares); literal.has_value())
+                parser_result.optimization_data.literal_prefix = literal.release_value();
             StaticallyInterpretedCompares compares;
             if (!interpret_compares(flat_compares, compares))
                 return; // No idea, the bytecode is too complex.
@@ -595,6 +619,8 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
         case OpCodeId::CompareSimple: {
             auto& compare = to<OpCode_CompareSimple>(opcode);
             auto flat_compares = compare.flat_compares();
+            if (auto literal = literal_from_compares(bytecode, flat_compares); literal.has_value())
+                parser_result.optimization_data.literal_prefix = literal.release_value();
             StaticallyInterpretedCompares compares;
             if (!interpret_compares(flat_compares, compares))
                 return; // No idea, the bytecode is too complex.
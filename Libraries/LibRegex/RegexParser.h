@@ -64,6 +64,8 @@ public:
 
         struct {
             Optional<Vector<u16>> pure_substring_search;
+            // If populated, every match of the pattern starts with this literal string.
+            Optional<Vector<u16>> literal_prefix;
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
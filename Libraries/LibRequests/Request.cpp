@@ -43,6 +43,11 @@ bool Request::stop()
     return m_client->stop_request({}, *this);
 }
 
+void Request::set_priority(::RequestServer::RequestPriority priority)
+{
+    m_client->set_priority({}, *this, priority);
+}
+
 void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
 {
     // If the request was stopped while this IPC was in-flight, just bail.
@@ -55,10 +60,30 @@ void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
     auto read_stream = MUST(ReadStream::create(fd));
     auto notifier = read_stream->notifier();
     notifier->on_activation = move(m_internal_stream_data->read_notifier->on_activation);
+    notifier->set_enabled(!m_internal_stream_data->reading_suspended);
     m_internal_stream_data->read_notifier = notifier;
     m_internal_stream_data->read_stream = move(read_stream);
 }
 
+void Request::suspend_reading()
+{
+    if (!m_internal_stream_data)
+        return;
+
+    m_internal_stream_data->reading_suspended = true;
+    m_internal_stream_data->read_notifier->set_enabled(false);
+}
+
+void Request::resume_reading()
+{
+    if (!m_internal_stream_data || !m_internal_stream_data->reading_suspended)
+        return;
+
+    // NB: The notifier is level-triggered, so it activates right away if data arrived while reading was suspended.
+    m_internal_stream_data->reading_suspended = false;
+    m_internal_stream_data->read_notifier->set_enabled(true);
+}
+
 void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_buffered_request_finished)
 {
     VERIFY(m_mode == Mode::Unknown);
@@ -167,6 +192,10 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             return;
 
         do {
+            // NB: Handling the data we read may have suspended reading.
+            if (m_internal_stream_data->reading_suspended)
+                break;
+
             auto result = m_internal_stream_data->read_stream->read_some({ buffer, buffer_size });
             if (result.is_error() && (!result.error().is_errno() || (result.error().is_errno() && result.error().code() != EINTR)))
                 break;
@@ -16,6 +16,7 @@
 #include <LibHTTP/HeaderList.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Requests {
 
@@ -58,6 +59,9 @@ public:
     int fd() const { return m_fd; }
     bool stop();
 
+    // Lets RequestServer reschedule the request, e.g. once an image it is fetching has scrolled into view.
+    void set_priority(::RequestServer::RequestPriority);
+
     using BufferedRequestFinished = Function<void(u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error, NonnullRefPtr<HTTP::HeaderList> response_headers, Optional<u32> response_code, Optional<String> reason_phrase, ReadonlyBytes payload)>;
 
     // Configure the request such that the entirety of the response data is buffered. The callback receives that data and
@@ -72,6 +76,11 @@ public:
     // mutually exclusive with `set_buffered_request_finished_callback`.
     void set_unbuffered_request_callbacks(HeadersReceived, DataReceived, RequestFinished);
 
+    // Stops reading unbuffered response data until reading is resumed. Once the pipe from RequestServer fills up,
+    // RequestServer stops receiving more of the response from the network.
+    void suspend_reading();
+    void resume_reading();
+
     Function<CertificateAndKey()> on_certificate_requested;
 
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
@@ -121,6 +130,7 @@ private:
         RequestTimingInfo timing_info;
         Function<void()> on_finish {};
         bool user_finish_called { false };
+        bool reading_suspended { false };
     };
 
     OwnPtr<InternalBufferedData> m_internal_buffered_data;
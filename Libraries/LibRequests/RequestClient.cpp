@@ -27,9 +27,18 @@ void RequestClient::die()
 
     for (auto& [id, promise] : m_pending_cache_size_estimations)
         promise->reject(Error::from_string_literal("RequestServer process died"));
+    for (auto& [id, promise] : m_pending_memory_reports)
+        promise->reject(Error::from_string_literal("RequestServer process died"));
+    for (auto& [id, promise] : m_pending_cache_storage_body_stores)
+        promise->reject(Error::from_string_literal("RequestServer process died"));
+    for (auto& [id, promise] : m_pending_cache_storage_body_retrievals)
+        promise->reject(Error::from_string_literal("RequestServer process died"));
 
     m_requests.clear();
     m_pending_cache_size_estimations.clear();
+    m_pending_memory_reports.clear();
+    m_pending_cache_storage_body_stores.clear();
+    m_pending_cache_storage_body_retrievals.clear();
 }
 
 void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::CacheLevel cache_level)
@@ -38,12 +47,12 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(request_id, url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, Core::ProxyData const& proxy_data)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, Optional<HTTP::HeaderList const&> request_headers, ReadonlyBytes request_body, HTTP::CacheMode cache_mode, Core::ProxyData const& proxy_data, ::RequestServer::RequestPriority priority)
 {
     auto request_id = m_next_request_id++;
     auto headers = request_headers.map([](auto const& headers) { return headers.headers().span(); }).value_or({});
 
-    IPCProxy::async_start_request(request_id, method, url, headers, request_body, cache_mode, proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, headers, request_body, cache_mode, proxy_data, priority);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -75,6 +84,13 @@ bool RequestClient::set_certificate(Badge<Request>, Request& request, ByteString
     return IPCProxy::set_certificate(request.id(), move(certificate), move(key));
 }
 
+void RequestClient::set_priority(Badge<Request>, Request& request, ::RequestServer::RequestPriority priority)
+{
+    if (!m_requests.contains(request.id()))
+        return;
+    async_set_request_priority(request.id(), priority);
+}
+
 NonnullRefPtr<Core::Promise<CacheSizes>> RequestClient::estimate_cache_size_accessed_since(UnixDateTime since)
 {
     auto promise = Core::Promise<CacheSizes>::construct();
@@ -93,6 +109,60 @@ void RequestClient::estimated_cache_size(u64 cache_size_estimation_id, CacheSize
         (*promise)->resolve(sizes);
 }
 
+NonnullRefPtr<Core::Promise<JsonValue>> RequestClient::request_memory_report()
+{
+    auto promise = Core::Promise<JsonValue>::construct();
+
+    auto memory_report_id = m_next_memory_report_id++;
+    m_pending_memory_reports.set(memory_report_id, promise);
+
+    async_request_memory_report(memory_report_id);
+
+    return promise;
+}
+
+void RequestClient::did_produce_memory_report(u64 memory_report_id, JsonValue report)
+{
+    if (auto promise = m_pending_memory_reports.take(memory_report_id); promise.has_value())
+        (*promise)->resolve(move(report));
+}
+
+NonnullRefPtr<Core::Promise<bool>> RequestClient::store_cache_storage_body(ByteString const& storage_key, ByteString const& body_id, ReadonlyBytes body)
+{
+    auto promise = Core::Promise<bool>::construct();
+
+    auto cache_storage_request_id = m_next_cache_storage_request_id++;
+    m_pending_cache_storage_body_stores.set(cache_storage_request_id, promise);
+
+    async_store_cache_storage_body(cache_storage_request_id, storage_key, body_id, body);
+
+    return promise;
+}
+
+void RequestClient::cache_storage_body_stored(u64 cache_storage_request_id, bool success)
+{
+    if (auto promise = m_pending_cache_storage_body_stores.take(cache_storage_request_id); promise.has_value())
+        (*promise)->resolve(success);
+}
+
+NonnullRefPtr<Core::Promise<Optional<ByteBuffer>>> RequestClient::retrieve_cache_storage_body(ByteString const& storage_key, ByteString const& body_id)
+{
+    auto promise = Core::Promise<Optional<ByteBuffer>>::construct();
+
+    auto cache_storage_request_id = m_next_cache_storage_request_id++;
+    m_pending_cache_storage_body_retrievals.set(cache_storage_request_id, promise);
+
+    async_retrieve_cache_storage_body(cache_storage_request_id, storage_key, body_id);
+
+    return promise;
+}
+
+void RequestClient::cache_storage_body_retrieved(u64 cache_storage_request_id, Optional<ByteBuffer> body)
+{
+    if (auto promise = m_pending_cache_storage_body_retrievals.take(cache_storage_request_id); promise.has_value())
+        (*promise)->resolve(move(body));
+}
+
 void RequestClient::request_finished(u64 request_id, u64 total_size, RequestTimingInfo timing_info, Optional<NetworkError> network_error)
 {
     RefPtr<Request> request;
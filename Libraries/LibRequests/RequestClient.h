@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/JsonValue.h>
 #include <LibHTTP/Cache/CacheMode.h>
 #include <LibHTTP/HeaderList.h>
 #include <LibIPC/ConnectionToServer.h>
@@ -14,6 +15,7 @@
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -32,7 +34,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, Optional<HTTP::HeaderList const&> request_headers = {}, ReadonlyBytes request_body = {}, HTTP::CacheMode = HTTP::CacheMode::Default, Core::ProxyData const& = {}, ::RequestServer::RequestPriority = ::RequestServer::RequestPriority::Medium);
 
     RefPtr<WebSocket> websocket_connect(URL::URL const&, ByteString const& origin, Vector<ByteString> const& protocols, Vector<ByteString> const& extensions, HTTP::HeaderList const& request_headers);
 
@@ -40,8 +42,13 @@ public:
 
     bool stop_request(Badge<Request>, Request&);
     bool set_certificate(Badge<Request>, Request&, ByteString, ByteString);
+    void set_priority(Badge<Request>, Request&, ::RequestServer::RequestPriority);
 
     NonnullRefPtr<Core::Promise<CacheSizes>> estimate_cache_size_accessed_since(UnixDateTime since);
+    NonnullRefPtr<Core::Promise<JsonValue>> request_memory_report();
+
+    NonnullRefPtr<Core::Promise<bool>> store_cache_storage_body(ByteString const& storage_key, ByteString const& body_id, ReadonlyBytes body);
+    NonnullRefPtr<Core::Promise<Optional<ByteBuffer>>> retrieve_cache_storage_body(ByteString const& storage_key, ByteString const& body_id);
 
     Function<void()> on_request_server_died;
 
@@ -62,6 +69,10 @@ private:
     virtual void websocket_certificate_requested(u64 websocket_id) override;
 
     virtual void estimated_cache_size(u64 cache_size_estimation_id, CacheSizes sizes) override;
+    virtual void did_produce_memory_report(u64 memory_report_id, JsonValue report) override;
+
+    virtual void cache_storage_body_stored(u64 cache_storage_request_id, bool success) override;
+    virtual void cache_storage_body_retrieved(u64 cache_storage_request_id, Optional<ByteBuffer> body) override;
 
     HashMap<u64, RefPtr<Request>> m_requests;
     u64 m_next_request_id { 0 };
@@ -71,6 +82,13 @@ private:
 
     HashMap<u64, NonnullRefPtr<Core::Promise<CacheSizes>>> m_pending_cache_size_estimations;
     u64 m_next_cache_size_estimation_id { 0 };
+
+    HashMap<u64, NonnullRefPtr<Core::Promise<JsonValue>>> m_pending_memory_reports;
+    u64 m_next_memory_report_id { 0 };
+
+    HashMap<u64, NonnullRefPtr<Core::Promise<bool>>> m_pending_cache_storage_body_stores;
+    HashMap<u64, NonnullRefPtr<Core::Promise<Optional<ByteBuffer>>>> m_pending_cache_storage_body_retrievals;
+    u64 m_next_cache_storage_request_id { 0 };
 };
 
 }
@@ -8,6 +8,8 @@
  */
 
 #include <AK/BinarySearch.h>
+#include <AK/CharacterTypes.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -352,6 +354,48 @@ ErrorOr<String> Decoder::to_utf8(StringView input)
     return builder.to_string_without_validation();
 }
 
+static size_t ascii_prefix_length(ReadonlyBytes bytes)
+{
+    static constexpr u64 high_bits = 0x8080808080808080ull;
+    size_t length = 0;
+
+    // OPTIMIZATION: Look for a byte with its high bit set 32 bytes at a time, as most text on the web is ASCII.
+    for (; length + sizeof(AK::SIMD::u64x4) <= bytes.size(); length += sizeof(AK::SIMD::u64x4)) {
+        auto chunk = AK::SIMD::load_unaligned<AK::SIMD::u64x4>(bytes.data() + length) & high_bits;
+        if ((chunk[0] | chunk[1] | chunk[2] | chunk[3]) != 0)
+            break;
+    }
+
+    while (length < bytes.size() && is_ascii(bytes[length]))
+        ++length;
+
+    return length;
+}
+
+// Decodes an encoding in which ASCII bytes stand for themselves, and every other byte for a single code point.
+template<typename MapNonASCIIByte>
+static ErrorOr<String> decode_ascii_compatible_single_byte_encoding(StringView input, MapNonASCIIByte map_non_ascii_byte)
+{
+    StringBuilder builder(input.length());
+    auto bytes = input.bytes();
+
+    while (!bytes.is_empty()) {
+        // OPTIMIZATION: Runs of ASCII bytes are already valid UTF-8, so we copy them over in one go instead of decoding
+        //               them one code point at a time.
+        auto ascii_length = ascii_prefix_length(bytes);
+        TRY(builder.try_append(StringView { bytes.trim(ascii_length) }));
+        bytes = bytes.slice(ascii_length);
+
+        if (bytes.is_empty())
+            break;
+
+        TRY(builder.try_append_code_point(map_non_ascii_byte(bytes[0])));
+        bytes = bytes.slice(1);
+    }
+
+    return builder.to_string_without_validation();
+}
+
 ErrorOr<void> UTF8Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -408,6 +452,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return decode_ascii_compatible_single_byte_encoding(input, [](u8 byte) -> u32 { return byte; });
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -479,6 +528,11 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    return decode_ascii_compatible_single_byte_encoding(input, [](u8 byte) -> u32 { return 0xF780 + byte - 0x80; });
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +556,12 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_ascii_compatible_single_byte_encoding(input, [this](u8 byte) -> u32 { return m_translation_table[byte - 0x80]; });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
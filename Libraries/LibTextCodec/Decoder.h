@@ -60,6 +60,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -68,6 +69,7 @@ private:
 class TEXTCODEC_API Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
     virtual bool validate(StringView) override { return true; }
 };
 
@@ -80,6 +82,7 @@ public:
 class TEXTCODEC_API XUserDefinedDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
     virtual bool validate(StringView) override { return true; }
 };
 
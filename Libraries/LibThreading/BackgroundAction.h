@@ -18,6 +18,7 @@
 #include <LibCore/EventReceiver.h>
 #include <LibCore/Promise.h>
 #include <LibThreading/Forward.h>
+#include <LibThreading/ThreadPool.h>
 
 namespace Threading {
 
@@ -31,8 +32,7 @@ class BackgroundActionBase {
 private:
     BackgroundActionBase() = default;
 
-    static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
+    static void enqueue_work(ESCAPING Function<void()>, TaskPriority);
 };
 
 template<typename Result>
@@ -58,7 +58,7 @@ public:
     bool is_canceled() const { return m_canceled.load(AK::MemoryOrder::memory_order_relaxed); }
 
 private:
-    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {})
+    BackgroundAction(ESCAPING Function<ErrorOr<Result>(BackgroundAction&)> action, ESCAPING Function<ErrorOr<void>(Result)> on_complete, ESCAPING Optional<Function<void(Error)>> on_error = {}, TaskPriority priority = TaskPriority::Normal)
         : m_action(move(action))
         , m_on_complete(move(on_complete))
     {
@@ -96,7 +96,8 @@ private:
                 }
             };
 
-            auto result = self->m_action(*self);
+            // Don't bother starting work that was canceled while it was waiting in the queue.
+            auto result = self->is_canceled() ? ErrorOr<Result> { Error::from_errno(ECANCELED) } : self->m_action(*self);
             auto const has_job = static_cast<bool>(self->m_on_complete);
             auto const canceled = self->m_canceled.load(AK::MemoryOrder::memory_order_relaxed);
 
@@ -129,7 +130,8 @@ private:
                     self->m_on_error(Error::copy(error));
                 });
             }
-        });
+        },
+            priority);
     }
 
     Function<ErrorOr<Result>(BackgroundAction&)> m_action;
@@ -141,6 +143,7 @@ private:
     Atomic<bool> m_canceled { false };
 };
 
+// Stops the threads that run BackgroundActions, dropping any actions that haven't started yet.
 void quit_background_thread();
 
 }
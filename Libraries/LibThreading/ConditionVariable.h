@@ -7,7 +7,9 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <AK/Time.h>
 #include <LibThreading/Mutex.h>
+#include <errno.h>
 #include <pthread.h>
 #include <sys/types.h>
 
@@ -37,6 +39,14 @@ public:
         auto result = pthread_cond_wait(&m_condition, &m_to_wait_on.m_mutex);
         VERIFY(result == 0);
     }
+    // Same as wait(), but gives up once the deadline has passed. Returns false if it timed out.
+    ALWAYS_INLINE bool wait_until(UnixDateTime deadline)
+    {
+        auto absolute_time = deadline.to_timespec();
+        auto result = pthread_cond_timedwait(&m_condition, &m_to_wait_on.m_mutex, &absolute_time);
+        VERIFY(result == 0 || result == ETIMEDOUT);
+        return result == 0;
+    }
     ALWAYS_INLINE void wait_while(Function<bool()> condition)
     {
         while (condition())
@@ -6,8 +6,13 @@
 
 #pragma once
 
+#include <AK/Types.h>
+
 namespace Threading {
 
 class Thread;
+class ThreadPool;
+
+enum class TaskPriority : u8;
 
 }
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+static constexpr size_t max_default_worker_count = 4;
+
+// Lets submit() tell whether it is being called from one of a pool's own workers.
+static thread_local ThreadPool const* s_current_pool = nullptr;
+static thread_local size_t s_current_worker_index = 0;
+
+NonnullOwnPtr<ThreadPool> ThreadPool::create(StringView thread_name, size_t worker_count)
+{
+    return adopt_own(*new ThreadPool(thread_name, worker_count));
+}
+
+size_t ThreadPool::default_worker_count()
+{
+    auto core_count = max(static_cast<size_t>(Core::System::hardware_concurrency()), 2uz);
+    return min(core_count - 1, max_default_worker_count);
+}
+
+ThreadPool::ThreadPool(StringView thread_name, size_t worker_count)
+{
+    VERIFY(worker_count > 0);
+
+    m_workers.ensure_capacity(worker_count);
+    for (size_t i = 0; i < worker_count; ++i)
+        m_workers.append(make<Worker>());
+
+    for (size_t i = 0; i < worker_count; ++i) {
+        m_workers[i]->thread = Thread::construct(thread_name, [this, i] {
+            worker_loop(i);
+            return static_cast<intptr_t>(0);
+        });
+        m_workers[i]->thread->start();
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker const locker { m_idle_mutex };
+        m_exit = true;
+        m_work_available.broadcast();
+    }
+    for (auto& worker : m_workers)
+        MUST(worker->thread->join());
+}
+
+void ThreadPool::submit(Function<void()> task, TaskPriority priority)
+{
+    // Work spawned by a worker is likely to touch the same data as the task that spawned it, so keep it local.
+    size_t worker_index = 0;
+    if (s_current_pool == this)
+        worker_index = s_current_worker_index;
+    else
+        worker_index = m_next_worker_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    auto& worker = *m_workers[worker_index];
+    {
+        // NB: The count is bumped under the worker's lock, before the task becomes visible to the workers. Otherwise, a
+        //     worker could dequeue the task and decrement the count first, wrapping it around. And since the count is
+        //     bumped before taking the idle lock, a worker either sees it before going to sleep or is already waiting
+        //     when we signal.
+        MutexLocker const locker { worker.mutex };
+        m_pending_task_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+        worker.queues[to_underlying(priority)].enqueue(move(task));
+    }
+
+    MutexLocker const locker { m_idle_mutex };
+    m_work_available.signal();
+}
+
+Optional<ThreadPool::Task> ThreadPool::take_task_from(Worker& worker, TaskPriority priority)
+{
+    MutexLocker const locker { worker.mutex };
+
+    auto& queue = worker.queues[to_underlying(priority)];
+    if (queue.is_empty())
+        return {};
+
+    m_pending_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_acq_rel);
+    return queue.dequeue();
+}
+
+Optional<ThreadPool::Task> ThreadPool::take_task(size_t worker_index)
+{
+    for (size_t priority = 0; priority < priority_count; ++priority) {
+        // Prefer our own queue, then steal from the other workers in turn.
+        for (size_t offset = 0; offset < m_workers.size(); ++offset) {
+            auto& worker = *m_workers[(worker_index + offset) % m_workers.size()];
+            if (auto task = take_task_from(worker, static_cast<TaskPriority>(priority)); task.has_value())
+                return task;
+        }
+    }
+    return {};
+}
+
+void ThreadPool::worker_loop(size_t worker_index)
+{
+    s_current_pool = this;
+    s_current_worker_index = worker_index;
+
+    while (true) {
+        {
+            MutexLocker const locker { m_idle_mutex };
+            while (m_pending_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0 && !m_exit)
+                m_work_available.wait();
+            if (m_exit)
+                return;
+        }
+
+        if (auto task = take_task(worker_index); task.has_value())
+            (*task)();
+    }
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Queue.h>
+#include <AK/RefPtr.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Forward.h>
+#include <LibThreading/Mutex.h>
+
+namespace Threading {
+
+enum class TaskPriority : u8 {
+    High,
+    Normal,
+    Low,
+};
+
+// A fixed set of worker threads that run submitted tasks. Every worker has its own queue per priority; tasks submitted
+// from a worker stay on that worker's queue, while tasks from other threads are spread across the workers. A worker that
+// runs out of work steals from the others, so a burst of tasks landing on one worker still spreads across all of them.
+// Higher priorities are always drained first, across all workers, before looking at lower ones.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    static NonnullOwnPtr<ThreadPool> create(StringView thread_name, size_t worker_count);
+
+    // One worker per core, minus one for the thread submitting the work, but at least one and never more than a handful.
+    static size_t default_worker_count();
+
+    // Stops the workers once they finish the task they are running. Tasks that have not started yet are dropped.
+    ~ThreadPool();
+
+    void submit(ESCAPING Function<void()>, TaskPriority = TaskPriority::Normal);
+
+    size_t worker_count() const { return m_workers.size(); }
+
+private:
+    using Task = Function<void()>;
+    static constexpr size_t priority_count = 3;
+
+    struct Worker {
+        RefPtr<Thread> thread;
+
+        // Guards the queues, which may be pushed to by any thread and stolen from by any worker.
+        Mutex mutex;
+        Array<Queue<Task, 32>, priority_count> queues;
+    };
+
+    ThreadPool(StringView thread_name, size_t worker_count);
+
+    void worker_loop(size_t worker_index);
+    Optional<Task> take_task(size_t worker_index);
+    Optional<Task> take_task_from(Worker&, TaskPriority);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Atomic<size_t> m_next_worker_index { 0 };
+
+    // Workers sleep on this while there are no pending tasks anywhere in the pool.
+    Mutex m_idle_mutex;
+    ConditionVariable m_work_available { m_idle_mutex };
+    Atomic<size_t> m_pending_task_count { 0 };
+    bool m_exit { false };
+};
+
+}
@@ -91,6 +91,9 @@ public:
         return false;
     }
 
+    // https://html.spec.whatwg.org/multipage/browsers.html#schemelessly-same-site
+    bool is_schemelessly_same_site(Origin const&) const;
+
     // https://html.spec.whatwg.org/multipage/browsers.html#same-site
     bool is_same_site(Origin const&) const;
 
@@ -214,6 +214,7 @@ inline URL about_blank() { return URL::about("blank"_string); }
 inline URL about_srcdoc() { return URL::about("srcdoc"_string); }
 
 inline URL about_error() { return URL::about("error"_string); }
+inline URL about_memory() { return URL::about("memory"_string); }
 inline URL about_newtab() { return URL::about("newtab"_string); }
 inline URL about_processes() { return URL::about("processes"_string); }
 inline URL about_settings() { return URL::about("settings"_string); }
@@ -138,6 +138,14 @@ TimeZoneData::TimeZoneData(NonnullOwnPtr<icu::TimeZone> time_zone)
 {
 }
 
+void TimeZoneData::clear_cached_offsets()
+{
+    for (auto& it : s_time_zone_cache) {
+        if (it.value)
+            it.value->m_cached_offset.clear();
+    }
+}
+
 Vector<icu::UnicodeString> icu_string_list(ReadonlySpan<Utf16String> strings)
 {
     Vector<icu::UnicodeString> result;
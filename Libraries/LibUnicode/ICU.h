@@ -73,10 +73,27 @@ public:
 
     ALWAYS_INLINE icu::TimeZone& time_zone() { return *m_time_zone; }
 
+    // The UTC offset between two consecutive transitions of this time zone. Within the range [start, end), the offset
+    // is known to be constant.
+    struct CachedOffset {
+        bool contains(UDate time) const { return time >= start && time < end; }
+
+        UDate start { 0 };
+        UDate end { 0 };
+        i32 raw_offset { 0 };
+        i32 dst_offset { 0 };
+    };
+
+    Optional<CachedOffset> const& cached_offset() const { return m_cached_offset; }
+    void set_cached_offset(CachedOffset cached_offset) { m_cached_offset = cached_offset; }
+
+    static void clear_cached_offsets();
+
 private:
     explicit TimeZoneData(NonnullOwnPtr<icu::TimeZone>);
 
     NonnullOwnPtr<icu::TimeZone> m_time_zone;
+    Optional<CachedOffset> m_cached_offset;
 };
 
 constexpr bool icu_success(UErrorCode code)
@@ -41,8 +41,32 @@ StringView normalization_form_to_string(NormalizationForm form)
     VERIFY_NOT_REACHED();
 }
 
+// Every code point in the Latin-1 range has NFC_Quick_Check=Yes and canonical combining class 0, so text made only of
+// such code points is already in NFC. (It is not in the other forms, which decompose e.g. U+00E9 or U+00A0.)
+static bool is_latin1(StringView string)
+{
+    auto bytes = string.bytes();
+
+    for (size_t i = 0; i < bytes.size();) {
+        if (bytes[i] < 0x80)
+            i += 1;
+        else if (bytes[i] == 0xc2 || bytes[i] == 0xc3)
+            i += 2;
+        else
+            return false;
+    }
+
+    return true;
+}
+
 String normalize(StringView string, NormalizationForm form)
 {
+    // OPTIMIZATION: ASCII text is left unchanged by every normalization form, so we don't need to ask ICU about it.
+    if (string.is_ascii())
+        return MUST(String::from_utf8(string));
+    if (form == NormalizationForm::NFC && is_latin1(string))
+        return MUST(String::from_utf8(string));
+
     UErrorCode status = U_ZERO_ERROR;
     icu::Normalizer2 const* normalizer = nullptr;
 
@@ -5,6 +5,7 @@
  */
 
 #include <AK/CharacterTypes.h>
+#include <AK/HashMap.h>
 #include <AK/QuickSort.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/ICU.h>
@@ -590,11 +591,70 @@ static void flatten_partitions(Vector<PartitionRange>& partitions)
     quick_sort(partitions);
 }
 
+// ICU number formatters only become fast after being used a few times, at which point they compile their options into
+// an optimized form. Since e.g. Number.prototype.toLocaleString creates a new Intl.NumberFormat on every call, we share
+// formatters between every NumberFormat created with the same locale and options, in every realm. LocalizedNumberFormatter
+// is immutable, so sharing one doesn't change how it formats.
+struct SharedNumberFormatter : public RefCounted<SharedNumberFormatter> {
+    explicit SharedNumberFormatter(icu::number::LocalizedNumberFormatter formatter)
+        : formatter(move(formatter))
+    {
+    }
+
+    icu::number::LocalizedNumberFormatter formatter;
+};
+
+struct NumberFormatterKey {
+    String locale;
+    DisplayOptions display_options;
+    RoundingOptions rounding_options;
+
+    bool operator==(NumberFormatterKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<Unicode::NumberFormatterKey> : public DefaultTraits<Unicode::NumberFormatterKey> {
+    static unsigned hash(Unicode::NumberFormatterKey const& key)
+    {
+        auto hash_optional = [](auto const& value) -> unsigned {
+            return value.has_value() ? Traits<RemoveCVReference<decltype(*value)>>::hash(*value) + 1 : 0;
+        };
+
+        auto const& display = key.display_options;
+        auto const& rounding = key.rounding_options;
+
+        auto hash = key.locale.hash();
+        hash = pair_int_hash(hash, (to_underlying(display.style) << 24) | (to_underlying(display.sign_display) << 16) | (to_underlying(display.notation) << 8) | to_underlying(display.grouping));
+        hash = pair_int_hash(hash, hash_optional(display.compact_display));
+        hash = pair_int_hash(hash, hash_optional(display.currency));
+        hash = pair_int_hash(hash, hash_optional(display.currency_display));
+        hash = pair_int_hash(hash, hash_optional(display.currency_sign));
+        hash = pair_int_hash(hash, hash_optional(display.unit));
+        hash = pair_int_hash(hash, hash_optional(display.unit_display));
+        hash = pair_int_hash(hash, (to_underlying(rounding.type) << 16) | (to_underlying(rounding.mode) << 8) | to_underlying(rounding.trailing_zero_display));
+        hash = pair_int_hash(hash, hash_optional(rounding.min_significant_digits));
+        hash = pair_int_hash(hash, hash_optional(rounding.max_significant_digits));
+        hash = pair_int_hash(hash, hash_optional(rounding.min_fraction_digits));
+        hash = pair_int_hash(hash, hash_optional(rounding.max_fraction_digits));
+        hash = pair_int_hash(hash, pair_int_hash(rounding.min_integer_digits, rounding.rounding_increment));
+        return hash;
+    }
+};
+
+namespace Unicode {
+
+// Formatters that are no longer in use are kept around, up to this many in total.
+static constexpr size_t number_formatter_cache_soft_limit = 64;
+static HashMap<NumberFormatterKey, NonnullRefPtr<SharedNumberFormatter>> s_number_formatter_cache;
+
 class NumberFormatImpl : public NumberFormat {
 public:
-    NumberFormatImpl(icu::Locale& locale, icu::number::LocalizedNumberFormatter formatter, bool is_unit)
+    NumberFormatImpl(icu::Locale& locale, NonnullRefPtr<SharedNumberFormatter> formatter, bool is_unit)
         : m_locale(locale)
-        , m_formatter(move(formatter))
+        , m_shared_formatter(move(formatter))
+        , m_formatter(m_shared_formatter->formatter)
         , m_is_unit(is_unit)
     {
     }
@@ -841,7 +901,8 @@ private:
 
     icu::Locale& m_locale;
 
-    icu::number::LocalizedNumberFormatter m_formatter;
+    NonnullRefPtr<SharedNumberFormatter> m_shared_formatter;
+    icu::number::LocalizedNumberFormatter const& m_formatter;
     mutable Optional<icu::number::LocalizedNumberRangeFormatter> m_range_formatter;
 
     OwnPtr<icu::PluralRules> m_plural_rules;
@@ -857,12 +918,23 @@ NonnullOwnPtr<NumberFormat> NumberFormat::create(
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto formatter = icu::number::NumberFormatter::withLocale(locale_data->locale());
-    apply_display_options(formatter, display_options);
-    apply_rounding_options(formatter, rounding_options);
+    NumberFormatterKey key { MUST(String::from_utf8(locale)), display_options, rounding_options };
+
+    RefPtr<SharedNumberFormatter> shared_formatter = s_number_formatter_cache.get(key).value_or(nullptr);
+    if (!shared_formatter) {
+        auto formatter = icu::number::NumberFormatter::withLocale(locale_data->locale());
+        apply_display_options(formatter, display_options);
+        apply_rounding_options(formatter, rounding_options);
+
+        if (s_number_formatter_cache.size() >= number_formatter_cache_soft_limit)
+            s_number_formatter_cache.remove_all_matching([](auto const&, auto const& formatter) { return formatter->ref_count() == 1; });
+
+        shared_formatter = adopt_ref(*new SharedNumberFormatter(move(formatter)));
+        s_number_formatter_cache.set(move(key), *shared_formatter);
+    }
 
     bool is_unit = display_options.style == NumberFormatStyle::Unit;
-    return adopt_own(*new NumberFormatImpl(locale_data->locale(), move(formatter), is_unit));
+    return adopt_own(*new NumberFormatImpl(locale_data->locale(), shared_formatter.release_nonnull(), is_unit));
 }
 
 }
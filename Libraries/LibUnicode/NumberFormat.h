@@ -92,6 +92,8 @@ struct DisplayOptions {
 
     Optional<String> unit;
     Optional<Style> unit_display;
+
+    bool operator==(DisplayOptions const&) const = default;
 };
 
 enum class RoundingType {
@@ -137,6 +139,8 @@ struct RoundingOptions {
 
     int min_integer_digits { 0 };
     int rounding_increment { 1 };
+
+    bool operator==(RoundingOptions const&) const = default;
 };
 
 class NumberFormat {
@@ -127,6 +127,19 @@ private:
     size_t m_current { 0 };
 };
 
+// Latin-1 has no combining marks, and each of its control characters (including U+00AD SOFT HYPHEN) forms a grapheme
+// cluster of its own, so CR LF is the only sequence of Latin-1 characters that is a single grapheme.
+static bool is_latin1_without_crlf(ReadonlySpan<char16_t> code_units)
+{
+    for (size_t i = 0; i < code_units.size(); ++i) {
+        if (code_units[i] > 0xff)
+            return false;
+        if (code_units[i] == '\r' && i + 1 < code_units.size() && code_units[i + 1] == '\n')
+            return false;
+    }
+    return true;
+}
+
 class SegmenterImpl : public Segmenter {
 public:
     SegmenterImpl(NonnullOwnPtr<icu::BreakIterator> segmenter, SegmenterGranularity segmenter_granularity)
@@ -139,13 +152,24 @@ public:
 
     virtual NonnullOwnPtr<Segmenter> clone() const override
     {
-        return make<SegmenterImpl>(adopt_own(*m_segmenter->clone()), m_segmenter_granularity);
+        auto clone = make<SegmenterImpl>(adopt_own(*m_segmenter->clone()), m_segmenter_granularity);
+        clone->m_trivial_grapheme_text_length = m_trivial_grapheme_text_length;
+        clone->m_trivial_current_boundary = m_trivial_current_boundary;
+        return clone;
     }
 
     virtual void set_segmented_text(String text) override
     {
         UErrorCode status = U_ZERO_ERROR;
 
+        m_trivial_grapheme_text_length.clear();
+        if (m_segmenter_granularity == SegmenterGranularity::Grapheme && text.is_ascii() && !text.bytes_as_string_view().contains("\r\n"sv)) {
+            m_trivial_grapheme_text_length = text.byte_count();
+            m_trivial_current_boundary = 0;
+            m_segmented_text = move(text);
+            return;
+        }
+
         m_segmented_text = move(text);
         auto view = m_segmented_text.get<String>().bytes_as_string_view();
 
@@ -166,17 +190,37 @@ public:
             return;
         }
 
+        m_trivial_grapheme_text_length.clear();
+        if (m_segmenter_granularity == SegmenterGranularity::Grapheme && is_latin1_without_crlf(text.utf16_span())) {
+            m_trivial_grapheme_text_length = text.length_in_code_units();
+            m_trivial_current_boundary = 0;
+            m_segmented_text = Empty {};
+            return;
+        }
+
         m_segmented_text = icu::UnicodeString { text.utf16_span().data(), static_cast<i32>(text.length_in_code_units()) };
         m_segmenter->setText(m_segmented_text.get<icu::UnicodeString>());
     }
 
     virtual size_t current_boundary() override
     {
+        if (m_trivial_grapheme_text_length.has_value())
+            return m_trivial_current_boundary;
         return m_segmenter->current();
     }
 
     virtual Optional<size_t> previous_boundary(size_t boundary, Inclusive inclusive) override
     {
+        if (m_trivial_grapheme_text_length.has_value()) {
+            boundary = min(boundary, *m_trivial_grapheme_text_length);
+            if (inclusive == Inclusive::No) {
+                if (boundary == 0)
+                    return {};
+                --boundary;
+            }
+            return m_trivial_current_boundary = boundary;
+        }
+
         auto icu_boundary = align_boundary(boundary);
 
         if (inclusive == Inclusive::Yes) {
@@ -192,6 +236,16 @@ public:
 
     virtual Optional<size_t> next_boundary(size_t boundary, Inclusive inclusive) override
     {
+        if (m_trivial_grapheme_text_length.has_value()) {
+            boundary = min(boundary, *m_trivial_grapheme_text_length);
+            if (inclusive == Inclusive::No) {
+                if (boundary == *m_trivial_grapheme_text_length)
+                    return {};
+                ++boundary;
+            }
+            return m_trivial_current_boundary = boundary;
+        }
+
         auto icu_boundary = align_boundary(boundary);
 
         if (inclusive == Inclusive::Yes) {
@@ -249,6 +303,9 @@ public:
 
     virtual bool is_current_boundary_word_like() const override
     {
+        if (m_trivial_grapheme_text_length.has_value())
+            return false;
+
         auto status = m_segmenter->getRuleStatus();
 
         if (status >= UBRK_WORD_NUMBER && status < UBRK_WORD_NUMBER_LIMIT)
@@ -287,6 +344,15 @@ private:
 
     void for_each_boundary(SegmentationCallback callback)
     {
+        if (m_trivial_grapheme_text_length.has_value()) {
+            for (size_t boundary = 0; boundary <= *m_trivial_grapheme_text_length; ++boundary) {
+                m_trivial_current_boundary = boundary;
+                if (callback(boundary) == IterationDecision::Break)
+                    return;
+            }
+            return;
+        }
+
         if (callback(static_cast<size_t>(m_segmenter->first())) == IterationDecision::Break)
             return;
 
@@ -302,6 +368,12 @@ private:
 
     NonnullOwnPtr<icu::BreakIterator> m_segmenter;
     Variant<Empty, String, icu::UnicodeString> m_segmented_text;
+
+    // OPTIMIZATION: Text made only of Latin-1 characters, with no CR LF pair in it, has a grapheme boundary between
+    //               every two code units. This is the case for most text, so we compute those boundaries ourselves and
+    //               don't hand the text to ICU at all.
+    Optional<size_t> m_trivial_grapheme_text_length;
+    size_t m_trivial_current_boundary { 0 };
 };
 
 NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granularity)
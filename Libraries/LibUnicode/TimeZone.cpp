@@ -5,6 +5,7 @@
  */
 
 #include <AK/Array.h>
+#include <AK/Math.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/QuickSort.h>
 #include <LibUnicode/ICU.h>
@@ -55,6 +56,7 @@ String current_time_zone()
 void clear_system_time_zone_cache()
 {
     cached_system_time_zone.clear();
+    TimeZoneData::clear_cached_offsets();
 }
 
 ErrorOr<void> set_current_time_zone(StringView time_zone)
@@ -167,19 +169,36 @@ Optional<TimeZoneOffset> time_zone_offset(StringView time_zone, UnixDateTime tim
     if (!time_zone_data.has_value())
         return {};
 
-    i32 raw_offset = 0;
-    i32 dst_offset = 0;
+    auto to_time_zone_offset = [](i32 raw_offset, i32 dst_offset) {
+        return TimeZoneOffset {
+            .offset = AK::Duration::from_milliseconds(raw_offset + dst_offset),
+            .in_dst = dst_offset == 0 ? TimeZoneOffset::InDST::No : TimeZoneOffset::InDST::Yes,
+        };
+    };
 
     auto icu_time = to_icu_time(time);
 
+    // OPTIMIZATION: Consecutive lookups (e.g. formatting a list of dates, or repeated Date getters) tend to land between
+    //               the same two transitions, so we remember the offset of the most recently queried range.
+    if (auto const& cached_offset = time_zone_data->cached_offset(); cached_offset.has_value() && cached_offset->contains(icu_time))
+        return to_time_zone_offset(cached_offset->raw_offset, cached_offset->dst_offset);
+
+    i32 raw_offset = 0;
+    i32 dst_offset = 0;
+
     time_zone_data->time_zone().getOffset(icu_time, 0, raw_offset, dst_offset, status);
     if (icu_failure(status))
         return {};
 
-    return TimeZoneOffset {
-        .offset = AK::Duration::from_milliseconds(raw_offset + dst_offset),
-        .in_dst = dst_offset == 0 ? TimeZoneOffset::InDST::No : TimeZoneOffset::InDST::Yes,
-    };
+    auto& basic_time_zone = as<icu::BasicTimeZone>(time_zone_data->time_zone());
+    icu::TimeZoneTransition transition;
+
+    auto start = basic_time_zone.getPreviousTransition(icu_time, true, transition) ? transition.getTime() : -AK::Infinity<UDate>;
+    auto end = basic_time_zone.getNextTransition(icu_time, false, transition) ? transition.getTime() : AK::Infinity<UDate>;
+
+    time_zone_data->set_cached_offset({ .start = start, .end = end, .raw_offset = raw_offset, .dst_offset = dst_offset });
+
+    return to_time_zone_offset(raw_offset, dst_offset);
 }
 
 Vector<TimeZoneOffset> disambiguated_time_zone_offsets(StringView time_zone, UnixDateTime time)
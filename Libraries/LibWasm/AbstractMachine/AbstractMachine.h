@@ -712,7 +712,8 @@ public:
     explicit AbstractMachine() = default;
 
     // Validate a module; permanently sets the module's validity status.
-    ErrorOr<void, ValidationError> validate(Module&);
+    // NOTE: This does not touch any machine state, so it is safe to call from any thread.
+    static ErrorOr<void, ValidationError> validate(Module&);
     // Load and instantiate a module, and link it into this interpreter.
     InstantiationResult instantiate(Module const&, Vector<ExternValue>);
     Result invoke(FunctionAddress, Vector<Value>);
@@ -5148,7 +5148,8 @@ bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: load_and_push - Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
+    // NOTE: The access was bounds checked above, so there's no need for slice() to check it again.
+    ReadonlyBytes slice { memory->data().data() + instance_address, sizeof(ReadType) };
     entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
     dbgln_if(WASM_TRACE_DEBUG, "  loaded value: {}", entry.value());
     return false;
@@ -5448,7 +5449,11 @@ bool BytecodeInterpreter::store_value(Configuration& configuration, Instruction
     auto& memarg = instruction.arguments().unsafe_get<Instruction::MemoryArgument>();
     dbgln_if(WASM_TRACE_DEBUG, "stack({}) -> temporary({}b)", value, sizeof(StoreT));
     auto base = configuration.take_source<SourceAddressMix::Any>(address_source, addresses.sources).template to<i32>();
-    return store_to_memory(configuration, memarg, { &value, sizeof(StoreT) }, base);
+    auto const& address = configuration.frame().module().memories().data()[memarg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
+    u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + memarg.offset;
+    // NOTE: Storing the value as-is (rather than as a span of bytes) gives us a fixed-size memcpy.
+    return store_to_memory(*memory, instance_address, value);
 }
 
 template<size_t N>
@@ -5499,12 +5504,10 @@ template<typename T>
 T BytecodeInterpreter::read_value(ReadonlyBytes data)
 {
     VERIFY(sizeof(T) <= data.size());
-    if (bit_cast<FlatPtr>(data.data()) % alignof(T)) {
-        alignas(T) u8 buf[sizeof(T)];
-        memcpy(buf, data.data(), sizeof(T));
-        return bit_cast<LittleEndian<T>>(buf);
-    }
-    return *bit_cast<LittleEndian<T> const*>(data.data());
+    // NOTE: A fixed-size memcpy compiles down to a single (unaligned) load, so there's no need to branch on alignment.
+    LittleEndian<T> value;
+    memcpy(&value, data.data(), sizeof(T));
+    return value;
 }
 
 template<>
@@ -339,16 +339,10 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
-        auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            SetSign<ElementType> lhs = result[i];
-            SetSign<ElementType> rhs = other[i];
-            result[i] = op(lhs, rhs) ? static_cast<MakeUnsigned<ElementType>>(-1) : 0;
-        }
-        return bit_cast<u128>(result);
+        using VectorType = Native128ByteVectorOf<SetSign<NativeIntegralType<128 / VectorSize>>, SetSign>;
+        // NOTE: Comparing two vectors produces a mask with all bits of each lane set to the result,
+        //       which is exactly what wasm wants, and lowers to a single compare on SSE/NEON.
+        return bit_cast<u128>(Op {}(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
     }
 
     static StringView name()
@@ -372,14 +366,9 @@ template<size_t VectorSize, typename Op>
 struct VectorFloatCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
-        auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
-        auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        Native128ByteVectorOf<ElementType, MakeUnsigned> result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i)
-            result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
-        return bit_cast<u128>(result);
+        using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
+        // NOTE: Same as VectorCmpOp, NaN lanes compare the same way the scalar operators do.
+        return bit_cast<u128>(Op {}(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
     }
 
     static StringView name()
@@ -570,6 +559,19 @@ struct Ceil {
     static StringView name() { return "ceil"sv; }
 };
 
+template<size_t Offset, size_t Stride, typename VectorType, size_t... Idx>
+ALWAYS_INLINE static auto select_lanes_impl(VectorType vector, IndexSequence<Idx...>)
+{
+    return __builtin_shufflevector(vector, vector, (Offset + Idx * Stride)...);
+}
+
+// Picks VectorSize lanes starting at Offset, Stride lanes apart, and widens (or narrows) them into a VectorResult.
+template<typename VectorResult, size_t VectorSize, size_t Offset, size_t Stride, typename VectorInput>
+ALWAYS_INLINE static VectorResult convert_lanes(VectorInput vector)
+{
+    return __builtin_convertvector(select_lanes_impl<Offset, Stride>(vector, MakeIndexSequence<VectorSize>()), VectorResult);
+}
+
 template<size_t VectorSize, typename Op, template<typename> typename SetSign = MakeSigned>
 struct VectorIntegerExtOpPairwise {
     auto operator()(u128 c) const
@@ -577,15 +579,9 @@ struct VectorIntegerExtOpPairwise {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-        Op op;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
-        }
-
-        return bit_cast<u128>(result);
+        auto even = convert_lanes<VectorResult, VectorSize, 0, 2>(vector);
+        auto odd = convert_lanes<VectorResult, VectorSize, 1, 2>(vector);
+        return bit_cast<u128>(Op {}(even, odd));
     }
 
     static StringView name()
@@ -615,19 +611,8 @@ struct VectorIntegerExt {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
         auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+        return bit_cast<u128>(convert_lanes<VectorResult, VectorSize, offset, 1>(vector));
     }
 
     static StringView name()
@@ -651,27 +636,10 @@ struct VectorIntegerExtOp {
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto first = bit_cast<VectorInput>(lhs);
-        auto second = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-        Op op;
-
-        using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High) {
-                ResultType a = first[VectorSize + i];
-                ResultType b = second[VectorSize + i];
-                result[i] = op(a, b);
-            } else if constexpr (Mode == VectorExt::Low) {
-                ResultType a = first[i];
-                ResultType b = second[i];
-                result[i] = op(a, b);
-            } else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        constexpr size_t offset = Mode == VectorExt::High ? VectorSize : 0;
+        auto first = convert_lanes<VectorResult, VectorSize, offset, 1>(bit_cast<VectorInput>(lhs));
+        auto second = convert_lanes<VectorResult, VectorSize, offset, 1>(bit_cast<VectorInput>(rhs));
+        return bit_cast<u128>(Op {}(first, second));
     }
 
     static StringView name()
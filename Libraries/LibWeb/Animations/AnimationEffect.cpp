@@ -854,7 +854,15 @@ AnimationUpdateContext::~AnimationUpdateContext()
             if (invalidation.rebuild_accumulated_visual_contexts)
                 element.document().set_needs_accumulated_visual_contexts_update(true);
 
-            element.document().set_needs_display();
+            // OPTIMIZATION: Animating transform or opacity alone only changes visual contexts, which the cached display
+            //               list can be updated with without walking the paint tree again.
+            if (invalidation.rebuild_accumulated_visual_contexts && !invalidation.rerecord_display_list && !invalidation.relayout
+                && !invalidation.rebuild_layout_tree && !invalidation.rebuild_stacking_context_tree) {
+                element.document().invalidate_visual_contexts_of_display_list();
+                element.document().set_needs_display(InvalidateDisplayList::No);
+            } else {
+                element.document().set_needs_display();
+            }
         }
         if (invalidation.rebuild_stacking_context_tree)
             element.document().invalidate_stacking_context_tree();
@@ -929,6 +929,10 @@ void KeyframeEffect::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_target_element);
     visitor.visit(m_keyframe_objects);
+    for (auto const& cached_values : m_cached_computed_key_frame_values) {
+        if (cached_values.has_value())
+            visitor.visit(cached_values->key.style);
+    }
 }
 
 void KeyframeEffect::update_computed_properties(AnimationUpdateContext& context)
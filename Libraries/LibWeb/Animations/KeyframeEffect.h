@@ -6,11 +6,14 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Optional.h>
 #include <AK/RedBlackTree.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Bindings/KeyframeEffectPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/CSS/Length.h>
+#include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
 
@@ -75,6 +78,30 @@ public:
     };
     static void generate_initial_and_final_frames(RefPtr<KeyFrameSet>, HashTable<CSS::PropertyID> const& animated_properties);
 
+    // The computed values of a keyframe only depend on the inputs recorded here, as long as computing them didn't
+    // have to look at any animated values. Those are reused across animation frames instead of being recomputed on
+    // every tick.
+    struct ComputedKeyFrameValuesKey {
+        RefPtr<KeyFrameSet const> key_frame_set;
+        KeyFrameSet::ResolvedKeyFrame const* keyframe { nullptr };
+        GC::Ptr<CSS::ComputedProperties> style;
+        CSS::Length::FontMetrics font_metrics;
+        CSS::Length::FontMetrics root_font_metrics;
+        CSSPixelRect viewport_rect;
+        CSS::PreferredColorScheme color_scheme;
+        double device_pixels_per_css_pixel { 1 };
+
+        bool operator==(ComputedKeyFrameValuesKey const&) const = default;
+    };
+    struct ComputedKeyFrameValues {
+        ComputedKeyFrameValuesKey key;
+        HashMap<CSS::PropertyID, RefPtr<CSS::StyleValue const>> values;
+    };
+    enum class KeyFrameBoundary : u8 {
+        Start,
+        End,
+    };
+
     static int composite_order(GC::Ref<KeyframeEffect>, GC::Ref<KeyframeEffect>);
 
     static GC::Ref<KeyframeEffect> create(JS::Realm&);
@@ -109,6 +136,8 @@ public:
     KeyFrameSet const* key_frame_set() { return m_key_frame_set; }
     void set_key_frame_set(RefPtr<KeyFrameSet const> key_frame_set) { m_key_frame_set = key_frame_set; }
 
+    Optional<ComputedKeyFrameValues>& cached_computed_key_frame_values(KeyFrameBoundary boundary) { return m_cached_computed_key_frame_values[to_underlying(boundary)]; }
+
     virtual bool is_keyframe_effect() const override { return true; }
 
     virtual void update_computed_properties(AnimationUpdateContext&) override;
@@ -136,6 +165,9 @@ private:
     Vector<GC::Ref<JS::Object>> m_keyframe_objects {};
 
     RefPtr<KeyFrameSet const> m_key_frame_set {};
+
+    // The computed values of the keyframes the current iteration is interpolating between.
+    Array<Optional<ComputedKeyFrameValues>, 2> m_cached_computed_key_frame_values;
 };
 
 }
@@ -99,12 +99,6 @@ void initialize_main_thread_vm(AgentType type)
 {
     VERIFY(!s_main_thread_vm);
 
-    // Initialize Python engine before creating the JS VM
-    HTML::PythonEngine::initialize();
-
-    // Initialize Python DOM API bindings
-    // Web::Bindings::PythonDOMAPI::initialize_module();
-
     s_main_thread_vm = JS::VM::create();
     s_main_thread_vm->set_agent(create_agent(s_main_thread_vm->heap(), type));
 
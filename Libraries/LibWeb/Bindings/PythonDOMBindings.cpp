@@ -4,19 +4,31 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PythonDOMBindings.h>
 #include <LibWeb/Bindings/PythonDOMWrapperCache.h>
 #include <LibWeb/Bindings/PythonCompat.h>
+#include <LibWeb/Bindings/PythonJSBridge.h>
 #include <LibWeb/Bindings/TestPythonDOMModule.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/DocumentFragment.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeList.h>
+#include <LibWeb/HTML/DedicatedWorkerGlobalScope.h>
 #include <LibWeb/HTML/History.h>
+#include <LibWeb/HTML/Scripting/PythonAsyncTask.h>
+#include <LibWeb/HTML/Scripting/PythonPerformanceMetrics.h>
 #include <LibWeb/HTML/Location.h>
+#include <LibWeb/HTML/MessageEvent.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/TrustedTypes/TrustedHTML.h>
+#include <LibWeb/WebIDL/CallbackType.h>
 #include <LibGC/Heap.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <AK/OwnPtr.h>
 
 namespace Web::Bindings {
@@ -25,18 +37,36 @@ namespace Web::Bindings {
 typedef struct {
     PyObject_HEAD
         Web::DOM::Document* document;
+    PythonDOMWrapperCache* cache;
+    PyObject* weakreflist;
 } PythonDocumentObject;
 
+static_assert(offsetof(PythonDocumentObject, document) == offsetof(PythonDOMWrapperObject, cell));
+static_assert(offsetof(PythonDocumentObject, cache) == offsetof(PythonDOMWrapperObject, cache));
+static_assert(offsetof(PythonDocumentObject, weakreflist) == offsetof(PythonDOMWrapperObject, weakreflist));
+
 typedef struct {
     PyObject_HEAD
         Web::DOM::Element* element;
+    PythonDOMWrapperCache* cache;
+    PyObject* weakreflist;
 } PythonElementObject;
 
+static_assert(offsetof(PythonElementObject, element) == offsetof(PythonDOMWrapperObject, cell));
+static_assert(offsetof(PythonElementObject, cache) == offsetof(PythonDOMWrapperObject, cache));
+static_assert(offsetof(PythonElementObject, weakreflist) == offsetof(PythonDOMWrapperObject, weakreflist));
+
 typedef struct {
     PyObject_HEAD
         Web::HTML::Window* window;
+    PythonDOMWrapperCache* cache;
+    PyObject* weakreflist;
 } PythonWindowObject;
 
+static_assert(offsetof(PythonWindowObject, window) == offsetof(PythonDOMWrapperObject, cell));
+static_assert(offsetof(PythonWindowObject, cache) == offsetof(PythonDOMWrapperObject, cache));
+static_assert(offsetof(PythonWindowObject, weakreflist) == offsetof(PythonDOMWrapperObject, weakreflist));
+
 // Forward declarations for type objects
 PyTypeObject PythonDocument::s_type;
 PyTypeObject PythonElement::s_type;
@@ -45,12 +75,238 @@ PyTypeObject PythonWindow::s_type;
 PyObject* PythonDOMAPI::s_module = nullptr;
 bool PythonDOMAPI::s_initialized = false;
 
+// Bulk helpers shared by the Document and Element wrappers. They let Python build or read many
+// nodes in a single native call instead of crossing the bridge once per node or attribute.
+static Optional<String> python_string_to_string(PyObject* object, char const* what)
+{
+    if (!PyUnicode_Check(object)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a string", what);
+        return {};
+    }
+
+    Py_ssize_t length = 0;
+    char const* utf8 = PyUnicode_AsUTF8AndSize(object, &length);
+    if (!utf8)
+        return {};
+    return MUST(String::from_utf8(StringView { utf8, static_cast<size_t>(length) }));
+}
+
+// Builds an element from a spec of the form "tag" or (tag[, attributes[, text[, children]]]),
+// where attributes is a dict of strings, text is a string and children is a sequence of specs.
+static GC::Ptr<Web::DOM::Element> python_build_element(Web::DOM::Document& document, PyObject* spec, size_t& created_count)
+{
+    PyObject* tag_object = spec;
+    PyObject* attributes_object = nullptr;
+    PyObject* text_object = nullptr;
+    PyObject* children_object = nullptr;
+
+    if (PyTuple_Check(spec)) {
+        if (!PyArg_ParseTuple(spec, "O|OOO", &tag_object, &attributes_object, &text_object, &children_object))
+            return nullptr;
+    }
+
+    auto tag_name = python_string_to_string(tag_object, "Element tag name");
+    if (!tag_name.has_value())
+        return nullptr;
+
+    auto element_or_error = document.create_element(*tag_name, Web::DOM::ElementCreationOptions {});
+    if (element_or_error.is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "Invalid element tag name");
+        return nullptr;
+    }
+    auto element = element_or_error.release_value();
+    ++created_count;
+
+    if (attributes_object && attributes_object != Py_None) {
+        if (!PyDict_Check(attributes_object)) {
+            PyErr_SetString(PyExc_TypeError, "Element attributes must be a dict");
+            return nullptr;
+        }
+
+        PyObject* key = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t position = 0;
+        while (PyDict_Next(attributes_object, &position, &key, &value)) {
+            auto name = python_string_to_string(key, "Attribute name");
+            if (!name.has_value())
+                return nullptr;
+            auto attribute_value = python_string_to_string(value, "Attribute value");
+            if (!attribute_value.has_value())
+                return nullptr;
+            // NB: This goes through the same validation as setAttribute(), which rejects invalid names, lowercases
+            //     names in HTML documents and applies Trusted Types.
+            if (element->set_attribute_for_bindings(FlyString(*name), *attribute_value).is_error()) {
+                PyErr_Format(PyExc_ValueError, "Unable to set attribute \"%s\"", name->to_byte_string().characters());
+                return nullptr;
+            }
+        }
+    }
+
+    if (text_object && text_object != Py_None) {
+        auto text = python_string_to_string(text_object, "Element text");
+        if (!text.has_value())
+            return nullptr;
+        if (element->set_text_content(Utf16String::from_utf8(*text)).is_error()) {
+            PyErr_SetString(PyExc_RuntimeError, "Failed to set text content");
+            return nullptr;
+        }
+    }
+
+    if (children_object && children_object != Py_None) {
+        PyObject* children = PySequence_Fast(children_object, "Element children must be a sequence");
+        if (!children)
+            return nullptr;
+
+        auto child_count = PySequence_Fast_GET_SIZE(children);
+        for (Py_ssize_t i = 0; i < child_count; ++i) {
+            auto child = python_build_element(document, PySequence_Fast_GET_ITEM(children, i), created_count);
+            if (!child || element->append_child(*child).is_error()) {
+                if (!PyErr_Occurred())
+                    PyErr_SetString(PyExc_RuntimeError, "Failed to append child");
+                Py_DECREF(children);
+                return nullptr;
+            }
+        }
+        Py_DECREF(children);
+    }
+
+    return element;
+}
 
+// Builds every spec into a detached fragment first, so the live tree is only mutated once.
+static PyObject* python_append_elements(Web::DOM::Node& parent, PyObject* args)
+{
+    PyObject* specs_object = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &specs_object)) {
+        return nullptr;
+    }
+
+    PyObject* specs = PySequence_Fast(specs_object, "append_elements() expects a sequence of element specs");
+    if (!specs)
+        return nullptr;
+
+    auto& document = parent.document();
+    auto fragment = document.create_document_fragment();
+    size_t created_count = 0;
+
+    auto spec_count = PySequence_Fast_GET_SIZE(specs);
+    for (Py_ssize_t i = 0; i < spec_count; ++i) {
+        auto element = python_build_element(document, PySequence_Fast_GET_ITEM(specs, i), created_count);
+        if (!element || fragment->append_child(*element).is_error()) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_RuntimeError, "Failed to append child");
+            Py_DECREF(specs);
+            return nullptr;
+        }
+    }
+    Py_DECREF(specs);
+
+    if (parent.append_child(fragment).is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "Failed to append elements");
+        return nullptr;
+    }
+
+    return PyLong_FromSize_t(created_count);
+}
+
+// Returns one dict of attributes per element matching the selector. When a sequence of names is
+// given, only those attributes are read (missing ones map to None); otherwise all are returned.
+static PyObject* python_select_attributes(Web::DOM::ParentNode& root, PyObject* args)
+{
+    char const* selector = nullptr;
+    PyObject* names_object = Py_None;
+    if (!PyArg_ParseTuple(args, "s|O", &selector, &names_object)) {
+        return nullptr;
+    }
+
+    Vector<FlyString> names;
+    bool const all_attributes = names_object == Py_None;
+    if (!all_attributes) {
+        PyObject* names_sequence = PySequence_Fast(names_object, "Attribute names must be a sequence");
+        if (!names_sequence)
+            return nullptr;
+
+        auto name_count = PySequence_Fast_GET_SIZE(names_sequence);
+        names.ensure_capacity(name_count);
+        for (Py_ssize_t i = 0; i < name_count; ++i) {
+            auto name = python_string_to_string(PySequence_Fast_GET_ITEM(names_sequence, i), "Attribute name");
+            if (!name.has_value()) {
+                Py_DECREF(names_sequence);
+                return nullptr;
+            }
+            names.unchecked_append(FlyString(*name));
+        }
+        Py_DECREF(names_sequence);
+    }
+
+    auto elements = root.query_selector_all(StringView { selector, strlen(selector) });
+    if (elements.is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "Invalid selector");
+        return nullptr;
+    }
+
+    auto node_list = elements.release_value();
+    PyObject* result = PyList_New(static_cast<Py_ssize_t>(node_list->length()));
+    if (!result)
+        return nullptr;
+
+    auto set_item = [](PyObject* dict, StringView key, Optional<String> const& value) {
+        PyObject* key_object = PyUnicode_FromStringAndSize(key.characters_without_null_termination(), key.length());
+        PyObject* value_object = Py_None;
+        if (value.has_value()) {
+            auto value_view = value->bytes_as_string_view();
+            value_object = PyUnicode_FromStringAndSize(value_view.characters_without_null_termination(), value_view.length());
+        } else {
+            Py_INCREF(value_object);
+        }
+        bool ok = key_object && value_object && PyDict_SetItem(dict, key_object, value_object) == 0;
+        Py_XDECREF(key_object);
+        Py_XDECREF(value_object);
+        return ok;
+    };
+
+    for (size_t i = 0; i < node_list->length(); ++i) {
+        auto const& element = static_cast<Web::DOM::Element const&>(*node_list->item(i));
+
+        PyObject* attributes = PyDict_New();
+        if (!attributes) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+
+        bool ok = true;
+        if (all_attributes) {
+            element.for_each_attribute([&](FlyString const& name, String const& value) {
+                if (ok)
+                    ok = set_item(attributes, name.bytes_as_string_view(), value);
+            });
+        } else {
+            for (auto const& name : names) {
+                if (!set_item(attributes, name.bytes_as_string_view(), element.get_attribute(name))) {
+                    ok = false;
+                    break;
+                }
+            }
+        }
+
+        if (!ok) {
+            Py_DECREF(attributes);
+            Py_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, static_cast<Py_ssize_t>(i), attributes);
+    }
+
+    return result;
+}
 
 // PythonDocument methods
 static void python_document_dealloc(PythonDocumentObject* self)
 {
     // Don't delete the C++ document, just the Python wrapper
+    PythonDOMWrapperCache::wrapper_will_be_deallocated(*reinterpret_cast<PythonDOMWrapperObject*>(self));
+    if (self->weakreflist)
+        PyObject_ClearWeakRefs((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -263,6 +519,31 @@ static PyObject* python_document_create_text_node(PythonDocumentObject* self, Py
     Py_RETURN_NONE;
 }
 
+static PyObject* python_document_append_elements(PythonDocumentObject* self, PyObject* args)
+{
+    if (!self->document) {
+        PyErr_SetString(PyExc_RuntimeError, "Document object is invalid");
+        return nullptr;
+    }
+
+    auto body = self->document->body();
+    if (!body) {
+        PyErr_SetString(PyExc_RuntimeError, "Document has no body");
+        return nullptr;
+    }
+    return python_append_elements(*body, args);
+}
+
+static PyObject* python_document_select_attributes(PythonDocumentObject* self, PyObject* args)
+{
+    if (!self->document) {
+        PyErr_SetString(PyExc_RuntimeError, "Document object is invalid");
+        return nullptr;
+    }
+
+    return python_select_attributes(*self->document, args);
+}
+
 static PyMethodDef python_document_methods[] = {
     { "select", (PyCFunction)python_document_select, METH_VARARGS, "Select elements using CSS selector" },
     { "find", (PyCFunction)python_document_find, METH_VARARGS, "Find first element using CSS selector" },
@@ -271,6 +552,8 @@ static PyMethodDef python_document_methods[] = {
     { "get_elements_by_class_name", (PyCFunction)python_document_get_elements_by_class_name, METH_VARARGS, "Get elements by class name" },
     { "get_elements_by_tag_name", (PyCFunction)python_document_get_elements_by_tag_name, METH_VARARGS, "Get elements by tag name" },
     { "create_text_node", (PyCFunction)python_document_create_text_node, METH_VARARGS, "Create a text node" },
+    { "append_elements", (PyCFunction)python_document_append_elements, METH_VARARGS, "Build element specs and append them to the body in one operation" },
+    { "select_attributes", (PyCFunction)python_document_select_attributes, METH_VARARGS, "Read attributes of all elements matching a CSS selector" },
     { NULL, NULL, 0, NULL } // Sentinel
 };
 
@@ -299,7 +582,7 @@ static PyTypeObject document_type = {
     0,                           /* tp_traverse */
     0,                           /* tp_clear */
     0,                           /* tp_richcompare */
-    0,                           /* tp_weaklistoffset */
+    offsetof(PythonDocumentObject, weakreflist), /* tp_weaklistoffset */
     0,                           /* tp_iter */
     0,                           /* tp_iternext */
     python_document_methods,     /* tp_methods */
@@ -346,14 +629,16 @@ PyObject* PythonDocument::create_from_cpp_document(Web::DOM::Document& document)
     setup_type();
 
     if (!document.m_python_dom_wrapper_cache)
-        document.m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>();
-    if (auto* wrapper = document.m_python_dom_wrapper_cache->get_wrapper(&document))
+        document.m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>(document.heap());
+    if (auto* wrapper = document.m_python_dom_wrapper_cache->get_wrapper(document))
         return wrapper;
 
     PythonDocumentObject* obj = PyObject_New(PythonDocumentObject, &s_type);
     if (obj) {
         obj->document = &document;
-        document.m_python_dom_wrapper_cache->set_wrapper(&document, (PyObject*)obj);
+        obj->cache = nullptr;
+        obj->weakreflist = nullptr;
+        document.m_python_dom_wrapper_cache->set_wrapper(document, *reinterpret_cast<PythonDOMWrapperObject*>(obj));
     }
     return (PyObject*)obj;
 }
@@ -370,6 +655,9 @@ Web::DOM::Document* PythonDocument::get_cpp_document(PyObject* obj)
 static void python_element_dealloc(PythonElementObject* self)
 {
     // Don't delete the C++ element, just the Python wrapper
+    PythonDOMWrapperCache::wrapper_will_be_deallocated(*reinterpret_cast<PythonDOMWrapperObject*>(self));
+    if (self->weakreflist)
+        PyObject_ClearWeakRefs((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -737,6 +1025,26 @@ static int python_element_set_inner_html(PythonElementObject* self, PyObject* va
     return 0;
 }
 
+static PyObject* python_element_append_elements(PythonElementObject* self, PyObject* args)
+{
+    if (!self->element) {
+        PyErr_SetString(PyExc_RuntimeError, "Element object is invalid");
+        return nullptr;
+    }
+
+    return python_append_elements(*self->element, args);
+}
+
+static PyObject* python_element_select_attributes(PythonElementObject* self, PyObject* args)
+{
+    if (!self->element) {
+        PyErr_SetString(PyExc_RuntimeError, "Element object is invalid");
+        return nullptr;
+    }
+
+    return python_select_attributes(*self->element, args);
+}
+
 static PyMethodDef python_element_methods[] = {
     { "select", (PyCFunction)python_element_select, METH_VARARGS, "Select child elements using CSS selector" },
     { "find", (PyCFunction)python_element_find, METH_VARARGS, "Find first child element using CSS selector" },
@@ -747,6 +1055,8 @@ static PyMethodDef python_element_methods[] = {
     { "append_child", (PyCFunction)python_element_append_child, METH_VARARGS, "Append a child element" },
     { "remove_child", (PyCFunction)python_element_remove_child, METH_VARARGS, "Remove a child element" },
     { "replace_child", (PyCFunction)python_element_replace_child, METH_VARARGS, "Replace a child element" },
+    { "append_elements", (PyCFunction)python_element_append_elements, METH_VARARGS, "Build element specs and append them in one operation" },
+    { "select_attributes", (PyCFunction)python_element_select_attributes, METH_VARARGS, "Read attributes of all descendants matching a CSS selector" },
     { NULL, NULL, 0, NULL } // Sentinel
 };
 
@@ -781,7 +1091,7 @@ static PyTypeObject element_type = {
     0,                           /* tp_traverse */
     0,                           /* tp_clear */
     0,                           /* tp_richcompare */
-    0,                           /* tp_weaklistoffset */
+    offsetof(PythonElementObject, weakreflist), /* tp_weaklistoffset */
     0,                           /* tp_iter */
     0,                           /* tp_iternext */
     python_element_methods,      /* tp_methods */
@@ -830,14 +1140,16 @@ PyObject* PythonElement::create_from_cpp_element(Web::DOM::Element& element)
     auto& document_ref = element.document();
     auto* document_ptr = &document_ref;
     if (!document_ptr->m_python_dom_wrapper_cache)
-        document_ptr->m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>();
-    if (auto* wrapper = document_ptr->m_python_dom_wrapper_cache->get_wrapper(&element))
+        document_ptr->m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>(document_ptr->heap());
+    if (auto* wrapper = document_ptr->m_python_dom_wrapper_cache->get_wrapper(element))
         return wrapper;
 
     PythonElementObject* obj = PyObject_New(PythonElementObject, &s_type);
     if (obj) {
         obj->element = &element;
-        document_ptr->m_python_dom_wrapper_cache->set_wrapper(&element, (PyObject*)obj);
+        obj->cache = nullptr;
+        obj->weakreflist = nullptr;
+        document_ptr->m_python_dom_wrapper_cache->set_wrapper(element, *reinterpret_cast<PythonDOMWrapperObject*>(obj));
     }
     return (PyObject*)obj;
 }
@@ -853,6 +1165,9 @@ Web::DOM::Element* PythonElement::get_cpp_element(PyObject* obj)
 // PythonWindow methods
 static void python_window_dealloc(PythonWindowObject* self)
 {
+    PythonDOMWrapperCache::wrapper_will_be_deallocated(*reinterpret_cast<PythonDOMWrapperObject*>(self));
+    if (self->weakreflist)
+        PyObject_ClearWeakRefs((PyObject*)self);
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -917,7 +1232,7 @@ static PyTypeObject window_type = {
     0,                           /* tp_traverse */
     0,                           /* tp_clear */
     0,                           /* tp_richcompare */
-    0,                           /* tp_weaklistoffset */
+    offsetof(PythonWindowObject, weakreflist), /* tp_weaklistoffset */
     0,                           /* tp_iter */
     0,                           /* tp_iternext */
     0,                           /* tp_methods */
@@ -969,14 +1284,16 @@ PyObject* PythonWindow::create_from_cpp_window(Web::HTML::Window& window)
     // Dereference GC::Ref to get const Document&, then const_cast to mutable
     auto* document_mut = const_cast<Web::DOM::Document*>(&*document_ref);
     if (!document_mut->m_python_dom_wrapper_cache)
-        document_mut->m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>();
-    if (auto* wrapper = document_mut->m_python_dom_wrapper_cache->get_wrapper(&window))
+        document_mut->m_python_dom_wrapper_cache = make<PythonDOMWrapperCache>(document_mut->heap());
+    if (auto* wrapper = document_mut->m_python_dom_wrapper_cache->get_wrapper(window))
         return wrapper;
 
     PythonWindowObject* obj = PyObject_New(PythonWindowObject, &s_type);
     if (obj) {
         obj->window = &window;
-        document_mut->m_python_dom_wrapper_cache->set_wrapper(&window, (PyObject*)obj);
+        obj->cache = nullptr;
+        obj->weakreflist = nullptr;
+        document_mut->m_python_dom_wrapper_cache->set_wrapper(window, *reinterpret_cast<PythonDOMWrapperObject*>(obj));
     }
     return (PyObject*)obj;
 }
@@ -997,8 +1314,181 @@ static PyObject* python_get_window(PyObject*, PyObject*)
     Py_RETURN_NONE;
 }
 
+// Keeps a Python callable alive for as long as the JS function that forwards to it.
+struct PythonCallbackHolder : public RefCounted<PythonCallbackHolder> {
+    explicit PythonCallbackHolder(PyObject* callable)
+        : callable(callable)
+    {
+        Py_INCREF(callable);
+    }
+
+    ~PythonCallbackHolder()
+    {
+        PyGILState_STATE gstate = PyGILState_Ensure();
+        Py_DECREF(callable);
+        PyGILState_Release(gstate);
+    }
+
+    PyObject* callable { nullptr };
+};
+
+static Web::HTML::DedicatedWorkerGlobalScope* current_dedicated_worker_global_scope()
+{
+    auto& vm = main_thread_vm();
+    if (vm.execution_context_stack().is_empty() || !vm.current_realm()) {
+        PyErr_SetString(PyExc_RuntimeError, "No script is currently running");
+        return nullptr;
+    }
+
+    auto* scope = as_if<Web::HTML::DedicatedWorkerGlobalScope>(vm.current_realm()->global_object());
+    if (!scope)
+        PyErr_SetString(PyExc_RuntimeError, "Worker messaging is only available in dedicated worker scripts");
+    return scope;
+}
+
+static PyObject* python_post_message(PyObject*, PyObject* args)
+{
+    PyObject* message = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &message)) {
+        return nullptr;
+    }
+
+    auto* scope = current_dedicated_worker_global_scope();
+    if (!scope)
+        return nullptr;
+
+    auto& realm = scope->realm();
+    auto value = PythonJSBridge::python_to_js(message, realm);
+
+    // Binary payloads were just copied into a fresh ArrayBuffer by the bridge, so transfer that buffer
+    // to the owner instead of letting structured serialization copy it a second time.
+    Vector<GC::Root<JS::Object>> transfer;
+    if (value.is_object()) {
+        auto& object = value.as_object();
+        if (auto* typed_array = as_if<JS::TypedArrayBase>(object))
+            transfer.append(GC::make_root(*typed_array->viewed_array_buffer()));
+        else if (is<JS::ArrayBuffer>(object))
+            transfer.append(GC::make_root(object));
+    }
+
+    if (scope->post_message(value, transfer).is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "Failed to post message");
+        return nullptr;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyObject* python_on_message(PyObject*, PyObject* args)
+{
+    PyObject* callback = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &callback)) {
+        return nullptr;
+    }
+
+    if (callback != Py_None && !PyCallable_Check(callback)) {
+        PyErr_SetString(PyExc_TypeError, "on_message() expects a callable or None");
+        return nullptr;
+    }
+
+    auto* scope = current_dedicated_worker_global_scope();
+    if (!scope)
+        return nullptr;
+
+    if (callback == Py_None) {
+        scope->set_onmessage(nullptr);
+        Py_RETURN_NONE;
+    }
+
+    auto& realm = scope->realm();
+    auto holder = adopt_ref(*new PythonCallbackHolder(callback));
+    auto function = JS::NativeFunction::create(
+        realm, [holder](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+            auto& event = as<Web::HTML::MessageEvent>(vm.argument(0).as_object());
+
+            PyGILState_STATE gstate = PyGILState_Ensure();
+            PyObject* data = PythonJSBridge::js_to_python(event.data(), vm);
+            PyObject* result = data ? PyObject_CallFunctionObjArgs(holder->callable, data, nullptr) : nullptr;
+            Py_XDECREF(data);
+
+            Optional<String> error_message;
+            if (!result) {
+                error_message = "Python message handler raised an exception"_string;
+                PyObject* error_type = nullptr;
+                PyObject* error_value = nullptr;
+                PyObject* error_traceback = nullptr;
+                PyErr_Fetch(&error_type, &error_value, &error_traceback);
+                if (PyObject* error_str = error_value ? PyObject_Str(error_value) : nullptr) {
+                    if (char const* error_cstr = PyUnicode_AsUTF8(error_str))
+                        error_message = MUST(String::from_utf8(StringView { error_cstr, strlen(error_cstr) }));
+                    Py_DECREF(error_str);
+                }
+                PyErr_Clear();
+                Py_XDECREF(error_type);
+                Py_XDECREF(error_value);
+                Py_XDECREF(error_traceback);
+            }
+            Py_XDECREF(result);
+            PyGILState_Release(gstate);
+
+            if (error_message.has_value())
+                return vm.throw_completion<JS::Error>(error_message.release_value());
+            return JS::js_undefined();
+        },
+        1, Utf16FlyString {}, &realm);
+
+    scope->set_onmessage(realm.heap().allocate<WebIDL::CallbackType>(*function, realm));
+    Py_RETURN_NONE;
+}
+
+static PyObject* python_start_profiling(PyObject*, PyObject* args, PyObject* kwargs)
+{
+    static char const* keywords[] = { "interval_ms", nullptr };
+    double interval_ms = 1.0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|d", const_cast<char**>(keywords), &interval_ms)) {
+        return nullptr;
+    }
+
+    if (interval_ms < 0) {
+        PyErr_SetString(PyExc_ValueError, "interval_ms must not be negative");
+        return nullptr;
+    }
+
+    if (HTML::PythonPerformanceMetrics::is_sampling_profiler_running()) {
+        PyErr_SetString(PyExc_RuntimeError, "The profiler is already running");
+        return nullptr;
+    }
+
+    HTML::PythonPerformanceMetrics::start_sampling_profiler(AK::Duration::from_microseconds(static_cast<i64>(interval_ms * 1000)));
+    Py_RETURN_NONE;
+}
+
+static PyObject* python_stop_profiling(PyObject*, PyObject*)
+{
+    auto samples = HTML::PythonPerformanceMetrics::stop_sampling_profiler();
+
+    PyObject* list = PyList_New(static_cast<Py_ssize_t>(samples.size()));
+    if (!list)
+        return nullptr;
+
+    for (size_t i = 0; i < samples.size(); ++i) {
+        auto const& sample = samples[i];
+        PyObject* entry = Py_BuildValue("(ssiK)", sample.filename.characters(), sample.function_name.characters(), sample.line, static_cast<unsigned long long>(sample.hit_count));
+        if (!entry) {
+            Py_DECREF(list);
+            return nullptr;
+        }
+        PyList_SET_ITEM(list, static_cast<Py_ssize_t>(i), entry);
+    }
+    return list;
+}
+
 static PyMethodDef web_module_methods[] = {
     { "get_window", python_get_window, METH_NOARGS, "Get the current window object" },
+    { "post_message", python_post_message, METH_VARARGS, "Post a message from a dedicated worker to its owner" },
+    { "on_message", python_on_message, METH_VARARGS, "Set the callable that receives messages sent to a dedicated worker" },
+    { "start_profiling", (PyCFunction)(void (*)(void))python_start_profiling, METH_VARARGS | METH_KEYWORDS, "Start sampling the running Python code every interval_ms milliseconds" },
+    { "stop_profiling", python_stop_profiling, METH_NOARGS, "Stop the profiler and return (filename, function, line, hits) tuples, hottest first" },
     { nullptr, nullptr, 0, nullptr } // Sentinel
 };
 
@@ -1056,6 +1546,13 @@ bool PythonDOMAPI::initialize_module()
         return false;
     }
 
+    // Add sleep(), fetch() and create_task() for coroutines running on the event loop
+    if (!HTML::PythonAsyncTask::add_functions_to_module(s_module)) {
+        Py_DECREF(s_module);
+        s_module = nullptr;
+        return false;
+    }
+
     // Add the test module
     if (auto* test_module = TestPythonDOMModule::get_module()) {
         Py_INCREF(test_module);
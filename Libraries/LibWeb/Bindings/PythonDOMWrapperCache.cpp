@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, Ladybird contributors
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Cell.h>
+#include <LibWeb/Bindings/PythonDOMWrapperCache.h>
+
+namespace Web::Bindings {
+
+PythonDOMWrapperCache::PythonDOMWrapperCache(GC::Heap& heap)
+    : GC::WeakContainer(heap)
+{
+}
+
+PythonDOMWrapperCache::~PythonDOMWrapperCache()
+{
+    // Wrappers may outlive the document that owns this cache; make sure they
+    // neither touch the cache nor the (dying) cells afterwards.
+    for (auto& it : m_wrapper_cache) {
+        it.value->cell = nullptr;
+        it.value->cache = nullptr;
+    }
+}
+
+PyObject* PythonDOMWrapperCache::get_wrapper(GC::Cell& cell)
+{
+    auto it = m_wrapper_cache.find(&cell);
+    if (it == m_wrapper_cache.end()) {
+        ++m_metrics.misses;
+        return nullptr;
+    }
+    ++m_metrics.hits;
+    auto* wrapper = reinterpret_cast<PyObject*>(it->value);
+    Py_INCREF(wrapper);
+    return wrapper;
+}
+
+void PythonDOMWrapperCache::set_wrapper(GC::Cell& cell, PythonDOMWrapperObject& wrapper)
+{
+    VERIFY(!wrapper.cache);
+    wrapper.cell = &cell;
+    wrapper.cache = this;
+    m_wrapper_cache.set(&cell, &wrapper);
+
+    m_metrics.live_wrappers = m_wrapper_cache.size();
+    m_metrics.peak_wrappers = max(m_metrics.peak_wrappers, m_metrics.live_wrappers);
+}
+
+void PythonDOMWrapperCache::wrapper_will_be_deallocated(PythonDOMWrapperObject& wrapper)
+{
+    if (wrapper.cache)
+        wrapper.cache->remove_wrapper(wrapper);
+}
+
+void PythonDOMWrapperCache::remove_wrapper(PythonDOMWrapperObject& wrapper)
+{
+    if (wrapper.cell) {
+        if (auto it = m_wrapper_cache.find(wrapper.cell); it != m_wrapper_cache.end() && it->value == &wrapper)
+            m_wrapper_cache.remove(it);
+    }
+    wrapper.cell = nullptr;
+    wrapper.cache = nullptr;
+
+    ++m_metrics.wrappers_released;
+    m_metrics.live_wrappers = m_wrapper_cache.size();
+}
+
+void PythonDOMWrapperCache::remove_dead_cells(Badge<GC::Heap>)
+{
+    // NOTE: This runs in the middle of a GC, so we only touch plain fields here and never call into Python.
+    m_wrapper_cache.remove_all_matching([&](GC::Cell* cell, PythonDOMWrapperObject* wrapper) {
+        if (cell->is_marked())
+            return false;
+        wrapper->cell = nullptr;
+        wrapper->cache = nullptr;
+        ++m_metrics.cells_collected;
+        return true;
+    });
+    m_metrics.live_wrappers = m_wrapper_cache.size();
+}
+
+}
@@ -7,37 +7,59 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <LibGC/Forward.h>
+#include <LibGC/WeakContainer.h>
 #include <Python.h>
 
 namespace Web::Bindings {
 
-// Per-document cache for Python wrappers
-class PythonDOMWrapperCache {
+class PythonDOMWrapperCache;
+
+// Common layout shared by every Python wrapper of a DOM cell. The concrete wrapper structs
+// (PythonDocumentObject, PythonElementObject, ...) must start with these exact fields.
+struct PythonDOMWrapperObject {
+    PyObject_HEAD
+        GC::Cell* cell;
+    PythonDOMWrapperCache* cache;
+    PyObject* weakreflist;
+};
+
+// Per-document cache for Python wrappers.
+// Entries are weak on both sides: the cache does not keep the Python wrapper alive (a wrapper
+// unregisters itself when it is deallocated), and it does not keep the DOM cell alive (when the
+// GC finds the cell dead, the wrapper is detached from it and the entry is dropped).
+class PythonDOMWrapperCache final : public GC::WeakContainer {
 public:
-    ~PythonDOMWrapperCache()
-    {
-        for (auto const& it : m_wrapper_cache) {
-            Py_DECREF(it.value);
-        }
-    }
-
-    PyObject* get_wrapper(void* cpp_object)
-    {
-        if (auto it = m_wrapper_cache.find(cpp_object); it != m_wrapper_cache.end()) {
-            Py_INCREF(it->value);
-            return it->value;
-        }
-        return nullptr;
-    }
-
-    void set_wrapper(void* cpp_object, PyObject* wrapper)
-    {
-        m_wrapper_cache.set(cpp_object, wrapper);
-        Py_INCREF(wrapper);
-    }
+    struct Metrics {
+        size_t live_wrappers { 0 };
+        size_t peak_wrappers { 0 };
+        u64 hits { 0 };
+        u64 misses { 0 };
+        u64 wrappers_released { 0 };
+        u64 cells_collected { 0 };
+    };
+
+    explicit PythonDOMWrapperCache(GC::Heap&);
+    virtual ~PythonDOMWrapperCache() override;
+
+    // Returns a new reference to the cached wrapper for the cell, or nullptr.
+    PyObject* get_wrapper(GC::Cell&);
+
+    // Registers a freshly created wrapper. The cache takes no reference to it.
+    void set_wrapper(GC::Cell&, PythonDOMWrapperObject&);
+
+    // Must be called from the wrapper's tp_dealloc.
+    static void wrapper_will_be_deallocated(PythonDOMWrapperObject&);
+
+    Metrics const& metrics() const { return m_metrics; }
+
+    virtual void remove_dead_cells(Badge<GC::Heap>) override;
 
 private:
-    HashMap<void*, PyObject*> m_wrapper_cache;
+    void remove_wrapper(PythonDOMWrapperObject&);
+
+    HashMap<GC::Cell*, PythonDOMWrapperObject*> m_wrapper_cache;
+    Metrics m_metrics;
 };
 
 }
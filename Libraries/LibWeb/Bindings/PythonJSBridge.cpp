@@ -7,11 +7,15 @@
 #include <AK/StringView.h>
 #include <AK/Utf16String.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibJS/Runtime/DataView.h>
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/PropertyKey.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibWeb/Bindings/PythonCompat.h>
 #include <LibWeb/Bindings/PythonJSBridge.h>
@@ -24,6 +28,159 @@ bool PythonJSBridge::s_bridge_initialized = false;
 PyObject* PythonJSBridge::s_js_proxy_type = nullptr;
 PyObject* PythonJSBridge::s_py_proxy_type = nullptr;
 
+// Binary data is converted with a single copy of the underlying bytes rather than element by element. The copy cannot
+// be avoided: a JS ArrayBuffer may be detached or resized at any time, which would leave a Python view over its storage
+// dangling, and a Python buffer export cannot be kept alive by the JS garbage collector.
+static char const* python_buffer_format_for_typed_array(JS::TypedArrayBase::Kind kind)
+{
+    switch (kind) {
+    case JS::TypedArrayBase::Kind::Uint8Array:
+    case JS::TypedArrayBase::Kind::Uint8ClampedArray:
+        return "B";
+    case JS::TypedArrayBase::Kind::Uint16Array:
+        return "H";
+    case JS::TypedArrayBase::Kind::Uint32Array:
+        return "I";
+    case JS::TypedArrayBase::Kind::BigUint64Array:
+        return "Q";
+    case JS::TypedArrayBase::Kind::Int8Array:
+        return "b";
+    case JS::TypedArrayBase::Kind::Int16Array:
+        return "h";
+    case JS::TypedArrayBase::Kind::Int32Array:
+        return "i";
+    case JS::TypedArrayBase::Kind::BigInt64Array:
+        return "q";
+    case JS::TypedArrayBase::Kind::Float16Array:
+        return "e";
+    case JS::TypedArrayBase::Kind::Float32Array:
+        return "f";
+    case JS::TypedArrayBase::Kind::Float64Array:
+        return "d";
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Converts an ArrayBuffer, typed array or DataView to a memoryview over a copy of its bytes. Typed arrays keep their
+// element type, so a Float32Array becomes a memoryview of format "f".
+static PyObject* buffer_source_to_python(JS::Object const& buffer_source)
+{
+    JS::ArrayBuffer const* array_buffer = nullptr;
+    size_t offset = 0;
+    size_t length = 0;
+    char const* format = nullptr;
+
+    if (auto const* typed_array = as_if<JS::TypedArrayBase>(buffer_source)) {
+        auto typed_array_record = JS::make_typed_array_with_buffer_witness_record(*typed_array, JS::ArrayBuffer::Order::SeqCst);
+        if (!JS::is_typed_array_out_of_bounds(typed_array_record)) {
+            array_buffer = typed_array->viewed_array_buffer();
+            offset = typed_array->byte_offset();
+            length = JS::typed_array_byte_length(typed_array_record);
+        }
+        format = python_buffer_format_for_typed_array(typed_array->kind());
+    } else if (auto const* data_view = as_if<JS::DataView>(buffer_source)) {
+        auto view_record = JS::make_data_view_with_buffer_witness_record(*data_view, JS::ArrayBuffer::Order::SeqCst);
+        if (!JS::is_view_out_of_bounds(view_record)) {
+            array_buffer = data_view->viewed_array_buffer();
+            offset = data_view->byte_offset();
+            length = JS::get_view_byte_length(view_record);
+        }
+    } else {
+        array_buffer = &as<JS::ArrayBuffer>(buffer_source);
+        length = array_buffer->byte_length();
+    }
+
+    ReadonlyBytes bytes;
+    if (array_buffer && !array_buffer->is_detached())
+        bytes = array_buffer->buffer().bytes().slice(offset, length);
+
+    PyObject* byte_array = PyByteArray_FromStringAndSize(reinterpret_cast<char const*>(bytes.data()), static_cast<Py_ssize_t>(bytes.size()));
+    if (!byte_array) {
+        return nullptr;
+    }
+
+    PyObject* view = PyMemoryView_FromObject(byte_array);
+    Py_DECREF(byte_array);
+    if (!view || !format) {
+        return view;
+    }
+
+    // Fall back to a plain byte view if this Python version can't cast to the element type.
+    PyObject* typed_view = PyObject_CallMethod(view, "cast", "s", format);
+    if (!typed_view) {
+        PyErr_Clear();
+        return view;
+    }
+
+    Py_DECREF(view);
+    return typed_view;
+}
+
+// Converts an object that supports the buffer protocol (bytes, bytearray, memoryview, array.array, ...) to a typed
+// array over a copy of its bytes. The element type follows the buffer's format, defaulting to Uint8Array.
+static Optional<JS::Value> python_buffer_to_js(PyObject* py_obj, JS::Realm& realm)
+{
+    Py_buffer view;
+    if (PyObject_GetBuffer(py_obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+        PyErr_Clear();
+        return {};
+    }
+
+    auto bytes_or_error = ByteBuffer::copy(ReadonlyBytes { static_cast<u8 const*>(view.buf), static_cast<size_t>(view.len) });
+
+    // Only native byte order can be reinterpreted as a typed array, anything else is exposed as raw bytes.
+    StringView format = view.format ? StringView { view.format, strlen(view.format) } : "B"sv;
+    if (format.starts_with('@') || format.starts_with('=') || format.starts_with('<'))
+        format = format.substring_view(1);
+    auto item_size = static_cast<size_t>(view.itemsize);
+
+    PyBuffer_Release(&view);
+
+    if (bytes_or_error.is_error()) {
+        return {};
+    }
+
+    auto byte_length = bytes_or_error.value().size();
+    auto array_buffer = JS::ArrayBuffer::create(realm, bytes_or_error.release_value());
+
+    auto element_count = [&](size_t element_size) { return static_cast<u32>(byte_length / element_size); };
+    auto is_signed_integer = format == "b"sv || format == "h"sv || format == "i"sv || format == "l"sv || format == "q"sv || format == "n"sv;
+    auto is_unsigned_integer = format == "B"sv || format == "H"sv || format == "I"sv || format == "L"sv || format == "Q"sv || format == "N"sv;
+
+    if (format == "e"sv && item_size == 2)
+        return JS::Float16Array::create(realm, element_count(2), *array_buffer);
+    if (format == "f"sv && item_size == 4)
+        return JS::Float32Array::create(realm, element_count(4), *array_buffer);
+    if (format == "d"sv && item_size == 8)
+        return JS::Float64Array::create(realm, element_count(8), *array_buffer);
+
+    if (is_signed_integer) {
+        switch (item_size) {
+        case 1:
+            return JS::Int8Array::create(realm, element_count(1), *array_buffer);
+        case 2:
+            return JS::Int16Array::create(realm, element_count(2), *array_buffer);
+        case 4:
+            return JS::Int32Array::create(realm, element_count(4), *array_buffer);
+        case 8:
+            return JS::BigInt64Array::create(realm, element_count(8), *array_buffer);
+        }
+    }
+
+    if (is_unsigned_integer) {
+        switch (item_size) {
+        case 2:
+            return JS::Uint16Array::create(realm, element_count(2), *array_buffer);
+        case 4:
+            return JS::Uint32Array::create(realm, element_count(4), *array_buffer);
+        case 8:
+            return JS::BigUint64Array::create(realm, element_count(8), *array_buffer);
+        }
+    }
+
+    return JS::Uint8Array::create(realm, static_cast<u32>(byte_length), *array_buffer);
+}
+
 bool PythonJSBridge::initialize_bridge()
 {
     if (s_bridge_initialized) {
@@ -74,6 +231,12 @@ JS::Value PythonJSBridge::python_to_js(PyObject* py_obj, JS::Realm& realm)
         return JS::js_undefined();
     }
 
+    if (PyObject_CheckBuffer(py_obj)) {
+        if (auto typed_array = python_buffer_to_js(py_obj, realm); typed_array.has_value()) {
+            return typed_array.release_value();
+        }
+    }
+
     if (PyDict_Check(py_obj)) {
         // Create a JS object from Python dict
         auto js_obj = JS::Object::create(realm, realm.intrinsics().object_prototype());
@@ -142,6 +305,16 @@ PyObject* PythonJSBridge::js_to_python(JS::Value js_val, JS::VM& vm)
     if (js_val.is_object()) {
         auto& obj = js_val.as_object();
 
+        // Handle binary data
+        if (is<JS::ArrayBuffer>(obj) || is<JS::TypedArrayBase>(obj) || is<JS::DataView>(obj)) {
+            return buffer_source_to_python(obj);
+        }
+
+        // Keep promises as live objects so Python coroutines can await them
+        if (is<JS::Promise>(obj)) {
+            return PythonJSObjectWrapper::create_wrapper(obj);
+        }
+
         // Handle arrays
         if (is<JS::Array>(obj)) {
             auto& array = static_cast<JS::Array&>(obj);
@@ -8,6 +8,7 @@
 #include <LibJS/Runtime/ExecutionContext.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Promise.h>
 #include <LibJS/Runtime/PropertyKey.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/VM.h>
@@ -15,10 +16,12 @@
 #include <LibWeb/Bindings/PythonCompat.h>
 #include <LibWeb/Bindings/PythonJSBridge.h>
 #include <LibWeb/Bindings/PythonJSObjectWrapper.h>
+#include <LibWeb/HTML/Scripting/PythonAsyncTask.h>
 
 namespace Web::Bindings {
 
 PyTypeObject PythonJSObjectWrapper::s_js_object_wrapper_type;
+static PyAsyncMethods s_js_object_wrapper_async_methods;
 
 void PythonJSObjectWrapper::setup_js_object_wrapper_type()
 {
@@ -39,6 +42,10 @@ void PythonJSObjectWrapper::setup_js_object_wrapper_type()
     s_js_object_wrapper_type.tp_setattro = (setattrofunc)wrapper_setattr;
     s_js_object_wrapper_type.tp_call = (ternaryfunc)wrapper_call;
 
+    // Promises are awaitable from Python coroutines driven by PythonAsyncTask.
+    s_js_object_wrapper_async_methods.am_await = (unaryfunc)wrapper_await;
+    s_js_object_wrapper_type.tp_as_async = &s_js_object_wrapper_async_methods;
+
     if (PyType_Ready(&s_js_object_wrapper_type) < 0) {
         // Handle error appropriately
     }
@@ -182,4 +189,15 @@ PyObject* PythonJSObjectWrapper::wrapper_call(JSObjectWrapper* self, PyObject* a
     return PythonJSBridge::js_to_python(result.release_value(), vm);
 }
 
+PyObject* PythonJSObjectWrapper::wrapper_await(JSObjectWrapper* self)
+{
+    auto* js_obj = static_cast<JS::Object*>(self->js_object_ptr);
+    if (!js_obj || !is<JS::Promise>(*js_obj)) {
+        PyErr_SetString(PyExc_TypeError, "JavaScript object is not a promise");
+        return nullptr;
+    }
+
+    return HTML::PythonAsyncTask::create_awaitable_for_promise(*js_obj);
+}
+
 }
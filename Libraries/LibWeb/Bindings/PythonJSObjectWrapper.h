@@ -37,6 +37,7 @@ private:
     static PyObject* wrapper_getattr(JSObjectWrapper* self, PyObject* attr_name);
     static int wrapper_setattr(JSObjectWrapper* self, PyObject* attr_name, PyObject* value);
     static PyObject* wrapper_call(JSObjectWrapper* self, PyObject* args, PyObject* kwargs);
+    static PyObject* wrapper_await(JSObjectWrapper* self);
 };
 
 }
\ No newline at end of file
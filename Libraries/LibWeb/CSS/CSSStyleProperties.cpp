@@ -551,17 +551,34 @@ Optional<StyleProperty> CSSStyleProperties::get_direct_property(PropertyNameAndI
         // 1. Properties that need layout computation (used values) - always run update_layout()
         // 2. Properties that need a layout node for special resolution - ensure layout node exists
         // 3. Everything else - just update_style() and return computed value
-        bool const needs_layout = property_needs_layout_for_getcomputedstyle(property_id);
-        bool const needs_layout_node = property_needs_layout_node_for_resolved_value(property_id) || property_is_logical_alias(property_id) || property_is_shorthand(property_id);
-
-        if (needs_layout || needs_layout_node) {
-            // Properties that need layout computation or layout node for special resolution
-            // always need update_layout() to ensure both style and layout tree are up to date.
-            abstract_element.document().update_layout(DOM::UpdateLayoutReason::ResolvedCSSStyleDeclarationProperty);
-            layout_node = abstract_element.layout_node();
+        // NB: Logical aliases and shorthands may map to properties that need layout, and the resolved transform
+        //     depends on the size of the box.
+        bool const needs_layout = property_needs_layout_for_getcomputedstyle(property_id) || property_is_logical_alias(property_id) || property_is_shorthand(property_id) || property_id == PropertyID::Transform;
+        bool const needs_layout_node = property_needs_layout_node_for_resolved_value(property_id);
+
+        auto& document = abstract_element.document();
+        auto update_layout = [&] {
+            // NB: An element without any box has its computed values resolved below, without a layout node.
+            if (document.update_layout_for_element(abstract_element.element(), DOM::UpdateLayoutReason::ResolvedCSSStyleDeclarationProperty))
+                layout_node = abstract_element.layout_node();
+            else
+                layout_node = nullptr;
+        };
+
+        if (needs_layout) {
+            update_layout();
+        } else if (needs_layout_node) {
+            // OPTIMIZATION: Layout nodes get the new style applied as soon as it is computed, so as long as the layout
+            //               tree doesn't need to be rebuilt, we can read the computed values off of the layout node
+            //               without laying out the document first.
+            document.update_style();
+            if (document.layout_tree_is_up_to_date())
+                layout_node = abstract_element.layout_node();
+            else
+                update_layout();
         } else {
             // Just ensure styles are up to date.
-            abstract_element.document().update_style();
+            document.update_style();
         }
 
         // FIXME: Somehow get custom properties if there's no layout node.
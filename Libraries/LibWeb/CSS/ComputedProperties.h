@@ -273,6 +273,7 @@ public:
         return m_attempted_pseudo_class_matches.get(pseudo_class);
     }
 
+    PseudoClassBitmap const& attempted_pseudo_class_matches() const { return m_attempted_pseudo_class_matches; }
     void set_attempted_pseudo_class_matches(PseudoClassBitmap const& results)
     {
         m_attempted_pseudo_class_matches = results;
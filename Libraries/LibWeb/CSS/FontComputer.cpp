@@ -11,11 +11,10 @@
 #include "FontComputer.h"
 #include <AK/NonnullRawPtr.h>
 #include <LibGfx/Font/FontDatabase.h>
-#include <LibGfx/Font/WOFF/Loader.h>
-#include <LibGfx/Font/WOFF2/Loader.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Fetch.h>
+#include <LibWeb/CSS/FontDecoding.h>
 #include <LibWeb/CSS/FontFace.h>
 #include <LibWeb/CSS/FontFaceSet.h>
 #include <LibWeb/CSS/StyleValues/CustomIdentStyleValue.h>
@@ -177,23 +176,21 @@ void FontLoader::start_loading_next_url()
             // 2. Load a font from stream according to its type.
 
             // NB: We need to fetch the next source if this one fails to fetch OR decode. So, first try to decode it.
-            RefPtr<Gfx::Typeface const> typeface;
-            if (auto* bytes = stream.template get_pointer<ByteBuffer>()) {
-                if (auto maybe_typeface = loader->try_load_font(response, *bytes); !maybe_typeface.is_error())
-                    typeface = maybe_typeface.release_value();
+            auto* bytes = stream.template get_pointer<ByteBuffer>();
+            auto format = bytes ? loader->font_format_for(response, *bytes) : Optional<FontFormat> {};
+            if (!format.has_value()) {
+                loader->font_did_fail_to_load_from_current_url();
+                return;
             }
 
-            if (!typeface) {
-                // NB: If we have other sources available, try the next one.
-                if (loader->m_urls.is_empty()) {
-                    loader->font_did_load_or_fail(nullptr);
-                } else {
-                    loader->m_fetch_controller = nullptr;
-                    loader->start_loading_next_url();
+            // NB: Decoding happens on a background thread, as decompressing a WOFF2 font can take a while.
+            decode_font(move(*bytes), *format, [loader = GC::make_root(loader)](RefPtr<Gfx::Typeface const> typeface) {
+                if (!typeface) {
+                    loader->font_did_fail_to_load_from_current_url();
+                    return;
                 }
-            } else {
                 loader->font_did_load_or_fail(move(typeface));
-            }
+            });
         });
 
     if (!m_fetch_controller)
@@ -214,7 +211,18 @@ void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
     m_fetch_controller = nullptr;
 }
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
+void FontLoader::font_did_fail_to_load_from_current_url()
+{
+    // NB: If we have other sources available, try the next one.
+    if (m_urls.is_empty()) {
+        font_did_load_or_fail(nullptr);
+    } else {
+        m_fetch_controller = nullptr;
+        start_loading_next_url();
+    }
+}
+
+Optional<FontFormat> FontLoader::font_format_for(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
 {
     // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
     auto mime_type = Fetch::Infrastructure::extract_mime_type(response.header_list());
@@ -222,24 +230,15 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Inf
         mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
     }
     if (mime_type.has_value()) {
-        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
-            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
-            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
-            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
+        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv)
+            return FontFormat::OpenType;
+        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv)
+            return FontFormat::WOFF;
+        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv)
+            return FontFormat::WOFF2;
     }
 
-    return Error::from_string_literal("Automatic format detection failed");
+    return {};
 }
 
 struct FontComputer::MatchingFontCandidate {
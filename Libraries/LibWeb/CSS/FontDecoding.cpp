@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteReader.h>
+#include <AK/HashMap.h>
+#include <AK/NeverDestroyed.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibGfx/Font/WOFF/Loader.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibWeb/CSS/FontDecoding.h>
+
+namespace Web::CSS {
+
+using FontDigest = Crypto::Hash::SHA256::DigestType;
+
+struct FontDigestTraits : public DefaultTraits<FontDigest> {
+    // The digest is already uniformly distributed, so any 32 bits of it make a good hash.
+    static unsigned hash(FontDigest const& digest) { return ByteReader::load32(digest.data); }
+};
+
+using DecodedFontCallback = Function<void(RefPtr<Gfx::Typeface const>)>;
+
+struct DecodedFontCache {
+    HashMap<FontDigest, NonnullRefPtr<Gfx::Typeface const>, FontDigestTraits> typefaces;
+    // Callbacks waiting on a decode that is already in progress, keyed by the digest of the data being decoded.
+    HashMap<FontDigest, Vector<DecodedFontCallback>, FontDigestTraits> pending_decodes;
+};
+
+// Typefaces that no loaded font refers to any more are kept around for a while, so that e.g. navigating to another
+// page of the same site can reuse them. Past this many typefaces, unused ones are evicted.
+static constexpr size_t decoded_font_cache_soft_limit = 64;
+
+static DecodedFontCache& decoded_font_cache()
+{
+    static NeverDestroyed<DecodedFontCache> cache;
+    return *cache;
+}
+
+static ErrorOr<NonnullRefPtr<Gfx::Typeface const>> decode_font_data(ReadonlyBytes data, FontFormat format)
+{
+    // NB: The typeface may outlive the buffer it was decoded from, as it is shared with later loads of the same data,
+    //     so OpenType data has to be copied.
+    if (format == FontFormat::Unknown || format == FontFormat::OpenType) {
+        if (auto result = Gfx::Typeface::try_load_from_temporary_memory(data); !result.is_error())
+            return result.release_value();
+    }
+    if (format == FontFormat::Unknown || format == FontFormat::WOFF) {
+        if (auto result = WOFF::try_load_from_bytes(data); !result.is_error())
+            return result.release_value();
+    }
+    if (format == FontFormat::Unknown || format == FontFormat::WOFF2) {
+        if (auto result = WOFF2::try_load_from_bytes(data); !result.is_error())
+            return result.release_value();
+    }
+    return Error::from_string_literal("Automatic format detection failed");
+}
+
+static void cache_decoded_font(FontDigest const& digest, NonnullRefPtr<Gfx::Typeface const> typeface)
+{
+    auto& cache = decoded_font_cache();
+    if (cache.typefaces.size() >= decoded_font_cache_soft_limit)
+        cache.typefaces.remove_all_matching([](auto const&, auto const& typeface) { return typeface->ref_count() == 1; });
+    cache.typefaces.set(digest, move(typeface));
+}
+
+static void finish_decoding_font(FontDigest const& digest, RefPtr<Gfx::Typeface const> typeface)
+{
+    auto& cache = decoded_font_cache();
+    if (typeface)
+        cache_decoded_font(digest, *typeface);
+
+    auto callbacks = cache.pending_decodes.take(digest).release_value();
+    for (auto& callback : callbacks)
+        callback(typeface);
+}
+
+static void start_decoding_font(ByteBuffer data, FontFormat format, FontDigest const& digest)
+{
+    using DecodeResult = RefPtr<Gfx::Typeface const>;
+    (void)Threading::BackgroundAction<DecodeResult>::construct(
+        [data = move(data), format](auto&) -> ErrorOr<DecodeResult> {
+            auto typeface_or_error = decode_font_data(data, format);
+            if (typeface_or_error.is_error())
+                return DecodeResult {};
+            return DecodeResult { typeface_or_error.release_value() };
+        },
+        [digest](DecodeResult typeface) -> ErrorOr<void> {
+            finish_decoding_font(digest, move(typeface));
+            return {};
+        });
+}
+
+void decode_font(ByteBuffer data, FontFormat format, DecodedFontCallback on_complete)
+{
+    // NB: Hashing megabytes of font data isn't free either, so that happens in the background too. Only the cache
+    //     lookups happen on this thread, which keeps the cache and the typefaces' reference counts single-threaded.
+    using HashResult = Tuple<ByteBuffer, FontDigest>;
+    (void)Threading::BackgroundAction<HashResult>::construct(
+        [data = move(data)](auto&) mutable -> ErrorOr<HashResult> {
+            auto digest = Crypto::Hash::SHA256::hash(data);
+            return HashResult { move(data), digest };
+        },
+        [format, on_complete = move(on_complete)](HashResult result) mutable -> ErrorOr<void> {
+            auto& [data, digest] = result;
+            auto& cache = decoded_font_cache();
+
+            if (auto typeface = cache.typefaces.get(digest); typeface.has_value()) {
+                on_complete(*typeface);
+                return {};
+            }
+
+            if (auto pending = cache.pending_decodes.find(digest); pending != cache.pending_decodes.end()) {
+                pending->value.append(move(on_complete));
+                return {};
+            }
+
+            Vector<DecodedFontCallback> callbacks;
+            callbacks.append(move(on_complete));
+            cache.pending_decodes.set(digest, move(callbacks));
+            start_decoding_font(move(data), format, digest);
+            return {};
+        });
+}
+
+}
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Web::CSS {
+
+enum class FontFormat : u8 {
+    // We don't know the format, so every supported format is tried in turn.
+    Unknown,
+    OpenType,
+    WOFF,
+    WOFF2,
+};
+
+// Decodes web font data into a typeface on a background thread, then calls on_complete on the calling thread with the
+// typeface, or with null if the data couldn't be decoded. Typefaces are shared between every load of byte-identical
+// font data in this process, so e.g. an icon font used by every page of a site is only decompressed once.
+// NB: This must always be called from the same thread, which is also where on_complete is called.
+void decode_font(ByteBuffer data, FontFormat, Function<void(RefPtr<Gfx::Typeface const>)> on_complete);
+
+}
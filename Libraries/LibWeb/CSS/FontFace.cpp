@@ -10,14 +10,13 @@
 #include <LibGC/Heap.h>
 #include <LibGfx/Font/FontSupport.h>
 #include <LibGfx/Font/Typeface.h>
-#include <LibGfx/Font/WOFF/Loader.h>
-#include <LibGfx/Font/WOFF2/Loader.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/Bindings/FontFacePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/CSS/CSSFontFaceRule.h>
 #include <LibWeb/CSS/FontComputer.h>
+#include <LibWeb/CSS/FontDecoding.h>
 #include <LibWeb/CSS/FontFace.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/StyleValues/CustomIdentStyleValue.h>
@@ -31,32 +30,18 @@
 
 namespace Web::CSS {
 
-static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vector_font(JS::Realm& realm, ByteBuffer const& data)
+static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vector_font(ByteBuffer const& data)
 {
     auto promise = Core::Promise<NonnullRefPtr<Gfx::Typeface const>>::construct();
 
-    // FIXME: 'Asynchronously' shouldn't mean 'later on the main thread'.
-    //        Can we defer this to a background thread?
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&data, promise] {
-        // FIXME: This should be de-duplicated with StyleComputer::FontLoader::try_load_font
-        // We don't have the luxury of knowing the MIME type, so we have to try all formats.
-        auto ttf = Gfx::Typeface::try_load_from_externally_owned_memory(data);
-        if (!ttf.is_error()) {
-            promise->resolve(ttf.release_value());
+    // NB: We don't have the luxury of knowing the MIME type, so we have to try all formats.
+    decode_font(data, FontFormat::Unknown, [promise](RefPtr<Gfx::Typeface const> typeface) {
+        if (!typeface) {
+            promise->reject(Error::from_string_literal("Automatic format detection failed"));
             return;
         }
-        auto woff = WOFF::try_load_from_bytes(data);
-        if (!woff.is_error()) {
-            promise->resolve(woff.release_value());
-            return;
-        }
-        auto woff2 = WOFF2::try_load_from_bytes(data);
-        if (!woff2.is_error()) {
-            promise->resolve(woff2.release_value());
-            return;
-        }
-        promise->reject(Error::from_string_literal("Automatic format detection failed"));
-    }));
+        promise->resolve(typeface.release_nonnull());
+    });
 
     return promise;
 }
@@ -147,7 +132,7 @@ GC::Ref<FontFace> FontFace::construct_impl(JS::Realm& realm, String family, Font
 
         // 3. Asynchronously, attempt to parse the data in it as a font.
         //    When this is completed, successfully or not, queue a task to run the following steps synchronously:
-        font_face->m_font_load_promise = load_vector_font(realm, font_face->m_binary_data);
+        font_face->m_font_load_promise = load_vector_font(font_face->m_binary_data);
 
         font_face->m_font_load_promise->when_resolved([font = GC::make_root(font_face)](auto const& vector_font) -> ErrorOr<void> {
             HTML::queue_global_task(HTML::Task::Source::FontLoading, HTML::relevant_global_object(*font), GC::create_function(font->heap(), [font = GC::Ref(*font), vector_font] {
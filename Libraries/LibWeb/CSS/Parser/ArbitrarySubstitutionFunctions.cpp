@@ -324,6 +324,7 @@ static Vector<ComponentValue> replace_a_var_function(DOM::AbstractElement& eleme
     } else {
         // Look up the value of the custom property
         auto& custom_property_name = name_token.token().ident();
+        element.element().add_custom_property_used_by_style(custom_property_name);
         auto custom_property_value = StyleComputer::compute_value_of_custom_property(element, custom_property_name, guarded_contexts);
         if (custom_property_value->is_guaranteed_invalid()) {
             result = { ComponentValue { GuaranteedInvalidValue {} } };
@@ -164,10 +164,16 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
 
         auto decoded_input = MUST(decoder->to_utf8(input));
 
-        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
+        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering.
+        //               CR, FF and NULL are single bytes in UTF-8, and surrogates are encoded as 0xED followed by a
+        //               byte in the range 0xA0-0xBF, so we can look for all of them without decoding the input.
         bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
+            auto bytes = decoded_input.bytes();
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                auto byte = bytes[i];
+                if (byte == '\r' || byte == '\f' || byte == 0x00)
+                    return true;
+                if (byte == 0xED && i + 1 < bytes.size() && bytes[i + 1] >= 0xA0)
                     return true;
             }
             return false;
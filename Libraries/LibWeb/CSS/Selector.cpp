@@ -124,10 +124,47 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     }
 
     collect_ancestor_hashes();
+    collect_pseudo_classes_affecting_elements_outside_their_subtree();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
 }
 
+void Selector::collect_pseudo_classes_affecting_elements_outside_their_subtree()
+{
+    // NOTE: Slotted elements and parts aren't descendants of the elements their selectors are anchored to.
+    if (is_slotted() || has_part_pseudo_element()) {
+        m_pseudo_classes_affecting_elements_outside_their_subtree = m_contained_pseudo_classes;
+        return;
+    }
+
+    for (size_t compound_index = 0; compound_index < m_compound_selectors.size(); ++compound_index) {
+        // A compound selector followed by a sibling combinator is matched against siblings of the subject's
+        // ancestors, so every pseudo-class in it can affect elements outside the subtree of the element it matches.
+        bool is_followed_by_sibling_combinator = compound_index + 1 < m_compound_selectors.size()
+            && first_is_one_of(m_compound_selectors[compound_index + 1].combinator, Combinator::NextSibling, Combinator::SubsequentSibling);
+
+        for (auto const& simple_selector : m_compound_selectors[compound_index].simple_selectors) {
+            if (simple_selector.type != SimpleSelector::Type::PseudoClass)
+                continue;
+            auto const& pseudo_class = simple_selector.pseudo_class();
+            if (is_followed_by_sibling_combinator)
+                m_pseudo_classes_affecting_elements_outside_their_subtree.set(pseudo_class.type, true);
+
+            // :has() looks at descendants and following siblings, the :nth-*() pseudo-classes look at siblings,
+            // and :host() is matched against an element in another tree, so their arguments don't follow the
+            // structure of the outer selector.
+            bool argument_is_matched_against_other_elements = is_followed_by_sibling_combinator
+                || first_is_one_of(pseudo_class.type, PseudoClass::Has, PseudoClass::Host, PseudoClass::NthChild, PseudoClass::NthLastChild, PseudoClass::NthOfType, PseudoClass::NthLastOfType);
+            for (auto const& child_selector : pseudo_class.argument_selector_list) {
+                if (argument_is_matched_against_other_elements)
+                    m_pseudo_classes_affecting_elements_outside_their_subtree |= child_selector->m_contained_pseudo_classes;
+                else
+                    m_pseudo_classes_affecting_elements_outside_their_subtree |= child_selector->m_pseudo_classes_affecting_elements_outside_their_subtree;
+            }
+        }
+    }
+}
+
 void Selector::collect_ancestor_hashes()
 {
     if (is_slotted()) {
@@ -165,6 +202,35 @@ void Selector::collect_ancestor_hashes()
                 if (append_unique_hash(simple_selector.attribute().qualified_name.name.lowercase_name.hash()))
                     return true;
                 break;
+            case SimpleSelector::Type::PseudoClass: {
+                // :is(X) and :where(X) with a single argument require the same element to match all of X, so X's
+                // subject compound and everything X itself requires from its ancestors must be present too.
+                // With multiple arguments, any one of them could match, so we can't require anything.
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                if (pseudo_class.type != PseudoClass::Is && pseudo_class.type != PseudoClass::Where)
+                    break;
+                if (pseudo_class.argument_selector_list.size() != 1)
+                    break;
+                auto const& argument_selector = *pseudo_class.argument_selector_list.first();
+                for (auto const& argument_simple_selector : argument_selector.compound_selectors().last().simple_selectors) {
+                    u32 hash = 0;
+                    if (argument_simple_selector.type == SimpleSelector::Type::Id || argument_simple_selector.type == SimpleSelector::Type::Class)
+                        hash = argument_simple_selector.name().hash();
+                    else if (argument_simple_selector.type == SimpleSelector::Type::TagName)
+                        hash = argument_simple_selector.qualified_name().name.lowercase_name.hash();
+                    if (hash && append_unique_hash(hash))
+                        return true;
+                }
+                if (argument_selector.can_use_ancestor_filter()) {
+                    for (auto hash : argument_selector.ancestor_hashes()) {
+                        if (hash == 0)
+                            break;
+                        if (append_unique_hash(hash))
+                            return true;
+                    }
+                }
+                break;
+            }
             default:
                 break;
             }
@@ -219,6 +219,10 @@ public:
     NonnullRefPtr<Selector> relative_to(SimpleSelector const&) const;
     bool contains_the_nesting_selector() const { return m_contains_the_nesting_selector; }
     bool contains_pseudo_class(PseudoClass pseudo_class) const { return m_contained_pseudo_classes.get(pseudo_class); }
+
+    // Whether a change in the given pseudo-class state of an element can change whether this selector matches
+    // elements other than that element and its descendants, e.g. ".a:hover + .b" or ".b:has(.a:hover)".
+    bool pseudo_class_can_affect_elements_outside_its_subtree(PseudoClass pseudo_class) const { return m_pseudo_classes_affecting_elements_outside_their_subtree.get(pseudo_class); }
     bool contains_unknown_webkit_pseudo_element() const;
     RefPtr<Selector> absolutized(SimpleSelector const& selector_for_nesting) const;
     u32 specificity() const;
@@ -246,8 +250,10 @@ private:
     bool m_contains_the_nesting_selector { false };
 
     PseudoClassBitmap m_contained_pseudo_classes;
+    PseudoClassBitmap m_pseudo_classes_affecting_elements_outside_their_subtree;
 
     void collect_ancestor_hashes();
+    void collect_pseudo_classes_affecting_elements_outside_their_subtree();
 
     Array<u32, 8> m_ancestor_hashes;
 };
@@ -1268,9 +1268,15 @@ bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr
     return matches(selector, selector.compound_selectors().size() - 1, element, shadow_host, context, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+// OPTIMIZATION: Document-wide facts that would otherwise be looked up again for every simple selector we try.
+struct FastMatchState {
+    bool is_html_document { false };
+    CaseSensitivity class_case_sensitivity { CaseSensitivity::CaseSensitive };
+};
+
+static ALWAYS_INLINE bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, FastMatchState const& state)
 {
-    if (should_block_shadow_host_matching(simple_selector, shadow_host, element))
+    if (shadow_host && should_block_shadow_host_matching(simple_selector, shadow_host, element))
         return false;
 
     switch (simple_selector.type) {
@@ -1281,7 +1287,7 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
         // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
         // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
         // the comparison is case sensitive).
-        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
+        if (state.is_html_document && element.namespace_uri() == Namespace::HTML) {
             if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
                 return false;
         } else if (simple_selector.qualified_name().name.name != element.local_name()) {
@@ -1289,12 +1295,10 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
             return false;
         }
         return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
+    case CSS::Selector::SimpleSelector::Type::Class:
         // Class selectors are matched case insensitively in quirks mode.
         // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
+        return element.has_class(simple_selector.name(), state.class_case_sensitivity);
     case CSS::Selector::SimpleSelector::Type::Id:
         return simple_selector.name() == element.id();
     case CSS::Selector::SimpleSelector::Type::Attribute:
@@ -1306,10 +1310,10 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, FastMatchState const& state)
 {
     for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context, state))
             return false;
     }
     return true;
@@ -1319,9 +1323,15 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
 {
     DOM::Element const* current = &element_to_match;
 
+    auto const& document = element_to_match.document();
+    FastMatchState const state {
+        .is_html_document = document.document_type() == DOM::Document::Type::HTML,
+        .class_case_sensitivity = document.in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive,
+    };
+
     ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context, state))
         return false;
 
     // NOTE: If we fail after following a child combinator, we may need to backtrack
@@ -1344,7 +1354,7 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
             backtrack_state = { current->parent_element(), compound_selector_index };
             compound_selector = &selector.compound_selectors()[--compound_selector_index];
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context, state))
                     break;
             }
             if (!current)
@@ -1355,7 +1365,7 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context, state)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
                     compound_selector_index = backtrack_state.compound_selector_index;
@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/GenericShorthands.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringFloatingPointConversions.h>
 #include <AK/Utf8View.h>
 #include <LibWeb/CSS/Parser/ComponentValue.h>
 #include <LibWeb/CSS/Parser/TokenStream.h>
@@ -145,6 +147,37 @@ void serialize_a_number(StringBuilder& builder, double value)
         return;
     }
 
+    // OPTIMIZATION: If the shortest round-trip representation of the value has at most 6 decimals, it is exactly what
+    //               we want to print, and writing it out is cheaper and more precise than formatting with a precision.
+    if (isfinite(value)) {
+        auto [sign, mantissa, exponent] = convert_floating_point_to_decimal_exponential_form(value);
+
+        Array<char, 20> digits;
+        size_t first_digit = digits.size();
+        for (; mantissa; mantissa /= 10)
+            digits[--first_digit] = static_cast<char>('0' + mantissa % 10);
+        auto digits_view = StringView { digits.data() + first_digit, digits.size() - first_digit };
+        auto integer_digits = exponent + static_cast<i32>(digits_view.length());
+
+        if (exponent >= -6 && integer_digits <= 21) {
+            if (sign)
+                builder.append('-');
+            if (exponent >= 0) {
+                builder.append(digits_view);
+                builder.append_repeated('0', exponent);
+            } else if (integer_digits > 0) {
+                builder.append(digits_view.substring_view(0, integer_digits));
+                builder.append('.');
+                builder.append(digits_view.substring_view(integer_digits));
+            } else {
+                builder.append("0."sv);
+                builder.append_repeated('0', -integer_digits);
+                builder.append(digits_view);
+            }
+            return;
+        }
+    }
+
     // FIXME: Prevent scientific notation for large values.
     builder.appendff("{:.6}", value);
 }
@@ -18,6 +18,7 @@
 #include <AK/Math.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/QuickSort.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
@@ -75,6 +76,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/HTML/HTMLBRElement.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
@@ -337,13 +339,15 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
     Vector<MatchingRule const*> matching_rules;
     matching_rules.ensure_capacity(rules_to_run.size());
 
+    bool const element_is_shadow_host = abstract_element.element().is_shadow_host();
+
     for (auto const& rule_to_run : rules_to_run) {
         // NOTE: When matching an element against a rule from outside the shadow root's style scope,
         //       we have to pass in null for the shadow host, otherwise combinator traversal will
         //       be confined to the element itself (since it refuses to cross the shadow boundary).
         auto rule_root = rule_to_run.shadow_root;
         auto shadow_host_to_use = shadow_host;
-        if (abstract_element.element().is_shadow_host() && rule_root != abstract_element.element().shadow_root())
+        if (element_is_shadow_host && rule_root != element_shadow_root)
             shadow_host_to_use = nullptr;
 
         auto const& selector = rule_to_run.selector;
@@ -379,11 +383,15 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
 
 static void sort_matching_rules(Vector<MatchingRule const*>& matching_rules)
 {
+    // OPTIMIZATION: Most elements only match a handful of rules per cascade origin, often none at all.
+    if (matching_rules.size() < 2)
+        return;
+
     quick_sort(matching_rules, [&](MatchingRule const* a, MatchingRule const* b) {
-        auto const& a_selector = a->selector;
-        auto const& b_selector = b->selector;
-        auto a_specificity = a_selector.specificity();
-        auto b_specificity = b_selector.specificity();
+        // NB: The specificity is cached on the MatchingRule when building the rule cache, so we don't have to chase
+        //     the selector pointer for every comparison.
+        auto a_specificity = a->specificity;
+        auto b_specificity = b->specificity;
         if (a_specificity == b_specificity) {
             if (a->style_sheet_index == b->style_sheet_index)
                 return a->rule_index < b->rule_index;
@@ -612,12 +620,12 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
         return potential_match;
     }();
     auto keyframe_start = static_cast<i64>(keyframe_start_it.key());
-    auto keyframe_values = *keyframe_start_it;
+    auto const& keyframe_values = *keyframe_start_it;
 
     auto keyframe_end_it = ++keyframe_start_it;
     VERIFY(!keyframe_end_it.is_end());
     auto keyframe_end = static_cast<i64>(keyframe_end_it.key());
-    auto keyframe_end_values = *keyframe_end_it;
+    auto const& keyframe_end_values = *keyframe_end_it;
 
     auto progress_in_keyframe = (progress - keyframe_start) / static_cast<double>(keyframe_end - keyframe_start);
 
@@ -626,8 +634,18 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
         dbgln("Animation {} contains {} properties to interpolate, progress = {}%", animation->id(), valid_properties, progress_in_keyframe * 100);
     }
 
+    Length::FontMetrics font_metrics {
+        computed_properties.font_size(),
+        computed_properties.first_available_computed_font(document().font_computer())->pixel_metrics(),
+        computed_properties.line_height()
+    };
+    auto color_scheme = computed_properties.color_scheme(document().page().preferred_color_scheme(), document().supported_color_schemes());
+    auto device_pixels_per_css_pixel = m_document->page().client().device_pixels_per_css_pixel();
+
     // FIXME: Follow https://drafts.csswg.org/web-animations-1/#ref-for-computed-keyframes in whatever the right place is.
-    auto compute_keyframe_values = [&computed_properties, &abstract_element, this](auto const& keyframe_values) {
+    // NB: is_cacheable is cleared if the result depends on anything other than the inputs recorded in a
+    //     ComputedKeyFrameValuesKey, such as animated values or the style of the inheritance parent.
+    auto compute_keyframe_values = [&](auto const& keyframe_values, bool& is_cacheable) {
         HashMap<PropertyID, RefPtr<StyleValue const>> result;
         HashMap<PropertyID, PropertyID> longhands_set_by_property_id;
         AK::FixedBitmap<number_of_longhand_properties> property_is_set_by_use_initial(false);
@@ -669,12 +687,6 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             return camel_case_string_from_property_id(a) < camel_case_string_from_property_id(b);
         };
 
-        Length::FontMetrics font_metrics {
-            computed_properties.font_size(),
-            computed_properties.first_available_computed_font(document().font_computer())->pixel_metrics(),
-            computed_properties.line_height()
-        };
-
         HashMap<PropertyID, RefPtr<StyleValue const>> specified_values;
 
         for (auto const& [property_id, value] : keyframe_values.properties) {
@@ -701,8 +713,10 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             if (style_value->is_pending_substitution())
                 continue;
 
-            if (style_value->is_unresolved())
+            if (style_value->is_unresolved()) {
+                is_cacheable = false;
                 style_value = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingParams { abstract_element.document() }, abstract_element, PropertyNameAndID::from_id(property_id), style_value->as_unresolved());
+            }
 
             for_each_property_expanding_shorthands(property_id, *style_value, [&](PropertyID longhand_id, StyleValue const& longhand_value) {
                 auto physical_longhand_id = map_logical_alias_to_physical_property(longhand_id, LogicalAliasMappingContext { computed_properties.writing_mode(), computed_properties.direction() });
@@ -718,6 +732,7 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
 
                 auto const& specified_value_with_css_wide_keywords_applied = [&]() -> StyleValue const& {
                     if (longhand_value.is_inherit() || (longhand_value.is_unset() && is_inherited_property(longhand_id))) {
+                        is_cacheable = false;
                         if (auto inherited_animated_value = get_animated_inherit_value(longhand_id, abstract_element); inherited_animated_value.has_value())
                             return inherited_animated_value->value;
 
@@ -727,8 +742,10 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
                     if (longhand_value.is_initial() || longhand_value.is_unset())
                         return property_initial_value(longhand_id);
 
-                    if (longhand_value.is_revert() || longhand_value.is_revert_layer())
+                    if (longhand_value.is_revert() || longhand_value.is_revert_layer()) {
+                        is_cacheable = false;
                         return computed_properties.property(longhand_id);
+                    }
 
                     return longhand_value;
                 }();
@@ -739,6 +756,12 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             });
         }
 
+        // NB: The computed values of font properties depend on the style of the inheritance parent.
+        for (auto property_id : { PropertyID::FontSize, PropertyID::FontWeight, PropertyID::FontWidth, PropertyID::FontStyle, PropertyID::LineHeight }) {
+            if (specified_values.contains(property_id))
+                is_cacheable = false;
+        }
+
         auto const& inheritance_parent = abstract_element.element_to_inherit_style_from();
         auto inheritance_parent_has_computed_properties = inheritance_parent.has_value() && inheritance_parent->computed_properties();
         ComputationContext font_computation_context {
@@ -800,7 +823,7 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
                 .font_metrics = font_metrics,
                 .root_font_metrics = m_root_element_font_metrics },
             .abstract_element = abstract_element,
-            .color_scheme = computed_properties.color_scheme(document().page().preferred_color_scheme(), document().supported_color_schemes()),
+            .color_scheme = color_scheme,
         };
 
         // NOTE: This doesn't necessarily return the specified value if we reach into computed_properties but that
@@ -809,6 +832,7 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             if (auto keyframe_value = specified_values.get(property_id); keyframe_value.has_value() && keyframe_value.value())
                 return *keyframe_value.value();
 
+            is_cacheable = false;
             return computed_properties.property(property_id);
         };
 
@@ -819,13 +843,46 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             if (first_is_one_of(property_id, PropertyID::FontSize, PropertyID::FontWeight, PropertyID::FontWidth, PropertyID::FontStyle, PropertyID::LineHeight))
                 continue;
 
-            result.set(property_id, compute_value_of_property(property_id, *style_value, get_property_specified_value, computation_context, m_document->page().client().device_pixels_per_css_pixel()));
+            result.set(property_id, compute_value_of_property(property_id, *style_value, get_property_specified_value, computation_context, device_pixels_per_css_pixel));
         }
 
         return result;
     };
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_start_values = compute_keyframe_values(keyframe_values);
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_end_values = compute_keyframe_values(keyframe_end_values);
+
+    // OPTIMIZATION: Computing the values of a keyframe means expanding shorthands and resolving every value, which
+    //               would otherwise be repeated on every animation frame. As long as nothing they depend on changes,
+    //               we reuse the values computed for the previous frame, so a tick only has to interpolate.
+    HashMap<PropertyID, RefPtr<StyleValue const>> uncached_start_values;
+    HashMap<PropertyID, RefPtr<StyleValue const>> uncached_end_values;
+    auto computed_keyframe_values = [&](auto const& keyframe, Animations::KeyframeEffect::KeyFrameBoundary boundary, auto& uncached_values) -> HashMap<PropertyID, RefPtr<StyleValue const>> const& {
+        Animations::KeyframeEffect::ComputedKeyFrameValuesKey key {
+            .key_frame_set = effect->key_frame_set(),
+            .keyframe = &keyframe,
+            .style = &computed_properties,
+            .font_metrics = font_metrics,
+            .root_font_metrics = m_root_element_font_metrics,
+            .viewport_rect = viewport_rect(),
+            .color_scheme = color_scheme,
+            .device_pixels_per_css_pixel = device_pixels_per_css_pixel,
+        };
+
+        auto& cached_values = effect->cached_computed_key_frame_values(boundary);
+        if (cached_values.has_value() && cached_values->key == key)
+            return cached_values->values;
+
+        bool is_cacheable = true;
+        auto values = compute_keyframe_values(keyframe, is_cacheable);
+        if (!is_cacheable) {
+            cached_values.clear();
+            uncached_values = move(values);
+            return uncached_values;
+        }
+
+        cached_values = Animations::KeyframeEffect::ComputedKeyFrameValues { move(key), move(values) };
+        return cached_values->values;
+    };
+    auto const& computed_start_values = computed_keyframe_values(keyframe_values, Animations::KeyframeEffect::KeyFrameBoundary::Start, uncached_start_values);
+    auto const& computed_end_values = computed_keyframe_values(keyframe_end_values, Animations::KeyframeEffect::KeyFrameBoundary::End, uncached_end_values);
     auto to_composite_operation = [&](Bindings::CompositeOperationOrAuto composite_operation_or_auto) {
         switch (composite_operation_or_auto) {
         case Bindings::CompositeOperationOrAuto::Accumulate:
@@ -1811,19 +1868,20 @@ GC::Ref<ComputedProperties> StyleComputer::create_document_style() const
     return style;
 }
 
-GC::Ref<ComputedProperties> StyleComputer::compute_style(DOM::AbstractElement abstract_element, Optional<bool&> did_change_custom_properties) const
+GC::Ref<ComputedProperties> StyleComputer::compute_style(DOM::AbstractElement abstract_element, Optional<HashTable<FlyString>&> changed_custom_properties) const
 {
+    TRACE_EVENT(Style, "StyleComputer::compute_style");
     auto& style_scope = abstract_element.style_scope();
-    return *compute_style_impl(abstract_element, ComputeStyleMode::Normal, did_change_custom_properties, style_scope);
+    return *compute_style_impl(abstract_element, ComputeStyleMode::Normal, changed_custom_properties, style_scope);
 }
 
-GC::Ptr<ComputedProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::AbstractElement abstract_element, Optional<bool&> did_change_custom_properties) const
+GC::Ptr<ComputedProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::AbstractElement abstract_element, Optional<HashTable<FlyString>&> changed_custom_properties) const
 {
     auto& style_scope = abstract_element.style_scope();
-    return compute_style_impl(abstract_element, ComputeStyleMode::CreatePseudoElementStyleIfNeeded, did_change_custom_properties, style_scope);
+    return compute_style_impl(abstract_element, ComputeStyleMode::CreatePseudoElementStyleIfNeeded, changed_custom_properties, style_scope);
 }
 
-GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractElement abstract_element, ComputeStyleMode mode, Optional<bool&> did_change_custom_properties, StyleScope const& style_scope) const
+GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractElement abstract_element, ComputeStyleMode mode, Optional<HashTable<FlyString>&> changed_custom_properties, StyleScope const& style_scope) const
 {
     style_scope.build_rule_cache_if_needed();
 
@@ -1856,21 +1914,36 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
-    auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+    GC::Ptr<CascadedProperties> cascaded_properties;
 
     auto old_custom_properties = abstract_element.custom_properties();
 
-    // Resolve all the CSS custom properties ("variables") for this element:
-    if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
-        OrderedHashMap<FlyString, StyleProperty> custom_properties;
-        for (auto& layer : matching_rule_set.author_rules) {
-            cascade_custom_properties(abstract_element, layer.rules, custom_properties);
-        }
+    GC::Ptr<DOM::Element const> style_sharing_candidate;
+    if (mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value())
+        style_sharing_candidate = find_style_sharing_candidate(abstract_element.element());
+
+    if (style_sharing_candidate) {
+        // OPTIMIZATION: The candidate matched exactly the rules we would match, so we can skip selector matching and
+        //               the cascade entirely, and reuse its results. Computed values are still resolved per element.
+        attempted_pseudo_class_matches = style_sharing_candidate->computed_properties()->attempted_pseudo_class_matches();
+        auto custom_properties = style_sharing_candidate->custom_properties({});
         abstract_element.set_custom_properties(move(custom_properties));
-    }
+        cascaded_properties = style_sharing_candidate->cascaded_properties({});
+    } else {
+        auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode, style_scope);
+
+        // Resolve all the CSS custom properties ("variables") for this element:
+        if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
+            OrderedHashMap<FlyString, StyleProperty> custom_properties;
+            for (auto& layer : matching_rule_set.author_rules) {
+                cascade_custom_properties(abstract_element, layer.rules, custom_properties);
+            }
+            abstract_element.set_custom_properties(move(custom_properties));
+        }
 
-    auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
-    auto cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+        auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
+        cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+    }
     abstract_element.set_cascaded_properties(cascaded_properties);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -1910,16 +1983,115 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
         }
     }
 
-    auto computed_properties = compute_properties(abstract_element, cascaded_properties);
+    auto computed_properties = compute_properties(abstract_element, *cascaded_properties);
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
-    if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties) {
-        *did_change_custom_properties = true;
+    if (changed_custom_properties.has_value()) {
+        auto const& new_custom_properties = abstract_element.custom_properties();
+        for (auto const& [name, property] : new_custom_properties) {
+            if (auto old_property = old_custom_properties.get(name); !old_property.has_value() || *old_property != property)
+                changed_custom_properties->set(name);
+        }
+        for (auto const& [name, property] : old_custom_properties) {
+            if (!new_custom_properties.contains(name))
+                changed_custom_properties->set(name);
+        }
     }
 
     return computed_properties;
 }
 
+// Pseudo-classes that can't tell apart two siblings with the same attributes: whatever they test, they test it on
+// the shared ancestors or attributes. Anything else (e.g. :hover, :checked or :defined) depends on per-element state.
+static PseudoClassBitmap const& pseudo_classes_compatible_with_style_sharing()
+{
+    static PseudoClassBitmap const bitmap = [] {
+        PseudoClassBitmap bitmap;
+        bitmap.set(PseudoClass::Is, true);
+        bitmap.set(PseudoClass::Where, true);
+        bitmap.set(PseudoClass::Not, true);
+        bitmap.set(PseudoClass::Lang, true);
+        return bitmap;
+    }();
+    return bitmap;
+}
+
+static bool have_identical_attributes(DOM::Element const& a, DOM::Element const& b)
+{
+    auto attribute_count = a.attribute_list_size();
+    if (attribute_count != b.attribute_list_size())
+        return false;
+    if (attribute_count == 0)
+        return true;
+
+    auto const& a_attributes = *a.attributes();
+    auto const& b_attributes = *b.attributes();
+    for (u32 i = 0; i < attribute_count; ++i) {
+        auto const& a_attribute = *a_attributes.item(i);
+        auto const& b_attribute = *b_attributes.item(i);
+        if (a_attribute.local_name() != b_attribute.local_name()
+            || a_attribute.namespace_uri() != b_attribute.namespace_uri()
+            || a_attribute.value() != b_attribute.value())
+            return false;
+    }
+    return true;
+}
+
+static bool is_eligible_for_style_sharing(DOM::Element const& element)
+{
+    return element.is_html_element()
+        && !element.is_document_element()
+        && !element.use_pseudo_element().has_value()
+        && !element.is_shadow_host()
+        && !element.inline_style()
+        && !element.assigned_slot_internal();
+}
+
+static bool can_share_style_with(DOM::Element const& element, DOM::Element const& candidate)
+{
+    if (!is_eligible_for_style_sharing(candidate))
+        return false;
+    if (candidate.local_name() != element.local_name())
+        return false;
+
+    // The candidate has to be up to date, since we're going to reuse its cascade.
+    auto candidate_style = candidate.computed_properties();
+    if (!candidate_style || !candidate.cascaded_properties({}) || candidate.needs_style_update())
+        return false;
+
+    // Anything that makes matching or values depend on the element's position among its siblings, its own state, or
+    // something other than its attributes and ancestors rules out sharing.
+    if (candidate.style_affected_by_structural_changes()
+        || candidate.affected_by_has_pseudo_class_in_subject_position()
+        || candidate.affected_by_has_pseudo_class_in_non_subject_position()
+        || candidate.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator()
+        || candidate.style_uses_var_css_function()
+        || candidate.style_uses_attr_css_function()
+        || candidate.style_uses_tree_counting_function())
+        return false;
+    if (!candidate_style->attempted_pseudo_class_matches().is_subset_of(pseudo_classes_compatible_with_style_sharing()))
+        return false;
+
+    return have_identical_attributes(element, candidate);
+}
+
+// Siblings with the same tag name and attributes match exactly the same rules, since they share all their ancestors.
+// We look at a few preceding siblings for one that we can borrow the matched rules and cascade from.
+GC::Ptr<DOM::Element const> StyleComputer::find_style_sharing_candidate(DOM::Element const& element) const
+{
+    static constexpr size_t max_style_sharing_candidates = 4;
+
+    if (!is_eligible_for_style_sharing(element))
+        return {};
+
+    auto const* candidate = element.previous_element_sibling();
+    for (size_t i = 0; candidate && i < max_style_sharing_candidates; ++i, candidate = candidate->previous_element_sibling()) {
+        if (can_share_style_with(element, *candidate))
+            return candidate;
+    }
+    return {};
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (!value.is_value_list())
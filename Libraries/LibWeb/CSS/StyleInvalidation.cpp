@@ -58,6 +58,11 @@ static bool is_stacking_context_creating_value(CSS::PropertyID property_id, RefP
     }
 }
 
+static bool is_nonzero_opacity(RefPtr<StyleValue const> const& value)
+{
+    return value && value->is_number() && value->as_number().number() != 0;
+}
+
 RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::PropertyID property_id, RefPtr<StyleValue const> const& old_value, RefPtr<StyleValue const> const& new_value)
 {
     RequiredInvalidationAfterStyleChange invalidation;
@@ -78,6 +83,7 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
         invalidation.rebuild_layout_tree = true;
         invalidation.relayout = true;
         invalidation.repaint = true;
+        invalidation.rerecord_display_list = true;
         return invalidation;
     }
 
@@ -115,6 +121,19 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
     }
     invalidation.repaint = true;
 
+    // OPTIMIZATION: These properties only end up in the AccumulatedVisualContext tree, so the recorded display list can
+    //               be reused with updated visual contexts instead of being re-recorded. Opacity 0 is the exception,
+    //               since we don't record fully transparent stacking contexts at all.
+    bool only_affects_accumulated_visual_contexts = AK::first_is_one_of(property_id,
+                                                        CSS::PropertyID::Transform,
+                                                        CSS::PropertyID::Rotate,
+                                                        CSS::PropertyID::Scale,
+                                                        CSS::PropertyID::Translate,
+                                                        CSS::PropertyID::TransformOrigin)
+        || (property_id == CSS::PropertyID::Opacity && is_nonzero_opacity(old_value) && is_nonzero_opacity(new_value));
+    if (!only_affects_accumulated_visual_contexts)
+        invalidation.rerecord_display_list = true;
+
     // Transform, perspective, clip, clip-path, and effects properties require rebuilding AccumulatedVisualContext tree.
     if (AK::first_is_one_of(property_id,
             CSS::PropertyID::Transform,
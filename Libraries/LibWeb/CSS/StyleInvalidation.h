@@ -16,6 +16,8 @@ struct RequiredInvalidationAfterStyleChange {
     bool relayout : 1 { false };
     bool rebuild_layout_tree : 1 { false };
     bool rebuild_accumulated_visual_contexts : 1 { false };
+    // NB: Unset if a repaint only has to update the AccumulatedVisualContext tree, but not the display list contents.
+    bool rerecord_display_list : 1 { false };
 
     void operator|=(RequiredInvalidationAfterStyleChange const& other)
     {
@@ -24,11 +26,12 @@ struct RequiredInvalidationAfterStyleChange {
         relayout |= other.relayout;
         rebuild_layout_tree |= other.rebuild_layout_tree;
         rebuild_accumulated_visual_contexts |= other.rebuild_accumulated_visual_contexts;
+        rerecord_display_list |= other.rerecord_display_list;
     }
 
     [[nodiscard]] bool is_none() const { return !repaint && !rebuild_stacking_context_tree && !relayout && !rebuild_layout_tree && !rebuild_accumulated_visual_contexts; }
     [[nodiscard]] bool is_full() const { return repaint && rebuild_stacking_context_tree && relayout && rebuild_layout_tree; }
-    static RequiredInvalidationAfterStyleChange full() { return { true, true, true, true, false }; }
+    static RequiredInvalidationAfterStyleChange full() { return { true, true, true, true, false, true }; }
 };
 
 RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::PropertyID property_id, RefPtr<StyleValue const> const& old_value, RefPtr<StyleValue const> const& new_value);
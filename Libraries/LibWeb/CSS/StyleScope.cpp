@@ -99,6 +99,7 @@ void StyleScope::build_rule_cache()
 
     build_qualified_layer_names_cache();
 
+    m_pseudo_classes_affecting_elements_outside_their_subtree = {};
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Hover)] = make<RuleCache>();
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Active)] = make<RuleCache>();
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Focus)] = make<RuleCache>();
@@ -126,6 +127,7 @@ void StyleScope::invalidate_rule_cache()
     m_user_agent_rule_cache = nullptr;
 
     m_pseudo_class_rule_cache = {};
+    m_pseudo_classes_affecting_elements_outside_their_subtree = {};
     m_style_invalidation_data = nullptr;
 }
 
@@ -279,6 +281,8 @@ void StyleScope::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin
                     if (selector.contains_pseudo_class(pseudo_class)) {
                         // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
                         m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
+                        if (selector.pseudo_class_can_affect_elements_outside_its_subtree(pseudo_class))
+                            m_pseudo_classes_affecting_elements_outside_their_subtree.set(pseudo_class, true);
                     }
                 }
 
@@ -459,6 +463,12 @@ RuleCache const& StyleScope::get_pseudo_class_rule_cache(PseudoClass pseudo_clas
     return *m_pseudo_class_rule_cache[to_underlying(pseudo_class)];
 }
 
+bool StyleScope::pseudo_class_can_affect_elements_outside_its_subtree(PseudoClass pseudo_class) const
+{
+    build_rule_cache_if_needed();
+    return m_pseudo_classes_affecting_elements_outside_their_subtree.get(pseudo_class);
+}
+
 void StyleScope::for_each_active_css_style_sheet(Function<void(CSS::CSSStyleSheet&)>&& callback) const
 {
     if (auto* shadow_root = as_if<DOM::ShadowRoot>(*m_node)) {
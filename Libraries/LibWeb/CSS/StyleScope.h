@@ -87,6 +87,7 @@ public:
     void invalidate_rule_cache();
 
     [[nodiscard]] RuleCache const& get_pseudo_class_rule_cache(PseudoClass) const;
+    [[nodiscard]] bool pseudo_class_can_affect_elements_outside_its_subtree(PseudoClass) const;
 
     template<typename Callback>
     void for_each_stylesheet(CascadeOrigin, Callback) const;
@@ -114,6 +115,7 @@ public:
     Vector<FlyString> m_qualified_layer_names_in_order;
     OwnPtr<SelectorInsights> m_selector_insights;
     Array<OwnPtr<RuleCache>, to_underlying(PseudoClass::__Count)> m_pseudo_class_rule_cache;
+    PseudoClassBitmap m_pseudo_classes_affecting_elements_outside_their_subtree;
     OwnPtr<StyleInvalidationData> m_style_invalidation_data;
     OwnPtr<RuleCaches> m_author_rule_cache;
     OwnPtr<RuleCaches> m_user_rule_cache;
@@ -14,6 +14,14 @@ class IntegerStyleValue final : public StyleValue {
 public:
     static ValueComparingNonnullRefPtr<IntegerStyleValue const> create(i64 value)
     {
+        if (value == 0) {
+            static auto zero_instance = adopt_ref(*new (nothrow) IntegerStyleValue(0));
+            return zero_instance;
+        }
+        if (value == 1) {
+            static auto one_instance = adopt_ref(*new (nothrow) IntegerStyleValue(1));
+            return one_instance;
+        }
         return adopt_ref(*new (nothrow) IntegerStyleValue(value));
     }
 
@@ -19,6 +19,18 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<KeywordStyleValue const> KeywordStyleValue::create(Keyword keyword)
+{
+    // OPTIMIZATION: Keyword values are immutable and there's a small, fixed number of them, so we share a single
+    //               instance per keyword. This saves an allocation for every "auto", "none", etc. in every style sheet,
+    //               and lets comparisons between them succeed on pointer equality.
+    static Array<RefPtr<KeywordStyleValue const>, keyword_count> s_instances;
+    auto& instance = s_instances[to_underlying(keyword)];
+    if (!instance)
+        instance = adopt_ref(*new (nothrow) KeywordStyleValue(keyword));
+    return *instance;
+}
+
 void KeywordStyleValue::serialize(StringBuilder& builder, SerializationMode) const
 {
     builder.append(string_from_keyword(keyword()));
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/BitCast.h>
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
 
 namespace Web::CSS {
@@ -17,6 +18,16 @@ class NumberStyleValue final : public StyleValue {
 public:
     static ValueComparingNonnullRefPtr<NumberStyleValue const> create(double value)
     {
+        // NOTE: 0 and 1 are by far the most common numbers, not least as the alpha channel of every RGB color.
+        //       We compare the bits so that -0 keeps its own instance.
+        if (bit_cast<u64>(value) == bit_cast<u64>(0.0)) {
+            static auto zero_instance = adopt_ref(*new (nothrow) NumberStyleValue(0));
+            return zero_instance;
+        }
+        if (value == 1) {
+            static auto one_instance = adopt_ref(*new (nothrow) NumberStyleValue(1));
+            return one_instance;
+        }
         return adopt_ref(*new (nothrow) NumberStyleValue(value));
     }
 
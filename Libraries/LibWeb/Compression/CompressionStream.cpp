@@ -11,12 +11,15 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Compression/CompressionStream.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/Streams/TransformStreamOperations.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
@@ -52,15 +55,7 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
     // 3. Let transformAlgorithm be an algorithm which takes a chunk argument and runs the compress and enqueue a chunk
     //    algorithm with this and chunk.
     auto transform_algorithm = GC::create_function(realm.heap(), [stream](JS::Value chunk) -> GC::Ref<WebIDL::Promise> {
-        auto& realm = stream->realm();
-        auto& vm = realm.vm();
-
-        if (auto result = stream->compress_and_enqueue_chunk(chunk); result.is_error()) {
-            auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
-            return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
-        }
-
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return stream->compress_and_enqueue_chunk(chunk);
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm with this.
@@ -104,22 +99,63 @@ void CompressionStream::visit_edges(JS::Cell::Visitor& visitor)
     Streams::GenericTransformStreamMixin::visit_edges(visitor);
 }
 
+// NB: Compressing smaller chunks than this takes less time than handing them to a background thread and back.
+static constexpr size_t min_chunk_size_to_compress_in_background = 16 * KiB;
+
 // https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
+GC::Ref<WebIDL::Promise> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
 {
     auto& realm = this->realm();
 
     // 1. If chunk is not a BufferSource type, then throw a TypeError.
     if (!WebIDL::is_buffer_source_type(chunk))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv });
 
     // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        return compress(chunk_buffer, Finish::No);
-    }();
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::create_rejected_promise_from_exception(realm, compression_error(chunk_buffer.error()));
+
+    if (chunk_buffer.value().size() < min_chunk_size_to_compress_in_background) {
+        auto result = enqueue_compressed_chunk(compress(chunk_buffer.value(), Finish::No));
+        if (result.is_error())
+            return WebIDL::create_rejected_promise_from_exception(realm, result.release_error());
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // OPTIMIZATION: Compressing a large chunk takes long enough to block the event loop noticeably, so we do it on a
+    //               background thread. The transform stream does not hand us the next chunk until the promise we
+    //               return settles, so the compressor is never used by two threads at once.
+    auto promise = WebIDL::create_promise(realm);
+
+    using Result = ErrorOr<ByteBuffer>;
+    (void)Threading::BackgroundAction<Result>::construct(
+        [stream = GC::Ref { *this }, chunk_buffer = chunk_buffer.release_value()](auto&) -> ErrorOr<Result> {
+            return stream->compress(chunk_buffer, Finish::No);
+        },
+        [stream = GC::make_root(*this), promise = GC::make_root(promise)](Result buffer) -> ErrorOr<void> {
+            auto& realm = stream->realm();
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            if (auto result = stream->enqueue_compressed_chunk(move(buffer)); result.is_error()) {
+                auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), result.exception());
+                WebIDL::reject_promise(realm, *promise, throw_completion.release_value());
+                return {};
+            }
+
+            WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+            return {};
+        });
+
+    return promise;
+}
+
+WebIDL::ExceptionOr<void> CompressionStream::enqueue_compressed_chunk(ErrorOr<ByteBuffer> maybe_buffer)
+{
+    auto& realm = this->realm();
+
     if (maybe_buffer.is_error())
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", maybe_buffer.error())) };
+        return compression_error(maybe_buffer.error());
 
     auto buffer = maybe_buffer.release_value();
 
@@ -136,6 +172,11 @@ WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Valu
     return {};
 }
 
+WebIDL::SimpleException CompressionStream::compression_error(Error const& error)
+{
+    return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", error)) };
+}
+
 // https://compression.spec.whatwg.org/#compress-flush-and-enqueue
 WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue()
 {
@@ -41,7 +41,9 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
-    WebIDL::ExceptionOr<void> compress_and_enqueue_chunk(JS::Value);
+    GC::Ref<WebIDL::Promise> compress_and_enqueue_chunk(JS::Value);
+    WebIDL::ExceptionOr<void> enqueue_compressed_chunk(ErrorOr<ByteBuffer>);
+    static WebIDL::SimpleException compression_error(Error const&);
     WebIDL::ExceptionOr<void> compress_flush_and_enqueue();
 
     enum class Finish {
@@ -116,14 +116,29 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
     // 2. Let buffer be the result of decompressing chunk with ds's format and context. If this results in an error,
     //    then throw a TypeError.
     auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
+        static constexpr size_t decompression_block_size = 64 * KiB;
+
         auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
         TRY(m_input_stream->write_until_depleted(move(chunk_buffer)));
 
-        auto decompressed = TRY(ByteBuffer::create_uninitialized(4096));
-        auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
-            return TRY(decompressor->read_some(decompressed.bytes())).size();
-        }));
-        return decompressed.slice(0, size);
+        // NB: We must decompress everything this chunk makes available, rather than a single block of it. Otherwise,
+        //     any output beyond that block would be held back until the stream is flushed.
+        ByteBuffer decompressed;
+
+        while (!m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); })) {
+            auto block = TRY(decompressed.get_bytes_for_writing(decompression_block_size));
+
+            auto size = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<size_t> {
+                return TRY(decompressor->decompress_available_input(block)).size();
+            }));
+            decompressed.resize(decompressed.size() - (block.size() - size));
+
+            // The decompressor only stops short of filling the block once it has consumed all of its buffered input.
+            if (size < block.size() && m_input_stream->used_buffer_size() == 0)
+                break;
+        }
+
+        return decompressed;
     }();
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress chunk: {}", maybe_buffer.error())) };
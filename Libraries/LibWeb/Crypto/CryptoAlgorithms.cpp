@@ -279,6 +279,14 @@ static WebIDL::ExceptionOr<ByteBuffer> generate_random_key(JS::VM& vm, u16 const
     return key_buffer;
 }
 
+// Turns the result of an AlgorithmMethods::BackgroundOperation into the result of the operation.
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> finish_background_operation(JS::Realm& realm, ErrorOr<ByteBuffer> result)
+{
+    if (result.is_error())
+        return WebIDL::OperationError::create(realm, Utf16String::formatted("{}", result.error()));
+    return JS::ArrayBuffer::create(realm, result.release_value());
+}
+
 JS::ThrowCompletionOr<GC::Ref<JS::Object>> EncapsulatedKey::to_object(JS::Realm& realm)
 {
     auto object = JS::Object::create(realm, realm.intrinsics().object_prototype());
@@ -3735,7 +3743,7 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
     return key;
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+WebIDL::ExceptionOr<AlgorithmMethods::BackgroundOperation> SHA::prepare_digest(AlgorithmParams const& algorithm, ByteBuffer data)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3758,15 +3766,13 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
-
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+    return [hash_kind, data = move(data)] -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::Manager hash { hash_kind };
+        hash.update(data);
 
-    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+        auto digest = hash.digest();
+        return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    };
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations
@@ -6858,6 +6864,13 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(prepare_derive_bits(params, key, length_optional)).release_value();
+    return finish_background_operation(m_realm, operation());
+}
+
+// https://w3c.github.io/webcrypto/#pbkdf2-operations
+WebIDL::ExceptionOr<Optional<AlgorithmMethods::BackgroundOperation>> PBKDF2::prepare_derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6896,15 +6909,17 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    return [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes] -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
 
-    // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
+        // 5. If the key derivation operation fails, then throw an OperationError.
+        if (maybe_result.is_error())
+            return Error::from_string_literal("Failed to derive key");
 
-    // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+        // 6. Return result
+        return maybe_result.release_value();
+    };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
@@ -9582,6 +9597,13 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> Argon2::import_key(AlgorithmParams const
 
 // https://wicg.github.io/webcrypto-modern-algos/#argon2-operations-derive-bits
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> Argon2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length)
+{
+    auto operation = TRY(prepare_derive_bits(params, key, length)).release_value();
+    return finish_background_operation(m_realm, operation());
+}
+
+// https://wicg.github.io/webcrypto-modern-algos/#argon2-operations-derive-bits
+WebIDL::ExceptionOr<Optional<AlgorithmMethods::BackgroundOperation>> Argon2::prepare_derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length)
 {
     auto const& normalized_algorithm = static_cast<Argon2Params const&>(params);
     // 1. If length is null, or is less than 32 (4*8), then throw an OperationError.
@@ -9604,53 +9626,52 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> Argon2::derive_bits(AlgorithmParam
     if (normalized_algorithm.passes == 0)
         return WebIDL::OperationError::create(m_realm, "Invalid passes"_utf16);
 
-    auto const algorithm = [&]() {
+    auto const type = [&]() {
         // 6 => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2d":
         //      Let type be 0.
         if (normalized_algorithm.name == "Argon2d")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2d);
+            return ::Crypto::Hash::Argon2Type::Argon2d;
         //   => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2i":
         //      Let type be 1.
         if (normalized_algorithm.name == "Argon2i")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2i);
+            return ::Crypto::Hash::Argon2Type::Argon2i;
         //   => If the name member of normalizedAlgorithm is a case-sensitive string match for "Argon2id":
         //      Let type be 2.
         if (normalized_algorithm.name == "Argon2id")
-            return ::Crypto::Hash::Argon2(::Crypto::Hash::Argon2Type::Argon2id);
+            return ::Crypto::Hash::Argon2Type::Argon2id;
 
         VERIFY_NOT_REACHED();
     }();
 
     // 7. Let secretValue be the secretValue member of normalizedAlgorithm, if present.
-    auto const& secret_value = normalized_algorithm.secret_value;
+    auto secret_value = normalized_algorithm.secret_value;
 
     // 8. Let associatedData be the associatedData member of normalizedAlgorithm, if present.
-    auto const& associated_data = normalized_algorithm.associated_data;
-
-    // 9. Let result be the result of performing the Argon2 function defined in Section 3 of [RFC9106] using the
-    //    password represented by [[handle]] internal slot of key as the message, P, the nonce attribute of
-    //    normalizedAlgorithm as the nonce, S, the value of the parallelism attribute of normalizedAlgorithm as the
-    //    degree of parallelism, p, the value of the memory attribute of normalizedAlgorithm as the memory size, m, the
-    //    value of the passes attribute of normalizedAlgorithm as the number of passes, t, 0x13 as the version number,
-    //    v, secretValue (if present) as the secret value, K, associatedData (if present) as the associated data, X, type
-    //    as the type, y, and length divided by 8 as the tag length, T.
-    VERIFY(key->handle().has<ByteBuffer>());
-    auto const maybe_result = algorithm.derive_key(
-        key->handle().get<ByteBuffer>(),
-        normalized_algorithm.nonce,
-        normalized_algorithm.parallelism,
-        normalized_algorithm.memory,
-        normalized_algorithm.passes,
-        0x13,
-        secret_value.map([](auto const& value) { return value.span(); }),
-        associated_data.map([](auto const& value) { return value.span(); }),
-        length.value() / 8);
-
-    // 10. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(m_realm, Utf16String::formatted("Hashing function failed: {}", maybe_result.error()));
+    auto associated_data = normalized_algorithm.associated_data;
 
-    return JS::ArrayBuffer::create(m_realm, maybe_result.value());
+    VERIFY(key->handle().has<ByteBuffer>());
+    auto message = key->handle().get<ByteBuffer>();
+
+    return [type, message = move(message), nonce = normalized_algorithm.nonce, parallelism = normalized_algorithm.parallelism, memory = normalized_algorithm.memory, passes = normalized_algorithm.passes, secret_value = move(secret_value), associated_data = move(associated_data), tag_length = length.value() / 8] -> ErrorOr<ByteBuffer> {
+        // 9. Let result be the result of performing the Argon2 function defined in Section 3 of [RFC9106] using the
+        //    password represented by [[handle]] internal slot of key as the message, P, the nonce attribute of
+        //    normalizedAlgorithm as the nonce, S, the value of the parallelism attribute of normalizedAlgorithm as the
+        //    degree of parallelism, p, the value of the memory attribute of normalizedAlgorithm as the memory size, m, the
+        //    value of the passes attribute of normalizedAlgorithm as the number of passes, t, 0x13 as the version number,
+        //    v, secretValue (if present) as the secret value, K, associatedData (if present) as the associated data, X, type
+        //    as the type, y, and length divided by 8 as the tag length, T.
+        // 10. If the key derivation operation fails, then throw an OperationError.
+        return ::Crypto::Hash::Argon2(type).derive_key(
+            message,
+            nonce,
+            parallelism,
+            memory,
+            passes,
+            0x13,
+            secret_value.map([](auto const& value) { return value.span(); }),
+            associated_data.map([](auto const& value) { return value.span(); }),
+            tag_length);
+    };
 }
 
 // https://wicg.github.io/webcrypto-modern-algos/#argon2-operations-get-key-length
@@ -9661,46 +9682,43 @@ WebIDL::ExceptionOr<JS::Value> Argon2::get_key_length(AlgorithmParams const&)
 }
 
 // https://wicg.github.io/webcrypto-modern-algos/#cshake-operations-digest
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> CShake::digest(AlgorithmParams const& params, ByteBuffer const& data)
+WebIDL::ExceptionOr<AlgorithmMethods::BackgroundOperation> CShake::prepare_digest(AlgorithmParams const& params, ByteBuffer data)
 {
     auto const& normalized_algorithm = static_cast<CShakeParams const&>(params);
 
     // 1. Let length be the length member of normalizedAlgorithm.
-    auto const& length = normalized_algorithm.length;
+    auto length = normalized_algorithm.length;
 
     // 2. Let functionName be the functionName member of normalizedAlgorithm if present or the empty octet string otherwise.
-    auto const& function_name = normalized_algorithm.function_name;
+    auto function_name = normalized_algorithm.function_name;
 
     // 3. Let customization be the customization member of normalizedAlgorithm if present or the empty octet string otherwise.
-    auto const& customization = normalized_algorithm.customization;
+    auto customization = normalized_algorithm.customization;
 
-    auto const algorithm = [&]() {
+    auto const kind = [&]() {
         // 4. If the name member of normalizedAlgorithm is a case-sensitive string match for "cSHAKE128":
         if (normalized_algorithm.name == "cSHAKE128"sv)
-            return ::Crypto::Hash::SHAKE(::Crypto::Hash::SHAKEKind::CSHAKE128);
+            return ::Crypto::Hash::SHAKEKind::CSHAKE128;
         // 4. If the name member of normalizedAlgorithm is a case-sensitive string match for "cSHAKE256":
         if (normalized_algorithm.name == "cSHAKE256"sv)
-            return ::Crypto::Hash::SHAKE(::Crypto::Hash::SHAKEKind::CSHAKE256);
+            return ::Crypto::Hash::SHAKEKind::CSHAKE256;
         VERIFY_NOT_REACHED();
     }();
 
-    // 4. Let result be the result of performing the cSHAKE128/cSHAKE256 function defined in Section 3 of [NIST-SP800-185]
-    // using message as the X input parameter,
-    // length as the L input parameter,
-    // functionName as the N input parameter,
-    // and customization as the S input parameter.
-    auto maybe_result = algorithm.digest(
-        data,
-        length,
-        customization.map([](auto const& value) { return value.span(); }),
-        function_name.map([](auto const& value) { return value.span(); }));
-
-    // 5. If performing the operation results in an error, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(m_realm, Utf16String::formatted("Hash function failed: {}", maybe_result.error()));
-
-    // 6. Return result.
-    return JS::ArrayBuffer::create(m_realm, maybe_result.release_value());
+    return [kind, data = move(data), length, function_name = move(function_name), customization = move(customization)] -> ErrorOr<ByteBuffer> {
+        // 4. Let result be the result of performing the cSHAKE128/cSHAKE256 function defined in Section 3 of [NIST-SP800-185]
+        // using message as the X input parameter,
+        // length as the L input parameter,
+        // functionName as the N input parameter,
+        // and customization as the S input parameter.
+        // 5. If performing the operation results in an error, then throw an OperationError.
+        // 6. Return result.
+        return ::Crypto::Hash::SHAKE(kind).digest(
+            data,
+            length,
+            customization.map([](auto const& value) { return value.span(); }),
+            function_name.map([](auto const& value) { return value.span(); }));
+    };
 }
 
 AeadParams::~AeadParams() = default;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibGC/Ptr.h>
@@ -317,6 +318,10 @@ class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
 
+    // The part of an operation that only works on bytes and never touches the JS heap, which makes it safe to run on a
+    // background thread. If it fails, the operation throws an OperationError.
+    using BackgroundOperation = Function<ErrorOr<ByteBuffer>()>;
+
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "encrypt is not supported"_utf16);
@@ -337,7 +342,8 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "verify is not supported"_utf16);
     }
 
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&)
+    // Returns the digest operation for the caller to run, once the parameters have been validated.
+    virtual WebIDL::ExceptionOr<BackgroundOperation> prepare_digest(AlgorithmParams const&, ByteBuffer)
     {
         return WebIDL::NotSupportedError::create(m_realm, "digest is not supported"_utf16);
     }
@@ -347,6 +353,13 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "deriveBits is not supported"_utf16);
     }
 
+    // Algorithms whose derive bits operation only works on bytes return it here for the caller to run, once the
+    // parameters have been validated. Other algorithms return nothing, and derive_bits() has to be used instead.
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> prepare_derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return OptionalNone {};
+    }
+
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "importKey is not supported"_utf16);
@@ -546,6 +559,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> prepare_derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -559,7 +573,7 @@ private:
 
 class SHA : public AlgorithmMethods {
 public:
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<BackgroundOperation> prepare_digest(AlgorithmParams const&, ByteBuffer) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -728,6 +742,7 @@ class Argon2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> prepare_derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new Argon2(realm)); }
@@ -741,7 +756,7 @@ private:
 
 class CShake : public AlgorithmMethods {
 public:
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<BackgroundOperation> prepare_digest(AlgorithmParams const&, ByteBuffer) override;
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new CShake(realm)); }
 
 private:
@@ -878,5 +893,6 @@ private:
 ErrorOr<String> base64_url_uint_encode(::Crypto::UnsignedBigInteger);
 WebIDL::ExceptionOr<ByteBuffer> base64_url_bytes_decode(JS::Realm&, String const& base64_url_string);
 WebIDL::ExceptionOr<::Crypto::UnsignedBigInteger> base64_url_uint_decode(JS::Realm&, String const& base64_url_string);
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> finish_background_operation(JS::Realm&, ErrorOr<ByteBuffer> result);
 
 }
@@ -12,6 +12,7 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -62,6 +63,30 @@ void SubtleCrypto::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+// OPTIMIZATION: Digests of large inputs, and key derivations like PBKDF2 with many iterations, can take a long time, so
+//               they run on a background thread instead of blocking the event loop. The promise is settled once they
+//               are done.
+static void perform_background_operation(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, AlgorithmMethods::BackgroundOperation operation)
+{
+    using Result = ErrorOr<ByteBuffer>;
+    (void)Threading::BackgroundAction<Result>::construct(
+        [operation = move(operation)](auto&) -> ErrorOr<Result> {
+            return operation();
+        },
+        [realm = GC::make_root(realm), promise = GC::make_root(promise)](Result result) -> ErrorOr<void> {
+            HTML::TemporaryExecutionContext context(*realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            auto array_buffer = finish_background_operation(*realm, move(result));
+            if (array_buffer.is_error()) {
+                WebIDL::reject_promise(*realm, *promise, Bindings::exception_to_throw_completion(realm->vm(), array_buffer.release_error()).release_value());
+                return {};
+            }
+
+            WebIDL::resolve_promise(*realm, *promise, array_buffer.release_value());
+            return {};
+        });
+}
+
 // https://w3c.github.io/webcrypto/#dfn-normalize-an-algorithm
 WebIDL::ExceptionOr<NormalizedAlgorithmAndParameter> normalize_an_algorithm(JS::Realm& realm, AlgorithmIdentifier const& algorithm, String operation)
 {
@@ -275,21 +300,20 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
-        auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
-
-        if (result.is_exception()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
+        auto operation = algorithm_object.methods->prepare_digest(*algorithm_object.parameter, move(data_buffer));
+        if (operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), operation.release_error()).release_value());
             return;
         }
 
         // 9. Resolve promise with result.
-        WebIDL::resolve_promise(realm, promise, result.release_value());
+        perform_background_operation(realm, promise, operation.release_value());
     }));
 
     return promise;
@@ -638,6 +662,17 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        auto operation = normalized_algorithm.methods->prepare_derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
+        if (operation.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), operation.release_error()).release_value());
+            return;
+        }
+        if (auto background_operation = operation.release_value(); background_operation.has_value()) {
+            // 10. Resolve promise with result.
+            perform_background_operation(realm, promise, background_operation.release_value());
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
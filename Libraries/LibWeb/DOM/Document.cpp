@@ -20,6 +20,7 @@
 #include <AK/Time.h>
 #include <AK/Utf8View.h>
 #include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGC/RootVector.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -92,6 +93,8 @@
 #include <LibWeb/DOM/Utils.h>
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/FetchRecord.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/AttributeNames.h>
@@ -125,6 +128,7 @@
 #include <LibWeb/HTML/HTMLMetaElement.h>
 #include <LibWeb/HTML/HTMLObjectElement.h>
 #include <LibWeb/HTML/HTMLScriptElement.h>
+#include <LibWeb/HTML/HTMLSelectElement.h>
 #include <LibWeb/HTML/HTMLStyleElement.h>
 #include <LibWeb/HTML/HTMLTextAreaElement.h>
 #include <LibWeb/HTML/HTMLTitleElement.h>
@@ -161,11 +165,13 @@
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/TreeBuilder.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/AccumulatedVisualContext.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
+#include <LibWeb/Painting/NavigableContainerViewportPaintable.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
@@ -504,7 +510,8 @@ Document::Document(JS::Realm& realm, URL::URL const& url, TemporaryDocumentForFr
 
         if (node->paintable()) {
             m_cursor_blink_state = !m_cursor_blink_state;
-            node->paintable()->set_needs_display();
+            // NB: The caret is recorded regardless of its blink state, so we only need a repaint.
+            node->paintable()->set_needs_display(InvalidateDisplayList::No);
         }
     });
 
@@ -651,6 +658,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_render_blocking_elements);
     visitor.visit(m_policy_container);
     visitor.visit(m_style_invalidator);
+    if (m_xpath_evaluation_cache)
+        m_xpath_evaluation_cache->visit_edges(visitor);
 }
 
 // https://w3c.github.io/selection-api/#dom-document-getselection
@@ -1201,6 +1210,7 @@ void Document::update_base_element(Badge<HTML::HTMLBaseElement>)
 
     m_first_base_element_with_href_in_tree_order = base_element_with_href;
     m_first_base_element_with_target_in_tree_order = base_element_with_target;
+    invalidate_encoding_parsed_url_cache();
 }
 
 GC::Ptr<HTML::HTMLBaseElement> Document::first_base_element_with_href_in_tree_order() const
@@ -1218,6 +1228,9 @@ void Document::respond_to_base_url_changes()
 {
     // To respond to base URL changes for a Document document:
 
+    // NB: URLs parsed against the old base URL may now resolve differently.
+    invalidate_encoding_parsed_url_cache();
+
     // 1. The user agent should update any user interface elements which are displaying affected URLs, or data derived
     //    from such URLs, to the user. Examples of such user interface elements would be a status bar that displays a
     //    hyperlink's url, or some user interface which displays the URL specified by a q, blockquote, ins, or del
@@ -1283,8 +1296,30 @@ URL::URL Document::base_url() const
     return base_element->frozen_base_url();
 }
 
+static constexpr size_t encoding_parsed_url_cache_limit = 4096;
+
 // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#encoding-parsing-a-url
 Optional<URL::URL> Document::encoding_parse_url(StringView url) const
+{
+    // OPTIMIZATION: Pages resolve the same URLs over and over (e.g. a link or image URL shared by many elements, or the
+    //               same url() in many style rules), so we remember the result of parsing each input.
+    if (auto it = m_encoding_parsed_url_cache.find(url); it != m_encoding_parsed_url_cache.end())
+        return it->value;
+
+    auto parsed_url = encoding_parse_url_impl(url);
+
+    // NB: Parsing a blob URL resolves it to its blob URL entry, which depends on whether the URL has been revoked since,
+    //     so those results are not cached.
+    if (!parsed_url.has_value() || parsed_url->scheme() != "blob"sv) {
+        if (m_encoding_parsed_url_cache.size() >= encoding_parsed_url_cache_limit)
+            m_encoding_parsed_url_cache.clear();
+        m_encoding_parsed_url_cache.set(MUST(String::from_utf8(url)), parsed_url);
+    }
+
+    return parsed_url;
+}
+
+Optional<URL::URL> Document::encoding_parse_url_impl(StringView url) const
 {
     // 1. Let encoding be UTF-8.
     // 2. If environment is a Document object, then set encoding to environment's character encoding.
@@ -1387,6 +1422,25 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+bool Document::update_layout_for_element(Element const& element, UpdateLayoutReason reason)
+{
+    // OPTIMIZATION: An element in a display: none subtree generates no boxes, so don't lay out the whole document just to
+    //               find that out. This keeps measuring loops cheap while they toggle hidden content. Elements rendered
+    //               in the top layer get a box regardless of their ancestors, though.
+    if (auto navigable = this->navigable(); navigable && navigable->active_document() == this) {
+        update_style();
+        for (auto const* ancestor = &element; ancestor; ancestor = ancestor->flat_tree_parent_element()) {
+            if (auto computed_properties = ancestor->computed_properties(); computed_properties && computed_properties->display().is_none())
+                return false;
+            if (ancestor->rendered_in_top_layer())
+                break;
+        }
+    }
+
+    update_layout(reason);
+    return true;
+}
+
 void Document::update_layout(UpdateLayoutReason reason)
 {
     auto navigable = this->navigable();
@@ -1402,6 +1456,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (m_created_for_appropriate_template_contents)
         return;
 
+    TRACE_EVENT(Layout, "Document::update_layout");
+
     // Clear text blocks cache so we rebuild them on the next find action.
     if (m_layout_root)
         m_layout_root->invalidate_text_blocks_cache();
@@ -1429,18 +1485,20 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
     }
 
-    m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
+    // OPTIMIZATION: This is a single pre-order traversal, rather than one pass per step. Every step only depends on
+    //               state that has already been recomputed for the node's ancestors, since containing blocks are
+    //               always ancestors.
+    m_layout_root->for_each_in_inclusive_subtree([&](Layout::Node& layout_node) {
         layout_node.recompute_containing_block({});
-        return TraversalDecision::Continue;
-    });
 
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
+        auto* box = as_if<Layout::Box>(layout_node);
+        if (!box)
+            return TraversalDecision::Continue;
+        auto& child = *box;
+
         child.clear_contained_abspos_children();
-        return TraversalDecision::Continue;
-    });
 
-    // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
+        // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
         if (!child.is_absolutely_positioned())
             return TraversalDecision::Continue;
         if (auto containing_block = child.containing_block()) {
@@ -1524,7 +1582,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     }
 }
 
-[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update, bool recompute_elements_depending_on_custom_properties, bool parent_display_changed)
+[[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update, HashTable<FlyString> const& changed_custom_properties, bool parent_display_changed)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
@@ -1537,12 +1595,12 @@ void Document::update_layout(UpdateLayoutReason reason)
     //       We will still recompute style for the children, though.
     bool is_display_none = false;
 
-    bool did_change_custom_properties = false;
+    HashTable<FlyString> changed_custom_properties_of_node;
     CSS::RequiredInvalidationAfterStyleChange node_invalidation;
     if (is<Element>(node)) {
         auto& element = static_cast<Element&>(node);
-        if (needs_full_style_update || node.needs_style_update() || parent_display_changed || (recompute_elements_depending_on_custom_properties && element.style_uses_var_css_function())) {
-            node_invalidation = element.recompute_style(did_change_custom_properties);
+        if (needs_full_style_update || node.needs_style_update() || parent_display_changed || (!changed_custom_properties.is_empty() && element.style_uses_any_custom_property_in(changed_custom_properties))) {
+            node_invalidation = element.recompute_style(changed_custom_properties_of_node);
         } else if (needs_inherited_style_update) {
             node_invalidation = element.recompute_inherited_style();
         }
@@ -1563,9 +1621,14 @@ void Document::update_layout(UpdateLayoutReason reason)
     node.set_needs_style_update(false);
     invalidation |= node_invalidation;
 
-    if (did_change_custom_properties) {
-        recompute_elements_depending_on_custom_properties = true;
+    // NB: Descendants have to be restyled if they use a custom property that changed on this node or any ancestor.
+    auto const* changed_custom_properties_for_children = &changed_custom_properties;
+    if (!changed_custom_properties_of_node.is_empty()) {
+        for (auto const& name : changed_custom_properties)
+            changed_custom_properties_of_node.set(name);
+        changed_custom_properties_for_children = &changed_custom_properties_of_node;
     }
+    bool const recompute_elements_depending_on_custom_properties = !changed_custom_properties_for_children->is_empty();
 
     bool children_need_inherited_style_update = !invalidation.is_none();
     // NB: When display changes to/from flex/grid/contents, children may need to be blockified or un-blockified.
@@ -1575,7 +1638,7 @@ void Document::update_layout(UpdateLayoutReason reason)
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
                 if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
-                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties, children_need_full_style_recompute);
+                    auto subtree_invalidation = update_style_recursively(*shadow_root, style_computer, children_need_inherited_style_update, *changed_custom_properties_for_children, children_need_full_style_recompute);
                     if (!is_display_none)
                         invalidation |= subtree_invalidation;
                 }
@@ -1584,7 +1647,7 @@ void Document::update_layout(UpdateLayoutReason reason)
 
         node.for_each_child([&](auto& child) {
             if (needs_full_style_update || child.needs_style_update() || children_need_inherited_style_update || child.child_needs_style_update() || recompute_elements_depending_on_custom_properties || children_need_full_style_recompute) {
-                auto subtree_invalidation = update_style_recursively(child, style_computer, children_need_inherited_style_update, recompute_elements_depending_on_custom_properties, children_need_full_style_recompute);
+                auto subtree_invalidation = update_style_recursively(child, style_computer, children_need_inherited_style_update, *changed_custom_properties_for_children, children_need_full_style_recompute);
                 if (!is_display_none)
                     invalidation |= subtree_invalidation;
             }
@@ -1630,6 +1693,8 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    TRACE_EVENT(Style, "Document::update_style");
+
     // Fetch the viewport rect once, instead of repeatedly, during style computation.
     style_computer().set_viewport_rect({}, viewport_rect());
 
@@ -1640,7 +1705,7 @@ void Document::update_style()
 
     build_registered_properties_cache();
 
-    auto invalidation = update_style_recursively(*this, style_computer(), false, false, false);
+    auto invalidation = update_style_recursively(*this, style_computer(), false, {}, false);
     if (!invalidation.is_none())
         invalidate_display_list();
 
@@ -1671,6 +1736,61 @@ void Document::update_animated_style_if_needed()
     m_needs_animated_style_update = false;
 }
 
+using VisualContextReplacements = HashMap<RefPtr<Painting::AccumulatedVisualContext const>, RefPtr<Painting::AccumulatedVisualContext const>>;
+
+struct VisualContextsOfBox {
+    GC::Ref<Painting::PaintableBox> box;
+    RefPtr<Painting::AccumulatedVisualContext const> own;
+    RefPtr<Painting::AccumulatedVisualContext const> for_descendants;
+};
+
+// Maps every context in the chain starting at old_context to the context at the same position in the chain starting
+// at new_context. Returns false if the chains don't have the same shape, as the display list recorded with the old
+// contexts can't be reused with the new ones then.
+static bool map_visual_context_chain(RefPtr<Painting::AccumulatedVisualContext const> old_context, RefPtr<Painting::AccumulatedVisualContext const> new_context, VisualContextReplacements& replacements)
+{
+    while (old_context || new_context) {
+        if (!old_context || !new_context)
+            return false;
+        if (old_context->data().index() != new_context->data().index())
+            return false;
+        if (auto existing_replacement = replacements.get(old_context); existing_replacement.has_value())
+            return existing_replacement.value() == new_context;
+        replacements.set(old_context, new_context);
+        old_context = old_context->parent();
+        new_context = new_context->parent();
+    }
+    return true;
+}
+
+// Maps the visual contexts referenced by the cached display list to the ones that replaced them. Returns false if that
+// isn't possible, in which case the display list has to be re-recorded.
+static bool update_visual_context_replacements(Vector<VisualContextsOfBox> const& previous_visual_contexts, VisualContextReplacements& visual_context_replacements)
+{
+    VisualContextReplacements replacements;
+    for (auto const& [box, own, for_descendants] : previous_visual_contexts) {
+        if (!map_visual_context_chain(own, box->accumulated_visual_context(), replacements))
+            return false;
+        if (!map_visual_context_chain(for_descendants, box->accumulated_visual_context_for_descendants(), replacements))
+            return false;
+    }
+
+    // NB: The tree may be rebuilt more than once before we record again, in which case the contexts referenced by our
+    //     display list have to be mapped all the way to the latest ones.
+    if (!visual_context_replacements.is_empty()) {
+        for (auto& it : visual_context_replacements) {
+            auto replacement = replacements.get(it.value);
+            if (!replacement.has_value())
+                return false;
+            it.value = replacement.release_value();
+        }
+        return true;
+    }
+
+    visual_context_replacements = move(replacements);
+    return true;
+}
+
 void Document::update_paint_and_hit_testing_properties_if_needed()
 {
     if (auto* paintable = this->paintable()) {
@@ -1687,7 +1807,21 @@ void Document::update_paint_and_hit_testing_properties_if_needed()
     if (m_needs_accumulated_visual_contexts_update) {
         m_needs_accumulated_visual_contexts_update = false;
         if (auto* paintable = this->paintable()) {
+            if (!m_cached_display_list_has_stale_visual_contexts) {
+                paintable->assign_accumulated_visual_contexts();
+                return;
+            }
+
+            Vector<VisualContextsOfBox> previous_visual_contexts;
+            paintable->for_each_in_inclusive_subtree_of_type<Painting::PaintableBox>([&](auto& paintable_box) {
+                previous_visual_contexts.append({ paintable_box, paintable_box.accumulated_visual_context(), paintable_box.accumulated_visual_context_for_descendants() });
+                return TraversalDecision::Continue;
+            });
+
             paintable->assign_accumulated_visual_contexts();
+
+            if (!update_visual_context_replacements(previous_visual_contexts, m_visual_context_replacements))
+                invalidate_display_list();
         }
     }
 }
@@ -1906,6 +2040,18 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
         return result;
     };
 
+    // OPTIMIZATION: Only the old and new elements and their shadow-including ancestors change state. If no rule lets
+    //               that state reach siblings (e.g. ".a:hover + .b") or :has() subjects, then below the common
+    //               ancestor only subtrees containing the old or new element can be affected, and we can skip the rest.
+    //               Moving the pointer between cells in the same table row then only visits those two cells.
+    Node const* old_node = element_slot.ptr();
+    Node const* new_node = node.ptr();
+    bool const can_skip_unchanged_subtrees = !style_scope.pseudo_class_can_affect_elements_outside_its_subtree(pseudo_class);
+    auto subtree_contains_changed_element = [&](Node const& subtree_root) {
+        return (old_node && subtree_root.is_shadow_including_inclusive_ancestor_of(*old_node))
+            || (new_node && subtree_root.is_shadow_including_inclusive_ancestor_of(*new_node));
+    };
+
     Function<void(Node&)> invalidate_affected_elements_recursively = [&](Node& node) -> void {
         if (node.is_element()) {
             auto& element = static_cast<Element&>(node);
@@ -1915,7 +2061,10 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
             }
         }
 
+        bool const is_common_ancestor = &node == &old_new_common_ancestor;
         node.for_each_child([&](auto& child) {
+            if (is_common_ancestor && can_skip_unchanged_subtrees && !subtree_contains_changed_element(child))
+                return IterationDecision::Continue;
             invalidate_affected_elements_recursively(child);
             return IterationDecision::Continue;
         });
@@ -4209,9 +4358,11 @@ void Document::run_unloading_cleanup_steps()
 
         // 2. Clear window's map of active timers.
         window.clear_map_of_active_timers();
-    }
 
-    FileAPI::run_unloading_cleanup_steps(*this);
+        // NB: Blob URLs must keep working for a document restored from the back/forward cache, so we only revoke them
+        //     once the document can no longer be restored.
+        FileAPI::run_unloading_cleanup_steps(*this);
+    }
 }
 
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#destroy-a-document
@@ -4463,6 +4614,61 @@ void Document::set_browsing_context(GC::Ptr<HTML::BrowsingContext> browsing_cont
     m_browsing_context = browsing_context;
 }
 
+// NB: The spec leaves it up to the user agent which documents to keep in the back/forward cache. We only keep documents
+//     whose restoration can't be observed as different from a fresh load in ways we don't implement yet.
+bool Document::is_eligible_for_back_forward_cache() const
+{
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable())
+        return false;
+
+    if (is_initial_about_blank() || readiness() != HTML::DocumentReadyState::Complete)
+        return false;
+
+    // NB: Documents loaded from anything other than the network are cheap to load again.
+    if (!url().scheme().is_one_of("http"sv, "https"sv))
+        return false;
+
+    // FIXME: Support documents with child navigables, which have to be frozen and restored along with their parent.
+    if (!document_tree_child_navigables().is_empty())
+        return false;
+
+    // NB: Pages with unload handlers expect them to run when navigating away, which can't happen if they're kept alive.
+    auto const& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    if (window.has_event_listener(HTML::EventNames::unload))
+        return false;
+
+    if (m_browsing_context && m_browsing_context->opener_browsing_context())
+        return false;
+
+    return true;
+}
+
+template<typename Callback>
+static void for_each_ongoing_fetch(Document& document, Callback callback)
+{
+    for (auto const& record : HTML::relevant_settings_object(document).fetch_group()) {
+        auto controller = record->fetch_controller();
+        if (controller && controller->state() == Fetch::Infrastructure::FetchController::State::Ongoing)
+            callback(*controller);
+    }
+}
+
+void Document::freeze_fetches()
+{
+    for_each_ongoing_fetch(*this, [](auto& controller) { controller.freeze(); });
+}
+
+void Document::unfreeze_fetches()
+{
+    for_each_ongoing_fetch(*this, [](auto& controller) { controller.unfreeze(); });
+}
+
+void Document::stop_frozen_fetches()
+{
+    for_each_ongoing_fetch(*this, [](auto& controller) { controller.stop_fetch(); });
+}
+
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
 void Document::unload(GC::Ptr<Document>)
 {
@@ -4476,7 +4682,7 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    auto intend_to_store_in_bfcache = is_eligible_for_back_forward_cache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4528,11 +4734,15 @@ void Document::unload(GC::Ptr<Document>)
 
     // FIXME: 17. Set oldDocument's has been scrolled by the user to false.
 
-    // FIXME: 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    // 18. Run any unloading document cleanup steps for oldDocument that are defined by this specification and other applicable specifications.
+    run_unloading_cleanup_steps();
 
     // 19. If oldDocument's salvageable state is false, then destroy oldDocument.
     if (!m_salvageable) {
         // NOTE: Document is destroyed from Document::unload_a_document_and_its_descendants()
+    } else {
+        // NB: The UI has to be told about the page having loaded once it's restored from the back/forward cache.
+        m_needs_to_call_page_did_load = true;
     }
 
     // 20. Decrease oldDocument's unload counter by 1.
@@ -4597,6 +4807,15 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // NB: A document that is still salvageable is kept alive in its session history entry for the back/forward cache.
+    //     Only documents without descendants are ever kept, see is_eligible_for_back_forward_cache().
+    if (m_salvageable) {
+        freeze_fetches();
+        if (after_all_unloads)
+            HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, relevant_global_object(*this), *after_all_unloads);
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
@@ -5417,9 +5636,66 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& navigation_entries)
+{
+    // 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset
+    //    algorithm for formControl.
+    auto reset_if_autofill_is_off = [](auto& form_control) {
+        if (form_control.parse_autocomplete_attribute().field_name == "off"sv)
+            form_control.reset_algorithm();
+    };
+    for_each_in_subtree_of_type<HTML::HTMLElement>([&](auto& element) {
+        if (auto* input_element = as_if<HTML::HTMLInputElement>(element))
+            reset_if_autofill_is_off(*input_element);
+        else if (auto* select_element = as_if<HTML::HTMLSelectElement>(element))
+            reset_if_autofill_is_off(*select_element);
+        else if (auto* text_area_element = as_if<HTML::HTMLTextAreaElement>(element))
+            reset_if_autofill_is_off(*text_area_element);
+        return TraversalDecision::Continue;
+    });
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase
+    //              activeTimers[handle] by suspendDuration.
+
+    // NB: Fetches that were in flight when the document was put in the back/forward cache pick up where they left off.
+    unfreeze_fetches();
+
+    // 3. Update the navigation API entries for a reactivation given document's relevant global object's navigation API,
+    //    navigationEntries, and reactivatedEntry.
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    window.navigation()->update_the_navigation_api_entries_for_reactivation(navigation_entries, reactivated_entry);
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        set_page_showing(true);
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
     }
+
+    // AD-HOC: The layout tree was torn down when the document was unloaded, and the viewport may have changed while
+    //         the document was in the back/forward cache.
+    invalidate_style(StyleInvalidationReason::ReactivateDocument);
+    set_needs_media_query_evaluation();
 }
 
 HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& Document::shared_resource_requests()
@@ -6313,6 +6589,71 @@ bool Document::is_decoded_svg() const
     return page().client().is_svg_page_client();
 }
 
+void Document::prefetch_dns_for_hyperlink(URL::URL const& url)
+{
+    // NB: A page full of links to distinct hosts should not be able to flood the resolver.
+    static constexpr size_t maximum_number_of_hosts_to_prefetch = 64;
+
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    // NB: The document's own host has already been resolved to load the document itself.
+    auto host = url.serialized_host();
+    if (host == this->url().serialized_host())
+        return;
+
+    if (m_hosts_with_prefetched_dns.size() >= maximum_number_of_hosts_to_prefetch)
+        return;
+    if (m_hosts_with_prefetched_dns.set(move(host)) != AK::HashSetResult::InsertedNewEntry)
+        return;
+
+    ResourceLoader::the().prefetch_dns(url);
+}
+
+void Document::add_speculation_rule_set(HTML::HTMLScriptElement const& script_element, HTML::SpeculationRuleSet rule_set)
+{
+    m_speculation_rule_sets.set(script_element.unique_id(), move(rule_set));
+    consider_speculative_loads();
+}
+
+void Document::remove_speculation_rule_set(HTML::HTMLScriptElement const& script_element)
+{
+    if (m_speculation_rule_sets.remove(script_element.unique_id()))
+        consider_speculative_loads();
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#consider-speculative-loads
+void Document::consider_speculative_loads()
+{
+    // NB: Every prefetch competes with the document's own loads for the network, so a document can't ask for too many.
+    static constexpr size_t maximum_number_of_prefetches = 50;
+
+    // 1. If document's node navigable is not a top-level traversable, then return.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable())
+        return;
+
+    // FIXME: 2. Queue a task to run the inner consider speculative loads steps, which also handle prerendering, and
+    //           the eagerness of rules based on user interaction with the links they match.
+    for (auto const& [_, rule_set] : m_speculation_rule_sets) {
+        for (auto const& rule : rule_set.prefetch_rules) {
+            // FIXME: Rules with moderate or conservative eagerness should only be acted upon once the user hovers or
+            //        presses a link to one of their URLs.
+            if (rule.eagerness != HTML::SpeculationRuleEagerness::Immediate && rule.eagerness != HTML::SpeculationRuleEagerness::Eager)
+                continue;
+
+            for (auto const& url : rule.urls) {
+                if (m_prefetched_urls.size() >= maximum_number_of_prefetches)
+                    return;
+                if (m_prefetched_urls.set(url) != AK::HashSetResult::InsertedNewEntry)
+                    continue;
+
+                HTML::prefetch(*this, url, rule.referrer_policy);
+            }
+        }
+    }
+}
+
 // https://drafts.csswg.org/css-position-4/#add-an-element-to-the-top-layer
 void Document::add_an_element_to_the_top_layer(GC::Ref<Element> element)
 {
@@ -6677,24 +7018,122 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
         return;
     }
 
+    // NB: invalidate_display_list() has already let the container documents know that our display list changed.
     if (auto container = navigable->container()) {
-        container->document().set_needs_display(should_invalidate_display_list);
+        container->document().set_needs_display(InvalidateDisplayList::No);
     }
 }
 
 void Document::invalidate_display_list()
 {
+    if (m_cached_display_list)
+        m_superseded_display_list = m_cached_display_list;
     m_cached_display_list.clear();
+    m_cached_display_list_has_stale_nested_display_lists = false;
+    m_cached_display_list_has_stale_visual_contexts = false;
+    m_visual_context_replacements.clear();
+
+    auto navigable = this->navigable();
+    if (!navigable)
+        return;
+
+    if (auto container = navigable->container()) {
+        container->document().invalidate_nested_display_lists();
+    }
+}
+
+void Document::invalidate_nested_display_lists()
+{
+    // NB: Nothing in this document has changed, so our display list only needs its nested display lists swapped out.
+    //     Containers further up still reference our current display list, which is about to be replaced as well.
+    if (m_cached_display_list)
+        m_cached_display_list_has_stale_nested_display_lists = true;
 
     auto navigable = this->navigable();
     if (!navigable)
         return;
 
     if (auto container = navigable->container()) {
-        container->document().invalidate_display_list();
+        container->document().invalidate_nested_display_lists();
     }
 }
 
+void Document::invalidate_visual_contexts_of_display_list()
+{
+    if (!m_cached_display_list)
+        return;
+    m_cached_display_list_has_stale_visual_contexts = true;
+
+    auto navigable = this->navigable();
+    if (!navigable)
+        return;
+
+    if (auto container = navigable->container()) {
+        container->document().invalidate_nested_display_lists();
+    }
+}
+
+static bool display_list_references_visual_contexts(Painting::DisplayList const& display_list)
+{
+    for (auto const& item : display_list.commands()) {
+        if (item.context)
+            return true;
+        if (auto const* mask = item.command.get_pointer<Painting::AddMask>(); mask && mask->display_list && display_list_references_visual_contexts(*mask->display_list))
+            return true;
+    }
+    return false;
+}
+
+// Copies the cached display list, replacing the display list of every nested navigable with a freshly recorded one,
+// and every visual context with its replacement if any are given. Returns null if a nested display list or a visual
+// context can't be accounted for, in which case a full re-record is needed.
+static RefPtr<Painting::DisplayList> copy_display_list_with_updated_dependencies(Painting::DisplayList const& cached_display_list, Painting::ViewportPaintable& viewport_paintable, HTML::PaintConfig const& config, VisualContextReplacements const* visual_context_replacements)
+{
+    HashMap<Painting::DisplayList const*, Document*> hosted_document_by_display_list;
+    viewport_paintable.for_each_in_inclusive_subtree_of_type<Painting::NavigableContainerViewportPaintable>([&](auto& navigable_container_paintable) {
+        auto* hosted_document = const_cast<Document*>(navigable_container_paintable.navigable_container().content_document_without_origin_check());
+        if (!hosted_document || !hosted_document->paintable())
+            return TraversalDecision::Continue;
+        if (auto display_list = hosted_document->cached_display_list())
+            hosted_document_by_display_list.set(display_list.ptr(), hosted_document);
+        if (auto superseded_display_list = hosted_document->superseded_display_list())
+            hosted_document_by_display_list.set(superseded_display_list.ptr(), hosted_document);
+        return TraversalDecision::Continue;
+    });
+
+    // NB: This must match the config NavigableContainerViewportPaintable::paint() records nested display lists with.
+    HTML::PaintConfig nested_config;
+    nested_config.paint_overlay = config.paint_overlay;
+    nested_config.should_show_line_box_borders = config.should_show_line_box_borders;
+
+    auto display_list = Painting::DisplayList::create(cached_display_list.device_pixels_per_css_pixel());
+    for (auto const& item : cached_display_list.commands()) {
+        auto command = item.command;
+        if (auto* nested = command.get_pointer<Painting::PaintNestedDisplayList>(); nested && nested->display_list) {
+            auto hosted_document = hosted_document_by_display_list.get(nested->display_list.ptr());
+            if (!hosted_document.has_value())
+                return nullptr;
+            nested->display_list = hosted_document.value()->record_display_list(nested_config);
+            hosted_document.value()->release_superseded_display_list();
+        }
+
+        auto context = item.context;
+        if (visual_context_replacements) {
+            // NB: Mask display lists are recorded without visual contexts, so they can be shared as they are.
+            if (auto const* mask = command.get_pointer<Painting::AddMask>(); mask && mask->display_list && display_list_references_visual_contexts(*mask->display_list))
+                return nullptr;
+            if (context) {
+                auto replacement = visual_context_replacements->get(context);
+                if (!replacement.has_value())
+                    return nullptr;
+                context = replacement.release_value();
+            }
+        }
+        display_list->append(move(command), move(context));
+    }
+    return display_list;
+}
+
 RefPtr<Painting::DisplayList> Document::cached_display_list() const
 {
     return m_cached_display_list;
@@ -6702,8 +7141,26 @@ RefPtr<Painting::DisplayList> Document::cached_display_list() const
 
 RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config)
 {
-    if (m_cached_display_list && m_cached_display_list_paint_config == config)
-        return m_cached_display_list;
+    if (m_cached_display_list && m_cached_display_list_paint_config == config && paintable()) {
+        if (!m_cached_display_list_has_stale_nested_display_lists && !m_cached_display_list_has_stale_visual_contexts)
+            return m_cached_display_list;
+
+        // OPTIMIZATION: Only nested navigables or visual contexts (e.g. an animated transform or opacity) have changed
+        //               since we last recorded, so instead of walking our whole paint tree again, reuse our commands
+        //               and only swap in the new nested display lists and visual contexts.
+        update_paint_and_hit_testing_properties_if_needed();
+        if (m_cached_display_list) {
+            auto const* visual_context_replacements = m_cached_display_list_has_stale_visual_contexts ? &m_visual_context_replacements : nullptr;
+            if (auto display_list = copy_display_list_with_updated_dependencies(*m_cached_display_list, *paintable(), config, visual_context_replacements)) {
+                m_superseded_display_list = m_cached_display_list;
+                m_cached_display_list = display_list;
+                m_cached_display_list_has_stale_nested_display_lists = false;
+                m_cached_display_list_has_stale_visual_contexts = false;
+                m_visual_context_replacements.clear();
+                return display_list;
+            }
+        }
+    }
 
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
@@ -6760,8 +7217,13 @@ RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig co
         highlighted_node()->paintable()->paint_inspector_overlay(context);
     }
 
+    if (m_cached_display_list)
+        m_superseded_display_list = m_cached_display_list;
     m_cached_display_list = display_list;
     m_cached_display_list_paint_config = config;
+    m_cached_display_list_has_stale_nested_display_lists = false;
+    m_cached_display_list_has_stale_visual_contexts = false;
+    m_visual_context_replacements.clear();
 
     return display_list;
 }
@@ -6962,6 +7424,28 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+// NB: Past this many selectors, we start over rather than keeping lists around that might never be used again.
+static constexpr size_t max_cached_selector_lists_for_queries = 256;
+
+Optional<CSS::SelectorList> Document::cached_selector_list_for_query(String const& selector_text) const
+{
+    return m_selector_lists_for_queries.get(selector_text);
+}
+
+void Document::cache_selector_list_for_query(String selector_text, CSS::SelectorList selector_list)
+{
+    if (m_selector_lists_for_queries.size() >= max_cached_selector_lists_for_queries)
+        m_selector_lists_for_queries.clear();
+    m_selector_lists_for_queries.set(move(selector_text), move(selector_list));
+}
+
+XPath::EvaluationCache& Document::xpath_evaluation_cache() const
+{
+    if (!m_xpath_evaluation_cache)
+        m_xpath_evaluation_cache = make<XPath::EvaluationCache>();
+    return *m_xpath_evaluation_cache;
+}
+
 String Document::dump_display_list()
 {
     update_layout(UpdateLayoutReason::DumpDisplayList);
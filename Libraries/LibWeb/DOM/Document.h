@@ -27,6 +27,7 @@
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/CustomPropertyRegistration.h>
 #include <LibWeb/CSS/EnvironmentVariable.h>
+#include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleScope.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
@@ -42,6 +43,7 @@
 #include <LibWeb/HTML/NavigationType.h>
 #include <LibWeb/HTML/PaintConfig.h>
 #include <LibWeb/HTML/SandboxingFlagSet.h>
+#include <LibWeb/HTML/SpeculationRules.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/InvalidateDisplayList.h>
@@ -274,6 +276,7 @@ public:
 
     Optional<URL::URL> encoding_parse_url(StringView) const;
     Optional<String> encoding_parse_and_serialize_url(StringView) const;
+    void invalidate_encoding_parsed_url_cache() { m_encoding_parsed_url_cache.clear(); }
 
     CSS::StyleComputer& style_computer() { return *m_style_computer; }
     CSS::StyleComputer const& style_computer() const { return *m_style_computer; }
@@ -379,6 +382,15 @@ public:
 
     void update_style();
     void update_layout(UpdateLayoutReason);
+
+    // Brings layout up to date to answer a query about the boxes of the given element. Returns false without updating
+    // layout if the element can't have any box, in which case its layout node may be stale and must not be looked at.
+    [[nodiscard]] bool update_layout_for_element(Element const&, UpdateLayoutReason);
+
+    // Whether the layout tree reflects the current style, i.e. whether layout nodes carry up-to-date computed values
+    // even if their geometry is stale.
+    [[nodiscard]] bool layout_tree_is_up_to_date() const { return m_layout_root && !needs_layout_tree_update() && !child_needs_layout_tree_update() && !needs_full_layout_tree_update(); }
+
     void update_paint_and_hit_testing_properties_if_needed();
     void update_animated_style_if_needed();
 
@@ -525,7 +537,11 @@ public:
     bool has_encoding() const { return m_encoding.has_value(); }
     Optional<String> const& encoding() const { return m_encoding; }
     String encoding_or_default() const { return m_encoding.value_or("UTF-8"_string); }
-    void set_encoding(Optional<String> encoding) { m_encoding = move(encoding); }
+    void set_encoding(Optional<String> encoding)
+    {
+        m_encoding = move(encoding);
+        invalidate_encoding_parsed_url_cache();
+    }
 
     // NOTE: These are intended for the JS bindings
     String character_set() const { return encoding_or_default(); }
@@ -654,7 +670,11 @@ public:
 
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-about-base-url
     Optional<URL::URL> about_base_url() const { return m_about_base_url; }
-    void set_about_base_url(Optional<URL::URL> url) { m_about_base_url = url; }
+    void set_about_base_url(Optional<URL::URL> url)
+    {
+        m_about_base_url = url;
+        invalidate_encoding_parsed_url_cache();
+    }
 
     String domain() const;
     WebIDL::ExceptionOr<void> set_domain(String const&);
@@ -745,6 +765,14 @@ public:
 
     void make_active();
 
+    bool is_eligible_for_back_forward_cache() const;
+
+    // The in-flight fetches of a document in the back/forward cache are suspended until it's restored, and stopped
+    // if it's evicted instead.
+    void freeze_fetches();
+    void unfreeze_fetches();
+    void stop_frozen_fetches();
+
     void set_salvageable(bool value) { m_salvageable = value; }
 
     void make_unsalvageable(String reason);
@@ -775,6 +803,9 @@ public:
 
     void update_for_history_step_application(GC::Ref<HTML::SessionHistoryEntry>, bool do_not_reactivate, size_t script_history_length, size_t script_history_index, Optional<Bindings::NavigationType> navigation_type, Optional<Vector<GC::Ref<HTML::SessionHistoryEntry>>> entries_for_navigation_api = {}, GC::Ptr<HTML::SessionHistoryEntry> previous_entry_for_activation = {}, bool update_navigation_api = true);
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& navigation_entries);
+
     HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& shared_resource_requests();
 
     void restore_the_history_object_state(GC::Ref<HTML::SessionHistoryEntry> entry);
@@ -874,6 +905,17 @@ public:
     // Does document represent an embedded svg img
     [[nodiscard]] bool is_decoded_svg() const;
 
+    // OPTIMIZATION: Resolves the host of a hyperlink ahead of time, so that following it doesn't have to wait on DNS.
+    void prefetch_dns_for_hyperlink(URL::URL const&);
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    void add_speculation_rule_set(HTML::HTMLScriptElement const&, HTML::SpeculationRuleSet);
+    void remove_speculation_rule_set(HTML::HTMLScriptElement const&);
+    OrderedHashMap<UniqueNodeID, HTML::SpeculationRuleSet> const& speculation_rule_sets() const { return m_speculation_rule_sets; }
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#consider-speculative-loads
+    void consider_speculative_loads();
+
     Vector<GC::Root<Range>> find_matching_text(String const&, CaseSensitivity);
 
     void parse_html_from_a_string(StringView);
@@ -896,9 +938,13 @@ public:
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
     RefPtr<Painting::DisplayList> cached_display_list() const;
+    RefPtr<Painting::DisplayList> superseded_display_list() const { return m_superseded_display_list; }
+    void release_superseded_display_list() { m_superseded_display_list.clear(); }
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
 
     void invalidate_display_list();
+    void invalidate_nested_display_lists();
+    void invalidate_visual_contexts_of_display_list();
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -976,6 +1022,11 @@ public:
 
     ElementByIdMap& element_by_id() const;
 
+    Optional<CSS::SelectorList> cached_selector_list_for_query(String const& selector_text) const;
+    void cache_selector_list_for_query(String selector_text, CSS::SelectorList);
+
+    XPath::EvaluationCache& xpath_evaluation_cache() const;
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -1025,6 +1076,8 @@ private:
 
     void evaluate_media_rules();
 
+    Optional<URL::URL> encoding_parse_url_impl(StringView) const;
+
     enum class AddLineFeed {
         Yes,
         No,
@@ -1069,6 +1122,12 @@ private:
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
 
+    // OPTIMIZATION: Scripts tend to run the same few selectors through querySelector() and friends over and over, so we
+    //               hold on to the ones we've parsed for them.
+    HashMap<String, CSS::SelectorList> m_selector_lists_for_queries;
+
+    mutable OwnPtr<XPath::EvaluationCache> m_xpath_evaluation_cache;
+
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
@@ -1156,6 +1215,13 @@ private:
 
     HashTable<GC::Ref<CSS::CSSImportRule>> m_pending_css_import_rules;
 
+    HashTable<String> m_hosts_with_prefetched_dns;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    // NB: Keyed by the script element that each rule set came from, so that it can be removed along with it.
+    OrderedHashMap<UniqueNodeID, HTML::SpeculationRuleSet> m_speculation_rule_sets;
+    HashTable<URL::URL> m_prefetched_urls;
+
     GC::Ptr<HTML::History> m_history;
 
     size_t m_number_of_things_delaying_the_load_event { 0 };
@@ -1253,6 +1319,10 @@ private:
     GC::Ptr<HTML::HTMLBaseElement> m_first_base_element_with_href_in_tree_order;
     GC::Ptr<HTML::HTMLBaseElement> m_first_base_element_with_target_in_tree_order;
 
+    // NOTE: This is a cache of the results of encoding_parse_url(), keyed by the input. Those results depend on the base
+    //       URL and the character encoding, so it is cleared whenever either of them may have changed.
+    mutable HashMap<String, Optional<URL::URL>> m_encoding_parsed_url_cache;
+
     // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
     GC::Ptr<HTML::ListOfAvailableImages> m_list_of_available_images;
 
@@ -1360,6 +1430,19 @@ private:
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
 
+    // NB: Set when only the display lists of nested navigables have changed since m_cached_display_list was recorded.
+    bool m_cached_display_list_has_stale_nested_display_lists { false };
+
+    // NB: The display list that m_cached_display_list replaced, if any, which a container document's cached display list
+    //     may still reference. It is looked up by address, so we keep it alive until the container has swapped it out;
+    //     otherwise another display list could be allocated at the same address and be mistaken for it.
+    RefPtr<Painting::DisplayList> m_superseded_display_list;
+
+    // NB: Set when only the AccumulatedVisualContext tree has changed since m_cached_display_list was recorded. The
+    //     contexts it references are then mapped to the ones that replaced them when the tree gets rebuilt.
+    bool m_cached_display_list_has_stale_visual_contexts { false };
+    HashMap<RefPtr<Painting::AccumulatedVisualContext const>, RefPtr<Painting::AccumulatedVisualContext const>> m_visual_context_replacements;
+
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
 
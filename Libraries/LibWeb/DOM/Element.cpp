@@ -11,6 +11,7 @@
 #include <AK/Debug.h>
 #include <AK/IterationDecision.h>
 #include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
@@ -133,13 +134,15 @@ void Element::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_inline_style);
     visitor.visit(m_class_list);
     visitor.visit(m_shadow_root);
-    visitor.visit(m_part_list);
     visitor.visit(m_custom_element_definition);
-    visitor.visit(m_custom_state_set);
     visitor.visit(m_cascaded_properties);
     visitor.visit(m_computed_properties);
-    visitor.visit(m_computed_style_map_cache);
-    visitor.visit(m_attribute_style_map);
+    if (m_rare_data) {
+        visitor.visit(m_rare_data->attribute_style_map);
+        visitor.visit(m_rare_data->part_list);
+        visitor.visit(m_rare_data->custom_state_set);
+        visitor.visit(m_rare_data->computed_style_map_cache);
+    }
     if (m_pseudo_element_data) {
         for (auto& pseudo_element : *m_pseudo_element_data) {
             visitor.visit(pseudo_element.value);
@@ -838,12 +841,13 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(C
     return invalidation;
 }
 
-CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_change_custom_properties)
+CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(HashTable<FlyString>& changed_custom_properties)
 {
     VERIFY(parent());
 
     m_style_uses_attr_css_function = false;
     m_style_uses_var_css_function = false;
+    m_custom_properties_used_by_style.clear();
     m_affected_by_has_pseudo_class_in_subject_position = false;
     m_affected_by_has_pseudo_class_in_non_subject_position = false;
     m_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator = false;
@@ -854,7 +858,7 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
     m_sibling_invalidation_distance = 0;
 
     auto& style_computer = document().style_computer();
-    auto new_computed_properties = style_computer.compute_style({ *this }, did_change_custom_properties);
+    auto new_computed_properties = style_computer.compute_style({ *this }, changed_custom_properties);
 
     // Tables must not inherit -libweb-* values for text-align.
     // FIXME: Find the spec for this.
@@ -894,7 +898,7 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
         style_computer.push_ancestor(*this);
 
         auto pseudo_element_style = computed_properties(pseudo_element);
-        auto new_pseudo_element_style = style_computer.compute_pseudo_element_style_if_needed({ *this, pseudo_element }, did_change_custom_properties);
+        auto new_pseudo_element_style = style_computer.compute_pseudo_element_style_if_needed({ *this, pseudo_element }, changed_custom_properties);
 
         // TODO: Can we be smarter about invalidation?
         if (pseudo_element_style && new_pseudo_element_style) {
@@ -1033,9 +1037,30 @@ GC::Ref<DOMTokenList> Element::part_list()
 {
     // The part attribute’s getter must return a DOMTokenList object whose associated element is the context object and
     // whose associated attribute’s local name is part.
-    if (!m_part_list)
-        m_part_list = DOMTokenList::create(*this, HTML::AttributeNames::part);
-    return *m_part_list;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.part_list)
+        rare_data.part_list = DOMTokenList::create(*this, HTML::AttributeNames::part);
+    return *rare_data.part_list;
+}
+
+Element::RareData& Element::ensure_rare_data()
+{
+    if (!m_rare_data)
+        m_rare_data = make<RareData>();
+    return *m_rare_data;
+}
+
+Optional<String> const& Element::is_value() const
+{
+    static Optional<String> const s_no_is_value;
+    return m_rare_data ? m_rare_data->is_value : s_no_is_value;
+}
+
+void Element::set_is_value(Optional<String> const& is)
+{
+    if (!is.has_value() && !m_rare_data)
+        return;
+    ensure_rare_data().is_value = is;
 }
 
 // https://dom.spec.whatwg.org/#valid-shadow-host-name
@@ -1063,9 +1088,9 @@ WebIDL::ExceptionOr<void> Element::attach_a_shadow_root(Bindings::ShadowRootMode
         return WebIDL::NotSupportedError::create(realm(), "Element's local name is not a valid shadow host name"_utf16);
 
     // 3. If element’s local name is a valid custom element name, or element’s is value is not null, then:
-    if (HTML::is_valid_custom_element_name(local_name()) || m_is_value.has_value()) {
+    if (HTML::is_valid_custom_element_name(local_name()) || is_value().has_value()) {
         // 1. Let definition be the result of looking up a custom element definition given element’s node document, its namespace, its local name, and its is value.
-        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value());
 
         // 2. If definition is not null and definition’s disable shadow is true, then throw a "NotSupportedError" DOMException.
         if (definition && definition->disable_shadow())
@@ -1296,16 +1321,17 @@ GC::Ref<CSS::CSSStyleProperties> Element::style_for_bindings()
 
 GC::Ref<CSS::StylePropertyMap> Element::attribute_style_map()
 {
-    if (!m_attribute_style_map)
-        m_attribute_style_map = CSS::StylePropertyMap::create(realm(), style_for_bindings());
-    return *m_attribute_style_map;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.attribute_style_map)
+        rare_data.attribute_style_map = CSS::StylePropertyMap::create(realm(), style_for_bindings());
+    return *rare_data.attribute_style_map;
 }
 
 void Element::set_inline_style(GC::Ptr<CSS::CSSStyleProperties> style)
 {
     m_inline_style = style;
-    if (m_attribute_style_map)
-        m_attribute_style_map = nullptr;
+    if (m_rare_data)
+        m_rare_data->attribute_style_map = nullptr;
     set_needs_style_update(true);
 }
 
@@ -1394,8 +1420,13 @@ Vector<CSSPixelRect> Element::get_client_rects() const
     if (!navigable)
         return {};
 
+    // OPTIMIZATION: A disconnected element never has a layout box, so don't force a layout just to find that out.
+    if (!is_connected())
+        return {};
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout(UpdateLayoutReason::ElementGetClientRects);
+    if (!const_cast<Document&>(document()).update_layout_for_element(*this, UpdateLayoutReason::ElementGetClientRects))
+        return {};
 
     // 1. If the element on which it was invoked does not have an associated layout box return an empty DOMRectList
     //    object and stop this algorithm.
@@ -1438,8 +1469,13 @@ Vector<CSSPixelRect> Element::get_client_rects() const
 
 int Element::client_top() const
 {
+    // OPTIMIZATION: See get_client_rects().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout(UpdateLayoutReason::ElementClientTop);
+    if (!const_cast<Document&>(document()).update_layout_for_element(*this, UpdateLayoutReason::ElementClientTop))
+        return 0;
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1454,8 +1490,13 @@ int Element::client_top() const
 // https://drafts.csswg.org/cssom-view/#dom-element-clientleft
 int Element::client_left() const
 {
+    // OPTIMIZATION: See get_client_rects().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout(UpdateLayoutReason::ElementClientLeft);
+    if (!const_cast<Document&>(document()).update_layout_for_element(*this, UpdateLayoutReason::ElementClientLeft))
+        return 0;
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1480,8 +1521,13 @@ int Element::client_width() const
         return document().viewport_rect().width().to_int();
     }
 
+    // OPTIMIZATION: See get_client_rects().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout(UpdateLayoutReason::ElementClientWidth);
+    if (!const_cast<Document&>(document()).update_layout_for_element(*this, UpdateLayoutReason::ElementClientWidth))
+        return 0;
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1505,8 +1551,13 @@ int Element::client_height() const
         return document().viewport_rect().height().to_int();
     }
 
+    // OPTIMIZATION: See get_client_rects().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout(UpdateLayoutReason::ElementClientHeight);
+    if (!const_cast<Document&>(document()).update_layout_for_element(*this, UpdateLayoutReason::ElementClientHeight))
+        return 0;
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -3085,7 +3136,7 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
 void Element::try_to_upgrade()
 {
     // 1. Let definition be the result of looking up a custom element definition given element's node document, element's namespace, element's local name, and element's is value.
-    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value());
 
     // 2. If definition is not null, then enqueue a custom element upgrade reaction given element and definition.
     if (definition)
@@ -3127,7 +3178,7 @@ void Element::setup_custom_element_from_constructor(HTML::CustomElementDefinitio
     m_custom_element_definition = custom_element_definition;
 
     // 7.8. Set element's is value to is value.
-    m_is_value = is_value;
+    set_is_value(is_value);
 }
 
 void Element::set_prefix(Optional<FlyString> value)
@@ -3309,6 +3360,15 @@ OrderedHashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(
     return ensure_pseudo_element(pseudo_element.value()).custom_properties();
 }
 
+bool Element::style_uses_any_custom_property_in(HashTable<FlyString> const& names) const
+{
+    for (auto const& name : m_custom_properties_used_by_style) {
+        if (names.contains(name))
+            return true;
+    }
+    return false;
+}
+
 // https://drafts.csswg.org/cssom-view/#dom-element-scroll
 GC::Ref<WebIDL::Promise> Element::scroll(double x, double y)
 {
@@ -3442,7 +3502,8 @@ GC::Ref<WebIDL::Promise> Element::scroll_by(HTML::ScrollToOptions options)
 bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 {
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    document().update_layout(UpdateLayoutReason::ElementCheckVisibility);
+    if (!document().update_layout_for_element(*this, UpdateLayoutReason::ElementCheckVisibility))
+        return false;
 
     // 1. If this does not have an associated box, return false.
     if (!paintable_box())
@@ -3476,11 +3537,9 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree
     //    skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
+    if (options->content_visibility_auto) {
         for (auto* element = flat_tree_parent_element(); element; element = element->flat_tree_parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
                 return false;
         }
     }
@@ -3497,13 +3556,34 @@ void Element::determine_proximity_to_the_viewport()
     // - The element is close to the viewport: In this state, the element is considered "on-screen": its paint
     //   containment box's overflow clip edge intersects with the viewport, or a user-agent defined margin around the
     //   viewport.
+    // NB: The element's absolute rect doesn't account for transforms or for the scroll offsets of its scroll containers,
+    //     so we map it into the viewport the same way getClientRects() does. The rendering update has already brought
+    //     the transforms and scroll offsets up to date.
+    auto const& paintable_box = *this->paintable_box();
+    auto rect = paintable_box.absolute_border_box_rect();
     auto viewport_rect = document().viewport_rect();
+    if (auto const& accumulated_visual_context = paintable_box.accumulated_visual_context()) {
+        rect = accumulated_visual_context->transform_rect_to_viewport(rect, document().paintable()->scroll_state_snapshot());
+        viewport_rect.set_location({});
+    }
+
     // NOTE: This margin is meant to allow the user agent to begin preparing for an element to be in the
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
-    // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+
+    auto previous_proximity_to_the_viewport = m_proximity_to_the_viewport;
+    ScopeGuard invalidate_display_list_if_proximity_changed = [&] {
+        // NOTE: We don't paint the contents of elements that skip their contents, so the display list has to be
+        //       re-recorded whenever one of them comes close to the viewport or moves far away from it.
+        if (m_proximity_to_the_viewport != previous_proximity_to_the_viewport)
+            document().set_needs_display();
+    };
+
+    // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the border box for now.
+    if (rect.intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -3634,7 +3714,8 @@ void Element::maybe_invalidate_ordinals_for_list_owner(Optional<Element*> skip_n
             if (skip_node.has_value() && item == skip_node.value())
                 return IterationDecision::Continue;
 
-            item->m_ordinal_value = {};
+            if (item->m_rare_data)
+                item->m_rare_data->ordinal_value = {};
 
             // Invalidate just the first ordinal in the list of numbered items.
             // NOTE: This works since this item is the first accessed (preorder) when rendering the list.
@@ -3646,8 +3727,8 @@ void Element::maybe_invalidate_ordinals_for_list_owner(Optional<Element*> skip_n
 // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
 i32 Element::ordinal_value()
 {
-    if (m_ordinal_value.has_value())
-        return m_ordinal_value.value();
+    if (m_rare_data && m_rare_data->ordinal_value.has_value())
+        return m_rare_data->ordinal_value.value();
 
     auto owner = list_owner();
     if (!owner)
@@ -3680,7 +3761,7 @@ i32 Element::ordinal_value()
         }
 
         // 6. The ordinal value of item is numbering.
-        item->m_ordinal_value = numbering.value();
+        item->ensure_rare_data().ordinal_value = numbering.value();
 
         // 7. If owner is an ol element, and owner has a reversed attribute, decrement numbering by 1; otherwise, increment numbering by 1.
         if (reversed) {
@@ -3694,7 +3775,7 @@ i32 Element::ordinal_value()
         return IterationDecision::Continue;
     });
 
-    return m_ordinal_value.value_or(1);
+    return m_rare_data ? m_rare_data->ordinal_value.value_or(1) : 1;
 }
 
 bool Element::id_reference_exists(String const& id_reference) const
@@ -4088,16 +4169,17 @@ void Element::attribute_changed(FlyString const& local_name, Optional<String> co
             return TraversalDecision::Continue;
         });
     } else if (local_name == HTML::AttributeNames::part) {
-        m_parts.clear();
+        if (m_rare_data)
+            m_rare_data->parts.clear();
         if (!value_or_empty.is_empty()) {
             auto new_parts = value_or_empty.bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace);
-            m_parts.clear();
-            m_parts.ensure_capacity(new_parts.size());
+            auto& parts = ensure_rare_data().parts;
+            parts.ensure_capacity(new_parts.size());
             for (auto& new_part : new_parts)
-                m_parts.unchecked_append(MUST(FlyString::from_utf8(new_part)));
+                parts.unchecked_append(MUST(FlyString::from_utf8(new_part)));
         }
-        if (m_part_list)
-            m_part_list->associated_attribute_changed(value_or_empty);
+        if (m_rare_data && m_rare_data->part_list)
+            m_rare_data->part_list->associated_attribute_changed(value_or_empty);
     }
 
     // https://html.spec.whatwg.org/multipage/common-dom-interfaces.html#reflecting-content-attributes-in-idl-attributes:concept-element-attributes-change-ext
@@ -4132,9 +4214,10 @@ auto Element::ensure_custom_element_reaction_queue() -> CustomElementReactionQue
 
 HTML::CustomStateSet& Element::ensure_custom_state_set()
 {
-    if (!m_custom_state_set)
-        m_custom_state_set = HTML::CustomStateSet::create(realm(), *this);
-    return *m_custom_state_set;
+    auto& rare_data = ensure_rare_data();
+    if (!rare_data.custom_state_set)
+        rare_data.custom_state_set = HTML::CustomStateSet::create(realm(), *this);
+    return *rare_data.custom_state_set;
 }
 
 CSS::StyleSheetList& Element::document_or_shadow_root_style_sheets()
@@ -4484,12 +4567,13 @@ GC::Ref<CSS::StylePropertyMapReadOnly> Element::computed_style_map()
     //
     // NOTE: In practice, since the values are "hidden" behind a .get() method call, UAs can delay computing anything
     //    until a given property is actually requested.
-    if (m_computed_style_map_cache == nullptr) {
-        m_computed_style_map_cache = CSS::StylePropertyMapReadOnly::create_computed_style(realm(), AbstractElement { *this });
+    auto& rare_data = ensure_rare_data();
+    if (rare_data.computed_style_map_cache == nullptr) {
+        rare_data.computed_style_map_cache = CSS::StylePropertyMapReadOnly::create_computed_style(realm(), AbstractElement { *this });
     }
 
     // 2. Return this’s [[computedStyleMapCache]] internal slot.
-    return *m_computed_style_map_cache;
+    return *rare_data.computed_style_map_cache;
 }
 
 double Element::ensure_css_random_base_value(CSS::RandomCachingKey const& random_caching_key)
@@ -4499,7 +4583,7 @@ double Element::ensure_css_random_base_value(CSS::RandomCachingKey const& random
     if (!random_caching_key.element_id.has_value())
         return document().ensure_element_shared_css_random_base_value(random_caching_key);
 
-    return m_element_specific_css_random_base_value_cache.ensure(random_caching_key, []() {
+    return ensure_rare_data().element_specific_css_random_base_value_cache.ensure(random_caching_key, []() {
         static XorShift128PlusRNG random_number_generator;
         return random_number_generator.get();
     });
@@ -197,7 +197,7 @@ public:
 
     GC::Ref<DOMTokenList> class_list();
     GC::Ref<DOMTokenList> part_list();
-    ReadonlySpan<FlyString> part_names() const { return m_parts; }
+    ReadonlySpan<FlyString> part_names() const { return m_rare_data ? m_rare_data->parts.span() : ReadonlySpan<FlyString> {}; }
 
     WebIDL::ExceptionOr<GC::Ref<ShadowRoot>> attach_shadow(ShadowRootInit init);
     WebIDL::ExceptionOr<void> attach_a_shadow_root(Bindings::ShadowRootMode mode, bool clonable, bool serializable, bool delegates_focus, Bindings::SlotAssignmentMode slot_assignment);
@@ -227,7 +227,7 @@ public:
 
     void run_attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_);
 
-    CSS::RequiredInvalidationAfterStyleChange recompute_style(bool& did_change_custom_properties);
+    CSS::RequiredInvalidationAfterStyleChange recompute_style(HashTable<FlyString>& changed_custom_properties);
     CSS::RequiredInvalidationAfterStyleChange recompute_inherited_style();
 
     Optional<CSS::PseudoElement> use_pseudo_element() const { return m_use_pseudo_element; }
@@ -290,6 +290,11 @@ public:
     void set_style_uses_attr_css_function() { m_style_uses_attr_css_function = true; }
     bool style_uses_var_css_function() const { return m_style_uses_var_css_function; }
     void set_style_uses_var_css_function() { m_style_uses_var_css_function = true; }
+
+    // The custom properties that var() functions in this element's style refer to, so that a change to one of them
+    // only restyles the elements that actually use it.
+    void add_custom_property_used_by_style(FlyString const& name) { m_custom_properties_used_by_style.set(name); }
+    bool style_uses_any_custom_property_in(HashTable<FlyString> const&) const;
     bool style_uses_tree_counting_function() const { return m_style_uses_tree_counting_function; }
     void set_style_uses_tree_counting_function()
     {
@@ -388,7 +393,7 @@ public:
     CustomElementReactionQueue const* custom_element_reaction_queue() const { return m_custom_element_reaction_queue; }
     CustomElementReactionQueue& ensure_custom_element_reaction_queue();
 
-    GC::Ptr<HTML::CustomStateSet const> custom_state_set() const { return m_custom_state_set; }
+    GC::Ptr<HTML::CustomStateSet const> custom_state_set() const { return m_rare_data ? m_rare_data->custom_state_set : nullptr; }
     HTML::CustomStateSet& ensure_custom_state_set();
 
     JS::ThrowCompletionOr<void> upgrade_element(GC::Ref<HTML::CustomElementDefinition> custom_element_definition);
@@ -397,8 +402,8 @@ public:
     bool is_defined() const;
     bool is_custom() const;
 
-    Optional<String> const& is_value() const { return m_is_value; }
-    void set_is_value(Optional<String> const& is) { m_is_value = is; }
+    Optional<String> const& is_value() const;
+    void set_is_value(Optional<String> const& is);
 
     void set_custom_element_state(CustomElementState);
     void setup_custom_element_from_constructor(HTML::CustomElementDefinition& custom_element_definition, Optional<String> const& is_value);
@@ -598,14 +603,13 @@ private:
 
     GC::Ptr<NamedNodeMap> m_attributes;
     GC::Ptr<CSS::CSSStyleProperties> m_inline_style;
-    GC::Ptr<CSS::StylePropertyMap> m_attribute_style_map;
     GC::Ptr<DOMTokenList> m_class_list;
     GC::Ptr<ShadowRoot> m_shadow_root;
-    GC::Ptr<DOMTokenList> m_part_list;
 
     GC::Ptr<CSS::CascadedProperties> m_cascaded_properties;
     GC::Ptr<CSS::ComputedProperties> m_computed_properties;
     OrderedHashMap<FlyString, CSS::StyleProperty> m_custom_properties;
+    HashTable<FlyString> m_custom_properties_used_by_style;
 
     using PseudoElementData = HashMap<CSS::PseudoElement, GC::Ref<PseudoElement>>;
     mutable OwnPtr<PseudoElementData> m_pseudo_element_data;
@@ -614,7 +618,6 @@ private:
     Optional<CSS::PseudoElement> m_use_pseudo_element;
 
     Vector<FlyString> m_classes;
-    Vector<FlyString> m_parts;
     Optional<Dir> m_dir;
 
     Optional<FlyString> m_id;
@@ -628,21 +631,10 @@ private:
     // https://dom.spec.whatwg.org/#concept-element-custom-element-definition
     GC::Ptr<HTML::CustomElementDefinition> m_custom_element_definition;
 
-    // https://dom.spec.whatwg.org/#concept-element-is-value
-    Optional<String> m_is_value;
-
-    // https://html.spec.whatwg.org/multipage/custom-elements.html#states-set
-    GC::Ptr<HTML::CustomStateSet> m_custom_state_set;
-
     // https://www.w3.org/TR/intersection-observer/#dom-element-registeredintersectionobservers-slot
     // Element objects have an internal [[RegisteredIntersectionObservers]] slot, which is initialized to an empty list.
     OwnPtr<Vector<IntersectionObserver::IntersectionObserverRegistration>> m_registered_intersection_observers;
 
-    // https://drafts.css-houdini.org/css-typed-om-1/#dom-element-computedstylemapcache-slot
-    // Every Element has a [[computedStyleMapCache]] internal slot, initially set to null, which caches the result of
-    // the computedStyleMap() method when it is first called.
-    GC::Ptr<CSS::StylePropertyMapReadOnly> m_computed_style_map_cache;
-
     CSSPixelPoint m_scroll_offset;
 
     bool m_in_top_layer : 1 { false };
@@ -663,9 +655,6 @@ private:
 
     OwnPtr<CSS::CountersSet> m_counters_set;
 
-    // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
-    Optional<i32> m_ordinal_value;
-
     mutable Optional<String> m_lang_value;
 
     // https://w3c.github.io/webappsec-csp/#is-element-nonceable
@@ -686,8 +675,32 @@ private:
 
     bool m_is_contained_in_list_subtree { false };
 
-    // https://drafts.csswg.org/css-values-5/#random-caching
-    HashMap<CSS::RandomCachingKey, double> m_element_specific_css_random_base_value_cache;
+    // OPTIMIZATION: Most elements never use any of these, so they are allocated on first use instead of taking up space
+    //               in every element.
+    struct RareData {
+        GC::Ptr<CSS::StylePropertyMap> attribute_style_map;
+        GC::Ptr<DOMTokenList> part_list;
+        Vector<FlyString> parts;
+
+        // https://dom.spec.whatwg.org/#concept-element-is-value
+        Optional<String> is_value;
+
+        // https://html.spec.whatwg.org/multipage/custom-elements.html#states-set
+        GC::Ptr<HTML::CustomStateSet> custom_state_set;
+
+        // https://drafts.css-houdini.org/css-typed-om-1/#dom-element-computedstylemapcache-slot
+        // Every Element has a [[computedStyleMapCache]] internal slot, initially set to null, which caches the result of
+        // the computedStyleMap() method when it is first called.
+        GC::Ptr<CSS::StylePropertyMapReadOnly> computed_style_map_cache;
+
+        // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
+        Optional<i32> ordinal_value;
+
+        // https://drafts.csswg.org/css-values-5/#random-caching
+        HashMap<CSS::RandomCachingKey, double> element_specific_css_random_base_value_cache;
+    };
+    RareData& ensure_rare_data();
+    OwnPtr<RareData> m_rare_data;
 };
 
 template<>
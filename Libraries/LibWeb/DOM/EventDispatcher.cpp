@@ -31,6 +31,22 @@
 
 namespace Web::DOM {
 
+// NB: The type a trusted event is dispatched with again if it has no listeners, per step 9 of "invoke".
+static Optional<FlyString> legacy_event_type(Event const& event)
+{
+    if (!event.is_trusted())
+        return {};
+    if (event.type() == HTML::EventNames::animationend)
+        return HTML::EventNames::webkitAnimationEnd;
+    if (event.type() == HTML::EventNames::animationiteration)
+        return HTML::EventNames::webkitAnimationIteration;
+    if (event.type() == HTML::EventNames::animationstart)
+        return HTML::EventNames::webkitAnimationStart;
+    if (event.type() == HTML::EventNames::transitionend)
+        return HTML::EventNames::webkitTransitionEnd;
+    return {};
+}
+
 // https://dom.spec.whatwg.org/#concept-event-listener-inner-invoke
 bool EventDispatcher::inner_invoke(Event& event, Vector<GC::Root<DOM::DOMEventListener>>& listeners, Event::Phase phase, bool invocation_target_in_shadow_tree, bool& legacy_output_did_listeners_throw)
 {
@@ -149,7 +165,12 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
     // 6. Let listeners be a clone of event’s currentTarget attribute value’s event listener list.
     // NOTE: This avoids event listeners added after this point from being run. Note that removal still has an effect due to the removed field.
-    auto listeners = event.current_target()->event_listener_list();
+    // OPTIMIZATION: Inner invoke skips listeners of any other type, so we only clone the ones that can actually run.
+    //               Most targets along the path of frequent events like pointermove have no such listener, in which
+    //               case there is nothing left to do.
+    auto listeners = event.current_target()->event_listener_list(event.type(), legacy_event_type(event));
+    if (listeners.is_empty())
+        return;
 
     // 7. Let invocationTargetInShadowTree be struct’s invocation-target-in-shadow-tree.
     bool invocation_target_in_shadow_tree = struct_.invocation_target_in_shadow_tree;
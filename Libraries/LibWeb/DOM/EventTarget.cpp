@@ -92,6 +92,18 @@ Vector<GC::Root<DOMEventListener>> EventTarget::event_listener_list()
     return list;
 }
 
+Vector<GC::Root<DOMEventListener>> EventTarget::event_listener_list(FlyString const& type, Optional<FlyString> const& legacy_type)
+{
+    Vector<GC::Root<DOMEventListener>> list;
+    if (!m_data)
+        return list;
+    for (auto& listener : m_data->event_listener_list) {
+        if (listener->type == type || (legacy_type.has_value() && listener->type == *legacy_type))
+            list.append(*listener);
+    }
+    return list;
+}
+
 // https://dom.spec.whatwg.org/#concept-flatten-options
 static bool flatten_event_listener_options(Variant<EventListenerOptions, bool> const& options)
 {
@@ -45,6 +45,9 @@ public:
     void remove_an_event_listener(DOMEventListener&);
 
     Vector<GC::Root<DOMEventListener>> event_listener_list();
+    // Like event_listener_list(), but only includes the listeners for the given event type and, if given, its legacy
+    // type.
+    Vector<GC::Root<DOMEventListener>> event_listener_list(FlyString const& type, Optional<FlyString> const& legacy_type);
 
     virtual bool has_activation_behavior() const;
     virtual void activation_behavior(Event const&);
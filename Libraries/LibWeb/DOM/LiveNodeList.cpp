@@ -7,6 +7,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/Error.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/LiveNodeList.h>
 #include <LibWeb/DOM/Node.h>
 
@@ -35,23 +36,29 @@ void LiveNodeList::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_root);
 }
 
-GC::RootVector<Node*> LiveNodeList::collection() const
+void LiveNodeList::update_cache_if_needed() const
 {
-    GC::RootVector<Node*> nodes(heap());
+    // Nothing to do, the DOM hasn't updated since we last built the cache.
+    auto dom_tree_version = m_root->document().dom_tree_version();
+    if (m_cached_dom_tree_version == dom_tree_version)
+        return;
+
+    m_cached_nodes.clear_with_capacity();
     if (m_scope == Scope::Descendants) {
         m_root->for_each_in_subtree([&](auto& node) {
             if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
+                m_cached_nodes.append(const_cast<Node&>(node));
             return TraversalDecision::Continue;
         });
     } else {
         m_root->for_each_child([&](auto& node) {
             if (m_filter(node))
-                nodes.append(const_cast<Node*>(&node));
+                m_cached_nodes.append(const_cast<Node&>(node));
             return IterationDecision::Continue;
         });
     }
-    return nodes;
+
+    m_cached_dom_tree_version = dom_tree_version;
 }
 
 Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) const
@@ -80,17 +87,18 @@ Node* LiveNodeList::first_matching(Function<bool(Node const&)> const& filter) co
 // https://dom.spec.whatwg.org/#dom-nodelist-length
 u32 LiveNodeList::length() const
 {
-    return collection().size();
+    update_cache_if_needed();
+    return m_cached_nodes.size();
 }
 
 // https://dom.spec.whatwg.org/#dom-nodelist-item
 Node const* LiveNodeList::item(u32 index) const
 {
     // The item(index) method must return the indexth node in the collection. If there is no indexth node in the collection, then the method must return null.
-    auto nodes = collection();
-    if (index >= nodes.size())
+    update_cache_if_needed();
+    if (index >= m_cached_nodes.size())
         return nullptr;
-    return nodes[index];
+    return m_cached_nodes[index];
 }
 
 }
@@ -8,12 +8,11 @@
 #pragma once
 
 #include <AK/Function.h>
+#include <LibGC/Weak.h>
 #include <LibWeb/DOM/NodeList.h>
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
-
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
     GC_DECLARE_ALLOCATOR(LiveNodeList);
@@ -38,7 +37,10 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    GC::RootVector<Node*> collection() const;
+    void update_cache_if_needed() const;
+
+    mutable Optional<u64> m_cached_dom_tree_version;
+    mutable Vector<GC::Weak<Node>> m_cached_nodes;
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
@@ -10,22 +10,23 @@
 #include <LibWeb/DOM/MutationRecord.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/DOM/NodeList.h>
+#include <LibWeb/DOM/StaticNodeList.h>
 
 namespace Web::DOM {
 
 GC_DEFINE_ALLOCATOR(MutationRecord);
 
-GC::Ref<MutationRecord> MutationRecord::create(JS::Realm& realm, FlyString const& type, Node const& target, NodeList& added_nodes, NodeList& removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value)
+GC::Ref<MutationRecord> MutationRecord::create(JS::Realm& realm, FlyString const& type, Node const& target, Vector<GC::Ref<Node>> added_nodes, Vector<GC::Ref<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value)
 {
-    return realm.create<MutationRecord>(realm, type, target, added_nodes, removed_nodes, previous_sibling, next_sibling, attribute_name, attribute_namespace, old_value);
+    return realm.create<MutationRecord>(realm, type, target, move(added_nodes), move(removed_nodes), previous_sibling, next_sibling, attribute_name, attribute_namespace, old_value);
 }
 
-MutationRecord::MutationRecord(JS::Realm& realm, FlyString const& type, Node const& target, NodeList& added_nodes, NodeList& removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value)
+MutationRecord::MutationRecord(JS::Realm& realm, FlyString const& type, Node const& target, Vector<GC::Ref<Node>> added_nodes, Vector<GC::Ref<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value)
     : PlatformObject(realm)
     , m_type(type)
     , m_target(GC::make_root(target))
-    , m_added_nodes(added_nodes)
-    , m_removed_nodes(removed_nodes)
+    , m_added_node_entries(move(added_nodes))
+    , m_removed_node_entries(move(removed_nodes))
     , m_previous_sibling(GC::make_root(previous_sibling))
     , m_next_sibling(GC::make_root(next_sibling))
     , m_attribute_name(attribute_name)
@@ -46,10 +47,37 @@ void MutationRecord::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_target);
+    visitor.visit(m_added_node_entries);
+    visitor.visit(m_removed_node_entries);
     visitor.visit(m_added_nodes);
     visitor.visit(m_removed_nodes);
     visitor.visit(m_previous_sibling);
     visitor.visit(m_next_sibling);
 }
 
+static GC::Ref<NodeList> create_node_list(JS::Realm& realm, Vector<GC::Ref<Node>> const& nodes)
+{
+    Vector<GC::Root<Node>> roots;
+    roots.ensure_capacity(nodes.size());
+    for (auto node : nodes)
+        roots.unchecked_append(node);
+    return StaticNodeList::create(realm, move(roots));
+}
+
+// https://dom.spec.whatwg.org/#dom-mutationrecord-addednodes
+NodeList const* MutationRecord::added_nodes() const
+{
+    if (!m_added_nodes)
+        m_added_nodes = create_node_list(realm(), m_added_node_entries);
+    return m_added_nodes;
+}
+
+// https://dom.spec.whatwg.org/#dom-mutationrecord-removednodes
+NodeList const* MutationRecord::removed_nodes() const
+{
+    if (!m_removed_nodes)
+        m_removed_nodes = create_node_list(realm(), m_removed_node_entries);
+    return m_removed_nodes;
+}
+
 }
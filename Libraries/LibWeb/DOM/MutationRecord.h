@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/Vector.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 
 namespace Web::DOM {
@@ -17,14 +18,14 @@ class MutationRecord : public Bindings::PlatformObject {
     GC_DECLARE_ALLOCATOR(MutationRecord);
 
 public:
-    [[nodiscard]] static GC::Ref<MutationRecord> create(JS::Realm&, FlyString const& type, Node const& target, NodeList& added_nodes, NodeList& removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value);
+    [[nodiscard]] static GC::Ref<MutationRecord> create(JS::Realm&, FlyString const& type, Node const& target, Vector<GC::Ref<Node>> added_nodes, Vector<GC::Ref<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value);
 
     virtual ~MutationRecord() override;
 
     FlyString const& type() const { return m_type; }
     Node const* target() const { return m_target; }
-    NodeList const* added_nodes() const { return m_added_nodes; }
-    NodeList const* removed_nodes() const { return m_removed_nodes; }
+    NodeList const* added_nodes() const;
+    NodeList const* removed_nodes() const;
     Node const* previous_sibling() const { return m_previous_sibling; }
     Node const* next_sibling() const { return m_next_sibling; }
     Optional<String> const& attribute_name() const { return m_attribute_name; }
@@ -32,15 +33,22 @@ public:
     Optional<String> const& old_value() const { return m_old_value; }
 
 private:
-    MutationRecord(JS::Realm& realm, FlyString const& type, Node const& target, NodeList& added_nodes, NodeList& removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value);
+    MutationRecord(JS::Realm& realm, FlyString const& type, Node const& target, Vector<GC::Ref<Node>> added_nodes, Vector<GC::Ref<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling, Optional<String> const& attribute_name, Optional<String> const& attribute_namespace, Optional<String> const& old_value);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
     FlyString m_type;
     GC::Ptr<Node const> m_target;
-    GC::Ptr<NodeList> m_added_nodes;
-    GC::Ptr<NodeList> m_removed_nodes;
+
+    // OPTIMIZATION: Most records are taken and dropped without script ever looking at their added or removed nodes (and
+    //               attribute and character data records never have any), so the NodeLists are only created on first
+    //               access. Until then, the nodes are kept in these plain vectors.
+    Vector<GC::Ref<Node>> m_added_node_entries;
+    Vector<GC::Ref<Node>> m_removed_node_entries;
+    mutable GC::Ptr<NodeList> m_added_nodes;
+    mutable GC::Ptr<NodeList> m_removed_nodes;
+
     GC::Ptr<Node> m_previous_sibling;
     GC::Ptr<Node> m_next_sibling;
     Optional<String> m_attribute_name;
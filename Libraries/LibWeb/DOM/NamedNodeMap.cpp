@@ -257,6 +257,10 @@ void NamedNodeMap::replace_attribute(Attr& old_attribute, Attr& new_attribute, s
 
     // 6. Handle attribute changes for oldAttribute with element, oldAttribute’s value, and newAttribute’s value.
     old_attribute.handle_attribute_changes(*new_attribute.owner_element(), old_attribute.value(), new_attribute.value());
+
+    // AD-HOC: The attribute change steps only bump the DOM tree version if the value changed, but the attribute node
+    //         itself was replaced either way, and caches such as XPath's mirror of the tree point at attribute nodes.
+    element->document().bump_dom_tree_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-element-attributes-append
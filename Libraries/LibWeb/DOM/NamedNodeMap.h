@@ -68,7 +68,9 @@ private:
     void remove_attribute_at_index(size_t attribute_index);
 
     GC::Ref<DOM::Element> m_element;
-    Vector<GC::Ref<Attr>> m_attributes;
+
+    // OPTIMIZATION: Most elements only have a couple of attributes, which we can then store without a separate allocation.
+    Vector<GC::Ref<Attr>, 2> m_attributes;
 };
 
 }
@@ -2716,14 +2716,19 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     if (attribute_namespace.has_value())
         string_attribute_namespace = attribute_namespace->to_string();
 
-    auto added_nodes_list = StaticNodeList::create(realm(), move(added_nodes));
-    auto removed_nodes_list = StaticNodeList::create(realm(), move(removed_nodes));
+    auto to_node_entries = [](Vector<GC::Root<Node>> const& nodes) {
+        Vector<GC::Ref<Node>> entries;
+        entries.ensure_capacity(nodes.size());
+        for (auto const& node : nodes)
+            entries.unchecked_append(*node);
+        return entries;
+    };
 
     // 4. For each observer → mappedOldValue of interestedObservers:
     for (auto& [observer, mapped_old_value] : interested_observers) {
         // 1. Let record be a new MutationRecord object with its type set to type, target set to target, attributeName set to name, attributeNamespace set to namespace, oldValue set to mappedOldValue,
         //    addedNodes set to addedNodes, removedNodes set to removedNodes, previousSibling set to previousSibling, and nextSibling set to nextSibling.
-        auto record = MutationRecord::create(realm(), type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, mapped_old_value);
+        auto record = MutationRecord::create(realm(), type, *this, to_node_entries(added_nodes), to_node_entries(removed_nodes), previous_sibling, next_sibling, string_attribute_name, string_attribute_namespace, mapped_old_value);
 
         // 2. Enqueue record to observer’s record queue.
         observer->enqueue_record({}, move(record));
@@ -2736,8 +2741,11 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     Bindings::queue_mutation_observer_microtask();
 
     // AD-HOC: Notify the UI if it is interested in DOM mutations (i.e. for DevTools).
-    if (page.listen_for_dom_mutations())
+    if (page.listen_for_dom_mutations()) {
+        auto added_nodes_list = StaticNodeList::create(realm(), move(added_nodes));
+        auto removed_nodes_list = StaticNodeList::create(realm(), move(removed_nodes));
         page.client().page_did_mutate_dom(type, *this, added_nodes_list, removed_nodes_list, previous_sibling, next_sibling, string_attribute_name);
+    }
 }
 
 // https://dom.spec.whatwg.org/#queue-a-tree-mutation-record
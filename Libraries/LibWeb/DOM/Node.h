@@ -85,6 +85,7 @@ enum class ShouldComputeRole {
     X(NodeRemove)                                   \
     X(NodeSetTextContent)                           \
     X(Other)                                        \
+    X(ReactivateDocument)                           \
     X(SetSelectorText)                              \
     X(SettingsChange)                               \
     X(StyleSheetDeleteRule)                         \
@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -43,6 +44,32 @@ static bool contains_named_namespace(CSS::SelectorList const& selectors)
     return false;
 }
 
+static Optional<FlyString> lone_id_selector(CSS::SelectorList const& selectors)
+{
+    if (selectors.size() != 1)
+        return {};
+    auto const& compound_selectors = selectors.first()->compound_selectors();
+    if (compound_selectors.size() != 1 || compound_selectors.first().simple_selectors.size() != 1)
+        return {};
+    auto const& simple_selector = compound_selectors.first().simple_selectors.first();
+    if (simple_selector.type != CSS::Selector::SimpleSelector::Type::Id)
+        return {};
+    return simple_selector.name();
+}
+
+// NB: Only connected documents and shadow roots keep their elements indexed by ID.
+static ElementByIdMap* element_by_id_map_for_tree_of(ParentNode& node)
+{
+    if (!node.is_connected())
+        return nullptr;
+    auto& root = node.root();
+    if (root.is_document())
+        return &static_cast<Document&>(root).element_by_id();
+    if (root.is_shadow_root())
+        return &static_cast<ShadowRoot&>(root).element_by_id();
+    return nullptr;
+}
+
 enum class ReturnMatches {
     First,
     All,
@@ -52,21 +79,49 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto selector_string = MUST(String::from_utf8(selector_text));
+    auto maybe_selectors = node.document().cached_selector_list_for_query(selector_string);
+    if (!maybe_selectors.has_value()) {
+        maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
 
-    // 2. If s is failure, then throw a "SyntaxError" DOMException.
-    if (!maybe_selectors.has_value())
-        return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
+        // 2. If s is failure, then throw a "SyntaxError" DOMException.
+        if (!maybe_selectors.has_value())
+            return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
 
-    auto selectors = maybe_selectors.value();
+        // "Note: Support for namespaces within selectors is not planned and will not be added."
+        if (contains_named_namespace(*maybe_selectors))
+            return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
+
+        node.document().cache_selector_list_for_query(move(selector_string), *maybe_selectors);
+    }
 
-    // "Note: Support for namespaces within selectors is not planned and will not be added."
-    if (contains_named_namespace(selectors))
-        return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
+    auto selectors = maybe_selectors.release_value();
 
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
+
+    // OPTIMIZATION: A lone ID selector can only match the elements that are already indexed by their ID, for the trees
+    //               that have such an index.
+    if (auto* element_by_id = element_by_id_map_for_tree_of(node); element_by_id) {
+        if (auto id = lone_id_selector(selectors); id.has_value()) {
+            element_by_id->for_each_element_with_id(*id, [&](GC::Ref<Element> element) {
+                if (!element->is_descendant_of(node))
+                    return;
+                if (return_matches == ReturnMatches::First) {
+                    if (!single_result)
+                        single_result = element;
+                    return;
+                }
+                results.append(element);
+            });
+
+            if (return_matches == ReturnMatches::First)
+                return { single_result };
+            return { StaticNodeList::create(node.realm(), move(results)) };
+        }
+    }
+
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     node.for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
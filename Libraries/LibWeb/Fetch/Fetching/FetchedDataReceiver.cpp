@@ -9,6 +9,7 @@
 #include <LibHTTP/Cache/MemoryCache.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Fetch/Fetching/FetchedDataReceiver.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
@@ -22,6 +23,14 @@ namespace Web::Fetch::Fetching {
 
 GC_DEFINE_ALLOCATOR(FetchedDataReceiver);
 
+// NB: Once this many bytes wait for the stream to pull them, we stop reading the response from RequestServer, which in
+//     turn stops receiving it from the network once the pipe between us fills up.
+static constexpr size_t suspend_fetch_unpulled_byte_count = 4 * MiB;
+
+// NB: Bodies larger than this are not stored in the HTTP cache, so that we don't have to keep all of their bytes around
+//     after the stream has pulled them.
+static constexpr size_t max_http_cache_body_size = 16 * MiB;
+
 FetchedDataReceiver::FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const> fetch_params, GC::Ref<Streams::ReadableStream> stream, RefPtr<HTTP::MemoryCache> http_cache)
     : m_fetch_params(fetch_params)
     , m_stream(stream)
@@ -81,6 +90,16 @@ void FetchedDataReceiver::handle_network_bytes(ReadonlyBytes bytes, NetworkState
         // Capture bytes for MIME sniffing
         if (m_body)
             m_body->append_sniff_bytes(bytes);
+
+        if (m_http_cache && m_buffer.size() > max_http_cache_body_size)
+            stop_storing_response_in_http_cache();
+
+        // NB: This is step 8 of the steps below. We have to run it even while the stream isn't pulling, which is when
+        //     the buffer fills up.
+        if (!m_fetch_is_suspended && unpulled_byte_count() > suspend_fetch_unpulled_byte_count) {
+            m_fetch_is_suspended = true;
+            m_fetch_params->controller()->suspend_request();
+        }
     }
 
     if (!m_pending_promise) {
@@ -102,8 +121,9 @@ void FetchedDataReceiver::handle_network_bytes(ReadonlyBytes bytes, NetworkState
         // 7. Append bytes to buffer.
         pull_bytes_into_stream();
 
-        // FIXME: 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent
-        //           to suspend the ongoing fetch.
+        // 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent to
+        //    suspend the ongoing fetch.
+        // NB: This is done above, when the bytes are appended to the buffer.
         return;
     }
     // 2. Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable,
@@ -120,15 +140,18 @@ void FetchedDataReceiver::pull_bytes_into_stream()
 {
     VERIFY(m_lifecycle_state == LifecycleState::Receiving || m_lifecycle_state == LifecycleState::CompletePending);
 
-    // FIXME: 1. If the size of buffer is smaller than a lower limit chosen by the user agent and the ongoing fetch
-    //           is suspended, resume the fetch.
-
     // 2. Wait until buffer is not empty.
-    // NB: It would be nice to avoid a copy here, but ReadableStream::pull_from_bytes currently requires an allocated
-    //     ByteBuffer to create a JS::ArrayBuffer.
-    auto bytes = copy_unpulled_bytes();
+    auto bytes = take_unpulled_bytes();
     VERIFY(!bytes.is_empty());
 
+    // 1. If the size of buffer is smaller than a lower limit chosen by the user agent and the ongoing fetch is
+    //    suspended, resume the fetch.
+    // NB: We do this once the bytes have been taken out of the buffer, which always leaves no unpulled bytes behind.
+    if (m_fetch_is_suspended) {
+        m_fetch_is_suspended = false;
+        m_fetch_params->controller()->resume_request();
+    }
+
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     VERIFY(!m_has_unfulfilled_promise);
     m_has_unfulfilled_promise = true;
@@ -186,12 +209,27 @@ void FetchedDataReceiver::close_stream()
     }
 }
 
-ByteBuffer FetchedDataReceiver::copy_unpulled_bytes()
+ByteBuffer FetchedDataReceiver::take_unpulled_bytes()
 {
+    // OPTIMIZATION: Unless the HTTP cache needs the whole body once the response is complete, there is no need to keep
+    //               the bytes the stream has pulled, and we can hand over the buffer without copying it.
+    if (!m_http_cache) {
+        VERIFY(m_pulled_bytes == 0);
+        return exchange(m_buffer, {});
+    }
+
     auto bytes = MUST(m_buffer.slice(m_pulled_bytes, m_buffer.size() - m_pulled_bytes));
     m_pulled_bytes += bytes.size();
 
     return bytes;
 }
 
+void FetchedDataReceiver::stop_storing_response_in_http_cache()
+{
+    m_http_cache.clear();
+
+    m_buffer = MUST(m_buffer.slice(m_pulled_bytes, m_buffer.size() - m_pulled_bytes));
+    m_pulled_bytes = 0;
+}
+
 }
@@ -43,7 +43,10 @@ private:
     void close_stream();
 
     bool buffer_is_eof() const { return m_pulled_bytes == m_buffer.size(); }
-    ByteBuffer copy_unpulled_bytes();
+    size_t unpulled_byte_count() const { return m_buffer.size() - m_pulled_bytes; }
+    ByteBuffer take_unpulled_bytes();
+
+    void stop_storing_response_in_http_cache();
 
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ptr<Fetch::Infrastructure::Response const> m_response;
@@ -65,6 +68,7 @@ private:
     };
     LifecycleState m_lifecycle_state { LifecycleState::Receiving };
     bool m_has_unfulfilled_promise { false };
+    bool m_fetch_is_suspended { false };
 };
 
 }
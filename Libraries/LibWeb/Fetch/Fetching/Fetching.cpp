@@ -104,6 +104,21 @@ public:
         m_cache.clear();
     }
 
+    HTTPMemoryCacheStatistics statistics() const
+    {
+        HTTPMemoryCacheStatistics statistics;
+        statistics.partition_count = m_cache.size();
+
+        for (auto const& it : m_cache) {
+            auto partition_statistics = it.value->statistics();
+            statistics.entry_count += partition_statistics.entry_count;
+            statistics.pending_entry_count += partition_statistics.pending_entry_count;
+            statistics.body_size += partition_statistics.body_size;
+        }
+
+        return statistics;
+    }
+
 private:
     HashMap<Infrastructure::NetworkPartitionKey, NonnullRefPtr<HTTP::MemoryCache>> m_cache;
 };
@@ -678,9 +693,9 @@ GC::Ptr<PendingResponse> main_fetch(JS::Realm& realm, Infrastructure::FetchParam
                 }
 
                 // 3. Let processBody given bytes be these steps:
-                auto process_body = GC::create_function(vm.heap(), [&realm, request, response, &fetch_params, process_body_error](ByteBuffer bytes) {
+                auto process_body_with_match_result = GC::create_function(vm.heap(), [&realm, response, &fetch_params, process_body_error](ByteBuffer bytes, ErrorOr<bool> matches) {
                     // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
-                    if (!TRY_OR_IGNORE(SRI::do_bytes_match_metadata_list(bytes, request->integrity_metadata()))) {
+                    if (!TRY_OR_IGNORE(move(matches))) {
                         process_body_error->function()({});
                         return;
                     }
@@ -692,6 +707,15 @@ GC::Ptr<PendingResponse> main_fetch(JS::Realm& realm, Infrastructure::FetchParam
                     fetch_response_handover(realm, fetch_params, *response);
                 });
 
+                auto process_body = GC::create_function(vm.heap(), [request, process_body_with_match_result](ByteBuffer bytes) {
+                    // OPTIMIZATION: Hashing a large body takes a while, so the bytes are matched against the integrity
+                    //               metadata on a background thread instead of blocking the event loop.
+                    SRI::do_bytes_match_metadata_list_in_background(move(bytes), request->integrity_metadata(),
+                        [process_body_with_match_result = GC::make_root(process_body_with_match_result)](ByteBuffer bytes, ErrorOr<bool> matches) {
+                            process_body_with_match_result->function()(move(bytes), move(matches));
+                        });
+                });
+
                 // 4. Fully read response’s body given processBody and processBodyError.
                 response->body()->fully_read(realm, process_body, process_body_error, fetch_params.task_destination());
             }
@@ -1657,8 +1681,10 @@ GC::Ref<PendingResponse> http_network_or_cache_fetch(JS::Realm& realm, Infrastru
         // 13. Append the Fetch metadata headers for httpRequest.
         append_fetch_metadata_headers_for_request(*http_request);
 
-        // 14. FIXME: If httpRequest’s initiator is "prefetch", then set a structured field value
+        // 14. If httpRequest’s initiator is "prefetch", then set a structured field value
         //     given (`Sec-Purpose`, the token prefetch) in httpRequest’s header list.
+        if (http_request->initiator() == Infrastructure::Request::Initiator::Prefetch)
+            http_request->header_list()->set(HTTP::Header::isomorphic_encode("Sec-Purpose"sv, "prefetch"sv));
 
         // 15. If httpRequest’s header list does not contain `User-Agent`, then user agents should append
         //     (`User-Agent`, default `User-Agent` value) to httpRequest’s header list.
@@ -2027,6 +2053,63 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 }
 #endif
 
+// Maps a request onto the priority RequestServer uses to schedule it against the document's other requests. This is also
+// where we honor the request's priority hint (i.e. the fetchpriority attribute), by nudging it one level up or down.
+static RequestServer::RequestPriority network_priority_for_request(Infrastructure::Request const& request)
+{
+    using enum RequestServer::RequestPriority;
+
+    if (request.initiator() == Infrastructure::Request::Initiator::Prefetch || request.initiator() == Infrastructure::Request::Initiator::Prerender)
+        return Lowest;
+
+    auto priority = [&] {
+        if (request.render_blocking())
+            return Highest;
+        if (!request.destination().has_value())
+            return High;
+
+        switch (*request.destination()) {
+        case Infrastructure::Request::Destination::Document:
+        case Infrastructure::Request::Destination::Frame:
+        case Infrastructure::Request::Destination::IFrame:
+        case Infrastructure::Request::Destination::Style:
+            return Highest;
+        case Infrastructure::Request::Destination::Font:
+        case Infrastructure::Request::Destination::Script:
+        case Infrastructure::Request::Destination::Worker:
+        case Infrastructure::Request::Destination::SharedWorker:
+        case Infrastructure::Request::Destination::ServiceWorker:
+        case Infrastructure::Request::Destination::JSON:
+        case Infrastructure::Request::Destination::XSLT:
+            return High;
+        case Infrastructure::Request::Destination::Audio:
+        case Infrastructure::Request::Destination::Image:
+        case Infrastructure::Request::Destination::Track:
+        case Infrastructure::Request::Destination::Video:
+            return Low;
+        case Infrastructure::Request::Destination::Report:
+            return Lowest;
+        default:
+            return Medium;
+        }
+    }();
+
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        if (priority != Highest)
+            priority = static_cast<RequestServer::RequestPriority>(to_underlying(priority) + 1);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        if (priority != Lowest)
+            priority = static_cast<RequestServer::RequestPriority>(to_underlying(priority) - 1);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    return priority;
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
@@ -2053,6 +2136,7 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
     load_request.set_page(page);
     load_request.set_method(request->method());
     load_request.set_cache_mode(request->cache_mode());
+    load_request.set_priority(network_priority_for_request(*request));
     load_request.set_store_set_cookie_headers(include_credentials == IncludeCredentials::Yes);
     load_request.set_initiator_type(request->initiator_type());
 
@@ -2080,6 +2164,10 @@ GC::Ref<PendingResponse> nonstandard_resource_loader_file_or_http_network_fetch(
     // 10. Let stream be a new ReadableStream.
     auto stream = realm.create<Streams::ReadableStream>(realm);
 
+    // NB: The receiver holds on to the entire body for the HTTP cache, so we only hand it a cache that will store it.
+    if (!g_http_memory_cache_enabled || request->cache_mode() == HTTP::CacheMode::NoStore)
+        http_cache = nullptr;
+
     // 9. Let buffer be an empty byte sequence.
     auto fetched_data_receiver = realm.create<FetchedDataReceiver>(fetch_params, stream, move(http_cache));
 
@@ -2480,4 +2568,9 @@ void clear_http_memory_cache()
     HTTPCache::the().clear_cache();
 }
 
+HTTPMemoryCacheStatistics http_memory_cache_statistics()
+{
+    return HTTPCache::the().statistics();
+}
+
 }
@@ -61,4 +61,12 @@ WEB_API void set_http_memory_cache_enabled(bool enabled);
 WEB_API bool http_memory_cache_enabled();
 WEB_API void clear_http_memory_cache();
 
+struct HTTPMemoryCacheStatistics {
+    size_t partition_count { 0 };
+    size_t entry_count { 0 };
+    size_t pending_entry_count { 0 };
+    size_t body_size { 0 };
+};
+WEB_API HTTPMemoryCacheStatistics http_memory_cache_statistics();
+
 }
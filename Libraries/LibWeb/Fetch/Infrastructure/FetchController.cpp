@@ -37,6 +37,9 @@ void FetchController::visit_edges(JS::Cell::Visitor& visitor)
 void FetchController::set_pending_request(RefPtr<Requests::Request> request)
 {
     m_pending_request = move(request);
+
+    if (m_pending_request && m_frozen)
+        m_pending_request->suspend_reading();
 }
 
 void FetchController::set_report_timing_steps(Function<void(JS::Object&)> report_timing_steps)
@@ -167,6 +170,34 @@ void FetchController::stop_request()
     }
 }
 
+void FetchController::suspend_request()
+{
+    m_request_suspended = true;
+    if (m_pending_request)
+        m_pending_request->suspend_reading();
+}
+
+void FetchController::resume_request()
+{
+    m_request_suspended = false;
+    if (m_pending_request && !m_frozen)
+        m_pending_request->resume_reading();
+}
+
+void FetchController::freeze()
+{
+    m_frozen = true;
+    if (m_pending_request)
+        m_pending_request->suspend_reading();
+}
+
+void FetchController::unfreeze()
+{
+    m_frozen = false;
+    if (m_pending_request && !m_request_suspended)
+        m_pending_request->resume_reading();
+}
+
 void FetchController::fetch_task_queued(u64 fetch_task_id, HTML::TaskID event_id)
 {
     m_ongoing_fetch_tasks.set(fetch_task_id, event_id);
@@ -58,6 +58,14 @@ public:
     void stop_fetch();
     void stop_request();
 
+    void suspend_request();
+    void resume_request();
+
+    // Keeps the request suspended while its client's document is in the back/forward cache, regardless of whether
+    // the fetch itself asks for it to be resumed.
+    void freeze();
+    void unfreeze();
+
     u64 next_fetch_task_id() { return m_next_fetch_task_id++; }
     void fetch_task_queued(u64 fetch_task_id, HTML::TaskID event_id);
     void fetch_task_complete(u64 fetch_task_id);
@@ -95,6 +103,8 @@ private:
     GC::Ptr<FetchParams> m_fetch_params;
 
     RefPtr<Requests::Request> m_pending_request;
+    bool m_request_suspended { false };
+    bool m_frozen { false };
 
     HashMap<u64, HTML::TaskID> m_ongoing_fetch_tasks;
     u64 m_next_fetch_task_id { 0 };
@@ -39,6 +39,7 @@ AK_TYPEDEF_DISTINCT_NUMERIC_GENERAL(i64, UniqueNodeID, Comparison, Increment, Ca
 
 namespace Web::Painting {
 
+class AccumulatedVisualContext;
 class BackingStore;
 class DevicePixelConverter;
 class DisplayList;
@@ -706,6 +707,7 @@ class HTMLParamElement;
 class HTMLParser;
 class HTMLPictureElement;
 class HTMLPreElement;
+class HTMLPreloadScanner;
 class HTMLProgressElement;
 class HTMLQuoteElement;
 class HTMLScriptElement;
@@ -1062,6 +1064,8 @@ struct SerialPortInfo;
 
 namespace Web::ServiceWorker {
 
+class Cache;
+class CacheStorage;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
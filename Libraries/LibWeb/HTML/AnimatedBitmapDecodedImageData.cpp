@@ -4,11 +4,15 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibGC/Heap.h>
+#include <LibGC/Weak.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/Window.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 #include <LibWeb/Painting/DisplayListRecordingContext.h>
 
@@ -21,6 +25,26 @@ ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData:
     return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
 }
 
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create_streamed(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, NonnullRefPtr<Platform::StreamedAnimation> streamed_animation, Gfx::ColorSpace color_space)
+{
+    VERIFY(!frames.is_empty() && frames.first().bitmap);
+
+    auto image_data = realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, true);
+    streamed_animation->on_frames_decoded = [weak_image_data = GC::Weak { *image_data }](size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps) {
+        if (weak_image_data)
+            weak_image_data->did_decode_streamed_frames(first_frame_index, move(bitmaps));
+    };
+    streamed_animation->on_error = [weak_image_data = GC::Weak { *image_data }](Error) {
+        if (weak_image_data)
+            weak_image_data->did_fail_to_decode_streamed_frames();
+    };
+    image_data->m_streamed_animation = move(streamed_animation);
+    if (auto const* window = as_if<Window>(realm.global_object()))
+        image_data->m_document = window->associated_document();
+    image_data->m_color_space = move(color_space);
+    return image_data;
+}
+
 AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
     : m_frames(move(frames))
     , m_loop_count(loop_count)
@@ -34,9 +58,139 @@ RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame
 {
     if (frame_index >= m_frames.size())
         return nullptr;
+    if (m_streamed_animation)
+        return streamed_frame_bitmap(frame_index);
     return m_frames[frame_index].bitmap;
 }
 
+// How many frames of a streamed animation we keep decoded for each playhead, counting from the one being shown.
+static constexpr size_t streamed_frame_window_size = 8;
+// How many frames of a streamed animation we ask for at once.
+static constexpr size_t streamed_frame_batch_size = 4;
+// How many consumers of a streamed animation get their own window of frames. Beyond this, the least recently used
+// playhead is forgotten, which also bounds the memory kept alive by consumers that have stopped playing.
+static constexpr size_t max_streamed_playhead_count = 4;
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::streamed_frame_bitmap(size_t frame_index) const
+{
+    auto& playhead = streamed_playhead_for_frame(frame_index);
+
+    drop_streamed_frames_outside_of_playhead_windows();
+    request_streamed_frames_if_needed();
+
+    if (auto const& bitmap = m_frames[frame_index].bitmap) {
+        playhead.last_shown_frame_index = frame_index;
+        return bitmap;
+    }
+
+    // NB: The frame hasn't arrived yet, so we keep showing the last one we had.
+    if (auto const& bitmap = m_frames[playhead.last_shown_frame_index].bitmap)
+        return bitmap;
+    return m_frames.first().bitmap;
+}
+
+static size_t distance_between_frames(size_t from_frame_index, size_t to_frame_index, size_t frame_count)
+{
+    return (to_frame_index + frame_count - from_frame_index) % frame_count;
+}
+
+AnimatedBitmapDecodedImageData::StreamedPlayhead& AnimatedBitmapDecodedImageData::streamed_playhead_for_frame(size_t frame_index) const
+{
+    // A consumer asks for the frame it showed last, or one shortly after it. So the playhead closest behind the
+    // requested frame is the one that belongs to the same consumer.
+    Optional<size_t> closest_playhead_index;
+    size_t closest_distance = streamed_frame_window_size;
+    for (size_t i = 0; i < m_streamed_playheads.size(); ++i) {
+        auto distance = distance_between_frames(m_streamed_playheads[i].current_frame_index, frame_index, m_frames.size());
+        if (distance < closest_distance) {
+            closest_playhead_index = i;
+            closest_distance = distance;
+        }
+    }
+
+    StreamedPlayhead playhead { frame_index, frame_index };
+    if (closest_playhead_index.has_value()) {
+        playhead = m_streamed_playheads.take(*closest_playhead_index);
+        playhead.current_frame_index = frame_index;
+    } else if (m_streamed_playheads.size() == max_streamed_playhead_count) {
+        m_streamed_playheads.take_first();
+    }
+
+    m_streamed_playheads.append(playhead);
+    return m_streamed_playheads.last();
+}
+
+void AnimatedBitmapDecodedImageData::drop_streamed_frames_outside_of_playhead_windows() const
+{
+    // Drop every frame that has fallen out of all windows, except for the first one (which backs our intrinsic size) and
+    // the ones we last showed (which we may have to keep showing until the next ones arrive).
+    auto should_keep_frame = [&](size_t index) {
+        for (auto const& playhead : m_streamed_playheads) {
+            if (index == playhead.last_shown_frame_index)
+                return true;
+            if (distance_between_frames(playhead.current_frame_index, index, m_frames.size()) < streamed_frame_window_size)
+                return true;
+        }
+        return false;
+    };
+    for (size_t i = 1; i < m_frames.size(); ++i) {
+        if (!should_keep_frame(i))
+            m_frames[i].bitmap = nullptr;
+    }
+}
+
+void AnimatedBitmapDecodedImageData::request_streamed_frames_if_needed() const
+{
+    if (m_has_pending_frame_request || m_streaming_failed)
+        return;
+
+    // NB: The most recently used playhead is served first.
+    for (auto const& playhead : m_streamed_playheads.in_reverse()) {
+        for (size_t offset = 0; offset < streamed_frame_window_size; ++offset) {
+            auto index = (playhead.current_frame_index + offset) % m_frames.size();
+            if (m_frames[index].bitmap)
+                continue;
+            m_has_pending_frame_request = true;
+            m_streamed_animation->request_frames(index, streamed_frame_batch_size);
+            return;
+        }
+    }
+}
+
+void AnimatedBitmapDecodedImageData::did_decode_streamed_frames(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps)
+{
+    m_has_pending_frame_request = false;
+
+    for (size_t i = 0; i < bitmaps.size(); ++i) {
+        auto index = first_frame_index + i;
+        if (index >= m_frames.size())
+            break;
+        // NB: A frame that failed to decode shows the first frame instead, so we don't keep asking for it.
+        if (bitmaps[i])
+            m_frames[index].bitmap = Gfx::ImmutableBitmap::create(*bitmaps[i], m_color_space);
+        else
+            m_frames[index].bitmap = m_frames.first().bitmap;
+    }
+
+    // NB: A consumer whose animation has stopped on a frame that only arrived now won't paint again by itself.
+    auto is_waiting_for_decoded_frame = any_of(m_streamed_playheads, [&](auto const& playhead) {
+        return playhead.current_frame_index != playhead.last_shown_frame_index
+            && distance_between_frames(first_frame_index, playhead.current_frame_index, m_frames.size()) < bitmaps.size();
+    });
+    if (is_waiting_for_decoded_frame && m_document)
+        m_document->set_needs_display();
+
+    drop_streamed_frames_outside_of_playhead_windows();
+    request_streamed_frames_if_needed();
+}
+
+void AnimatedBitmapDecodedImageData::did_fail_to_decode_streamed_frames()
+{
+    // NB: Asking again won't help, as the decoder is gone. We keep showing whichever frames we still have.
+    m_has_pending_frame_request = false;
+    m_streaming_failed = true;
+}
+
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 {
     if (frame_index >= m_frames.size())
@@ -61,12 +215,15 @@ Optional<CSSPixelFraction> AnimatedBitmapDecodedImageData::intrinsic_aspect_rati
 
 Optional<Gfx::IntRect> AnimatedBitmapDecodedImageData::frame_rect(size_t frame_index) const
 {
-    return m_frames[frame_index].bitmap->rect();
+    if (auto bitmap = this->bitmap(frame_index))
+        return bitmap->rect();
+    return {};
 }
 
 void AnimatedBitmapDecodedImageData::paint(DisplayListRecordingContext& context, size_t frame_index, Gfx::IntRect dst_rect, Gfx::IntRect clip_rect, Gfx::ScalingMode scaling_mode) const
 {
-    context.display_list_recorder().draw_scaled_immutable_bitmap(dst_rect, clip_rect, *m_frames[frame_index].bitmap, scaling_mode);
+    if (auto bitmap = this->bitmap(frame_index))
+        context.display_list_recorder().draw_scaled_immutable_bitmap(dst_rect, clip_rect, *bitmap, scaling_mode);
 }
 
 }
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <LibGC/Weak.h>
+#include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -22,6 +25,10 @@ public:
     };
 
     static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+
+    // Only the frames that have a bitmap are decoded up front. The rest are requested from the streamed animation as
+    // they are about to be shown, and only a few of them are kept around at a time.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create_streamed(JS::Realm&, Vector<Frame>&&, size_t loop_count, NonnullRefPtr<Platform::StreamedAnimation>, Gfx::ColorSpace);
     virtual ~AnimatedBitmapDecodedImageData() override;
 
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
@@ -41,9 +48,31 @@ public:
 private:
     AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
 
-    Vector<Frame> m_frames;
+    struct StreamedPlayhead {
+        size_t current_frame_index { 0 };
+        size_t last_shown_frame_index { 0 };
+    };
+
+    RefPtr<Gfx::ImmutableBitmap> streamed_frame_bitmap(size_t frame_index) const;
+    StreamedPlayhead& streamed_playhead_for_frame(size_t frame_index) const;
+    void drop_streamed_frames_outside_of_playhead_windows() const;
+    void request_streamed_frames_if_needed() const;
+    void did_decode_streamed_frames(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>>);
+    void did_fail_to_decode_streamed_frames();
+
+    // NB: For streamed animations, the frames' bitmaps are filled in and dropped while the animation plays.
+    mutable Vector<Frame> m_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    RefPtr<Platform::StreamedAnimation> m_streamed_animation;
+    GC::Weak<DOM::Document> m_document;
+    Gfx::ColorSpace m_color_space;
+    // NB: Every <img> element and CSS image sharing this data steps through the frames on its own timer, so each of them
+    //     gets its own window of frames. The most recently used playhead comes last.
+    mutable Vector<StreamedPlayhead, 4> m_streamed_playheads;
+    mutable bool m_has_pending_frame_request { false };
+    bool m_streaming_failed { false };
 };
 
 }
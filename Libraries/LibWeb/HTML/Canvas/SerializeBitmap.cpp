@@ -8,6 +8,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/JPEGWriter.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/HTML/Canvas/SerializeBitmap.h>
 
 namespace Web::HTML {
@@ -34,4 +35,25 @@ ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, Strin
     return SerializeBitmapResult { TRY(Gfx::PNGWriter::encode(bitmap)), "image/png"sv };
 }
 
+void serialize_bitmap_in_parallel(RefPtr<Gfx::Bitmap> bitmap, StringView type, Optional<double> quality, SerializeBitmapCallback on_complete)
+{
+    using Result = Optional<SerializeBitmapResult>;
+    (void)Threading::BackgroundAction<Result>::construct(
+        [bitmap = move(bitmap), type = ByteString { type }, quality](auto&) -> ErrorOr<Result> {
+            if (!bitmap)
+                return Result {};
+
+            auto result = serialize_bitmap(*bitmap, type, quality);
+            if (result.is_error()) {
+                dbgln("Failed to serialize bitmap as {}: {}", type, result.error());
+                return Result {};
+            }
+            return Result { result.release_value() };
+        },
+        [on_complete = move(on_complete)](Result result) -> ErrorOr<void> {
+            on_complete(move(result));
+            return {};
+        });
+}
+
 }
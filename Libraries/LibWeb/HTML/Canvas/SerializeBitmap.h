@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/ByteBuffer.h>
+#include <AK/Function.h>
 #include <LibGfx/Forward.h>
 #include <LibWeb/DOM/Document.h>
 
@@ -20,4 +21,9 @@ struct SerializeBitmapResult {
 // https://html.spec.whatwg.org/multipage/canvas.html#a-serialisation-of-the-bitmap-as-a-file
 ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, StringView type, Optional<double> quality);
 
+// Serializes the bitmap on a background thread, then calls on_complete on the current thread's event loop. The result is
+// null if there is no bitmap or if serializing it failed.
+using SerializeBitmapCallback = Function<void(Optional<SerializeBitmapResult>)>;
+void serialize_bitmap_in_parallel(RefPtr<Gfx::Bitmap>, StringView type, Optional<double> quality, SerializeBitmapCallback on_complete);
+
 }
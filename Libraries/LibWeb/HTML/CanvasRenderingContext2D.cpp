@@ -212,6 +212,15 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
     // FIXME: Make use of the rect to reduce the invalidated area when possible.
     if (!canvas_element().paintable())
         return;
+
+    // OPTIMIZATION: Scripts often issue thousands of draws per frame, and every one of them used to walk the canvas'
+    //               containing block and schedule a rendering update. Once a repaint is pending, it will pick up
+    //               everything drawn into the canvas until then anyway.
+    if (auto navigable = canvas_element().document().navigable()) {
+        if (auto traversable = navigable->traversable_navigable(); traversable && traversable->needs_repaint())
+            return;
+    }
+
     canvas_element().paintable()->set_needs_display(InvalidateDisplayList::No);
 }
 
@@ -523,9 +532,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -536,20 +545,19 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // OPTIMIZATION: We read just the source rectangle straight into imageData's bitmap, converting the pixels to its
+    //               format and alpha type on the way, instead of snapshotting the whole output bitmap and then painting
+    //               part of that snapshot.
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
-    // NOTE: No-op, already done during creation.
+    // NOTE: No-op, already done during creation, and read_into_bitmap() leaves those pixels untouched.
 
     // 8. Return imageData.
     return image_data;
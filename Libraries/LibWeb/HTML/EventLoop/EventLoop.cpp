@@ -224,6 +224,10 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // OPTIMIZATION: Use a slice of the idle period to sweep heap blocks left over by the last garbage collection,
+        //               so that allocations in the next task don't have to.
+        heap().sweep_lazily(AK::Duration::from_milliseconds(2));
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
@@ -449,6 +453,10 @@ void EventLoop::update_the_rendering()
             // 3. For each element element with 'auto' used value of 'content-visibility':
             auto* document_element = document->document_element();
             if (document_element) {
+                // NB: Determining the proximity to the viewport needs up-to-date transforms and scroll offsets.
+                if (!document->paintable()->paintable_boxes_with_auto_content_visibility().is_empty())
+                    document->update_paint_and_hit_testing_properties_if_needed();
+
                 for (auto& paintable_box : document->paintable()->paintable_boxes_with_auto_content_visibility()) {
                     auto& element = as<DOM::Element>(*paintable_box->dom_node());
 
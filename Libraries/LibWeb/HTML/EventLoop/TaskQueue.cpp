@@ -42,18 +42,48 @@ void TaskQueue::add(GC::Ref<Task> task)
     m_event_loop->schedule();
 }
 
+// NB: The event loop is free to choose which task queue to take a task from, and this is how we prefer tasks that the
+//     user is waiting on. Since the priority only depends on the task source, tasks from the same source still run in
+//     the order they were queued.
+static bool is_prioritized_task_source(Task::Source source)
+{
+    // NB: Input events are dispatched while updating the rendering, so the rendering task source covers them as well.
+    return source == Task::Source::UserInteraction || source == Task::Source::Rendering;
+}
+
+// NB: Without a limit, a page that keeps the rendering and user interaction task sources busy would never get to run
+//     its timers or process its network responses.
+static constexpr size_t max_consecutive_prioritized_tasks = 16;
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
+    Optional<size_t> first_runnable_index;
     for (size_t i = 0; i < m_tasks.size(); ++i) {
         if (m_event_loop->running_rendering_task() && m_tasks[i]->source() == Task::Source::Rendering)
             continue;
-        if (m_tasks[i]->is_runnable())
+        if (!m_tasks[i]->is_runnable())
+            continue;
+
+        if (!first_runnable_index.has_value()) {
+            first_runnable_index = i;
+            if (m_consecutive_prioritized_tasks >= max_consecutive_prioritized_tasks)
+                break;
+        }
+
+        if (is_prioritized_task_source(m_tasks[i]->source())) {
+            ++m_consecutive_prioritized_tasks;
             return m_tasks.take(i);
+        }
     }
-    return nullptr;
+
+    if (!first_runnable_index.has_value())
+        return nullptr;
+
+    m_consecutive_prioritized_tasks = 0;
+    return m_tasks.take(*first_runnable_index);
 }
 
 bool TaskQueue::has_runnable_tasks() const
@@ -47,6 +47,8 @@ private:
     GC::Ref<HTML::EventLoop> m_event_loop;
 
     Vector<GC::Ref<HTML::Task>> m_tasks;
+
+    size_t m_consecutive_prioritized_tasks { 0 };
 };
 
 }
@@ -46,12 +46,36 @@ void HTMLAnchorElement::attribute_changed(FlyString const& name, Optional<String
 
     if (name == HTML::AttributeNames::href) {
         set_the_url();
+        if (is_connected())
+            prefetch_dns_for_href();
     } else if (name == HTML::AttributeNames::rel) {
         if (m_rel_list)
             m_rel_list->associated_attribute_changed(value.value_or(String {}));
     }
 }
 
+void HTMLAnchorElement::inserted()
+{
+    Base::inserted();
+
+    // NB: inserted() also runs for anchors that were inserted into a disconnected subtree, which nobody can see yet.
+    if (is_connected())
+        prefetch_dns_for_href();
+}
+
+void HTMLAnchorElement::prefetch_dns_for_href()
+{
+    if (!document().browsing_context())
+        return;
+
+    auto href = get_attribute(HTML::AttributeNames::href);
+    if (!href.has_value())
+        return;
+
+    if (auto url = document().encoding_parse_url(*href); url.has_value())
+        document().prefetch_dns_for_hyperlink(*url);
+}
+
 bool HTMLAnchorElement::has_activation_behavior() const
 {
     return true;
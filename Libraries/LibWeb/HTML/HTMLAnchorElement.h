@@ -49,6 +49,9 @@ private:
     virtual bool has_activation_behavior() const override;
     virtual void activation_behavior(Web::DOM::Event const&) override;
 
+    // ^DOM::Node
+    virtual void inserted() override;
+
     // ^DOM::Element
     virtual void attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_) override;
     virtual i32 default_tab_index_value() const override;
@@ -59,6 +62,8 @@ private:
 
     virtual Optional<ARIA::Role> default_role() const override;
 
+    void prefetch_dns_for_href();
+
     GC::Ptr<DOM::DOMTokenList> m_rel_list;
 };
 
@@ -90,6 +90,7 @@ void HTMLBaseElement::set_the_frozen_base_url()
         || ContentSecurityPolicy::is_base_allowed_for_document(realm(), url_record.value(), document) == ContentSecurityPolicy::Directives::Directive::Result::Blocked) {
         // then set element's frozen base URL to document's fallback base URL and return.
         m_frozen_base_url = document.fallback_base_url();
+        document.invalidate_encoding_parsed_url_cache();
         return;
     }
 
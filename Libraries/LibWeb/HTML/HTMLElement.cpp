@@ -514,7 +514,8 @@ GC::Ptr<DOM::Element> HTMLElement::scroll_parent() const
 GC::Ptr<DOM::Element> HTMLElement::offset_parent() const
 {
     // NOTE: We have to ensure that the layout is up-to-date before querying the layout tree.
-    const_cast<DOM::Document&>(document()).update_layout(DOM::UpdateLayoutReason::HTMLElementOffsetParent);
+    if (!const_cast<DOM::Document&>(document()).update_layout_for_element(*this, DOM::UpdateLayoutReason::HTMLElementOffsetParent))
+        return nullptr;
 
     // 1. If any of the following holds true return null and terminate this algorithm:
     //    - The element does not have an associated box.
@@ -587,8 +588,13 @@ int HTMLElement::offset_top() const
     if (is<HTML::HTMLBodyElement>(*this))
         return 0;
 
+    // OPTIMIZATION: A disconnected element never has a layout box, so don't force a layout just to find that out.
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout(DOM::UpdateLayoutReason::HTMLElementOffsetTop);
+    if (!const_cast<DOM::Document&>(document()).update_layout_for_element(*this, DOM::UpdateLayoutReason::HTMLElementOffsetTop))
+        return 0;
 
     if (!paintable_box())
         return 0;
@@ -629,8 +635,13 @@ int HTMLElement::offset_left() const
     if (is<HTML::HTMLBodyElement>(*this))
         return 0;
 
+    // OPTIMIZATION: See offset_top().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout(DOM::UpdateLayoutReason::HTMLElementOffsetLeft);
+    if (!const_cast<DOM::Document&>(document()).update_layout_for_element(*this, DOM::UpdateLayoutReason::HTMLElementOffsetLeft))
+        return 0;
 
     if (!paintable_box())
         return 0;
@@ -667,8 +678,13 @@ int HTMLElement::offset_left() const
 // https://drafts.csswg.org/cssom-view/#dom-htmlelement-offsetwidth
 int HTMLElement::offset_width() const
 {
+    // OPTIMIZATION: See offset_top().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout(DOM::UpdateLayoutReason::HTMLElementOffsetWidth);
+    if (!const_cast<DOM::Document&>(document()).update_layout_for_element(*this, DOM::UpdateLayoutReason::HTMLElementOffsetWidth))
+        return 0;
 
     // 1. If the element does not have any associated box return zero and terminate this algorithm.
     auto const* box = paintable_box();
@@ -686,8 +702,13 @@ int HTMLElement::offset_width() const
 // https://drafts.csswg.org/cssom-view/#dom-htmlelement-offsetheight
 int HTMLElement::offset_height() const
 {
+    // OPTIMIZATION: See offset_top().
+    if (!is_connected())
+        return 0;
+
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout(DOM::UpdateLayoutReason::HTMLElementOffsetHeight);
+    if (!const_cast<DOM::Document&>(document()).update_layout_for_element(*this, DOM::UpdateLayoutReason::HTMLElementOffsetHeight))
+        return 0;
 
     // 1. If the element does not have any associated box return zero and terminate this algorithm.
     auto const* box = paintable_box();
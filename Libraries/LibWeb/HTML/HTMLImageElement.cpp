@@ -825,6 +825,25 @@ after_step_7:
 
 void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> image_request, bool maybe_omit_events, String const& url_string, String const& previous_url)
 {
+    // AD-HOC: While the current request is still being fetched, show whatever could be decoded of it so far. The pending
+    //         request keeps the previous image around instead, so it isn't shown until it has been fetched completely.
+    image_request->add_partial_image_data_callback([this, image_request]() {
+        if (image_request != m_current_request || image_request->state() == ImageRequest::State::CompletelyAvailable || image_request->state() == ImageRequest::State::Broken)
+            return;
+        auto image_data = image_request->shared_resource_request()->partial_image_data();
+        if (!image_data)
+            return;
+        image_request->set_image_data(image_data);
+
+        // https://html.spec.whatwg.org/multipage/images.html#img-inc
+        // The user agent has obtained some of the image data.
+        image_request->set_state(ImageRequest::State::PartiallyAvailable);
+
+        set_needs_style_update(true);
+        if (auto layout_node = this->layout_node())
+            layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+    });
+
     image_request->add_callbacks(
         [this, image_request, maybe_omit_events, url_string, previous_url]() {
             batching_dispatcher().enqueue(GC::create_function(realm().heap(), [this, image_request, maybe_omit_events, url_string, previous_url] {
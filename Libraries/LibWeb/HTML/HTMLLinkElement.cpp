@@ -173,6 +173,11 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
                 m_relationship |= Relationship::Preconnect;
             else if (part == "icon"sv)
                 m_relationship |= Relationship::Icon;
+            else if (part == "prefetch"sv)
+                m_relationship |= Relationship::Prefetch;
+            // AD-HOC: rel=prerender is obsolete, but is still widely used. Like other engines, we treat it as a prefetch.
+            else if (part == "prerender"sv)
+                m_relationship |= Relationship::Prefetch;
         }
 
         if (m_rel_list)
@@ -377,10 +382,12 @@ GC::Ptr<Fetch::Infrastructure::Request> HTMLLinkElement::create_link_request(HTM
 // https://html.spec.whatwg.org/multipage/semantics.html#fetch-and-process-the-linked-resource
 void HTMLLinkElement::fetch_and_process_linked_resource()
 {
-    if (m_relationship & ~(Relationship::DNSPrefetch | Relationship::Preconnect | Relationship::Preload))
+    if (m_relationship & ~(Relationship::DNSPrefetch | Relationship::Preconnect | Relationship::Preload | Relationship::Prefetch))
         default_fetch_and_process_linked_resource();
     else if (m_relationship & Relationship::Preload)
         fetch_and_process_linked_preload_resource();
+    else if (m_relationship & Relationship::Prefetch)
+        fetch_and_process_linked_prefetch_resource();
     else if (m_relationship & Relationship::Preconnect)
         fetch_and_process_linked_preconnect_resource();
     else if (m_relationship & Relationship::DNSPrefetch)
@@ -524,6 +531,44 @@ void HTMLLinkElement::fetch_and_process_linked_preload_resource()
     }));
 }
 
+// https://html.spec.whatwg.org/multipage/links.html#link-type-prefetch:fetch-and-process-the-linked-resource-2
+void HTMLLinkElement::fetch_and_process_linked_prefetch_resource()
+{
+    // 1. Let options be the result of creating link options from el.
+    auto options = create_link_options();
+
+    // 2. Set options's destination to the empty string.
+    options->destination = {};
+
+    // 3. Let request be the result of creating a link request given options.
+    auto request = create_link_request(options);
+
+    // 4. If request is null, then return.
+    if (!request)
+        return;
+
+    // 5. Set request's initiator to "prefetch".
+    request->set_initiator(Fetch::Infrastructure::Request::Initiator::Prefetch);
+
+    // 6. Let processPrefetchResponse be the following steps, given a response response and null, failure, or a byte
+    //    sequence bytesOrNull:
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [this](auto response, auto) {
+        // 1. If response is a network error, fire an event named error at el.
+        if (response->is_network_error())
+            dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
+        // 2. Otherwise, fire an event named load at el.
+        else
+            dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load));
+    };
+
+    // 7. Fetch request, with processResponseConsumeBody set to processPrefetchResponse.
+    // NB: The response is stored in the HTTP cache, where a later navigation to it will find it.
+    if (m_fetch_controller)
+        m_fetch_controller->abort(realm(), {});
+    m_fetch_controller = Fetch::Fetching::fetch(realm(), *request, Fetch::Infrastructure::FetchAlgorithms::create(vm(), move(fetch_algorithms_input)));
+}
+
 // https://html.spec.whatwg.org/multipage/semantics.html#linked-resource-fetch-setup-steps
 bool HTMLLinkElement::linked_resource_fetch_setup_steps(Fetch::Infrastructure::Request& request)
 {
@@ -998,9 +1043,10 @@ bool HTMLLinkElement::should_fetch_and_process_resource_type() const
 {
     // https://html.spec.whatwg.org/multipage/links.html#link-type-dns-prefetch:fetch-and-process-the-linked-resource
     // https://html.spec.whatwg.org/multipage/links.html#link-type-preconnect:fetch-and-process-the-linked-resource
+    // https://html.spec.whatwg.org/multipage/links.html#link-type-prefetch:fetch-and-process-the-linked-resource
     // https://html.spec.whatwg.org/multipage/links.html#link-type-preload:fetch-and-process-the-linked-resource
     // https://html.spec.whatwg.org/multipage/links.html#link-type-stylesheet:fetch-and-process-the-linked-resource
-    if (m_relationship & (Relationship::DNSPrefetch | Relationship::Preconnect | Relationship::Preload | Relationship::Stylesheet))
+    if (m_relationship & (Relationship::DNSPrefetch | Relationship::Preconnect | Relationship::Prefetch | Relationship::Preload | Relationship::Stylesheet))
         return true;
 
     // AD-HOC: The spec is underspecified for fetching and processing rel="icon". See:
@@ -189,6 +189,7 @@ private:
     void fetch_and_process_linked_dns_prefetch_resource();
     void fetch_and_process_linked_preconnect_resource();
     void fetch_and_process_linked_preload_resource();
+    void fetch_and_process_linked_prefetch_resource();
 
     bool linked_resource_fetch_setup_steps(Fetch::Infrastructure::Request&);
     bool icon_linked_resource_fetch_setup_steps(Fetch::Infrastructure::Request&);
@@ -211,6 +212,7 @@ private:
             DNSPrefetch = 1 << 3,
             Preconnect = 1 << 4,
             Icon = 1 << 5,
+            Prefetch = 1 << 6,
         };
     };
 
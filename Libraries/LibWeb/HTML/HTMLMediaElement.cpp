@@ -987,6 +987,13 @@ void HTMLMediaElement::fetch_resource(URL::URL const& url_record, Function<void(
             return;
         self->restart_fetch_at_offset(fetch_data, offset);
     });
+    fetch_data->stream->set_read_ahead_limit_callback([self = GC::Weak(*this)] {
+        if (!self)
+            return;
+        // NB: The stream only asks for this once it knows it can request the rest of the data again with a range request.
+        if (self->m_fetch_controller && self->m_fetch_controller->state() == Fetch::Infrastructure::FetchController::State::Ongoing)
+            self->m_fetch_controller->stop_fetch();
+    });
     fetch_data->failure_callback = [&stream = *fetch_data->stream, failure_callback = move(failure_callback)](String error_message) {
         // Ensure that we unblock any reads if we stop the fetch due to some failure.
         stream.reached_end_of_body();
@@ -1100,6 +1107,9 @@ void HTMLMediaElement::fetch_resource(NonnullRefPtr<FetchData> const& fetch_data
             if (auto accept_ranges = response->header_list()->extract_header_list_values("Accept-Ranges"sv); accept_ranges.template has<Vector<ByteString>>())
                 fetch_data->accepts_byte_ranges = accept_ranges.template get<Vector<ByteString>>().contains([](auto const& units) { return units == "bytes"sv; });
 
+            // NB: Data that has been played back can only be discarded if we are able to fetch it again with a range request.
+            fetch_data->stream->set_data_can_be_requested_again(fetch_data->accepts_byte_ranges);
+
             // 4. If the result of verifying response given the current media resource and byteRange is false, then abort these steps.
             // NOTE: We do this step before creating the updateMedia task so that we can invoke the failure callback.
             auto maybe_verify_response_failure = verify_response_or_get_failure_reason(response, byte_range, fetch_data);
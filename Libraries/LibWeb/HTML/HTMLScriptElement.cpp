@@ -7,6 +7,8 @@
 
 #include <AK/Debug.h>
 #include <AK/StringBuilder.h>
+#include <LibJS/Console.h>
+#include <LibJS/Runtime/ConsoleObject.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/HTMLScriptElementPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -20,6 +22,7 @@
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/ImportMapParseResult.h>
+#include <LibWeb/HTML/Scripting/PythonEngine.h>
 #include <LibWeb/HTML/Scripting/PythonPackageManager.h>
 #include <LibWeb/HTML/Scripting/PythonScript.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
@@ -280,7 +283,10 @@ void HTMLScriptElement::prepare_script()
         dbgln("🐍 HTMLScriptElement: Detected Python script type: '{}'", script_block_type);
         m_script_type = ScriptType::Python;
     }
-    // FIXME: 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules", then set el's type to "speculationrules".
+    // 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules", then set el's type to "speculationrules".
+    else if (script_block_type.equals_ignoring_ascii_case("speculationrules"sv)) {
+        m_script_type = ScriptType::SpeculationRules;
+    }
     // 13. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
@@ -415,8 +421,7 @@ void HTMLScriptElement::prepare_script()
     // 33. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
         // 1. If el's type is "importmap" or "speculationrules", then:
-        // FIXME: Add "speculationrules" support.
-        if (m_script_type == ScriptType::ImportMap) {
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -552,6 +557,8 @@ void HTMLScriptElement::prepare_script()
         }
         // -> "python"
         else if (m_script_type == ScriptType::Python) {
+            PythonEngine::ensure_initialized();
+
             // 0. Install packages from requirements.txt BEFORE creating and executing the script
             auto& package_manager = HTML::PythonPackageManager::the();
             auto init_result = package_manager.initialize();
@@ -586,7 +593,26 @@ void HTMLScriptElement::prepare_script()
             // 2. Mark as ready el given script.
             mark_as_ready(Result(move(script)));
         }
-        // FIXME: -> "speculationrules"
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // 1. Let result be the result of parsing a speculation rule set string given source text, el's node
+            //    document, and el's node document's document base URL.
+            auto result = parse_a_speculation_rule_set_string(source_text_utf8, document(), document().base_url());
+
+            // NB: If this throws, the user agent should report a warning to the console.
+            if (result.is_exception()) {
+                auto& console = realm().intrinsics().console_object()->console();
+                console.output_debug_message(JS::Console::LogLevel::Warn, MUST(String::formatted("Ignoring invalid speculation rules: {}", result.exception().get<WebIDL::SimpleException>().message)));
+                return;
+            }
+
+            // 2. Append result to el's node document's speculation rule sets, and consider speculative loads for it.
+            // NB: The rule set is removed again by the script element's removing steps.
+            document().add_speculation_rule_set(*this, result.release_value());
+
+            // 3. Return.
+            return;
+        }
     }
 
     // 35. If el's type is "classic" and el has a src attribute, or el's type is "module", or el's type is "python" and el has a src attribute:
@@ -730,6 +756,22 @@ void HTMLScriptElement::post_connection()
     prepare_script();
 }
 
+// https://html.spec.whatwg.org/multipage/scripting.html#script-processing-model:html-element-removing-steps
+void HTMLScriptElement::removed_from(Node* old_parent, Node& old_root)
+{
+    Base::removed_from(old_parent, old_root);
+
+    // 1. If removedNode's result is a speculation rule set, then:
+    if (m_script_type == ScriptType::SpeculationRules) {
+        // 1. Remove it from removedNode's node document's speculation rule sets.
+        // 2. Set removedNode's result to null.
+        // 3. Consider speculative loads for removedNode's node document.
+        // NB: The rule set isn't kept as the element's result, but in the document, which reconsiders its speculative
+        //     loads when it's removed.
+        document().remove_speculation_rule_set(*this);
+    }
+}
+
 // https://html.spec.whatwg.org/multipage/scripting.html#mark-as-ready
 void HTMLScriptElement::mark_as_ready(Result result)
 {
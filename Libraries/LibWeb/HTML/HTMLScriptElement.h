@@ -48,11 +48,12 @@ public:
 
     virtual void children_changed(ChildrenChangedMetadata const*) override;
     virtual void post_connection() override;
+    virtual void removed_from(Node* old_parent, Node& old_root) override;
 
     // https://html.spec.whatwg.org/multipage/scripting.html#dom-script-supports
     static bool supports(JS::VM&, StringView type)
     {
-        return type.is_one_of("classic"sv, "module"sv, "importmap"sv, "python"sv);
+        return type.is_one_of("classic"sv, "module"sv, "importmap"sv, "speculationrules"sv, "python"sv);
     }
 
     void set_source_line_number(Badge<HTMLParser>, size_t source_line_number) { m_source_line_number = source_line_number; }
@@ -145,6 +146,7 @@ private:
         Module,
         ImportMap,
         Python,
+        SpeculationRules,
     };
 
     // https://html.spec.whatwg.org/multipage/scripting.html#concept-script-type
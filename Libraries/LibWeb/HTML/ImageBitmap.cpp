@@ -5,6 +5,7 @@
  */
 
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ShareableBitmap.h>
 #include <LibWeb/Bindings/ImageBitmapPrototype.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
@@ -98,7 +99,15 @@ WebIDL::ExceptionOr<void> ImageBitmap::transfer_steps(HTML::TransferDataEncoder&
     // FIXME: 1. If value's origin-clean flag is not set, then throw a "DataCloneError" DOMException.
 
     // 2. Set dataHolder.[[BitmapData]] to value's bitmap data.
-    serialize_bitmap(data_holder, m_bitmap);
+    // OPTIMIZATION: Transferring hands over the bitmap data itself, so instead of copying its pixels, we share the
+    //               anonymous buffer backing them. Bitmaps from OffscreenCanvas.transferToImageBitmap() already are.
+    Gfx::ShareableBitmap shareable_bitmap;
+    if (m_bitmap) {
+        shareable_bitmap = m_bitmap->to_shareable_bitmap();
+        if (!shareable_bitmap.is_valid())
+            return WebIDL::DataCloneError::create(realm(), "Unable to share ImageBitmap data"_utf16);
+    }
+    data_holder.encode(shareable_bitmap);
 
     // 3. Unset value's bitmap data.
     m_bitmap = nullptr;
@@ -110,7 +119,8 @@ WebIDL::ExceptionOr<void> ImageBitmap::transfer_steps(HTML::TransferDataEncoder&
 WebIDL::ExceptionOr<void> ImageBitmap::transfer_receiving_steps(HTML::TransferDataDecoder& data_holder)
 {
     // 1. Set value's bitmap data to dataHolder.[[BitmapData]].
-    set_bitmap(TRY(deserialize_bitmap(this->realm(), data_holder)));
+    auto shareable_bitmap = data_holder.decode<Gfx::ShareableBitmap>();
+    set_bitmap(shareable_bitmap.bitmap());
 
     return {};
 }
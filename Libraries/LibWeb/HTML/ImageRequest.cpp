@@ -128,4 +128,10 @@ void ImageRequest::add_callbacks(Function<void()> on_finish, Function<void()> on
     m_shared_resource_request->add_callbacks(move(on_finish), move(on_fail));
 }
 
+void ImageRequest::add_partial_image_data_callback(Function<void()> callback)
+{
+    VERIFY(m_shared_resource_request);
+    m_shared_resource_request->add_partial_image_data_callback(move(callback));
+}
+
 }
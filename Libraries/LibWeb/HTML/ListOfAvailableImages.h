@@ -50,6 +50,7 @@ public:
     void add(Key const&, GC::Ref<DecodedImageData>, bool ignore_higher_layer_caching);
     void remove(Key const&);
     [[nodiscard]] Entry* get(Key const&);
+    [[nodiscard]] size_t size() const { return m_images.size(); }
 
     void visit_edges(JS::Cell::Visitor& visitor) override;
 
@@ -145,6 +145,11 @@ bool Navigable::is_ancestor_of(GC::Ref<Navigable> other) const
 
 static RefPtr<Gfx::SkiaBackendContext> g_cached_skia_backend_context;
 
+// NB: Each tab gets its own WebContent process, so this is effectively a per-tab budget. It covers the textures Skia can
+//     recreate on demand (glyph atlases, scratch layers), not the ones uploaded for ImmutableBitmap, which are kept alive
+//     by the bitmap itself and reused across frames.
+static constexpr size_t skia_resource_cache_limit = 256 * MiB;
+
 static RefPtr<Gfx::SkiaBackendContext> get_skia_backend_context()
 {
     if (!g_cached_skia_backend_context) {
@@ -161,6 +166,8 @@ static RefPtr<Gfx::SkiaBackendContext> get_skia_backend_context()
         auto vulkan_context = maybe_vulkan_context.release_value();
         g_cached_skia_backend_context = Gfx::SkiaBackendContext::create_vulkan_context(vulkan_context);
 #endif
+        if (g_cached_skia_backend_context)
+            g_cached_skia_backend_context->set_resource_cache_limit(skia_resource_cache_limit);
     }
     return g_cached_skia_backend_context;
 }
@@ -2594,7 +2601,11 @@ bool Navigable::has_a_rendering_opportunity() const
     // or whether its active document's visibility state is "visible".
     // Rendering opportunities typically occur at regular intervals.
 
-    // FIXME: Return `false` here if we're an inactive browser tab.
+    // NB: Hidden tabs can't present anything, so there's no point in running their rendering updates, which would also
+    //     run their animation frame callbacks and advance their animations.
+    if (auto traversable = traversable_navigable(); traversable && traversable->system_visibility_state() == VisibilityState::Hidden)
+        return false;
+
     return true;
 }
 
@@ -2800,7 +2811,12 @@ void Navigable::record_display_list_and_scroll_state(PaintConfig paint_config)
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.update_display_list(*display_list, move(scroll_state_snapshot_by_display_list));
+    // NB: Only the focused navigable paints a caret, see paint_cursor_if_needed().
+    bool should_paint_caret = true;
+    if (auto focused_document = page().focused_navigable().active_document())
+        should_paint_caret = focused_document->cursor_blink_state();
+
+    m_rendering_thread.update_display_list(*display_list, move(scroll_state_snapshot_by_display_list), should_paint_caret);
 }
 
 void Navigable::paint_next_frame()
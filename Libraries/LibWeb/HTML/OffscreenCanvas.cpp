@@ -13,7 +13,6 @@
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WorkerGlobalScope.h>
-#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebGL/WebGL2RenderingContext.h>
 #include <LibWeb/WebGL/WebGLRenderingContext.h>
 
@@ -27,6 +26,13 @@ GC::Ref<OffscreenCanvas> OffscreenCanvas::create(JS::Realm& realm, WebIDL::Unsig
     return MUST(OffscreenCanvas::construct_impl(realm, width, height));
 }
 
+// NB: The bitmap is backed by an anonymous buffer, so that an ImageBitmap taken from it with transferToImageBitmap() can be
+//     transferred to another agent (e.g. from a worker to its document) without copying its pixels.
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> create_offscreen_canvas_bitmap(Gfx::IntSize size)
+{
+    return Gfx::Bitmap::create_shareable(Gfx::BitmapFormat::RGBA8888, Gfx::AlphaType::Premultiplied, size);
+}
+
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas
 WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> OffscreenCanvas::construct_impl(
     JS::Realm& realm,
@@ -36,7 +42,7 @@ WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> OffscreenCanvas::construct_impl(
     RefPtr<Gfx::Bitmap> bitmap;
     if (width > 0 && height > 0) {
         // The new OffscreenCanvas(width, height) constructor steps are:
-        auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, Gfx::IntSize { width, height });
+        auto bitmap_or_error = create_offscreen_canvas_bitmap(Gfx::IntSize { width, height });
 
         if (bitmap_or_error.is_error()) {
             return WebIDL::InvalidStateError::create(realm, Utf16String::formatted("Error in allocating bitmap: {}", bitmap_or_error.error()));
@@ -143,7 +149,7 @@ WebIDL::ExceptionOr<void> OffscreenCanvas::set_new_bitmap_size(Gfx::IntSize new_
     else {
         // FIXME: Other browsers appear to not throw for unreasonable sizes being set. We could consider deferring allocation of the bitmap until it is used,
         //        but for now, lets just allocate it here and throw if it fails instead of crashing.
-        auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, Gfx::IntSize { new_size.width(), new_size.height() });
+        auto bitmap_or_error = create_offscreen_canvas_bitmap(Gfx::IntSize { new_size.width(), new_size.height() });
         if (bitmap_or_error.is_error()) {
             return WebIDL::InvalidStateError::create(realm(), Utf16String::formatted("Error in allocating bitmap: {}", bitmap_or_error.error()));
         }
@@ -253,7 +259,7 @@ WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> OffscreenCanvas::transfer_to_image_bit
     if (size.is_empty()) {
         m_bitmap = nullptr;
     } else {
-        m_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, size));
+        m_bitmap = MUST(create_offscreen_canvas_bitmap(size));
     }
 
     // 5. Return image.
@@ -298,30 +304,26 @@ GC::Ref<WebIDL::Promise> OffscreenCanvas::convert_to_blob(Optional<ImageEncodeOp
     auto& global = HTML::relevant_global_object(*this);
 
     // 7. Run these steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this, &global, result_promise, bitmap, maybe_options] {
-        // 1. Let file be a serialization of bitmap as a file, with options's type and quality if present.
-        Optional<SerializeBitmapResult> file_result {};
-        auto options = options_convert_or_default(maybe_options);
-
-        if (auto result = serialize_bitmap(*bitmap, options.get<0>(), options.get<1>()); !result.is_error())
-            file_result = result.release_value();
-
+    //    1. Let file be a serialization of bitmap as a file, with options's type and quality if present.
+    auto options = options_convert_or_default(move(maybe_options));
+    serialize_bitmap_in_parallel(move(bitmap), options.get<0>(), options.get<1>(), [canvas = GC::make_root(*this), global = GC::make_root(global), result_promise = GC::make_root(result_promise)](Optional<SerializeBitmapResult> file_result) {
         // 2. Queue a global task on the canvas blob serialization task source given global to run these steps:
-        HTML::queue_global_task(Task::Source::CanvasBlobSerializationTask, global, GC::create_function(heap(), [this, result_promise, file_result = move(file_result)] -> void {
-            HTML::TemporaryExecutionContext context(realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        HTML::queue_global_task(Task::Source::CanvasBlobSerializationTask, *global, GC::create_function(canvas->heap(), [canvas = GC::Ref { *canvas }, result_promise = GC::Ref { *result_promise }, file_result = move(file_result)] -> void {
+            auto& realm = canvas->realm();
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
             // 1. If file is null, then reject result with an "EncodingError" DOMException.
             if (!file_result.has_value()) {
-                auto error = WebIDL::EncodingError::create(realm(), "Failed to convert OffscreenCanvas to Blob"_utf16);
-                WebIDL::reject_promise(realm(), result_promise, error);
+                auto error = WebIDL::EncodingError::create(realm, "Failed to convert OffscreenCanvas to Blob"_utf16);
+                WebIDL::reject_promise(realm, result_promise, error);
             }
             // 2. Otherwise, resolve result with a new Blob object, created in global's relevant realm, representing file. [FILEAPI]
             else {
-                auto blob = FileAPI::Blob::create(realm(), file_result->buffer, MUST(String::from_utf8(file_result->mime_type)));
-                WebIDL::resolve_promise(realm(), result_promise, blob);
+                auto blob = FileAPI::Blob::create(realm, file_result->buffer, MUST(String::from_utf8(file_result->mime_type)));
+                WebIDL::resolve_promise(realm, result_promise, blob);
             }
         }));
-    }));
+    });
 
     // 8. Return result.
     return result_promise;
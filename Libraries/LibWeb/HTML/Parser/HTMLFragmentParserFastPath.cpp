@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
+#include <AK/StringBuilder.h>
+#include <LibWeb/DOM/Attr.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementFactory.h>
+#include <LibWeb/DOM/QualifiedName.h>
+#include <LibWeb/DOM/Text.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/HTMLFormElement.h>
+#include <LibWeb/HTML/Parser/HTMLFragmentParserFastPath.h>
+#include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Namespace.h>
+
+namespace Web::HTML {
+
+namespace {
+
+// NB: How the "in body" insertion mode treats a start tag for each of the elements we support, which determines when
+//     the tree builder would do anything other than append the element to the current node.
+enum class ElementKind {
+    // "Any other start tag"
+    Ordinary,
+    // Closes a p element that is in button scope.
+    Block,
+    // Closes a p element that is in button scope and a heading that is the current node.
+    Heading,
+    // Closes an li element and a p element that is in button scope.
+    ListItem,
+    // Closes a button element that is in scope.
+    Button,
+    // Immediately popped off the stack of open elements again.
+    Void,
+};
+
+HashMap<FlyString, ElementKind> const& supported_elements()
+{
+    static auto const elements = [] {
+        HashMap<FlyString, ElementKind> elements;
+        for (auto const& name : { TagNames::abbr, TagNames::bdi, TagNames::bdo, TagNames::cite, TagNames::data, TagNames::del, TagNames::dfn, TagNames::ins, TagNames::kbd, TagNames::label, TagNames::mark, TagNames::picture, TagNames::q, TagNames::samp, TagNames::span, TagNames::sub, TagNames::sup, TagNames::time, TagNames::var })
+            elements.set(name, ElementKind::Ordinary);
+        for (auto const& name : { TagNames::address, TagNames::article, TagNames::aside, TagNames::blockquote, TagNames::center, TagNames::details, TagNames::div, TagNames::dl, TagNames::figcaption, TagNames::figure, TagNames::footer, TagNames::header, TagNames::hgroup, TagNames::main, TagNames::menu, TagNames::nav, TagNames::ol, TagNames::p, TagNames::search, TagNames::section, TagNames::summary, TagNames::ul })
+            elements.set(name, ElementKind::Block);
+        for (auto const& name : { TagNames::h1, TagNames::h2, TagNames::h3, TagNames::h4, TagNames::h5, TagNames::h6 })
+            elements.set(name, ElementKind::Heading);
+        elements.set(TagNames::li, ElementKind::ListItem);
+        elements.set(TagNames::button, ElementKind::Button);
+        for (auto const& name : { TagNames::br, TagNames::img, TagNames::input, TagNames::wbr })
+            elements.set(name, ElementKind::Void);
+        return elements;
+    }();
+    return elements;
+}
+
+constexpr bool is_tokenizer_whitespace(char ch)
+{
+    // NB: U+000D CARRIAGE RETURN never gets this far, since we leave normalizing newlines to the full parser.
+    return ch == '\t' || ch == '\n' || ch == '\f' || ch == ' ';
+}
+
+constexpr bool is_attribute_name_character(char ch)
+{
+    return is_ascii_alphanumeric(ch) || ch == '-' || ch == '_' || ch == ':' || ch == '.';
+}
+
+FlyString to_lowercase_name(StringView name)
+{
+    if (!any_of(name, is_ascii_upper_alpha))
+        return FlyString::from_utf8_without_validation(name.bytes());
+    return name.to_ascii_lowercase_string();
+}
+
+class FragmentParser {
+public:
+    FragmentParser(DOM::Document& document, StringView markup)
+        : m_document(document)
+        , m_lexer(markup)
+    {
+    }
+
+    bool parse();
+    Vector<GC::Root<DOM::Node>> take_nodes() { return move(m_nodes); }
+
+private:
+    struct OpenElement {
+        GC::Ref<DOM::Element> element;
+        ElementKind kind;
+    };
+
+    bool parse_start_tag();
+    bool parse_end_tag();
+    bool parse_attribute_value(StringBuilder&);
+    bool consume_character_reference(StringBuilder&);
+
+    bool has_a_p_element_in_button_scope() const;
+    bool has_an_li_element_that_would_be_closed() const;
+
+    void flush_text();
+    void insert_node(GC::Ref<DOM::Node>);
+
+    DOM::Document& m_document;
+    GenericLexer m_lexer;
+    Vector<OpenElement> m_stack_of_open_elements;
+    Vector<GC::Root<DOM::Node>> m_nodes;
+    StringBuilder m_text { StringBuilder::Mode::UTF16 };
+};
+
+bool FragmentParser::parse()
+{
+    while (!m_lexer.is_eof()) {
+        auto ch = m_lexer.peek();
+
+        if (ch == '<') {
+            auto next = m_lexer.peek(1);
+            if (is_ascii_alpha(next)) {
+                if (!parse_start_tag())
+                    return false;
+                continue;
+            }
+            if (next == '/') {
+                if (!parse_end_tag())
+                    return false;
+                continue;
+            }
+            if (next == '!' || next == '?')
+                return false;
+
+            // NB: Anything else makes the tokenizer emit the '<' as a character token.
+            m_lexer.ignore();
+            m_text.append('<');
+            continue;
+        }
+
+        if (ch == '&') {
+            if (!consume_character_reference(m_text))
+                return false;
+            continue;
+        }
+
+        // NB: The tree builder drops U+0000 NULL characters in body content, and the tokenizer normalizes newlines.
+        if (ch == '\0' || ch == '\r')
+            return false;
+
+        m_text.append(m_lexer.consume_until([](char ch) { return ch == '<' || ch == '&' || ch == '\0' || ch == '\r'; }));
+    }
+
+    flush_text();
+    return true;
+}
+
+bool FragmentParser::parse_start_tag()
+{
+    m_lexer.ignore();
+    auto tag_name = to_lowercase_name(m_lexer.consume_while(is_ascii_alphanumeric));
+    auto next = m_lexer.peek();
+    if (!is_tokenizer_whitespace(next) && next != '/' && next != '>')
+        return false;
+
+    auto kind = supported_elements().get(tag_name);
+    if (!kind.has_value())
+        return false;
+
+    // NB: These are the cases where the "in body" insertion mode would close open elements before inserting this one.
+    switch (*kind) {
+    case ElementKind::Ordinary:
+    case ElementKind::Void:
+        break;
+    case ElementKind::Block:
+        if (has_a_p_element_in_button_scope())
+            return false;
+        break;
+    case ElementKind::Heading:
+        if (has_a_p_element_in_button_scope())
+            return false;
+        if (!m_stack_of_open_elements.is_empty() && m_stack_of_open_elements.last().kind == ElementKind::Heading)
+            return false;
+        break;
+    case ElementKind::ListItem:
+        if (has_an_li_element_that_would_be_closed() || has_a_p_element_in_button_scope())
+            return false;
+        break;
+    case ElementKind::Button:
+        if (any_of(m_stack_of_open_elements, [](auto const& entry) { return entry.kind == ElementKind::Button; }))
+            return false;
+        break;
+    }
+
+    Vector<DOM::QualifiedName, 4> attribute_names;
+    Vector<String, 4> attribute_values;
+
+    while (true) {
+        m_lexer.ignore_while(is_tokenizer_whitespace);
+
+        if (m_lexer.consume_specific('>'))
+            break;
+
+        // NB: The self-closing flag is only acknowledged for void elements.
+        if (m_lexer.consume_specific("/>"sv)) {
+            if (*kind != ElementKind::Void)
+                return false;
+            break;
+        }
+
+        // NB: This also catches start tags that are cut off by the end of the input, which the tokenizer drops.
+        auto name = m_lexer.consume_while(is_attribute_name_character);
+        if (name.is_empty())
+            return false;
+        next = m_lexer.peek();
+        if (!is_tokenizer_whitespace(next) && next != '/' && next != '>' && next != '=')
+            return false;
+        auto attribute_name = to_lowercase_name(name);
+
+        // NB: The tokenizer drops duplicate attributes, and the "is" attribute would make this a customized built-in.
+        if (attribute_name == AttributeNames::is)
+            return false;
+        if (any_of(attribute_names, [&](auto const& existing_name) { return existing_name.local_name() == attribute_name; }))
+            return false;
+
+        m_lexer.ignore_while(is_tokenizer_whitespace);
+
+        StringBuilder value_builder;
+        if (m_lexer.consume_specific('=')) {
+            m_lexer.ignore_while(is_tokenizer_whitespace);
+            if (!parse_attribute_value(value_builder))
+                return false;
+
+            next = m_lexer.peek();
+            if (!is_tokenizer_whitespace(next) && next != '/' && next != '>')
+                return false;
+        }
+
+        attribute_names.append({ attribute_name, {}, {} });
+        attribute_values.append(value_builder.to_string_without_validation());
+    }
+
+    flush_text();
+
+    auto element_or_error = DOM::create_element(m_document, tag_name, Namespace::HTML);
+    if (element_or_error.is_error())
+        return false;
+    auto element = element_or_error.release_value();
+
+    // NB: Like the tree builder, we append the attributes before inserting the element, so that its insertion steps
+    //     already see them.
+    for (size_t i = 0; i < attribute_names.size(); ++i) {
+        auto attribute = m_document.realm().create<DOM::Attr>(m_document, move(attribute_names[i]), move(attribute_values[i]), element);
+        element->append_attribute(attribute);
+    }
+
+    insert_node(element);
+
+    if (*kind != ElementKind::Void)
+        m_stack_of_open_elements.append({ element, *kind });
+    return true;
+}
+
+bool FragmentParser::parse_end_tag()
+{
+    m_lexer.ignore(2);
+    auto name = m_lexer.consume_while(is_ascii_alphanumeric);
+    if (name.is_empty())
+        return false;
+    m_lexer.ignore_while(is_tokenizer_whitespace);
+    if (!m_lexer.consume_specific('>'))
+        return false;
+
+    // NB: An end tag that matches the current node is handled by just popping it for every element we support. Any
+    //     other end tag makes the tree builder either ignore it, generate implied end tags, or insert new elements.
+    if (m_stack_of_open_elements.is_empty() || !m_stack_of_open_elements.last().element->local_name().equals_ignoring_ascii_case(name))
+        return false;
+
+    flush_text();
+    m_stack_of_open_elements.take_last();
+    return true;
+}
+
+bool FragmentParser::parse_attribute_value(StringBuilder& builder)
+{
+    auto quote = m_lexer.peek();
+    if (quote == '"' || quote == '\'') {
+        m_lexer.ignore();
+        while (true) {
+            if (m_lexer.is_eof())
+                return false;
+            auto ch = m_lexer.peek();
+            if (ch == quote) {
+                m_lexer.ignore();
+                return true;
+            }
+            if (ch == '&') {
+                if (!consume_character_reference(builder))
+                    return false;
+                continue;
+            }
+            if (ch == '\0' || ch == '\r')
+                return false;
+            builder.append(m_lexer.consume_until([quote](char ch) { return ch == quote || ch == '&' || ch == '\0' || ch == '\r'; }));
+        }
+    }
+
+    // NB: An empty unquoted attribute value means the tag ends right after the '='.
+    if (quote == '>')
+        return false;
+
+    while (!m_lexer.is_eof()) {
+        auto ch = m_lexer.peek();
+        if (is_tokenizer_whitespace(ch) || ch == '>')
+            return true;
+        if (ch == '&') {
+            if (!consume_character_reference(builder))
+                return false;
+            continue;
+        }
+        if (ch == '"' || ch == '\'' || ch == '<' || ch == '=' || ch == '`' || ch == '\0' || ch == '\r')
+            return false;
+        builder.append(m_lexer.consume());
+    }
+    return false;
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#character-reference-state
+bool FragmentParser::consume_character_reference(StringBuilder& builder)
+{
+    m_lexer.ignore();
+
+    auto next = m_lexer.peek();
+    if (!is_ascii_alphanumeric(next) && next != '#') {
+        builder.append('&');
+        return true;
+    }
+
+    // NB: We only support terminated references to code points that are passed through as-is, and the few named
+    //     references that markup generators commonly escape text with.
+    if (m_lexer.consume_specific('#')) {
+        bool is_hexadecimal = m_lexer.consume_specific('x') || m_lexer.consume_specific('X');
+        auto digits = is_hexadecimal ? m_lexer.consume_while(is_ascii_hex_digit) : m_lexer.consume_while(is_ascii_digit);
+        if (digits.is_empty() || digits.length() > 6 || !m_lexer.consume_specific(';'))
+            return false;
+
+        u32 code_point = 0;
+        for (auto digit : digits)
+            code_point = code_point * (is_hexadecimal ? 16 : 10) + parse_ascii_hex_digit(digit);
+
+        bool is_passed_through = (code_point >= 0x20 && code_point < 0x7f)
+            || code_point == '\t' || code_point == '\n' || code_point == '\f'
+            || (code_point >= 0xa0 && code_point <= 0x10ffff && !is_unicode_surrogate(code_point));
+        if (!is_passed_through)
+            return false;
+
+        builder.append_code_point(code_point);
+        return true;
+    }
+
+    auto name = m_lexer.consume_while(is_ascii_alphanumeric);
+    if (!m_lexer.consume_specific(';'))
+        return false;
+
+    if (name == "amp"sv)
+        builder.append('&');
+    else if (name == "lt"sv)
+        builder.append('<');
+    else if (name == "gt"sv)
+        builder.append('>');
+    else if (name == "quot"sv)
+        builder.append('"');
+    else if (name == "apos"sv)
+        builder.append('\'');
+    else if (name == "nbsp"sv)
+        builder.append_code_point(0xa0);
+    else
+        return false;
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#has-an-element-in-button-scope
+bool FragmentParser::has_a_p_element_in_button_scope() const
+{
+    // NB: Of the elements we support, only button elements delimit the button scope.
+    for (auto const& entry : m_stack_of_open_elements.in_reverse()) {
+        if (entry.element->local_name() == TagNames::p)
+            return true;
+        if (entry.kind == ElementKind::Button)
+            return false;
+    }
+    return false;
+}
+
+bool FragmentParser::has_an_li_element_that_would_be_closed() const
+{
+    // NB: This mirrors the loop in the "in body" insertion mode's handling of li start tags.
+    for (auto const& entry : m_stack_of_open_elements.in_reverse()) {
+        if (entry.kind == ElementKind::ListItem)
+            return true;
+        auto const& local_name = entry.element->local_name();
+        if (HTMLParser::is_special_tag(local_name, Namespace::HTML) && !local_name.is_one_of(TagNames::address, TagNames::div, TagNames::p))
+            return false;
+    }
+    return false;
+}
+
+void FragmentParser::flush_text()
+{
+    if (m_text.is_empty())
+        return;
+    insert_node(m_document.realm().create<DOM::Text>(m_document, m_text.to_utf16_string()));
+    m_text.clear();
+}
+
+void FragmentParser::insert_node(GC::Ref<DOM::Node> node)
+{
+    // NB: Nodes are always inserted into their parent right away, so that the roots we hold for the top-level ones keep
+    //     everything else alive as well.
+    if (m_stack_of_open_elements.is_empty())
+        m_nodes.append(GC::make_root(node));
+    else
+        m_stack_of_open_elements.last().element->insert_before(node, nullptr);
+}
+
+}
+
+Optional<Vector<GC::Root<DOM::Node>>> try_parse_html_fragment_using_fast_path(DOM::Element& context_element, StringView markup)
+{
+    // NB: The context element has to leave the tokenizer in the data state and make the tree builder start in the
+    //     "in body" insertion mode, as that's the only one we handle.
+    if (!context_element.document().is_html_document() || context_element.namespace_uri() != Namespace::HTML)
+        return {};
+    if (context_element.local_name().is_one_of(TagNames::title, TagNames::textarea, TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes, TagNames::script, TagNames::noscript, TagNames::plaintext)
+        || context_element.local_name().is_one_of(TagNames::select, TagNames::td, TagNames::th, TagNames::tr, TagNames::tbody, TagNames::thead, TagNames::tfoot, TagNames::caption, TagNames::colgroup, TagNames::table, TagNames::template_, TagNames::head, TagNames::frameset, TagNames::html)) {
+        return {};
+    }
+
+    // NB: Form-associated elements would be associated with the form element pointer the full parser sets up.
+    if (is<HTMLFormElement>(context_element) || context_element.first_ancestor_of_type<HTMLFormElement>())
+        return {};
+
+    FragmentParser parser { context_element.document(), markup };
+    if (!parser.parse())
+        return {};
+    return parser.take_nodes();
+}
+
+}
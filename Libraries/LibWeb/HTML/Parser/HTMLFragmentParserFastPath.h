@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Vector.h>
+#include <LibGC/Root.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// Parses fragments that stick to a common subset of HTML (plain elements nested exactly as written, text, and a handful
+// of character references) directly into nodes of the context element's document. This skips setting up a temporary
+// document, a full parser and the tree builder, and adopting every node afterwards.
+//
+// Returns an empty Optional for anything the HTML fragment parsing algorithm might treat differently, e.g. formatting
+// elements, implied end tags, tables, foreign content, custom elements and comments, in which case the caller must fall
+// back to that algorithm. Otherwise, the returned nodes are the ones it would have produced.
+Optional<Vector<GC::Root<DOM::Node>>> try_parse_html_fragment_using_fast_path(DOM::Element& context_element, StringView markup);
+
+}
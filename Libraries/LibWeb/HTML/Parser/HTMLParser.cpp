@@ -9,6 +9,7 @@
 
 #include <AK/Debug.h>
 #include <AK/SourceLocation.h>
+#include <AK/TemporaryChange.h>
 #include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
@@ -38,7 +39,9 @@
 #include <LibWeb/HTML/HTMLTableElement.h>
 #include <LibWeb/HTML/HTMLTemplateElement.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
+#include <LibWeb/HTML/Parser/HTMLFragmentParserFastPath.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
@@ -164,6 +167,7 @@ HTMLParser::HTMLParser(DOM::Document& document, StringView input, StringView enc
     , m_document(document)
 {
     m_tokenizer.set_parser({}, *this);
+    m_tokenizer.set_emits_character_runs(true);
     m_document->set_parser({}, *this);
     m_stack_of_open_elements.set_on_element_popped([this](DOM::Element& element) {
         handle_element_popped(element);
@@ -179,6 +183,7 @@ HTMLParser::HTMLParser(DOM::Document& document)
 {
     m_document->set_parser({}, *this);
     m_tokenizer.set_parser({}, *this);
+    m_tokenizer.set_emits_character_runs(true);
     m_stack_of_open_elements.set_on_element_popped([this](DOM::Element& element) {
         handle_element_popped(element);
     });
@@ -200,6 +205,8 @@ void HTMLParser::visit_edges(Cell::Visitor& visitor)
     m_stack_of_open_elements.visit_edges(visitor);
     m_list_of_active_formatting_elements.visit_edges(visitor);
     m_tokenizer.visit_edges(visitor);
+    if (m_preload_scanner)
+        m_preload_scanner->visit_edges(visitor);
 }
 
 void HTMLParser::initialize(JS::Realm& realm)
@@ -214,8 +221,16 @@ void HTMLParser::initialize(JS::Realm& realm)
 void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
     m_stop_parsing = false;
+    m_did_yield_to_the_event_loop = false;
+
+    TemporaryChange run_nesting_level { m_run_nesting_level, m_run_nesting_level + 1 };
 
     for (;;) {
+        if (should_yield_to_the_event_loop()) {
+            m_did_yield_to_the_event_loop = true;
+            break;
+        }
+
         auto optional_token = m_tokenizer.next_token(stop_at_insertion_point);
         if (!optional_token.has_value())
             break;
@@ -223,6 +238,11 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
 
         dbgln_if(HTML_PARSER_DEBUG, "[{}] {}", insertion_mode_name(), token.to_string());
 
+        if (token.is_character_run()) {
+            process_character_run(token.character_run());
+            continue;
+        }
+
         if (m_next_line_feed_can_be_ignored) {
             m_next_line_feed_can_be_ignored = false;
             if (token.is_character() && token.code_point() == '\n') {
@@ -230,32 +250,7 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
             }
         }
 
-        // https://html.spec.whatwg.org/multipage/parsing.html#tree-construction-dispatcher
-        // As each token is emitted from the tokenizer, the user agent must follow the appropriate steps from the following list, known as the tree construction dispatcher:
-        if (m_stack_of_open_elements.is_empty()
-            || adjusted_current_node()->namespace_uri() == Namespace::HTML
-            || (is_mathml_text_integration_point(*adjusted_current_node()) && token.is_start_tag() && token.tag_name() != MathML::TagNames::mglyph && token.tag_name() != MathML::TagNames::malignmark)
-            || (is_mathml_text_integration_point(*adjusted_current_node()) && token.is_character())
-            || (adjusted_current_node()->namespace_uri() == Namespace::MathML && adjusted_current_node()->local_name() == MathML::TagNames::annotation_xml && token.is_start_tag() && token.tag_name() == SVG::TagNames::svg)
-            || (is_html_integration_point(*adjusted_current_node()) && (token.is_start_tag() || token.is_character()))
-            || token.is_end_of_file()) {
-            // -> If the stack of open elements is empty
-            // -> If the adjusted current node is an element in the HTML namespace
-            // -> If the adjusted current node is a MathML text integration point and the token is a start tag whose tag name is neither "mglyph" nor "malignmark"
-            // -> If the adjusted current node is a MathML text integration point and the token is a character token
-            // -> If the adjusted current node is a MathML annotation-xml element and the token is a start tag whose tag name is "svg"
-            // -> If the adjusted current node is an HTML integration point and the token is a start tag
-            // -> If the adjusted current node is an HTML integration point and the token is a character token
-            // -> If the token is an end-of-file token
-
-            // Process the token according to the rules given in the section corresponding to the current insertion mode in HTML content.
-            process_using_the_rules_for(m_insertion_mode, token);
-        } else {
-            // -> Otherwise
-
-            // Process the token according to the rules given in the section for parsing tokens in foreign content.
-            process_using_the_rules_for_foreign_content(token);
-        }
+        process_using_the_tree_construction_dispatcher(token);
 
         if (token.is_end_of_file() && m_tokenizer.is_eof_inserted())
             break;
@@ -271,6 +266,70 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
     m_tokenizer.parser_did_run({});
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#tree-construction-dispatcher
+void HTMLParser::process_using_the_tree_construction_dispatcher(HTMLToken& token)
+{
+    // As each token is emitted from the tokenizer, the user agent must follow the appropriate steps from the following list, known as the tree construction dispatcher:
+    if (m_stack_of_open_elements.is_empty()
+        || adjusted_current_node()->namespace_uri() == Namespace::HTML
+        || (is_mathml_text_integration_point(*adjusted_current_node()) && token.is_start_tag() && token.tag_name() != MathML::TagNames::mglyph && token.tag_name() != MathML::TagNames::malignmark)
+        || (is_mathml_text_integration_point(*adjusted_current_node()) && token.is_character())
+        || (adjusted_current_node()->namespace_uri() == Namespace::MathML && adjusted_current_node()->local_name() == MathML::TagNames::annotation_xml && token.is_start_tag() && token.tag_name() == SVG::TagNames::svg)
+        || (is_html_integration_point(*adjusted_current_node()) && (token.is_start_tag() || token.is_character()))
+        || token.is_end_of_file()) {
+        // -> If the stack of open elements is empty
+        // -> If the adjusted current node is an element in the HTML namespace
+        // -> If the adjusted current node is a MathML text integration point and the token is a start tag whose tag name is neither "mglyph" nor "malignmark"
+        // -> If the adjusted current node is a MathML text integration point and the token is a character token
+        // -> If the adjusted current node is a MathML annotation-xml element and the token is a start tag whose tag name is "svg"
+        // -> If the adjusted current node is an HTML integration point and the token is a start tag
+        // -> If the adjusted current node is an HTML integration point and the token is a character token
+        // -> If the token is an end-of-file token
+
+        // Process the token according to the rules given in the section corresponding to the current insertion mode in HTML content.
+        process_using_the_rules_for(m_insertion_mode, token);
+    } else {
+        // -> Otherwise
+
+        // Process the token according to the rules given in the section for parsing tokens in foreign content.
+        process_using_the_rules_for_foreign_content(token);
+    }
+}
+
+// OPTIMIZATION: The tokenizer emits runs of character data as a single token, which never contains U+0000 NULL or
+//               U+000D CR. Processing such a run is equivalent to processing each of its code points as its own
+//               character token.
+void HTMLParser::process_character_run(Utf32View run)
+{
+    if (m_next_line_feed_can_be_ignored) {
+        m_next_line_feed_can_be_ignored = false;
+        if (*run.begin() == '\n')
+            run = run.substring_view(1);
+    }
+    if (run.is_empty())
+        return;
+
+    // NB: This is by far the most common case. Every code point would reconstruct the active formatting elements (which
+    //     is a no-op after the first one does it) and then be inserted, so we can insert the whole run at once.
+    if (m_insertion_mode == InsertionMode::InBody && !m_stack_of_open_elements.is_empty() && adjusted_current_node()->namespace_uri() == Namespace::HTML) {
+        reconstruct_the_active_formatting_elements();
+        insert_characters(run);
+
+        for (auto code_point : run) {
+            if (!first_is_one_of(code_point, '\t', '\n', '\f', ' ')) {
+                m_frameset_ok = false;
+                break;
+            }
+        }
+        return;
+    }
+
+    for (auto code_point : run) {
+        auto token = HTMLToken::make_character(code_point);
+        process_using_the_tree_construction_dispatcher(token);
+    }
+}
+
 void HTMLParser::run(URL::URL const& url, HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
     m_document->set_url(url);
@@ -279,6 +338,63 @@ void HTMLParser::run(URL::URL const& url, HTMLTokenizer::StopAtInsertionPoint st
     the_end(*m_document, this);
 }
 
+// NB: Until the body element exists, the document is render-blocked and yielding wouldn't get anything painted. After
+//     that, the first slice is kept short so that the top of the page shows up early, and later slices are longer so
+//     that the overhead of yielding doesn't add much to the total time it takes to parse the document.
+static constexpr auto time_slice_until_first_render_opportunity = AK::Duration::from_milliseconds(5);
+static constexpr auto time_slice_after_first_render_opportunity = AK::Duration::from_milliseconds(50);
+
+// NB: Reading the clock for every token would cost more than the checks save, so we only do it every so often.
+static constexpr size_t tokens_per_time_slice_check = 256;
+
+void HTMLParser::run_in_time_slices(URL::URL const& url)
+{
+    m_document->set_url(url);
+    m_document->set_source(m_tokenizer.source());
+    run_next_time_slice();
+}
+
+void HTMLParser::run_next_time_slice()
+{
+    // NB: Aborting the parser discards the rest of its input, including whatever we have yet to parse.
+    if (m_aborted)
+        return;
+
+    auto time_slice = m_has_yielded_since_body_was_created ? time_slice_after_first_render_opportunity : time_slice_until_first_render_opportunity;
+    m_time_slice_deadline = MonotonicTime::now() + time_slice;
+    m_tokens_since_time_slice_check = 0;
+    run();
+    m_time_slice_deadline = {};
+
+    if (!m_did_yield_to_the_event_loop) {
+        the_end(*m_document, this);
+        return;
+    }
+
+    if (m_document->body())
+        m_has_yielded_since_body_was_created = true;
+
+    queue_global_task(HTML::Task::Source::Networking, *m_document, GC::create_function(m_document->heap(), [parser = GC::Ref { *this }] {
+        parser->run_next_time_slice();
+    }));
+}
+
+bool HTMLParser::should_yield_to_the_event_loop()
+{
+    if (!m_time_slice_deadline.has_value() || m_run_nesting_level != 1)
+        return false;
+
+    if (++m_tokens_since_time_slice_check < tokens_per_time_slice_check)
+        return false;
+    m_tokens_since_time_slice_check = 0;
+
+    // NB: There's no point in yielding for a rendering update that would skip this document anyway.
+    if (m_document->is_render_blocked())
+        return false;
+
+    return MonotonicTime::now() >= *m_time_slice_deadline;
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#the-end
 void HTMLParser::the_end(GC::Ref<DOM::Document> document, GC::Ptr<HTMLParser> parser)
 {
@@ -315,7 +431,11 @@ void HTMLParser::the_end(GC::Ref<DOM::Document> document, GC::Ptr<HTMLParser> pa
     if (parser && parser->m_parsing_fragment)
         return;
 
-    // FIXME: 1. If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
+    // 1. If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
+    // NB: Our speculative parser runs to completion whenever it is started, so it is never active at this point. Every
+    //     element it fetched for has been created by now though, so we can let go of it.
+    if (parser)
+        parser->m_preload_scanner = nullptr;
 
     // 2. Set the insertion point to undefined.
     if (parser)
@@ -1458,6 +1578,14 @@ void HTMLParser::handle_element_popped(DOM::Element& element)
     }
 }
 
+void HTMLParser::insert_characters(Utf32View characters)
+{
+    // NB: Inserting the first character determines the text node that the rest of them go into as well.
+    insert_character(*characters.begin());
+    for (auto code_point : characters.substring_view(1))
+        m_character_insertion_builder.append_code_point(code_point);
+}
+
 void HTMLParser::insert_character(u32 data)
 {
     auto node = find_character_insertion_node();
@@ -3408,7 +3536,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3427,7 +3556,9 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NB: The speculative parser has already finished scanning by now. It stays around until parsing
+                    //     is done, so that the fetches it started aren't repeated the next time it is started.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4842,6 +4973,11 @@ DOM::Document& HTMLParser::document()
 // https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
 WebIDL::ExceptionOr<Vector<GC::Root<DOM::Node>>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
+    // OPTIMIZATION: Most fragments that get parsed are simple enough to be turned into nodes without setting up a
+    //               temporary document and running the tree builder, so we try that first.
+    if (auto children = try_parse_html_fragment_using_fast_path(context_element, markup); children.has_value())
+        return children.release_value();
+
     // 1. Let document be a Document node whose type is "html".
     auto temp_document = DOM::Document::create_for_fragment_parsing(context_element.realm());
     temp_document->set_document_type(DOM::Document::Type::HTML);
@@ -5505,13 +5641,28 @@ JS::Realm& HTMLParser::realm()
     return m_document->realm();
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // NB: Speculative fetches only make sense for documents that are actually going to load their subresources.
+    if (!m_document->browsing_context())
+        return;
+
+    // NB: All of the input is available up front, so one scan of whatever the tokenizer hasn't reached the first time
+    //     we block on a script finds everything. Subsequent starts have nothing left to do.
+    if (!m_preload_scanner)
+        m_preload_scanner = make<HTMLPreloadScanner>(*m_document, m_tokenizer.unconsumed_input(), m_scripting_enabled);
+    m_preload_scanner->scan();
+}
+
 // https://html.spec.whatwg.org/multipage/parsing.html#abort-a-parser
 void HTMLParser::abort()
 {
     // 1. Throw away any pending content in the input stream, and discard any future content that would have been added to it.
     m_tokenizer.abort();
 
-    // FIXME: 2. Stop the speculative HTML parser for this HTML parser.
+    // 2. Stop the speculative HTML parser for this HTML parser.
+    m_preload_scanner = nullptr;
 
     // 3. Update the current document readiness to "interactive".
     m_document->update_readiness(DocumentReadyState::Interactive);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <LibGfx/Color.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/DOM/Node.h>
@@ -66,6 +67,10 @@ public:
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(URL::URL const&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
 
+    // Like run(URL), but yields to the event loop whenever a time slice runs out, so that input can be handled and the
+    // partially parsed document can be rendered in between. Runs the end once the input has been parsed.
+    void run_in_time_slices(URL::URL const&);
+
     static void the_end(GC::Ref<DOM::Document>, GC::Ptr<HTMLParser> = nullptr);
 
     DOM::Document& document();
@@ -161,15 +166,22 @@ private:
     [[nodiscard]] GC::Ptr<DOM::Element> adjusted_current_node();
     [[nodiscard]] GC::Ptr<DOM::Element> node_before_current_node();
     void insert_character(u32 data);
+    void insert_characters(Utf32View);
     void insert_comment(HTMLToken&);
     void reconstruct_the_active_formatting_elements();
     void close_a_p_element();
+    void process_using_the_tree_construction_dispatcher(HTMLToken&);
+    void process_character_run(Utf32View);
+
+    void run_next_time_slice();
+    bool should_yield_to_the_event_loop();
     void process_using_the_rules_for(InsertionMode, HTMLToken&);
     void process_using_the_rules_for_foreign_content(HTMLToken&);
     void parse_generic_raw_text_element(HTMLToken&);
     void increment_script_nesting_level();
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
+    void start_the_speculative_html_parser();
 
     void handle_element_popped(DOM::Element&);
 
@@ -198,6 +210,9 @@ private:
 
     HTMLTokenizer m_tokenizer;
 
+    // https://html.spec.whatwg.org/multipage/parsing.html#active-speculative-html-parser
+    OwnPtr<HTMLPreloadScanner> m_preload_scanner;
+
     bool m_next_line_feed_can_be_ignored { false };
 
     bool m_foster_parenting { false };
@@ -214,6 +229,13 @@ private:
     bool m_stop_parsing { false };
     size_t m_script_nesting_level { 0 };
 
+    // NB: Only the outermost run() yields, since nested ones run on behalf of a script that expects them to finish.
+    size_t m_run_nesting_level { 0 };
+    Optional<MonotonicTime> m_time_slice_deadline;
+    size_t m_tokens_since_time_slice_check { 0 };
+    bool m_did_yield_to_the_event_loop { false };
+    bool m_has_yielded_since_body_was_created { false };
+
     JS::Realm& realm();
 
     GC::Ptr<DOM::Document> m_document;
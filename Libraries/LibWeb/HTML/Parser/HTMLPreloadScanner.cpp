@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/SharedResourceRequest.h>
+#include <LibWeb/HTML/SourceSet.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+
+namespace Web::HTML {
+
+HTMLPreloadScanner::HTMLPreloadScanner(DOM::Document& document, StringView input, bool scripting_enabled)
+    : m_document(document)
+    , m_tokenizer(input, "UTF-8"sv)
+    , m_scripting_enabled(scripting_enabled)
+{
+}
+
+void HTMLPreloadScanner::visit_edges(GC::Cell::Visitor& visitor)
+{
+    visitor.visit(m_document);
+    visitor.visit(m_image_requests);
+    m_tokenizer.visit_edges(visitor);
+}
+
+void HTMLPreloadScanner::scan()
+{
+    if (m_is_done)
+        return;
+
+    while (true) {
+        auto token = m_tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_start_tag())
+            process_start_tag(*token);
+        else if (token->is_end_tag())
+            process_end_tag(*token);
+    }
+
+    m_is_done = true;
+}
+
+static bool has_link_type(Optional<String> const& rel, StringView link_type)
+{
+    if (!rel.has_value())
+        return false;
+
+    for (auto keyword : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+        if (keyword.equals_ignoring_ascii_case(link_type))
+            return true;
+    }
+    return false;
+}
+
+void HTMLPreloadScanner::process_start_tag(HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+
+    // NB: The tree builder is what normally switches the tokenizer into these states, and without one we have to do it
+    //     ourselves so that we don't look for markup inside of script or style contents.
+    if (tag_name == TagNames::script) {
+        m_tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+    } else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes)
+        || (tag_name == TagNames::noscript && m_scripting_enabled)) {
+        m_tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+    } else if (tag_name.is_one_of(TagNames::title, TagNames::textarea)) {
+        m_tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+    } else if (tag_name == TagNames::plaintext) {
+        m_tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+    }
+
+    if (tag_name.is_one_of(TagNames::svg, TagNames::math)) {
+        if (!token.is_self_closing())
+            ++m_foreign_content_depth;
+        return;
+    }
+    if (tag_name == TagNames::template_) {
+        ++m_template_depth;
+        return;
+    }
+
+    // NB: Only HTML elements are speculatively fetched for, and template contents are inert.
+    if (m_foreign_content_depth > 0 || m_template_depth > 0)
+        return;
+
+    // NB: Only the first base element determines the document base URL.
+    if (tag_name == TagNames::base) {
+        if (m_base_url.has_value())
+            return;
+        if (auto href = token.attribute(AttributeNames::href); href.has_value())
+            m_base_url = parse_url(*href);
+        return;
+    }
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    if (tag_name == TagNames::script) {
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || token.attribute(AttributeNames::nomodule).has_value())
+            return;
+
+        // NB: This mirrors how HTMLScriptElement determines the script's type from its type and language attributes.
+        auto type = token.attribute(AttributeNames::type);
+        auto language = token.attribute(AttributeNames::language);
+        String script_block_type;
+        if ((type.has_value() && type->is_empty()) || (!type.has_value() && (!language.has_value() || language->is_empty())))
+            script_block_type = "text/javascript"_string;
+        else if (type.has_value())
+            script_block_type = MUST(type->trim(Infra::ASCII_WHITESPACE));
+        else
+            script_block_type = MUST(String::formatted("text/{}", *language));
+
+        if (script_block_type.equals_ignoring_ascii_case("module"sv)) {
+            // NB: Module scripts are always fetched in CORS mode.
+            if (cors_setting == CORSSettingAttribute::NoCORS)
+                cors_setting = CORSSettingAttribute::Anonymous;
+        } else if (!MimeSniff::is_javascript_mime_type_essence_match(script_block_type)) {
+            return;
+        }
+
+        speculative_fetch(*src, Fetch::Infrastructure::Request::Destination::Script, cors_setting, token);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        auto href = token.attribute(AttributeNames::href);
+        if (!href.has_value())
+            return;
+
+        auto rel = token.attribute(AttributeNames::rel);
+        if (has_link_type(rel, "stylesheet"sv)) {
+            if (has_link_type(rel, "alternate"sv) || token.attribute(AttributeNames::disabled).has_value())
+                return;
+            speculative_fetch(*href, Fetch::Infrastructure::Request::Destination::Style, cors_setting, token);
+        } else if (has_link_type(rel, "modulepreload"sv)) {
+            if (cors_setting == CORSSettingAttribute::NoCORS)
+                cors_setting = CORSSettingAttribute::Anonymous;
+            speculative_fetch(*href, Fetch::Infrastructure::Request::Destination::Script, cors_setting, token);
+        } else if (has_link_type(rel, "preload"sv)) {
+            // NB: Image preloads may use a source set, which we leave to the preload element itself.
+            auto as = token.attribute(AttributeNames::as);
+            if (!as.has_value() || !as->is_one_of("fetch"sv, "font"sv, "script"sv, "style"sv, "track"sv))
+                return;
+            auto destination = Fetch::Infrastructure::translate_potential_destination(*as);
+
+            // NB: Fonts are always fetched in CORS mode.
+            if (destination == Fetch::Infrastructure::Request::Destination::Font && cors_setting == CORSSettingAttribute::NoCORS)
+                cors_setting = CORSSettingAttribute::Anonymous;
+            speculative_fetch(*href, destination, cors_setting, token);
+        }
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        speculative_fetch_image(token);
+        return;
+    }
+}
+
+void HTMLPreloadScanner::process_end_tag(HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+    if (tag_name.is_one_of(TagNames::svg, TagNames::math)) {
+        if (m_foreign_content_depth > 0)
+            --m_foreign_content_depth;
+    } else if (tag_name == TagNames::template_) {
+        if (m_template_depth > 0)
+            --m_template_depth;
+    }
+}
+
+Optional<URL::URL> HTMLPreloadScanner::parse_url(StringView url) const
+{
+    if (m_base_url.has_value())
+        return DOMURL::parse(url, *m_base_url, m_document->encoding_or_default());
+    return m_document->encoding_parse_url(url);
+}
+
+void HTMLPreloadScanner::speculative_fetch_image(HTMLToken const& token)
+{
+    // NB: Lazily loaded images are only fetched once they get close to the viewport.
+    auto loading = token.attribute(AttributeNames::loading);
+    if (m_scripting_enabled && loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+        return;
+
+    auto src = token.attribute(AttributeNames::src).value_or({});
+    auto srcset = token.attribute(AttributeNames::srcset).value_or({});
+
+    // NB: Selecting a source from a source set needs an element to evaluate the sizes attribute's media conditions
+    //     against. Since those only depend on the document, the document element is as good as the img would be.
+    String selected_source = src;
+    if (!srcset.is_empty()) {
+        auto* document_element = m_document->document_element();
+        if (!document_element || !m_document->window())
+            return;
+
+        auto source_set = SourceSet::create(*document_element, src, srcset, token.attribute(AttributeNames::sizes).value_or({}));
+        if (source_set.is_empty())
+            return;
+        selected_source = source_set.select_an_image_source().source.url;
+    }
+
+    if (selected_source.is_empty())
+        return;
+
+    auto url = parse_url(selected_source);
+    if (!url.has_value() || m_speculative_fetch_urls.set(*url) != HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& realm = m_document->realm();
+    auto shared_resource_request = SharedResourceRequest::get_or_create(realm, m_document->page(), *url);
+    if (!shared_resource_request->needs_fetching())
+        return;
+
+    // NB: This builds the same request that HTMLImageElement would, so that the image element can adopt our fetch.
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+    auto request = create_potential_CORS_request(realm.vm(), *url, Fetch::Infrastructure::Request::Destination::Image, cors_setting);
+    request->set_client(&m_document->relevant_settings_object());
+    if (!srcset.is_empty())
+        request->set_initiator(Fetch::Infrastructure::Request::Initiator::ImageSet);
+    request->set_referrer_policy(ReferrerPolicy::from_string(token.attribute(AttributeNames::referrerpolicy).value_or({})).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+    request->set_priority(Fetch::Infrastructure::request_priority_from_string(token.attribute(AttributeNames::fetchpriority).value_or({})).value_or(Fetch::Infrastructure::Request::Priority::Auto));
+
+    shared_resource_request->fetch_resource(realm, request);
+    m_image_requests.append(shared_resource_request);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+void HTMLPreloadScanner::speculative_fetch(StringView url_string, Optional<Fetch::Infrastructure::Request::Destination> destination, CORSSettingAttribute cors_setting, HTMLToken const& token)
+{
+    if (url_string.is_empty())
+        return;
+    auto url = parse_url(url_string);
+    if (!url.has_value())
+        return;
+
+    if (m_speculative_fetch_urls.set(*url) != HashSetResult::InsertedNewEntry)
+        return;
+
+    // NB: Only HTTP(S) fetches can be served from the HTTP cache once the element itself fetches them.
+    if (!url->scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    // NB: The request has to match the one the element itself will make for the HTTP cache to be able to serve it.
+    auto& realm = m_document->realm();
+    auto& vm = realm.vm();
+
+    auto request = create_potential_CORS_request(vm, *url, destination, cors_setting);
+    request->set_client(&m_document->relevant_settings_object());
+    request->set_referrer_policy(ReferrerPolicy::from_string(token.attribute(AttributeNames::referrerpolicy).value_or({})).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+    request->set_priority(Fetch::Infrastructure::request_priority_from_string(token.attribute(AttributeNames::fetchpriority).value_or({})).value_or(Fetch::Infrastructure::Request::Priority::Auto));
+    if (auto integrity = token.attribute(AttributeNames::integrity); integrity.has_value())
+        request->set_integrity_metadata(*integrity);
+
+    // NB: The response itself is thrown away. Reading its body to the end is what lets the HTTP cache store it, so that
+    //     the element's own fetch is served from there once the parser reaches it.
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [](GC::Ref<Fetch::Infrastructure::Response>, Fetch::Infrastructure::FetchAlgorithms::BodyBytes) {};
+    (void)Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <AK/Noncopyable.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// Tokenizes the input that the HTML parser hasn't reached yet while it is blocked on a parser-blocking script, and
+// issues speculative fetches for the subresources it finds, so they aren't all serialized behind that script.
+class HTMLPreloadScanner {
+    AK_MAKE_NONCOPYABLE(HTMLPreloadScanner);
+    AK_MAKE_NONMOVABLE(HTMLPreloadScanner);
+
+public:
+    HTMLPreloadScanner(DOM::Document&, StringView input, bool scripting_enabled);
+
+    // Scans the rest of the input. Since no more input is added to it, later calls return immediately.
+    void scan();
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    void process_start_tag(HTMLToken const&);
+    void process_end_tag(HTMLToken const&);
+
+    void speculative_fetch_image(HTMLToken const&);
+    void speculative_fetch(StringView url, Optional<Fetch::Infrastructure::Request::Destination>, CORSSettingAttribute, HTMLToken const&);
+
+    Optional<URL::URL> parse_url(StringView) const;
+
+    GC::Ref<DOM::Document> m_document;
+    HTMLTokenizer m_tokenizer;
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#list-of-speculative-fetch-urls
+    HashTable<URL::URL> m_speculative_fetch_urls;
+
+    // NB: Image elements pick up their shared resource request by URL once the parser reaches them, so we have to keep
+    //     the ones we started alive until then.
+    Vector<GC::Ref<SharedResourceRequest>> m_image_requests;
+
+    Optional<URL::URL> m_base_url;
+    size_t m_template_depth { 0 };
+    size_t m_foreign_content_depth { 0 };
+    bool m_scripting_enabled { true };
+    bool m_is_done { false };
+};
+
+}
@@ -61,7 +61,12 @@ String HTMLToken::to_string() const
 
     if (is_character()) {
         builder.append(" { data: '"sv);
-        builder.append_code_point(code_point());
+        if (is_character_run()) {
+            for (auto code_point : character_run())
+                builder.append_code_point(code_point);
+        } else {
+            builder.append_code_point(code_point());
+        }
         builder.append("' }"sv);
     }
 
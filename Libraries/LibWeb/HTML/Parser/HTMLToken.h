@@ -11,6 +11,7 @@
 #include <AK/Function.h>
 #include <AK/OwnPtr.h>
 #include <AK/Types.h>
+#include <AK/Utf32View.h>
 #include <AK/Variant.h>
 #include <AK/Vector.h>
 #include <LibWeb/Export.h>
@@ -68,6 +69,14 @@ public:
         return token;
     }
 
+    // NB: The run points into the tokenizer's input, so it is only valid until the tokenizer is asked for its next token.
+    static HTMLToken make_character_run(Utf32View run)
+    {
+        HTMLToken token { Type::Character };
+        token.m_data.set(run);
+        return token;
+    }
+
     static HTMLToken make_start_tag(FlyString const& tag_name)
     {
         HTMLToken token { Type::StartTag };
@@ -103,6 +112,14 @@ public:
     bool is_character() const { return m_type == Type::Character; }
     bool is_end_of_file() const { return m_type == Type::EndOfFile; }
 
+    bool is_character_run() const { return is_character() && m_data.has<Utf32View>(); }
+
+    Utf32View character_run() const
+    {
+        VERIFY(is_character_run());
+        return m_data.get<Utf32View>();
+    }
+
     u32 code_point() const
     {
         VERIFY(is_character());
@@ -368,7 +385,7 @@ private:
     // Type::Comment (comment data)
     String m_comment_data;
 
-    Variant<Empty, u32, OwnPtr<DoctypeData>, OwnPtr<Vector<Attribute>>> m_data {};
+    Variant<Empty, u32, Utf32View, OwnPtr<DoctypeData>, OwnPtr<Vector<Attribute>>> m_data {};
 
     Position m_start_position;
     Position m_end_position;
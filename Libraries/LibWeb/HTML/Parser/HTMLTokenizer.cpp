@@ -8,6 +8,7 @@
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -238,6 +239,47 @@ void HTMLTokenizer::skip(size_t count)
     }
 }
 
+// OPTIMIZATION: Returns the offset of the first code point at or after the current offset that is one of the given
+//               delimiters (or the end of the input or insertion point), comparing four code points at a time.
+template<u32... delimiters>
+size_t HTMLTokenizer::find_end_of_run(StopAtInsertionPoint stop_at_insertion_point) const
+{
+    auto offset = static_cast<size_t>(m_current_offset);
+    auto end = m_decoded_input.size();
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.has_value())
+        end = min(end, static_cast<size_t>(*m_insertion_point));
+    if (offset >= end)
+        return offset;
+
+    auto const* input = m_decoded_input.data();
+    for (; offset + 4 <= end; offset += 4) {
+        auto code_points = AK::SIMD::load_unaligned<AK::SIMD::u32x4>(input + offset);
+        auto matches = ((code_points == AK::SIMD::expand4(delimiters)) | ...);
+        if (AK::SIMD::any(matches))
+            return offset + count_trailing_zeroes(static_cast<u32>(AK::SIMD::maskbits(matches)));
+    }
+    for (; offset < end; ++offset) {
+        if (((input[offset] == delimiters) || ...))
+            return offset;
+    }
+    return end;
+}
+
+// OPTIMIZATION: Appends the code points following the current one to the attribute value, up to the next one that the
+//               quoted attribute value states have to look at.
+template<u32 quote>
+void HTMLTokenizer::append_rest_of_attribute_value_run(StopAtInsertionPoint stop_at_insertion_point)
+{
+    auto run_end = find_end_of_run<quote, '&', '\r', 0>(stop_at_insertion_point);
+    auto run_length = run_end - static_cast<size_t>(m_current_offset);
+    if (run_length == 0)
+        return;
+
+    for (size_t i = m_current_offset; i < run_end; ++i)
+        m_current_builder.append_code_point(m_decoded_input[i]);
+    skip(run_length);
+}
+
 Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
 {
     auto it = m_current_offset + offset;
@@ -303,6 +345,19 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
+                    // OPTIMIZATION: Emit everything up to the next code point that this state has to look at as one
+                    //               token. We can only do this if the current code point wasn't a normalized newline.
+                    if (m_emits_character_runs && m_decoded_input[m_prev_offset] == current_input_character.value()) {
+                        auto run_start = static_cast<size_t>(m_prev_offset);
+                        auto run_end = find_end_of_run<'<', '&', '\r', 0>(stop_at_insertion_point);
+                        if (run_end > static_cast<size_t>(m_current_offset)) {
+                            auto token = HTMLToken::make_character_run({ m_decoded_input.data() + run_start, run_end - run_start });
+                            token.set_start_position({}, nth_last_position(0));
+                            skip(run_end - m_current_offset);
+                            m_queued_tokens.enqueue(move(token));
+                            return m_queued_tokens.dequeue();
+                        }
+                    }
                     EMIT_CURRENT_CHARACTER;
                 }
             }
@@ -1316,6 +1371,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    append_rest_of_attribute_value_run<'"'>(stop_at_insertion_point);
                     continue;
                 }
             }
@@ -1348,6 +1404,7 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    append_rest_of_attribute_value_run<'\''>(stop_at_insertion_point);
                     continue;
                 }
             }
@@ -2888,14 +2945,24 @@ HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
     m_source = MUST(decoder->to_utf8(input));
+    // OPTIMIZATION: A UTF-8 string never has more code points than it has bytes, so this is enough capacity to skip the
+    //               capacity checks while decoding the code points.
     m_decoded_input.ensure_capacity(m_source.bytes().size());
     for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+        m_decoded_input.unchecked_append(code_point);
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
 }
 
+String HTMLTokenizer::unconsumed_input() const
+{
+    StringBuilder builder;
+    for (size_t i = m_current_offset; i < m_decoded_input.size(); ++i)
+        builder.append_code_point(m_decoded_input[i]);
+    return builder.to_string_without_validation();
+}
+
 void HTMLTokenizer::parser_did_run(Badge<HTMLParser>)
 {
     // OPTIMIZATION: If we've consumed all input and the insertion point is at the start,
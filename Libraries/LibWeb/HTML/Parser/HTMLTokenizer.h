@@ -127,6 +127,10 @@ public:
         m_state = new_state;
     }
 
+    // OPTIMIZATION: When enabled, runs of plain character data in the data state are emitted as a single character token
+    //               instead of one token per code point. See HTMLToken::make_character_run().
+    void set_emits_character_runs(bool emits_character_runs) { m_emits_character_runs = emits_character_runs; }
+
     void set_blocked(bool b) { m_blocked = b; }
     bool is_blocked() const { return m_blocked; }
 
@@ -143,6 +147,9 @@ public:
     void restore_insertion_point() { m_insertion_point = move(m_old_insertion_point); }
     void update_insertion_point() { m_insertion_point = m_current_offset; }
 
+    // Returns the input that hasn't been tokenized yet.
+    String unconsumed_input() const;
+
     // This permanently cuts off the tokenizer input stream.
     void abort() { m_aborted = true; }
 
@@ -152,6 +159,11 @@ public:
 
 private:
     void skip(size_t count);
+
+    template<u32... delimiters>
+    size_t find_end_of_run(StopAtInsertionPoint) const;
+    template<u32 quote>
+    void append_rest_of_attribute_value_run(StopAtInsertionPoint);
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
@@ -210,6 +222,7 @@ private:
 
     Optional<FlyString> m_last_emitted_start_tag_name;
 
+    bool m_emits_character_runs { false };
     bool m_explicit_eof_inserted { false };
     bool m_has_emitted_eof { false };
 
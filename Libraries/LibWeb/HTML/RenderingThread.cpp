@@ -8,20 +8,34 @@
 #include <LibThreading/Thread.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Painting/AccumulatedVisualContext.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/ParallelRasterizer.h>
 
 namespace Web::HTML {
 
+// What a backing store was last painted with, so we can tell which part of it is out of date.
+struct RasterizedFrame {
+    NonnullRefPtr<Painting::DisplayList> display_list;
+    Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
+    Gfx::IntRect viewport_rect;
+    bool caret_painted { false };
+    Vector<Gfx::IntRect> caret_device_rects;
+};
+
 struct BackingStoreState {
     RefPtr<Gfx::PaintingSurface> front_store;
     RefPtr<Gfx::PaintingSurface> back_store;
     i32 front_bitmap_id { -1 };
     i32 back_bitmap_id { -1 };
+    Optional<RasterizedFrame> front_frame;
+    Optional<RasterizedFrame> back_frame;
 
     void swap()
     {
         AK::swap(front_store, back_store);
         AK::swap(front_bitmap_id, back_bitmap_id);
+        AK::swap(front_frame, back_frame);
     }
 
     bool is_valid() const { return front_store && back_store; }
@@ -30,6 +44,7 @@ struct BackingStoreState {
 struct UpdateDisplayListCommand {
     NonnullRefPtr<Painting::DisplayList> display_list;
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot;
+    bool should_paint_caret { true };
 };
 
 struct UpdateBackingStoresCommand {
@@ -46,6 +61,49 @@ struct ScreenshotCommand {
 
 using CompositorCommand = Variant<UpdateDisplayListCommand, UpdateBackingStoresCommand, ScreenshotCommand>;
 
+static bool scroll_state_snapshots_are_equal(Painting::ScrollStateSnapshotByDisplayList const& a, Painting::ScrollStateSnapshotByDisplayList const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (auto const& it : a) {
+        auto other = b.get(it.key);
+        if (!other.has_value() || *other != it.value)
+            return false;
+    }
+    return true;
+}
+
+// Repainting only part of a backing store relies on the pixels there depending only on the commands overlapping them.
+// That doesn't hold for filters and backdrop filters, which read neighbouring pixels, or for painting surfaces
+// (e.g. <canvas>), whose contents can change without a new display list.
+static bool display_list_can_be_repainted_partially(Painting::DisplayList const& display_list, HashTable<Painting::AccumulatedVisualContext const*>& visited_contexts, bool is_mask)
+{
+    for (auto const& [context, command] : display_list.commands()) {
+        for (auto const* node = context.ptr(); node && !visited_contexts.contains(node); node = node->parent().ptr()) {
+            visited_contexts.set(node);
+            if (auto const* effects = node->data().get_pointer<Painting::EffectsData>(); effects && effects->filter.has_filters())
+                return false;
+        }
+
+        auto can_be_repainted_partially = command.visit(
+            [](Painting::DrawPaintingSurface const&) { return false; },
+            [](Painting::ApplyBackdropFilter const&) { return false; },
+            [](Painting::ApplyEffects const& command) { return !command.filter.has_value(); },
+            // NB: The player doesn't report device rects for carets painted into mask surfaces.
+            [&](Painting::PaintCaret const&) { return !is_mask; },
+            [&](Painting::PaintNestedDisplayList const& command) {
+                return !command.display_list || display_list_can_be_repainted_partially(*command.display_list, visited_contexts, is_mask);
+            },
+            [&](Painting::AddMask const& command) {
+                return !command.display_list || display_list_can_be_repainted_partially(*command.display_list, visited_contexts, true);
+            },
+            [](auto const&) { return true; });
+        if (!can_be_repainted_partially)
+            return false;
+    }
+    return true;
+}
+
 class RenderingThread::ThreadData final : public AtomicRefCounted<ThreadData> {
 public:
     ThreadData(Core::EventLoop& main_thread_event_loop, RenderingThread::PresentationCallback presentation_callback)
@@ -58,6 +116,9 @@ public:
 
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player)
     {
+        // NB: GPU-backed stores are already rasterized in parallel by the GPU.
+        if (player && !player->is_gpu_backed())
+            m_parallel_rasterizer = Painting::ParallelRasterizer::create_if_supported();
         m_skia_player = move(player);
     }
 
@@ -111,18 +172,26 @@ public:
 
                 command->visit(
                     [this](UpdateDisplayListCommand& cmd) {
+                        if (m_cached_display_list.ptr() != cmd.display_list.ptr()) {
+                            HashTable<Painting::AccumulatedVisualContext const*> visited_contexts;
+                            m_cached_display_list_can_be_repainted_partially = display_list_can_be_repainted_partially(*cmd.display_list, visited_contexts, false);
+                        }
                         m_cached_display_list = move(cmd.display_list);
                         m_cached_scroll_state_snapshot = move(cmd.scroll_state_snapshot);
+                        m_should_paint_caret = cmd.should_paint_caret;
                     },
                     [this](UpdateBackingStoresCommand& cmd) {
                         m_backing_stores.front_store = move(cmd.front_store);
                         m_backing_stores.back_store = move(cmd.back_store);
                         m_backing_stores.front_bitmap_id = cmd.front_bitmap_id;
                         m_backing_stores.back_bitmap_id = cmd.back_bitmap_id;
+                        m_backing_stores.front_frame.clear();
+                        m_backing_stores.back_frame.clear();
                     },
                     [this](ScreenshotCommand& cmd) {
                         if (!m_cached_display_list)
                             return;
+                        m_skia_player->set_should_paint_caret(m_should_paint_caret);
                         m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *cmd.target_surface);
                         if (cmd.callback) {
                             invoke_on_main_thread([callback = move(cmd.callback)]() mutable {
@@ -161,7 +230,21 @@ public:
                 }
 
                 if (m_cached_display_list && m_backing_stores.is_valid()) {
-                    m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store);
+                    // OPTIMIZATION: If the back store was painted with the same display list and scroll state, only
+                    //               repaint the parts of it that differ, e.g. a blinking caret.
+                    auto damage_rect = back_store_damage_rect(viewport_rect);
+                    if (!damage_rect.has_value() || !damage_rect->is_empty()) {
+                        auto caret_device_rects = rasterize_into_back_store(damage_rect);
+                        m_backing_stores.back_frame = RasterizedFrame {
+                            .display_list = *m_cached_display_list,
+                            .scroll_state_snapshot = m_cached_scroll_state_snapshot,
+                            .viewport_rect = viewport_rect,
+                            .caret_painted = m_should_paint_caret,
+                            .caret_device_rects = move(caret_device_rects),
+                        };
+                    } else {
+                        m_backing_stores.back_frame->caret_painted = m_should_paint_caret;
+                    }
                     i32 rendered_bitmap_id = m_backing_stores.back_bitmap_id;
                     m_backing_stores.swap();
 
@@ -176,6 +259,43 @@ public:
     }
 
 private:
+    // Paints the current display list into the back store and returns the device rects of its carets.
+    Vector<Gfx::IntRect> rasterize_into_back_store(Optional<Gfx::IntRect> damage_rect)
+    {
+        // OPTIMIZATION: Full repaints of CPU-backed stores are split into bands that are rasterized in parallel.
+        // NB: Only for display lists that can be repainted partially, since every band is a partial repaint, and
+        //     painting surfaces can't be read from several threads at once.
+        if (m_parallel_rasterizer && !damage_rect.has_value() && m_cached_display_list_can_be_repainted_partially) {
+            if (m_parallel_rasterizer->execute(*m_cached_display_list, m_cached_scroll_state_snapshot, *m_backing_stores.back_store, m_should_paint_caret))
+                return m_parallel_rasterizer->caret_device_rects();
+        }
+
+        m_skia_player->set_should_paint_caret(m_should_paint_caret);
+        m_skia_player->execute(*m_cached_display_list, Painting::ScrollStateSnapshotByDisplayList(m_cached_scroll_state_snapshot), *m_backing_stores.back_store, damage_rect);
+        return m_skia_player->caret_device_rects();
+    }
+
+    // Returns the part of the back store that needs repainting for it to show the current frame, or an empty Optional
+    // if all of it does.
+    Optional<Gfx::IntRect> back_store_damage_rect(Gfx::IntRect viewport_rect) const
+    {
+        auto const& back_frame = m_backing_stores.back_frame;
+        if (!back_frame.has_value() || !m_cached_display_list_can_be_repainted_partially)
+            return {};
+        if (back_frame->display_list.ptr() != m_cached_display_list.ptr() || back_frame->viewport_rect != viewport_rect)
+            return {};
+        if (!scroll_state_snapshots_are_equal(back_frame->scroll_state_snapshot, m_cached_scroll_state_snapshot))
+            return {};
+
+        // NB: With the same display list and scroll state, only the caret's blink state can differ.
+        Gfx::IntRect damage_rect;
+        if (back_frame->caret_painted != m_should_paint_caret) {
+            for (auto const& caret_device_rect : back_frame->caret_device_rects)
+                damage_rect.unite(caret_device_rect);
+        }
+        return damage_rect;
+    }
+
     template<typename Invokee>
     void invoke_on_main_thread(Invokee invokee)
     {
@@ -196,8 +316,11 @@ private:
     Queue<CompositorCommand> m_command_queue;
 
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
+    OwnPtr<Painting::ParallelRasterizer> m_parallel_rasterizer;
     RefPtr<Painting::DisplayList> m_cached_display_list;
     Painting::ScrollStateSnapshotByDisplayList m_cached_scroll_state_snapshot;
+    bool m_cached_display_list_can_be_repainted_partially { false };
+    bool m_should_paint_caret { true };
     BackingStoreState m_backing_stores;
 
     Atomic<i32> m_queued_rasterization_tasks { 0 };
@@ -251,9 +374,9 @@ void RenderingThread::set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&&
     m_thread_data->set_skia_player(move(player));
 }
 
-void RenderingThread::update_display_list(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot)
+void RenderingThread::update_display_list(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot, bool should_paint_caret)
 {
-    m_thread_data->enqueue_command(UpdateDisplayListCommand { move(display_list), move(scroll_state_snapshot) });
+    m_thread_data->enqueue_command(UpdateDisplayListCommand { move(display_list), move(scroll_state_snapshot), should_paint_caret });
 }
 
 void RenderingThread::update_backing_stores(RefPtr<Gfx::PaintingSurface> front, RefPtr<Gfx::PaintingSurface> back, i32 front_id, i32 back_id)
@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
@@ -21,6 +22,54 @@ GC_DEFINE_ALLOCATOR(ClassicScript);
 // https://html.spec.whatwg.org/multipage/webappapis.html#creating-a-classic-script
 // https://whatpr.org/html/9893/webappapis.html#creating-a-classic-script
 GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
+{
+    // 2. If scripting is disabled for realm, then set source to the empty string.
+    if (is_scripting_disabled(realm))
+        source = ""sv;
+
+    // NB: Steps 1 and 3 to 9 are shared with create_in_background().
+    auto script = create_without_record(move(filename), realm, move(base_url), muted_errors);
+
+    // 10. Let result be ParseScript(source, realm, script).
+    auto parse_timer = Core::ElapsedTimer::start_new();
+    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number, JS::Script::UseParseTreeCache::Yes);
+    dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
+
+    // NB: Steps 11 and 12 are shared with create_in_background().
+    script->set_record_from_parse_result(move(result));
+
+    // 13. Return script.
+    return script;
+}
+
+void ClassicScript::create_in_background(ByteString filename, String source, JS::Realm& realm, URL::URL base_url, MutedErrors muted_errors, GC::Ref<GC::Function<void(GC::Ref<ClassicScript>)>> on_complete)
+{
+    if (source.bytes().size() < minimum_source_length_for_background_parsing || is_scripting_disabled(realm)) {
+        on_complete->function()(create(move(filename), source, realm, move(base_url), 1, muted_errors));
+        return;
+    }
+
+    auto script = create_without_record(move(filename), realm, move(base_url), muted_errors);
+
+    // 10. Let result be ParseScript(source, realm, script).
+    // NB: Only the parser runs on the background thread. The script record is allocated back on this thread. The
+    //     filename is copied rather than shared, as ByteString's reference count isn't atomic.
+    auto parse_timer = Core::ElapsedTimer::start_new();
+    (void)Threading::BackgroundAction<JS::Script::ParsedText>::construct(
+        [source = move(source), filename = ByteString { script->filename().view() }](auto&) -> ErrorOr<JS::Script::ParsedText> {
+            return JS::Script::parse_text(Utf16String::from_utf8(source.bytes_as_string_view()), filename);
+        },
+        [script = GC::make_root(script), on_complete = GC::make_root(on_complete), parse_timer](JS::Script::ParsedText parsed_text) -> ErrorOr<void> {
+            dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in the background in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
+
+            auto result = JS::Script::create_from_parsed_text(move(parsed_text), script->realm(), script->filename(), script.ptr(), 1, JS::Script::UseParseTreeCache::Yes);
+            script->set_record_from_parse_result(move(result));
+            on_complete->function()(*script);
+            return {};
+        });
+}
+
+GC::Ref<ClassicScript> ClassicScript::create_without_record(ByteString filename, JS::Realm& realm, URL::URL base_url, MutedErrors muted_errors)
 {
     auto& vm = realm.vm();
 
@@ -28,10 +77,6 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
     if (muted_errors == MutedErrors::Yes)
         base_url = URL::about_blank();
 
-    // 2. If scripting is disabled for realm, then set source to the empty string.
-    if (is_scripting_disabled(realm))
-        source = ""sv;
-
     // 3. Let script be a new classic script that this algorithm will subsequently initialize.
     // 4. Set script's realm to realm.
     // 5. Set script's base URL to baseURL.
@@ -48,29 +93,26 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
 
     // FIXME: 9. Record classic script creation time given script and sourceURLForWindowScripts .
 
-    // 10. Let result be ParseScript(source, realm, script).
-    auto parse_timer = Core::ElapsedTimer::start_new();
-    auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
-    dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
+    return script;
+}
 
+void ClassicScript::set_record_from_parse_result(Result<GC::Ref<JS::Script>, Vector<JS::ParserError>> result)
+{
     // 11. If result is a list of errors, then:
     if (result.is_error()) {
         auto& parse_error = result.error().first();
         dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Failed to parse: {}", parse_error.to_string());
 
         // 1. Set script's parse error and its error to rethrow to result[0].
-        script->set_parse_error(JS::SyntaxError::create(realm, parse_error.to_string()));
-        script->set_error_to_rethrow(script->parse_error());
+        set_parse_error(JS::SyntaxError::create(realm(), parse_error.to_string()));
+        set_error_to_rethrow(this->parse_error());
 
         // 2. Return script.
-        return script;
+        return;
     }
 
     // 12. Set script's record to result.
-    script->m_script_record = *result.release_value();
-
-    // 13. Return script.
-    return script;
+    m_script_record = *result.release_value();
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#run-a-classic-script
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGC/Function.h>
 #include <LibJS/Script.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -27,6 +28,10 @@ public:
     };
     static GC::Ref<ClassicScript> create(ByteString filename, StringView source, JS::Realm&, URL::URL base_url, size_t source_line_number = 1, MutedErrors = MutedErrors::No);
 
+    // Like create(), but parses large source text on a background thread. The callback runs on this thread once the
+    // script has been created.
+    static void create_in_background(ByteString filename, String source, JS::Realm&, URL::URL base_url, MutedErrors, GC::Ref<GC::Function<void(GC::Ref<ClassicScript>)>> on_complete);
+
     JS::Script* script_record() { return m_script_record; }
     JS::Script const* script_record() const { return m_script_record; }
 
@@ -41,6 +46,9 @@ public:
 private:
     ClassicScript(URL::URL base_url, ByteString filename, JS::Realm&);
 
+    static GC::Ref<ClassicScript> create_without_record(ByteString filename, JS::Realm&, URL::URL base_url, MutedErrors);
+    void set_record_from_parse_result(Result<GC::Ref<JS::Script>, Vector<JS::ParserError>>);
+
     virtual bool is_classic_script() const final { return true; }
 
     virtual void visit_edges(Cell::Visitor&) override;
@@ -301,9 +301,10 @@ bool is_scripting_enabled(JS::Realm const& realm)
     // The user has not disabled scripting for realm at this time. (User agents may provide users with the option to disable scripting globally, or in a finer-grained manner, e.g., on a per-origin basis, down to the level of individual realms.)
     auto const& document = as<HTML::Window>(realm.global_object()).associated_document();
 
-    // NB: about:settings and about:processes are internal pages using javascript, so we do not consider user configuration for these pages.
+    // NB: about:settings, about:processes and about:memory are internal pages using javascript, so we do not consider user configuration for these pages.
     if (document.url() != URL::about_settings()
         && document.url() != URL::about_processes()
+        && document.url() != URL::about_memory()
         && !document.page().is_scripting_enabled())
         return false;
 
@@ -381,15 +381,22 @@ void fetch_classic_script(GC::Ref<HTMLScriptElement> element, URL::URL const& ur
         //    options, and muted errors.
         // FIXME: Pass options.
         auto response_url = response->url().value_or({});
-        auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url, 1, muted_errors);
-
-        // 8. Run onComplete given script.
-        on_complete->function()(script);
+        ClassicScript::create_in_background(response_url.to_byte_string(), move(source_text), settings_object.realm(), response_url, muted_errors, GC::create_function(settings_object.heap(), [on_complete](GC::Ref<ClassicScript> script) {
+            // 8. Run onComplete given script.
+            on_complete->function()(script);
+        }));
     };
 
     Fetch::Fetching::fetch(element->realm(), request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
 }
 
+static bool is_python_worker_script_response(Optional<MimeSniff::MimeType> const& mime_type, Optional<URL::URL const&> url)
+{
+    if (mime_type.has_value())
+        return mime_type->essence().is_one_of("text/python"sv, "application/x-python"sv);
+    return url.has_value() && url->serialize_path().ends_with_bytes(".py"sv);
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-classic-worker-script
 WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, EnvironmentSettingsObject& fetch_client, Fetch::Infrastructure::Request::Destination destination, EnvironmentSettingsObject& settings_object, PerformTheFetchHook perform_fetch, OnFetchScriptComplete on_complete)
 {
@@ -431,7 +438,10 @@ WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, Envir
         auto maybe_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
         auto mime_type_is_javascript = maybe_mime_type.has_value() && maybe_mime_type->is_javascript();
 
-        if (response->url().has_value() && Fetch::Infrastructure::is_http_or_https_scheme(response->url()->scheme()) && !mime_type_is_javascript) {
+        // NON-STANDARD: Worker scripts served as Python (or named *.py when there is no MIME type) run as Python scripts.
+        auto is_python_worker_script = is_python_worker_script_response(maybe_mime_type, response->url());
+
+        if (response->url().has_value() && Fetch::Infrastructure::is_http_or_https_scheme(response->url()->scheme()) && !mime_type_is_javascript && !is_python_worker_script) {
             auto mime_type_serialized = maybe_mime_type.has_value() ? maybe_mime_type->serialized() : "unknown"_string;
             dbgln("Invalid non-javascript mime type \"{}\" for worker script at {}", mime_type_serialized, response->url().value());
 
@@ -450,6 +460,10 @@ WebIDL::ExceptionOr<void> fetch_classic_worker_script(URL::URL const& url, Envir
         // 5. Let script be the result of creating a classic script using sourceText, settingsObject's realm,
         //    response's URL, and the default classic script fetch options.
         auto response_url = response->url().value_or({});
+        if (is_python_worker_script) {
+            on_complete->function()(PythonScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url));
+            return;
+        }
         auto script = ClassicScript::create(response_url.to_byte_string(), source_text, settings_object.realm(), response_url);
 
         // 6. Run onComplete given script.
@@ -773,20 +787,29 @@ void fetch_single_module_script(JS::Realm& realm,
         // 4. Let moduleScript be null.
         GC::Ptr<JavaScriptModuleScript> module_script;
 
+        // NB: A JavaScript module script may be created asynchronously, so step 10 is run from here.
+        auto set_module_map_entry_and_complete = [&module_map, url, module_type, on_complete](GC::Ptr<JavaScriptModuleScript> script) {
+            // 10. Set moduleMap[(url, moduleType)] to moduleScript, and run onComplete given moduleScript.
+            module_map.set(url, module_type.to_byte_string(), { ModuleMap::EntryType::ModuleScript, script });
+            on_complete->function()(script);
+        };
+
         // FIXME: 5. Let referrerPolicy be the result of parsing the `Referrer-Policy` header given response. [REFERRERPOLICY]
         // FIXME: 6. If referrerPolicy is not the empty string, set options's referrer policy to referrerPolicy.
 
         // 7. If mimeType is a JavaScript MIME type and moduleType is "javascript", then set moduleScript to the result of creating a JavaScript module script given sourceText, moduleMapRealm, response's URL, and options.
         // FIXME: Pass options.
-        if (mime_type.has_value() && mime_type->is_javascript() && module_type == "javascript")
-            module_script = JavaScriptModuleScript::create(url.to_byte_string(), source_text, module_map_realm, response->url().value_or({})).release_value_but_fixme_should_propagate_errors();
+        if (mime_type.has_value() && mime_type->is_javascript() && module_type == "javascript") {
+            JavaScriptModuleScript::create_in_background(url.to_byte_string(), move(source_text), module_map_realm, response->url().value_or({}), GC::create_function(module_map_realm.heap(), [set_module_map_entry_and_complete = move(set_module_map_entry_and_complete)](GC::Ref<JavaScriptModuleScript> script) {
+                set_module_map_entry_and_complete(script);
+            }));
+            return;
+        }
 
         // FIXME: 8. If the MIME type essence of mimeType is "text/css" and moduleType is "css", then set moduleScript to the result of creating a CSS module script given sourceText and settingsObject.
         // FIXME: 9. If mimeType is a JSON MIME type and moduleType is "json", then set moduleScript to the result of creating a JSON module script given sourceText and settingsObject.
 
-        // 10. Set moduleMap[(url, moduleType)] to moduleScript, and run onComplete given moduleScript.
-        module_map.set(url, module_type.to_byte_string(), { ModuleMap::EntryType::ModuleScript, module_script });
-        on_complete->function()(module_script);
+        set_module_map_entry_and_complete(module_script);
     };
 
     if (perform_fetch != nullptr) {
@@ -5,6 +5,7 @@
  */
 
 #include <LibJS/Runtime/ModuleRequest.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/ModuleScript.h>
@@ -38,6 +39,45 @@ WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> JavaScriptModuleScript::cre
     if (HTML::is_scripting_disabled(realm))
         source = ""sv;
 
+    // NB: Steps 2 to 6 are shared with create_in_background().
+    auto script = create_without_record(filename, realm, move(base_url));
+
+    // 7. Let result be ParseModule(source, realm, script).
+    auto result = JS::SourceTextModule::parse(source, realm, filename.view(), script);
+
+    // NB: Steps 8 and 9 are shared with create_in_background().
+    script->set_record_from_parse_result(move(result));
+
+    // 10. Return script.
+    return script;
+}
+
+void JavaScriptModuleScript::create_in_background(ByteString const& filename, String source, JS::Realm& realm, URL::URL base_url, GC::Ref<GC::Function<void(GC::Ref<JavaScriptModuleScript>)>> on_complete)
+{
+    if (source.bytes().size() < minimum_source_length_for_background_parsing || HTML::is_scripting_disabled(realm)) {
+        on_complete->function()(*create(filename, source, realm, move(base_url)).release_value_but_fixme_should_propagate_errors());
+        return;
+    }
+
+    auto script = create_without_record(filename, realm, move(base_url));
+
+    // 7. Let result be ParseModule(source, realm, script).
+    // NB: Only the parser runs on the background thread. The module record is allocated back on this thread. The
+    //     filename is copied rather than shared, as ByteString's reference count isn't atomic.
+    (void)Threading::BackgroundAction<JS::Script::ParsedText>::construct(
+        [source = move(source), filename = ByteString { filename.view() }](auto&) -> ErrorOr<JS::Script::ParsedText> {
+            return JS::SourceTextModule::parse_text(Utf16String::from_utf8(source.bytes_as_string_view()), filename);
+        },
+        [script = GC::make_root(script), on_complete = GC::make_root(on_complete)](JS::Script::ParsedText parsed_text) -> ErrorOr<void> {
+            auto result = JS::SourceTextModule::create_from_parsed_text(move(parsed_text), script->realm(), script->filename(), script.ptr());
+            script->set_record_from_parse_result(move(result));
+            on_complete->function()(*script);
+            return {};
+        });
+}
+
+GC::Ref<JavaScriptModuleScript> JavaScriptModuleScript::create_without_record(ByteString const& filename, JS::Realm& realm, URL::URL base_url)
+{
     // 2. Let script be a new module script that this algorithm will subsequently initialize.
     // 3. Set script's realm to realm.
     // 4. Set script's base URL to baseURL.
@@ -49,26 +89,25 @@ WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> JavaScriptModuleScript::cre
     script->set_parse_error(JS::js_null());
     script->set_error_to_rethrow(JS::js_null());
 
-    // 7. Let result be ParseModule(source, realm, script).
-    auto result = JS::SourceTextModule::parse(source, realm, filename.view(), script);
+    return script;
+}
 
+void JavaScriptModuleScript::set_record_from_parse_result(Result<GC::Ref<JS::SourceTextModule>, Vector<JS::ParserError>> result)
+{
     // 8. If result is a list of errors, then:
     if (result.is_error()) {
         auto& parse_error = result.error().first();
         dbgln("JavaScriptModuleScript: Failed to parse: {}", parse_error.to_string());
 
         // 1. Set script's parse error to result[0].
-        script->set_parse_error(JS::SyntaxError::create(realm, parse_error.to_string()));
+        set_parse_error(JS::SyntaxError::create(realm(), parse_error.to_string()));
 
         // 2. Return script.
-        return script;
+        return;
     }
 
     // 9. Set script's record to result.
-    script->m_record = result.value();
-
-    // 10. Return script.
-    return script;
+    m_record = result.value();
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#run-a-module-script
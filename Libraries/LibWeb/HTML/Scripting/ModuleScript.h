@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGC/Function.h>
 #include <LibJS/SourceTextModule.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/HTML/Scripting/Script.h>
@@ -35,6 +36,10 @@ public:
 
     static WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> create(ByteString const& filename, StringView source, JS::Realm&, URL::URL base_url);
 
+    // Like create(), but parses large source text on a background thread. The callback runs on this thread once the
+    // script has been created.
+    static void create_in_background(ByteString const& filename, String source, JS::Realm&, URL::URL base_url, GC::Ref<GC::Function<void(GC::Ref<JavaScriptModuleScript>)>> on_complete);
+
     enum class PreventErrorReporting {
         Yes,
         No
@@ -49,6 +54,9 @@ protected:
     JavaScriptModuleScript(URL::URL base_url, ByteString filename, JS::Realm&);
 
 private:
+    static GC::Ref<JavaScriptModuleScript> create_without_record(ByteString const& filename, JS::Realm&, URL::URL base_url);
+    void set_record_from_parse_result(Result<GC::Ref<JS::SourceTextModule>, Vector<JS::ParserError>>);
+
     virtual bool is_javascript_module_script() const final { return true; }
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2025, Ladybird Browser Project
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/Bindings/PythonJSBridge.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/PythonAsyncTask.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/WebIDL/CallbackType.h>
+#include <Python.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PythonAsyncTask);
+
+enum class AwaitableKind : u8 {
+    Sleep,
+    Promise,
+};
+
+enum class AwaitableState : u8 {
+    Created,
+    Suspended,
+    Completed,
+};
+
+// The object a coroutine hands to PythonAsyncTask when it awaits a web operation.
+// The first step yields the awaitable itself to the task. Once the task has stored a result or an
+// exception and resumed the coroutine, the next step returns or raises it at the await expression.
+typedef struct {
+    PyObject_HEAD
+        AwaitableKind kind;
+    AwaitableState state;
+    double delay_seconds;
+    GC::Root<JS::Object>* promise;
+    PyObject* result;
+    PyObject* exception;
+} PythonWebAwaitableObject;
+
+static PyTypeObject s_awaitable_type;
+static PyAsyncMethods s_awaitable_async_methods;
+
+static void python_awaitable_dealloc(PythonWebAwaitableObject* self)
+{
+    delete self->promise;
+    Py_XDECREF(self->result);
+    Py_XDECREF(self->exception);
+    Py_TYPE(self)->tp_free((PyObject*)self);
+}
+
+static PyObject* python_awaitable_await(PyObject* self)
+{
+    Py_INCREF(self);
+    return self;
+}
+
+static PyObject* python_awaitable_next(PythonWebAwaitableObject* self)
+{
+    switch (self->state) {
+    case AwaitableState::Created:
+        self->state = AwaitableState::Suspended;
+        Py_INCREF(self);
+        return (PyObject*)self;
+    case AwaitableState::Suspended:
+        PyErr_SetString(PyExc_RuntimeError, "Web awaitable was resumed before it completed");
+        return nullptr;
+    case AwaitableState::Completed:
+        break;
+    }
+
+    if (self->exception) {
+        PyErr_SetObject((PyObject*)Py_TYPE(self->exception), self->exception);
+        return nullptr;
+    }
+
+    // Raise an explicit StopIteration instance so a tuple result isn't unpacked into constructor arguments.
+    PyObject* stop_iteration = PyObject_CallFunctionObjArgs(PyExc_StopIteration, self->result ? self->result : Py_None, nullptr);
+    if (stop_iteration) {
+        PyErr_SetObject(PyExc_StopIteration, stop_iteration);
+        Py_DECREF(stop_iteration);
+    }
+    return nullptr;
+}
+
+static bool setup_awaitable_type()
+{
+    if (s_awaitable_type.tp_name)
+        return true;
+
+    s_awaitable_async_methods.am_await = python_awaitable_await;
+
+    s_awaitable_type.ob_base.ob_base.ob_refcnt = 1;
+    s_awaitable_type.ob_base.ob_base.ob_type = &PyType_Type;
+    s_awaitable_type.tp_name = "web.Awaitable";
+    s_awaitable_type.tp_doc = "Web operation awaitable from Python coroutines";
+    s_awaitable_type.tp_basicsize = sizeof(PythonWebAwaitableObject);
+    s_awaitable_type.tp_flags = Py_TPFLAGS_DEFAULT;
+    s_awaitable_type.tp_dealloc = (destructor)python_awaitable_dealloc;
+    s_awaitable_type.tp_as_async = &s_awaitable_async_methods;
+    s_awaitable_type.tp_iter = PyObject_SelfIter;
+    s_awaitable_type.tp_iternext = (iternextfunc)python_awaitable_next;
+
+    return PyType_Ready(&s_awaitable_type) == 0;
+}
+
+static PythonWebAwaitableObject* create_awaitable(AwaitableKind kind)
+{
+    if (!setup_awaitable_type())
+        return nullptr;
+
+    auto* awaitable = PyObject_New(PythonWebAwaitableObject, &s_awaitable_type);
+    if (!awaitable)
+        return nullptr;
+
+    awaitable->kind = kind;
+    awaitable->state = AwaitableState::Created;
+    awaitable->delay_seconds = 0;
+    awaitable->promise = nullptr;
+    awaitable->result = nullptr;
+    awaitable->exception = nullptr;
+    return awaitable;
+}
+
+static JS::Realm* current_realm_for_python()
+{
+    auto& vm = Bindings::main_thread_vm();
+    if (vm.execution_context_stack().is_empty() || !vm.current_realm()) {
+        PyErr_SetString(PyExc_RuntimeError, "No script is currently running");
+        return nullptr;
+    }
+    return vm.current_realm();
+}
+
+static PyObject* python_web_sleep(PyObject*, PyObject* args)
+{
+    double seconds = 0;
+    if (!PyArg_ParseTuple(args, "d", &seconds)) {
+        return nullptr;
+    }
+
+    auto* awaitable = create_awaitable(AwaitableKind::Sleep);
+    if (!awaitable)
+        return nullptr;
+    awaitable->delay_seconds = max(seconds, 0.0);
+    return (PyObject*)awaitable;
+}
+
+static PyObject* python_web_fetch(PyObject*, PyObject* args, PyObject* kwargs)
+{
+    static char const* keywords[] = { "url", "json", nullptr };
+    char const* url = nullptr;
+    int as_json = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|p", const_cast<char**>(keywords), &url, &as_json)) {
+        return nullptr;
+    }
+
+    auto* realm = current_realm_for_python();
+    if (!realm)
+        return nullptr;
+    auto& vm = realm->vm();
+    auto& global = realm->global_object();
+
+    auto fetch_function = global.get("fetch"_utf16_fly_string);
+    if (fetch_function.is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "fetch() is not available");
+        return nullptr;
+    }
+
+    auto url_string = JS::PrimitiveString::create(vm, MUST(String::from_utf8(StringView { url, strlen(url) })));
+    auto response_promise = JS::call(vm, fetch_function.value(), &global, url_string);
+    if (response_promise.is_error()) {
+        PyErr_SetString(PyExc_RuntimeError, "fetch() failed");
+        return nullptr;
+    }
+
+    // Read the body in the same promise chain, so the coroutine is only resumed once with the decoded body.
+    auto body_method = as_json ? "json"_utf16_fly_string : "text"_utf16_fly_string;
+    auto body_promise = WebIDL::upon_fulfillment(
+        WebIDL::create_resolved_promise(*realm, response_promise.value()),
+        GC::create_function(realm->heap(), [&vm, body_method](JS::Value response) -> WebIDL::ExceptionOr<JS::Value> {
+            return TRY(response.invoke(vm, body_method));
+        }));
+
+    return PythonAsyncTask::create_awaitable_for_promise(*body_promise->promise());
+}
+
+static PyObject* python_web_create_task(PyObject*, PyObject* args)
+{
+    PyObject* coroutine = nullptr;
+    if (!PyArg_ParseTuple(args, "O", &coroutine)) {
+        return nullptr;
+    }
+
+    if (!PyCoro_CheckExact(coroutine)) {
+        PyErr_SetString(PyExc_TypeError, "create_task() expects a coroutine");
+        return nullptr;
+    }
+
+    auto* realm = current_realm_for_python();
+    if (!realm)
+        return nullptr;
+
+    PythonAsyncTask::create(*realm, coroutine)->start();
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef python_async_methods[] = {
+    { "sleep", python_web_sleep, METH_VARARGS, "Suspend the current coroutine for the given number of seconds" },
+    { "fetch", (PyCFunction)(void (*)(void))python_web_fetch, METH_VARARGS | METH_KEYWORDS, "Fetch a URL and return its body as text, or as parsed JSON if json=True" },
+    { "create_task", python_web_create_task, METH_VARARGS, "Run a coroutine on the page's event loop" },
+    { nullptr, nullptr, 0, nullptr } // Sentinel
+};
+
+bool PythonAsyncTask::add_functions_to_module(PyObject* module)
+{
+    if (!setup_awaitable_type())
+        return false;
+    return PyModule_AddFunctions(module, python_async_methods) == 0;
+}
+
+PyObject* PythonAsyncTask::create_awaitable_for_promise(JS::Object& promise)
+{
+    auto* awaitable = create_awaitable(AwaitableKind::Promise);
+    if (!awaitable)
+        return nullptr;
+    awaitable->promise = new GC::Root<JS::Object>(GC::make_root(promise));
+    return (PyObject*)awaitable;
+}
+
+GC::Ref<PythonAsyncTask> PythonAsyncTask::create(JS::Realm& realm, PyObject* coroutine)
+{
+    return realm.heap().allocate<PythonAsyncTask>(realm, WebIDL::create_promise(realm), coroutine);
+}
+
+PythonAsyncTask::PythonAsyncTask(JS::Realm& realm, GC::Ref<WebIDL::Promise> completion_promise, PyObject* coroutine)
+    : m_realm(realm)
+    , m_completion_promise(completion_promise)
+    , m_coroutine(coroutine)
+{
+    Py_INCREF(m_coroutine);
+}
+
+PythonAsyncTask::~PythonAsyncTask()
+{
+    if (!m_coroutine && !m_awaiting && !m_exception_to_throw)
+        return;
+
+    // Acquire GIL before destroying Python objects
+    PyGILState_STATE gstate = PyGILState_Ensure();
+    Py_XDECREF(m_coroutine);
+    Py_XDECREF(m_awaiting);
+    Py_XDECREF(m_exception_to_throw);
+    PyGILState_Release(gstate);
+}
+
+void PythonAsyncTask::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_realm);
+    visitor.visit(m_completion_promise);
+}
+
+void PythonAsyncTask::start()
+{
+    resume();
+}
+
+void PythonAsyncTask::resume()
+{
+    if (!m_coroutine)
+        return;
+
+    prepare_to_run_script(m_realm);
+    PyGILState_STATE gstate = PyGILState_Ensure();
+
+    // The coroutine's frame holds its own reference to the awaitable it is suspended on.
+    Py_CLEAR(m_awaiting);
+
+    PyObject* yielded = nullptr;
+    if (m_exception_to_throw) {
+        PyObject* exception = exchange(m_exception_to_throw, nullptr);
+        yielded = PyObject_CallMethod(m_coroutine, "throw", "O", exception);
+        Py_DECREF(exception);
+    } else {
+        yielded = PyObject_CallMethod(m_coroutine, "send", "O", Py_None);
+    }
+
+    if (yielded) {
+        suspend_on(yielded);
+        Py_DECREF(yielded);
+    } else if (PyErr_ExceptionMatches(PyExc_StopIteration)) {
+        PyObject* error_type = nullptr;
+        PyObject* error_value = nullptr;
+        PyObject* error_traceback = nullptr;
+        PyErr_Fetch(&error_type, &error_value, &error_traceback);
+        PyErr_NormalizeException(&error_type, &error_value, &error_traceback);
+
+        PyObject* result = error_value ? PyObject_GetAttrString(error_value, "value") : nullptr;
+        if (!result) {
+            PyErr_Clear();
+            Py_INCREF(Py_None);
+            result = Py_None;
+        }
+        Py_XDECREF(error_type);
+        Py_XDECREF(error_value);
+        Py_XDECREF(error_traceback);
+
+        finish(result);
+    } else {
+        finish(nullptr);
+    }
+
+    PyGILState_Release(gstate);
+    clean_up_after_running_script(m_realm);
+}
+
+void PythonAsyncTask::suspend_on(PyObject* yielded)
+{
+    auto& realm = *m_realm;
+    GC::Ref<PythonAsyncTask> task = *this;
+
+    // A bare yield (e.g. asyncio.sleep(0)) only gives other tasks a chance to run.
+    if (yielded == Py_None || !PyObject_TypeCheck(yielded, &s_awaitable_type)) {
+        if (yielded != Py_None)
+            m_exception_to_throw = PyObject_CallFunction(PyExc_RuntimeError, "s", "Only web.sleep(), web.fetch() and JavaScript promises can be awaited on the page's event loop");
+        queue_global_task(Task::Source::JavaScriptEngine, realm.global_object(), GC::create_function(realm.heap(), [task] {
+            task->resume();
+        }));
+        return;
+    }
+
+    Py_INCREF(yielded);
+    m_awaiting = yielded;
+
+    auto* awaitable = (PythonWebAwaitableObject*)yielded;
+    switch (awaitable->kind) {
+    case AwaitableKind::Sleep: {
+        // Go through the global's timer list, so sleeping coroutines are throttled and cancelled like JS timers.
+        auto callback_function = JS::NativeFunction::create(
+            realm, [task](JS::VM&) {
+                task->complete_awaitable(JS::js_undefined(), false);
+                return JS::js_undefined();
+            },
+            0, Utf16FlyString {}, &realm);
+        auto callback = realm.heap().allocate<WebIDL::CallbackType>(*callback_function, realm);
+        auto timeout = static_cast<i32>(min(awaitable->delay_seconds * 1000.0, static_cast<double>(NumericLimits<i32>::max())));
+        as<WindowOrWorkerGlobalScopeMixin>(realm.global_object()).set_timeout(callback, timeout, GC::RootVector<JS::Value> { realm.heap() });
+        break;
+    }
+    case AwaitableKind::Promise: {
+        auto promise = WebIDL::create_resolved_promise(realm, awaitable->promise->ptr());
+        WebIDL::react_to_promise(promise,
+            GC::create_function(realm.heap(), [task](JS::Value value) -> WebIDL::ExceptionOr<JS::Value> {
+                task->complete_awaitable(value, false);
+                return JS::js_undefined();
+            }),
+            GC::create_function(realm.heap(), [task](JS::Value reason) -> WebIDL::ExceptionOr<JS::Value> {
+                task->complete_awaitable(reason, true);
+                return JS::js_undefined();
+            }));
+        break;
+    }
+    }
+}
+
+void PythonAsyncTask::complete_awaitable(JS::Value value, bool rejected)
+{
+    PyGILState_STATE gstate = PyGILState_Ensure();
+
+    if (m_awaiting) {
+        auto* awaitable = (PythonWebAwaitableObject*)m_awaiting;
+        awaitable->state = AwaitableState::Completed;
+        if (rejected) {
+            auto message = value.to_string_without_side_effects().to_byte_string();
+            awaitable->exception = PyObject_CallFunction(PyExc_RuntimeError, "s", message.characters());
+        } else {
+            awaitable->result = Bindings::PythonJSBridge::js_to_python(value, m_realm->vm());
+        }
+
+        if (!awaitable->result && !awaitable->exception) {
+            PyErr_Clear();
+            Py_INCREF(Py_None);
+            awaitable->result = Py_None;
+        }
+    }
+
+    PyGILState_Release(gstate);
+    resume();
+}
+
+void PythonAsyncTask::finish(PyObject* result)
+{
+    auto& realm = *m_realm;
+
+    if (result) {
+        WebIDL::resolve_promise(realm, m_completion_promise, Bindings::PythonJSBridge::python_to_js(result, realm));
+        Py_DECREF(result);
+    } else {
+        auto message = "Python coroutine raised an exception"_string;
+
+        PyObject* error_type = nullptr;
+        PyObject* error_value = nullptr;
+        PyObject* error_traceback = nullptr;
+        PyErr_Fetch(&error_type, &error_value, &error_traceback);
+        PyErr_NormalizeException(&error_type, &error_value, &error_traceback);
+        if (error_value) {
+            if (PyObject* error_str = PyObject_Str(error_value)) {
+                if (char const* error_cstr = PyUnicode_AsUTF8(error_str))
+                    message = MUST(String::from_utf8(StringView { error_cstr, strlen(error_cstr) }));
+                Py_DECREF(error_str);
+            }
+        }
+        PyErr_Clear();
+        Py_XDECREF(error_type);
+        Py_XDECREF(error_value);
+        Py_XDECREF(error_traceback);
+
+        // Report the exception like a failed script run; the completion promise is marked as handled so it isn't reported twice.
+        auto error = JS::Error::create(realm, message);
+        WebIDL::mark_promise_as_handled(m_completion_promise);
+        WebIDL::reject_promise(realm, m_completion_promise, error);
+        as<WindowOrWorkerGlobalScopeMixin>(realm.global_object()).report_an_exception(error);
+    }
+
+    Py_CLEAR(m_coroutine);
+}
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025, Ladybird Browser Project
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/ForwardPython.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::HTML {
+
+// Drives a Python coroutine from the HTML event loop.
+// Whenever the coroutine awaits one of the web awaitables (web.sleep(), web.fetch(), a JS promise),
+// it is suspended and later resumed from a task once the awaited operation has completed, so Python
+// code never blocks the WebContent thread while waiting for timers or the network.
+class PythonAsyncTask final : public JS::Cell {
+    GC_CELL(PythonAsyncTask, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PythonAsyncTask);
+
+public:
+    // NOTE: Takes its own reference to the coroutine. The GIL must be held.
+    static GC::Ref<PythonAsyncTask> create(JS::Realm&, PyObject* coroutine);
+
+    virtual ~PythonAsyncTask() override;
+
+    // Runs the coroutine until its first suspension point.
+    void start();
+
+    // Settles with the coroutine's return value, or rejects if it raised.
+    GC::Ref<WebIDL::Promise> completion_promise() const { return m_completion_promise; }
+
+    // Adds sleep(), fetch() and create_task() to the "web" module.
+    static bool add_functions_to_module(PyObject* module);
+
+    // Returns a new reference to an awaitable that completes when the given JS promise settles.
+    static PyObject* create_awaitable_for_promise(JS::Object& promise);
+
+private:
+    PythonAsyncTask(JS::Realm&, GC::Ref<WebIDL::Promise> completion_promise, PyObject* coroutine);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    void resume();
+    void suspend_on(PyObject* yielded);
+    void complete_awaitable(JS::Value, bool rejected);
+    void finish(PyObject* result);
+
+    GC::Ref<JS::Realm> m_realm;
+    GC::Ref<WebIDL::Promise> m_completion_promise;
+    PyObject* m_coroutine { nullptr };
+    PyObject* m_awaiting { nullptr };
+    PyObject* m_exception_to_throw { nullptr };
+};
+
+}
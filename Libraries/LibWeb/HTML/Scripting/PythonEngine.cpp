@@ -171,6 +171,52 @@ bool PythonEngine::is_initialized() {
   return s_initialized;
 }
 
+Optional<PythonEngine::MemoryStatistics> PythonEngine::memory_statistics() {
+  if (!s_initialized) {
+    return {};
+  }
+
+  PyGILState_STATE gstate = PyGILState_Ensure();
+
+  MemoryStatistics statistics;
+
+  // sys.getallocatedblocks() counts the blocks of the object allocator, which is cheap and always available.
+  if (PyObject *sys_module = PyImport_ImportModule("sys")) {
+    if (PyObject *blocks = PyObject_CallMethod(sys_module, "getallocatedblocks", nullptr)) {
+      auto block_count = PyLong_AsSsize_t(blocks);
+      if (block_count >= 0)
+        statistics.allocated_blocks = static_cast<size_t>(block_count);
+      Py_DECREF(blocks);
+    }
+    Py_DECREF(sys_module);
+  }
+
+  // Byte sizes are only known while tracemalloc is tracing, as it's too expensive to leave on otherwise.
+  if (PyObject *tracemalloc_module = PyImport_ImportModule("tracemalloc")) {
+    PyObject *is_tracing = PyObject_CallMethod(tracemalloc_module, "is_tracing", nullptr);
+    if (is_tracing && PyObject_IsTrue(is_tracing) == 1) {
+      if (PyObject *traced_memory = PyObject_CallMethod(tracemalloc_module, "get_traced_memory", nullptr)) {
+        Py_ssize_t current = 0;
+        Py_ssize_t peak = 0;
+        if (PyArg_ParseTuple(traced_memory, "nn", &current, &peak)) {
+          statistics.traced_bytes = static_cast<size_t>(current);
+          statistics.peak_traced_bytes = static_cast<size_t>(peak);
+        }
+        Py_DECREF(traced_memory);
+      }
+    }
+    Py_XDECREF(is_tracing);
+    Py_DECREF(tracemalloc_module);
+  }
+
+  // NB: A memory report must never leave a Python exception behind for the next script to trip over.
+  PyErr_Clear();
+
+  PyGILState_Release(gstate);
+
+  return statistics;
+}
+
 void *PythonEngine::get_main_interpreter_state() {
   if (!s_initialized) {
     return nullptr;
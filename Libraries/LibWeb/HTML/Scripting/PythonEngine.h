@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <AK/Optional.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::HTML {
@@ -15,6 +16,14 @@ class PythonEngine {
 public:
     static void initialize();
     static void shutdown();
+
+    // The interpreter is only started once a document actually uses Python, so that processes without any
+    // Python scripts don't pay for it at startup.
+    static void ensure_initialized()
+    {
+        if (!s_initialized)
+            initialize();
+    }
     
     // Check if Python is initialized
     static bool is_initialized();
@@ -25,7 +34,19 @@ public:
     // Create a new subinterpreter for isolation
     static void* create_subinterpreter();
     static void destroy_subinterpreter(void* subinterpreter);
-    
+
+    struct MemoryStatistics {
+        // Number of memory blocks currently allocated by the interpreter's object allocator.
+        size_t allocated_blocks { 0 };
+
+        // Bytes currently (and at most) allocated by Python code, only known while tracemalloc is tracing.
+        Optional<size_t> traced_bytes;
+        Optional<size_t> peak_traced_bytes;
+    };
+
+    // Returns nothing if the interpreter hasn't been started.
+    static Optional<MemoryStatistics> memory_statistics();
+
 private:
     static bool s_initialized;
 };
@@ -9,6 +9,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
+#include <LibCore/StandardPaths.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
@@ -34,6 +35,52 @@ namespace Web::HTML {
 
 static PythonPackageManager *s_the = nullptr;
 
+static constexpr size_t MAX_CACHED_REQUIREMENTS_FILES = 16;
+
+// PEP 503 name normalization, so "Foo_Bar" and "foo-bar" refer to the same
+// package.
+static String normalized_package_name(String const &name) {
+  StringBuilder builder;
+  for (auto ch : name.bytes_as_string_view()) {
+    if (ch == '_' || ch == '.')
+      builder.append('-');
+    else
+      builder.append(to_ascii_lowercase(ch));
+  }
+  return builder.to_string_without_validation();
+}
+
+// The finder is appended to sys.meta_path, so it is only consulted for modules
+// that no other finder could locate, i.e. ones that may still be installing.
+static constexpr auto import_hook_source = R"~~~(
+import importlib
+import importlib.machinery
+import sys
+
+class PendingPackageFinder:
+    @classmethod
+    def find_spec(cls, name, path=None, target=None):
+        if not wait_for_pending_installs():
+            return None
+        importlib.invalidate_caches()
+        return importlib.machinery.PathFinder.find_spec(name, path, target)
+
+sys.meta_path.append(PendingPackageFinder)
+)~~~";
+
+static PyObject *python_wait_for_pending_installs(PyObject *, PyObject *) {
+  bool waited = false;
+  // pip may take a while; let other Python threads run in the meantime.
+  Py_BEGIN_ALLOW_THREADS
+  waited = PythonPackageManager::the().wait_for_pending_installs();
+  Py_END_ALLOW_THREADS
+  return PyBool_FromLong(waited);
+}
+
+static PyMethodDef s_wait_for_pending_installs_method = {
+    "wait_for_pending_installs", python_wait_for_pending_installs, METH_NOARGS,
+    nullptr};
+
 #ifdef __APPLE__
 // Helper to get app bundle path on macOS
 static Optional<String> get_app_bundle_path() {
@@ -136,11 +183,36 @@ ErrorOr<void> PythonPackageManager::initialize() {
 
   // Set up Python path to include our virtual environment
   TRY(setup_python_path());
+  TRY(install_import_hook());
 
   m_initialized = true;
   return {};
 }
 
+ErrorOr<void> PythonPackageManager::install_import_hook() {
+  PyObject *globals = PyDict_New();
+  if (!globals)
+    return Error::from_string_literal("Failed to create import hook globals");
+
+  PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+  PyObject *wait_function =
+      PyCFunction_New(&s_wait_for_pending_installs_method, nullptr);
+  if (wait_function) {
+    PyDict_SetItemString(globals, "wait_for_pending_installs", wait_function);
+    Py_DECREF(wait_function);
+  }
+
+  PyObject *result =
+      PyRun_String(import_hook_source, Py_file_input, globals, globals);
+  Py_DECREF(globals);
+  if (!result) {
+    PyErr_Clear();
+    return Error::from_string_literal("Failed to install package import hook");
+  }
+  Py_DECREF(result);
+  return {};
+}
+
 ErrorOr<void> PythonPackageManager::setup_python_path() {
   // Add our virtual environment's site-packages directory to Python's sys.path
   String package_path = get_package_install_path();
@@ -166,6 +238,12 @@ ErrorOr<void> PythonPackageManager::setup_python_path() {
         "Failed to create Python string for package path");
   }
 
+  // This runs for every Python script, so avoid growing sys.path each time.
+  if (PySequence_Contains(sys_path, path_string) == 1) {
+    Py_DECREF(path_string);
+    return {};
+  }
+
   int result = PyList_Insert(sys_path, 0, path_string);
   Py_DECREF(path_string);
 
@@ -256,6 +334,17 @@ PythonPackageManager::find_requirements_file(URL::URL const &document_origin) {
 ErrorOr<Vector<PythonPackage>>
 PythonPackageManager::parse_requirements(String const &content,
                                          URL::URL const &document_origin) {
+  auto origin = document_origin.serialize(URL::ExcludeFragment::Yes);
+
+  // The pages of a site usually share one requirements.txt, so each distinct
+  // file is only parsed once.
+  if (auto cached = m_parsed_requirements.get(content); cached.has_value()) {
+    auto packages = *cached;
+    for (auto &package : packages)
+      package.origin = origin;
+    return packages;
+  }
+
   Vector<PythonPackage> packages;
 
   // Parse the requirements.txt file format
@@ -303,6 +392,15 @@ PythonPackageManager::parse_requirements(String const &content,
     if (package_name.is_empty())
       continue;
 
+    // Lines such as "-r other.txt" or "--index-url ..." are pip options, not
+    // packages. Passing them on would let a page change how pip runs.
+    if (package_name.starts_with('-')) {
+      dbgln("🐍 PythonPackageManager: Ignoring requirements option: {}",
+            package_name);
+      lexer.ignore_until([](char ch) { return ch == '\n' || ch == '\r'; });
+      continue;
+    }
+
     // Skip whitespace
     lexer.ignore_while([](char ch) { return ch == ' ' || ch == '\t'; });
 
@@ -333,7 +431,7 @@ PythonPackageManager::parse_requirements(String const &content,
     PythonPackage package{
         .name = package_name,
         .version = version,
-        .origin = document_origin.serialize(URL::ExcludeFragment::Yes)};
+        .origin = origin};
 
     packages.append(package);
     dbgln("🐍 PythonPackageManager: Parsed package requirement: {}{}",
@@ -342,6 +440,10 @@ PythonPackageManager::parse_requirements(String const &content,
                               : String(""_string));
   }
 
+  if (m_parsed_requirements.size() >= MAX_CACHED_REQUIREMENTS_FILES)
+    m_parsed_requirements.take_first();
+  m_parsed_requirements.set(content, packages);
+
   return packages;
 }
 
@@ -352,10 +454,20 @@ PythonPackageManager::install_packages(Vector<PythonPackage> const &packages) {
 
   dbgln("🐍 PythonPackageManager: Installing {} packages", packages.size());
 
-  // Get the origin for caching purposes (assume all packages from same origin)
-  String origin = packages.first().origin;
+  m_installed_packages.set(packages.first().origin, packages);
+
+  auto needs_install = [&](PythonPackage const &package) {
+    return !is_package_installed(package) && !is_package_pending(package);
+  };
+  if (!packages.first_matching(needs_install).has_value()) {
+    dbgln("🐍 PythonPackageManager: All packages already installed");
+    return {};
+  }
+
+  // Installs write to the shared site-packages directory, so only one pip run
+  // may be in flight. It may also have installed some of these packages.
+  wait_for_pending_installs();
 
-  // Check which packages need to be installed
   Vector<PythonPackage> packages_to_install;
   for (auto const &package : packages) {
     if (!is_package_installed(package)) {
@@ -378,23 +490,16 @@ PythonPackageManager::install_packages(Vector<PythonPackage> const &packages) {
   String python_home = get_python_home_path();
 
   // Use python -m pip instead of pip binary (more reliable)
-  auto python_exe_result = String::formatted("{}/bin/python3.14", python_home);
-  if (python_exe_result.is_error())
-    return python_exe_result.release_error();
-  String python_exe = python_exe_result.release_value();
+  auto python_exe = ByteString::formatted("{}/bin/python3.14", python_home);
 
   // Check if python executable exists and pip module is available
-  auto check_command =
-      String::formatted("{} -m pip --version > /dev/null 2>&1", python_exe);
-  if (check_command.is_error()) {
-    dbgln("🐍 PythonPackageManager: Failed to format check command");
-    return check_command.release_error();
+  if (!m_pip_available.has_value()) {
+    auto check_command =
+        ByteString::formatted("{} -m pip --version > /dev/null 2>&1", python_exe);
+    m_pip_available = system(check_command.characters()) == 0;
   }
-  String check_command_str = check_command.release_value();
-  auto check_command_byte_string = check_command_str.to_byte_string();
-  int pip_check = system(check_command_byte_string.characters());
 
-  if (pip_check != 0) {
+  if (!*m_pip_available) {
     dbgln("🐍 PythonPackageManager: pip module not available. "
           "Try running: {} -m ensurepip",
           python_exe);
@@ -403,106 +508,120 @@ PythonPackageManager::install_packages(Vector<PythonPackage> const &packages) {
 
   // Determine the site-packages directory for installation
   // This is typically python_home/lib/pythonX.Y/site-packages
-  auto site_packages_result =
-      String::formatted("{}/lib/python3.14/site-packages", python_home);
-  if (site_packages_result.is_error())
-    return site_packages_result.release_error();
-  String site_packages = site_packages_result.release_value();
+  auto site_packages =
+      ByteString::formatted("{}/lib/python3.14/site-packages", python_home);
+
+  // Downloaded and built wheels are kept in pip's content-addressed cache,
+  // which is shared by all origins. Requirements pinned with --hash are
+  // verified against it.
+  auto wheel_cache = ByteString::formatted(
+      "{}/Ladybird/python-wheels", Core::StandardPaths::cache_directory());
+
+  // Install every package with a single pip run: the interpreter starts once,
+  // dependencies shared between packages are resolved and fetched once, and
+  // no shell is involved, so package specs cannot inject commands.
+  Vector<ByteString> arguments{"-m",
+                               "pip",
+                               "install",
+                               "--upgrade",
+                               "--disable-pip-version-check",
+                               "--target",
+                               site_packages,
+                               "--cache-dir",
+                               wheel_cache,
+                               "--"};
 
-  // Install each package using python -m pip
   for (auto const &package : packages_to_install) {
-    dbgln("🐍 PythonPackageManager: Installing package: {}", package.name);
-
-    StringBuilder command_builder;
-    command_builder.append(python_exe);
-    command_builder.append(" -m pip install --upgrade --target "_string);
-    command_builder.append(site_packages);
-    command_builder.append(" \""_string); // Open quote for package spec
-    command_builder.append(package.name);
+    StringBuilder spec_builder;
+    spec_builder.append(package.name);
 
     if (package.version.has_value()) {
       // Fix the version specifier - remove any spaces or extra characters
-      String version = *package.version;
-      // Remove leading/trailing whitespace
-      auto trimmed_version = version.trim_whitespace();
+      auto trimmed_version = package.version->trim_whitespace();
       if (!trimmed_version.is_error() && !trimmed_version.value().is_empty()) {
         // Check if version already has an operator
         if (!trimmed_version.value().starts_with_bytes("="sv) &&
             !trimmed_version.value().starts_with_bytes(">"sv) &&
             !trimmed_version.value().starts_with_bytes("<"sv) &&
             !trimmed_version.value().starts_with_bytes("~"sv)) {
-          command_builder.append("=="sv);
+          spec_builder.append("=="sv);
         }
-        command_builder.append(trimmed_version.value());
+        spec_builder.append(trimmed_version.value());
       }
     }
 
-    command_builder.append("\""_string); // Close quote for package spec
+    arguments.append(spec_builder.to_byte_string());
+  }
 
-    // Special handling for numpy to avoid installation issues
-    if (package.name == "numpy"_string) {
-      // Add --no-cache-dir to avoid potential cache issues
-      command_builder.append(" --no-cache-dir"_string);
-      // Also add --force-reinstall to ensure a clean installation
-      command_builder.append(" --force-reinstall"_string);
-      // Add --no-deps to avoid dependency conflicts
-      command_builder.append(" --no-deps"_string);
-    }
+  dbgln("🐍 PythonPackageManager: Running {} {}", python_exe,
+        ByteString::join(' ', arguments));
 
-    auto command_result = command_builder.to_string();
-    if (command_result.is_error()) {
-      dbgln("🐍 PythonPackageManager: Failed to build command string");
-      return command_result.release_error();
-    }
-    String command = command_result.release_value();
-    dbgln("🐍 PythonPackageManager: Running command: {}", command);
+  auto process = Core::Process::spawn(python_exe, arguments.span());
+  if (process.is_error()) {
+    dbgln("🐍 PythonPackageManager: Failed to start pip: {}", process.error());
+    return process.release_error();
+  }
 
-    // Execute the pip install command
-    auto command_byte_string = command.to_byte_string();
-    int result = system(command_byte_string.characters());
+  m_pending_install = PendingInstall{.process = process.release_value(),
+                                     .packages = move(packages_to_install)};
+  return {};
+}
 
-    if (result == 0) {
-      dbgln("🐍 PythonPackageManager: Successfully installed package {}",
-            package.name);
-    } else {
-      dbgln("🐍 PythonPackageManager: Failed to install package {} (exit code: "
-            "{})",
-            package.name, result);
-      // Continue with other packages even if one fails
-    }
-  }
+bool PythonPackageManager::wait_for_pending_installs() {
+  if (!m_pending_install.has_value())
+    return false;
 
-  // Update our cache of installed packages
-  m_installed_packages.set(origin, packages);
+  auto pending_install = m_pending_install.release_value();
+  auto exit_code = pending_install.process.wait_for_termination();
+  if (exit_code.is_error() || exit_code.value() != 0) {
+    // Nothing is recorded as installed, so the next page that needs these
+    // packages tries again.
+    dbgln("🐍 PythonPackageManager: Failed to install packages (exit code: {})",
+          exit_code.is_error() ? -1 : exit_code.value());
+    return true;
+  }
 
-  return {};
+  for (auto const &package : pending_install.packages) {
+    dbgln("🐍 PythonPackageManager: Successfully installed package {}",
+          package.name);
+    m_installed_versions.set(normalized_package_name(package.name),
+                             package.version);
+  }
+  return true;
 }
 
 bool PythonPackageManager::is_package_installed(
     PythonPackage const &package) const {
-  // Check if this package is in our installed packages cache
-  auto it = m_installed_packages.find(package.origin);
-  if (it == m_installed_packages.end())
+  auto installed_version =
+      m_installed_versions.get(normalized_package_name(package.name));
+  if (!installed_version.has_value())
     return false;
 
-  // Look for the package in the origin's package list
-  for (auto const &installed_package : it->value) {
-    if (installed_package.name == package.name) {
-      // If version is specified, check if it matches
-      if (package.version.has_value()) {
-        return installed_package.version.has_value() &&
-               installed_package.version == package.version;
-      }
-      return true;
-    }
-  }
+  // If version is specified, check if it matches
+  if (package.version.has_value())
+    return *installed_version == package.version;
+  return true;
+}
+
+bool PythonPackageManager::is_package_pending(
+    PythonPackage const &package) const {
+  if (!m_pending_install.has_value())
+    return false;
 
-  return false;
+  auto name = normalized_package_name(package.name);
+  return m_pending_install->packages.first_matching([&](auto const &pending) {
+    return normalized_package_name(pending.name) == name &&
+           (!package.version.has_value() || pending.version == package.version);
+  }).has_value();
 }
 
 void PythonPackageManager::clear_cache_for_origin(URL::URL const &origin) {
   String origin_key = origin.serialize(URL::ExcludeFragment::Yes);
-  m_installed_packages.remove(origin_key);
+  if (auto packages = m_installed_packages.take(origin_key);
+      packages.has_value()) {
+    for (auto const &package : *packages)
+      m_installed_versions.remove(normalized_package_name(package.name));
+  }
   dbgln("🐍 PythonPackageManager: Cleared cache for origin: {}", origin_key);
 }
 
@@ -10,6 +10,7 @@
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/Vector.h>
+#include <LibCore/Process.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 
@@ -25,19 +26,23 @@ class PythonPackageManager {
 public:
     static PythonPackageManager& the();
 
-    // Initialize the package manager
+    // Initialize the package manager and install the import hook that waits for pending installs
     ErrorOr<void> initialize();
 
     // Check if a requirements.txt file exists for the given document origin
     ErrorOr<Optional<String>> find_requirements_file(URL::URL const& document_origin);
 
-    // Parse a requirements.txt file content
+    // Parse a requirements.txt file content. Each distinct file is only parsed once.
     ErrorOr<Vector<PythonPackage>> parse_requirements(String const& content, URL::URL const& document_origin);
 
-    // Install packages if not already installed
+    // Start installing the packages that are not installed yet, all in one pip run, and return without waiting for it.
+    // An import that no other finder can satisfy waits for the install to finish.
     ErrorOr<void> install_packages(Vector<PythonPackage> const& packages);
 
-    // Check if a package is already installed
+    // Block until the running install (if any) has finished. Returns whether there was anything to wait for.
+    bool wait_for_pending_installs();
+
+    // Check if a package is already installed. Installs are shared by all origins.
     bool is_package_installed(PythonPackage const& package) const;
 
     // Get the installation path for packages
@@ -56,9 +61,28 @@ private:
     // Returns bundled Python path on macOS app builds, Homebrew for development
     String get_python_home_path() const;
 
-    // Cache of installed packages
+    ErrorOr<void> install_import_hook();
+    bool is_package_pending(PythonPackage const& package) const;
+
+    struct PendingInstall {
+        Core::Process process;
+        Vector<PythonPackage> packages;
+    };
+
+    // The pip run that is currently installing packages, if any
+    Optional<PendingInstall> m_pending_install;
+
+    // Installed version specifier for each normalized package name, shared by all origins
+    HashMap<String, Optional<String>> m_installed_versions;
+
+    // Packages requested by each origin
     HashMap<String, Vector<PythonPackage>> m_installed_packages;
 
+    // Parsed requirements, keyed by the requirements.txt content
+    OrderedHashMap<String, Vector<PythonPackage>> m_parsed_requirements;
+
+    Optional<bool> m_pip_available;
+
     // Cache of package installation paths
     HashMap<String, String> m_package_paths;
 
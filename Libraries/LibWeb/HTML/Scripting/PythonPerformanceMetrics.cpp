@@ -4,98 +4,232 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <LibWeb/HTML/Scripting/PythonPerformanceMetrics.h>
+#include <AK/HashMap.h>
+#include <AK/QuickSort.h>
 #include <AK/Time.h>
+#include <LibWeb/HTML/Scripting/PythonPerformanceMetrics.h>
 #include <Python.h>
-#include <sys/time.h>
+#include <frameobject.h>
 #include <sys/resource.h>
+#include <sys/time.h>
+#include <time.h>
 
 namespace Web::HTML {
 
 // Static member initialization
 PythonPerformanceMetrics::ExecutionStats PythonPerformanceMetrics::s_current_stats;
-Optional<MonotonicTime> PythonPerformanceMetrics::s_start_time;
+Optional<PythonPerformanceMetrics::Measurement> PythonPerformanceMetrics::s_current_measurement;
+
+// Process-wide counters fed by the interpreter hooks. Measurements snapshot them to attribute deltas to a run.
+static u64 s_function_calls { 0 };
+static u64 s_gc_collections { 0 };
+static u64 s_gc_pause_ns { 0 };
+static Optional<MonotonicTime> s_gc_start_time;
+
+static bool s_profiler_running { false };
+static Duration s_sampling_interval;
+static Optional<MonotonicTime> s_next_sample_time;
+static HashMap<ByteString, PythonPerformanceMetrics::ProfileSample> s_profile_samples;
+
+static u64 current_thread_cpu_time_ns()
+{
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return 0;
+    return static_cast<u64>(ts.tv_sec) * 1'000'000'000 + static_cast<u64>(ts.tv_nsec);
+}
+
+PythonPerformanceMetrics::Measurement::Measurement()
+    : m_start_time(MonotonicTime::now())
+    , m_start_cpu_time_ns(current_thread_cpu_time_ns())
+    , m_start_function_calls(s_function_calls)
+    , m_start_gc_collections(s_gc_collections)
+    , m_start_gc_pause_ns(s_gc_pause_ns)
+{
+}
+
+Duration PythonPerformanceMetrics::Measurement::wall_time() const
+{
+    return MonotonicTime::now() - m_start_time;
+}
+
+void PythonPerformanceMetrics::Measurement::finish(ExecutionStats& stats)
+{
+    auto wall_time_ns = static_cast<u64>(wall_time().to_nanoseconds());
+    auto cpu_time_ns = current_thread_cpu_time_ns() - m_start_cpu_time_ns;
+
+    stats.execution_time_ns += wall_time_ns;
+    stats.cpu_time_ns += cpu_time_ns;
+    stats.function_calls += s_function_calls - m_start_function_calls;
+    stats.gc_collections += s_gc_collections - m_start_gc_collections;
+    stats.gc_pause_ns += s_gc_pause_ns - m_start_gc_pause_ns;
+    stats.run_count++;
+    if (stats.execution_time_ns > 0)
+        stats.cpu_usage_percent = static_cast<double>(stats.cpu_time_ns) / static_cast<double>(stats.execution_time_ns) * 100.0;
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+        stats.memory_usage_bytes = static_cast<u64>(usage.ru_maxrss) * 1024;
+}
+
+// Called by the gc module with ("start" | "stop", info) around every collection.
+static PyObject* python_gc_callback(PyObject*, PyObject* args)
+{
+    char const* phase = nullptr;
+    PyObject* info = nullptr;
+    if (!PyArg_ParseTuple(args, "sO", &phase, &info))
+        return nullptr;
+
+    if (StringView { phase, strlen(phase) } == "start"sv) {
+        s_gc_start_time = MonotonicTime::now();
+    } else if (s_gc_start_time.has_value()) {
+        s_gc_pause_ns += static_cast<u64>((MonotonicTime::now() - s_gc_start_time.release_value()).to_nanoseconds());
+        s_gc_collections++;
+    }
+
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef s_gc_callback_method = { "_ladybird_gc_callback", python_gc_callback, METH_VARARGS, nullptr };
+
+void PythonPerformanceMetrics::install_interpreter_hooks()
+{
+    static bool s_installed = false;
+    if (s_installed)
+        return;
+    s_installed = true;
+
+    PyObject* gc_module = PyImport_ImportModule("gc");
+    if (!gc_module) {
+        PyErr_Clear();
+        return;
+    }
+
+    PyObject* callbacks = PyObject_GetAttrString(gc_module, "callbacks");
+    PyObject* callback = PyCFunction_New(&s_gc_callback_method, nullptr);
+    if (!callbacks || !callback || PyList_Append(callbacks, callback) < 0)
+        PyErr_Clear();
+
+    Py_XDECREF(callback);
+    Py_XDECREF(callbacks);
+    Py_DECREF(gc_module);
+}
+
+static void record_profile_sample(PyFrameObject* frame)
+{
+#if PY_VERSION_HEX >= 0x03090000
+    PyCodeObject* code = PyFrame_GetCode(frame);
+#else
+    PyCodeObject* code = frame->f_code;
+    Py_INCREF(code);
+#endif
+    char const* filename = PyUnicode_AsUTF8(code->co_filename);
+    char const* function_name = PyUnicode_AsUTF8(code->co_name);
+    int line = PyFrame_GetLineNumber(frame);
+    Py_DECREF(code);
+
+    if (!filename || !function_name) {
+        PyErr_Clear();
+        return;
+    }
+
+    auto key = ByteString::formatted("{}:{}:{}", filename, function_name, line);
+    auto& sample = s_profile_samples.ensure(key, [&] {
+        return PythonPerformanceMetrics::ProfileSample { filename, function_name, line, 0 };
+    });
+    sample.hit_count++;
+}
+
+// A C-level profile hook is far cheaper than a sys.setprofile() Python callable: each call event is a
+// counter increment and a clock read, and code locations are only resolved when a sample is due.
+static int python_profile_hook(PyObject*, PyFrameObject* frame, int what, PyObject*)
+{
+    if (what != PyTrace_CALL)
+        return 0;
+
+    s_function_calls++;
+
+    auto now = MonotonicTime::now_coarse();
+    if (s_next_sample_time.has_value() && now < *s_next_sample_time)
+        return 0;
+    s_next_sample_time = now + s_sampling_interval;
+
+    record_profile_sample(frame);
+    return 0;
+}
+
+void PythonPerformanceMetrics::start_sampling_profiler(Duration interval)
+{
+    s_profile_samples.clear();
+    s_sampling_interval = interval;
+    s_next_sample_time.clear();
+    s_profiler_running = true;
+    PyEval_SetProfile(python_profile_hook, nullptr);
+}
+
+Vector<PythonPerformanceMetrics::ProfileSample> PythonPerformanceMetrics::stop_sampling_profiler()
+{
+    if (s_profiler_running)
+        PyEval_SetProfile(nullptr, nullptr);
+    s_profiler_running = false;
+
+    Vector<ProfileSample> samples;
+    samples.ensure_capacity(s_profile_samples.size());
+    for (auto& it : s_profile_samples)
+        samples.unchecked_append(move(it.value));
+    s_profile_samples.clear();
+
+    quick_sort(samples, [](auto const& a, auto const& b) { return a.hit_count > b.hit_count; });
+    return samples;
+}
+
+bool PythonPerformanceMetrics::is_sampling_profiler_running()
+{
+    return s_profiler_running;
+}
 
 // Start timing a Python execution
 void PythonPerformanceMetrics::start_timing()
 {
-    s_start_time = MonotonicTime::now();
-    
-    // Reset execution stats
-    s_current_stats.function_calls = 0;
-    s_current_stats.gc_collections = 0;
-    
-    // Get initial memory usage
-    update_memory_usage();
+    s_current_stats = {};
+    s_current_measurement = Measurement {};
 }
 
 // End timing a Python execution and return stats
 PythonPerformanceMetrics::ExecutionStats PythonPerformanceMetrics::end_timing()
 {
-    if (s_start_time.has_value()) {
-        auto end_time = MonotonicTime::now();
-        auto duration = end_time - s_start_time.value();
-        s_current_stats.execution_time_ns = static_cast<u64>(duration.to_nanoseconds());
-        s_start_time.clear();
-        
-        // Update final memory and CPU usage
-        update_memory_usage();
-        update_cpu_usage();
-    }
-    
+    if (s_current_measurement.has_value())
+        s_current_measurement.release_value().finish(s_current_stats);
     return s_current_stats;
 }
 
 // Record a Python function call
 void PythonPerformanceMetrics::record_function_call()
 {
-    s_current_stats.function_calls++;
+    s_function_calls++;
 }
 
 // Record a Python garbage collection cycle
 void PythonPerformanceMetrics::record_gc_collection()
 {
-    s_current_stats.gc_collections++;
+    s_gc_collections++;
 }
 
 // Update memory usage statistics
 void PythonPerformanceMetrics::update_memory_usage()
 {
-    // Use Python's memory allocation functions to get actual usage
-    // This is a simplified version - in a real implementation we would use the Python C API
-    // to get the actual memory usage of the Python interpreter
-    
     struct rusage usage;
     if (getrusage(RUSAGE_SELF, &usage) == 0) {
-        // This is just the process memory, not specifically Python's
-        // In a real implementation we'd use PyObject_Size or the gc module
+        // This is the peak process memory, not specifically Python's
         s_current_stats.memory_usage_bytes = static_cast<u64>(usage.ru_maxrss) * 1024;
     }
-    
-    // For a more accurate measurement, we could use Python's sys.getsizeof
-    // on various objects and track allocations/deallocations
 }
 
 // Update CPU usage statistics
 void PythonPerformanceMetrics::update_cpu_usage()
 {
-    struct rusage usage;
-    if (getrusage(RUSAGE_SELF, &usage) == 0) {
-        // Calculate CPU time in seconds
-        double user_time = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1000000.0;
-        double sys_time = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1000000.0;
-        double total_time = user_time + sys_time;
-        
-        // Convert to percentage based on elapsed time
-        if (s_start_time.has_value()) {
-            auto end_time = MonotonicTime::now();
-            auto duration = end_time - s_start_time.value();
-            double elapsed = duration.to_seconds_f64();
-            if (elapsed > 0) {
-                s_current_stats.cpu_usage_percent = (total_time / elapsed) * 100.0;
-            }
-        }
-    }
+    if (s_current_stats.execution_time_ns > 0)
+        s_current_stats.cpu_usage_percent = static_cast<double>(s_current_stats.cpu_time_ns) / static_cast<double>(s_current_stats.execution_time_ns) * 100.0;
 }
 
 // Get current performance statistics
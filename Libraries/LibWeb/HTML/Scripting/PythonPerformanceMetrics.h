@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
+#include <AK/Optional.h>
 #include <AK/Time.h>
 #include <AK/Types.h>
-#include <AK/Optional.h>
+#include <AK/Vector.h>
 
 namespace Web::HTML {
 
@@ -17,26 +19,63 @@ class PythonPerformanceMetrics {
 public:
     struct ExecutionStats {
         u64 execution_time_ns { 0 };
+        u64 cpu_time_ns { 0 };
         u64 memory_usage_bytes { 0 };
         u64 function_calls { 0 };
         u64 gc_collections { 0 };
+        u64 gc_pause_ns { 0 };
+        u64 run_count { 0 };
         double cpu_usage_percent { 0.0 };
     };
-    
-    // Performance tracking methods
+
+    // One entry of the sampling profiler, aggregated per code location.
+    struct ProfileSample {
+        ByteString filename;
+        ByteString function_name;
+        int line { 0 };
+        u64 hit_count { 0 };
+    };
+
+    // Measures a single stretch of Python execution (e.g. one PythonScript::run()) and adds
+    // wall time, thread CPU time, function calls and GC pauses to an ExecutionStats.
+    class Measurement {
+    public:
+        Measurement();
+        void finish(ExecutionStats&);
+
+        Duration wall_time() const;
+
+    private:
+        MonotonicTime m_start_time;
+        u64 m_start_cpu_time_ns { 0 };
+        u64 m_start_function_calls { 0 };
+        u64 m_start_gc_collections { 0 };
+        u64 m_start_gc_pause_ns { 0 };
+    };
+
+    // Installs the gc.callbacks hook that times collections. The GIL must be held.
+    static void install_interpreter_hooks();
+
+    // The sampling profiler hooks Python calls on the current thread and records the running code
+    // location at most once per interval. It also makes function call counts available.
+    static void start_sampling_profiler(Duration interval);
+    static Vector<ProfileSample> stop_sampling_profiler();
+    static bool is_sampling_profiler_running();
+
+    // Legacy process-wide tracking, used by IndependentPythonEngine
     static void start_timing();
     static ExecutionStats end_timing();
     static void record_function_call();
     static void record_gc_collection();
     static void update_memory_usage();
     static void update_cpu_usage();
-    
+
     // Get current statistics
     static ExecutionStats get_current_stats();
-    
+
 private:
     static ExecutionStats s_current_stats;
-    static Optional<MonotonicTime> s_start_time;
+    static Optional<Measurement> s_current_measurement;
 };
 
 } // namespace Web::HTML
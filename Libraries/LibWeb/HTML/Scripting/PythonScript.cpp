@@ -6,17 +6,24 @@
 
 #include <AK/Assertions.h>
 #include <AK/Debug.h>
+#include <AK/HashMap.h>
 #include <AK/TypeCasts.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Realm.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/PythonDOMBindings.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
+#include <LibWeb/HTML/Scripting/PythonAsyncTask.h>
 #include <LibWeb/HTML/Scripting/PythonEngine.h>
+#include <LibWeb/HTML/Scripting/PythonPerformanceMetrics.h>
 #include <LibWeb/HTML/Scripting/PythonScript.h>
 #include <LibWeb/HTML/Scripting/PythonSecurityModel.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/UserTiming/PerformanceMeasure.h>
 #include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/QuotaExceededError.h>
 #include <Python.h>
@@ -26,11 +33,63 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(PythonScript);
 
+// OPTIMIZATION: Compiling a large Python library takes a noticeable amount of time, and the same sources are compiled
+//               again whenever a page is reloaded or includes them more than once. Code objects are immutable, so
+//               every script created from the same source and filename can share one.
+struct CompiledCodeKey {
+    bool operator==(CompiledCodeKey const&) const = default;
+
+    ByteString filename;
+    ByteString source;
+};
+
+}
+
+template<>
+struct AK::Traits<Web::HTML::CompiledCodeKey> : public AK::DefaultTraits<Web::HTML::CompiledCodeKey> {
+    static unsigned hash(Web::HTML::CompiledCodeKey const& key)
+    {
+        return pair_int_hash(key.filename.hash(), key.source.hash());
+    }
+};
+
+namespace Web::HTML {
+
+static constexpr size_t MAX_CACHED_CODE_OBJECTS = 64;
+static OrderedHashMap<CompiledCodeKey, PyObject*> s_compiled_code_cache;
+
+static PyObject* compile_python_source(ByteString const& filename, ByteString const& source)
+{
+    CompiledCodeKey key { filename, source };
+
+    if (auto cached_code = s_compiled_code_cache.get(key); cached_code.has_value()) {
+        dbgln_if(HTML_SCRIPT_DEBUG, "PythonScript: Reusing compiled code for {}", filename);
+        Py_INCREF(*cached_code);
+        return *cached_code;
+    }
+
+    // Allow top-level await; such scripts evaluate to a coroutine that runs on the event loop.
+    PyCompilerFlags flags = _PyCompilerFlags_INIT;
+    flags.cf_flags = PyCF_ALLOW_TOP_LEVEL_AWAIT;
+    PyObject* compiled_code = Py_CompileStringExFlags(source.characters(), filename.characters(), Py_file_input, &flags, -1);
+    if (!compiled_code)
+        return nullptr;
+
+    if (s_compiled_code_cache.size() >= MAX_CACHED_CODE_OBJECTS)
+        Py_DECREF(s_compiled_code_cache.take_first());
+
+    Py_INCREF(compiled_code);
+    s_compiled_code_cache.set(move(key), compiled_code);
+    return compiled_code;
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#creating-a-python-script
 GC::Ref<PythonScript> PythonScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, MutedErrors muted_errors)
 {
     auto& vm = realm.vm();
 
+    PythonEngine::ensure_initialized();
+
     // 1. If muted errors is true, then set baseURL to about:blank.
     if (muted_errors == MutedErrors::Yes)
         base_url = URL::about_blank();
@@ -58,7 +117,7 @@ GC::Ref<PythonScript> PythonScript::create(ByteString filename, StringView sourc
 
     // Convert StringView to Python-compatible string
     auto source_bytes = source.to_byte_string();
-    PyObject* compiled_code = Py_CompileString(source_bytes.characters(), filename.characters(), Py_file_input);
+    PyObject* compiled_code = compile_python_source(filename, source_bytes);
 
     if (!compiled_code) {
         // Handle compilation error
@@ -116,6 +175,7 @@ JS::Completion PythonScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envir
                 dbgln("🐍 PythonScript::run() - Has compiled code, executing...");
                 // Create a new Python thread state to execute the script
                 PyGILState_STATE gstate = PyGILState_Ensure();
+                PythonPerformanceMetrics::install_interpreter_hooks();
 
                 if (!m_execution_context) {
                     m_execution_context = PyDict_New();
@@ -164,20 +224,21 @@ JS::Completion PythonScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envir
                                 Py_DECREF(win_class);
                             }
 
-                            // Expose current window and document instances to Python (no JS bridge)
-                            auto& window_object = HTML::relevant_global_object(realm.global_object());
-                            VERIFY(is<HTML::Window>(window_object));
-                            auto& win = static_cast<HTML::Window&>(window_object);
-                            PyObject* py_window = Bindings::PythonWindow::create_from_cpp_window(win);
-                            if (py_window) {
-                                PyDict_SetItemString(m_execution_context, "window", py_window);
-                                Py_DECREF(py_window);
-                            }
-                            auto& doc = const_cast<DOM::Document&>(*win.document());
-                            PyObject* py_document = Bindings::PythonDocument::create_from_cpp_document(doc);
-                            if (py_document) {
-                                PyDict_SetItemString(m_execution_context, "document", py_document);
-                                Py_DECREF(py_document);
+                            // Expose current window and document instances to Python (no JS bridge).
+                            // Worker scripts have neither, and talk to their owner through web.post_message() instead.
+                            auto& global_object = HTML::relevant_global_object(realm.global_object());
+                            if (auto* win = as_if<HTML::Window>(global_object)) {
+                                PyObject* py_window = Bindings::PythonWindow::create_from_cpp_window(*win);
+                                if (py_window) {
+                                    PyDict_SetItemString(m_execution_context, "window", py_window);
+                                    Py_DECREF(py_window);
+                                }
+                                auto& doc = const_cast<DOM::Document&>(*win->document());
+                                PyObject* py_document = Bindings::PythonDocument::create_from_cpp_document(doc);
+                                if (py_document) {
+                                    PyDict_SetItemString(m_execution_context, "document", py_document);
+                                    Py_DECREF(py_document);
+                                }
                             }
                         }
                     }
@@ -201,9 +262,19 @@ JS::Completion PythonScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envir
                     }
 
                     dbgln("🐍 PythonScript::run() - Calling PyEval_EvalCode...");
+                    auto start_time = HighResolutionTime::current_high_resolution_time(realm.global_object());
+                    auto run_stats_before = m_execution_stats;
+                    auto was_profiling = PythonPerformanceMetrics::is_sampling_profiler_running();
+                    PythonPerformanceMetrics::Measurement measurement;
                     PyObject* result = PyEval_EvalCode(m_script_record, m_execution_context, m_execution_context);
+                    measurement.finish(m_execution_stats);
                     dbgln("🐍 PythonScript::run() - PyEval_EvalCode returned");
 
+                    // NB: Runs are only added to the performance timeline while profiling, as pages that don't ask for
+                    //     them shouldn't pay for an ever-growing list of entries.
+                    if (was_profiling || PythonPerformanceMetrics::is_sampling_profiler_running())
+                        report_execution_to_performance_timeline(start_time, run_stats_before);
+
                     // Flush stdout/stderr after execution to ensure output appears immediately
                     sys_module = PyImport_ImportModule("sys");
                     if (sys_module) {
@@ -251,8 +322,11 @@ JS::Completion PythonScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envir
                     } else {
                         // Execution was successful
                         dbgln("🐍 PythonScript::run() - ✅ Execution successful!");
-                        if (result != Py_None) {
-                            // Currently unused; mark success
+                        // Scripts using top-level await evaluate to a coroutine; hand it to the event loop.
+                        m_async_task = nullptr;
+                        if (PyCoro_CheckExact(result)) {
+                            m_async_task = PythonAsyncTask::create(realm, result);
+                            m_async_task->start();
                         }
                         Py_DECREF(result);
                         evaluation_status = JS::normal_completion(JS::js_undefined());
@@ -314,6 +388,28 @@ JS::Completion PythonScript::run(RethrowErrors rethrow_errors, GC::Ptr<JS::Envir
     }
 }
 
+// Surfaces each run as a "python:<filename>" measure in the performance timeline, so it shows up next to the page's
+// other user timing entries. The detail carries the counters that the wall-clock duration alone does not explain.
+void PythonScript::report_execution_to_performance_timeline(HighResolutionTime::DOMHighResTimeStamp start_time, PythonPerformanceMetrics::ExecutionStats const& stats_before)
+{
+    auto& realm = this->realm();
+    auto& window_or_worker = as<WindowOrWorkerGlobalScopeMixin>(realm.global_object());
+
+    auto duration = HighResolutionTime::current_high_resolution_time(realm.global_object()) - start_time;
+
+    auto detail = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    auto nanoseconds_to_milliseconds = [](u64 nanoseconds) { return JS::Value(static_cast<double>(nanoseconds) / 1'000'000.0); };
+    MUST(detail->create_data_property("cpuTime"_utf16_fly_string, nanoseconds_to_milliseconds(m_execution_stats.cpu_time_ns - stats_before.cpu_time_ns)));
+    MUST(detail->create_data_property("functionCalls"_utf16_fly_string, JS::Value(static_cast<double>(m_execution_stats.function_calls - stats_before.function_calls))));
+    MUST(detail->create_data_property("gcCollections"_utf16_fly_string, JS::Value(static_cast<double>(m_execution_stats.gc_collections - stats_before.gc_collections))));
+    MUST(detail->create_data_property("gcPause"_utf16_fly_string, nanoseconds_to_milliseconds(m_execution_stats.gc_pause_ns - stats_before.gc_pause_ns)));
+
+    auto name = MUST(String::formatted("python:{}", filename()));
+    auto entry = UserTiming::PerformanceMeasure::create(realm, name, start_time, duration, detail);
+    window_or_worker.queue_performance_entry(entry);
+    window_or_worker.add_performance_entry(entry);
+}
+
 PythonScript::PythonScript(URL::URL base_url, ByteString filename, JS::Realm& realm)
     : Script(move(base_url), move(filename), realm)
 {
@@ -336,9 +432,22 @@ PythonScript::~PythonScript()
     }
 }
 
+ErrorOr<JS::Value> PythonScript::execute_async(JS::Realm& realm)
+{
+    auto completion = run(RethrowErrors::Yes);
+    if (completion.is_abrupt())
+        return Error::from_string_literal("Python script raised an exception");
+
+    // Without top-level await the script has already finished running.
+    if (!m_async_task)
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined())->promise();
+    return m_async_task->completion_promise()->promise();
+}
+
 void PythonScript::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visitor.visit(m_async_task);
     // Note: We don't visit m_script_record or m_execution_context since it's a Python object, not a GC object
 }
 
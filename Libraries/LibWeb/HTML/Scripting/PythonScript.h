@@ -10,11 +10,14 @@
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/ForwardPython.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
 #include <LibWeb/HTML/Scripting/Script.h>
 #include <LibWeb/HTML/Scripting/IndependentPythonEngine.h>
 
 namespace Web::HTML {
 
+class PythonAsyncTask;
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#python-script
 class WEB_API PythonScript final : public Script {
     GC_CELL(PythonScript, Script);
@@ -44,12 +47,11 @@ public:
     // Enhanced Python execution with independent engine
     ErrorOr<JS::Value> execute_with_independent_engine();
 
-    // Performance monitoring
-    // TODO: Implement performance metrics
-    // PythonPerformanceMetrics::ExecutionStats get_execution_stats() const;
-    // void reset_performance_stats();
+    // Performance monitoring, accumulated over every run() of this script.
+    PythonPerformanceMetrics::ExecutionStats const& execution_stats() const { return m_execution_stats; }
+    void reset_performance_stats() { m_execution_stats = {}; }
 
-    // Async support
+    // Async support: runs the script and returns a promise that settles once its top-level coroutine (if any) finishes.
     ErrorOr<JS::Value> execute_async(JS::Realm& realm);
 
 private:
@@ -59,14 +61,19 @@ private:
 
     virtual void visit_edges(Cell::Visitor&) override;
 
+    void report_execution_to_performance_timeline(HighResolutionTime::DOMHighResTimeStamp start_time, PythonPerformanceMetrics::ExecutionStats const& stats_before);
+
     PyObject* m_script_record { nullptr };
     PyObject* m_execution_context { nullptr };
     MutedErrors m_muted_errors { MutedErrors::No };
 
     // Independent Python engine
     OwnPtr<IndependentPythonEngine> m_independent_engine;
-    // TODO: Implement performance metrics
-    // PythonPerformanceMetrics::ExecutionStats m_execution_stats;
+
+    // Drives the script's top-level coroutine when it uses top-level await.
+    GC::Ptr<PythonAsyncTask> m_async_task;
+
+    PythonPerformanceMetrics::ExecutionStats m_execution_stats;
 };
 
 }
\ No newline at end of file
@@ -18,6 +18,10 @@
 #include <Python.h>
 #include <cmath>
 
+#if defined(AK_OS_UNIX)
+#    include <unistd.h>
+#endif
+
 namespace Web::HTML {
 
 namespace {
@@ -142,34 +146,58 @@ static PyObject* restricted_open_func([[maybe_unused]] PyObject* self, [[maybe_u
     return nullptr;
 }
 
-Vector<String> dangerous_patterns()
+constexpr Array dangerous_patterns = {
+    "__import__"sv,
+    "eval("sv,
+    "exec("sv,
+    "globals("sv,
+    "locals("sv,
+    "getattr("sv,
+    "setattr("sv,
+    "delattr("sv,
+    "open("sv,
+    "compile("sv,
+    "input("sv,
+    "subprocess"sv,
+    "ctypes"sv,
+    "os.system"sv,
+    "sys.modules"sv,
+    "importlib"sv,
+    "__class__"sv,
+    "__bases__"sv,
+    "__subclasses__"sv,
+    "builtins.__dict__"sv,
+};
+
+// Buckets the deny patterns by their first byte, so checking a script is a single pass over its source that only
+// compares the few patterns that can start at each position, instead of one full scan per pattern.
+class DangerousPatternMatcher {
+public:
+    DangerousPatternMatcher()
+    {
+        for (auto pattern : dangerous_patterns)
+            m_patterns_by_first_byte[static_cast<u8>(pattern[0])].append(pattern);
+    }
+
+    bool matches(StringView code) const
+    {
+        for (size_t i = 0; i < code.length(); ++i) {
+            for (auto pattern : m_patterns_by_first_byte[static_cast<u8>(code[i])]) {
+                if (code.substring_view(i).starts_with(pattern))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    Array<Vector<StringView>, 256> m_patterns_by_first_byte;
+};
+
+DangerousPatternMatcher const& dangerous_pattern_matcher()
 {
-    Vector<String> patterns;
-    patterns.ensure_capacity(20);
-    auto append_literal = [&](StringView literal) {
-        patterns.unchecked_append(MUST(String::from_utf8(literal)));
-    };
-    append_literal("__import__"sv);
-    append_literal("eval("sv);
-    append_literal("exec("sv);
-    append_literal("globals("sv);
-    append_literal("locals("sv);
-    append_literal("getattr("sv);
-    append_literal("setattr("sv);
-    append_literal("delattr("sv);
-    append_literal("open("sv);
-    append_literal("compile("sv);
-    append_literal("input("sv);
-    append_literal("subprocess"sv);
-    append_literal("ctypes"sv);
-    append_literal("os.system"sv);
-    append_literal("sys.modules"sv);
-    append_literal("importlib"sv);
-    append_literal("__class__"sv);
-    append_literal("__bases__"sv);
-    append_literal("__subclasses__"sv);
-    append_literal("builtins.__dict__"sv);
-    return patterns;
+    static DangerousPatternMatcher matcher;
+    return matcher;
 }
 
 Vector<String> default_allowed_modules()
@@ -213,12 +241,69 @@ bool host_matches(StringView host, StringView pattern)
     return false;
 }
 
+// Builds the __builtins__ dictionary handed to scripts: the safe subset of the real builtins, plus an open() that
+// always raises. Returns a new reference.
+PyObject* create_safe_builtins()
+{
+    PyObject* builtins_module = PyEval_GetBuiltins();
+    if (!builtins_module)
+        return nullptr;
+
+    PyObject* safe_builtins = PyDict_New();
+    if (!safe_builtins)
+        return nullptr;
+
+    for (auto const& name : default_safe_builtins()) {
+        auto name_bytes = name.to_byte_string();
+        if (PyObject* builtin = PyDict_GetItemString(builtins_module, name_bytes.characters()))
+            PyDict_SetItemString(safe_builtins, name_bytes.characters(), builtin);
+    }
+
+    // Create a restricted 'open' function that raises an error when called
+    // This allows Python's internal code to check for 'open' without KeyError,
+    // but prevents user code from actually using it
+    static PyMethodDef restricted_open_method = {
+        "open",
+        (PyCFunction)restricted_open_func,
+        METH_VARARGS,
+        "Restricted: open() is not allowed"
+    };
+
+    PyObject* restricted_open = PyCFunction_New(&restricted_open_method, nullptr);
+    if (restricted_open) {
+        // Note: The global builtins module already has the restricted 'open' set up
+        // during Python initialization, so we just need to add it to the execution context
+        PyDict_SetItemString(safe_builtins, "open", restricted_open);
+        Py_DECREF(restricted_open);
+    }
+
+    return safe_builtins;
+}
+
+#if defined(AK_OS_UNIX)
+void rearm_cpu_alarm(u32 max_ms)
+{
+    alarm(static_cast<unsigned>(std::ceil(static_cast<double>(max_ms) / 1000.0)));
+}
+#endif
+
 } // namespace
 
 bool PythonSecurityModel::s_security_initialized = false;
-HashMap<String, HashTable<String>> PythonSecurityModel::s_origin_allowed_modules;
+HashMap<String, PythonSecurityModel::OriginPolicy> PythonSecurityModel::s_origin_policies;
 HashTable<String> PythonSecurityModel::s_safe_domains;
-HashMap<String, PythonSecurityModel::ResourceLimits> PythonSecurityModel::s_origin_resource_limits;
+
+// OPTIMIZATION: The restricted builtins are identical for every script, so they are built once and each script's
+//               globals receive a shallow copy. Copying keeps scripts from observing each other's changes.
+static PyObject* s_safe_builtins_template = nullptr;
+
+// OPTIMIZATION: Large scripts and libraries are checked again on every page load, so verdicts are remembered. Keying
+//               on the source itself rather than on a bare hash means a collision can never pass unsafe code.
+static constexpr size_t MAX_CACHED_CODE_SAFETY_VERDICTS = 256;
+static OrderedHashMap<String, bool> s_code_safety_cache;
+
+// The resource limits are process-wide, so only changes to them need to be applied.
+static Optional<PythonSecurityModel::ResourceLimits> s_applied_resource_limits;
 
 ErrorOr<void> PythonSecurityModel::initialize_security()
 {
@@ -230,14 +315,10 @@ ErrorOr<void> PythonSecurityModel::initialize_security()
     s_safe_domains.set(MUST(String::from_utf8("127.0.0.1"sv)));
     s_safe_domains.set(MUST(String::from_utf8("0.0.0.0"sv)));
 
-    auto default_modules = default_allowed_modules();
-    HashTable<String> module_table;
-    for (auto const& module : default_modules)
-        module_table.set(module);
-    s_origin_allowed_modules.set(default_origin_key(), move(module_table));
-
-    ResourceLimits default_limits;
-    s_origin_resource_limits.set(default_origin_key(), default_limits);
+    OriginPolicy default_policy;
+    for (auto const& module : default_allowed_modules())
+        default_policy.allowed_modules.set(module);
+    s_origin_policies.set(default_origin_key(), move(default_policy));
 
     s_security_initialized = true;
     return {};
@@ -299,11 +380,7 @@ ErrorOr<void> PythonSecurityModel::setup_sandboxed_environment(void* globals_ptr
     // Apply basic FS restrictions to neutralize obvious modules/APIs regardless of imports
     TRY(setup_restricted_filesystem_access(globals_ptr));
 
-    auto limits = s_origin_resource_limits.get(normalize_origin(origin));
-    if (!limits.has_value())
-        limits = s_origin_resource_limits.get(default_origin_key());
-    VERIFY(limits.has_value());
-    TRY(set_resource_limits(globals_ptr, *limits));
+    TRY(set_resource_limits(globals_ptr, policy_for_origin(origin).limits));
 
     return {};
 }
@@ -313,44 +390,17 @@ ErrorOr<void> PythonSecurityModel::restrict_builtins(void* globals_ptr)
     if (!globals_ptr)
         return Error::from_string_literal("Invalid Python globals");
 
-    auto* globals = static_cast<PyObject*>(globals_ptr);
-    PyObject* builtins_module = PyEval_GetBuiltins();
-    if (!builtins_module)
-        return Error::from_string_literal("Failed to retrieve Python builtins");
+    if (!s_safe_builtins_template) {
+        s_safe_builtins_template = create_safe_builtins();
+        if (!s_safe_builtins_template)
+            return Error::from_string_literal("Failed to create safe builtins dictionary");
+    }
 
-    PyObject* safe_builtins = PyDict_New();
+    PyObject* safe_builtins = PyDict_Copy(s_safe_builtins_template);
     if (!safe_builtins)
         return Error::from_string_literal("Failed to create safe builtins dictionary");
 
-    auto safe_names = default_safe_builtins();
-    for (auto const& name : safe_names) {
-        auto name_bytes = name.to_byte_string();
-        PyObject* builtin = PyDict_GetItemString(builtins_module, name_bytes.characters());
-        if (builtin) {
-            Py_INCREF(builtin);
-            PyDict_SetItemString(safe_builtins, name_bytes.characters(), builtin);
-        }
-    }
-
-    // Create a restricted 'open' function that raises an error when called
-    // This allows Python's internal code to check for 'open' without KeyError,
-    // but prevents user code from actually using it
-    static PyMethodDef restricted_open_method = {
-        "open",
-        (PyCFunction)restricted_open_func,
-        METH_VARARGS,
-        "Restricted: open() is not allowed"
-    };
-
-    PyObject* restricted_open = PyCFunction_New(&restricted_open_method, nullptr);
-    if (restricted_open) {
-        // Add to the execution context's __builtins__
-        // Note: The global builtins module already has the restricted 'open' set up
-        // during Python initialization, so we just need to add it to the execution context
-        PyDict_SetItemString(safe_builtins, "open", restricted_open);
-        Py_DECREF(restricted_open);
-    }
-
+    auto* globals = static_cast<PyObject*>(globals_ptr);
     PyDict_SetItemString(globals, "__builtins__", safe_builtins);
     Py_DECREF(safe_builtins);
     return {};
@@ -360,17 +410,18 @@ ErrorOr<bool> PythonSecurityModel::should_allow_module_import(String const& modu
 {
     TRY(initialize_security());
 
-    auto modules = get_allowed_modules(origin);
-    for (auto const& allowed : modules) {
-        if (module_name == allowed)
-            return true;
-        auto module_view = module_name.bytes_as_string_view();
-        auto allowed_view = allowed.bytes_as_string_view();
-        if (module_view.starts_with(allowed_view) && module_view.length() > allowed_view.length() && module_view[allowed_view.length()] == '.')
+    auto const& allowed_modules = policy_for_origin(origin).allowed_modules;
+
+    // Submodules of an allowed package are allowed too, so look up "a.b.c", then "a.b", then "a".
+    auto module_view = module_name.bytes_as_string_view();
+    while (true) {
+        if (allowed_modules.contains(module_view))
             return true;
+        auto last_dot = module_view.find_last('.');
+        if (!last_dot.has_value())
+            return false;
+        module_view = module_view.substring_view(0, *last_dot);
     }
-
-    return false;
 }
 
 ErrorOr<void> PythonSecurityModel::setup_restricted_filesystem_access(void* interpreter)
@@ -415,13 +466,24 @@ ErrorOr<void> PythonSecurityModel::set_resource_limits(void* interpreter, Resour
     if (!interpreter)
         return Error::from_string_literal("Invalid interpreter");
 
-    TRY(setup_memory_limiter(interpreter, limits.max_memory_bytes));
-    TRY(setup_cpu_limiter(interpreter, limits.max_cpu_time_ms));
+    // OPTIMIZATION: Applying the limits compiles and runs several snippets of Python. Since they are process-wide,
+    //               doing that again for every script only repeats what is already in effect.
+    if (!s_applied_resource_limits.has_value() || *s_applied_resource_limits != limits) {
+        TRY(setup_memory_limiter(interpreter, limits.max_memory_bytes));
+        TRY(setup_cpu_limiter(interpreter, limits.max_cpu_time_ms));
+
+        auto recursion_command = MUST(String::formatted("import sys; sys.setrecursionlimit({})", limits.max_recursion_depth));
+        auto recursion_c_string = recursion_command.to_byte_string();
+        if (PyRun_SimpleString(recursion_c_string.characters()) != 0)
+            return Error::from_string_literal("Failed to set recursion limit");
+
+        s_applied_resource_limits = limits;
+    }
 
-    auto recursion_command = MUST(String::formatted("import sys; sys.setrecursionlimit({})", limits.max_recursion_depth));
-    auto recursion_c_string = recursion_command.to_byte_string();
-    if (PyRun_SimpleString(recursion_c_string.characters()) != 0)
-        return Error::from_string_literal("Failed to set recursion limit");
+#if defined(AK_OS_UNIX)
+    // The CPU time alarm covers a single run, so it is re-armed every time.
+    rearm_cpu_alarm(limits.max_cpu_time_ms);
+#endif
 
     return {};
 }
@@ -434,11 +496,15 @@ ErrorOr<void> PythonSecurityModel::add_safe_domain(String const& domain)
 
 ErrorOr<bool> PythonSecurityModel::is_code_safe(String const& code)
 {
-    for (auto const& pattern : dangerous_patterns()) {
-        if (code.contains(pattern.bytes_as_string_view(), CaseSensitivity::CaseSensitive))
-            return false;
-    }
-    return true;
+    if (auto cached_verdict = s_code_safety_cache.get(code); cached_verdict.has_value())
+        return *cached_verdict;
+
+    bool is_safe = !dangerous_pattern_matcher().matches(code.bytes_as_string_view());
+
+    if (s_code_safety_cache.size() >= MAX_CACHED_CODE_SAFETY_VERDICTS)
+        s_code_safety_cache.take_first();
+    s_code_safety_cache.set(code, is_safe);
+    return is_safe;
 }
 
 ErrorOr<bool> PythonSecurityModel::check_against_csp(String const& code, URL::URL const& origin)
@@ -450,24 +516,25 @@ ErrorOr<bool> PythonSecurityModel::check_against_csp(String const& code, URL::UR
 
 Vector<String> PythonSecurityModel::get_allowed_modules(URL::URL const& origin)
 {
-    auto origin_key = normalize_origin(origin);
-    if (auto entry = s_origin_allowed_modules.get(origin_key); entry.has_value()) {
-        Vector<String> modules;
-        modules.ensure_capacity(entry->size());
-        for (auto const& module : *entry)
-            modules.append(module);
-        return modules;
-    }
+    auto const& allowed_modules = policy_for_origin(origin).allowed_modules;
 
     Vector<String> modules;
-    if (auto default_entry = s_origin_allowed_modules.get(default_origin_key()); default_entry.has_value()) {
-        modules.ensure_capacity(default_entry->size());
-        for (auto const& module : *default_entry)
-            modules.append(module);
-    }
+    modules.ensure_capacity(allowed_modules.size());
+    for (auto const& module : allowed_modules)
+        modules.unchecked_append(module);
     return modules;
 }
 
+PythonSecurityModel::OriginPolicy const& PythonSecurityModel::policy_for_origin(URL::URL const& origin)
+{
+    if (auto it = s_origin_policies.find(normalize_origin(origin)); it != s_origin_policies.end())
+        return it->value;
+
+    auto it = s_origin_policies.find(default_origin_key());
+    VERIFY(it != s_origin_policies.end());
+    return it->value;
+}
+
 HashMap<String, double> PythonSecurityModel::get_resource_usage(void* interpreter)
 {
     (void)interpreter;
@@ -508,12 +575,10 @@ ErrorOr<void> PythonSecurityModel::setup_cpu_limiter(void*, u32 max_ms)
 {
 #if defined(AK_OS_UNIX)
     double seconds = static_cast<double>(max_ms) / 1000.0;
-    auto rounded = static_cast<unsigned>(std::ceil(seconds));
     String command = MUST(String::formatted(
-        "import resource, signal, threading; "
-        "resource.setrlimit(resource.RLIMIT_CPU, ({}, {})); "
-        "signal.alarm({})",
-        seconds, seconds, rounded));
+        "import resource; "
+        "resource.setrlimit(resource.RLIMIT_CPU, ({}, {}))",
+        seconds, seconds));
     auto command_c_str = command.to_byte_string();
     if (PyRun_SimpleString(command_c_str.characters()) != 0)
         return Error::from_string_literal("Failed to configure CPU limiter");
@@ -7,8 +7,8 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/String.h>
 #include <AK/HashTable.h>
+#include <AK/String.h>
 #include <LibURL/Origin.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
@@ -50,6 +50,8 @@ public:
         u32 max_stack_depth { 1000 };
         u32 max_recursion_depth { 100 };
         u32 max_module_imports { 50 };
+
+        bool operator==(ResourceLimits const&) const = default;
     };
 
     // Set resource limits for Python execution
@@ -58,7 +60,7 @@ public:
     // Add a safe domain for cross-origin requests
     static ErrorOr<void> add_safe_domain(String const& domain);
 
-    // Check if code contains potentially dangerous patterns
+    // Check if code contains potentially dangerous patterns. Verdicts are cached by source.
     static ErrorOr<bool> is_code_safe(String const& code);
 
     // Content Security Policy integration
@@ -71,10 +73,17 @@ public:
     static HashMap<String, double> get_resource_usage(void* interpreter);
 
 private:
+    // Everything the sandbox needs to know about one origin, resolved once and then looked up by hash.
+    struct OriginPolicy {
+        HashTable<String> allowed_modules;
+        ResourceLimits limits;
+    };
+
+    static OriginPolicy const& policy_for_origin(URL::URL const& origin);
+
     static bool s_security_initialized;
-    static HashMap<String, HashTable<String>> s_origin_allowed_modules;
+    static HashMap<String, OriginPolicy> s_origin_policies;
     static HashTable<String> s_safe_domains;
-    static HashMap<String, ResourceLimits> s_origin_resource_limits;
 
     // Helper methods
     static ErrorOr<bool> check_code_for_dangerous_patterns(String const& code);
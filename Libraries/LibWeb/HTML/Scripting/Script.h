@@ -14,6 +14,11 @@
 
 namespace Web::HTML {
 
+// OPTIMIZATION: Parsing is the expensive part of creating a script, and it doesn't touch the JS heap. Scripts with at
+//               least this much source text are parsed on a background thread, so the event loop can keep handling
+//               input meanwhile. Smaller scripts aren't worth the round trip.
+static constexpr size_t minimum_source_length_for_background_parsing = 64 * KiB;
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#concept-script
 // https://whatpr.org/html/9893/webappapis.html#concept-script
 class WEB_API Script
@@ -62,7 +62,9 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
     }
+    visitor.visit(m_partial_image_data_callbacks);
     visitor.visit(m_image_data);
+    visitor.visit(m_partial_image_data);
 }
 
 GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
@@ -103,6 +105,26 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
             return;
         }
 
+        // OPTIMIZATION: A baseline JPEG can be decoded from any prefix of its data, which gives us the top part of the
+        //               image while the rest is still downloading. So we read JPEGs incrementally and decode what we have
+        //               received so far whenever that has doubled in size.
+        auto extracted_mime_type = Fetch::Infrastructure::extract_mime_type(response->header_list());
+        if (extracted_mime_type.has_value() && extracted_mime_type->essence() == "image/jpeg"sv) {
+            auto process_body_chunk = GC::create_function(heap(), [this](ByteBuffer chunk) {
+                if (m_received_data.try_append(chunk.bytes()).is_error()) {
+                    handle_failed_fetch();
+                    return;
+                }
+                decode_partial_image_data_if_needed();
+            });
+            auto process_end_of_body = GC::create_function(heap(), [this, process_body]() {
+                process_body->function()(move(m_received_data));
+            });
+
+            response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
+            return;
+        }
+
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -139,6 +161,50 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
     m_callbacks.append(move(callbacks));
 }
 
+void SharedResourceRequest::add_partial_image_data_callback(Function<void()> callback)
+{
+    if (m_state == State::Finished || m_state == State::Failed)
+        return;
+    m_partial_image_data_callbacks.append(GC::create_function(vm().heap(), move(callback)));
+}
+
+// NB: We don't bother for anything smaller than this, since it's likely to arrive in full soon after.
+static constexpr size_t minimum_partial_image_data_size = 64 * KiB;
+
+void SharedResourceRequest::decode_partial_image_data_if_needed()
+{
+    if (m_partial_decode_in_progress || m_partial_image_data_callbacks.is_empty())
+        return;
+    if (m_received_data.size() < max(m_next_partial_decode_size, minimum_partial_image_data_size))
+        return;
+
+    m_next_partial_decode_size = m_received_data.size() * 2;
+    m_partial_decode_in_progress = true;
+
+    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+        strong_this->m_partial_decode_in_progress = false;
+        // NB: The whole resource may have been decoded in the meantime.
+        if (strong_this->m_state != State::Fetching || result.frames.is_empty() || !result.frames.first().bitmap)
+            return {};
+
+        Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+        frames.append(AnimatedBitmapDecodedImageData::Frame {
+            .bitmap = Gfx::ImmutableBitmap::create(*result.frames.first().bitmap, result.color_space),
+            .duration = 0,
+        });
+        strong_this->m_partial_image_data = TRY(AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), 0, false));
+        for (auto& callback : strong_this->m_partial_image_data_callbacks)
+            callback->function()();
+        return {};
+    };
+
+    auto handle_failed_decode = [strong_this = GC::Root(*this)](Error&) -> void {
+        strong_this->m_partial_decode_in_progress = false;
+    };
+
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(m_received_data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+}
+
 void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string, StringView mime_type, ByteBuffer data)
 {
     // AD-HOC: At this point, things gets very ad-hoc.
@@ -160,12 +226,19 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
     auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
         Vector<AnimatedBitmapDecodedImageData::Frame> frames;
         for (auto& frame : result.frames) {
+            // NB: The frames of a streamed animation that haven't been decoded yet don't have a bitmap.
+            RefPtr<Gfx::ImmutableBitmap> bitmap;
+            if (frame.bitmap)
+                bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, result.color_space);
             frames.append(AnimatedBitmapDecodedImageData::Frame {
-                .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, result.color_space),
+                .bitmap = move(bitmap),
                 .duration = static_cast<int>(frame.duration),
             });
         }
-        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+        if (result.streamed_animation)
+            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create_streamed(strong_this->m_document->realm(), move(frames), result.loop_count, result.streamed_animation.release_nonnull(), result.color_space).release_value_but_fixme_should_propagate_errors();
+        else
+            strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
         strong_this->handle_successful_resource_load();
         return {};
     };
@@ -180,6 +253,8 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
 void SharedResourceRequest::handle_failed_fetch()
 {
     m_state = State::Failed;
+    m_partial_image_data = nullptr;
+    m_partial_image_data_callbacks.clear();
     for (auto& callback : m_callbacks) {
         if (callback.on_fail)
             callback.on_fail->function()();
@@ -190,6 +265,8 @@ void SharedResourceRequest::handle_failed_fetch()
 void SharedResourceRequest::handle_successful_resource_load()
 {
     m_state = State::Finished;
+    m_partial_image_data = nullptr;
+    m_partial_image_data_callbacks.clear();
     for (auto& callback : m_callbacks) {
         if (callback.on_finish)
             callback.on_finish->function()();
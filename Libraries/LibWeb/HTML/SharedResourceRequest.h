@@ -36,6 +36,10 @@ public:
 
     void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
 
+    // Image data decoded from the part of the resource that has been received so far, if any, while it's still being fetched.
+    [[nodiscard]] GC::Ptr<DecodedImageData> partial_image_data() const { return m_partial_image_data; }
+    void add_partial_image_data_callback(Function<void()>);
+
     bool is_fetching() const;
     bool needs_fetching() const;
 
@@ -48,6 +52,7 @@ private:
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
     void handle_failed_fetch();
     void handle_successful_resource_load();
+    void decode_partial_image_data_if_needed();
 
     enum class State {
         New,
@@ -65,9 +70,15 @@ private:
         GC::Ptr<GC::Function<void()>> on_fail;
     };
     Vector<Callbacks> m_callbacks;
+    Vector<GC::Ref<GC::Function<void()>>> m_partial_image_data_callbacks;
 
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
+
+    ByteBuffer m_received_data;
+    size_t m_next_partial_decode_size { 0 };
+    bool m_partial_decode_in_progress { false };
+    GC::Ptr<DecodedImageData> m_partial_image_data;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
 
     GC::Ptr<DOM::Document> m_document;
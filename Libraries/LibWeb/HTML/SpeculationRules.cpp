@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Console.h>
+#include <LibJS/Runtime/ConsoleObject.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/HTML/SpeculationRules.h>
+
+namespace Web::HTML {
+
+static Optional<SpeculationRuleEagerness> speculation_rule_eagerness_from_string(StringView string)
+{
+    if (string == "immediate"sv)
+        return SpeculationRuleEagerness::Immediate;
+    if (string == "eager"sv)
+        return SpeculationRuleEagerness::Eager;
+    if (string == "moderate"sv)
+        return SpeculationRuleEagerness::Moderate;
+    if (string == "conservative"sv)
+        return SpeculationRuleEagerness::Conservative;
+    return {};
+}
+
+static void report_a_warning(DOM::Document const& document, StringView message)
+{
+    auto& console = document.realm().intrinsics().console_object()->console();
+    console.output_debug_message(JS::Console::LogLevel::Warn, message);
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule
+static Optional<SpeculationRule> parse_a_speculation_rule(JsonValue const& input, DOM::Document const& document, URL::URL base_url)
+{
+    // 1. If input is not a map, then the user agent may report a warning to the console indicating that the rule needs
+    //    to be a JSON object, and return null.
+    if (!input.is_object()) {
+        report_a_warning(document, "Speculation rules: A rule needs to be a JSON object."sv);
+        return {};
+    }
+    auto const& input_object = input.as_object();
+
+    // 2. If input has any key other than "source", "urls", "where", "relative_to", "eagerness", "referrer_policy",
+    //    "tag", "requires", "expects_no_vary_search", or "target_hint", then the user agent may report a warning to the
+    //    console indicating that the rule has unrecognized keys, and return null.
+    auto has_unrecognized_keys = false;
+    input_object.for_each_member([&](auto const& key, auto const&) {
+        if (!key.bytes_as_string_view().is_one_of("source"sv, "urls"sv, "where"sv, "relative_to"sv, "eagerness"sv, "referrer_policy"sv, "tag"sv, "requires"sv, "expects_no_vary_search"sv, "target_hint"sv))
+            has_unrecognized_keys = true;
+    });
+    if (has_unrecognized_keys) {
+        report_a_warning(document, "Speculation rules: A rule has unrecognized keys."sv);
+        return {};
+    }
+
+    // 3. If input["source"] exists, then let source be input["source"]. Otherwise, if input["urls"] exists and
+    //    input["where"] does not exist, then let source be "list". Otherwise, if input["where"] exists and input["urls"]
+    //    does not exist, then let source be "document".
+    Optional<String> source;
+    if (auto const& source_value = input_object.get("source"sv); source_value.has_value()) {
+        if (source_value->is_string())
+            source = source_value->as_string();
+    } else if (input_object.has("urls"sv) && !input_object.has("where"sv)) {
+        source = "list"_string;
+    } else if (input_object.has("where"sv) && !input_object.has("urls"sv)) {
+        source = "document"_string;
+    }
+
+    // 4. If source is neither "list" nor "document", then the user agent may report a warning to the console indicating
+    //    that a source could not be inferred or an invalid source was specified, and return null.
+    if (!source.has_value() || !source->is_one_of("list"sv, "document"sv)) {
+        report_a_warning(document, "Speculation rules: A rule has no valid source."sv);
+        return {};
+    }
+
+    // 5. Let urls be an empty list.
+    Vector<URL::URL> urls;
+
+    // 6. Let predicate be null.
+
+    // 7. If source is "list", then:
+    if (source == "list"sv) {
+        // 1. If input["where"] exists, then the user agent may report a warning to the console indicating that there
+        //    were conflicting sources for this rule, and return null.
+        if (input_object.has("where"sv)) {
+            report_a_warning(document, "Speculation rules: A list rule can't have a where clause."sv);
+            return {};
+        }
+
+        // 2. If input["relative_to"] exists, then:
+        if (auto const& relative_to = input_object.get("relative_to"sv); relative_to.has_value()) {
+            // 1. If input["relative_to"] is neither "ruleset" nor "document", then the user agent may report a warning
+            //    to the console indicating that the supplied relative-to value was invalid, and return null.
+            if (!relative_to->is_string() || !relative_to->as_string().is_one_of("ruleset"sv, "document"sv)) {
+                report_a_warning(document, "Speculation rules: A rule has an invalid relative_to value."sv);
+                return {};
+            }
+
+            // 2. If input["relative_to"] is "document", then set baseURL to document's document base URL.
+            if (relative_to->as_string() == "document"sv)
+                base_url = document.base_url();
+        }
+
+        // 3. If input["urls"] does not exist or is not a list, then the user agent may report a warning to the console
+        //    indicating that the supplied URLs must be a list, and return null.
+        auto const& urls_value = input_object.get_array("urls"sv);
+        if (!urls_value.has_value()) {
+            report_a_warning(document, "Speculation rules: The urls of a rule must be a list."sv);
+            return {};
+        }
+
+        // 4. For each urlString of input["urls"]:
+        for (auto const& url_string : urls_value->values()) {
+            // 1. If urlString is not a string, then the user agent may report a warning to the console indicating that
+            //    the supplied URL must be a string, and return null.
+            if (!url_string.is_string()) {
+                report_a_warning(document, "Speculation rules: The urls of a rule must be strings."sv);
+                return {};
+            }
+
+            // 2. Let parsedURL be the result of URL parsing urlString with baseURL.
+            auto parsed_url = DOMURL::parse(url_string.as_string(), base_url);
+
+            // 3. If parsedURL is failure, or parsedURL's scheme is not an HTTP(S) scheme, then continue.
+            if (!parsed_url.has_value() || !parsed_url->scheme().is_one_of("http"sv, "https"sv))
+                continue;
+
+            // 4. Append parsedURL to urls.
+            urls.append(parsed_url.release_value());
+        }
+    }
+
+    // 8. If source is "document", then:
+    if (source == "document"sv) {
+        // FIXME: Support document rules, which match the links in the document against a predicate.
+        report_a_warning(document, "Speculation rules: Document rules are not supported yet."sv);
+        return {};
+    }
+
+    // 9. Let eagerness be "immediate" if source is "list"; otherwise, "conservative".
+    auto eagerness = source == "list"sv ? SpeculationRuleEagerness::Immediate : SpeculationRuleEagerness::Conservative;
+
+    // 10. If input["eagerness"] exists, then:
+    if (auto const& eagerness_value = input_object.get("eagerness"sv); eagerness_value.has_value()) {
+        // 1. If input["eagerness"] is not a speculation rule eagerness, then the user agent may report a warning to the
+        //    console indicating that the eagerness was invalid, and return null.
+        Optional<SpeculationRuleEagerness> parsed_eagerness;
+        if (eagerness_value->is_string())
+            parsed_eagerness = speculation_rule_eagerness_from_string(eagerness_value->as_string());
+        if (!parsed_eagerness.has_value()) {
+            report_a_warning(document, "Speculation rules: A rule has an invalid eagerness."sv);
+            return {};
+        }
+
+        // 2. Set eagerness to input["eagerness"].
+        eagerness = *parsed_eagerness;
+    }
+
+    // 11. Let referrerPolicy be the empty string.
+    auto referrer_policy = ReferrerPolicy::ReferrerPolicy::EmptyString;
+
+    // 12. If input["referrer_policy"] exists, then:
+    if (auto const& referrer_policy_value = input_object.get("referrer_policy"sv); referrer_policy_value.has_value()) {
+        // 1. If input["referrer_policy"] is not a referrer policy, then the user agent may report a warning to the
+        //    console indicating that the provided referrer policy is not valid, and return null.
+        Optional<ReferrerPolicy::ReferrerPolicy> parsed_referrer_policy;
+        if (referrer_policy_value->is_string())
+            parsed_referrer_policy = ReferrerPolicy::from_string(referrer_policy_value->as_string());
+        if (!parsed_referrer_policy.has_value()) {
+            report_a_warning(document, "Speculation rules: A rule has an invalid referrer policy."sv);
+            return {};
+        }
+
+        // 2. Set referrerPolicy to input["referrer_policy"].
+        referrer_policy = *parsed_referrer_policy;
+    }
+
+    // FIXME: 13-20. Handle tags, requirements, No-Vary-Search hints and target hints.
+
+    // 21. Return a speculation rule with URLs urls, predicate predicate, eagerness eagerness, referrer policy
+    //     referrerPolicy, tags tags, requirements requirements, No-Vary-Search hint noVarySearchHint, and target
+    //     navigable name hint targetHint.
+    return SpeculationRule {
+        .urls = move(urls),
+        .eagerness = eagerness,
+        .referrer_policy = referrer_policy,
+    };
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(StringView input, DOM::Document const& document, URL::URL const& base_url)
+{
+    // 1. Let parsed be the result of parsing a JSON string to an Infra value given input.
+    auto parsed = JsonValue::from_string(input);
+    if (parsed.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Speculation rules must be valid JSON."_string };
+
+    // 2. If parsed is not a map, then throw a TypeError indicating that the top-level value needs to be a JSON object.
+    if (!parsed.value().is_object())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The top-level value of speculation rules needs to be a JSON object."_string };
+    auto const& parsed_object = parsed.value().as_object();
+
+    // 3. Let result be a new speculation rule set.
+    SpeculationRuleSet result;
+
+    // FIXME: 4. Let tag be null, and handle parsed["tag"].
+
+    // 5. Let typesToTreatAsPrefetch be « "prefetch" ».
+    // 6. The user agent may append "prerender" to typesToTreatAsPrefetch.
+    // NB: We don't support prerendering, so prerender rules are downgraded to prefetches, which the spec allows.
+    for (auto type : { "prefetch"sv, "prerender"sv }) {
+        // 7. For each type of typesToTreatAsPrefetch, if parsed[type] exists:
+        auto const& rules = parsed_object.get(type);
+        if (!rules.has_value())
+            continue;
+
+        // 1. If parsed[type] is a list, then for each rule of parsed[type]:
+        if (rules->is_array()) {
+            for (auto const& rule : rules->as_array().values()) {
+                // 1. Let rule be the result of parsing a speculation rule given rule, tag, document, and baseURL.
+                auto parsed_rule = parse_a_speculation_rule(rule, document, base_url);
+
+                // 2. If rule is null, then continue.
+                if (!parsed_rule.has_value())
+                    continue;
+
+                // 3. Append rule to result's prefetch rules.
+                result.prefetch_rules.append(parsed_rule.release_value());
+            }
+        }
+        // 2. Otherwise, the user agent may report a warning to the console indicating that the rules list for type
+        //    needs to be a JSON array.
+        else {
+            report_a_warning(document, MUST(String::formatted("Speculation rules: The {} rules need to be a JSON array.", type)));
+        }
+    }
+
+    // 8. Return result.
+    return result;
+}
+
+// https://wicg.github.io/nav-speculation/prefetch.html#prefetch
+void prefetch(DOM::Document& document, URL::URL const& url, ReferrerPolicy::ReferrerPolicy referrer_policy)
+{
+    auto& realm = document.realm();
+    auto& vm = realm.vm();
+
+    // FIXME: Cross-origin prefetches have to be made without credentials, and from a separate network partition, so
+    //        that they don't leak anything about the user to the other site. Until we support that, we don't make any.
+    if (!url.origin().is_same_origin(document.origin()))
+        return;
+
+    auto request = Fetch::Infrastructure::Request::create(vm);
+    request->set_url(url);
+    request->set_client(&document.relevant_settings_object());
+    request->set_destination(Fetch::Infrastructure::Request::Destination::Document);
+    request->set_initiator(Fetch::Infrastructure::Request::Initiator::Prefetch);
+    request->set_mode(Fetch::Infrastructure::Request::Mode::SameOrigin);
+    request->set_credentials_mode(Fetch::Infrastructure::Request::CredentialsMode::Include);
+    request->set_referrer_policy(referrer_policy);
+
+    // NB: Rather than keeping the prefetched response in a prefetch record for the navigation to pick up, we let it
+    //     populate the HTTP cache, where the navigation will find it. The body has to be read for it to be cached.
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [](auto, auto) { };
+
+    Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+}
+
+}
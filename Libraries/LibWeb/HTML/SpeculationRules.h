@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-eagerness
+enum class SpeculationRuleEagerness {
+    Immediate,
+    Eager,
+    Moderate,
+    Conservative,
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule
+struct SpeculationRule {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-urls
+    Vector<URL::URL> urls;
+
+    // FIXME: predicate, for document rules.
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-eagerness
+    SpeculationRuleEagerness eagerness { SpeculationRuleEagerness::Immediate };
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-referrer-policy
+    ReferrerPolicy::ReferrerPolicy referrer_policy { ReferrerPolicy::ReferrerPolicy::EmptyString };
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-set
+struct SpeculationRuleSet {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-set-prefetch-rules
+    Vector<SpeculationRule> prefetch_rules;
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(StringView input, DOM::Document const&, URL::URL const& base_url);
+
+// https://wicg.github.io/nav-speculation/prefetch.html#prefetch
+void prefetch(DOM::Document&, URL::URL const&, ReferrerPolicy::ReferrerPolicy);
+
+}
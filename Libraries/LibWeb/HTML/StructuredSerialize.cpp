@@ -102,6 +102,12 @@ enum class ValueTag : u8 {
     // TODO: Define many more types
 };
 
+enum class PropertyKeyTag : u8 {
+    Index,
+    Name,
+    NameReference,
+};
+
 enum ErrorType {
     Error,
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -164,22 +170,21 @@ static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, TransferData
 
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // OPTIMIZATION: Encoding the data copies it into the serialized record, which makes a copy of our own redundant.
+        auto data_copy = array_buffer.buffer().bytes().trim(size);
 
         // 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
         if (!array_buffer.is_fixed_length()) {
             data_holder.encode(ValueTag::ResizeableArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode_buffer(data_copy);
             data_holder.encode(array_buffer.max_byte_length());
         }
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             data_holder.encode(ValueTag::ArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode_buffer(data_copy);
         }
     }
     return {};
@@ -258,22 +263,29 @@ public:
     Serializer(JS::VM& vm, SerializationMemory& memory, bool for_storage)
         : m_vm(vm)
         , m_memory(memory)
-        , m_next_id(memory.size())
         , m_for_storage(for_storage)
     {
     }
 
-    // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
-    // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
     WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
     {
         TransferDataEncoder serialized;
+        TRY(serialize(value, serialized));
+        return serialized.take_buffer().take_data();
+    }
 
+private:
+    // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
+    // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
+    // OPTIMIZATION: Rather than serializing each nested value into a record of its own and copying that into its parent's
+    //               record, the entries of maps, sets, arrays and objects are serialized straight into their parent's one.
+    WebIDL::ExceptionOr<void> serialize(JS::Value value, TransferDataEncoder& serialized)
+    {
         // 2. If memory[value] exists, then return memory[value].
         if (m_memory.contains(value)) {
             serialized.encode(ValueTag::ObjectReference);
             serialized.encode(m_memory.get(value).value());
-            return serialized.take_buffer().take_data();
+            return {};
         }
 
         // 3. Let deep be false.
@@ -303,7 +315,7 @@ public:
         }
 
         if (return_primitive_type)
-            return serialized.take_buffer().take_data();
+            return {};
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -475,7 +487,8 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_root(value), m_next_id++);
+        // NB: Values are numbered in the order that they are deserialized in, which is the order they are added in here.
+        m_memory.set(make_root(value), m_memory.size());
 
         // 26. If deep is true, then:
         if (deep) {
@@ -501,10 +514,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(copied_value, serialized));
                 }
             }
 
@@ -525,10 +536,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(copied_value, serialized));
                 }
             }
 
@@ -543,20 +552,26 @@ public:
                 auto count_offset = serialized.buffer().data().size();
                 serialized.encode(property_count);
 
-                for (auto key : MUST(object.enumerable_own_property_names(JS::Object::PropertyKind::Key))) {
-                    auto property_key = MUST(JS::PropertyKey::from_value(m_vm, key));
-
+                // OPTIMIZATION: This collects the same keys as EnumerableOwnProperties would, but without turning each of them
+                //               into a string value first, which is particularly costly for the indices of arrays.
+                Vector<JS::PropertyKey> keys;
+                keys.ensure_capacity(object.own_properties_count());
+                MUST(object.for_each_own_property_with_enumerability([&](JS::PropertyKey const& property_key, bool enumerable) -> JS::ThrowCompletionOr<void> {
+                    if (enumerable)
+                        keys.append(property_key);
+                    return {};
+                }));
+
+                for (auto const& property_key : keys) {
                     // 1. If ! HasOwnProperty(value, key) is true, then:
                     if (MUST(object.has_own_property(property_key))) {
                         // 1. Let inputValue be ? value.[[Get]](key, value).
                         auto input_value = TRY(object.internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
-                        serialized.encode(key.as_string().utf16_string());
-                        serialized.append(move(output_value));
+                        encode_property_key(serialized, property_key);
+                        TRY(serialize(input_value, serialized));
 
                         ++property_count;
                     }
@@ -570,13 +585,34 @@ public:
         }
 
         // 27. Return serialized.
-        return serialized.take_buffer().take_data();
+        return {};
+    }
+
+    // NB: Objects of the same kind tend to have the same property names, so each name is only encoded the first time it
+    //     is used. Later uses refer back to it by the order that the names were first used in.
+    void encode_property_key(TransferDataEncoder& serialized, JS::PropertyKey const& property_key)
+    {
+        if (property_key.is_number()) {
+            serialized.encode(PropertyKeyTag::Index);
+            serialized.encode(property_key.as_number());
+            return;
+        }
+
+        auto const& name = property_key.as_string();
+        if (auto id = m_property_names.get(name); id.has_value()) {
+            serialized.encode(PropertyKeyTag::NameReference);
+            serialized.encode(*id);
+            return;
+        }
+
+        serialized.encode(PropertyKeyTag::Name);
+        serialized.encode(name.to_utf16_string());
+        m_property_names.set(name, m_property_names.size());
     }
 
-private:
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
+    HashMap<Utf16FlyString, u32> m_property_names;
     bool m_for_storage { false };
 };
 
@@ -696,6 +732,9 @@ public:
 
             // 2. Otherwise, set value to a new SharedArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]]
             //    and whose [[ArrayBufferByteLength]] internal slot value is serialized.[[ArrayBufferByteLength]].
+            // FIXME: The data block should be shared with the agent that serialized it, not copied. Since agents run in
+            //        separate processes, that needs data blocks backed by shared memory. Until then, writes made by
+            //        one agent are not seen by the other, and Atomics.notify() can't wake waiters in another agent.
             auto buffer = TRY(m_serialized.decode_buffer(realm));
             value = JS::ArrayBuffer::create(realm, move(buffer), JS::DataBlock::Shared::Yes);
             break;
@@ -916,7 +955,7 @@ public:
 
                 // 1. For each Record { [[Key]], [[Value]] } entry of serialized.[[Properties]]:
                 for (u64 i = 0u; i < length; ++i) {
-                    auto key = m_serialized.decode<Utf16String>();
+                    auto key = decode_property_key();
 
                     // 1. Let deserializedValue be ? StructuredDeserialize(entry.[[Value]], targetRealm, memory).
                     auto deserialized_value = TRY(deserialize());
@@ -942,6 +981,21 @@ public:
     }
 
 private:
+    JS::PropertyKey decode_property_key()
+    {
+        switch (m_serialized.decode<PropertyKeyTag>()) {
+        case PropertyKeyTag::Index:
+            return JS::PropertyKey { m_serialized.decode<u32>() };
+        case PropertyKeyTag::Name:
+            // NB: Holding on to the key means that later references to it don't have to look up the interned string again.
+            m_property_names.append(JS::PropertyKey { m_serialized.decode<Utf16String>() });
+            return m_property_names.last();
+        case PropertyKeyTag::NameReference:
+            return m_property_names[m_serialized.decode<u32>()];
+        }
+        VERIFY_NOT_REACHED();
+    }
+
     static bool is_serializable_interface_exposed_on_target_realm(SerializeType name, JS::Realm& realm)
     {
         auto const& intrinsics = Bindings::host_defined_intrinsics(realm);
@@ -1027,6 +1081,7 @@ private:
     JS::VM& m_vm;
     TransferDataDecoder& m_serialized;
     GC::RootVector<JS::Value> m_memory;
+    Vector<JS::PropertyKey> m_property_names;
 };
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
@@ -1339,6 +1394,11 @@ TransferDataEncoder::TransferDataEncoder(IPC::MessageBuffer&& buffer)
 {
 }
 
+void TransferDataEncoder::encode_buffer(ReadonlyBytes bytes)
+{
+    MUST(m_encoder.encode_payload(bytes.size(), bytes));
+}
+
 void TransferDataEncoder::append(SerializationRecord&& record)
 {
     MUST(m_buffer.append_data(record.data(), record.size()));
@@ -32,6 +32,9 @@ public:
         MUST(m_encoder.encode(value));
     }
 
+    // NB: The bytes are encoded the same way as a ByteBuffer, to be decoded with TransferDataDecoder::decode_buffer().
+    void encode_buffer(ReadonlyBytes);
+
     void append(SerializationRecord&&);
     void extend(Vector<TransferDataEncoder>);
 
@@ -46,6 +46,11 @@ void Timer::start()
     m_timer->start();
 }
 
+void Timer::start(i32 milliseconds)
+{
+    m_timer->start(milliseconds);
+}
+
 void Timer::stop()
 {
     m_timer->stop();
@@ -32,6 +32,7 @@ public:
     static GC::Ref<Timer> create(JS::Object&, i32 milliseconds, Function<void()> callback, i32 id, Repeating);
 
     void start();
+    void start(i32 milliseconds);
     void stop();
 
     void set_callback(Function<void()>);
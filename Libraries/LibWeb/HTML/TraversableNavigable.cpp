@@ -23,6 +23,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/BackingStoreManager.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 
@@ -810,6 +811,12 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
             // 1. Assert: navigationType is not null.
             VERIFY(navigation_type.has_value());
 
+            // AD-HOC: A document that is being reloaded, or whose session history entry was replaced, can never be
+            //         traversed back to, so there's no point in keeping it in the back/forward cache.
+            if (target_entry == navigable->active_session_history_entry()
+                || !navigable->get_session_history_entries().contains_slow(*navigable->active_session_history_entry()))
+                displayed_document->make_unsalvageable("masked"_string);
+
             // 2. Deactivate displayedDocument, given userInvolvement, targetEntry, navigationType, and afterPotentialUnloads.
             deactivate_a_document_for_cross_document_navigation(*displayed_document, user_involvement, *populated_target_entry, after_potential_unload);
         }
@@ -876,6 +883,9 @@ TraversableNavigable::HistoryStepResult TraversableNavigable::apply_the_history_
     // 20. Set traversable's current session history step to targetStep.
     m_current_session_history_step = target_step;
 
+    // Not in the spec:
+    prune_back_forward_cache();
+
     // Not in the spec:
     auto back_enabled = m_current_session_history_step > 0;
     VERIFY(m_session_history_entries.size() > 0);
@@ -1092,6 +1102,49 @@ Vector<GC::Ref<SessionHistoryEntry>> TraversableNavigable::get_session_history_e
     return entries_for_navigation_api;
 }
 
+static void evict_document_from_back_forward_cache(GC::Ref<SessionHistoryEntry> entry)
+{
+    auto document = entry->document();
+
+    // NB: This also clears the document of any other entry sharing this entry's document state.
+    entry->document_state()->set_document(nullptr);
+
+    document->stop_frozen_fetches();
+    document->make_unsalvageable("masked"_string);
+    document->destroy();
+}
+
+void TraversableNavigable::prune_back_forward_cache(size_t maximum_document_count)
+{
+    Vector<GC::Ref<SessionHistoryEntry>> cached_entries;
+    for (auto& entry : m_session_history_entries) {
+        if (entry->step().has<int>() && entry->document() && entry->document() != active_document())
+            cached_entries.append(entry);
+    }
+
+    auto distance_from_current_step = [this](GC::Ref<SessionHistoryEntry> entry) {
+        return abs(entry->step().get<int>() - m_current_session_history_step);
+    };
+    quick_sort(cached_entries, [&](auto const& a, auto const& b) {
+        return distance_from_current_step(a) < distance_from_current_step(b);
+    });
+
+    // NB: Entries created by same-document navigations share their document, which should only be counted once.
+    HashTable<GC::Ref<DOM::Document>> kept_documents;
+    for (auto& entry : cached_entries) {
+        auto document = entry->document();
+        if (!document)
+            continue;
+        if (kept_documents.contains(*document))
+            continue;
+        if (kept_documents.size() < maximum_document_count) {
+            kept_documents.set(*document);
+            continue;
+        }
+        evict_document_from_back_forward_cache(entry);
+    }
+}
+
 // https://html.spec.whatwg.org/multipage/browsing-the-web.html#clear-the-forward-session-history
 void TraversableNavigable::clear_the_forward_session_history()
 {
@@ -1100,6 +1153,12 @@ void TraversableNavigable::clear_the_forward_session_history()
     // 2. Let step be the navigable's current session history step.
     auto step = current_session_history_step();
 
+    // AD-HOC: The removed entries can never be traversed to again, so evict their documents from the back/forward cache.
+    for (auto& entry : m_session_history_entries) {
+        if (entry->step().get<int>() > step && entry->document() && entry->document() != active_document())
+            evict_document_from_back_forward_cache(entry);
+    }
+
     // 3. Let entryLists be the ordered set « navigable's session history entries ».
     Vector<Vector<GC::Ref<SessionHistoryEntry>>&> entry_lists;
     entry_lists.append(session_history_entries());
@@ -1361,6 +1420,21 @@ void TraversableNavigable::set_system_visibility_state(VisibilityState visibilit
         return;
     m_system_visibility_state = visibility_state;
 
+    // NB: A hidden tab can give back GPU memory that Skia would otherwise hold onto for its next frame, and its
+    //     backing stores once it has been hidden for a while.
+    if (visibility_state == VisibilityState::Hidden) {
+        if (auto skia_backend_context = this->skia_backend_context())
+            skia_backend_context->purge_unused_resources();
+        backing_store_manager().schedule_release_of_backing_stores();
+    }
+
+    // NB: The backing stores may have been released while we were hidden.
+    if (visibility_state == VisibilityState::Visible) {
+        backing_store_manager().cancel_scheduled_release_of_backing_stores();
+        if (!backing_store_manager().has_backing_stores())
+            backing_store_manager().resize_backing_stores_if_needed(Painting::BackingStoreManager::WindowResizingInProgress::No);
+    }
+
     // When a user agent determines that the system visibility state for
     // traversable navigable traversable has changed to newState, it must run the following steps:
 
@@ -81,6 +81,12 @@ public:
 
     Vector<int> get_all_used_history_steps() const;
     void clear_the_forward_session_history();
+
+    // Documents that were navigated away from are kept alive in their session history entries, so that traversing
+    // back to them doesn't have to load them again. This evicts all but the given number of them, keeping the ones
+    // closest to the current session history step.
+    static constexpr size_t default_back_forward_cache_size = 3;
+    void prune_back_forward_cache(size_t maximum_document_count = default_back_forward_cache_size);
     void traverse_the_history_by_delta(int delta, GC::Ptr<DOM::Document> source_document = {});
 
     void close_top_level_traversable();
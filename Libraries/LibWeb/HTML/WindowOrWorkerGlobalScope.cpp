@@ -9,6 +9,7 @@
 
 #include <AK/QuickSort.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <AK/Utf8View.h>
 #include <AK/Vector.h>
 #include <LibGC/Function.h>
@@ -673,7 +674,7 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
     // 13. Set uniqueHandle to the result of running steps after a timeout given global, "setTimeout/setInterval",
     //     timeout, and completionStep.
     //     FIXME: run_steps_after_a_timeout() needs to be updated to return a unique internal value that can be used here.
-    run_steps_after_a_timeout_impl(timeout, move(completion_step), id, repeat);
+    run_steps_after_a_timeout_impl(throttled_timer_timeout(timeout), move(completion_step), id, repeat);
 
     // FIXME: 14. Set global's map of setTimeout and setInterval IDs[id] to uniqueHandle.
 
@@ -1072,6 +1073,22 @@ WindowOrWorkerGlobalScopeMixin::AffectedAnyWebSockets WindowOrWorkerGlobalScopeM
     return affected_any_web_sockets;
 }
 
+// NB: Timers in hidden documents fire on whole seconds of the monotonic clock, so that they run at most once a second
+//     and the wake-ups of all of them coalesce. This is the implementation-defined wait that running steps after a
+//     timeout allows for.
+i32 WindowOrWorkerGlobalScopeMixin::throttled_timer_timeout(i32 timeout) const
+{
+    static constexpr i64 hidden_document_timer_alignment_ms = 1000;
+
+    auto const* window = as_if<Window>(this_impl());
+    if (!window || !window->associated_document().hidden())
+        return timeout;
+
+    auto now = MonotonicTime::now().milliseconds();
+    auto aligned_deadline = ceil_div(now + timeout, hidden_document_timer_alignment_ms) * hidden_document_timer_alignment_ms;
+    return static_cast<i32>(min<i64>(aligned_deadline - now, NumericLimits<i32>::max()));
+}
+
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#run-steps-after-a-timeout
 void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step)
 {
@@ -1110,7 +1127,7 @@ void WindowOrWorkerGlobalScopeMixin::run_steps_after_a_timeout_impl(i32 timeout,
     // FIXME:    4. Perform completionSteps.
     // FIXME:    5. If timerKey is a non-numeric value, remove global's map of active timers[timerKey].
 
-    timer->start();
+    timer->start(timeout);
 }
 
 // https://w3c.github.io/hr-time/#dom-windoworworkerglobalscope-performance
@@ -58,6 +58,22 @@ bool IDBKeyRange::is_in_range(GC::Ref<Key> key) const
     return lower_bound_in_range && upper_bound_in_range;
 }
 
+bool IDBKeyRange::is_below_lower_bound(GC::Ref<Key> key) const
+{
+    if (!m_lower_bound)
+        return false;
+    auto comparison = Key::compare_two_keys(key, *m_lower_bound);
+    return comparison < 0 || (comparison == 0 && m_lower_open);
+}
+
+bool IDBKeyRange::is_above_upper_bound(GC::Ref<Key> key) const
+{
+    if (!m_upper_bound)
+        return false;
+    auto comparison = Key::compare_two_keys(key, *m_upper_bound);
+    return comparison > 0 || (comparison == 0 && m_upper_open);
+}
+
 // https://w3c.github.io/IndexedDB/#dom-idbkeyrange-only
 WebIDL::ExceptionOr<GC::Ref<IDBKeyRange>> IDBKeyRange::only(JS::VM& vm, JS::Value value)
 {
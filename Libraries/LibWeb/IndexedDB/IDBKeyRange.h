@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Span.h>
 #include <AK/Types.h>
 #include <LibGC/Heap.h>
 #include <LibGC/Ptr.h>
@@ -16,6 +17,23 @@
 
 namespace Web::IndexedDB {
 
+// NB: Returns the index of the first record in a sorted list of records for which the predicate doesn't hold, given that it
+//     holds for all records before that one and for none after it.
+template<typename Record, typename Predicate>
+size_t partition_point_of_records(ReadonlySpan<Record> records, Predicate predicate)
+{
+    size_t low = 0;
+    size_t high = records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (predicate(records[middle]))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
 // https://w3c.github.io/IndexedDB/#keyrange
 class IDBKeyRange : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(IDBKeyRange, Bindings::PlatformObject);
@@ -48,6 +66,25 @@ public:
 
     bool is_unbound() const { return m_lower_bound == nullptr && m_upper_bound == nullptr; }
     bool is_in_range(GC::Ref<Key>) const;
+
+    // NB: A key that is in neither of these is in the range.
+    bool is_below_lower_bound(GC::Ref<Key>) const;
+    bool is_above_upper_bound(GC::Ref<Key>) const;
+
+    // NB: Lists of records are sorted by key, so the records in a range are next to each other and can be found with a
+    //     binary search. These return the indices of the first record in the range and of the first record after it.
+    template<typename Record>
+    size_t index_of_first_record_in_range(ReadonlySpan<Record> records) const
+    {
+        return partition_point_of_records(records, [&](auto const& record) { return is_below_lower_bound(record.key); });
+    }
+
+    template<typename Record>
+    size_t index_past_last_record_in_range(ReadonlySpan<Record> records) const
+    {
+        return partition_point_of_records(records, [&](auto const& record) { return !is_above_upper_bound(record.key); });
+    }
+
     GC::Ptr<Key> lower_key() const { return m_lower_bound; }
     GC::Ptr<Key> upper_key() const { return m_upper_bound; }
 
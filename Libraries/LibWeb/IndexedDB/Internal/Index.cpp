@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -51,11 +51,10 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
+    auto index = partition_point_of_records(records(), [&](auto const& record) {
+        return Key::compare_two_keys(record.key, key) < 0;
     });
-
-    return index != m_records.end();
+    return index < m_records.size() && Key::equals(m_records[index].key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +62,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,20 +72,21 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto first = range->index_of_first_record_in_range(records());
+    if (first == m_records.size() || range->is_above_upper_bound(m_records[first].key))
+        return {};
+    return m_records[first];
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    auto first = range->index_of_first_record_in_range(this->records());
+    auto end = range->index_past_last_record_in_range(this->records());
+    for (auto i = first; i < end; ++i) {
         if (count.has_value() && records.size() >= *count)
             break;
+        records.append(m_records[i]);
     }
 
     return records;
@@ -101,12 +95,12 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    auto first = range->index_of_first_record_in_range(this->records());
+    auto end = range->index_past_last_record_in_range(this->records());
+    for (auto i = end; i > first; --i) {
         if (count.has_value() && records.size() >= *count)
             break;
+        records.append(m_records[i - 1]);
     }
 
     return records;
@@ -114,26 +108,22 @@ GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange>
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto first = range->index_of_first_record_in_range(records());
+    auto end = range->index_past_last_record_in_range(records());
+    return first < end ? end - first : 0;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
+    auto index = partition_point_of_records(records(), [&](auto const& other) {
+        auto key_comparison = Key::compare_two_keys(other.key, record.key);
         if (key_comparison != 0)
             return key_comparison < 0;
 
-        return Key::compare_two_keys(a.value, b.value) < 0;
+        return Key::compare_two_keys(other.value, record.value) <= 0;
     });
+    m_records.insert(index, record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
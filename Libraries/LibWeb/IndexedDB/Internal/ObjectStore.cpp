@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -43,45 +42,58 @@ void ObjectStore::visit_edges(Visitor& visitor)
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
+    auto first = range->index_of_first_record_in_range(records());
+    auto end = range->index_past_last_record_in_range(records());
+    if (first < end)
+        m_records.remove(first, end - first);
+}
+
+Optional<size_t> ObjectStore::index_of_record_with_key(GC::Ref<Key> key) const
+{
+    // NB: No two records in an object store have the same key.
+    auto index = partition_point_of_records(records(), [&](auto const& record) {
+        return Key::compare_two_keys(record.key, key) < 0;
     });
+    if (index == m_records.size() || !Key::equals(m_records[index].key, key))
+        return {};
+    return index;
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return index_of_record_with_key(key).has_value();
+}
 
-    return index != m_records.end();
+Optional<ObjectStoreRecord const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto index = index_of_record_with_key(key);
+    if (!index.has_value())
+        return {};
+    return m_records[*index];
 }
 
 void ObjectStore::store_a_record(ObjectStoreRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
+    auto index = partition_point_of_records(records(), [&](auto const& other) {
+        return Key::compare_two_keys(other.key, record.key) <= 0;
     });
+    m_records.insert(index, record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto first = range->index_of_first_record_in_range(records());
+    auto end = range->index_past_last_record_in_range(records());
+    return first < end ? end - first : 0;
 }
 
 Optional<ObjectStoreRecord&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto first = range->index_of_first_record_in_range(records());
+    if (first == m_records.size() || range->is_above_upper_bound(m_records[first].key))
+        return {};
+    return m_records[first];
 }
 
 void ObjectStore::clear_records()
@@ -92,12 +104,12 @@ void ObjectStore::clear_records()
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    auto first = range->index_of_first_record_in_range(this->records());
+    auto end = range->index_past_last_record_in_range(this->records());
+    for (auto i = first; i < end; ++i) {
         if (count.has_value() && records.size() >= *count)
             break;
+        records.append(m_records[i]);
     }
 
     return records;
@@ -106,12 +118,12 @@ GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
-
+    auto first = range->index_of_first_record_in_range(this->records());
+    auto end = range->index_past_last_record_in_range(this->records());
+    for (auto i = end; i > first; --i) {
         if (count.has_value() && records.size() >= *count)
             break;
+        records.append(m_records[i - 1]);
     }
 
     return records;
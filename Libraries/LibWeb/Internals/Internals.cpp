@@ -23,6 +23,7 @@
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/SpeculationRules.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/InternalGamepad.h>
 #include <LibWeb/Internals/Internals.h>
@@ -478,6 +479,18 @@ GC::Ptr<DOM::ShadowRoot> Internals::get_shadow_root(GC::Ref<DOM::Element> elemen
     return element->shadow_root();
 }
 
+Vector<String> Internals::get_speculation_rule_urls()
+{
+    Vector<String> urls;
+    for (auto const& [_, rule_set] : window().associated_document().speculation_rule_sets()) {
+        for (auto const& rule : rule_set.prefetch_rules) {
+            for (auto const& url : rule.urls)
+                urls.append(url.serialize());
+        }
+    }
+    return urls;
+}
+
 void Internals::handle_sdl_input_events()
 {
     page().handle_sdl_input_events();
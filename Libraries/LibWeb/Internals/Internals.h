@@ -94,6 +94,8 @@ public:
 
     GC::Ptr<DOM::ShadowRoot> get_shadow_root(GC::Ref<DOM::Element>);
 
+    Vector<String> get_speculation_rule_urls();
+
     void handle_sdl_input_events();
 
     GC::Ref<InternalGamepad> connect_virtual_gamepad();
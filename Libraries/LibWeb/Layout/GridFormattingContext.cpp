@@ -1379,6 +1379,9 @@ void GridFormattingContext::run_track_sizing(GridDimension dimension)
     // https://www.w3.org/TR/css-grid-2/#algo-track-sizing
     // 12.3. Track Sizing Algorithm
 
+    for (auto& item : m_grid_items)
+        item.cached_contributions[to_underlying(dimension)] = {};
+
     // 1. Initialize Track Sizes
     initialize_track_sizes(dimension);
 
@@ -2509,6 +2512,10 @@ CSSPixels GridFormattingContext::calculate_min_content_contribution(GridItem con
     }
 
     if (should_treat_preferred_size_as_auto) {
+        auto& cached_min_content_contribution = item.cached_contributions[to_underlying(dimension)].min_content;
+        if (cached_min_content_contribution.has_value())
+            return cached_min_content_contribution.value();
+
         CSSPixels min_content_size;
         // NOTE: This behavior is not defined in the spec, but seems required to match other browsers.
         if (item.box->is_scroll_container()) {
@@ -2517,7 +2524,8 @@ CSSPixels GridFormattingContext::calculate_min_content_contribution(GridItem con
             min_content_size = calculate_min_content_size(item, dimension);
         }
         auto result = item.add_margin_box_sizes(min_content_size, dimension);
-        return min(result, maximum_size);
+        cached_min_content_contribution = min(result, maximum_size);
+        return cached_min_content_contribution.value();
     }
 
     auto preferred_size = item.preferred_size(dimension);
@@ -2546,9 +2554,14 @@ CSSPixels GridFormattingContext::calculate_max_content_contribution(GridItem con
 
     auto preferred_size = item.preferred_size(dimension);
     if (should_treat_preferred_size_as_auto || preferred_size.is_fit_content()) {
+        auto& cached_max_content_contribution = item.cached_contributions[to_underlying(dimension)].max_content;
+        if (cached_max_content_contribution.has_value())
+            return cached_max_content_contribution.value();
+
         auto fit_content_size = dimension == GridDimension::Column ? calculate_fit_content_width(item.box, available_space_for_item) : calculate_fit_content_height(item.box, available_space_for_item);
         auto result = item.add_margin_box_sizes(fit_content_size, dimension);
-        return min(result, maximum_size);
+        cached_max_content_contribution = min(result, maximum_size);
+        return cached_max_content_contribution.value();
     }
 
     auto resolve_size = [&] {
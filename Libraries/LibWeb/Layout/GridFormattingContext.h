@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <LibWeb/CSS/Length.h>
 #include <LibWeb/Layout/FormattingContext.h>
 
@@ -130,6 +131,14 @@ struct GridItem {
         auto available_height = used_values.has_definite_height() ? AvailableSize::make_definite(used_values.content_height()) : AvailableSize::make_indefinite();
         return { available_width, available_height };
     }
+
+    // The min-content and max-content contributions of an item whose preferred size behaves as auto only depend on
+    // its contents, so they are computed once per run of the track sizing algorithm rather than at every step of it.
+    struct CachedContributions {
+        Optional<CSSPixels> min_content;
+        Optional<CSSPixels> max_content;
+    };
+    mutable Array<CachedContributions, 2> cached_contributions;
 };
 
 enum class FoundUnoccupiedPlace {
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Arena.h>
 #include <AK/HashMap.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
@@ -204,10 +205,17 @@ struct LayoutState {
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    OrderedHashMap<GC::Ref<Layout::Node const>, UsedValues*> used_values_per_layout_node;
 
 private:
+    UsedValues& create_used_values(NodeWithStyle const&);
+
     void resolve_relative_positions();
+
+    // OPTIMIZATION: A layout pass creates used values for every node it touches, and throwaway states for intrinsic
+    //               sizing create many more. They all die with the state, so allocate them together and free them in
+    //               one go rather than one malloc() and free() per node.
+    Arena<> m_used_values_arena;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/HTMLTableColElement.h>
@@ -123,6 +124,13 @@ void TableFormattingContext::compute_cell_measures()
 
     compute_constrainedness();
 
+    // OPTIMIZATION: In fixed mode, the width of a cell without a specified width doesn't contribute to the column
+    //               measures, and laying the cell out at its final width in compute_table_height() never makes it
+    //               shorter than its min-content height. Unless a cell spanning several rows needs the intrinsic
+    //               heights of the rows it spans, we can skip the intrinsic layouts of those cells entirely, which
+    //               is most of the cost of laying out a large fixed-layout table.
+    auto skip_intrinsic_sizes_of_cells_without_specified_width = use_fixed_mode_layout() && all_of(m_cells, [](auto const& cell) { return cell.row_span == 1; });
+
     for (auto& cell : m_cells) {
         auto const& computed_values = cell.box->computed_values();
         CSSPixels padding_top = computed_values.padding().top().to_px_or_zero(cell.box, containing_block.content_height());
@@ -138,14 +146,23 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
+        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
+        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
+        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
+
+        if (skip_intrinsic_sizes_of_cells_without_specified_width && !width_is_specified_length_or_percentage) {
+            auto height = computed_values.height().is_length() ? computed_values.height().to_px(cell.box, containing_block.content_height()) : 0;
+            cell.outer_min_height = min_height + cell_intrinsic_height_offsets;
+            cell.outer_max_height = max(min_height, height) + cell_intrinsic_height_offsets;
+            continue;
+        }
+
         auto min_content_width = calculate_min_content_width(cell.box);
         auto max_content_width = calculate_max_content_width(cell.box);
         auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
         auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
-        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
-        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
         cell.outer_min_height = max(min_height, min_content_height) + cell_intrinsic_height_offsets;
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
@@ -153,7 +170,6 @@ void TableFormattingContext::compute_cell_measures()
         // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
         // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
         // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
-        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
         if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
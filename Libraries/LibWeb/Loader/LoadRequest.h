@@ -16,6 +16,7 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web {
 
@@ -38,6 +39,9 @@ public:
     HTTP::CacheMode cache_mode() const { return m_cache_mode; }
     void set_cache_mode(HTTP::CacheMode cache_mode) { m_cache_mode = cache_mode; }
 
+    RequestServer::RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestServer::RequestPriority priority) { m_priority = priority; }
+
     bool store_set_cookie_headers() const { return m_store_set_cookie_headers; }
     void set_store_set_cookie_headers(bool store_set_cookie_headers) { m_store_set_cookie_headers = store_set_cookie_headers; }
 
@@ -60,6 +64,7 @@ private:
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
     HTTP::CacheMode m_cache_mode { HTTP::CacheMode::Default };
+    RequestServer::RequestPriority m_priority { RequestServer::RequestPriority::Medium };
     bool m_store_set_cookie_headers { true };
     Optional<Fetch::Infrastructure::Request::InitiatorType> m_initiator_type;
 };
@@ -21,6 +21,8 @@ namespace Web::Painting {
 
 GC_DEFINE_ALLOCATOR(BackingStoreManager);
 
+static constexpr int backing_store_release_delay_ms = 10'000;
+
 #ifdef AK_OS_MACOS
 static Optional<Core::MachPort> s_browser_mach_port;
 void BackingStoreManager::set_browser_mach_port(Core::MachPort&& port)
@@ -35,6 +37,9 @@ BackingStoreManager::BackingStoreManager(HTML::Navigable& navigable)
     m_backing_store_shrink_timer = Core::Timer::create_single_shot(3000, [this] {
         resize_backing_stores_if_needed(WindowResizingInProgress::No);
     });
+    m_backing_store_release_timer = Core::Timer::create_single_shot(backing_store_release_delay_ms, [this] {
+        release_backing_stores();
+    });
 }
 
 void BackingStoreManager::visit_edges(Cell::Visitor& visitor)
@@ -48,6 +53,37 @@ void BackingStoreManager::restart_resize_timer()
     m_backing_store_shrink_timer->restart();
 }
 
+void BackingStoreManager::release_backing_stores()
+{
+    if (m_allocated_size.is_empty())
+        return;
+
+    m_backing_store_shrink_timer->stop();
+    m_backing_store_release_timer->stop();
+
+    m_front_bitmap_id = -1;
+    m_back_bitmap_id = -1;
+    m_allocated_size = {};
+
+    m_navigable->rendering_thread().update_backing_stores(nullptr, nullptr, -1, -1);
+
+    // NB: The UI process maps the same memory, so it has to let go of it too before it is actually freed.
+    if (m_navigable->is_top_level_traversable())
+        m_navigable->top_level_traversable()->page().client().page_did_release_backing_stores();
+}
+
+void BackingStoreManager::schedule_release_of_backing_stores()
+{
+    if (m_allocated_size.is_empty())
+        return;
+    m_backing_store_release_timer->restart();
+}
+
+void BackingStoreManager::cancel_scheduled_release_of_backing_stores()
+{
+    m_backing_store_release_timer->stop();
+}
+
 void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
 {
     auto skia_backend_context = m_navigable->skia_backend_context();
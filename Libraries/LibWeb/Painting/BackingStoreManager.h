@@ -27,6 +27,15 @@ public:
     void reallocate_backing_stores(Gfx::IntSize);
     void restart_resize_timer();
 
+    // Frees both backing stores. They are reallocated by the next call to resize_backing_stores_if_needed().
+    void release_backing_stores();
+
+    // Releases the backing stores once the page has stayed hidden for a while, so that quickly switching back and forth
+    // between tabs doesn't have to reallocate them every time.
+    void schedule_release_of_backing_stores();
+    void cancel_scheduled_release_of_backing_stores();
+    bool has_backing_stores() const { return !m_allocated_size.is_empty(); }
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
     BackingStoreManager(HTML::Navigable&);
@@ -42,6 +51,7 @@ private:
     Gfx::IntSize m_allocated_size;
 
     RefPtr<Core::Timer> m_backing_store_shrink_timer;
+    RefPtr<Core::Timer> m_backing_store_release_timer;
 };
 
 }
@@ -20,6 +20,8 @@ struct CornerRadius {
     {
         return horizontal_radius > 0 && vertical_radius > 0;
     }
+
+    bool operator==(CornerRadius const&) const = default;
 };
 
 struct WEB_API BorderRadiusData {
@@ -52,6 +54,8 @@ struct CornerRadii {
     {
         return top_left || top_right || bottom_right || bottom_left;
     }
+
+    bool operator==(CornerRadii const&) const = default;
 };
 
 struct BorderRadiiData {
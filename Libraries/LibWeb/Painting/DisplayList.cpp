@@ -5,6 +5,7 @@
  */
 
 #include <AK/TemporaryChange.h>
+#include <LibCore/TraceEvent.h>
 #include <LibWeb/Painting/DevicePixelConverter.h>
 #include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/ResolvedCSSFilter.h>
@@ -38,14 +39,16 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
 {
+    TRACE_EVENT(Painting, "DisplayListPlayer::execute");
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
+    m_caret_device_rects.clear_with_capacity();
     if (surface) {
         surface->lock_context();
     }
     auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
-    execute_impl(display_list, scroll_state_snapshot, surface);
+    execute_impl(display_list, scroll_state_snapshot, surface, damage_rect);
     if (surface) {
         surface->unlock_context();
     }
@@ -76,7 +79,7 @@ static Gfx::FloatMatrix4x4 scale_matrix_translation(Gfx::FloatMatrix4x4 matrix,
     return matrix;
 }
 
-void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -85,6 +88,12 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             (void)surfaces.take_last();
     };
 
+    // NB: Clipping to the damage rect makes us cull every command outside of it below.
+    if (damage_rect.has_value()) {
+        save({});
+        add_clip_rect({ .rect = *damage_rect });
+    }
+
     auto const& commands = display_list.commands();
     auto device_pixels_per_css_pixel = display_list.device_pixels_per_css_pixel();
 
@@ -213,6 +222,15 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             continue;
         }
 
+        if (command.has<PaintCaret>()) {
+            auto const& paint_caret = command.get<PaintCaret>();
+            if (m_surfaces.size() == 1)
+                m_caret_device_rects.append(device_rect_for(paint_caret.rect));
+            if (m_should_paint_caret)
+                fill_rect({ .rect = paint_caret.rect, .color = paint_caret.color });
+            continue;
+        }
+
 #define HANDLE_COMMAND(command_type, executor_method) \
     if (command.has<command_type>()) {                \
         executor_method(command.get<command_type>()); \
@@ -256,6 +274,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         applied_depth--;
     }
 
+    if (damage_rect.has_value())
+        restore({});
+
     if (surface)
         flush();
 }
@@ -25,11 +25,17 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    // If a damage rect is given, only that part of the surface is repainted; everything outside of it is left as is.
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
+
+    void set_should_paint_caret(bool should_paint_caret) { m_should_paint_caret = should_paint_caret; }
+
+    // Device rects of the (possibly unpainted) PaintCaret commands that weren't culled during the last execute().
+    Vector<Gfx::IntRect> const& caret_device_rects() const { return m_caret_device_rects; }
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
-    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {});
 
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
 
@@ -66,10 +72,14 @@ private:
     virtual void apply_effects(ApplyEffects const&) = 0;
     virtual void apply_transform(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4 const&) = 0;
     virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect) const = 0;
+    virtual Gfx::IntRect device_rect_for(Gfx::IntRect) const = 0;
 
     virtual void add_clip_path(Gfx::Path const&) = 0;
 
     Vector<NonnullRefPtr<Gfx::PaintingSurface>, 1> m_surfaces;
+
+    bool m_should_paint_caret { true };
+    Vector<Gfx::IntRect> m_caret_device_rects;
 };
 
 class DisplayList : public AtomicRefCounted<DisplayList> {
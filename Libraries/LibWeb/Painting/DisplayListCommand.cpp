@@ -27,12 +27,17 @@ Gfx::IntRect PaintInnerBoxShadow::bounding_rect() const
 
 Gfx::IntRect DrawGlyphRun::bounding_rect() const
 {
-    return glyph_run->cached_blob_bounds().translated(translation).to_rounded<int>();
+    auto bounding_rect = glyph_run->cached_blob_bounds().translated(translation);
+    for (auto const& merged_glyph_run : merged_glyph_runs)
+        bounding_rect.unite(merged_glyph_run.glyph_run->cached_blob_bounds().translated(merged_glyph_run.translation));
+    return bounding_rect.to_rounded<int>();
 }
 
 void DrawGlyphRun::dump(StringBuilder& builder) const
 {
     builder.appendff(" rect={} translation={} color={}", rect, translation, color);
+    for (auto const& merged_glyph_run : merged_glyph_runs)
+        builder.appendff(" merged_rect={} merged_translation={}", merged_glyph_run.rect, merged_glyph_run.translation);
 }
 
 void FillRect::dump(StringBuilder& builder) const
@@ -40,6 +45,11 @@ void FillRect::dump(StringBuilder& builder) const
     builder.appendff(" rect={} color={}", rect, color);
 }
 
+void PaintCaret::dump(StringBuilder& builder) const
+{
+    builder.appendff(" rect={} color={}", rect, color);
+}
+
 void DrawPaintingSurface::dump(StringBuilder& builder) const
 {
     builder.appendff(" dst_rect={} src_rect={}", dst_rect, src_rect);
@@ -45,6 +45,15 @@ struct DrawGlyphRun {
     Color color;
     Gfx::Orientation orientation { Gfx::Orientation::Horizontal };
 
+    // Glyph runs that were recorded directly after this one and are drawn with the same paint. Each of them keeps its
+    // own text blob, so they may use different fonts.
+    struct MergedGlyphRun {
+        NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
+        Gfx::IntRect rect;
+        Gfx::FloatPoint translation;
+    };
+    Vector<MergedGlyphRun> merged_glyph_runs;
+
     [[nodiscard]] Gfx::IntRect bounding_rect() const;
     void dump(StringBuilder&) const;
 };
@@ -59,6 +68,18 @@ struct FillRect {
     void dump(StringBuilder&) const;
 };
 
+// NB: The caret is recorded regardless of its blink state; the player decides whether to paint it, so that a
+//     blinking caret doesn't require a new display list.
+struct PaintCaret {
+    static constexpr StringView command_name = "PaintCaret"sv;
+
+    Gfx::IntRect rect;
+    Color color;
+
+    [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
+    void dump(StringBuilder&) const;
+};
+
 struct DrawPaintingSurface {
     static constexpr StringView command_name = "DrawPaintingSurface"sv;
 
@@ -380,6 +401,7 @@ struct ApplyEffects {
 using DisplayListCommand = Variant<
     DrawGlyphRun,
     FillRect,
+    PaintCaret,
     DrawPaintingSurface,
     DrawScaledImmutableBitmap,
     DrawRepeatedImmutableBitmap,
@@ -11,6 +11,7 @@
 #include <core/SkBlurTypes.h>
 #include <core/SkCanvas.h>
 #include <core/SkFont.h>
+#include <core/SkImage.h>
 #include <core/SkMaskFilter.h>
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
@@ -34,6 +35,38 @@
 
 namespace Web::Painting {
 
+struct BoxShadowMaskKey {
+    Gfx::IntSize size;
+    CornerRadii corner_radii;
+    int blur_radius;
+
+    bool operator==(BoxShadowMaskKey const&) const = default;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::Painting::BoxShadowMaskKey> : public DefaultTraits<Web::Painting::BoxShadowMaskKey> {
+    static unsigned hash(Web::Painting::BoxShadowMaskKey const& key)
+    {
+        auto hash_corner = [](Web::Painting::CornerRadius const& radius) {
+            return pair_int_hash(radius.horizontal_radius, radius.vertical_radius);
+        };
+        auto hash = pair_int_hash(key.size.width(), key.size.height());
+        hash = pair_int_hash(hash, key.blur_radius);
+        hash = pair_int_hash(hash, hash_corner(key.corner_radii.top_left));
+        hash = pair_int_hash(hash, hash_corner(key.corner_radii.top_right));
+        hash = pair_int_hash(hash, hash_corner(key.corner_radii.bottom_right));
+        return pair_int_hash(hash, hash_corner(key.corner_radii.bottom_left));
+    }
+};
+
+}
+
+namespace Web::Painting {
+
 DisplayListPlayerSkia::DisplayListPlayerSkia(RefPtr<Gfx::SkiaBackendContext> context)
     : m_context(context)
 {
@@ -104,7 +137,7 @@ void DisplayListPlayerSkia::flush()
 void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
 {
     auto* blob = command.glyph_run->cached_skia_text_blob();
-    if (!blob)
+    if (!blob && command.merged_glyph_runs.is_empty())
         return;
 
     SkPaint paint;
@@ -115,9 +148,17 @@ void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
 
     switch (command.orientation) {
     case Gfx::Orientation::Horizontal:
-        canvas.drawTextBlob(blob, translation.x(), translation.y(), paint);
+        if (blob)
+            canvas.drawTextBlob(blob, translation.x(), translation.y(), paint);
+        for (auto const& merged_glyph_run : command.merged_glyph_runs) {
+            if (auto* merged_blob = merged_glyph_run.glyph_run->cached_skia_text_blob())
+                canvas.drawTextBlob(merged_blob, merged_glyph_run.translation.x(), merged_glyph_run.translation.y(), paint);
+        }
         break;
     case Gfx::Orientation::Vertical:
+        // NB: Vertical glyph runs are never merged.
+        if (!blob)
+            return;
         canvas.save();
         canvas.translate(command.rect.width(), 0);
         canvas.rotate(90, command.rect.top_left().x(), command.rect.top_left().y());
@@ -373,6 +414,21 @@ void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& co
     SkPaint paint;
     paint.setAntiAlias(true);
     paint.setColor(to_skia_color(color));
+
+    // OPTIMIZATION: Blurring the shadow's shape is by far the most expensive part of painting it on CPU, and pages tend to
+    //               repeat the same shadows over and over (e.g. cards in a list). So we blur a nine-patch mask of the shape
+    //               once and stretch its middle row and column to the size of each shadow that uses it.
+    // NB: The mask is only reusable as is if it lands on whole device pixels. On GPU, Skia blurs rounded rects analytically.
+    auto const& matrix = canvas.getTotalMatrix();
+    if (!m_context && blur_radius / 2 > 0 && matrix.isTranslate() && SkScalarIsInt(matrix.getTranslateX()) && SkScalarIsInt(matrix.getTranslateY())) {
+        if (auto const* mask = box_shadow_mask(shadow_rect.size(), corner_radii, blur_radius)) {
+            auto destination_rect = shadow_rect.inflated(mask->margin * 2, mask->margin * 2);
+            canvas.drawImageNine(mask->image.get(), mask->center, to_skia_rect(destination_rect), SkFilterMode::kNearest, &paint);
+            canvas.restore();
+            return;
+        }
+    }
+
     paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
     auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
     canvas.drawRRect(shadow_rounded_rect, paint);
@@ -755,6 +811,92 @@ DisplayListPlayerSkia::CachedRuntimeEffects& DisplayListPlayerSkia::cached_runti
     return *m_cached_runtime_effects;
 }
 
+// NB: Cached masks are dropped all at once when they'd exceed this, since the same few shadows tend to repeat.
+static constexpr size_t box_shadow_mask_cache_byte_limit = 8 * MiB;
+
+// A blurred mask of a shadow's shape, which can be stretched along its center row and column.
+struct DisplayListPlayerSkia::BoxShadowMask {
+    sk_sp<SkImage> image;
+    SkIRect center;
+    int margin { 0 };
+};
+
+struct DisplayListPlayerSkia::CachedBoxShadowMasks {
+    HashMap<BoxShadowMaskKey, Optional<BoxShadowMask>> masks;
+    size_t byte_size { 0 };
+};
+
+DisplayListPlayerSkia::CachedBoxShadowMasks& DisplayListPlayerSkia::cached_box_shadow_masks()
+{
+    if (!m_cached_box_shadow_masks)
+        m_cached_box_shadow_masks = make<DisplayListPlayerSkia::CachedBoxShadowMasks>();
+    return *m_cached_box_shadow_masks;
+}
+
+DisplayListPlayerSkia::BoxShadowMask const* DisplayListPlayerSkia::box_shadow_mask(Gfx::IntSize shadow_size, CornerRadii const& corner_radii, int blur_radius)
+{
+    // NB: This has to match the sigma of the uncached blur in paint_outer_box_shadow(), integer division included, or a
+    //     shadow would look different depending on whether it was drawn from the cache.
+    auto sigma = static_cast<float>(blur_radius / 2);
+    // NB: A blur reaches about three standard deviations out; one extra pixel keeps rounding from cutting it off.
+    auto margin = static_cast<int>(ceilf(sigma * 3)) + 1;
+
+    // Away from the corners, every column (row) of the blurred shape is the same, so a single one of them can be
+    // stretched to any width (height). That column has to be at least a blur margin away from the corner radii on
+    // either side.
+    auto left_radius = max(corner_radii.top_left.horizontal_radius, corner_radii.bottom_left.horizontal_radius);
+    auto right_radius = max(corner_radii.top_right.horizontal_radius, corner_radii.bottom_right.horizontal_radius);
+    auto top_radius = max(corner_radii.top_left.vertical_radius, corner_radii.top_right.vertical_radius);
+    auto bottom_radius = max(corner_radii.bottom_left.vertical_radius, corner_radii.bottom_right.vertical_radius);
+    Gfx::IntSize mask_size {
+        min(shadow_size.width(), left_radius + right_radius + margin * 2 + 1),
+        min(shadow_size.height(), top_radius + bottom_radius + margin * 2 + 1),
+    };
+    if (mask_size.is_empty())
+        return nullptr;
+
+    BoxShadowMaskKey key { mask_size, corner_radii, blur_radius };
+    auto& cache = cached_box_shadow_masks();
+    if (auto it = cache.masks.find(key); it != cache.masks.end())
+        return it->value.has_value() ? &it->value.value() : nullptr;
+
+    Gfx::IntSize image_size { mask_size.width() + margin * 2, mask_size.height() + margin * 2 };
+    auto byte_size = static_cast<size_t>(image_size.width()) * image_size.height();
+    if (byte_size > box_shadow_mask_cache_byte_limit / 4) {
+        cache.masks.set(key, {});
+        return nullptr;
+    }
+    if (cache.byte_size + byte_size > box_shadow_mask_cache_byte_limit) {
+        cache.masks.clear();
+        cache.byte_size = 0;
+    }
+
+    auto mask_surface = SkSurfaces::Raster(SkImageInfo::MakeA8(image_size.width(), image_size.height()));
+    if (!mask_surface) {
+        cache.masks.set(key, {});
+        return nullptr;
+    }
+    mask_surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+    mask_surface->getCanvas()->drawRRect(to_skia_rrect(Gfx::IntRect { { margin, margin }, mask_size }, corner_radii), paint);
+
+    // NB: If the mask didn't need shrinking along an axis, it's drawn at its own size there and any center will do.
+    auto center_x = mask_size.width() < shadow_size.width() ? margin * 2 + left_radius : image_size.width() / 2;
+    auto center_y = mask_size.height() < shadow_size.height() ? margin * 2 + top_radius : image_size.height() / 2;
+
+    cache.byte_size += byte_size;
+    auto& mask = cache.masks.ensure(key, [&]() -> Optional<BoxShadowMask> {
+        return BoxShadowMask {
+            .image = mask_surface->makeImageSnapshot(),
+            .center = SkIRect::MakeXYWH(center_x, center_y, 1, 1),
+            .margin = margin,
+        };
+    });
+    return &mask.value();
+}
+
 void DisplayListPlayerSkia::add_mask(AddMask const& command)
 {
     auto const& rect = command.rect;
@@ -890,4 +1032,15 @@ bool DisplayListPlayerSkia::would_be_fully_clipped_by_painter(Gfx::IntRect rect)
     return surface().canvas().quickReject(to_skia_rect(rect));
 }
 
+Gfx::IntRect DisplayListPlayerSkia::device_rect_for(Gfx::IntRect rect) const
+{
+    auto& canvas = surface().canvas();
+    auto device_rect = canvas.getLocalToDeviceAs3x3().mapRect(to_skia_rect(rect)).roundOut();
+    // NB: Anti-aliasing can touch one more pixel on each side.
+    device_rect.outset(1, 1);
+    if (!device_rect.intersect(canvas.getDeviceClipBounds()))
+        return {};
+    return { device_rect.x(), device_rect.y(), device_rect.width(), device_rect.height() };
+}
+
 }
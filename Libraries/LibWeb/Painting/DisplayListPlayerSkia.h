@@ -21,6 +21,8 @@ public:
     DisplayListPlayerSkia();
     ~DisplayListPlayerSkia();
 
+    bool is_gpu_backed() const { return m_context; }
+
 private:
     void flush() override;
     void draw_glyph_run(DrawGlyphRun const&) override;
@@ -57,12 +59,19 @@ private:
     void add_clip_path(Gfx::Path const&) override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
+    Gfx::IntRect device_rect_for(Gfx::IntRect) const override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
 
     struct CachedRuntimeEffects;
     OwnPtr<CachedRuntimeEffects> m_cached_runtime_effects;
     CachedRuntimeEffects& cached_runtime_effects();
+
+    struct BoxShadowMask;
+    struct CachedBoxShadowMasks;
+    OwnPtr<CachedBoxShadowMasks> m_cached_box_shadow_masks;
+    CachedBoxShadowMasks& cached_box_shadow_masks();
+    BoxShadowMask const* box_shadow_mask(Gfx::IntSize shadow_size, CornerRadii const&, int blur_radius);
 };
 
 }
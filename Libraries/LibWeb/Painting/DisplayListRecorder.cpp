@@ -58,6 +58,13 @@ void DisplayListRecorder::fill_rect(Gfx::IntRect const& rect, Color color)
     APPEND(FillRect { rect, color });
 }
 
+void DisplayListRecorder::paint_caret(Gfx::IntRect const& rect, Color color)
+{
+    if (rect.is_empty() || color.alpha() == 0)
+        return;
+    APPEND(PaintCaret { rect, color });
+}
+
 void DisplayListRecorder::fill_rect_transparent(Gfx::IntRect const& rect)
 {
     if (rect.is_empty())
@@ -241,6 +248,29 @@ void DisplayListRecorder::draw_glyph_run(Gfx::FloatPoint baseline_start, Gfx::Gl
     if (color.alpha() == 0)
         return;
     glyph_run.ensure_text_blob(scale);
+
+    // OPTIMIZATION: Text-dense content records long sequences of glyph runs that only differ in their position. Rather
+    //               than giving each of them a command, we append them to the preceding glyph run command when it uses
+    //               the same paint, so the player only has to set that up once.
+    if (orientation == Orientation::Horizontal) {
+        auto& commands = m_display_list.commands({});
+        if (!commands.is_empty()) {
+            auto& last_item = commands[commands.size() - 1];
+            auto* previous_command = last_item.command.get_pointer<DrawGlyphRun>();
+            if (previous_command
+                && last_item.context == m_accumulated_visual_context
+                && previous_command->orientation == Orientation::Horizontal
+                && previous_command->color == color) {
+                previous_command->merged_glyph_runs.append({
+                    .glyph_run = glyph_run,
+                    .rect = rect,
+                    .translation = baseline_start,
+                });
+                return;
+            }
+        }
+    }
+
     APPEND(DrawGlyphRun {
         .glyph_run = glyph_run,
         .rect = rect,
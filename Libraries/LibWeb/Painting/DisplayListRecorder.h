@@ -37,6 +37,7 @@ class WEB_API DisplayListRecorder {
 public:
     void fill_rect(Gfx::IntRect const& rect, Color color);
     void fill_rect_transparent(Gfx::IntRect const& rect);
+    void paint_caret(Gfx::IntRect const& rect, Color color);
 
     struct FillPathParams {
         Gfx::Path path;
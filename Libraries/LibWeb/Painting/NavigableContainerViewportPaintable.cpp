@@ -56,7 +56,10 @@ void NavigableContainerViewportPaintable::paint(DisplayListRecordingContext& con
         HTML::PaintConfig paint_config;
         paint_config.paint_overlay = context.should_paint_overlay();
         paint_config.should_show_line_box_borders = context.should_show_line_box_borders();
-        auto display_list = const_cast<DOM::Document*>(hosted_document)->record_display_list(paint_config);
+        auto& mutable_hosted_document = const_cast<DOM::Document&>(*hosted_document);
+        auto display_list = mutable_hosted_document.record_display_list(paint_config);
+        // NB: We're recording our document's display list from scratch, so it won't reference the one this replaced.
+        mutable_hosted_document.release_superseded_display_list();
         context.display_list_recorder().paint_nested_display_list(display_list, context.enclosing_device_rect(absolute_rect).to_type<int>());
 
         context.display_list_recorder().restore();
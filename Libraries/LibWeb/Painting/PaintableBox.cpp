@@ -960,8 +960,31 @@ bool PaintableBox::resizer_contains(CSSPixelPoint adjusted_position, ChromeMetri
     return handle_rect->contains(adjusted_position);
 }
 
+bool PaintableBox::is_outside_hit_test_bounds(CSSPixelPoint position, HitTestType type) const
+{
+    // NB: Other hit test types also look for the closest candidate, which may lie outside of the bounds.
+    if (type != HitTestType::Exact || !m_hit_test_bounds.has_value())
+        return false;
+
+    auto local_position = position;
+    if (auto state = accumulated_visual_context()) {
+        auto const& scroll_state = document().paintable()->scroll_state_snapshot();
+        auto transformed_position = state->transform_point_for_hit_test(position, scroll_state);
+
+        // NB: Everything within the bounds shares our visual context, so if it clips the position away, nothing in
+        //     this subtree can be hit.
+        if (!transformed_position.has_value())
+            return true;
+        local_position = transformed_position.release_value();
+    }
+    return !m_hit_test_bounds->contains(local_position);
+}
+
 TraversalDecision PaintableBox::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
+    if (is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     auto const is_visible = computed_values().visibility() == CSS::Visibility::Visible;
 
     // Only hit test chrome (scrollbars, etc.) for visible elements.
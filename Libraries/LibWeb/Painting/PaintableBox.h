@@ -241,6 +241,12 @@ public:
     void set_accumulated_visual_context_for_descendants(auto state) { m_accumulated_visual_context_for_descendants = move(state); }
     [[nodiscard]] auto accumulated_visual_context_for_descendants() const { return m_accumulated_visual_context_for_descendants; }
 
+    // The area, in the coordinate space of this box's accumulated visual context, that contains everything in this
+    // subtree that can be hit. None if some of it lives in a different coordinate space, e.g. behind a transform or
+    // a scroll container, in which case the subtree can't be skipped.
+    void set_hit_test_bounds(Optional<CSSPixelRect> bounds) { m_hit_test_bounds = bounds; }
+    [[nodiscard]] bool is_outside_hit_test_bounds(CSSPixelPoint, HitTestType) const;
+
     [[nodiscard]] RefPtr<ScrollFrame const> enclosing_scroll_frame() const { return m_enclosing_scroll_frame; }
     [[nodiscard]] Optional<int> scroll_frame_id() const;
     [[nodiscard]] CSSPixelPoint cumulative_offset_of_enclosing_scroll_frame() const;
@@ -312,6 +318,7 @@ private:
     RefPtr<ScrollFrame const> m_own_scroll_frame;
     RefPtr<AccumulatedVisualContext const> m_accumulated_visual_context;
     RefPtr<AccumulatedVisualContext const> m_accumulated_visual_context_for_descendants;
+    Optional<CSSPixelRect> m_hit_test_bounds;
 
     Optional<BordersDataWithElementKind> m_override_borders_data;
     Optional<TableCellCoordinates> m_table_cell_coordinates;
@@ -76,6 +76,9 @@ void PaintableWithLines::paint_text_fragment_debug_highlight(DisplayListRecordin
 
 TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
+    if (is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     auto const is_visible = computed_values().visibility() == CSS::Visibility::Visible;
 
     // TextCursor hit testing mode should be able to place cursor in contenteditable elements even if they are empty
@@ -430,9 +433,6 @@ void paint_cursor_if_needed(DisplayListRecordingContext& context, TextPaintable
     if (!navigable.is_focused())
         return;
 
-    if (!document.cursor_blink_state())
-        return;
-
     auto cursor_position = document.cursor_position();
     if (!cursor_position)
         return;
@@ -462,7 +462,8 @@ void paint_cursor_if_needed(DisplayListRecordingContext& context, TextPaintable
 
     auto cursor_device_rect = context.rounded_device_rect(cursor_rect).to_type<int>();
 
-    context.display_list_recorder().fill_rect(cursor_device_rect, caret_color);
+    // NB: The player takes care of the caret's blink state, see PaintCaret.
+    context.display_list_recorder().paint_caret(cursor_device_rect, caret_color);
 }
 
 void paint_text_decoration(DisplayListRecordingContext& context, TextPaintable const& paintable, PaintableFragment::FragmentSpan const& span)
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibThreading/Thread.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/ParallelRasterizer.h>
+
+#include <core/SkCanvas.h>
+
+namespace Web::Painting {
+
+// NB: Past this many bands, the cost of walking the whole display list once per band outweighs the extra cores.
+static constexpr size_t max_band_count = 8;
+
+OwnPtr<ParallelRasterizer> ParallelRasterizer::create_if_supported()
+{
+    auto band_count = min(static_cast<size_t>(Core::System::hardware_concurrency()), max_band_count);
+    if (band_count <= 1)
+        return nullptr;
+    return adopt_own(*new ParallelRasterizer(band_count));
+}
+
+ParallelRasterizer::ParallelRasterizer(size_t band_count)
+{
+    m_bands.ensure_capacity(band_count);
+    for (size_t i = 0; i < band_count; ++i)
+        m_bands.append({ .player = make<DisplayListPlayerSkia>(), .thread = {}, .surface = {}, .rect = {} });
+
+    // NB: The first band is rasterized on the calling thread.
+    for (size_t i = 1; i < band_count; ++i) {
+        m_bands[i].thread = Threading::Thread::construct("Rasterizer"sv, [this, i] {
+            worker_loop(i);
+            return static_cast<intptr_t>(0);
+        });
+        m_bands[i].thread->start();
+    }
+}
+
+ParallelRasterizer::~ParallelRasterizer()
+{
+    {
+        Threading::MutexLocker const locker { m_mutex };
+        m_exit = true;
+        m_frame_ready.broadcast();
+    }
+    for (auto& band : m_bands) {
+        if (band.thread)
+            (void)band.thread->join();
+    }
+}
+
+void ParallelRasterizer::rasterize_band(Band& band)
+{
+    if (!band.surface)
+        return;
+    band.player->set_should_paint_caret(m_should_paint_caret);
+    band.surface->canvas().translate(0, -band.rect.y());
+    band.player->execute(*m_display_list, ScrollStateSnapshotByDisplayList(*m_scroll_state_snapshot), band.surface, band.rect);
+}
+
+void ParallelRasterizer::worker_loop(size_t band_index)
+{
+    u64 last_frame_generation = 0;
+    while (true) {
+        {
+            Threading::MutexLocker const locker { m_mutex };
+            while (m_frame_generation == last_frame_generation && !m_exit)
+                m_frame_ready.wait();
+            if (m_exit)
+                return;
+            last_frame_generation = m_frame_generation;
+        }
+
+        rasterize_band(m_bands[band_index]);
+
+        Threading::MutexLocker const locker { m_mutex };
+        if (--m_pending_bands == 0)
+            m_band_done.signal();
+    }
+}
+
+bool ParallelRasterizer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot, Gfx::PaintingSurface& surface, bool should_paint_caret)
+{
+    auto size = surface.size();
+    auto band_height = ceil_div(size.height(), static_cast<int>(m_bands.size()));
+    for (size_t i = 0; i < m_bands.size(); ++i) {
+        auto& band = m_bands[i];
+        band.rect = Gfx::IntRect { 0, static_cast<int>(i) * band_height, size.width(), band_height }.intersected({ {}, size });
+        band.surface = band.rect.is_empty() ? nullptr : surface.raster_subsurface(band.rect);
+        if (!band.surface && !band.rect.is_empty()) {
+            for (auto& other_band : m_bands)
+                other_band.surface = nullptr;
+            return false;
+        }
+    }
+
+    m_display_list = &display_list;
+    m_scroll_state_snapshot = &scroll_state_snapshot;
+    m_should_paint_caret = should_paint_caret;
+
+    {
+        Threading::MutexLocker const locker { m_mutex };
+        m_pending_bands = m_bands.size() - 1;
+        ++m_frame_generation;
+        m_frame_ready.broadcast();
+    }
+
+    rasterize_band(m_bands[0]);
+
+    {
+        Threading::MutexLocker const locker { m_mutex };
+        while (m_pending_bands > 0)
+            m_band_done.wait();
+    }
+
+    m_caret_device_rects.clear_with_capacity();
+    for (auto& band : m_bands) {
+        if (!band.surface)
+            continue;
+        for (auto const& caret_device_rect : band.player->caret_device_rects())
+            m_caret_device_rects.append(caret_device_rect.translated(0, band.rect.y()));
+        // NB: The band surfaces point into the target's pixels, so they must not outlive this call.
+        band.surface = nullptr;
+    }
+
+    m_display_list = nullptr;
+    m_scroll_state_snapshot = nullptr;
+    return true;
+}
+
+}
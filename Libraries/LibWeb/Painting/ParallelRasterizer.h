@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibGfx/Rect.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Forward.h>
+#include <LibThreading/Mutex.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/Painting/ScrollState.h>
+
+namespace Web::Painting {
+
+// Rasterizes a display list into a CPU-backed surface by splitting it into horizontal bands and painting each band on
+// its own thread. Every band clips to its own rect, so the player culls every command that doesn't overlap it.
+class ParallelRasterizer {
+    AK_MAKE_NONCOPYABLE(ParallelRasterizer);
+    AK_MAKE_NONMOVABLE(ParallelRasterizer);
+
+public:
+    // Returns null if this machine doesn't have more than one core to rasterize on.
+    static OwnPtr<ParallelRasterizer> create_if_supported();
+
+    ~ParallelRasterizer();
+
+    // Returns false without painting anything if the surface isn't CPU-backed.
+    bool execute(DisplayList&, ScrollStateSnapshotByDisplayList const&, Gfx::PaintingSurface&, bool should_paint_caret);
+
+    Vector<Gfx::IntRect> const& caret_device_rects() const { return m_caret_device_rects; }
+
+private:
+    explicit ParallelRasterizer(size_t band_count);
+
+    struct Band {
+        NonnullOwnPtr<DisplayListPlayerSkia> player;
+        RefPtr<Threading::Thread> thread;
+        RefPtr<Gfx::PaintingSurface> surface;
+        Gfx::IntRect rect;
+    };
+
+    void rasterize_band(Band&);
+    void worker_loop(size_t band_index);
+
+    Vector<Band> m_bands;
+    Vector<Gfx::IntRect> m_caret_device_rects;
+
+    // NB: Only valid while a frame is being rasterized.
+    DisplayList* m_display_list { nullptr };
+    ScrollStateSnapshotByDisplayList const* m_scroll_state_snapshot { nullptr };
+    bool m_should_paint_caret { true };
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_frame_ready { m_mutex };
+    Threading::ConditionVariable m_band_done { m_mutex };
+    u64 m_frame_generation { 0 };
+    size_t m_pending_bands { 0 };
+    bool m_exit { false };
+};
+
+}
@@ -28,6 +28,7 @@ void SVGPathPaintable::reset_for_relayout()
 {
     SVGGraphicsPaintable::reset_for_relayout();
     m_computed_path.clear();
+    m_device_path.clear();
 }
 
 TraversalDecision SVGPathPaintable::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
@@ -81,8 +82,12 @@ void SVGPathPaintable::paint(DisplayListRecordingContext& context, PaintPhase ph
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
-    path.offset(offset);
+    if (!m_device_path.has_value() || m_device_path->paint_transform != paint_transform || m_device_path->offset != offset) {
+        auto device_path = computed_path()->copy_transformed(paint_transform);
+        device_path.offset(offset);
+        m_device_path = DevicePath { paint_transform, offset, move(device_path) };
+    }
+    auto const& path = m_device_path->path;
 
     auto svg_viewport = [&] {
         if (maybe_view_box.has_value())
@@ -29,6 +29,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_device_path.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -45,6 +46,15 @@ private:
 
     virtual void resolve_paint_properties() override;
 
+    // The computed path transformed to device pixels by the last paint, which is reused as long as the transform
+    // and offset stay the same.
+    struct DevicePath {
+        Gfx::AffineTransform paint_transform;
+        Gfx::FloatPoint offset;
+        Gfx::Path path;
+    };
+    mutable Optional<DevicePath> m_device_path;
+
     float m_stroke_thickness { 0 };
     float m_stroke_dashoffset { 0 };
     Vector<float> m_stroke_dasharray;
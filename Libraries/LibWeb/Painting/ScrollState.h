@@ -21,6 +21,8 @@ public:
         return own_offsets[id];
     }
 
+    bool operator==(ScrollStateSnapshot const&) const = default;
+
 private:
     Vector<CSSPixelPoint> own_offsets;
 };
@@ -10,6 +10,7 @@
 #include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibGfx/Rect.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Painting/DisplayList.h>
@@ -229,6 +230,18 @@ void StackingContext::paint_internal(DisplayListRecordingContext& context) const
     paint_node(paintable_box(), context, PaintPhase::Background);
     paint_node(paintable_box(), context, PaintPhase::Border);
 
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // NB: content-visibility: auto turns on paint containment, so every descendant of an element that skips its
+    //     contents is painted as part of this stacking context, and we can skip all of them at once.
+    if (paintable_box().computed_values().content_visibility() == CSS::ContentVisibility::Auto) {
+        if (auto* element = as_if<DOM::Element>(const_cast<DOM::Node*>(paintable_box().dom_node().ptr())); element && element->skips_its_contents()) {
+            paint_node(paintable_box(), context, PaintPhase::Outline);
+            if (context.should_paint_overlay())
+                paint_node(paintable_box(), context, PaintPhase::Overlay);
+            return;
+        }
+    }
+
     // Stacking contexts formed by positioned descendants with negative z-indices (excluding 0) in z-index order
     // (most negative first) then tree order. (step 3)
     // Here, we treat non-positioned stacking contexts as if they were positioned, because CSS 2.0 spec does not
@@ -347,6 +360,9 @@ void StackingContext::paint(DisplayListRecordingContext& context) const
 
 TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
+    if (paintable_box().is_outside_hit_test_bounds(position, type))
+        return TraversalDecision::Continue;
+
     auto const is_visible = paintable_box().computed_values().visibility() == CSS::Visibility::Visible;
 
     // NOTE: Hit testing basically happens in reverse painting order.
@@ -226,6 +226,56 @@ static Optional<Gfx::FloatMatrix4x4> compute_perspective_matrix(PaintableBox con
     return perspective_matrix;
 }
 
+// Returns whether everything between a descendant's visual context and that of its ancestor leaves positions unchanged,
+// i.e. whether only clips and effects lie between them.
+static bool shares_coordinate_space(AccumulatedVisualContext const* context, AccumulatedVisualContext const* ancestor_context)
+{
+    for (; context != ancestor_context; context = context->parent().ptr()) {
+        if (!context)
+            return false;
+        if (!context->is_effect() && !context->data().has<ClipData>() && !context->data().has<ClipPathData>())
+            return false;
+    }
+    return true;
+}
+
+static Optional<CSSPixelRect> assign_hit_test_bounds(PaintableBox& paintable_box)
+{
+    Optional<CSSPixelRect> bounds = paintable_box.absolute_border_box_rect();
+
+    // NB: SVG shapes are hit tested against their path, which isn't confined to the border box. Scroll containers have
+    //     to see positions outside of them too, so that their scrollbars can shrink back once they are left.
+    if (paintable_box.is_svg_paintable() || paintable_box.own_scroll_frame())
+        bounds = {};
+
+    if (bounds.has_value()) {
+        if (auto const* paintable_with_lines = as_if<PaintableWithLines>(paintable_box)) {
+            for (auto const& fragment : paintable_with_lines->fragments())
+                bounds->unite(fragment.absolute_rect());
+        }
+    }
+
+    for (auto* child = paintable_box.first_child(); child; child = child->next_sibling()) {
+        auto* child_box = as_if<PaintableBox>(*child);
+        if (!child_box) {
+            if (child->has_children())
+                bounds = {};
+            continue;
+        }
+
+        auto child_bounds = assign_hit_test_bounds(*child_box);
+        if (!bounds.has_value())
+            continue;
+        if (!child_bounds.has_value() || !shares_coordinate_space(child_box->accumulated_visual_context().ptr(), paintable_box.accumulated_visual_context().ptr()))
+            bounds = {};
+        else
+            bounds->unite(*child_bounds);
+    }
+
+    paintable_box.set_hit_test_bounds(bounds);
+    return bounds;
+}
+
 void ViewportPaintable::assign_accumulated_visual_contexts()
 {
     m_next_accumulated_visual_context_id = 1;
@@ -379,6 +429,13 @@ void ViewportPaintable::assign_accumulated_visual_contexts()
 
         return TraversalDecision::Continue;
     });
+
+    // NB: The viewport itself is always hit tested, so its children are the roots of the bounds hierarchy.
+    set_hit_test_bounds({});
+    for_each_child_of_type<PaintableBox>([&](auto& paintable_box) {
+        (void)assign_hit_test_bounds(paintable_box);
+        return IterationDecision::Continue;
+    });
 }
 
 void ViewportPaintable::refresh_scroll_state()
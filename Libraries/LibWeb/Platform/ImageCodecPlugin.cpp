@@ -11,6 +11,8 @@ namespace Web::Platform {
 
 static ImageCodecPlugin* s_the;
 
+StreamedAnimation::~StreamedAnimation() = default;
+
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
 ImageCodecPlugin& ImageCodecPlugin::the()
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/Function.h>
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibCore/Promise.h>
@@ -21,11 +23,27 @@ struct Frame {
     size_t duration { 0 };
 };
 
+// An animation that is too large to be decoded all at once. Its frames are decoded a few at a time, as they're needed.
+class WEB_API StreamedAnimation : public RefCounted<StreamedAnimation> {
+public:
+    virtual ~StreamedAnimation();
+
+    // Asynchronously decodes the given frames and passes them to on_frames_decoded. Frames that fail to decode are null.
+    // If the animation can't be decoded any further (e.g. because the decoder went away), on_error is called instead.
+    virtual void request_frames(size_t first_frame_index, size_t frame_count) = 0;
+
+    Function<void(size_t first_frame_index, Vector<RefPtr<Gfx::Bitmap>>)> on_frames_decoded;
+    Function<void(Error)> on_error;
+};
+
 struct DecodedImage {
     bool is_animated { false };
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // If set, only the first few frames have a bitmap, and the rest have to be requested from here.
+    RefPtr<StreamedAnimation> streamed_animation;
 };
 
 class WEB_API ImageCodecPlugin {
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/Array.h>
 #include <AK/Base64.h>
 #include <AK/Vector.h>
 #include <LibCrypto/Hash/SHA2.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/SRI/SRI.h>
 
 namespace Web::SRI {
@@ -188,4 +190,76 @@ ErrorOr<bool> do_bytes_match_metadata_list(ByteBuffer const& bytes, StringView m
     return false;
 }
 
+void do_bytes_match_metadata_list_in_background(ByteBuffer bytes, StringView metadata_list, MatchMetadataListCallback on_complete)
+{
+    auto parsed_metadata_or_error = parse_metadata(metadata_list);
+    if (parsed_metadata_or_error.is_error()) {
+        on_complete(move(bytes), parsed_metadata_or_error.release_error());
+        return;
+    }
+    auto parsed_metadata = parsed_metadata_or_error.release_value();
+
+    if (parsed_metadata.is_empty()) {
+        on_complete(move(bytes), true);
+        return;
+    }
+
+    auto metadata_or_error = get_strongest_metadata_from_set(parsed_metadata);
+    if (metadata_or_error.is_error()) {
+        on_complete(move(bytes), metadata_or_error.release_error());
+        return;
+    }
+    auto metadata = metadata_or_error.release_value();
+
+    // NB: The strongest metadata all uses the same algorithm, so the bytes only need hashing once. Only that algorithm
+    //     and the bytes are handed to the background thread, which gives back the bytes along with the raw digest.
+    //     Encoding it and comparing it against the expected values happens back on this thread.
+    enum class Algorithm : u8 {
+        SHA256,
+        SHA384,
+        SHA512,
+    };
+    auto algorithm = [&] {
+        if (metadata.first().algorithm == "sha256"sv)
+            return Algorithm::SHA256;
+        if (metadata.first().algorithm == "sha384"sv)
+            return Algorithm::SHA384;
+        if (metadata.first().algorithm == "sha512"sv)
+            return Algorithm::SHA512;
+        VERIFY_NOT_REACHED();
+    }();
+
+    struct HashResult {
+        ByteBuffer bytes;
+        ByteBuffer digest;
+    };
+    (void)Threading::BackgroundAction<HashResult>::construct(
+        [bytes = move(bytes), algorithm](auto&) mutable -> ErrorOr<HashResult> {
+            auto digest = TRY([&]() -> ErrorOr<ByteBuffer> {
+                switch (algorithm) {
+                case Algorithm::SHA256:
+                    return ByteBuffer::copy(Crypto::Hash::SHA256::hash(bytes).bytes());
+                case Algorithm::SHA384:
+                    return ByteBuffer::copy(Crypto::Hash::SHA384::hash(bytes).bytes());
+                case Algorithm::SHA512:
+                    return ByteBuffer::copy(Crypto::Hash::SHA512::hash(bytes).bytes());
+                }
+                VERIFY_NOT_REACHED();
+            }());
+            return HashResult { move(bytes), move(digest) };
+        },
+        [metadata = move(metadata), on_complete = move(on_complete)](HashResult result) mutable -> ErrorOr<void> {
+            auto actual_value_or_error = encode_base64(result.digest);
+            if (actual_value_or_error.is_error()) {
+                on_complete(move(result.bytes), actual_value_or_error.release_error());
+                return {};
+            }
+            auto actual_value = actual_value_or_error.release_value();
+
+            auto matches = any_of(metadata, [&](auto const& item) { return actual_value == item.base64_value; });
+            on_complete(move(result.bytes), matches);
+            return {};
+        });
+}
+
 }
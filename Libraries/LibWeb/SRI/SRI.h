@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <LibWeb/Export.h>
 
@@ -23,4 +25,9 @@ WEB_API ErrorOr<Vector<Metadata>> parse_metadata(StringView metadata);
 ErrorOr<Vector<Metadata>> get_strongest_metadata_from_set(Vector<Metadata> const& set);
 WEB_API ErrorOr<bool> do_bytes_match_metadata_list(ByteBuffer const& bytes, StringView metadata_list);
 
+// Like do_bytes_match_metadata_list(), but the bytes are hashed on a background thread. Once that is done, on_complete
+// is called on this thread with the bytes and the result.
+using MatchMetadataListCallback = Function<void(ByteBuffer, ErrorOr<bool>)>;
+WEB_API void do_bytes_match_metadata_list_in_background(ByteBuffer bytes, StringView metadata_list, MatchMetadataListCallback on_complete);
+
 }
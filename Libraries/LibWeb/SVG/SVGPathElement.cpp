@@ -33,6 +33,7 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 
     if (name == "d") {
         m_path = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_gfx_path.clear();
         if (layout_node())
             layout_node()->set_needs_layout_update(DOM::SetNeedsLayoutReason::StyleChange);
     }
@@ -40,7 +41,9 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return m_path.to_gfx_path();
+    if (!m_gfx_path.has_value())
+        m_gfx_path = m_path.to_gfx_path();
+    return *m_gfx_path;
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibGfx/Path.h>
 #include <LibWeb/SVG/Path.h>
 #include <LibWeb/SVG/SVGGeometryElement.h>
 
@@ -28,6 +29,9 @@ private:
     virtual void initialize(JS::Realm&) override;
 
     Path m_path {};
+
+    // The path built from m_path, which is reused until the "d" attribute changes.
+    Optional<Gfx::Path> m_gfx_path;
 };
 
 }
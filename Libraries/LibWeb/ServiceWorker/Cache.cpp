@@ -0,0 +1,1425 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibTextCodec/Decoder.h>
+#include <LibTextCodec/Encoder.h>
+#include <LibURL/Parser.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/PolicyContainers.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/ServiceWorker/ServiceWorkerGlobalScope.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/Promise.h>
+#include <LibWeb/WebIDL/QuotaExceededError.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(Cache);
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm, GC::Ref<StorageAPI::StorageBottle> storage_bottle, NonnullRefPtr<RequestResponseList> request_response_list)
+{
+    return realm.create<Cache>(realm, storage_bottle, move(request_response_list));
+}
+
+Cache::Cache(JS::Realm& realm, GC::Ref<StorageAPI::StorageBottle> storage_bottle, NonnullRefPtr<RequestResponseList> request_response_list)
+    : Bindings::PlatformObject(realm)
+    , m_storage_bottle(storage_bottle)
+    , m_request_response_list(move(request_response_list))
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+}
+
+void Cache::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_storage_bottle);
+}
+
+CachedRequestResponse::CachedRequestResponse(Fetch::Infrastructure::Request const& request, Fetch::Infrastructure::Response& response)
+    : request_method(request.method())
+    , request_url(request.url())
+    , request_header_list(HTTP::HeaderList::create(request.header_list()->headers()))
+    , response_type(response.type())
+{
+    auto internal_response = response.unsafe_response();
+    response_url_list = internal_response->url_list();
+    response_status = internal_response->status();
+    response_status_message = internal_response->status_message();
+    response_header_list = HTTP::HeaderList::create(internal_response->header_list()->headers());
+    response_cors_exposed_header_name_list = internal_response->cors_exposed_header_name_list();
+    response_request_includes_credentials = internal_response->request_includes_credentials();
+}
+
+static String request_response_list_key(StringView cache_id)
+{
+    return MUST(String::formatted("cache:{}", cache_id));
+}
+
+// NB: Header names and values are byte sequences, which are isomorphic decoded so that they can be stored as strings.
+static JsonArray serialize_header_list(HTTP::HeaderList const& header_list)
+{
+    JsonArray result;
+
+    for (auto const& header : header_list.headers()) {
+        JsonArray name_and_value;
+        name_and_value.must_append(TextCodec::isomorphic_decode(header.name));
+        name_and_value.must_append(TextCodec::isomorphic_decode(header.value));
+        result.must_append(move(name_and_value));
+    }
+
+    return result;
+}
+
+static Optional<NonnullRefPtr<HTTP::HeaderList>> deserialize_header_list(Optional<JsonArray const&> array)
+{
+    if (!array.has_value())
+        return {};
+
+    auto header_list = HTTP::HeaderList::create();
+
+    for (auto const& value : array->values()) {
+        if (!value.is_array() || value.as_array().size() != 2)
+            return {};
+
+        auto const& name = value.as_array().at(0);
+        auto const& header_value = value.as_array().at(1);
+        if (!name.is_string() || !header_value.is_string())
+            return {};
+
+        header_list->append({ TextCodec::isomorphic_encode(name.as_string()), TextCodec::isomorphic_encode(header_value.as_string()) });
+    }
+
+    return header_list;
+}
+
+static JsonObject serialize_cached_request_response(CachedRequestResponse const& entry)
+{
+    JsonObject object;
+    object.set("requestMethod"sv, TextCodec::isomorphic_decode(entry.request_method));
+    object.set("requestURL"sv, entry.request_url.serialize());
+    object.set("requestHeaders"sv, serialize_header_list(*entry.request_header_list));
+
+    JsonArray url_list;
+    for (auto const& url : entry.response_url_list)
+        url_list.must_append(url.serialize());
+
+    JsonArray cors_exposed_header_name_list;
+    for (auto const& name : entry.response_cors_exposed_header_name_list)
+        cors_exposed_header_name_list.must_append(TextCodec::isomorphic_decode(name));
+
+    object.set("responseType"sv, to_underlying(entry.response_type));
+    object.set("responseURLList"sv, move(url_list));
+    object.set("responseStatus"sv, entry.response_status);
+    object.set("responseStatusMessage"sv, TextCodec::isomorphic_decode(entry.response_status_message));
+    object.set("responseHeaders"sv, serialize_header_list(*entry.response_header_list));
+    object.set("responseCORSExposedHeaderNames"sv, move(cors_exposed_header_name_list));
+    object.set("responseRequestIncludesCredentials"sv, entry.response_request_includes_credentials);
+
+    if (entry.response_body_id.has_value())
+        object.set("responseBody"sv, *entry.response_body_id);
+
+    return object;
+}
+
+static RefPtr<CachedRequestResponse> deserialize_cached_request_response(JsonObject const& object)
+{
+    auto entry = make_ref_counted<CachedRequestResponse>();
+
+    auto request_method = object.get_string("requestMethod"sv);
+    auto request_url = object.get_string("requestURL"sv);
+    auto request_header_list = deserialize_header_list(object.get_array("requestHeaders"sv));
+    if (!request_method.has_value() || !request_url.has_value() || !request_header_list.has_value())
+        return {};
+
+    auto parsed_request_url = URL::Parser::basic_parse(*request_url);
+    if (!parsed_request_url.has_value())
+        return {};
+
+    entry->request_method = TextCodec::isomorphic_encode(*request_method);
+    entry->request_url = parsed_request_url.release_value();
+    entry->request_header_list = request_header_list.release_value();
+
+    auto response_type = object.get_integer<u8>("responseType"sv);
+    auto response_url_list = object.get_array("responseURLList"sv);
+    auto response_status = object.get_integer<Fetch::Infrastructure::Status>("responseStatus"sv);
+    auto response_status_message = object.get_string("responseStatusMessage"sv);
+    auto response_header_list = deserialize_header_list(object.get_array("responseHeaders"sv));
+    auto response_cors_exposed_header_name_list = object.get_array("responseCORSExposedHeaderNames"sv);
+    auto response_request_includes_credentials = object.get_bool("responseRequestIncludesCredentials"sv);
+    if (!response_type.has_value() || *response_type > to_underlying(Fetch::Infrastructure::Response::Type::OpaqueRedirect)
+        || !response_url_list.has_value() || !response_status.has_value() || !response_status_message.has_value()
+        || !response_header_list.has_value() || !response_cors_exposed_header_name_list.has_value()
+        || !response_request_includes_credentials.has_value())
+        return {};
+
+    entry->response_type = static_cast<Fetch::Infrastructure::Response::Type>(*response_type);
+    entry->response_status = *response_status;
+    entry->response_status_message = TextCodec::isomorphic_encode(*response_status_message);
+    entry->response_header_list = response_header_list.release_value();
+    entry->response_request_includes_credentials = *response_request_includes_credentials;
+
+    for (auto const& value : response_url_list->values()) {
+        if (!value.is_string())
+            return {};
+        auto url = URL::Parser::basic_parse(value.as_string());
+        if (!url.has_value())
+            return {};
+        entry->response_url_list.append(url.release_value());
+    }
+
+    for (auto const& value : response_cors_exposed_header_name_list->values()) {
+        if (!value.is_string())
+            return {};
+        entry->response_cors_exposed_header_name_list.append(TextCodec::isomorphic_encode(value.as_string()));
+    }
+
+    if (auto response_body_id = object.get_string("responseBody"sv); response_body_id.has_value())
+        entry->response_body_id = *response_body_id;
+
+    return entry;
+}
+
+// NB: The bodies of cached responses are kept out of the storage bottle, so that they are stored as binary data, and
+//     without waiting on the storage jar. RequestServer stores the bodies of local storage bottles, while the bodies of
+//     session storage bottles only live as long as this process.
+static HashMap<String, ByteBuffer>& session_response_bodies()
+{
+    static HashMap<String, ByteBuffer> bodies;
+    return bodies;
+}
+
+static ByteString storage_key_for_response_bodies(StorageAPI::LocalStorageBottle const& storage_bottle)
+{
+    return storage_bottle.storage_key().to_string().to_byte_string();
+}
+
+static void store_response_body(StorageAPI::StorageBottle const& storage_bottle, String const& body_id, ReadonlyBytes body, GC::Ref<GC::Function<void(bool)>> on_complete)
+{
+    if (auto const* local_storage_bottle = as_if<StorageAPI::LocalStorageBottle>(storage_bottle)) {
+        auto promise = ResourceLoader::the().request_client()->store_cache_storage_body(storage_key_for_response_bodies(*local_storage_bottle), body_id.to_byte_string(), body);
+
+        promise->when_resolved([on_complete = GC::make_root(on_complete)](bool stored) {
+            on_complete->function()(stored);
+        });
+        promise->when_rejected([on_complete = GC::make_root(on_complete)](Error&) {
+            on_complete->function()(false);
+        });
+        return;
+    }
+
+    auto copy = ByteBuffer::copy(body);
+    if (copy.is_error()) {
+        on_complete->function()(false);
+        return;
+    }
+
+    session_response_bodies().set(body_id, copy.release_value());
+    on_complete->function()(true);
+}
+
+static void retrieve_response_body(StorageAPI::StorageBottle const& storage_bottle, String const& body_id, GC::Ref<GC::Function<void(Optional<ByteBuffer>)>> on_complete)
+{
+    if (auto const* local_storage_bottle = as_if<StorageAPI::LocalStorageBottle>(storage_bottle)) {
+        auto promise = ResourceLoader::the().request_client()->retrieve_cache_storage_body(storage_key_for_response_bodies(*local_storage_bottle), body_id.to_byte_string());
+
+        promise->when_resolved([on_complete = GC::make_root(on_complete)](Optional<ByteBuffer>& body) {
+            on_complete->function()(move(body));
+        });
+        promise->when_rejected([on_complete = GC::make_root(on_complete)](Error&) {
+            on_complete->function()({});
+        });
+        return;
+    }
+
+    Optional<ByteBuffer> body;
+    if (auto stored_body = session_response_bodies().get(body_id); stored_body.has_value()) {
+        if (auto copy = ByteBuffer::copy(*stored_body); !copy.is_error())
+            body = copy.release_value();
+    }
+
+    on_complete->function()(move(body));
+}
+
+static void remove_response_body(StorageAPI::StorageBottle const& storage_bottle, String const& body_id)
+{
+    if (auto const* local_storage_bottle = as_if<StorageAPI::LocalStorageBottle>(storage_bottle)) {
+        ResourceLoader::the().request_client()->async_remove_cache_storage_body(storage_key_for_response_bodies(*local_storage_bottle), body_id.to_byte_string());
+        return;
+    }
+
+    session_response_bodies().remove(body_id);
+}
+
+static void parse_request_response_list(RequestResponseList& list, StringView serialized_list)
+{
+    auto json = JsonValue::from_string(serialized_list);
+    if (json.is_error() || !json.value().is_array()) {
+        dbgln("Cache: Ignoring malformed request response list of cache {}", list.cache_id());
+        return;
+    }
+
+    for (auto const& value : json.value().as_array().values()) {
+        RefPtr<CachedRequestResponse> entry;
+        if (value.is_object())
+            entry = deserialize_cached_request_response(value.as_object());
+
+        if (!entry) {
+            dbgln("Cache: Ignoring malformed entry of cache {}", list.cache_id());
+            continue;
+        }
+
+        list.entries.append(entry.release_nonnull());
+    }
+}
+
+// The request response lists that are currently loaded in this process, by the ID of their cache.
+static HashMap<String, WeakPtr<RequestResponseList>>& loaded_request_response_lists()
+{
+    static HashMap<String, WeakPtr<RequestResponseList>> lists;
+    return lists;
+}
+
+RequestResponseList::RequestResponseList(String cache_id)
+    : m_cache_id(move(cache_id))
+{
+}
+
+NonnullRefPtr<RequestResponseList> RequestResponseList::create(String cache_id)
+{
+    auto list = adopt_ref(*new RequestResponseList(move(cache_id)));
+    loaded_request_response_lists().set(list->cache_id(), list->make_weak_ptr());
+    return list;
+}
+
+NonnullRefPtr<RequestResponseList> RequestResponseList::load(StorageAPI::StorageBottle const& storage_bottle, String const& cache_id)
+{
+    if (auto list = loaded_request_response_lists().get(cache_id); list.has_value() && list->ptr())
+        return *list->ptr();
+
+    auto list = create(cache_id);
+
+    // NB: The list is no longer stored if another process deleted its cache.
+    if (auto serialized_list = storage_bottle.get(request_response_list_key(cache_id)); serialized_list.has_value())
+        parse_request_response_list(*list, *serialized_list);
+    else
+        list->m_was_removed = true;
+
+    return list;
+}
+
+WebView::StorageSetResult RequestResponseList::store(StorageAPI::StorageBottle& storage_bottle) const
+{
+    VERIFY(!m_was_removed);
+
+    JsonArray serialized_entries;
+    for (auto const& entry : entries)
+        serialized_entries.must_append(serialize_cached_request_response(entry));
+
+    return storage_bottle.set(request_response_list_key(m_cache_id), serialized_entries.serialized());
+}
+
+void RequestResponseList::remove(StorageAPI::StorageBottle& storage_bottle, String const& cache_id)
+{
+    auto list = load(storage_bottle, cache_id);
+
+    for (auto const& entry : list->entries) {
+        if (entry->response_body_id.has_value())
+            remove_response_body(storage_bottle, *entry->response_body_id);
+    }
+
+    storage_bottle.remove(request_response_list_key(cache_id));
+
+    list->entries.clear();
+    list->m_was_removed = true;
+    loaded_request_response_lists().remove(cache_id);
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+static bool request_matches_cached_item(Fetch::Infrastructure::Request const& request_query, CachedRequestResponse const& cached_item, CacheQueryOptions const& options)
+{
+    // 1. If options["ignoreMethod"] is false and requestQuery’s method is not `GET`, return false.
+    if (!options.ignore_method && request_query.method() != "GET"sv)
+        return false;
+
+    // 2. Let queryURL be requestQuery’s url.
+    auto query_url = request_query.url();
+
+    // 3. Let cachedURL be request’s url.
+    auto cached_url = cached_item.request_url;
+
+    // 4. If options["ignoreSearch"] is true, then:
+    if (options.ignore_search) {
+        // 1. Set cachedURL’s query to the empty string.
+        cached_url.set_query(String {});
+
+        // 2. Set queryURL’s query to the empty string.
+        query_url.set_query(String {});
+    }
+
+    // 5. If queryURL does not equal cachedURL with exclude fragments set to true, then return false.
+    if (!query_url.equals(cached_url, URL::ExcludeFragment::Yes))
+        return false;
+
+    // 6. If response is null, options["ignoreVary"] is true, or response’s header list does not contain `Vary`, then
+    //    return true.
+    if (options.ignore_vary || !cached_item.response_header_list->contains("Vary"sv))
+        return true;
+
+    // 7. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header for
+    //    the value of the header with name `Vary`.
+    bool matches = true;
+
+    // 8. For each fieldValue in fieldValues:
+    cached_item.response_header_list->for_each_vary_header([&](StringView field_value) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request’s header list does not match
+        //    the combined value given fieldValue and requestQuery’s header list, then return false.
+        if (field_value == "*"sv || cached_item.request_header_list->get(field_value) != request_query.header_list()->get(field_value)) {
+            matches = false;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+
+    // 9. Return true.
+    return matches;
+}
+
+// https://w3c.github.io/ServiceWorker/#query-cache
+Vector<NonnullRefPtr<CachedRequestResponse>> Cache::query_cache(Fetch::Infrastructure::Request const& request_query, CacheQueryOptions const& options, ReadonlySpan<NonnullRefPtr<CachedRequestResponse>> storage)
+{
+    // 1. Let resultList be an empty list.
+    Vector<NonnullRefPtr<CachedRequestResponse>> result_list;
+
+    // 2. Let storage be null.
+    // 3. If the optional argument targetStorage is omitted, set storage to the relevant request response list.
+    // 4. Else, set storage to targetStorage.
+
+    // 5. For each requestResponse of storage:
+    for (auto const& request_response : storage) {
+        // 1. Let cachedRequest be requestResponse’s request.
+        // 2. Let cachedResponse be requestResponse’s response.
+        // 3. If Request Matches Cached Item with requestQuery, cachedRequest, cachedResponse, and options returns true,
+        //    then:
+        if (request_matches_cached_item(request_query, request_response, options)) {
+            // 1. Let requestCopy be a copy of cachedRequest.
+            // 2. Let responseCopy be a copy of cachedResponse.
+            // 3. Add requestCopy/responseCopy to resultList.
+            // NB: Cached entries are never modified once stored, so sharing them is indistinguishable from copying.
+            result_list.append(request_response);
+        }
+    }
+
+    // 6. Return resultList.
+    return result_list;
+}
+
+GC::Ref<Fetch::Response> Cache::create_response_object(JS::Realm& realm, CachedRequestResponse const& cached_item, Optional<ByteBuffer> body)
+{
+    auto& vm = realm.vm();
+
+    auto internal_response = Fetch::Infrastructure::Response::create(vm);
+    internal_response->set_url_list(cached_item.response_url_list);
+    internal_response->set_status(cached_item.response_status);
+    internal_response->set_status_message(cached_item.response_status_message);
+    internal_response->set_header_list(HTTP::HeaderList::create(cached_item.response_header_list->headers()));
+    internal_response->set_cors_exposed_header_name_list(cached_item.response_cors_exposed_header_name_list);
+    internal_response->set_request_includes_credentials(cached_item.response_request_includes_credentials);
+
+    // NB: Clearing the site data that was accessed recently may remove a body without the request response list that
+    //     references it, in which case the response is returned without a body.
+    if (body.has_value())
+        internal_response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *body));
+
+    // NB: The internal response is stored, so that the filtered response that was put in the cache can be recreated.
+    GC::Ref<Fetch::Infrastructure::Response> response = internal_response;
+
+    switch (cached_item.response_type) {
+    case Fetch::Infrastructure::Response::Type::Basic:
+        response = Fetch::Infrastructure::BasicFilteredResponse::create(vm, internal_response);
+        break;
+    case Fetch::Infrastructure::Response::Type::CORS:
+        response = Fetch::Infrastructure::CORSFilteredResponse::create(vm, internal_response);
+        break;
+    case Fetch::Infrastructure::Response::Type::Opaque:
+        response = Fetch::Infrastructure::OpaqueFilteredResponse::create(vm, internal_response);
+        break;
+    case Fetch::Infrastructure::Response::Type::OpaqueRedirect:
+        response = Fetch::Infrastructure::OpaqueRedirectFilteredResponse::create(vm, internal_response);
+        break;
+    case Fetch::Infrastructure::Response::Type::Default:
+    case Fetch::Infrastructure::Response::Type::Error:
+        internal_response->set_type(cached_item.response_type);
+        break;
+    }
+
+    return Fetch::Response::create(realm, response, Fetch::Headers::Guard::Immutable);
+}
+
+static GC::Ref<Fetch::Infrastructure::Request> create_request(JS::VM& vm, CachedRequestResponse const& cached_item)
+{
+    auto request = Fetch::Infrastructure::Request::create(vm);
+    request->set_method(cached_item.request_method);
+    request->set_url(cached_item.request_url);
+    request->set_header_list(HTTP::HeaderList::create(cached_item.request_header_list->headers()));
+    return request;
+}
+
+static GC::Ref<Fetch::Request> create_request_object(JS::Realm& realm, CachedRequestResponse const& cached_item)
+{
+    return Fetch::Request::create(realm, create_request(realm.vm(), cached_item), Fetch::Headers::Guard::Immutable, realm.create<DOM::AbortSignal>(realm));
+}
+
+enum class CrossOriginResourcePolicyCheckResult {
+    Allowed,
+    Blocked,
+};
+
+// https://fetch.spec.whatwg.org/#cross-origin-resource-policy-internal-check
+static CrossOriginResourcePolicyCheckResult cross_origin_resource_policy_internal_check(URL::Origin const& origin, HTML::EmbedderPolicyValue embedder_policy_value, Fetch::Infrastructure::Response const& response, bool for_navigation)
+{
+    // 1. If forNavigation is true and embedderPolicyValue is "unsafe-none", then return allowed.
+    if (for_navigation && embedder_policy_value == HTML::EmbedderPolicyValue::UnsafeNone)
+        return CrossOriginResourcePolicyCheckResult::Allowed;
+
+    // 2. Let policy be the result of getting `Cross-Origin-Resource-Policy` from response’s header list.
+    auto policy = response.header_list()->get("Cross-Origin-Resource-Policy"sv);
+
+    // 3. If policy is neither `same-origin`, `same-site`, nor `cross-origin`, then set policy to null.
+    if (policy.has_value() && !policy->is_one_of("same-origin"sv, "same-site"sv, "cross-origin"sv))
+        policy.clear();
+
+    // 4. If policy is null, then switch on embedderPolicyValue:
+    if (!policy.has_value()) {
+        switch (embedder_policy_value) {
+        // -> "unsafe-none"
+        case HTML::EmbedderPolicyValue::UnsafeNone:
+            // Do nothing.
+            break;
+        // -> "credentialless"
+        case HTML::EmbedderPolicyValue::Credentialless:
+            // Set policy to `same-origin` if:
+            // - response’s request-includes-credentials is true, or
+            // - forNavigation is true.
+            if (response.request_includes_credentials() || for_navigation)
+                policy = "same-origin"sv;
+            break;
+        // -> "require-corp"
+        case HTML::EmbedderPolicyValue::RequireCorp:
+            // Set policy to `same-origin`.
+            policy = "same-origin"sv;
+            break;
+        }
+    }
+
+    // 5. Switch on policy:
+    // -> null
+    // -> `cross-origin`
+    if (!policy.has_value() || policy == "cross-origin"sv) {
+        // Return allowed.
+        return CrossOriginResourcePolicyCheckResult::Allowed;
+    }
+
+    auto response_url = response.url();
+    auto response_origin = response_url.has_value() ? response_url->origin() : URL::Origin::create_opaque();
+
+    // -> `same-origin`
+    if (policy == "same-origin"sv) {
+        // If origin is same origin with response’s URL’s origin, then return allowed.
+        if (origin.is_same_origin(response_origin))
+            return CrossOriginResourcePolicyCheckResult::Allowed;
+
+        // Otherwise, return blocked.
+        return CrossOriginResourcePolicyCheckResult::Blocked;
+    }
+
+    // -> `same-site`
+    // If all of the following are true
+    // - origin is schemelessly same site with response’s URL’s origin
+    // - origin’s scheme is "https" or response’s HTTPS state is "none"
+    // then return allowed.
+    // NB: Responses do not track their HTTPS state, so we consider it to be "none" for any response that was not
+    //     served over HTTPS.
+    auto response_https_state_is_none = !response_url.has_value() || response_url->scheme() != "https"sv;
+    if (origin.is_schemelessly_same_site(response_origin) && ((!origin.is_opaque() && origin.scheme() == "https"sv) || response_https_state_is_none))
+        return CrossOriginResourcePolicyCheckResult::Allowed;
+
+    // Otherwise, return blocked.
+    return CrossOriginResourcePolicyCheckResult::Blocked;
+}
+
+// https://fetch.spec.whatwg.org/#cross-origin-resource-policy-check
+static CrossOriginResourcePolicyCheckResult cross_origin_resource_policy_check(URL::Origin const& origin, HTML::EnvironmentSettingsObject const& environment, Fetch::Infrastructure::Response const& response, bool for_navigation = false)
+{
+    // 1. Set forNavigation to false if it is not given.
+    // 2. Let embedderPolicy be environment’s policy container’s embedder policy.
+    auto const& embedder_policy = environment.policy_container()->embedder_policy;
+
+    // 3. If the cross-origin resource policy internal check with origin, "unsafe-none", response, and forNavigation
+    //    returns blocked, then return blocked.
+    if (cross_origin_resource_policy_internal_check(origin, HTML::EmbedderPolicyValue::UnsafeNone, response, for_navigation) == CrossOriginResourcePolicyCheckResult::Blocked)
+        return CrossOriginResourcePolicyCheckResult::Blocked;
+
+    // 4. If the cross-origin resource policy internal check with origin, embedderPolicy’s report only value, response,
+    //    and forNavigation returns blocked, then queue a cross-origin embedder policy CORP violation report with
+    //    response, environment, embedderPolicy’s report only value, and true.
+    // FIXME: Queue violation reports once reporting is supported.
+
+    // 5. If the cross-origin resource policy internal check with origin, embedderPolicy’s value, response, and
+    //    forNavigation returns allowed, then return allowed.
+    if (cross_origin_resource_policy_internal_check(origin, embedder_policy.value, response, for_navigation) == CrossOriginResourcePolicyCheckResult::Allowed)
+        return CrossOriginResourcePolicyCheckResult::Allowed;
+
+    // 6. Queue a cross-origin embedder policy CORP violation report with response, environment, embedderPolicy’s
+    //    value, and false.
+    // 7. Return blocked.
+    return CrossOriginResourcePolicyCheckResult::Blocked;
+}
+
+struct ResponseBodyRetrieval : public RefCounted<ResponseBodyRetrieval> {
+    Vector<Optional<ByteBuffer>> bodies;
+    size_t pending_count { 0 };
+};
+
+// Retrieves the bodies of the given responses, and then queues a global task on the DOM manipulation task source to run
+// the given steps with them, in the same order as the responses.
+static void retrieve_response_bodies(JS::Object& global_object, StorageAPI::StorageBottle const& storage_bottle, Vector<NonnullRefPtr<CachedRequestResponse>> const& responses, GC::Ref<GC::Function<void(Vector<Optional<ByteBuffer>>)>> steps)
+{
+    auto retrieval = make_ref_counted<ResponseBodyRetrieval>();
+    retrieval->bodies.resize(responses.size());
+
+    auto queue_steps = [global_object = GC::Ref { global_object }, retrieval, steps]() {
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, global_object, GC::create_function(global_object->heap(), [retrieval, steps]() {
+            steps->function()(move(retrieval->bodies));
+        }));
+    };
+
+    for (auto const& response : responses) {
+        if (response->response_body_id.has_value())
+            ++retrieval->pending_count;
+    }
+
+    if (retrieval->pending_count == 0) {
+        queue_steps();
+        return;
+    }
+
+    for (size_t index = 0; index < responses.size(); ++index) {
+        auto const& body_id = responses[index]->response_body_id;
+        if (!body_id.has_value())
+            continue;
+
+        retrieve_response_body(storage_bottle, *body_id, GC::create_function(global_object.heap(), [retrieval, index, queue_steps](Optional<ByteBuffer> body) {
+            retrieval->bodies[index] = move(body);
+
+            if (--retrieval->pending_count == 0)
+                queue_steps();
+        }));
+    }
+}
+
+// Step 5.4 of matchAll(), which match() also runs.
+static WebIDL::ExceptionOr<GC::RootVector<GC::Ref<Fetch::Response>>> create_response_list(JS::Realm& realm, Vector<NonnullRefPtr<CachedRequestResponse>> const& responses, Vector<Optional<ByteBuffer>> bodies)
+{
+    auto& settings = HTML::principal_realm_settings_object(realm);
+
+    // 1. Let responseList be a list.
+    GC::RootVector<GC::Ref<Fetch::Response>> response_list { realm.heap() };
+
+    // 2. For each response in responses:
+    for (size_t index = 0; index < responses.size(); ++index) {
+        auto const& response = responses[index];
+        auto response_object = Cache::create_response_object(realm, response, move(bodies[index]));
+
+        // 1. If response’s type is "opaque" and cross-origin resource policy check with promise’s relevant settings
+        //    object’s origin, promise’s relevant settings object, "", and response’s internal response returns
+        //    blocked, then reject promise with a TypeError and abort these steps.
+        if (response->response_type == Fetch::Infrastructure::Response::Type::Opaque
+            && cross_origin_resource_policy_check(settings.origin(), settings, *response_object->response()->unsafe_response()) == CrossOriginResourcePolicyCheckResult::Blocked) {
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Cached response was blocked by its Cross-Origin-Resource-Policy"sv };
+        }
+
+        // 2. Add a new Response object associated with response and a new Headers object whose guard is "immutable" to
+        //    responseList.
+        response_list.append(response_object);
+    }
+
+    return response_list;
+}
+
+// Returns the request to query the cache with, or null if the query is known to not match anything.
+WebIDL::ExceptionOr<GC::Ptr<Fetch::Infrastructure::Request>> Cache::request_for_query(JS::Realm& realm, Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    // 1. If request is a Request object, then:
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        // 1. Set r to request’s request.
+        GC::Ptr<Fetch::Infrastructure::Request> r = (*request_object)->request();
+
+        // 2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty
+        //    array.
+        if (r->method() != "GET"sv && !options.ignore_method)
+            return GC::Ptr<Fetch::Infrastructure::Request> {};
+
+        return r;
+    }
+
+    // 2. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+    //        with request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, request));
+    return GC::Ptr<Fetch::Infrastructure::Request> { request_object->request() };
+}
+
+// Steps 1 to 5 of matchAll() and keys(), which only differ in which half of the matched request response pairs they
+// return.
+static WebIDL::ExceptionOr<Vector<NonnullRefPtr<CachedRequestResponse>>> matching_request_responses(JS::Realm& realm, Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options, RequestResponseList const& storage)
+{
+    // 1. Let r be null.
+    // 2. If the optional argument request is not omitted, then:
+    if (request.has_value()) {
+        auto r = TRY(Cache::request_for_query(realm, *request, options));
+        if (!r)
+            return Vector<NonnullRefPtr<CachedRequestResponse>> {};
+
+        // 3. Let requestResponses be the result of running Query Cache with r and options.
+        return Cache::query_cache(*r, options, storage.entries);
+    }
+
+    // 3. If the optional argument request is omitted, then for each requestResponse of the relevant request response
+    //    list, add a copy of requestResponse to the result.
+    return storage.entries;
+}
+
+struct PutOperation {
+    NonnullRefPtr<CachedRequestResponse> request_response;
+    Optional<ByteBuffer> body;
+};
+
+enum class CacheJobError {
+    DuplicateRequest,
+    QuotaExceeded,
+};
+
+// The last steps of put() and addAll(), which settle cacheJobPromise once Batch Cache Operations has completed.
+static void queue_a_task_to_settle_cache_job_promise(JS::Realm& realm, GC::Ref<WebIDL::Promise> cache_job_promise, Optional<CacheJobError> error_data)
+{
+    // Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM manipulation
+    // task source, to perform the following substeps:
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, cache_job_promise, error_data]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // 1. If errorData is null, resolve cacheJobPromise with undefined.
+        if (!error_data.has_value()) {
+            WebIDL::resolve_promise(realm, cache_job_promise, JS::js_undefined());
+            return;
+        }
+
+        // 2. Else, reject cacheJobPromise with a new exception with errorData and a user agent-defined message, in
+        //    realm.
+        switch (*error_data) {
+        case CacheJobError::DuplicateRequest:
+            WebIDL::reject_promise(realm, cache_job_promise, WebIDL::InvalidStateError::create(realm, "The same request cannot be added to a cache more than once"_utf16));
+            break;
+        case CacheJobError::QuotaExceeded:
+            WebIDL::reject_promise(realm, cache_job_promise, WebIDL::QuotaExceededError::create(realm, "Not enough storage space to add the response to the cache"_utf16));
+            break;
+        }
+    }));
+}
+
+// Steps 2 and 4 to 6 of Batch Cache Operations, which run once the bodies of the responses have been stored.
+static Optional<CacheJobError> apply_put_operations(JS::VM& vm, StorageAPI::StorageBottle& storage_bottle, RequestResponseList& cache, Vector<NonnullRefPtr<CachedRequestResponse>> const& request_responses_to_put, Vector<String> const& added_body_ids)
+{
+    auto remove_added_bodies = [&] {
+        for (auto const& body_id : added_body_ids)
+            remove_response_body(storage_bottle, body_id);
+    };
+
+    // FIXME: Cache objects keep representing their request response list after it was removed from the name to cache
+    //        map, but it is no longer stored anywhere, so the entries that are put into it are dropped.
+    if (cache.was_removed()) {
+        remove_added_bodies();
+        return {};
+    }
+
+    // 2. Let backupCache be a new request response list that is a copy of cache.
+    auto backup_cache = cache.entries;
+    Vector<String> replaced_body_ids;
+
+    // 4. Try running the following substeps atomically:
+    //     1. Let resultList be an empty list.
+    //     2. For each operation in operations:
+    for (auto const& request_response : request_responses_to_put) {
+        auto request = create_request(vm, request_response);
+
+        // 4. Let requestResponses be an empty list.
+        // 5. If operation’s type matches "delete", then:
+        //     ...
+        // 6. Else if operation’s type matches "put", then:
+        //     1. If operation’s response is null, throw a TypeError.
+        //     2. Let r be operation’s request’s associated request.
+        //     3. If r’s url’s scheme is not one of "http" and "https", throw a TypeError.
+        //     4. If r’s method is not `GET`, throw a TypeError.
+        //     5. If operation’s options is not null, throw a TypeError.
+        // NB: Every caller has already checked the request.
+
+        //     6. Set requestResponses to the result of running Query Cache with operation’s request.
+        auto request_responses = Cache::query_cache(*request, {}, cache.entries);
+
+        //     7. For each requestResponse of requestResponses:
+        //         1. Remove the item whose value matches requestResponse from cache.
+        cache.entries.remove_all_matching([&](auto const& entry) {
+            if (!request_responses.contains_slow(entry))
+                return false;
+            if (entry->response_body_id.has_value())
+                replaced_body_ids.append(*entry->response_body_id);
+            return true;
+        });
+
+        //     8. Append operation’s request/operation’s response to cache.
+        cache.entries.append(request_response);
+
+        //     10. Append operation’s request/operation’s response to addedItems.
+        // 7. Append operation’s request/operation’s response to resultList.
+    }
+
+    //     9. If the cache write operation in the previous two steps failed due to exceeding the granted quota limit,
+    //        throw a "QuotaExceededError" DOMException.
+    if (cache.store(storage_bottle).has<WebView::StorageOperationError>()) {
+        // 5. And then, if an exception was thrown, then:
+        //     1. Remove all the items from the relevant request response list.
+        //     2. For each requestResponse of backupCache:
+        //         1. Append requestResponse to the relevant request response list.
+        //     3. Throw the exception.
+        cache.entries = move(backup_cache);
+        remove_added_bodies();
+        return CacheJobError::QuotaExceeded;
+    }
+
+    for (auto const& body_id : replaced_body_ids)
+        remove_response_body(storage_bottle, body_id);
+
+    //     3. Return resultList.
+    return {};
+}
+
+// https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+// NB: Only the operations of put(), add() and addAll() are batched, as delete() never has more than one operation. The
+//     bodies of the responses are stored before the relevant request response list is updated, and cacheJobPromise is
+//     settled once both are done.
+static void batch_put_operations(JS::Realm& realm, GC::Ref<StorageAPI::StorageBottle> storage_bottle, NonnullRefPtr<RequestResponseList> cache, Vector<PutOperation> operations, GC::Ref<WebIDL::Promise> cache_job_promise)
+{
+    // 1. Let cache be the relevant request response list.
+    // 3. Let addedItems be an empty list.
+    Vector<NonnullRefPtr<CachedRequestResponse>> added_items;
+
+    for (auto const& operation : operations) {
+        auto request = create_request(realm.vm(), operation.request_response);
+
+        // 1. If operation’s type matches neither "delete" nor "put", throw a TypeError.
+        // 2. If operation’s type matches "delete" and operation’s response is not null, throw a TypeError.
+        // 3. If the result of running Query Cache with operation’s request, operation’s options, and addedItems is not
+        //    empty, throw an "InvalidStateError" DOMException.
+        // NB: This only depends on the operations themselves, so we check it before storing any of their bodies.
+        if (!Cache::query_cache(*request, {}, added_items).is_empty()) {
+            queue_a_task_to_settle_cache_job_promise(realm, cache_job_promise, CacheJobError::DuplicateRequest);
+            return;
+        }
+
+        added_items.append(operation.request_response);
+    }
+
+    struct BodyStores : public RefCounted<BodyStores> {
+        Vector<String> added_body_ids;
+        size_t pending_count { 0 };
+        bool failed { false };
+    };
+    auto body_stores = make_ref_counted<BodyStores>();
+
+    auto apply_operations = [&realm, storage_bottle, cache, cache_job_promise, body_stores, request_responses = added_items]() {
+        Optional<CacheJobError> error_data;
+
+        // NB: Failing to store a body is reported as exceeding the quota, which is the only failure that the
+        //     specification accounts for.
+        if (body_stores->failed) {
+            for (auto const& body_id : body_stores->added_body_ids)
+                remove_response_body(*storage_bottle, body_id);
+            error_data = CacheJobError::QuotaExceeded;
+        } else {
+            error_data = apply_put_operations(realm.vm(), *storage_bottle, *cache, request_responses, body_stores->added_body_ids);
+        }
+
+        queue_a_task_to_settle_cache_job_promise(realm, cache_job_promise, error_data);
+    };
+
+    for (auto const& operation : operations) {
+        if (operation.body.has_value())
+            ++body_stores->pending_count;
+    }
+
+    if (body_stores->pending_count == 0) {
+        apply_operations();
+        return;
+    }
+
+    for (auto& operation : operations) {
+        if (!operation.body.has_value())
+            continue;
+
+        auto body_id = MUST(Crypto::generate_random_uuid());
+        operation.request_response->response_body_id = body_id;
+        body_stores->added_body_ids.append(body_id);
+
+        store_response_body(*storage_bottle, body_id, *operation.body, GC::create_function(realm.heap(), [body_stores, apply_operations](bool stored) {
+            if (!stored)
+                body_stores->failed = true;
+
+            if (--body_stores->pending_count == 0)
+                apply_operations();
+        }));
+    }
+}
+
+// The state that the fetches of a single addAll() call share.
+class AddAllState final : public JS::Cell {
+    GC_CELL(AddAllState, JS::Cell);
+    GC_DECLARE_ALLOCATOR(AddAllState);
+
+public:
+    static GC::Ref<AddAllState> create(JS::VM& vm)
+    {
+        return vm.heap().allocate<AddAllState>();
+    }
+
+    void abort_fetches(JS::Realm& realm)
+    {
+        for (auto fetch_controller : fetch_controllers)
+            fetch_controller->abort(realm, {});
+    }
+
+    Vector<GC::Ref<Fetch::Infrastructure::FetchController>> fetch_controllers;
+    Vector<Optional<PutOperation>> operations;
+
+private:
+    AddAllState() = default;
+
+    virtual void visit_edges(JS::Cell::Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(fetch_controllers);
+    }
+};
+
+GC_DEFINE_ALLOCATOR(AddAllState);
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run these substeps in parallel:
+    //     1. Let p be the result of running the algorithm specified in matchAll(request, options) method with request
+    //        and options.
+    auto request_responses = matching_request_responses(realm, request, options, *m_request_response_list);
+    if (request_responses.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_responses.release_error());
+
+    // NB: Only the first matching response has to be created, so we don't run all of matchAll()'s steps here.
+    auto matches = request_responses.release_value();
+    if (matches.size() > 1)
+        matches.shrink(1);
+
+    retrieve_response_bodies(HTML::relevant_global_object(*this), *m_storage_bottle, matches, GC::create_function(realm.heap(), [&realm, promise, request_responses = matches](Vector<Optional<ByteBuffer>> bodies) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // 2. Wait until p settles.
+        auto response_list = create_response_list(realm, request_responses, move(bodies));
+
+        // 3. If p rejects with an exception, then reject promise with that exception.
+        if (response_list.is_exception()) {
+            auto error = Bindings::exception_to_throw_completion(realm.vm(), response_list.release_error());
+            WebIDL::reject_promise(realm, promise, error.value());
+            return;
+        }
+
+        // 4. Else if p resolves with an array, responses, then:
+        //     1. If responses is an empty array, then resolve promise with undefined.
+        if (response_list.value().is_empty()) {
+            WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+            return;
+        }
+
+        //     2. Else, resolve promise with the first element of responses.
+        WebIDL::resolve_promise(realm, promise, response_list.value().first());
+    }));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    auto request_responses = matching_request_responses(realm, request, options, *m_request_response_list);
+    if (request_responses.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_responses.release_error());
+
+    // 3. Let realm be this's relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    //     4. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    // NB: The task is queued once the bodies of the responses have been retrieved.
+    auto matches = request_responses.release_value();
+
+    retrieve_response_bodies(HTML::relevant_global_object(*this), *m_storage_bottle, matches, GC::create_function(realm.heap(), [&realm, promise, request_responses = matches](Vector<Optional<ByteBuffer>> bodies) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // 1. Let responseList be a list.
+        // 2. For each response in responses:
+        auto response_list = create_response_list(realm, request_responses, move(bodies));
+        if (response_list.is_exception()) {
+            auto error = Bindings::exception_to_throw_completion(realm.vm(), response_list.release_error());
+            WebIDL::reject_promise(realm, promise, error.value());
+            return;
+        }
+
+        // 3. Resolve promise with a frozen array created from responseList, in realm.
+        auto array = JS::Array::create_from<GC::Ref<Fetch::Response>>(realm, response_list.value(), [](auto response) {
+            return response;
+        });
+        MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+        WebIDL::resolve_promise(realm, promise, array);
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-add
+GC::Ref<WebIDL::Promise> Cache::add(Fetch::RequestInfo const& request)
+{
+    // 1. Let requests be an array containing only request.
+    // 2. Let responseArrayPromise be the result of running the algorithm specified in addAll(requests) passing
+    //    requests as the argument.
+    // 3. Return the result of reacting to responseArrayPromise with a fulfillment handler that returns undefined.
+    // NB: The promise returned by addAll() is already fulfilled with undefined.
+    return add_all({ request });
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-addAll
+GC::Ref<WebIDL::Promise> Cache::add_all(Vector<Fetch::RequestInfo> const& requests)
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    // 1. Let responsePromises be an empty list.
+    Vector<GC::Ref<WebIDL::Promise>> response_promises;
+
+    // 2. Let requestList be an empty list.
+    // NB: The requests are kept in the put operations that are created once their response has been fetched.
+    auto state = AddAllState::create(vm);
+    state->operations.resize(requests.size());
+
+    // 3. For each request whose type is Request in requests:
+    for (auto const& request : requests) {
+        auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>();
+        if (!request_object)
+            continue;
+
+        // 1. Let r be request’s request.
+        auto r = (*request_object)->request();
+
+        // 2. If r’s url’s scheme is not one of "http" and "https", or r’s method is not `GET`, return a promise
+        //    rejected with a TypeError.
+        if (!Fetch::Infrastructure::is_http_or_https_scheme(r->url().scheme()) || r->method() != "GET"sv)
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests with an HTTP(S) URL can be cached"sv));
+    }
+
+    // 4. Let fetchControllers be a list of fetch controllers.
+    // 5. For each request in requests:
+    for (size_t index = 0; index < requests.size(); ++index) {
+        // 1. Let r be the associated request of the result of invoking the initial value of Request as constructor
+        //    with request as its argument. If this throws an exception, return a promise rejected with that exception.
+        auto request_object = Fetch::Request::construct_impl(realm, requests[index]);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+
+        auto r = request_object.value()->request();
+
+        // 2. If r’s url’s scheme is not one of "http" and "https", then:
+        if (!Fetch::Infrastructure::is_http_or_https_scheme(r->url().scheme())) {
+            // 1. For each fetchController of fetchControllers, abort fetchController.
+            state->abort_fetches(realm);
+
+            // 2. Return a promise rejected with a TypeError.
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only requests with an HTTP(S) URL can be cached"sv));
+        }
+
+        // 3. If r’s client’s global object is a ServiceWorkerGlobalScope object, set request’s service-workers mode to
+        //    "none".
+        if (r->client() && is<ServiceWorkerGlobalScope>(r->client()->global_object()))
+            r->set_service_workers_mode(Fetch::Infrastructure::Request::ServiceWorkersMode::None);
+
+        // 4. Set r’s initiator to "fetch" and destination to "subresource".
+        // NB: Fetch has since replaced these with an initiator type of "fetch" and the empty destination.
+        r->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Fetch);
+
+        // 5. Add r to requestList.
+        // 6. Let responsePromise be a new promise.
+        auto response_promise = WebIDL::create_promise(realm);
+
+        // 7. Run the following substeps in parallel:
+        //     - Append the result of fetching r.
+        //     - To processResponse for response, run these substeps:
+        //         1. If response’s type is "error", or response’s status is not an ok status or is 206, reject
+        //            responsePromise with a TypeError.
+        //         2. Else if response’s header list contains a header named `Vary`, then:
+        //             1. Let fieldValues be the list containing the elements corresponding to the field-values of the
+        //                Vary header.
+        //             2. For each fieldValue of fieldValues:
+        //                 1. If fieldValue matches "*", then:
+        //                     1. Reject responsePromise with a TypeError.
+        //                     2. For each fetchController of fetchControllers, abort fetchController.
+        //                     3. Abort these steps.
+        //     - To processResponseEndOfBody for response, run these substeps:
+        //         1. If response’s aborted flag is set, reject responsePromise with an "AbortError" DOMException and
+        //            abort these steps.
+        //         2. Resolve responsePromise with response.
+        // NB: The response is only needed once its body has been read, so that the body can be stored along with it,
+        //     which is why we run all of these steps once the body has been consumed.
+        Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+        fetch_algorithms_input.process_response_consume_body = [&realm, state, response_promise, r, index](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes body_bytes) {
+            HTML::TemporaryExecutionContext execution_context { realm };
+
+            if (response->type() == Fetch::Infrastructure::Response::Type::Error || !Fetch::Infrastructure::is_ok_status(response->status()) || response->status() == 206) {
+                WebIDL::reject_promise(realm, response_promise, JS::TypeError::create(realm, "Only successful, complete responses can be cached"sv));
+                return;
+            }
+
+            bool varies_on_everything = false;
+            response->header_list()->for_each_vary_header([&](StringView field_value) {
+                if (field_value == "*"sv) {
+                    varies_on_everything = true;
+                    return IterationDecision::Break;
+                }
+                return IterationDecision::Continue;
+            });
+            if (varies_on_everything) {
+                WebIDL::reject_promise(realm, response_promise, JS::TypeError::create(realm, "Responses that vary on every header cannot be cached"sv));
+                state->abort_fetches(realm);
+                return;
+            }
+
+            if (response->aborted() || body_bytes.has<Fetch::Infrastructure::FetchAlgorithms::ConsumeBodyFailureTag>()) {
+                WebIDL::reject_promise(realm, response_promise, WebIDL::AbortError::create(realm, "Fetching the response was aborted"_utf16));
+                return;
+            }
+
+            Optional<ByteBuffer> body;
+            if (auto* bytes = body_bytes.get_pointer<ByteBuffer>())
+                body = move(*bytes);
+
+            state->operations[index] = PutOperation { make_ref_counted<CachedRequestResponse>(*r, *response), move(body) };
+            WebIDL::resolve_promise(realm, response_promise, JS::js_undefined());
+        };
+
+        state->fetch_controllers.append(Fetch::Fetching::fetch(realm, r, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input))));
+
+        // 8. Add responsePromise to responsePromises.
+        response_promises.append(response_promise);
+    }
+
+    // 6. Let p be the result of getting a promise to wait for all of responsePromises.
+    // 7. Return the result of reacting to p with a fulfillment handler that, when called with argument responses,
+    //    performs the following substeps:
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    auto success_steps = [&realm, cache_job_promise, state, storage_bottle = m_storage_bottle, request_response_list = m_request_response_list](Vector<JS::Value> const&) {
+        // 1. Let operations be an empty list.
+        // 2. Let index be zero.
+        // 3. For each response in responses:
+        //     1. Let operation be a cache batch operation.
+        //     2. Set operation’s type to "put".
+        //     3. Set operation’s request to requestList[index].
+        //     4. Set operation’s response to response.
+        //     5. Append operation to operations.
+        //     6. Increment index by one.
+        Vector<PutOperation> operations;
+        operations.ensure_capacity(state->operations.size());
+        for (auto& operation : state->operations)
+            operations.unchecked_append(operation.release_value());
+
+        // 4. Let realm be this’s relevant realm.
+        // 5. Let cacheJobPromise be a new promise.
+        // 6. Run the following substeps in parallel:
+        //     1. Let errorData be null.
+        //     2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+        //        exception.
+        //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+        //        manipulation task source, to perform the following substeps:
+        //         1. If errorData is null, resolve cacheJobPromise with undefined.
+        //         2. Else, reject cacheJobPromise with a new exception with errorData and a user agent-defined
+        //            message, in realm.
+        batch_put_operations(realm, storage_bottle, request_response_list, move(operations), cache_job_promise);
+    };
+
+    auto failure_steps = [&realm, cache_job_promise](JS::Value reason) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::reject_promise(realm, cache_job_promise, reason);
+    };
+
+    WebIDL::wait_for_all(realm, response_promises, move(success_steps), move(failure_steps));
+
+    //     7. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, Fetch::Response& response)
+{
+    auto& realm = this->realm();
+
+    // 1. Let innerRequest be null.
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+
+    // 2. If request is a Request object, then set innerRequest to request’s request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        inner_request = (*request_object)->request();
+    }
+    // 3. Else:
+    else {
+        // 1. Let requestObj be the result of invoking Request's constructor with request as its argument. If this
+        //    throws an exception, return a promise rejected with exception.
+        auto request_object = Fetch::Request::construct_impl(realm, request);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+
+        // 2. Set innerRequest to requestObj’s request.
+        inner_request = request_object.value()->request();
+    }
+
+    // 4. If innerRequest’s url's scheme is not one of "http" and "https", or innerRequest’s method is not `GET`, return
+    //    a promise rejected with a TypeError.
+    if (!Fetch::Infrastructure::is_http_or_https_scheme(inner_request->url().scheme()) || inner_request->method() != "GET"sv)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests with an HTTP(S) URL can be cached"sv));
+
+    // 5. Let innerResponse be response’s response.
+    auto inner_response = response.response();
+
+    // 6. If innerResponse’s status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Partial responses cannot be cached"sv));
+
+    // 7. If innerResponse’s header list contains a header named `Vary`, then:
+    bool varies_on_everything = false;
+    inner_response->header_list()->for_each_vary_header([&](StringView field_value) {
+        // 1. Let fieldValues be the list containing the items corresponding to the Vary header’s field-values.
+        // 2. For each fieldValue in fieldValues:
+        //     1. If fieldValue matches "*", return a promise rejected with a TypeError.
+        if (field_value == "*"sv) {
+            varies_on_everything = true;
+            return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    });
+    if (varies_on_everything)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Responses that vary on every header cannot be cached"sv));
+
+    // 8. If innerResponse’s body is disturbed or locked, return a promise rejected with a TypeError.
+    // NB: Filtered responses hide the body of their internal response, which is the body that we have to store.
+    auto body = inner_response->unsafe_response()->body();
+    if (body && (body->stream()->is_disturbed() || body->stream()->is_locked()))
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Response body has already been used"sv));
+
+    // 9. Let clonedResponse be the result of cloning innerResponse.
+    // NB: The response is stored outside of the JS heap, so we take a copy of everything but the body here, and the
+    //     body once it has been read.
+    auto cached_item = make_ref_counted<CachedRequestResponse>(*inner_request, *inner_response);
+
+    // 10. Let bodyReadPromise be a promise resolved with undefined.
+    // 11. If innerResponse’s body is non-null, run these substeps:
+    //     1. Let stream be innerResponse’s body’s stream.
+    //     2. Let reader be the result of getting a reader for stream.
+    //     3. Set bodyReadPromise to the result of reading all bytes from reader.
+    // 12. Let operations be an empty list.
+    // 13. Let operation be a cache batch operation.
+    // 14. Set operation’s type to "put".
+    // 15. Set operation’s request to innerRequest.
+    // 16. Set operation’s response to clonedResponse.
+    // 17. Append operation to operations.
+    // 18. Let realm be this’s relevant realm.
+    // 19. Return the result of the fulfillment of bodyReadPromise:
+    auto promise = WebIDL::create_promise(realm);
+
+    auto store_cached_item = [&realm, promise, cached_item, storage_bottle = m_storage_bottle, request_response_list = m_request_response_list](Optional<ByteBuffer> bytes) {
+        // 1. Let cacheJobPromise be a new promise.
+        // 2. Return cacheJobPromise and run these steps in parallel:
+        //     1. Let errorData be null.
+        //     2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+        //        exception.
+        //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+        //        manipulation task source, to perform the following substeps:
+        //         1. If errorData is null, resolve cacheJobPromise with undefined.
+        //         2. Else, reject cacheJobPromise with a new exception with errorData and a user agent-defined
+        //            message, in realm.
+        Vector<PutOperation> operations;
+        operations.append({ cached_item, move(bytes) });
+        batch_put_operations(realm, storage_bottle, request_response_list, move(operations), promise);
+    };
+
+    if (!body) {
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [store_cached_item = move(store_cached_item)]() {
+            store_cached_item({});
+        }));
+        return promise;
+    }
+
+    auto process_body = GC::create_function(realm.heap(), [store_cached_item = move(store_cached_item)](ByteBuffer bytes) {
+        store_cached_item(move(bytes));
+    });
+
+    // If bodyReadPromise rejects, reject the promise with that reason.
+    auto process_body_error = GC::create_function(realm.heap(), [&realm, promise](JS::Value error) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::reject_promise(realm, promise, error);
+    });
+
+    body->fully_read(realm, process_body, process_body_error, GC::Ref { HTML::relevant_global_object(*this) });
+
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If request is a Request object, then:
+    //     1. Set r to request’s request.
+    //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with false.
+    // 3. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+    //        with request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto r = request_for_query(realm, request, options);
+    if (r.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, r.release_error());
+    if (!r.value())
+        return WebIDL::create_resolved_promise(realm, JS::Value { false });
+
+    // 4. Let operations be an empty list.
+    // 5. Let operation be a cache batch operation.
+    // 6. Set operation’s type to "delete".
+    // 7. Set operation’s request to r.
+    // 8. Set operation’s options to options.
+    // 9. Append operation to operations.
+    // 10. Let cacheJobPromise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 11. Run these substeps in parallel:
+    //     1. Let errorData be null.
+    //     2. Let requestResponses be the result of running Batch Cache Operations with operations. If this throws an
+    //        exception, set errorData to the exception.
+    // https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+    auto& cache = *m_request_response_list;
+    auto request_responses = query_cache(*r.value(), options, cache.entries);
+
+    if (!request_responses.is_empty()) {
+        cache.entries.remove_all_matching([&](auto const& entry) {
+            return request_responses.contains_slow(entry);
+        });
+
+        // NB: Removing entries only ever shrinks the stored list, so this cannot exceed the quota.
+        (void)cache.store(m_storage_bottle);
+
+        for (auto const& request_response : request_responses) {
+            if (request_response->response_body_id.has_value())
+                remove_response_body(m_storage_bottle, *request_response->response_body_id);
+        }
+    }
+
+    //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+    //        manipulation task source, to perform the following substeps:
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, deleted_any = !request_responses.is_empty()]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // 1. If errorData is null, then:
+        //     1. If requestResponses is not empty, resolve cacheJobPromise with true.
+        //     2. Else, resolve cacheJobPromise with false.
+        WebIDL::resolve_promise(realm, promise, JS::Value { deleted_any });
+    }));
+
+    // 12. Return cacheJobPromise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    auto request_responses = matching_request_responses(realm, request, options, *m_request_response_list);
+    if (request_responses.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_responses.release_error());
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    //     3. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, request_responses = request_responses.release_value()]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        // 1. Let requestList be a list.
+        // 2. For each request in requests:
+        //     1. Add a new Request object associated with request and a new associated Headers object whose guard is
+        //        "immutable" to requestList.
+        auto request_list = JS::Array::create_from<NonnullRefPtr<CachedRequestResponse>>(realm, request_responses, [&](auto const& request_response) {
+            return create_request_object(realm, request_response);
+        });
+        MUST(request_list->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+
+        // 3. Resolve promise with a frozen array created from requestList, in realm.
+        WebIDL::resolve_promise(realm, promise, request_list);
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
+#include <AK/Weakable.h>
+#include <LibHTTP/HeaderList.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/StorageAPI/StorageBottle.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// https://w3c.github.io/ServiceWorker/#dictdef-multicachequeryoptions
+struct MultiCacheQueryOptions : public CacheQueryOptions {
+    Optional<String> cache_name;
+};
+
+// A request and response pair of a request response list. Cached entries are kept outside of the JS heap, and Request
+// and Response objects are only created for the entries that a query actually returns.
+struct CachedRequestResponse : public RefCounted<CachedRequestResponse> {
+    // Copies everything but the response's body, which has to be read before it can be stored. Everything but the type
+    // is copied from the response's internal response, so that filtered responses keep what their filter hides.
+    CachedRequestResponse(Fetch::Infrastructure::Request const&, Fetch::Infrastructure::Response&);
+    CachedRequestResponse() = default;
+
+    ByteString request_method;
+    URL::URL request_url;
+    NonnullRefPtr<HTTP::HeaderList> request_header_list { HTTP::HeaderList::create() };
+
+    Fetch::Infrastructure::Response::Type response_type { Fetch::Infrastructure::Response::Type::Default };
+    Vector<URL::URL> response_url_list;
+    Fetch::Infrastructure::Status response_status { 200 };
+    ByteString response_status_message;
+    NonnullRefPtr<HTTP::HeaderList> response_header_list { HTTP::HeaderList::create() };
+    Vector<ByteString> response_cors_exposed_header_name_list;
+    bool response_request_includes_credentials { true };
+
+    // The ID under which the response's body is stored outside of the storage bottle, if it has one.
+    Optional<String> response_body_id;
+};
+
+// https://w3c.github.io/ServiceWorker/#dfn-request-response-list
+// NB: Request response lists are persisted in the "caches" storage bottle of their storage key, so that they are shared
+//     between processes, outlive them, and are cleared along with the rest of a site's data. Each list is stored as a
+//     single item, while the bodies of its responses are stored as binary data outside of the storage bottle, and are
+//     only read when a Response object is created for them.
+//     A process only parses a list once, and every Cache object that represents it shares and updates that copy. This
+//     means that changes which another process makes to a list are only seen once it is loaded again.
+class RequestResponseList final
+    : public RefCounted<RequestResponseList>
+    , public Weakable<RequestResponseList> {
+public:
+    static NonnullRefPtr<RequestResponseList> create(String cache_id);
+    static NonnullRefPtr<RequestResponseList> load(StorageAPI::StorageBottle const&, String const& cache_id);
+    static void remove(StorageAPI::StorageBottle&, String const& cache_id);
+
+    WebView::StorageSetResult store(StorageAPI::StorageBottle&) const;
+
+    String const& cache_id() const { return m_cache_id; }
+
+    // Whether the list is no longer stored, because its cache was deleted.
+    bool was_removed() const { return m_was_removed; }
+
+    Vector<NonnullRefPtr<CachedRequestResponse>> entries;
+
+private:
+    explicit RequestResponseList(String cache_id);
+
+    String m_cache_id;
+    bool m_was_removed { false };
+};
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&, GC::Ref<StorageAPI::StorageBottle>, NonnullRefPtr<RequestResponseList>);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, CacheQueryOptions const& options = {});
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options = {});
+    GC::Ref<WebIDL::Promise> add(Fetch::RequestInfo const& request);
+    GC::Ref<WebIDL::Promise> add_all(Vector<Fetch::RequestInfo> const& requests);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const& request, Fetch::Response& response);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options = {});
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options = {});
+
+    static WebIDL::ExceptionOr<GC::Ptr<Fetch::Infrastructure::Request>> request_for_query(JS::Realm&, Fetch::RequestInfo const&, CacheQueryOptions const&);
+    static Vector<NonnullRefPtr<CachedRequestResponse>> query_cache(Fetch::Infrastructure::Request const& request_query, CacheQueryOptions const&, ReadonlySpan<NonnullRefPtr<CachedRequestResponse>> storage);
+    static GC::Ref<Fetch::Response> create_response_object(JS::Realm&, CachedRequestResponse const&, Optional<ByteBuffer> body);
+
+private:
+    Cache(JS::Realm&, GC::Ref<StorageAPI::StorageBottle>, NonnullRefPtr<RequestResponseList>);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    GC::Ref<StorageAPI::StorageBottle> m_storage_bottle;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-relevant-request-response-list
+    NonnullRefPtr<RequestResponseList> m_request_response_list;
+};
+
+}
@@ -4,10 +4,21 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonArray.h>
+#include <AK/JsonValue.h>
+#include <LibJS/Runtime/Array.h>
 #include <LibWeb/Bindings/CacheStoragePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/Promise.h>
+#include <LibWeb/WebIDL/QuotaExceededError.h>
 
 namespace Web::ServiceWorker {
 
@@ -24,17 +35,290 @@ void CacheStorage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
 }
 
-// https://w3c.github.io/ServiceWorker/#cache-storage-open
-GC::Ref<WebIDL::Promise> CacheStorage::open(String const&)
+void CacheStorage::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_storage_bottle);
+}
+
+// https://w3c.github.io/ServiceWorker/#relevant-name-to-cache-map
+GC::Ptr<StorageAPI::StorageBottle> CacheStorage::relevant_storage_bottle()
+{
+    if (m_storage_bottle)
+        return m_storage_bottle;
+
+    // The relevant name to cache map for a CacheStorage object is the map returned by running obtain a local storage
+    // bottle map given this's relevant settings object and "caches".
+    auto storage_key = StorageAPI::obtain_a_storage_key(HTML::relevant_settings_object(*this));
+    if (!storage_key.has_value())
+        return {};
+
+    if (auto* window = as_if<HTML::Window>(HTML::relevant_global_object(*this))) {
+        // NB: The quota of the "caches" storage bottles is enforced by the storage jar.
+        m_storage_bottle = StorageAPI::LocalStorageBottle::create(heap(), window->page(), StorageAPI::StorageEndpointType::Caches, storage_key.release_value(), {});
+    } else {
+        // FIXME: Workers cannot reach the storage jar yet, so their caches only last as long as the worker does.
+        m_storage_bottle = StorageAPI::SessionStorageBottle::create(heap(), {});
+    }
+
+    return m_storage_bottle;
+}
+
+static String const& name_to_cache_map_key()
 {
-    return WebIDL::create_rejected_promise(realm(), WebIDL::NotSupportedError::create(realm(), "CacheStorage.open() is not yet implemented"_utf16));
+    static auto const key = "caches"_string;
+    return key;
+}
+
+static NameToCacheMap load_name_to_cache_map(StorageAPI::StorageBottle const& storage_bottle)
+{
+    NameToCacheMap name_to_cache_map;
+
+    auto serialized_map = storage_bottle.get(name_to_cache_map_key());
+    if (!serialized_map.has_value())
+        return name_to_cache_map;
+
+    auto json = JsonValue::from_string(*serialized_map);
+    if (json.is_error() || !json.value().is_array()) {
+        dbgln("CacheStorage: Ignoring malformed name to cache map");
+        return name_to_cache_map;
+    }
+
+    for (auto const& value : json.value().as_array().values()) {
+        if (!value.is_array() || value.as_array().size() != 2 || !value.as_array().at(0).is_string() || !value.as_array().at(1).is_string()) {
+            dbgln("CacheStorage: Ignoring malformed entry of the name to cache map");
+            continue;
+        }
+
+        name_to_cache_map.set(value.as_array().at(0).as_string(), value.as_array().at(1).as_string());
+    }
+
+    return name_to_cache_map;
+}
+
+static WebView::StorageSetResult store_name_to_cache_map(StorageAPI::StorageBottle& storage_bottle, NameToCacheMap const& name_to_cache_map)
+{
+    JsonArray serialized_map;
+
+    for (auto const& [cache_name, cache_id] : name_to_cache_map) {
+        JsonArray name_and_id;
+        name_and_id.must_append(cache_name);
+        name_and_id.must_append(cache_id);
+        serialized_map.must_append(move(name_and_id));
+    }
+
+    return storage_bottle.set(name_to_cache_map_key(), serialized_map.serialized());
+}
+
+static GC::Ref<WebIDL::Promise> storage_unavailable_promise(JS::Realm& realm)
+{
+    return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Cache storage is not available for this origin"_utf16));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    auto storage_bottle = relevant_storage_bottle();
+    if (!storage_bottle)
+        return storage_unavailable_promise(realm);
+
+    auto name_to_cache_map = load_name_to_cache_map(*storage_bottle);
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. Return a new promise promise and run the following substeps in parallel:
+        //     1. For each cacheName → cache of the relevant name to cache map:
+        //         1. If options["cacheName"] matches cacheName, then:
+        //             1. Resolve promise with the result of running the algorithm specified in match(request, options)
+        //                method of Cache interface with request and options (providing cache as thisArgument to the
+        //                [[Call]] internal method of match(request, options).)
+        //             2. Abort these steps.
+        if (auto cache_id = name_to_cache_map.get(*options.cache_name); cache_id.has_value())
+            return Cache::create(realm, *storage_bottle, RequestResponseList::load(*storage_bottle, *cache_id))->match(request, options);
+
+        //     2. Resolve promise with undefined.
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // 2. Else:
+    //     1. Let promise be a promise resolved with undefined.
+    //     2. For each cacheName → cache of the relevant name to cache map:
+    //         1. Set promise to the result of reacting to itself with a fulfillment handler that, when called with
+    //            argument response, performs the following substeps:
+    //             1. If response is not undefined, return response.
+    //             2. Return the result of running the algorithm specified in match(request, options) method of Cache
+    //                interface with request and options as the arguments (providing cache as thisArgument to the
+    //                [[Call]] internal method of match(request, options).)
+    // NB: Only the first cache that has a matching entry settles the promise with a response, so we look for that cache
+    //     right away, and then only run match() on it.
+    auto request_query = Cache::request_for_query(realm, request, options);
+    if (request_query.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_query.release_error());
+
+    if (request_query.value()) {
+        for (auto const& [cache_name, cache_id] : name_to_cache_map) {
+            auto cache = RequestResponseList::load(*storage_bottle, cache_id);
+            if (!Cache::query_cache(*request_query.value(), options, cache->entries).is_empty())
+                return Cache::create(realm, *storage_bottle, move(cache))->match(request, options);
+        }
+    }
+
+    // 3. Return promise.
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
 }
 
 // https://w3c.github.io/ServiceWorker/#cache-storage-has
-GC::Ref<WebIDL::Promise> CacheStorage::has(String const&)
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
 {
-    dbgln("FIXME: CacheStorage::has() is not implemented yet");
-    return WebIDL::create_rejected_promise(realm(), JS::Value(false));
+    auto& realm = this->realm();
+
+    auto storage_bottle = relevant_storage_bottle();
+    if (!storage_bottle)
+        return storage_unavailable_promise(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, resolve promise with true and abort these steps.
+    //     2. Resolve promise with false.
+    auto has_cache = load_name_to_cache_map(*storage_bottle).contains(cache_name);
+
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, has_cache]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, JS::Value { has_cache });
+    }));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto storage_bottle = relevant_storage_bottle();
+    if (!storage_bottle)
+        return storage_unavailable_promise(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, then:
+    //             1. Resolve promise with a new Cache object that represents value.
+    //             2. Abort these steps.
+    auto name_to_cache_map = load_name_to_cache_map(*storage_bottle);
+    RefPtr<RequestResponseList> cache;
+
+    if (auto cache_id = name_to_cache_map.get(cache_name); cache_id.has_value()) {
+        cache = RequestResponseList::load(*storage_bottle, *cache_id);
+    } else {
+        //  2. Let cache be a new request response list.
+        cache = RequestResponseList::create(MUST(Crypto::generate_random_uuid()));
+
+        //  3. Set the relevant name to cache map[cacheName] to cache. If this cache write operation failed due to
+        //     exceeding the granted quota limit, reject promise with a "QuotaExceededError" DOMException and abort
+        //     these steps.
+        name_to_cache_map.set(cache_name, cache->cache_id());
+
+        if (cache->store(*storage_bottle).has<WebView::StorageOperationError>())
+            return WebIDL::create_rejected_promise(realm, WebIDL::QuotaExceededError::create(realm, "Not enough storage space to create the cache"_utf16));
+
+        if (store_name_to_cache_map(*storage_bottle, name_to_cache_map).has<WebView::StorageOperationError>()) {
+            RequestResponseList::remove(*storage_bottle, cache->cache_id());
+            return WebIDL::create_rejected_promise(realm, WebIDL::QuotaExceededError::create(realm, "Not enough storage space to create the cache"_utf16));
+        }
+    }
+
+    //     4. Resolve promise with a new Cache object that represents cache.
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, storage_bottle = GC::Ref { *storage_bottle }, cache = cache.release_nonnull()]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, Cache::create(realm, storage_bottle, cache));
+    }));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto storage_bottle = relevant_storage_bottle();
+    if (!storage_bottle)
+        return storage_unavailable_promise(realm);
+
+    // 1. Let promise be the result of running the algorithm specified in has(cacheName) method with cacheName.
+    // 2. Return the result of reacting to promise with a fulfillment handler that, when called with argument
+    //    cacheExists, performs the following substeps:
+    //     1. If cacheExists is false, then:
+    //         1. Return false.
+    //     2. Let cacheJobPromise be a new promise.
+    //     3. Run the following substeps in parallel:
+    //         1. Remove the relevant name to cache map[cacheName].
+    //         2. Resolve cacheJobPromise with true.
+    auto name_to_cache_map = load_name_to_cache_map(*storage_bottle);
+    auto cache_id = name_to_cache_map.take(cache_name);
+
+    if (cache_id.has_value()) {
+        // NB: Removing a cache only ever shrinks the stored map, so this cannot exceed the quota.
+        (void)store_name_to_cache_map(*storage_bottle, name_to_cache_map);
+        RequestResponseList::remove(*storage_bottle, *cache_id);
+    }
+
+    auto promise = WebIDL::create_promise(realm);
+
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, cache_existed = cache_id.has_value()]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::resolve_promise(realm, promise, JS::Value { cache_existed });
+    }));
+
+    //     4. Return cacheJobPromise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
+{
+    auto& realm = this->realm();
+
+    auto storage_bottle = relevant_storage_bottle();
+    if (!storage_bottle)
+        return storage_unavailable_promise(realm);
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    //     1. Let cacheKeys be the result of getting the keys of the relevant name to cache map.
+    //        NOTE: The items in the result ordered set are in the order that their corresponding entry was added to the
+    //              name to cache map.
+    auto name_to_cache_map = load_name_to_cache_map(*storage_bottle);
+
+    Vector<String> cache_keys;
+    cache_keys.ensure_capacity(name_to_cache_map.size());
+    for (auto const& [cache_name, cache_id] : name_to_cache_map)
+        cache_keys.unchecked_append(cache_name);
+
+    //     2. Resolve promise with cacheKeys.
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, cache_keys = move(cache_keys)]() {
+        HTML::TemporaryExecutionContext execution_context { realm };
+
+        auto array = JS::Array::create_from<String>(realm, cache_keys, [&](auto const& cache_name) {
+            return JS::PrimitiveString::create(realm.vm(), cache_name);
+        });
+        WebIDL::resolve_promise(realm, promise, array);
+    }));
+
+    // 3. Return promise.
+    return promise;
 }
 
 }
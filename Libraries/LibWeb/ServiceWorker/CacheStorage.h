@@ -6,24 +6,39 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
+// https://w3c.github.io/ServiceWorker/#dfn-name-to-cache-map
+// NB: Caches are identified by the storage bottle items that hold their request response list, so the map holds the
+//     identifier of each cache rather than the cache itself.
+using NameToCacheMap = OrderedHashMap<String, String>;
+
 // https://w3c.github.io/ServiceWorker/#cachestorage-interface
 class CacheStorage : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(CacheStorage, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(CacheStorage);
 
 public:
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options = {});
     GC::Ref<WebIDL::Promise> has(String const& cache_name);
     GC::Ref<WebIDL::Promise> open(String const& cache_name);
+    GC::Ref<WebIDL::Promise> delete_(String const& cache_name);
+    GC::Ref<WebIDL::Promise> keys();
 
 private:
     explicit CacheStorage(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    GC::Ptr<StorageAPI::StorageBottle> relevant_storage_bottle();
+
+    GC::Ptr<StorageAPI::StorageBottle> m_storage_bottle;
 };
 
 }
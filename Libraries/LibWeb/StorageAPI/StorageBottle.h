@@ -24,7 +24,7 @@ class StorageBottle : public GC::Cell {
     GC_CELL(StorageBottle, GC::Cell);
 
 public:
-    static GC::Ref<StorageBottle> create(GC::Heap& heap, GC::Ref<Page> page, StorageType type, StorageKey key, Optional<u64> quota);
+    static GC::Ref<StorageBottle> create(GC::Heap& heap, GC::Ref<Page> page, StorageType type, StorageEndpointType endpoint, StorageKey key, Optional<u64> quota);
 
     virtual ~StorageBottle() = default;
 
@@ -54,9 +54,9 @@ class LocalStorageBottle final : public StorageBottle {
     GC_DECLARE_ALLOCATOR(LocalStorageBottle);
 
 public:
-    static GC::Ref<LocalStorageBottle> create(GC::Heap& heap, GC::Ref<Page> page, StorageKey key, Optional<u64> quota)
+    static GC::Ref<LocalStorageBottle> create(GC::Heap& heap, GC::Ref<Page> page, StorageEndpointType endpoint, StorageKey key, Optional<u64> quota)
     {
-        return heap.allocate<LocalStorageBottle>(page, key, quota);
+        return heap.allocate<LocalStorageBottle>(page, endpoint, key, quota);
     }
 
     virtual size_t size() const override;
@@ -68,15 +68,19 @@ public:
 
     virtual void visit_edges(GC::Cell::Visitor& visitor) override;
 
+    StorageKey const& storage_key() const { return m_storage_key; }
+
 private:
-    explicit LocalStorageBottle(GC::Ref<Page> page, StorageKey key, Optional<u64> quota)
+    explicit LocalStorageBottle(GC::Ref<Page> page, StorageEndpointType endpoint, StorageKey key, Optional<u64> quota)
         : StorageBottle(quota)
         , m_page(move(page))
+        , m_endpoint(endpoint)
         , m_storage_key(move(key))
     {
     }
 
     GC::Ref<Page> m_page;
+    StorageEndpointType m_endpoint;
     StorageKey m_storage_key;
 };
 
@@ -112,6 +112,8 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_last_write_promise);
     visitor.visit(m_unwritten_chunks);
     visitor.visit(m_on_shutdown);
+    visitor.visit(m_read_request);
+    visitor.visit(m_write_chunk_and_process);
 }
 
 void ReadableStreamPipeTo::process()
@@ -220,26 +222,33 @@ void ReadableStreamPipeTo::read_chunk()
     if (check_for_error_and_close_states())
         return;
 
-    auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
-        m_unwritten_chunks.append(chunk);
-
-        if (check_for_error_and_close_states())
-            return;
-
-        HTML::queue_a_microtask(nullptr, GC::create_function(m_realm->heap(), [this]() {
+    // OPTIMIZATION: Piping a stream reads every one of its chunks, so we don't allocate a new read request along with its
+    //               callbacks for each of them.
+    if (!m_read_request) {
+        m_write_chunk_and_process = GC::create_function(heap(), [this]() {
             HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
             write_chunk();
             process();
-        }));
-    });
+        });
 
-    auto on_complete = GC::create_function(heap(), [this]() {
-        if (!check_for_error_and_close_states())
-            finish();
-    });
+        auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
+            m_unwritten_chunks.append(chunk);
+
+            if (check_for_error_and_close_states())
+                return;
+
+            HTML::queue_a_microtask(nullptr, *m_write_chunk_and_process);
+        });
+
+        auto on_complete = GC::create_function(heap(), [this]() {
+            if (!check_for_error_and_close_states())
+                finish();
+        });
+
+        m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, *m_on_shutdown);
+    }
 
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, *m_on_shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
+    readable_stream_default_reader_read(m_reader, *m_read_request);
 }
 
 void ReadableStreamPipeTo::write_chunk()
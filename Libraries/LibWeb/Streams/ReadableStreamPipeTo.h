@@ -15,6 +15,8 @@
 
 namespace Web::Streams::Detail {
 
+class ReadableStreamPipeToReadRequest;
+
 // https://streams.spec.whatwg.org/#ref-for-in-parallel
 class ReadableStreamPipeTo final : public JS::Cell {
     GC_CELL(ReadableStreamPipeTo, JS::Cell);
@@ -73,6 +75,10 @@ private:
 
     GC::Ref<WebIDL::ReactionSteps> m_on_shutdown;
 
+    // NB: These are created on the first read and then reused for every chunk, as none of them hold any per-chunk state.
+    GC::Ptr<ReadableStreamPipeToReadRequest> m_read_request;
+    GC::Ptr<GC::Function<void()>> m_write_chunk_and_process;
+
     bool m_prevent_close { false };
     bool m_prevent_abort { false };
     bool m_prevent_cancel { false };
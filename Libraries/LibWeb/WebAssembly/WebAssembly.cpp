@@ -7,8 +7,10 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/MemoryStream.h>
+#include <AK/OrderedHashMap.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -19,12 +21,16 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/BackgroundAction.h>
+#include <LibThreading/Mutex.h>
+#include <LibURL/Site.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/MIME.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebAssembly/Global.h>
@@ -40,6 +46,7 @@
 namespace Web::WebAssembly {
 
 static GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM&, ByteBuffer, HTML::Task::Source = HTML::Task::Source::Unspecified);
+static void finish_asynchronously_compiling_webassembly_module(JS::VM&, GC::Ref<WebIDL::Promise>, HTML::Task::Source, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>);
 static GC::Ref<WebIDL::Promise> instantiate_promise_of_module(JS::VM&, GC::Ref<WebIDL::Promise>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> asynchronously_instantiate_webassembly_module(JS::VM&, GC::Ref<Module>, GC::Ptr<JS::Object> import_object);
 static GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM&, GC::Ref<WebIDL::Promise>);
@@ -425,18 +432,95 @@ JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webass
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
-    FixedMemoryStream stream { data.bytes() };
+    auto cache_partition = compiled_module_cache_partition(*vm.current_realm());
+    if (!cache_partition.has_value())
+        return finish_compiling_webassembly_module(vm, parse_and_validate_webassembly_module(data));
+
+    auto cache_key = compiled_module_cache_key(cache_partition.release_value(), data);
+    if (auto module = cached_compiled_module(cache_key))
+        return finish_compiling_webassembly_module(vm, module.release_nonnull());
+
+    auto module_or_error = parse_and_validate_webassembly_module(data);
+    if (!module_or_error.is_error())
+        cache_compiled_module(move(cache_key), module_or_error.value());
+    return finish_compiling_webassembly_module(vm, move(module_or_error));
+}
+
+// OPTIMIZATION: Pages tend to compile the same module again and again (on every reload, and in every worker that runs
+//               it), and parsing and validating a large module takes a long time. Since validation also lowers the
+//               function bodies for the bytecode interpreter, and nothing changes a module once it has been
+//               validated, the validated modules are shared by everyone that compiles the same bytes.
+//               Like the HTTP cache, the cache is partitioned by top-level site and origin, so that a page can't
+//               learn through timing which modules other sites have compiled.
+//               The cache is looked up from background compilation threads, but only the main thread takes
+//               references to the cached modules, as their reference counts aren't atomic.
+static constexpr size_t compiled_module_cache_capacity = 8;
+static Threading::Mutex s_compiled_module_cache_mutex;
+static OrderedHashMap<ByteBuffer, NonnullRefPtr<Wasm::Module>> s_compiled_module_cache;
+
+Optional<ByteBuffer> compiled_module_cache_partition(JS::Realm& realm)
+{
+    auto const& settings = HTML::principal_realm_settings_object(realm);
+
+    // NB: Opaque origins all serialize to "null", so modules compiled for them can't be told apart and are not cached.
+    auto origin = settings.origin();
+    if (origin.is_opaque() || !settings.top_level_origin.has_value() || settings.top_level_origin->is_opaque())
+        return {};
+
+    auto top_level_site = URL::Site::obtain(*settings.top_level_origin);
+    return MUST(ByteBuffer::copy(ByteString::formatted("{} {}", top_level_site.serialize(), origin.serialize()).bytes()));
+}
+
+ByteBuffer compiled_module_cache_key(ByteBuffer partition, ReadonlyBytes data)
+{
+    partition.append('\0');
+    partition.append(::Crypto::Hash::SHA256::hash(data).bytes());
+    return partition;
+}
+
+bool is_compiled_module_cached(ByteBuffer const& key)
+{
+    Threading::MutexLocker locker { s_compiled_module_cache_mutex };
+    return s_compiled_module_cache.contains(key);
+}
+
+RefPtr<Wasm::Module> cached_compiled_module(ByteBuffer const& key)
+{
+    Threading::MutexLocker locker { s_compiled_module_cache_mutex };
+    if (auto module = s_compiled_module_cache.get(key); module.has_value())
+        return *module;
+    return nullptr;
+}
+
+void cache_compiled_module(ByteBuffer key, NonnullRefPtr<Wasm::Module> module)
+{
+    Threading::MutexLocker locker { s_compiled_module_cache_mutex };
+    if (s_compiled_module_cache.size() >= compiled_module_cache_capacity && !s_compiled_module_cache.contains(key))
+        s_compiled_module_cache.remove(ByteBuffer { s_compiled_module_cache.begin()->key });
+    s_compiled_module_cache.set(move(key), move(module));
+}
+
+// NB: This does not touch the JS heap, which lets us run it off the main thread.
+ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> parse_and_validate_webassembly_module(ReadonlyBytes data)
+{
+    FixedMemoryStream stream { data };
     auto module_result = Wasm::Module::parse(stream);
-    if (module_result.is_error()) {
-        return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
-    }
+    if (module_result.is_error())
+        return Wasm::parse_error_to_byte_string(module_result.error());
 
-    auto& cache = get_cache(*vm.current_realm());
-    if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
-        return vm.throw_completion<CompileError>(validation_result.error().error_string);
-    }
-    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
-    cache.add_compiled_module(compiled_module);
+    auto module = module_result.release_value();
+    if (auto validation_result = Wasm::AbstractMachine::validate(module); validation_result.is_error())
+        return validation_result.release_error().error_string;
+    return module;
+}
+
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> finish_compiling_webassembly_module(JS::VM& vm, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> module_or_error)
+{
+    if (module_or_error.is_error())
+        return vm.throw_completion<CompileError>(module_or_error.release_error());
+
+    auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_or_error.release_value());
+    get_cache(*vm.current_realm()).add_compiled_module(compiled_module);
     return compiled_module;
 }
 
@@ -787,35 +871,78 @@ GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, B
     auto promise = WebIDL::create_promise(realm);
 
     // 2. Run the following steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(vm.heap(), [&vm, &realm, bytes = move(bytes), promise, task_source]() mutable {
-        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-        // 1. Compile the WebAssembly module bytes and store the result as module.
-        auto module_or_error = Detail::compile_a_webassembly_module(vm, move(bytes));
+    // NB: Parsing and validating the module is the expensive part of compiling it, and it doesn't touch the JS heap,
+    //     so we do that on a background thread and only finish up on this one.
+    // NB: If the module is already in the compiled module cache, the background thread only tells us so, and we take it
+    //     out of the cache on this thread.
+    struct CompilationResult {
+        Optional<ByteBuffer> cache_key;
+        ByteBuffer bytes;
+        Optional<ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>> module_or_error;
+    };
+    (void)Threading::BackgroundAction<CompilationResult>::construct(
+        [bytes = move(bytes), cache_partition = Detail::compiled_module_cache_partition(realm)](auto&) mutable -> ErrorOr<CompilationResult> {
+            Optional<ByteBuffer> cache_key;
+            if (cache_partition.has_value()) {
+                cache_key = Detail::compiled_module_cache_key(cache_partition.release_value(), bytes);
+                if (Detail::is_compiled_module_cached(*cache_key))
+                    return CompilationResult { move(cache_key), move(bytes), {} };
+            }
+            auto module_or_error = Detail::parse_and_validate_webassembly_module(bytes);
+            return CompilationResult { move(cache_key), {}, move(module_or_error) };
+        },
+        [&vm, promise = GC::make_root(promise), task_source](CompilationResult compilation_result) -> ErrorOr<void> {
+            auto module_or_error = [&] -> ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> {
+                if (compilation_result.module_or_error.has_value()) {
+                    if (compilation_result.cache_key.has_value() && !compilation_result.module_or_error->is_error())
+                        Detail::cache_compiled_module(compilation_result.cache_key.release_value(), compilation_result.module_or_error->value());
+                    return compilation_result.module_or_error.release_value();
+                }
+                if (auto module = Detail::cached_compiled_module(*compilation_result.cache_key))
+                    return module.release_nonnull();
+
+                // NB: The module was evicted from the cache while we were looking it up, so we have to compile it after all.
+                return Detail::parse_and_validate_webassembly_module(compilation_result.bytes);
+            }();
+            finish_asynchronously_compiling_webassembly_module(vm, *promise, task_source, move(module_or_error));
+            return {};
+        });
 
-        // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
-        HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
-            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-            auto& realm = HTML::relevant_realm(*promise->promise());
+    // 3. Return promise.
+    return promise;
+}
 
-            // 1. If module is error, reject promise with a CompileError exception.
-            if (module_or_error.is_error()) {
-                WebIDL::reject_promise(realm, promise, module_or_error.error_value());
-            }
+static void finish_asynchronously_compiling_webassembly_module(JS::VM& vm, GC::Ref<WebIDL::Promise> promise, HTML::Task::Source task_source, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> compilation_result)
+{
+    auto& realm = HTML::relevant_realm(*promise->promise());
+    HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
 
-            // 2. Otherwise,
-            else {
-                // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
-                // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
-                auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+    // 1. Compile the WebAssembly module bytes and store the result as module.
+    auto module_or_error = [&]() -> JS::ThrowCompletionOr<NonnullRefPtr<Detail::CompiledWebAssemblyModule>> {
+        TRY(Detail::host_ensure_can_compile_wasm_bytes(vm));
+        return Detail::finish_compiling_webassembly_module(vm, move(compilation_result));
+    }();
 
-                // 2. Resolve promise with moduleObject.
-                WebIDL::resolve_promise(realm, promise, module_object);
-            }
-        }));
-    }));
+    // 2. Queue a task to perform the following steps. If taskSource was provided, queue the task on that task source.
+    HTML::queue_a_task(task_source, nullptr, nullptr, GC::create_function(vm.heap(), [&realm, promise, module_or_error = move(module_or_error)]() mutable {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        auto& realm = HTML::relevant_realm(*promise->promise());
 
-    // 3. Return promise.
-    return promise;
+        // 1. If module is error, reject promise with a CompileError exception.
+        if (module_or_error.is_error()) {
+            WebIDL::reject_promise(realm, promise, module_or_error.error_value());
+        }
+
+        // 2. Otherwise,
+        else {
+            // 1. Construct a WebAssembly module object from module and bytes, and let moduleObject be the result.
+            // FIXME: Save bytes to the Module instance instead of moving into compile_a_webassembly_module
+            auto module_object = realm.create<Module>(realm, module_or_error.release_value());
+
+            // 2. Resolve promise with moduleObject.
+            WebIDL::resolve_promise(realm, promise, module_object);
+        }
+    }));
 }
 
 // https://webassembly.github.io/spec/js-api/#asynchronously-instantiate-a-webassembly-module
@@ -103,6 +103,13 @@ WebAssemblyCache& get_cache(JS::Realm&);
 
 JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS::VM&, Wasm::Module const&, GC::Ptr<JS::Object> import_object);
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM&, ByteBuffer);
+ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString> parse_and_validate_webassembly_module(ReadonlyBytes);
+JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> finish_compiling_webassembly_module(JS::VM&, ErrorOr<NonnullRefPtr<Wasm::Module>, ByteString>);
+Optional<ByteBuffer> compiled_module_cache_partition(JS::Realm&);
+ByteBuffer compiled_module_cache_key(ByteBuffer partition, ReadonlyBytes);
+bool is_compiled_module_cached(ByteBuffer const& key);
+RefPtr<Wasm::Module> cached_compiled_module(ByteBuffer const& key);
+void cache_compiled_module(ByteBuffer key, NonnullRefPtr<Wasm::Module>);
 JS::NativeFunction* create_native_function(JS::VM&, Wasm::FunctionAddress address, Utf16FlyString name, Instance* instance = nullptr);
 JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM&, JS::Value value, Wasm::ValueType const& type);
 Wasm::Value default_webassembly_value(JS::VM&, Wasm::ValueType type);
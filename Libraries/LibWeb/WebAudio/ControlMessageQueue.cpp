@@ -9,14 +9,14 @@ namespace Web::WebAudio {
 
 void ControlMessageQueue::enqueue(ControlMessage message)
 {
-    Threading::MutexLocker locker(m_mutex);
-    m_messages.append(move(message));
+    m_messages.push(move(message));
 }
 
 Vector<ControlMessage> ControlMessageQueue::drain()
 {
-    Threading::MutexLocker locker(m_mutex);
-    return move(m_messages);
+    Vector<ControlMessage> messages;
+    m_messages.take_all([&](ControlMessage&& message) { messages.append(move(message)); });
+    return messages;
 }
 
 }
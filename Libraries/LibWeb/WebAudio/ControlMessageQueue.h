@@ -6,14 +6,16 @@
 
 #pragma once
 
+#include <AK/MultiProducerQueue.h>
 #include <AK/Vector.h>
-#include <LibThreading/Mutex.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/WebAudio/ControlMessage.h>
 
 namespace Web::WebAudio {
 
 // https://webaudio.github.io/web-audio-api/#control-message-queue
+// NB: The rendering thread must never wait on the control thread, or a busy control thread would cause audible
+//     glitches, so messages are handed over without taking a lock.
 class WEB_API ControlMessageQueue {
 
 public:
@@ -21,8 +23,7 @@ public:
     Vector<ControlMessage> drain(); // Called by the rendering thread.
 
 private:
-    mutable Threading::Mutex m_mutex;
-    Vector<ControlMessage> m_messages;
+    MultiProducerQueue<ControlMessage> m_messages;
 };
 
 }
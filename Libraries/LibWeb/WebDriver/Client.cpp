@@ -11,6 +11,7 @@
 #include <AK/ByteBuffer.h>
 #include <AK/Debug.h>
 #include <AK/Format.h>
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/Span.h>
@@ -109,14 +110,15 @@ static constexpr auto s_webdriver_endpoints = Array {
     ROUTE(GET, "/session/:session_id/screenshot"sv, take_screenshot),
     ROUTE(GET, "/session/:session_id/element/:element_id/screenshot"sv, take_element_screenshot),
     ROUTE(POST, "/session/:session_id/print"sv, print_page),
+    ROUTE(POST, "/session/:session_id/ladybird/batch"sv, execute_batch),
 };
 
 // https://w3c.github.io/webdriver/#dfn-match-a-request
-static ErrorOr<MatchedRoute, Error> match_route(HTTP::HttpRequest const& request)
+static ErrorOr<MatchedRoute, Error> match_route(HTTP::HttpRequest::Method method, StringView resource)
 {
-    dbgln_if(WEBDRIVER_ROUTE_DEBUG, "match_route({}, {})", HTTP::to_string_view(request.method()), request.resource());
+    dbgln_if(WEBDRIVER_ROUTE_DEBUG, "match_route({}, {})", HTTP::to_string_view(method), resource);
 
-    auto request_path = request.resource().view();
+    auto request_path = resource;
     Vector<String> parameters;
 
     auto next_segment = [](auto& path) -> Optional<StringView> {
@@ -134,14 +136,14 @@ static ErrorOr<MatchedRoute, Error> match_route(HTTP::HttpRequest const& request
 
     for (auto const& route : s_webdriver_endpoints) {
         dbgln_if(WEBDRIVER_ROUTE_DEBUG, "- Checking {} {}", HTTP::to_string_view(route.method), route.path);
-        if (route.method != request.method())
+        if (route.method != method)
             continue;
 
         auto route_path = route.path;
         Optional<bool> match;
 
         auto on_failed_match = [&]() {
-            request_path = request.resource();
+            request_path = resource;
             parameters.clear();
             match = false;
         };
@@ -176,6 +178,17 @@ static JsonValue make_success_response(JsonValue value)
     return result;
 }
 
+static JsonObject make_error_object(Error const& error)
+{
+    JsonObject error_object;
+    error_object.set("error"sv, error.error);
+    error_object.set("message"sv, error.message);
+    error_object.set("stacktrace"sv, ""sv);
+    if (error.data.has_value())
+        error_object.set("data"sv, *error.data);
+    return error_object;
+}
+
 Client::Client(NonnullOwnPtr<Core::BufferedTCPSocket> socket)
     : m_socket(move(socket))
 {
@@ -269,11 +282,80 @@ ErrorOr<void, Client::WrappedError> Client::handle_request(HTTP::HttpRequest con
         dbgln("Body: {}", body);
     }
 
-    auto [handler, parameters] = TRY(match_route(request));
+    auto [handler, parameters] = TRY(match_route(request.method(), request.resource()));
     auto result = TRY((*handler)(*this, move(parameters), move(body)));
     return send_success_response(request, move(result));
 }
 
+static Optional<HTTP::HttpRequest::Method> batched_command_method(StringView method)
+{
+    if (method == "GET"sv)
+        return HTTP::HttpRequest::Method::GET;
+    if (method == "POST"sv)
+        return HTTP::HttpRequest::Method::POST;
+    if (method == "DELETE"sv)
+        return HTTP::HttpRequest::Method::DELETE;
+    return {};
+}
+
+// AD-HOC: Runs a list of commands for one session back to back, so that clients issuing many small commands pay for a
+//         single HTTP round trip rather than one per command. The payload is of the form:
+//
+//         { "commands": [ { "method": "POST", "path": "/element", "body": { ... } }, ... ] }
+//
+//         where each path is relative to the session's URL and the body is optional. The result holds, in order, the
+//         { "value": ... } or { "error": ... } object of each command that ran. Commands after the first one to fail
+//         are not run.
+Response Client::execute_batch(Parameters parameters, JsonValue payload)
+{
+    if (!payload.is_object())
+        return Error::from_code(ErrorCode::InvalidArgument, "Payload is not a JSON object"sv);
+
+    auto commands = payload.as_object().get_array("commands"sv);
+    if (!commands.has_value())
+        return Error::from_code(ErrorCode::InvalidArgument, "Payload does not contain a 'commands' array"sv);
+
+    auto session_path = MUST(String::formatted("/session/{}", parameters[0]));
+
+    auto execute_command = [&](JsonValue const& command) -> Response {
+        if (!command.is_object())
+            return Error::from_code(ErrorCode::InvalidArgument, "Batched command is not a JSON object"sv);
+
+        auto method_name = command.as_object().get_string("method"sv);
+        auto path = command.as_object().get_string("path"sv);
+        if (!method_name.has_value() || !path.has_value())
+            return Error::from_code(ErrorCode::InvalidArgument, "Batched command must have a 'method' and a 'path'"sv);
+
+        auto method = batched_command_method(*method_name);
+        if (!method.has_value())
+            return Error::from_code(ErrorCode::InvalidArgument, "Batched command has an unsupported method"sv);
+
+        auto resource = MUST(String::formatted("{}{}", session_path, *path));
+        auto [handler, command_parameters] = TRY(match_route(*method, resource));
+
+        JsonValue body;
+        if (auto command_body = command.as_object().get("body"sv); command_body.has_value())
+            body = *command_body;
+
+        return (*handler)(*this, move(command_parameters), move(body));
+    };
+
+    JsonArray results;
+
+    for (auto const& command : commands->values()) {
+        auto result = execute_command(command);
+
+        if (result.is_error()) {
+            results.must_append(make_error_object(result.error()));
+            break;
+        }
+
+        results.must_append(make_success_response(result.release_value()));
+    }
+
+    return JsonValue { move(results) };
+}
+
 void Client::handle_error(HTTP::HttpRequest const& request, WrappedError const& error)
 {
     error.visit(
@@ -328,15 +410,8 @@ ErrorOr<void, Client::WrappedError> Client::send_error_response(HTTP::HttpReques
     dbgln_if(WEBDRIVER_DEBUG, "Sending error response: {} {}: {}", error.http_status, error.error, error.message);
     auto reason = HTTP::reason_phrase_for_code(error.http_status);
 
-    JsonObject error_response;
-    error_response.set("error"sv, error.error);
-    error_response.set("message"sv, error.message);
-    error_response.set("stacktrace"sv, ""sv);
-    if (error.data.has_value())
-        error_response.set("data"sv, *error.data);
-
     JsonObject result;
-    result.set("value"sv, move(error_response));
+    result.set("value"sv, make_error_object(error));
 
     auto content = result.serialized();
 
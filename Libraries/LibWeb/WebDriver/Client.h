@@ -117,6 +117,9 @@ public:
     // 18. Print, https://w3c.github.io/webdriver/#print
     virtual Response print_page(Parameters parameters, JsonValue payload) = 0;
 
+    // Ladybird extensions
+    Response execute_batch(Parameters parameters, JsonValue payload);
+
     Function<void()> on_death;
 
 protected:
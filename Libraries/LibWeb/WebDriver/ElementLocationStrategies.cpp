@@ -11,6 +11,8 @@
 #include <LibWeb/DOM/StaticNodeList.h>
 #include <LibWeb/WebDriver/ElementLocationStrategies.h>
 #include <LibWeb/WebDriver/ElementReference.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/XPath/XPath.h>
 
 namespace Web::WebDriver {
 
@@ -111,9 +113,48 @@ static GC::Ref<DOM::NodeList> locate_element_by_tag_name(DOM::ParentNode& start_
 }
 
 // https://w3c.github.io/webdriver/#xpath
-static ErrorOr<GC::Ref<DOM::NodeList>, Error> locate_element_by_x_path(DOM::ParentNode&, StringView)
+static ErrorOr<GC::Ref<DOM::NodeList>, Error> locate_element_by_x_path(DOM::ParentNode& start_node, StringView selector)
 {
-    return Error::from_code(ErrorCode::UnsupportedOperation, "Not implemented: locate element by XPath"sv);
+    auto& realm = start_node.realm();
+
+    // 1. Let evaluateResult be the result of calling evaluate, with arguments selector, start node, null,
+    //    ORDERED_NODE_SNAPSHOT_TYPE, and null.
+    auto evaluate_result = XPath::evaluate(realm, MUST(String::from_utf8(selector)), start_node, nullptr, XPath::XPathResult::ORDERED_NODE_SNAPSHOT_TYPE, nullptr);
+
+    //    If this throws a "SyntaxError" DOMException, return error with error code invalid selector; otherwise, if this
+    //    throws any other exception return error with error code unknown error.
+    if (evaluate_result.is_exception()) {
+        auto const& exception = evaluate_result.exception();
+        if (exception.has<GC::Ref<WebIDL::DOMException>>() && exception.get<GC::Ref<WebIDL::DOMException>>()->name() == "SyntaxError"sv)
+            return Error::from_code(ErrorCode::InvalidSelector, "XPath expression is invalid"sv);
+        return Error::from_code(ErrorCode::UnknownError, "XPath evaluation failed"sv);
+    }
+
+    // 2. Let index be 0.
+    // 3. Let length be the result of getting the property "snapshotLength" from evaluateResult.
+    auto length = evaluate_result.value()->snapshot_length();
+
+    // 4. Let result be an empty NodeList.
+    Vector<GC::Root<DOM::Node>> result;
+    result.ensure_capacity(length);
+
+    // 5. Repeat, while index is less than length:
+    for (WebIDL::UnsignedLong index = 0; index < length; ++index) {
+        // 1. Let node be the result of calling snapshotItem with evaluateResult as this and index as the argument.
+        auto node = evaluate_result.value()->snapshot_item(index);
+
+        // 2. If node is not an element return an error with error code invalid selector.
+        if (!node || !node->is_element())
+            return Error::from_code(ErrorCode::InvalidSelector, "XPath expression did not select only elements"sv);
+
+        // 3. Append node to result.
+        result.unchecked_append(*node);
+
+        // 4. Increment index by 1.
+    }
+
+    // 6. Return success with data result.
+    return DOM::StaticNodeList::create(realm, move(result));
 }
 
 Optional<LocationStrategy> location_strategy_from_string(StringView type)
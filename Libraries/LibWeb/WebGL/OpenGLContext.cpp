@@ -51,6 +51,21 @@ struct OpenGLContext::Impl {
 #endif
 };
 
+#ifdef ENABLE_WEBGL
+// NB: EGL tracks the current context per thread, so the cached one has to be per thread as well.
+static thread_local EGLContext s_current_egl_context = EGL_NO_CONTEXT;
+
+// OPTIMIZATION: Every WebGL call makes its context current first, and almost always it already is. eglMakeCurrent() isn't
+//               free even then, since it goes through ANGLE's global lock, so skip it when nothing would change.
+static void make_egl_context_current(EGLDisplay display, EGLContext context)
+{
+    if (s_current_egl_context == context)
+        return;
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+    s_current_egl_context = context;
+}
+#endif
+
 OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend_context, Impl impl, WebGLVersion webgl_version)
     : m_skia_backend_context(move(skia_backend_context))
     , m_impl(make<Impl>(impl))
@@ -62,7 +77,7 @@ OpenGLContext::~OpenGLContext()
 {
 #ifdef ENABLE_WEBGL
     free_surface_resources();
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    make_egl_context_current(m_impl->display, EGL_NO_CONTEXT);
     eglDestroyContext(m_impl->display, m_impl->context);
 #endif
 }
@@ -70,7 +85,7 @@ OpenGLContext::~OpenGLContext()
 void OpenGLContext::free_surface_resources()
 {
 #ifdef ENABLE_WEBGL
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->context);
 
     if (m_impl->framebuffer) {
         glDeleteFramebuffers(1, &m_impl->framebuffer);
@@ -307,7 +322,7 @@ void OpenGLContext::allocate_iosurface_painting_surface()
     };
     m_impl->surface = eglCreatePbufferFromClientBuffer(m_impl->display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), m_impl->config, surface_attributes);
 
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->context);
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(m_impl->texture_target == EGL_TEXTURE_RECTANGLE_ANGLE ? GL_TEXTURE_RECTANGLE_ANGLE : GL_TEXTURE_2D, m_impl->color_buffer);
@@ -371,7 +386,7 @@ void OpenGLContext::allocate_vkimage_painting_surface()
     VERIFY(m_impl->egl_image != EGL_NO_IMAGE);
 
     m_impl->surface = EGL_NO_SURFACE;
-    eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->context);
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(GL_TEXTURE_2D, m_impl->color_buffer);
@@ -425,7 +440,7 @@ void OpenGLContext::make_current()
 {
 #ifdef ENABLE_WEBGL
     allocate_painting_surface_if_needed();
-    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    make_egl_context_current(m_impl->display, m_impl->context);
 #endif
 }
 
@@ -235,6 +235,14 @@ JS::ThrowCompletionOr<String> to_string(JS::VM& vm, JS::Value value)
     return value.to_string(vm);
 }
 
+JS::ThrowCompletionOr<FlyString> to_fly_string(JS::VM& vm, JS::Value value)
+{
+    // OPTIMIZATION: Strings that are passed to the same API over and over only have to be interned the first time.
+    if (value.is_string())
+        return value.as_string().utf8_fly_string();
+    return FlyString { TRY(value.to_string(vm)) };
+}
+
 JS::ThrowCompletionOr<Utf16String> to_utf16_string(JS::VM& vm, JS::Value value)
 {
     return value.to_utf16_string(vm);
@@ -457,6 +465,19 @@ double integer_part(double n)
 template<Integral T>
 JS::ThrowCompletionOr<T> convert_to_int(JS::VM& vm, JS::Value value, EnforceRange enforce_range, Clamp clamp)
 {
+    // OPTIMIZATION: An Int32 that fits into T comes out of all of the steps below unchanged, regardless of [EnforceRange]
+    //               and [Clamp].
+    if (value.is_int32()) {
+        auto int32 = value.as_i32();
+        if constexpr (IsSigned<T>) {
+            if (sizeof(T) >= sizeof(i32) || (int32 >= NumericLimits<T>::min() && int32 <= NumericLimits<T>::max()))
+                return static_cast<T>(int32);
+        } else {
+            if (int32 >= 0 && static_cast<u32>(int32) <= NumericLimits<T>::max())
+                return static_cast<T>(int32);
+        }
+    }
+
     double upper_bound = 0;
     double lower_bound = 0;
 
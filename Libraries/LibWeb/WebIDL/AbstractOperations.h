@@ -24,6 +24,7 @@ WEB_API ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_sour
 JS::Completion call_user_object_operation(CallbackType& callback, Utf16FlyString const& operation_name, Optional<JS::Value> this_argument, ReadonlySpan<JS::Value> args);
 
 WEB_API JS::ThrowCompletionOr<String> to_string(JS::VM&, JS::Value);
+WEB_API JS::ThrowCompletionOr<FlyString> to_fly_string(JS::VM&, JS::Value);
 WEB_API JS::ThrowCompletionOr<Utf16String> to_utf16_string(JS::VM&, JS::Value);
 WEB_API JS::ThrowCompletionOr<String> to_usv_string(JS::VM&, JS::Value);
 JS::ThrowCompletionOr<Utf16String> to_utf16_usv_string(JS::VM&, JS::Value);
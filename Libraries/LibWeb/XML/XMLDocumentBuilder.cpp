@@ -51,9 +51,9 @@ XMLDocumentBuilder::XMLDocumentBuilder(DOM::Document& document, XMLScriptingSupp
     m_namespace_stack.append({ {}, 1 });
 }
 
-ErrorOr<void> XMLDocumentBuilder::set_source(ByteString source)
+ErrorOr<void> XMLDocumentBuilder::set_source(StringView source)
 {
-    m_document->set_source(TRY(String::from_byte_string(source)));
+    m_document->set_source(TRY(String::from_utf8(source)));
     return {};
 }
 
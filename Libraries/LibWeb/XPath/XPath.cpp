@@ -159,40 +159,135 @@ static void convert_xpath_result(xmlXPathObjectPtr xpath_result, XPath::XPathRes
     }
 }
 
-WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver)
+// Mirrors the subtree at the given node into a new libxml2 document, which the caller takes ownership of.
+static xmlNodePtr create_mirror(DOM::Node const& context_node, xmlDocPtr& xml_document)
 {
-    return realm.create<XPathExpression>(realm, expression, resolver);
+    xml_document = xmlNewDoc(nullptr);
+
+    if (context_node.type() == DOM::NodeType::DOCUMENT_NODE) {
+        xml_document->_private = bit_cast<void*>(&context_node);
+    } else {
+        xml_document->_private = bit_cast<void*>(&context_node.document());
+    }
+
+    auto* xml_node = mirror_node(xml_document, context_node);
+    if (!xml_node)
+        return nullptr;
+
+    xmlDocSetRootElement(xml_document, xml_node);
+
+    // OPTIMIZATION: Number the elements in document order up front, so that sorting node-sets compares these numbers
+    //               instead of walking the tree to find out which of two nodes comes first.
+    xmlXPathOrderDocElems(xml_document);
+
+    return xml_node;
 }
 
-WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> /*resolver*/, unsigned short type, GC::Ptr<XPathResult> result)
+WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> CompiledExpression::create(JS::Realm& realm, String const& expression)
 {
-    // Parse the expression as xpath
     ByteString bytes = expression.bytes_as_string_view();
     auto* xpath_compiled = xmlXPathCompile(bit_cast<xmlChar const*>(bytes.characters()));
     if (!xpath_compiled)
         return WebIDL::SyntaxError::create(realm, "Invalid XPath expression"_utf16);
-    ScopeGuard xpath_compiled_cleanup = [&] { xmlXPathFreeCompExpr(xpath_compiled); };
+    return adopt_ref(*new CompiledExpression(xpath_compiled));
+}
 
-    auto* xml_document = xmlNewDoc(nullptr);
-    ScopeGuard xml_cleanup = [&] { xmlFreeDoc(xml_document); };
+CompiledExpression::~CompiledExpression()
+{
+    xmlXPathFreeCompExpr(m_expression);
+}
 
-    if (context_node.type() == DOM::NodeType::DOCUMENT_NODE) {
-        xml_document->_private = bit_cast<void*>(&context_node);
-    } else {
-        xml_document->_private = bit_cast<void*>(&context_node.document());
+EvaluationCache::~EvaluationCache()
+{
+    clear_mirror();
+}
+
+// NB: Past this many expressions, we start over rather than keeping expressions around that might never be used again.
+static constexpr size_t max_cached_compiled_expressions = 256;
+
+WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> EvaluationCache::compiled_expression(JS::Realm& realm, String const& expression)
+{
+    if (auto it = m_compiled_expressions.find(expression); it != m_compiled_expressions.end())
+        return it->value;
+
+    auto compiled_expression = TRY(CompiledExpression::create(realm, expression));
+    if (m_compiled_expressions.size() >= max_cached_compiled_expressions)
+        m_compiled_expressions.clear();
+    m_compiled_expressions.set(expression, compiled_expression);
+    return compiled_expression;
+}
+
+_xmlNode* EvaluationCache::mirror_of(DOM::Node const& context_node)
+{
+    // NB: Only connected nodes are mirrored here. Changes to them are guaranteed to bump their document's versions,
+    //     while a disconnected subtree could be adopted into another document and changed there.
+    VERIFY(context_node.is_connected());
+
+    auto const& document = context_node.document();
+    if (m_mirrored_node == &context_node
+        && m_mirrored_dom_tree_version == document.dom_tree_version()
+        && m_mirrored_character_data_version == document.character_data_version()) {
+        return m_mirror_root;
     }
 
-    auto* xml_node = mirror_node(xml_document, context_node);
+    clear_mirror();
+    m_mirror_root = create_mirror(context_node, m_mirror_document);
+    m_mirrored_node = &context_node;
+    m_mirrored_dom_tree_version = document.dom_tree_version();
+    m_mirrored_character_data_version = document.character_data_version();
+    return m_mirror_root;
+}
+
+void EvaluationCache::clear_mirror()
+{
+    if (m_mirror_document)
+        xmlFreeDoc(m_mirror_document);
+    m_mirror_document = nullptr;
+    m_mirror_root = nullptr;
+    m_mirrored_node = nullptr;
+}
+
+void EvaluationCache::visit_edges(GC::Cell::Visitor& visitor)
+{
+    // NB: The mirror points at the DOM nodes it was made from, which stay alive through the mirrored node as long as
+    //     the DOM is unchanged.
+    visitor.visit(m_mirrored_node);
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver)
+{
+    return realm.create<XPathExpression>(realm, expression, resolver);
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> resolver, unsigned short type, GC::Ptr<XPathResult> result)
+{
+    // Parse the expression as xpath
+    auto compiled_expression = TRY(context_node.document().xpath_evaluation_cache().compiled_expression(realm, expression));
+    return evaluate(realm, *compiled_expression, context_node, resolver, type, result);
+}
+
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, CompiledExpression const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> /*resolver*/, unsigned short type, GC::Ptr<XPathResult> result)
+{
+    xmlDocPtr uncached_xml_document = nullptr;
+    ScopeGuard xml_cleanup = [&] {
+        if (uncached_xml_document)
+            xmlFreeDoc(uncached_xml_document);
+    };
+
+    xmlNodePtr xml_node = nullptr;
+    if (context_node.is_connected())
+        xml_node = context_node.document().xpath_evaluation_cache().mirror_of(context_node);
+    else
+        xml_node = create_mirror(context_node, uncached_xml_document);
+
     if (!xml_node) {
         return WebIDL::OperationError::create(realm, "XPath evaluation failed"_utf16);
     }
 
-    xmlDocSetRootElement(xml_document, xml_node);
-
-    auto* xpath_context = xmlXPathNewContext(xml_document);
+    auto* xpath_context = xmlXPathNewContext(xml_node->doc);
     xmlXPathSetContextNode(xml_node, xpath_context);
 
-    auto* xpath_result = xmlXPathCompiledEval(xpath_compiled, xpath_context);
+    auto* xpath_result = xmlXPathCompiledEval(expression.expression(), xpath_context);
 
     ScopeGuard xpath_result_cleanup = [&] {
         xmlXPathFreeObject(xpath_result);
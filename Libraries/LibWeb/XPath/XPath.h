@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/RefCounted.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -13,9 +16,59 @@
 #include "XPathNSResolver.h"
 #include "XPathResult.h"
 
+struct _xmlDoc;
+struct _xmlNode;
+struct _xmlXPathCompExpr;
+
 namespace Web::XPath {
 
+// An expression compiled by libxml2, which can be evaluated any number of times.
+class CompiledExpression : public RefCounted<CompiledExpression> {
+public:
+    static WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> create(JS::Realm&, String const& expression);
+    ~CompiledExpression();
+
+    _xmlXPathCompExpr* expression() const { return m_expression; }
+
+private:
+    explicit CompiledExpression(_xmlXPathCompExpr* expression)
+        : m_expression(expression)
+    {
+    }
+
+    _xmlXPathCompExpr* m_expression { nullptr };
+};
+
+// The state that one document's XPath evaluations share: the expressions that were compiled for
+// Document.evaluate(), and the libxml2 mirror of the subtree that was last evaluated against. The mirror is reused
+// until the DOM changes, so evaluating expressions in a loop only mirrors the tree once.
+class EvaluationCache {
+    AK_MAKE_NONCOPYABLE(EvaluationCache);
+    AK_MAKE_NONMOVABLE(EvaluationCache);
+
+public:
+    EvaluationCache() = default;
+    ~EvaluationCache();
+
+    WebIDL::ExceptionOr<NonnullRefPtr<CompiledExpression>> compiled_expression(JS::Realm&, String const& expression);
+    _xmlNode* mirror_of(DOM::Node const& context_node);
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    void clear_mirror();
+
+    HashMap<String, NonnullRefPtr<CompiledExpression>> m_compiled_expressions;
+
+    GC::Ptr<DOM::Node const> m_mirrored_node;
+    u64 m_mirrored_dom_tree_version { 0 };
+    u64 m_mirrored_character_data_version { 0 };
+    _xmlDoc* m_mirror_document { nullptr };
+    _xmlNode* m_mirror_root { nullptr };
+};
+
 WebIDL::ExceptionOr<GC::Ref<XPathExpression>> create_expression(JS::Realm& realm, String const& expression, GC::Ptr<XPathNSResolver> resolver);
 WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, String const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> resolver, unsigned short type, GC::Ptr<XPathResult> result);
+WebIDL::ExceptionOr<GC::Ref<XPathResult>> evaluate(JS::Realm& realm, CompiledExpression const& expression, DOM::Node const& context_node, GC::Ptr<XPathNSResolver> resolver, unsigned short type, GC::Ptr<XPathResult> result);
 
 }
@@ -44,7 +44,9 @@ XPathExpression::~XPathExpression() = default;
 WebIDL::ExceptionOr<GC::Ref<XPathResult>> XPathExpression::evaluate(DOM::Node const& context_node, WebIDL::UnsignedShort type, GC::Ptr<XPathResult> result)
 {
     auto& realm = this->realm();
-    return XPath::evaluate(realm, m_expression, context_node, m_resolver, type, result);
+    if (!m_compiled_expression)
+        m_compiled_expression = TRY(CompiledExpression::create(realm, m_expression));
+    return XPath::evaluate(realm, *m_compiled_expression, context_node, m_resolver, type, result);
 }
 
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/RefPtr.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebIDL/Types.h>
@@ -14,6 +15,8 @@
 
 namespace Web::XPath {
 
+class CompiledExpression;
+
 class XPathExpression final : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(XPathExpression, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(XPathExpression);
@@ -29,6 +32,9 @@ public:
 private:
     String m_expression;
     GC::Ptr<XPathNSResolver> m_resolver;
+
+    // Compiled on first evaluation, then reused for all others.
+    RefPtr<CompiledExpression> m_compiled_expression;
 };
 
 }
@@ -350,6 +350,7 @@ libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
 libweb_js_bindings(Serial/Serial)
 libweb_js_bindings(Serial/SerialPort)
+libweb_js_bindings(ServiceWorker/Cache)
 libweb_js_bindings(ServiceWorker/CacheStorage)
 libweb_js_bindings(ServiceWorker/ServiceWorker)
 libweb_js_bindings(ServiceWorker/ServiceWorkerContainer)
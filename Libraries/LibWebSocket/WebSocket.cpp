@@ -166,7 +166,13 @@ void WebSocket::drain_read()
         do {
             if (auto maybe_error = read_frame(); maybe_error.is_error())
                 break;
-        } while (!m_buffered_data.is_empty());
+        } while (m_buffered_data_offset < m_buffered_data.size());
+
+        if (m_buffered_data_offset == m_buffered_data.size())
+            m_buffered_data.clear_with_capacity();
+        else
+            m_buffered_data.remove(0, m_buffered_data_offset);
+        m_buffered_data_offset = 0;
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -408,7 +414,7 @@ ErrorOr<void> WebSocket::read_frame()
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
+    size_t cursor = m_buffered_data_offset;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
         if (cursor + count > m_buffered_data.size())
             return {};
@@ -476,24 +482,12 @@ ErrorOr<void> WebSocket::read_frame()
         masking_key[3] = masking_key_data[3];
     }
 
-    auto payload = ByteBuffer::create_uninitialized(payload_length).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
-    u64 read_length = 0;
-    while (read_length < payload_length) {
-        auto payload_part = get_buffered_bytes(payload_length - read_length);
-        if (payload_part.is_null())
-            return AK::Error::from_errno(EAGAIN);
-        // We read at most "actual_length - read" bytes, so this is safe to do.
-        payload.overwrite(read_length, payload_part.data(), payload_part.size());
-        read_length += payload_part.size();
-    }
+    auto payload_bytes = get_buffered_bytes(payload_length);
+    if (payload_length > 0 && payload_bytes.is_null())
+        return AK::Error::from_errno(EAGAIN);
+    auto payload = ByteBuffer::copy(payload_bytes).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    m_buffered_data_offset = cursor;
 
     if (is_masked) {
         // Unmask the payload
@@ -535,9 +529,8 @@ ErrorOr<void> WebSocket::read_frame()
         // Last fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
-        m_fragmented_data_buffer.clear();
+        payload = move(m_fragmented_data_buffer);
+        m_fragmented_data_buffer = {};
     }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(move(payload), true));
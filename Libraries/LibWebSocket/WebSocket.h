@@ -134,6 +134,9 @@ private:
     RefPtr<WebSocketImpl> m_impl;
 
     Vector<u8> m_buffered_data;
+    // NB: Frames are consumed from the front of m_buffered_data by advancing this offset. The consumed bytes are only
+    //     dropped once all complete frames of a read have been handled, instead of once per frame.
+    size_t m_buffered_data_offset { 0 };
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
 };
@@ -48,6 +48,10 @@ struct ApplicationSettingsObserver : public SettingsObserver {
             [](DNSOverUDP const& dns_over_udp) {
                 dbgln("Setting DNS server to {}:{} ({} local dnssec)", dns_over_udp.server_address, dns_over_udp.port, dns_over_udp.validate_dnssec_locally ? "with" : "without");
                 Application::request_server_client().async_set_dns_server(dns_over_udp.server_address, dns_over_udp.port, false, dns_over_udp.validate_dnssec_locally);
+            },
+            [](DNSOverHTTPS const& dns_over_https) {
+                dbgln("Setting DNS server to {}:{} with HTTPS ({} local dnssec)", dns_over_https.server_address, dns_over_https.port, dns_over_https.validate_dnssec_locally ? "with" : "without");
+                Application::request_server_client().async_set_dns_over_https_server(dns_over_https.server_address, dns_over_https.port, dns_over_https.validate_dnssec_locally);
             });
     }
 };
@@ -98,12 +102,15 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<HeadlessMode> headless_mode;
     Optional<int> window_width;
     Optional<int> window_height;
+    Optional<size_t> headless_view_count;
     bool new_window = false;
     bool force_new_process = false;
     bool allow_popups = false;
     bool disable_scripting = false;
     bool disable_sql_database = false;
     Optional<u16> devtools_port;
+    Optional<size_t> web_content_process_pool_size;
+    Optional<u64> memory_budget_mib;
     Optional<StringView> debug_process;
     Optional<StringView> profile_process;
     Optional<StringView> webdriver_content_ipc_path;
@@ -112,6 +119,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<StringView> default_time_zone;
     Optional<u16> dns_server_port;
     bool use_dns_over_tls = false;
+    bool use_dns_over_https = false;
     bool enable_test_mode = false;
     bool validate_dnssec_locally = false;
     bool log_all_js_exceptions = false;
@@ -156,6 +164,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(window_width, "Set viewport width in pixels (default: 800) (currently only supported for headless mode)", "window-width", 0, "pixels");
     args_parser.add_option(window_height, "Set viewport height in pixels (default: 600) (currently only supported for headless mode)", "window-height", 0, "pixels");
+    args_parser.add_option(headless_view_count, "Number of pages to load at once when taking screenshots of several URLs in headless mode (default: number of CPUs)", "headless-views", 0, "count");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(new_window, "Force opening in a new window", "new-window", 'n');
     args_parser.add_option(force_new_process, "Force creation of a new browser process", "force-new-process");
@@ -168,6 +177,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(enable_test_mode, "Enable test mode", "test-mode");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
+    args_parser.add_option(web_content_process_pool_size, "Number of spare WebContent processes to keep ready for new tabs (default: 1)", "web-content-pool-size", 0, "count");
+    args_parser.add_option(memory_budget_mib, "Memory the browser may use before it starts freeing caches and discarding background tabs (default: physical memory)", "memory-budget", 0, "MiB");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(disable_http_memory_cache, "Disable HTTP memory cache", "disable-http-memory-cache");
     args_parser.add_option(disable_http_disk_cache, "Disable HTTP disk cache", "disable-http-disk-cache");
@@ -179,8 +190,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
-    args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
+    args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53, 853 if --dot, or 443 if --doh)");
     args_parser.add_option(use_dns_over_tls, "Use DNS over TLS", "dot");
+    args_parser.add_option(use_dns_over_https, "Use DNS over HTTPS", "doh");
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
     args_parser.add_option(resource_substitution_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
@@ -220,7 +232,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         disable_sql_database = true;
 
     if (!dns_server_port.has_value())
-        dns_server_port = use_dns_over_tls ? 853 : 53;
+        dns_server_port = use_dns_over_https ? 443 : (use_dns_over_tls ? 853 : 53);
 
     Optional<ProcessType> debug_process_type;
     Optional<ProcessType> profile_process_type;
@@ -245,19 +257,29 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
-        .dns_settings = (dns_server_address.has_value()
-                ? Optional<DNSSettings> { use_dns_over_tls
-                          ? DNSSettings(DNSOverTLS(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally))
-                          : DNSSettings(DNSOverUDP(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally)) }
-                : OptionalNone()),
+        .dns_settings = [&] -> Optional<DNSSettings> {
+            if (!dns_server_address.has_value())
+                return {};
+            if (use_dns_over_https)
+                return DNSSettings(DNSOverHTTPS(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally));
+            if (use_dns_over_tls)
+                return DNSSettings(DNSOverTLS(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally));
+            return DNSSettings(DNSOverUDP(dns_server_address.release_value(), *dns_server_port, validate_dnssec_locally));
+        }(),
         .devtools_port = devtools_port,
         .enable_content_filter = disable_content_filter ? EnableContentFilter::No : EnableContentFilter::Yes,
     };
 
     if (window_width.has_value())
         m_browser_options.window_width = *window_width;
+    if (web_content_process_pool_size.has_value())
+        m_browser_options.web_content_process_pool_size = *web_content_process_pool_size;
+    if (memory_budget_mib.has_value())
+        m_browser_options.memory_budget_bytes = *memory_budget_mib * MiB;
     if (window_height.has_value())
         m_browser_options.window_height = *window_height;
+    if (headless_view_count.has_value())
+        m_browser_options.headless_view_count = max(*headless_view_count, 1uz);
 
     if (webdriver_content_ipc_path.has_value())
         m_browser_options.webdriver_content_ipc_path = *webdriver_content_ipc_path;
@@ -274,6 +296,10 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .resource_substitution_map_path = resource_substitution_map_path.has_value() ? Optional<ByteString> { *resource_substitution_map_path } : OptionalNone {},
     };
 
+    // NB: The bodies of the Cache API's responses are only persisted along with the storage jar that references them.
+    if (!disable_sql_database)
+        m_request_server_options.cache_storage_path = ByteString::formatted("{}/Ladybird/CacheStorage", Core::StandardPaths::user_data_directory());
+
     m_web_content_options = {
         .command_line = MUST(String::join(' ', m_arguments.strings)),
         .executable_path = MUST(String::from_byte_string(MUST(Core::System::current_executable_path()))),
@@ -319,19 +345,19 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
 
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
-        launch_spare_web_content_process();
+    if (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
+        launch_spare_web_content_processes();
 
         web_content_client->assign_view({}, view);
         return web_content_client;
     }
 
-    launch_spare_web_content_process();
+    launch_spare_web_content_processes();
     return create_web_content_client(view);
 }
 
-void Application::launch_spare_web_content_process()
+void Application::launch_spare_web_content_processes()
 {
     // Disable spare processes when debugging WebContent. Otherwise, it breaks running `gdb attach -p $(pidof WebContent)`.
     if (browser_options().debug_helper_process == ProcessType::WebContent)
@@ -340,12 +366,21 @@ void Application::launch_spare_web_content_process()
     if (browser_options().profile_helper_process == ProcessType::WebContent)
         return;
 
-    if (m_has_queued_task_to_launch_spare_web_content_process)
+    if (m_spare_processes_released)
+        return;
+    if (m_has_queued_task_to_launch_spare_web_content_processes)
         return;
-    m_has_queued_task_to_launch_spare_web_content_process = true;
+    m_has_queued_task_to_launch_spare_web_content_processes = true;
 
+    // NB: Spare processes are launched one per event loop iteration, so that refilling a large pool does not delay
+    //     input handling or painting in the UI process.
     Core::deferred_invoke([this]() {
-        m_has_queued_task_to_launch_spare_web_content_process = false;
+        m_has_queued_task_to_launch_spare_web_content_processes = false;
+
+        if (m_spare_processes_released)
+            return;
+        if (m_spare_web_content_processes.size() >= browser_options().web_content_process_pool_size)
+            return;
 
         auto web_content_client = create_web_content_client({});
         if (web_content_client.is_error()) {
@@ -353,10 +388,77 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
+        auto pid = web_content_client.value()->pid();
+        m_spare_web_content_processes.append(web_content_client.release_value());
 
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(pid); process.has_value())
             process->set_title("(spare)"_utf16);
+
+        launch_spare_web_content_processes();
+    });
+}
+
+void Application::release_spare_processes()
+{
+    m_spare_processes_released = true;
+
+    // Dropping the last reference to a spare client closes its IPC connection, which makes the process exit.
+    m_spare_web_content_processes.clear();
+    m_spare_web_worker_processes.clear();
+}
+
+void Application::allow_spare_processes()
+{
+    if (!m_spare_processes_released)
+        return;
+    m_spare_processes_released = false;
+
+    launch_spare_web_content_processes();
+}
+
+// NB: Pages tend to start several dedicated workers at once, e.g. one for each core, so we keep a few spare processes
+//     around once a page has started its first one.
+static constexpr size_t spare_web_worker_process_count = 4;
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    // NB: Shared and service workers are comparatively rare, so only dedicated workers have spare processes.
+    if (type != Web::Bindings::AgentType::DedicatedWorker)
+        return WebView::launch_web_worker_process(type);
+
+    launch_spare_web_worker_processes();
+
+    if (!m_spare_web_worker_processes.is_empty())
+        return m_spare_web_worker_processes.take_first();
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_web_worker_processes()
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as for WebContent.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_spare_processes_released)
+        return;
+    if (m_has_queued_task_to_launch_spare_web_worker_processes)
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_processes = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_web_worker_processes = false;
+
+        while (m_spare_web_worker_processes.size() < spare_web_worker_process_count) {
+            auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+            if (web_worker_client.is_error()) {
+                dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+                return;
+            }
+
+            m_spare_web_worker_processes.append(web_worker_client.release_value());
+        }
     });
 }
 
@@ -369,6 +471,16 @@ ErrorOr<void> Application::launch_services()
         process_did_exit(move(process));
     };
 
+    // Tests should behave the same regardless of how much memory the machine running them has.
+    if (m_web_content_options.is_test_mode == IsTestMode::No) {
+        auto memory_budget = m_browser_options.memory_budget_bytes.value_or(Core::System::physical_memory_bytes());
+
+        m_memory_pressure_monitor = MemoryPressureMonitor::create(*m_process_manager, memory_budget);
+        m_memory_pressure_monitor->on_level_change = [this](MemoryPressureLevel level) {
+            memory_pressure_level_changed(level);
+        };
+    }
+
     if (m_browser_options.disable_sql_database == DisableSQLDatabase::No) {
         // FIXME: Move this to a generic "Ladybird data directory" helper.
         auto database_path = ByteString::formatted("{}/Ladybird", Core::StandardPaths::user_data_directory());
@@ -406,6 +518,31 @@ ErrorOr<void> Application::launch_services()
     return {};
 }
 
+void Application::memory_pressure_level_changed(MemoryPressureLevel level)
+{
+    if (level == MemoryPressureLevel::None) {
+        allow_spare_processes();
+        return;
+    }
+
+    release_spare_processes();
+
+    if (level == MemoryPressureLevel::Critical) {
+        ViewImplementation::for_each_view([](ViewImplementation& view) {
+            view.discard();
+            return IterationDecision::Continue;
+        });
+    }
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        client.async_memory_pressure_changed(level);
+        return IterationDecision::Continue;
+    });
+
+    if (m_image_decoder_client)
+        m_image_decoder_client->async_purge_decoded_image_cache();
+}
+
 ErrorOr<void> Application::launch_request_server()
 {
     m_request_server_client = TRY(launch_request_server_process());
@@ -484,28 +621,76 @@ ErrorOr<void> Application::launch_devtools_server()
     return {};
 }
 
-static NonnullRefPtr<Core::Timer> load_page_for_screenshot_and_exit(Core::EventLoop& event_loop, HeadlessWebView& view, URL::URL const& url, int screenshot_timeout)
+struct ScreenshotJobs {
+    Vector<URL::URL> const& urls;
+    size_t next_url_index { 0 };
+    size_t remaining_screenshots { 0 };
+    size_t failed_screenshots { 0 };
+    MonotonicTime start_time { MonotonicTime::now() };
+};
+
+static void take_next_screenshot(Core::EventLoop& event_loop, HeadlessWebView& view, Core::Timer& timer, ScreenshotJobs& jobs)
 {
-    outln("Taking screenshot after {} seconds", screenshot_timeout);
+    if (jobs.next_url_index == jobs.urls.size())
+        return;
+
+    auto const& url = jobs.urls[jobs.next_url_index++];
+
+    auto did_finish_screenshot = [&event_loop, &view, &timer, &jobs]() {
+        if (--jobs.remaining_screenshots != 0) {
+            // NB: This may run from within the timer's callback, which we must not replace while it is running.
+            Core::deferred_invoke([&event_loop, &view, &timer, &jobs]() {
+                take_next_screenshot(event_loop, view, timer, jobs);
+            });
+            return;
+        }
 
-    auto timer = Core::Timer::create_single_shot(
-        screenshot_timeout * 1000,
-        [&]() {
-            view.take_screenshot(ViewImplementation::ScreenshotType::Full)
-                ->when_resolved([&event_loop](auto const& path) {
+        if (jobs.urls.size() > 1) {
+            auto elapsed_seconds = (MonotonicTime::now() - jobs.start_time).to_milliseconds() / 1000.0;
+            auto screenshot_count = jobs.urls.size() - jobs.failed_screenshots;
+            outln("Took {} screenshots ({} failed) in {:.2}s, {:.2} per second", screenshot_count, jobs.failed_screenshots, elapsed_seconds, screenshot_count / max(elapsed_seconds, 0.001));
+        }
+        event_loop.quit(0);
+    };
+
+    timer.on_timeout = [&view, &jobs, url, did_finish_screenshot]() {
+        view.take_screenshot(ViewImplementation::ScreenshotType::Full)
+            ->when_resolved([&jobs, url, did_finish_screenshot](auto const& path) {
+                if (jobs.urls.size() > 1)
+                    outln("Saved screenshot of {} to: {}", url, path);
+                else
                     outln("Saved screenshot to: {}", path);
-                    event_loop.quit(0);
-                })
-                .when_rejected([&event_loop](auto const& error) {
-                    warnln("Unable to take screenshot: {}", error);
-                    event_loop.quit(0);
-                });
-        });
+                did_finish_screenshot();
+            })
+            .when_rejected([&jobs, url, did_finish_screenshot](auto const& error) {
+                warnln("Unable to take screenshot of {}: {}", url, error);
+                ++jobs.failed_screenshots;
+                did_finish_screenshot();
+            });
+    };
 
     view.load(url);
-    timer->start();
+    timer.start();
+}
+
+// Takes a screenshot of each URL, loading up to one page per view at a time. Each view (and its WebContent process) is
+// reused for the next URL once it is done with its current one.
+static Vector<NonnullRefPtr<Core::Timer>> load_pages_for_screenshots_and_exit(Core::EventLoop& event_loop, ReadonlySpan<NonnullOwnPtr<HeadlessWebView>> views, ScreenshotJobs& jobs, int screenshot_timeout)
+{
+    outln("Taking screenshot after {} seconds", screenshot_timeout);
 
-    return timer;
+    jobs.remaining_screenshots = jobs.urls.size();
+
+    Vector<NonnullRefPtr<Core::Timer>> timers;
+    timers.ensure_capacity(views.size());
+
+    for (auto const& view : views) {
+        auto timer = Core::Timer::create_single_shot(screenshot_timeout * 1000, nullptr);
+        take_next_screenshot(event_loop, *view, *timer, jobs);
+        timers.unchecked_append(move(timer));
+    }
+
+    return timers;
 }
 
 static void load_page_for_info_and_exit(Core::EventLoop& event_loop, HeadlessWebView& view, URL::URL const& url, WebView::PageInfoType type)
@@ -535,22 +720,37 @@ static void load_page_and_exit_on_close(Core::EventLoop& event_loop, HeadlessWeb
 ErrorOr<int> Application::execute()
 {
     OwnPtr<HeadlessWebView> view;
-    RefPtr<Core::Timer> screenshot_timer;
+    Vector<NonnullOwnPtr<HeadlessWebView>> screenshot_views;
+    Vector<NonnullRefPtr<Core::Timer>> screenshot_timers;
+    ScreenshotJobs screenshot_jobs { .urls = m_browser_options.urls };
 
     if (m_browser_options.headless_mode.has_value()) {
         auto theme_path = LexicalPath::join(WebView::s_ladybird_resource_root, "themes"sv, "Default.ini"sv);
         auto theme = TRY(Gfx::load_system_theme(theme_path.string()));
+        Web::DevicePixelSize window_size { m_browser_options.window_width, m_browser_options.window_height };
+
+        if (m_browser_options.headless_mode == HeadlessMode::Screenshot && !m_browser_options.webdriver_content_ipc_path.has_value()) {
+            if (m_browser_options.urls.is_empty())
+                return Error::from_string_literal("Headless screenshot mode requires at least one URL");
 
-        view = HeadlessWebView::create(move(theme), { m_browser_options.window_width, m_browser_options.window_height });
+            auto view_count = min(m_browser_options.headless_view_count.value_or(Core::System::hardware_concurrency()), m_browser_options.urls.size());
+            screenshot_views.ensure_capacity(view_count);
+            for (size_t i = 0; i < view_count; ++i)
+                screenshot_views.unchecked_append(HeadlessWebView::create(theme, window_size));
+
+            screenshot_timers = load_pages_for_screenshots_and_exit(*m_event_loop, screenshot_views, screenshot_jobs, 1);
+            return m_event_loop->exec();
+        }
+
+        view = HeadlessWebView::create(move(theme), window_size);
 
         if (!m_browser_options.webdriver_content_ipc_path.has_value()) {
             if (m_browser_options.urls.size() != 1)
-                return Error::from_string_literal("Headless mode currently only supports exactly one URL");
+                return Error::from_string_literal("Headless mode currently only supports exactly one URL, except for screenshots");
 
             switch (*m_browser_options.headless_mode) {
             case HeadlessMode::Screenshot:
-                screenshot_timer = load_page_for_screenshot_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), 1);
-                break;
+                VERIFY_NOT_REACHED();
             case HeadlessMode::LayoutTree:
                 load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::LayoutTree | WebView::PageInfoType::PaintTree);
                 break;
@@ -637,7 +837,19 @@ ErrorOr<LexicalPath> Application::path_for_downloaded_file(StringView file) cons
             return Error::from_errno(ENOENT);
         }
 
-        return LexicalPath::join(downloads_directory, file);
+        auto path = LexicalPath::join(downloads_directory, file);
+
+        // NB: Nobody can be asked where to save the file in headless mode, so we must not overwrite an existing one
+        //     either. This happens e.g. when several screenshots are taken in the same second.
+        LexicalPath file_path { file };
+        for (size_t suffix = 1; FileSystem::exists(path.string()); ++suffix) {
+            auto deduplicated_file = file_path.extension().is_empty()
+                ? ByteString::formatted("{}-{}", file_path.title(), suffix)
+                : ByteString::formatted("{}-{}.{}", file_path.title(), suffix, file_path.extension());
+            path = LexicalPath::join(downloads_directory, deduplicated_file);
+        }
+
+        return path;
     }
 
     auto download_path = ask_user_for_download_path(file);
@@ -721,6 +933,7 @@ void Application::clear_browsing_data(ClearBrowsingDataOptions const& options)
     if (options.delete_site_data == ClearBrowsingDataOptions::Delete::Yes) {
         m_cookie_jar->expire_cookies_accessed_since(options.since);
         m_storage_jar->remove_items_accessed_since(options.since);
+        m_request_server_client->async_remove_cache_storage_bodies_stored_since(options.since);
     }
 }
 
@@ -893,6 +1106,15 @@ void Application::initialize_actions()
             }
         }
     }));
+    m_debug_menu->add_action(Action::create("Dump GC Heap Statistics"sv, ActionID::DumpGCHeapStatistics, [this]() {
+        if (auto view = active_web_view(); view.has_value()) {
+            auto heap_statistics_path = view->dump_gc_heap_statistics();
+            if (heap_statistics_path.is_error())
+                warnln("\033[31;1mFailed to dump GC heap statistics: {}\033[0m", heap_statistics_path.error());
+            else
+                warnln("\033[33;1mDumped GC heap statistics into {}\033[0m", heap_statistics_path.value());
+        }
+    }));
     m_debug_menu->add_separator();
 
     m_show_line_box_borders_action = Action::create_checkable("Show Line Box Borders"sv, ActionID::ShowLineBoxBorders, check(m_show_line_box_borders_action, "set-line-box-borders"sv));
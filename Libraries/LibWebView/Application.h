@@ -19,6 +19,7 @@
 #include <LibMain/Main.h>
 #include <LibRequests/Forward.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Bindings/AgentType.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PreferredContrast.h>
 #include <LibWeb/CSS/PreferredMotion.h>
@@ -26,6 +27,7 @@
 #include <LibWeb/HTML/ActivateTab.h>
 #include <LibWebView/FileDownloader.h>
 #include <LibWebView/Forward.h>
+#include <LibWebView/MemoryPressureMonitor.h>
 #include <LibWebView/Options.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
@@ -61,6 +63,11 @@ public:
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
+
+    // Drops all spare helper processes and stops replacing them until the pool is allowed to refill again.
+    void release_spare_processes();
+    void allow_spare_processes();
 
     virtual Optional<ViewImplementation&> active_web_view() const { return {}; }
     virtual Optional<ViewImplementation&> open_blank_new_tab(Web::HTML::ActivateTab) const { return {}; }
@@ -156,7 +163,9 @@ protected:
 
 private:
     ErrorOr<void> launch_services();
-    void launch_spare_web_content_process();
+    void launch_spare_web_content_processes();
+    void launch_spare_web_worker_processes();
+    void memory_pressure_level_changed(MemoryPressureLevel);
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -213,14 +222,19 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
-    bool m_has_queued_task_to_launch_spare_web_content_process { false };
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
+    bool m_has_queued_task_to_launch_spare_web_content_processes { false };
+    bool m_spare_processes_released { false };
+
+    Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>> m_spare_web_worker_processes;
+    bool m_has_queued_task_to_launch_spare_web_worker_processes { false };
 
     RefPtr<Database::Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
+    OwnPtr<MemoryPressureMonitor> m_memory_pressure_monitor;
 
     OwnPtr<Core::EventLoop> m_event_loop;
     OwnPtr<ProcessManager> m_process_manager;
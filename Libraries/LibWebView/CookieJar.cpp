@@ -50,6 +50,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database::Database& database
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new CookieJar { PersistedStorage { database, statements } });
 }
@@ -72,11 +74,20 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto& database = m_persisted_storage->database;
+            auto const& statements = m_persisted_storage->statements;
+
+            // OPTIMIZATION: Each SQLite write is its own transaction unless we start one ourselves, so we write all
+            //               cookies changed since the last synchronization in a single transaction.
+            database.execute_statement(statements.begin_transaction, {});
+
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
 
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            database.execute_statement(statements.expire_cookie, {}, now);
+
+            database.execute_statement(statements.commit_transaction, {});
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -507,7 +518,9 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url,
     // 3. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    // OPTIMIZATION: A cookie can only match if the retrieval host is its domain or a subdomain of it, so we only look at
+    //               the cookies stored for the host and its parent domains, rather than at every cookie in the store.
+    m_transient_storage.for_each_cookie_for_host(*retrieval_host_canonical, [&](Web::Cookie::Cookie& cookie) {
         if (!Web::Cookie::cookie_matches_url(cookie, url, *retrieval_host_canonical, source))
             return;
 
@@ -551,9 +564,20 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(URL::URL const& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+    rebuild_domain_index();
+
+    m_earliest_expiry_time = UnixDateTime::earliest();
     purge_expired_cookies();
 }
 
+void CookieJar::TransientStorage::rebuild_domain_index()
+{
+    m_cookie_keys_by_domain.clear();
+
+    for (auto const& [key, cookie] : m_cookies)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+}
+
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
     auto now = UnixDateTime::now();
@@ -573,7 +597,11 @@ void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::
         send_cookie_changed_notifications({ { CookieEntry { {}, cookie } } }, cookie_value_changed);
     }
 
-    m_cookies.set(key, cookie);
+    if (cookie.expiry_time < m_earliest_expiry_time)
+        m_earliest_expiry_time = cookie.expiry_time;
+
+    if (m_cookies.set(key, cookie) == AK::HashSetResult::InsertedNewEntry)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
     m_dirty_cookies.set(move(key), move(cookie));
 }
 
@@ -592,9 +620,30 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
+    // OPTIMIZATION: This runs on every cookie access, so avoid looking at every cookie when none of them has expired yet.
+    if (!offset.has_value() && now <= m_earliest_expiry_time)
+        return now;
+
     auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
+    auto removed_entries = m_cookies.take_all_matching(is_expired);
+
+    for (auto const& entry : removed_entries) {
+        auto keys = m_cookie_keys_by_domain.find(entry.key.domain);
+        if (keys == m_cookie_keys_by_domain.end())
+            continue;
+
+        keys->value.remove(entry.key);
+        if (keys->value.is_empty())
+            m_cookie_keys_by_domain.remove(keys);
+    }
+
+    m_earliest_expiry_time = UnixDateTime::latest();
+    for (auto const& it : m_cookies) {
+        if (it.value.expiry_time < m_earliest_expiry_time)
+            m_earliest_expiry_time = it.value.expiry_time;
+    }
 
-    if (auto removed_entries = m_cookies.take_all_matching(is_expired); !removed_entries.is_empty())
+    if (!removed_entries.is_empty())
         send_cookie_changed_notifications(removed_entries);
 
     return now;
@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -54,6 +55,8 @@ private:
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class WEBVIEW_API TransientStorage {
@@ -89,12 +92,35 @@ private:
             }
         }
 
+        // Invokes the callback for every cookie whose domain is the given host or one of its parent domains. These are
+        // the only cookies that may match a URL with that host.
+        template<typename Callback>
+        void for_each_cookie_for_host(StringView host, Callback callback)
+        {
+            for (auto domain = host;;) {
+                if (auto keys = m_cookie_keys_by_domain.get(domain); keys.has_value()) {
+                    for (auto const& key : *keys)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto separator = domain.find('.');
+                if (!separator.has_value())
+                    break;
+                domain = domain.substring_view(*separator + 1);
+            }
+        }
+
     private:
         using CookieEntry = decltype(declval<Cookies>().take_all_matching(nullptr))::ValueType;
         static void send_cookie_changed_notifications(ReadonlySpan<CookieEntry>, bool inform_web_view_about_changed_domains = true);
 
+        void rebuild_domain_index();
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
+        UnixDateTime m_earliest_expiry_time { UnixDateTime::latest() };
     };
 
     struct WEBVIEW_API PersistedStorage {
@@ -16,6 +16,7 @@ class Action;
 class Application;
 class Autocomplete;
 class CookieJar;
+class MemoryPressureMonitor;
 class Menu;
 class OutOfProcessWebView;
 class ProcessManager;
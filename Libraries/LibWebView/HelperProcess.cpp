@@ -245,6 +245,9 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
     if (request_server_options.resource_substitution_map_path.has_value())
         arguments.append(ByteString::formatted("--resource-map={}", *request_server_options.resource_substitution_map_path));
 
+    if (request_server_options.cache_storage_path.has_value())
+        arguments.append(ByteString::formatted("--cache-storage-path={}", *request_server_options.cache_storage_path));
+
     auto client = TRY(launch_server_process<Requests::RequestClient>("RequestServer"sv, move(arguments)));
 
     WebView::Application::settings().dns_settings().visit(
@@ -256,6 +259,10 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
         [&](WebView::DNSOverUDP const& dns_over_udp) {
             dbgln("Setting DNS server to {}:{} ({} local dnssec)", dns_over_udp.server_address, dns_over_udp.port, dns_over_udp.validate_dnssec_locally ? "with" : "without");
             client->async_set_dns_server(dns_over_udp.server_address, dns_over_udp.port, false, dns_over_udp.validate_dnssec_locally);
+        },
+        [&](WebView::DNSOverHTTPS const& dns_over_https) {
+            dbgln("Setting DNS server to {}:{} with HTTPS ({} local dnssec)", dns_over_https.server_address, dns_over_https.port, dns_over_https.validate_dnssec_locally ? "with" : "without");
+            client->async_set_dns_over_https_server(dns_over_https.server_address, dns_over_https.port, dns_over_https.validate_dnssec_locally);
         });
 
     return client;
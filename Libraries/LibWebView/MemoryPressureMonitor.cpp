@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibCore/Timer.h>
+#include <LibWebView/MemoryPressureMonitor.h>
+#include <LibWebView/ProcessManager.h>
+
+namespace WebView {
+
+static constexpr int memory_usage_check_interval_ms = 5000;
+
+// Fractions of the memory budget, in percent.
+static constexpr u64 moderate_pressure_threshold = 70;
+static constexpr u64 critical_pressure_threshold = 90;
+static constexpr u64 pressure_hysteresis = 10;
+
+NonnullOwnPtr<MemoryPressureMonitor> MemoryPressureMonitor::create(ProcessManager& process_manager, u64 memory_budget_bytes)
+{
+    return adopt_own(*new MemoryPressureMonitor(process_manager, memory_budget_bytes));
+}
+
+MemoryPressureMonitor::MemoryPressureMonitor(ProcessManager& process_manager, u64 memory_budget_bytes)
+    : m_process_manager(process_manager)
+    , m_memory_budget_bytes(memory_budget_bytes)
+{
+    m_timer = Core::Timer::create_repeating(memory_usage_check_interval_ms, [this]() {
+        check_memory_usage();
+    });
+    m_timer->start();
+}
+
+MemoryPressureMonitor::~MemoryPressureMonitor()
+{
+    m_timer->stop();
+}
+
+MemoryPressureLevel MemoryPressureMonitor::level_for_usage(u64 memory_usage_bytes) const
+{
+    auto percent_of_budget = memory_usage_bytes * 100 / m_memory_budget_bytes;
+
+    auto exceeds = [&](u64 threshold, MemoryPressureLevel threshold_level) {
+        // Only require dropping below the threshold by the hysteresis margin if we are at or above its level already.
+        if (m_level >= threshold_level)
+            return percent_of_budget + pressure_hysteresis >= threshold;
+        return percent_of_budget >= threshold;
+    };
+
+    if (exceeds(critical_pressure_threshold, MemoryPressureLevel::Critical))
+        return MemoryPressureLevel::Critical;
+    if (exceeds(moderate_pressure_threshold, MemoryPressureLevel::Moderate))
+        return MemoryPressureLevel::Moderate;
+    return MemoryPressureLevel::None;
+}
+
+void MemoryPressureMonitor::check_memory_usage()
+{
+    if (m_memory_budget_bytes == 0)
+        return;
+
+    auto level = level_for_usage(m_process_manager.total_memory_usage_bytes());
+    if (level == m_level)
+        return;
+
+    dbgln_if(MEMORY_PRESSURE_DEBUG, "Memory pressure level changed from {} to {}", to_underlying(m_level), to_underlying(level));
+    m_level = level;
+
+    if (on_level_change)
+        on_level_change(level);
+}
+
+}
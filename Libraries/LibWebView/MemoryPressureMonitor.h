@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/Types.h>
+#include <LibCore/Forward.h>
+#include <LibWebView/Export.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+enum class MemoryPressureLevel : u8 {
+    None,
+    Moderate,
+    Critical,
+};
+
+// Periodically sums up the resident memory of the browser and all of its helper processes, and reports whenever that
+// crosses a fraction of the memory budget. Levels are only lowered again once usage has dropped well below the
+// threshold that raised them, so that we don't flap between levels while processes give memory back.
+class WEBVIEW_API MemoryPressureMonitor {
+    AK_MAKE_NONCOPYABLE(MemoryPressureMonitor);
+
+public:
+    static NonnullOwnPtr<MemoryPressureMonitor> create(ProcessManager&, u64 memory_budget_bytes);
+    ~MemoryPressureMonitor();
+
+    MemoryPressureLevel level() const { return m_level; }
+    u64 memory_budget_bytes() const { return m_memory_budget_bytes; }
+
+    Function<void(MemoryPressureLevel)> on_level_change;
+
+private:
+    MemoryPressureMonitor(ProcessManager&, u64 memory_budget_bytes);
+
+    void check_memory_usage();
+    MemoryPressureLevel level_for_usage(u64 memory_usage_bytes) const;
+
+    ProcessManager& m_process_manager;
+    u64 m_memory_budget_bytes { 0 };
+    MemoryPressureLevel m_level { MemoryPressureLevel::None };
+
+    RefPtr<Core::Timer> m_timer;
+};
+
+}
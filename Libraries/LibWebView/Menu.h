@@ -80,6 +80,7 @@ enum class ActionID {
     DumpCookies,
     DumpLocalStorage,
     DumpGCGraph,
+    DumpGCHeapStatistics,
     ShowLineBoxBorders,
     CollectGarbage,
     SpoofUserAgent,
@@ -64,10 +64,16 @@ struct DNSOverUDP {
     u16 port;
     bool validate_dnssec_locally;
 };
+struct DNSOverHTTPS {
+    ByteString server_address;
+    u16 port;
+    bool validate_dnssec_locally;
+};
 
-using DNSSettings = Variant<SystemDNS, DNSOverTLS, DNSOverUDP>;
+using DNSSettings = Variant<SystemDNS, DNSOverTLS, DNSOverUDP, DNSOverHTTPS>;
 
 constexpr inline u16 default_devtools_port = 6000;
+constexpr inline size_t default_web_content_process_pool_size = 1;
 
 enum class EnableContentFilter {
     No,
@@ -80,6 +86,7 @@ struct BrowserOptions {
     Optional<HeadlessMode> headless_mode;
     int window_width { 800 };
     int window_height { 600 };
+    Optional<size_t> headless_view_count;
     NewWindow new_window { NewWindow::No };
     ForceNewProcess force_new_process { ForceNewProcess::No };
     AllowPopups allow_popups { AllowPopups::No };
@@ -90,6 +97,8 @@ struct BrowserOptions {
     Optional<ByteString> webdriver_content_ipc_path {};
     Optional<DNSSettings> dns_settings {};
     Optional<u16> devtools_port;
+    size_t web_content_process_pool_size { default_web_content_process_pool_size };
+    Optional<u64> memory_budget_bytes;
     EnableContentFilter enable_content_filter { EnableContentFilter::Yes };
 };
 
@@ -104,6 +113,7 @@ struct RequestServerOptions {
     Vector<ByteString> certificates;
     HTTPDiskCacheMode http_disk_cache_mode { HTTPDiskCacheMode::Disabled };
     Optional<ByteString> resource_substitution_map_path;
+    Optional<ByteString> cache_storage_path;
 };
 
 enum class IsTestMode {
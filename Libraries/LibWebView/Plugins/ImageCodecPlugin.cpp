@@ -31,6 +31,37 @@ void ImageCodecPlugin::set_client(NonnullRefPtr<ImageDecoderClient::Client> clie
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
+class StreamedAnimation final : public Web::Platform::StreamedAnimation {
+public:
+    StreamedAnimation(NonnullRefPtr<ImageDecoderClient::Client> client, i64 image_id)
+        : m_client(move(client))
+        , m_image_id(image_id)
+    {
+    }
+
+    virtual ~StreamedAnimation() override
+    {
+        m_client->stop_streaming_animation(m_image_id);
+    }
+
+    virtual void request_frames(size_t first_frame_index, size_t frame_count) override
+    {
+        m_client->request_animation_frames(m_image_id, first_frame_index, frame_count, [this](u32 first_frame_index, ErrorOr<Vector<RefPtr<Gfx::Bitmap>>> bitmaps) {
+            if (bitmaps.is_error()) {
+                if (on_error)
+                    on_error(bitmaps.release_error());
+                return;
+            }
+            if (on_frames_decoded)
+                on_frames_decoded(first_frame_index, bitmaps.release_value());
+        });
+    }
+
+private:
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    i64 m_image_id { 0 };
+};
+
 NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
@@ -46,7 +77,7 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
 
     auto image_decoder_promise = m_client->decode_image(
         bytes,
-        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+        [promise, client = NonnullRefPtr { *m_client }](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
             // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
             Web::Platform::DecodedImage decoded_image;
             decoded_image.is_animated = result.is_animated;
@@ -54,6 +85,12 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
             for (auto& frame : result.frames) {
                 decoded_image.frames.empend(move(frame.bitmap), frame.duration);
             }
+            if (result.streamed_image_id.has_value()) {
+                // NB: The frames that haven't been sent yet are left without a bitmap.
+                for (size_t i = decoded_image.frames.size(); i < result.streamed_frame_durations.size(); ++i)
+                    decoded_image.frames.empend(nullptr, result.streamed_frame_durations[i]);
+                decoded_image.streamed_animation = adopt_ref(*new StreamedAnimation(client, *result.streamed_image_id));
+            }
             decoded_image.color_space = move(result.color_space);
             promise->resolve(move(decoded_image));
             return {};
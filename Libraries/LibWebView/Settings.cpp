@@ -217,7 +217,7 @@ JsonValue Settings::serialize_json() const
 
     settings.set(global_privacy_control_key, m_global_privacy_control == GlobalPrivacyControl::Yes);
 
-    // dnsSettings :: { mode: "system" } | { mode: "custom", server: string, port: u16, type: "udp" | "tls", forciblyEnabled: bool, dnssec: bool }
+    // dnsSettings :: { mode: "system" } | { mode: "custom", server: string, port: u16, type: "udp" | "tls" | "https", forciblyEnabled: bool, dnssec: bool }
     JsonObject dns_settings;
     m_dns_settings.visit(
         [&](SystemDNS) {
@@ -238,6 +238,14 @@ JsonValue Settings::serialize_json() const
             dns_settings.set("type"sv, "udp"sv);
             dns_settings.set("dnssec"sv, dns.validate_dnssec_locally);
             dns_settings.set("forciblyEnabled"sv, m_dns_override_by_command_line);
+        },
+        [&](DNSOverHTTPS const& doh) {
+            dns_settings.set("mode"sv, "custom"sv);
+            dns_settings.set("server"sv, doh.server_address.view());
+            dns_settings.set("port"sv, doh.port);
+            dns_settings.set("type"sv, "https"sv);
+            dns_settings.set("dnssec"sv, doh.validate_dnssec_locally);
+            dns_settings.set("forciblyEnabled"sv, m_dns_override_by_command_line);
         });
     settings.set(dns_settings_key, move(dns_settings));
 
@@ -469,6 +477,8 @@ DNSSettings Settings::parse_dns_settings(JsonValue const& dns_settings)
                     return DNSOverTLS { .server_address = server->to_byte_string(), .port = *port, .validate_dnssec_locally = validate_dnssec_locally.value_or(false) };
                 if (*type == "udp"sv)
                     return DNSOverUDP { .server_address = server->to_byte_string(), .port = *port, .validate_dnssec_locally = validate_dnssec_locally.value_or(false) };
+                if (*type == "https"sv)
+                    return DNSOverHTTPS { .server_address = server->to_byte_string(), .port = *port, .validate_dnssec_locally = validate_dnssec_locally.value_or(false) };
             }
         }
     }
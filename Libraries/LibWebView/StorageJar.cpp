@@ -6,6 +6,7 @@
 
 #include <AK/NonnullOwnPtr.h>
 #include <AK/StdLibExtras.h>
+#include <LibCore/Timer.h>
 #include <LibDatabase/Database.h>
 #include <LibWebView/StorageJar.h>
 
@@ -14,11 +15,28 @@ namespace WebView {
 // Quota size is specified in https://storage.spec.whatwg.org/#registered-storage-endpoints
 static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
 
+// NB: The specification does not recommend a quota for the Cache API, whose bottles hold entire responses. We still
+//     limit them, so that a single site cannot fill the user's disk.
+static constexpr size_t CACHES_QUOTA = 50 * MiB;
+
+static constexpr size_t quota_for_storage_endpoint(StorageEndpointType storage_endpoint)
+{
+    if (storage_endpoint == StorageEndpointType::Caches)
+        return CACHES_QUOTA;
+    return LOCAL_STORAGE_QUOTA;
+}
+
 // Increment this version when needing to alter the WebStorage schema.
 static constexpr u32 WEB_STORAGE_VERSION = 2u;
 
 static constexpr u32 WEB_STORAGE_METADATA_KEY = 12389u;
 
+// OPTIMIZATION: Each SQLite write is its own transaction, which is far more expensive than updating the in-memory
+//               bottle. Pages that call setItem() in a loop would otherwise wait on one transaction per call. We
+//               instead write pending changes in a single transaction shortly after they were made.
+static constexpr size_t MAX_PENDING_WRITES = 256uz;
+static constexpr int PENDING_WRITES_FLUSH_DELAY_MS = 1000;
+
 ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& database)
 {
     Statements statements {};
@@ -54,15 +72,15 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& databa
     if (storage_version != WEB_STORAGE_VERSION)
         TRY(upgrade_database(database, storage_version));
 
-    statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
+    statements.get_items = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.set_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage VALUES (?, ?, ?, ?, ?);"sv));
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.delete_items_accessed_since = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE last_access_time >= ?;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE WebStorage SET last_access_time = ? WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(bottle_key) + OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
     statements.estimate_storage_size_accessed_since = TRY(database.prepare_statement("SELECT SUM(OCTET_LENGTH(storage_key)) + SUM(OCTET_LENGTH(bottle_key)) + SUM(OCTET_LENGTH(bottle_value)) FROM WebStorage WHERE last_access_time >= ?;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
 }
@@ -77,7 +95,11 @@ StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
 {
 }
 
-StorageJar::~StorageJar() = default;
+StorageJar::~StorageJar()
+{
+    if (m_persisted_storage.has_value())
+        m_persisted_storage->flush_pending_writes();
+}
 
 ErrorOr<void> StorageJar::upgrade_database(Database::Database& database, u32 current_version)
 {
@@ -149,7 +171,7 @@ Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, St
     return m_transient_storage.get_keys(storage_endpoint, storage_key);
 }
 
-Requests::CacheSizes StorageJar::estimate_storage_size_accessed_since(UnixDateTime since) const
+Requests::CacheSizes StorageJar::estimate_storage_size_accessed_since(UnixDateTime since)
 {
     if (m_persisted_storage.has_value())
         return m_persisted_storage->estimate_storage_size_accessed_since(since);
@@ -180,7 +202,7 @@ StorageSetResult StorageJar::TransientStorage::set_item(StorageLocation const& k
     }
 
     auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA)
+    if (current_size + new_size > quota_for_storage_endpoint(key.storage_endpoint))
         return StorageOperationError::QuotaExceededError;
 
     m_storage_items.set(key, { value, UnixDateTime::now() });
@@ -238,103 +260,104 @@ Requests::CacheSizes StorageJar::TransientStorage::estimate_storage_size_accesse
     return sizes;
 }
 
-Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
+
+StorageJar::PersistedStorage::Bottle& StorageJar::PersistedStorage::ensure_bottle(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Optional<String> result;
+    return bottles[to_underlying(storage_endpoint)].ensure(storage_key, [&]() {
+        Bottle bottle;
 
-    database.execute_statement(
-        statements.get_item,
-        [&](auto statement_id) {
-            result = database.result_column<String>(statement_id, 0);
-        },
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        key.bottle_key);
-
-    if (result.has_value()) {
         database.execute_statement(
-            statements.update_last_access_time,
-            {},
-            UnixDateTime::now(),
-            to_underlying(key.storage_endpoint),
-            key.storage_key,
-            key.bottle_key);
-    }
+            statements.get_items,
+            [&](auto statement_id) {
+                auto bottle_key = database.result_column<String>(statement_id, 0);
+                auto bottle_value = database.result_column<String>(statement_id, 1);
+
+                bottle.size += bottle_key.bytes().size() + bottle_value.bytes().size();
+                bottle.items.set(move(bottle_key), move(bottle_value));
+            },
+            to_underlying(storage_endpoint),
+            storage_key);
+
+        return bottle;
+    });
+}
+
+Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
+{
+    auto& bottle = ensure_bottle(key.storage_endpoint, key.storage_key);
+
+    auto value = bottle.items.get(key.bottle_key).copy();
+    if (value.has_value())
+        enqueue_pending_write(key, PendingWriteType::UpdateLastAccessTime);
 
-    return result;
+    return value;
 }
 
 StorageSetResult StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
 {
-    auto old_value = get_item(key);
+    auto& bottle = ensure_bottle(key.storage_endpoint, key.storage_key);
+    auto old_value = bottle.items.get(key.bottle_key).copy();
 
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        key.bottle_key);
+    auto current_size = bottle.size;
+    if (old_value.has_value())
+        current_size -= key.bottle_key.bytes().size() + old_value->bytes().size();
 
     auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA)
+    if (current_size + new_size > quota_for_storage_endpoint(key.storage_endpoint))
         return StorageOperationError::QuotaExceededError;
 
-    database.execute_statement(
-        statements.set_item,
-        {},
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        key.bottle_key,
-        value,
-        UnixDateTime::now());
+    bottle.items.set(key.bottle_key, value);
+    bottle.size = current_size + new_size;
 
+    enqueue_pending_write(key, PendingWriteType::SetItem);
     return old_value;
 }
 
 void StorageJar::PersistedStorage::delete_item(StorageLocation const& key)
 {
-    database.execute_statement(
-        statements.delete_item,
-        {},
-        to_underlying(key.storage_endpoint),
-        key.storage_key,
-        key.bottle_key);
+    auto& bottle = ensure_bottle(key.storage_endpoint, key.storage_key);
+
+    auto value = bottle.items.take(key.bottle_key);
+    if (!value.has_value())
+        return;
+
+    bottle.size -= key.bottle_key.bytes().size() + value->bytes().size();
+    enqueue_pending_write(key, PendingWriteType::DeleteItem);
 }
 
 void StorageJar::PersistedStorage::delete_items_accessed_since(UnixDateTime since)
 {
+    flush_pending_writes();
     database.execute_statement(statements.delete_items_accessed_since, {}, since);
+
+    // Last access times are only tracked in the database, so we don't know which cached items were removed.
+    for (auto& bottles_for_endpoint : bottles)
+        bottles_for_endpoint.clear();
 }
 
 void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
 {
+    flush_pending_writes();
+
     database.execute_statement(
         statements.clear,
         {},
         to_underlying(storage_endpoint),
         storage_key);
+
+    bottles[to_underlying(storage_endpoint)].remove(storage_key);
 }
 
 Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    Vector<String> keys;
-
-    database.execute_statement(
-        statements.get_keys,
-        [&](auto statement_id) {
-            keys.append(database.result_column<String>(statement_id, 0));
-        },
-        to_underlying(storage_endpoint),
-        storage_key);
-
-    return keys;
+    auto& bottle = ensure_bottle(storage_endpoint, storage_key);
+    return bottle.items.keys();
 }
 
-Requests::CacheSizes StorageJar::PersistedStorage::estimate_storage_size_accessed_since(UnixDateTime since) const
+Requests::CacheSizes StorageJar::PersistedStorage::estimate_storage_size_accessed_since(UnixDateTime since)
 {
+    flush_pending_writes();
+
     Requests::CacheSizes sizes;
 
     database.execute_statement(
@@ -350,4 +373,78 @@ Requests::CacheSizes StorageJar::PersistedStorage::estimate_storage_size_accesse
     return sizes;
 }
 
+void StorageJar::PersistedStorage::enqueue_pending_write(StorageLocation const& key, PendingWriteType type)
+{
+    auto now = UnixDateTime::now();
+
+    // Only the most recent write to each item matters. Accessing an item that is about to be written just updates
+    // the time it will be written with.
+    auto& pending_write = pending_writes.ensure(key, [&]() { return PendingWrite { type, now }; });
+    if (type != PendingWriteType::UpdateLastAccessTime)
+        pending_write.type = type;
+    pending_write.time = now;
+
+    if (pending_writes.size() >= MAX_PENDING_WRITES) {
+        flush_pending_writes();
+        return;
+    }
+
+    if (!flush_timer)
+        flush_timer = Core::Timer::create_single_shot(PENDING_WRITES_FLUSH_DELAY_MS, [this]() { flush_pending_writes(); });
+    if (!flush_timer->is_active())
+        flush_timer->start();
+}
+
+void StorageJar::PersistedStorage::flush_pending_writes()
+{
+    if (flush_timer)
+        flush_timer->stop();
+
+    if (pending_writes.is_empty())
+        return;
+
+    database.execute_statement(statements.begin_transaction, {});
+
+    for (auto const& [key, pending_write] : pending_writes) {
+        switch (pending_write.type) {
+        case PendingWriteType::UpdateLastAccessTime:
+            database.execute_statement(
+                statements.update_last_access_time,
+                {},
+                pending_write.time,
+                to_underlying(key.storage_endpoint),
+                key.storage_key,
+                key.bottle_key);
+            break;
+
+        case PendingWriteType::SetItem: {
+            auto const& bottle = bottles[to_underlying(key.storage_endpoint)].get(key.storage_key);
+            VERIFY(bottle.has_value());
+
+            database.execute_statement(
+                statements.set_item,
+                {},
+                to_underlying(key.storage_endpoint),
+                key.storage_key,
+                key.bottle_key,
+                bottle->items.get(key.bottle_key).value(),
+                pending_write.time);
+            break;
+        }
+
+        case PendingWriteType::DeleteItem:
+            database.execute_statement(
+                statements.delete_item,
+                {},
+                to_underlying(key.storage_endpoint),
+                key.storage_key,
+                key.bottle_key);
+            break;
+        }
+    }
+
+    database.execute_statement(statements.commit_transaction, {});
+    pending_writes.clear_with_capacity();
+}
+
 }
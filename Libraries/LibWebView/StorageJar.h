@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <AK/Time.h>
 #include <AK/Traits.h>
+#include <LibCore/Forward.h>
 #include <LibDatabase/Forward.h>
 #include <LibRequests/CacheSizes.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
@@ -44,19 +46,19 @@ public:
     void remove_items_accessed_since(UnixDateTime);
     void clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key);
     Vector<String> get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key);
-    Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since) const;
+    Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since);
 
 private:
     struct Statements {
-        Database::StatementID get_item { 0 };
+        Database::StatementID get_items { 0 };
         Database::StatementID set_item { 0 };
         Database::StatementID delete_item { 0 };
         Database::StatementID delete_items_accessed_since { 0 };
         Database::StatementID update_last_access_time { 0 };
         Database::StatementID clear { 0 };
-        Database::StatementID get_keys { 0 };
-        Database::StatementID calculate_size_excluding_key { 0 };
         Database::StatementID estimate_storage_size_accessed_since { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class TransientStorage {
@@ -85,10 +87,36 @@ private:
         void delete_items_accessed_since(UnixDateTime);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
-        Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since) const;
+        Requests::CacheSizes estimate_storage_size_accessed_since(UnixDateTime since);
+
+        void flush_pending_writes();
 
         Database::Database& database;
         Statements statements;
+
+        // Each bottle is read from the database in full the first time it is used. Reads and quota checks are then
+        // served from memory, and writes are applied to memory immediately and to the database in batches.
+        struct Bottle {
+            OrderedHashMap<String, String> items;
+            size_t size { 0 };
+        };
+        Bottle& ensure_bottle(StorageEndpointType storage_endpoint, String const& storage_key);
+
+        Array<HashMap<String, Bottle>, to_underlying(StorageEndpointType::Count)> bottles;
+
+        enum class PendingWriteType : u8 {
+            UpdateLastAccessTime,
+            SetItem,
+            DeleteItem,
+        };
+        struct PendingWrite {
+            PendingWriteType type { PendingWriteType::UpdateLastAccessTime };
+            UnixDateTime time;
+        };
+        void enqueue_pending_write(StorageLocation const& key, PendingWriteType);
+
+        OrderedHashMap<StorageLocation, PendingWrite> pending_writes;
+        RefPtr<Core::Timer> flush_timer;
     };
 
     explicit StorageJar(Optional<PersistedStorage>);
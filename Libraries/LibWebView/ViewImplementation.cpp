@@ -98,6 +98,12 @@ u64 ViewImplementation::page_id() const
 }
 
 void ViewImplementation::create_new_process_for_cross_site_navigation(URL::URL const& url)
+{
+    replace_client_with_new_process();
+    load(url);
+}
+
+void ViewImplementation::replace_client_with_new_process()
 {
     if (m_client_state.client) {
         m_client_state.client->unregister_view(m_client_state.page_index);
@@ -110,8 +116,6 @@ void ViewImplementation::create_new_process_for_cross_site_navigation(URL::URL c
     // Don't keep a stale backup bitmap around.
     m_backup_bitmap = nullptr;
     handle_resize();
-
-    load(url);
 }
 
 void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id, Gfx::IntSize size)
@@ -130,43 +134,103 @@ void ViewImplementation::server_did_paint(Badge<WebContentClient>, i32 bitmap_id
 
 void ViewImplementation::set_window_position(Gfx::IntPoint position)
 {
+    if (!has_client())
+        return;
     client().async_set_window_position(m_client_state.page_index, position.to_type<Web::DevicePixels>());
 }
 
 void ViewImplementation::set_window_size(Gfx::IntSize size)
 {
+    if (!has_client())
+        return;
     client().async_set_window_size(m_client_state.page_index, size.to_type<Web::DevicePixels>());
 }
 
 void ViewImplementation::did_update_window_rect()
 {
+    if (!has_client())
+        return;
     client().async_did_update_window_rect(m_client_state.page_index);
 }
 
 void ViewImplementation::set_system_visibility_state(Web::HTML::VisibilityState visibility_state)
 {
     m_system_visibility_state = visibility_state;
+
+    // NB: The new process is told about our visibility state when it is initialized.
+    if (visibility_state == Web::HTML::VisibilityState::Visible && is_discarded()) {
+        create_new_process_for_cross_site_navigation(m_discarded_url.release_value());
+        return;
+    }
+
+    if (!has_client())
+        return;
+
     client().async_set_system_visibility_state(m_client_state.page_index, m_system_visibility_state);
 }
 
+void ViewImplementation::discard()
+{
+    if (is_discarded() || m_system_visibility_state == Web::HTML::VisibilityState::Visible)
+        return;
+
+    // Other views, e.g. pop-ups opened by this page, may live in the same process.
+    if (m_client_state.client->view_count() > 1)
+        return;
+
+    // There is nothing to gain from discarding a blank page.
+    if (m_url.scheme() == "about"sv)
+        return;
+
+    // NB: The view keeps its URL and title, so the UI goes on showing them while the page is discarded.
+    m_client_state.client->unregister_view(m_client_state.page_index);
+    client().async_close_server();
+
+    m_client_state = {};
+    m_backup_bitmap = nullptr;
+    m_pending_input_events.clear();
+
+    m_discarded_url = m_url;
+}
+
 void ViewImplementation::load(URL::URL const& url)
 {
+    m_discarded_url.clear();
+
+    if (!has_client()) {
+        create_new_process_for_cross_site_navigation(url);
+        return;
+    }
+
     m_url = url;
     client().async_load_url(page_id(), url);
 }
 
 void ViewImplementation::load_html(StringView html)
 {
+    if (!has_client()) {
+        m_discarded_url.clear();
+        replace_client_with_new_process();
+    }
+
     client().async_load_html(page_id(), html);
 }
 
 void ViewImplementation::reload()
 {
+    if (is_discarded()) {
+        create_new_process_for_cross_site_navigation(m_discarded_url.release_value());
+        return;
+    }
+
     client().async_reload(page_id());
 }
 
 void ViewImplementation::traverse_the_history_by_delta(int delta)
 {
+    if (!has_client())
+        return;
+
     client().async_traverse_the_history_by_delta(page_id(), delta);
 }
 
@@ -196,7 +260,9 @@ void ViewImplementation::reset_zoom()
 {
     m_zoom_level = 1.0;
     update_zoom();
-    client().async_reset_zoom(m_client_state.page_index);
+
+    if (has_client())
+        client().async_reset_zoom(m_client_state.page_index);
 }
 
 void ViewImplementation::enqueue_input_event(Web::InputEvent event)
@@ -204,6 +270,9 @@ void ViewImplementation::enqueue_input_event(Web::InputEvent event)
     // Send the next event over to the WebContent to be handled by JS. We'll later get a message to say whether JS
     // prevented the default event behavior, at which point we either discard or handle that event, and then try to
     // process the next one.
+    if (!has_client())
+        return;
+
     m_pending_input_events.enqueue(move(event));
 
     m_pending_input_events.tail().visit(
@@ -247,16 +316,22 @@ void ViewImplementation::did_finish_handling_input_event(Badge<WebContentClient>
 
 void ViewImplementation::set_preferred_color_scheme(Web::CSS::PreferredColorScheme color_scheme)
 {
+    if (!has_client())
+        return;
     client().async_set_preferred_color_scheme(page_id(), color_scheme);
 }
 
 void ViewImplementation::set_preferred_contrast(Web::CSS::PreferredContrast contrast)
 {
+    if (!has_client())
+        return;
     client().async_set_preferred_contrast(page_id(), contrast);
 }
 
 void ViewImplementation::set_preferred_motion(Web::CSS::PreferredMotion motion)
 {
+    if (!has_client())
+        return;
     client().async_set_preferred_motion(page_id(), motion);
 }
 
@@ -267,7 +342,7 @@ void ViewImplementation::notify_cookies_changed(HashTable<String> const& changed
             Core::increment_shared_version(m_document_cookie_version_buffer, *document_index);
     }
 
-    if (!cookies.is_empty())
+    if (!cookies.is_empty() && has_client())
         client().async_cookies_changed(page_id(), cookies);
 }
 
@@ -379,13 +454,22 @@ void ViewImplementation::set_listen_for_dom_mutations(bool listen_for_dom_mutati
 void ViewImplementation::did_connect_devtools_client()
 {
     m_devtools_connected = true;
+
+    // NB: The new process is told about the DevTools connection when it is initialized.
+    if (is_discarded()) {
+        create_new_process_for_cross_site_navigation(m_discarded_url.release_value());
+        return;
+    }
+
     client().async_did_connect_devtools_client(page_id());
 }
 
 void ViewImplementation::did_disconnect_devtools_client()
 {
     m_devtools_connected = false;
-    client().async_did_disconnect_devtools_client(page_id());
+
+    if (has_client())
+        client().async_did_disconnect_devtools_client(page_id());
 }
 
 void ViewImplementation::get_dom_node_inner_html(Web::UniqueNodeID node_id)
@@ -460,6 +544,8 @@ void ViewImplementation::request_style_sheet_source(Web::CSS::StyleSheetIdentifi
 
 void ViewImplementation::debug_request(ByteString const& request, ByteString const& argument)
 {
+    if (!has_client())
+        return;
     client().async_debug_request(page_id(), request, argument);
 }
 
@@ -515,6 +601,8 @@ void ViewImplementation::retrieved_clipboard_entries(u64 request_id, ReadonlySpa
 
 void ViewImplementation::toggle_page_mute_state()
 {
+    if (!has_client())
+        return;
     m_mute_state = Web::HTML::invert_mute_state(m_mute_state);
     client().async_toggle_page_mute_state(page_id());
 }
@@ -564,6 +652,20 @@ void ViewImplementation::did_allocate_backing_stores(Badge<WebContentClient>, i3
     m_client_state.back_bitmap.id = back_bitmap_id;
 }
 
+void ViewImplementation::did_release_backing_stores(Badge<WebContentClient>)
+{
+    // NB: Only the last painted frame is kept, so there is something to show until the page paints again after it
+    //     becomes visible. The other backing store is freed along with WebContent's copy.
+    if (m_client_state.has_usable_bitmap) {
+        m_backup_bitmap = m_client_state.front_bitmap.bitmap;
+        m_backup_bitmap_size = m_client_state.front_bitmap.last_painted_size;
+    }
+    m_client_state.has_usable_bitmap = false;
+
+    m_client_state.front_bitmap = {};
+    m_client_state.back_bitmap = {};
+}
+
 #ifdef AK_OS_MACOS
 void ViewImplementation::did_allocate_iosurface_backing_stores(i32 front_id, Core::MachPort&& front_port, i32 back_id, Core::MachPort&& back_port)
 {
@@ -601,11 +703,14 @@ void ViewImplementation::update_zoom()
         m_reset_zoom_action->set_visible(false);
     }
 
-    client().async_set_zoom_level(m_client_state.page_index, m_zoom_level);
+    if (has_client())
+        client().async_set_zoom_level(m_client_state.page_index, m_zoom_level);
 }
 
 void ViewImplementation::handle_resize()
 {
+    if (!has_client())
+        return;
     client().async_set_viewport_size(page_id(), this->viewport_size());
 }
 
@@ -709,12 +814,18 @@ void ViewImplementation::default_zoom_level_factor_changed()
 
 void ViewImplementation::languages_changed()
 {
+    if (!has_client())
+        return;
+
     auto const& languages = Application::settings().languages();
     client().async_set_preferred_languages(page_id(), languages);
 }
 
 void ViewImplementation::autoplay_settings_changed()
 {
+    if (!has_client())
+        return;
+
     auto const& autoplay_settings = Application::settings().autoplay_settings();
     auto const& web_content_options = Application::web_content_options();
 
@@ -726,6 +837,9 @@ void ViewImplementation::autoplay_settings_changed()
 
 void ViewImplementation::global_privacy_control_changed()
 {
+    if (!has_client())
+        return;
+
     auto global_privacy_control = Application::settings().global_privacy_control();
     client().async_set_enable_global_privacy_control(page_id(), global_privacy_control == GlobalPrivacyControl::Yes);
 }
@@ -852,8 +966,24 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::dump_gc_heap_statistics()
+{
+    auto promise = request_internal_page_info(PageInfoType::HeapStatistics);
+    auto heap_statistics_json = TRY(promise->await());
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("gc-heap-statistics-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(dump_file->write_until_depleted(heap_statistics_json.bytes()));
+
+    return path;
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
+    if (!has_client())
+        return;
     client().async_set_user_style(page_id(), source);
 }
 
@@ -57,6 +57,9 @@ public:
 
     String const& handle() const { return m_client_state.client_handle; }
 
+    // A discarded view has no WebContent process until it becomes visible again.
+    bool has_client() const { return !m_client_state.client.is_null(); }
+
     void create_new_process_for_cross_site_navigation(URL::URL const&);
 
     void server_did_paint(Badge<WebContentClient>, i32 bitmap_id, Gfx::IntSize size);
@@ -67,6 +70,11 @@ public:
 
     void set_system_visibility_state(Web::HTML::VisibilityState);
 
+    // Discarding a hidden view closes its WebContent process and leaves the view without one. The page is loaded again
+    // in a new process once the view becomes visible.
+    void discard();
+    bool is_discarded() const { return m_discarded_url.has_value(); }
+
     void load(URL::URL const&);
     void load_html(StringView);
     void reload();
@@ -153,6 +161,7 @@ public:
     void did_update_navigation_buttons_state(Badge<WebContentClient>, bool back_enabled, bool forward_enabled) const;
 
     void did_allocate_backing_stores(Badge<WebContentClient>, i32 front_bitmap_id, Gfx::ShareableBitmap const&, i32 back_bitmap_id, Gfx::ShareableBitmap const&);
+    void did_release_backing_stores(Badge<WebContentClient>);
 #ifdef AK_OS_MACOS
     void did_allocate_iosurface_backing_stores(i32 front_bitmap_id, Core::MachPort&&, i32 back_bitmap_id, Core::MachPort&&);
 #endif
@@ -169,6 +178,7 @@ public:
     void did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, Optional<Core::AnonymousBuffer> const&);
 
     ErrorOr<LexicalPath> dump_gc_graph();
+    ErrorOr<LexicalPath> dump_gc_heap_statistics();
 
     void set_user_style_sheet(String const& source);
     // Load Native.css as the User style sheet, which attempts to make WebView content look as close to
@@ -287,6 +297,8 @@ protected:
     };
     void handle_web_content_process_crash(LoadErrorPage = LoadErrorPage::Yes);
 
+    void replace_client_with_new_process();
+
     virtual void default_zoom_level_factor_changed() override;
     virtual void languages_changed() override;
     virtual void autoplay_settings_changed() override;
@@ -365,6 +377,7 @@ protected:
     RefPtr<Core::Promise<String>> m_pending_info_request;
 
     Web::HTML::VisibilityState m_system_visibility_state { Web::HTML::VisibilityState::Hidden };
+    Optional<URL::URL> m_discarded_url;
 
     Web::HTML::AudioPlayState m_audio_play_state { Web::HTML::AudioPlayState::Paused };
     size_t m_number_of_elements_playing_audio { 0 };
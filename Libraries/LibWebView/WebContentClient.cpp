@@ -46,7 +46,11 @@ WebContentClient::~WebContentClient()
 
 void WebContentClient::die()
 {
-    // Intentionally empty. Restart is handled at another level.
+    for (auto& [id, promise] : m_pending_memory_reports)
+        promise->reject(Error::from_string_literal("WebContent process died"));
+    m_pending_memory_reports.clear();
+
+    // Restart is handled at another level.
 }
 
 void WebContentClient::assign_view(Badge<Application>, ViewImplementation& view)
@@ -428,6 +432,24 @@ void WebContentClient::did_get_internal_page_info(u64 page_id, WebView::PageInfo
         view->did_receive_internal_page_info({}, type, info);
 }
 
+NonnullRefPtr<Core::Promise<JsonValue>> WebContentClient::request_memory_report()
+{
+    auto promise = Core::Promise<JsonValue>::construct();
+
+    auto memory_report_id = m_next_memory_report_id++;
+    m_pending_memory_reports.set(memory_report_id, promise);
+
+    async_request_memory_report(memory_report_id);
+
+    return promise;
+}
+
+void WebContentClient::did_produce_memory_report(u64 memory_report_id, JsonValue report)
+{
+    if (auto promise = m_pending_memory_reports.take(memory_report_id); promise.has_value())
+        (*promise)->resolve(move(report));
+}
+
 void WebContentClient::did_execute_js_console_input(u64 page_id, JsonValue result)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -775,10 +797,16 @@ void WebContentClient::did_allocate_backing_stores(u64 page_id, i32 front_bitmap
         view->did_allocate_backing_stores({}, front_bitmap_id, front_bitmap, back_bitmap_id, back_bitmap);
 }
 
+void WebContentClient::did_release_backing_stores(u64 page_id)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_release_backing_stores({});
+}
+
 Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         return worker_client->clone_transport();
     }
 
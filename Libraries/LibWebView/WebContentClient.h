@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/SourceLocation.h>
+#include <LibCore/Promise.h>
 #include <LibHTTP/Header.h>
 #include <LibIPC/ConnectionToServer.h>
 #include <LibIPC/Transport.h>
@@ -52,6 +53,7 @@ public:
     void assign_view(Badge<Application>, ViewImplementation&);
     void register_view(u64 page_id, ViewImplementation&);
     void unregister_view(u64 page_id);
+    size_t view_count() const { return m_views.size(); }
 
     void web_ui_disconnected(Badge<WebUI>);
 
@@ -60,6 +62,8 @@ public:
     pid_t pid() const { return m_process_handle.pid; }
     void set_pid(pid_t pid) { m_process_handle.pid = pid; }
 
+    NonnullRefPtr<Core::Promise<JsonValue>> request_memory_report();
+
 private:
     virtual void die() override;
 
@@ -95,6 +99,7 @@ private:
     virtual void did_get_style_sheet_source(u64 page_id, Web::CSS::StyleSheetIdentifier identifier, URL::URL, String source) override;
     virtual void did_take_screenshot(u64 page_id, Gfx::ShareableBitmap screenshot) override;
     virtual void did_get_internal_page_info(u64 page_id, PageInfoType, Optional<Core::AnonymousBuffer>) override;
+    virtual void did_produce_memory_report(u64 memory_report_id, JsonValue) override;
     virtual void did_execute_js_console_input(u64 page_id, JsonValue) override;
     virtual void did_output_js_console_message(u64 page_id, ConsoleOutput) override;
     virtual void did_start_network_request(u64 page_id, u64 request_id, URL::URL, ByteString method, Vector<HTTP::Header>, ByteBuffer request_body, Optional<String> initiator_type) override;
@@ -148,6 +153,7 @@ private:
     virtual void did_change_audio_play_state(u64 page_id, Web::HTML::AudioPlayState) override;
     virtual void did_update_navigation_buttons_state(u64 page_id, bool back_enabled, bool forward_enabled) override;
     virtual void did_allocate_backing_stores(u64 page_id, i32 front_bitmap_id, Gfx::ShareableBitmap, i32 back_bitmap_id, Gfx::ShareableBitmap) override;
+    virtual void did_release_backing_stores(u64 page_id) override;
     virtual Messages::WebContentClient::RequestWorkerAgentResponse request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type) override;
 
     Optional<ViewImplementation&> view_for_page_id(u64, SourceLocation = SourceLocation::current());
@@ -158,6 +164,9 @@ private:
 
     RefPtr<WebUI> m_web_ui;
 
+    HashMap<u64, NonnullRefPtr<Core::Promise<JsonValue>>> m_pending_memory_reports;
+    u64 m_next_memory_report_id { 0 };
+
     static HashTable<WebContentClient*> s_clients;
 };
 
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibCore/Promise.h>
+#include <LibRequests/RequestClient.h>
+#include <LibWebView/Application.h>
+#include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
+#include <LibWebView/WebUI/MemoryUI.h>
+
+namespace WebView {
+
+void MemoryUI::register_interfaces()
+{
+    register_interface("updateMemoryReport"sv, [this](auto const&) {
+        update_memory_report();
+    });
+}
+
+void MemoryUI::update_memory_report()
+{
+    struct PendingMemoryReport : public RefCounted<PendingMemoryReport> {
+        JsonValue processes;
+        JsonArray reports;
+        size_t remaining_report_count { 0 };
+    };
+
+    auto& process_manager = Application::process_manager();
+    process_manager.update_all_process_statistics();
+
+    auto pending_report = make_ref_counted<PendingMemoryReport>();
+    pending_report->processes = process_manager.serialize_json();
+
+    Vector<NonnullRefPtr<Core::Promise<JsonValue>>> promises;
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        promises.append(client.request_memory_report());
+        return IterationDecision::Continue;
+    });
+    promises.append(Application::request_server_client().request_memory_report());
+
+    pending_report->remaining_report_count = promises.size();
+
+    // The processes reply in any order, and a process that dies before replying rejects its promise instead. Either way,
+    // the page receives a single message once every process has been heard from.
+    auto did_receive_report = [this, protector = NonnullRefPtr { *this }, pending_report](Optional<JsonValue> report) {
+        if (report.has_value())
+            pending_report->reports.must_append(report.release_value());
+
+        if (--pending_report->remaining_report_count != 0)
+            return;
+
+        JsonObject result;
+        result.set("processes"sv, move(pending_report->processes));
+        result.set("reports"sv, move(pending_report->reports));
+        async_send_message("loadMemoryReport"sv, move(result));
+    };
+
+    for (auto& promise : promises) {
+        promise
+            ->when_resolved([did_receive_report](JsonValue& report) {
+                did_receive_report(move(report));
+            })
+            .when_rejected([did_receive_report](Error const& error) {
+                dbgln("Failed to receive memory report: {}", error);
+                did_receive_report({});
+            });
+    }
+}
+
+}
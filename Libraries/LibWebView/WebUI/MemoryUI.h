@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWebView/Forward.h>
+#include <LibWebView/WebUI.h>
+
+namespace WebView {
+
+class WEBVIEW_API MemoryUI : public WebUI {
+    WEB_UI(MemoryUI);
+
+private:
+    virtual void register_interfaces() override;
+
+    void update_memory_report();
+};
+
+}
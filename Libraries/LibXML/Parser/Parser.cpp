@@ -445,95 +445,132 @@ static xmlSAXHandler create_sax_handler(bool preserve_comments, bool resolve_htm
     return handler;
 }
 
-ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
+static xmlParserCtxtPtr create_parser_context(ParserContext& context, Parser::Options const& options)
 {
-    auto source_result = listener.set_source(ByteString(m_source));
-    if (source_result.is_error())
-        return ParseError { {}, ByteString("Failed to set source") };
-
-    ParserContext context;
-    context.listener = &listener;
-    context.options = &m_options;
-
-    bool resolve_html_entities = static_cast<bool>(m_options.resolve_named_html_entity);
-    auto sax_handler = create_sax_handler(m_options.preserve_comments, resolve_html_entities);
+    bool resolve_html_entities = static_cast<bool>(options.resolve_named_html_entity);
+    auto sax_handler = create_sax_handler(options.preserve_comments, resolve_html_entities);
 
-    int options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
-    if (!m_options.preserve_cdata)
-        options |= XML_PARSE_NOCDATA;
+    int libxml_options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
+    if (!options.preserve_cdata)
+        libxml_options |= XML_PARSE_NOCDATA;
 
     auto* parser_ctx = xmlCreatePushParserCtxt(&sax_handler, nullptr, nullptr, 0, nullptr);
     if (!parser_ctx)
-        return ParseError { {}, ByteString("Failed to create parser context") };
+        return nullptr;
 
     parser_ctx->_private = &context;
-    xmlCtxtUseOptions(parser_ctx, options);
+    xmlCtxtUseOptions(parser_ctx, libxml_options);
 
     xmlSwitchEncoding(parser_ctx, XML_CHAR_ENCODING_UTF8);
 
-    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    return parser_ctx;
+}
 
+// Frees the parser context once the last chunk has been parsed, and determines the outcome of parsing.
+static ErrorOr<void, ParseError> finish_parsing(xmlParserCtxtPtr parser_ctx, int last_chunk_result, ParserContext& context, Parser::Options const& options, Vector<ParseError>& parse_errors)
+{
     bool well_formed = parser_ctx->wellFormed;
     xmlFreeParserCtxt(parser_ctx);
 
-    m_parse_errors = move(context.parse_errors);
+    parse_errors = move(context.parse_errors);
 
-    if (!context.document_ended)
-        listener.document_end();
+    if (context.listener && !context.document_ended)
+        context.listener->document_end();
 
-    if (context.error.has_value() && m_options.treat_errors_as_fatal)
+    if (context.error.has_value() && options.treat_errors_as_fatal)
         return context.error.release_value();
 
-    if (result != 0 || !well_formed) {
-        if (!m_parse_errors.is_empty())
-            return m_parse_errors.first();
+    if (last_chunk_result != 0 || !well_formed) {
+        if (!parse_errors.is_empty())
+            return parse_errors.first();
         return ParseError { {}, ByteString("XML parsing failed") };
     }
 
     return {};
 }
 
-ErrorOr<Document, ParseError> Parser::parse()
+ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
 {
+    auto source_result = listener.set_source(m_source);
+    if (source_result.is_error())
+        return ParseError { {}, ByteString("Failed to set source") };
+
     ParserContext context;
+    context.listener = &listener;
     context.options = &m_options;
 
-    bool resolve_html_entities = static_cast<bool>(m_options.resolve_named_html_entity);
-    auto sax_handler = create_sax_handler(m_options.preserve_comments, resolve_html_entities);
+    auto* parser_ctx = create_parser_context(context, m_options);
+    if (!parser_ctx)
+        return ParseError { {}, ByteString("Failed to create parser context") };
 
-    int options = XML_PARSE_NONET | XML_PARSE_NOWARNING;
-    if (!m_options.preserve_cdata)
-        options |= XML_PARSE_NOCDATA;
+    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    return finish_parsing(parser_ctx, result, context, m_options, m_parse_errors);
+}
 
-    auto* parser_ctx = xmlCreatePushParserCtxt(&sax_handler, nullptr, nullptr, 0, nullptr);
+ErrorOr<Document, ParseError> Parser::parse()
+{
+    ParserContext context;
+    context.options = &m_options;
+
+    auto* parser_ctx = create_parser_context(context, m_options);
     if (!parser_ctx)
         return ParseError { {}, ByteString("Failed to create parser context") };
 
-    parser_ctx->_private = &context;
-    xmlCtxtUseOptions(parser_ctx, options);
+    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    TRY(finish_parsing(parser_ctx, result, context, m_options, m_parse_errors));
 
-    xmlSwitchEncoding(parser_ctx, XML_CHAR_ENCODING_UTF8);
+    if (!context.root_node)
+        return ParseError { {}, ByteString("No root element") };
 
-    auto result = xmlParseChunk(parser_ctx, m_source.characters_without_null_termination(), static_cast<int>(m_source.length()), 1);
+    return Document(context.root_node.release_nonnull(), move(context.doctype), move(context.processing_instructions), context.version);
+}
 
-    bool well_formed = parser_ctx->wellFormed;
-    xmlFreeParserCtxt(parser_ctx);
+IncrementalParser::IncrementalParser(Listener& listener, Parser::Options options)
+    : m_options(move(options))
+    , m_context(make<ParserContext>())
+{
+    m_context->listener = &listener;
+    m_context->options = &m_options;
+}
 
-    m_parse_errors = move(context.parse_errors);
+IncrementalParser::~IncrementalParser()
+{
+    if (m_parser_context)
+        xmlFreeParserCtxt(m_parser_context);
+}
 
-    if (context.error.has_value() && m_options.treat_errors_as_fatal)
-        return context.error.release_value();
+ErrorOr<NonnullOwnPtr<IncrementalParser>, ParseError> IncrementalParser::create(Listener& listener, Parser::Options options)
+{
+    auto parser = adopt_own(*new IncrementalParser(listener, move(options)));
 
-    if (result != 0 || !well_formed) {
-        if (!m_parse_errors.is_empty())
-            return m_parse_errors.first();
-        return ParseError { {}, ByteString("XML parsing failed") };
-    }
+    parser->m_parser_context = create_parser_context(*parser->m_context, parser->m_options);
+    if (!parser->m_parser_context)
+        return ParseError { {}, ByteString("Failed to create parser context") };
 
-    if (!context.root_node)
-        return ParseError { {}, ByteString("No root element") };
+    return parser;
+}
 
-    return Document(context.root_node.release_nonnull(), move(context.doctype), move(context.processing_instructions), context.version);
+ErrorOr<void, ParseError> IncrementalParser::feed(StringView chunk)
+{
+    VERIFY(m_parser_context);
+
+    auto result = xmlParseChunk(m_parser_context, chunk.characters_without_null_termination(), static_cast<int>(chunk.length()), 0);
+
+    // NB: The error is only reported here, finish() still has to be called to end the document.
+    if (m_context->error.has_value() && m_options.treat_errors_as_fatal)
+        return m_context->error.value();
+    if (result != 0 && !m_context->parse_errors.is_empty())
+        return m_context->parse_errors.first();
+
+    return {};
+}
+
+ErrorOr<void, ParseError> IncrementalParser::finish()
+{
+    VERIFY(m_parser_context);
+
+    auto result = xmlParseChunk(m_parser_context, nullptr, 0, 1);
+    return finish_parsing(exchange(m_parser_context, nullptr), result, *m_context, m_options, m_parse_errors);
 }
 
 }
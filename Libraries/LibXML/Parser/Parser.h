@@ -11,6 +11,8 @@
 #include <AK/Function.h>
 #include <AK/GenericLexer.h>
 #include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
@@ -20,6 +22,8 @@
 #include <LibXML/Export.h>
 #include <LibXML/Forward.h>
 
+struct _xmlParserCtxt;
+
 namespace XML {
 
 struct Expectation {
@@ -34,7 +38,8 @@ struct ParseError {
 struct Listener {
     virtual ~Listener() { }
 
-    virtual ErrorOr<void> set_source(ByteString) { return {}; }
+    // Only called when the whole source is known up front, which is not the case with an IncrementalParser.
+    virtual ErrorOr<void> set_source(StringView) { return {}; }
     virtual void set_doctype(XML::Doctype) { }
     virtual void document_start() { }
     virtual void document_end() { }
@@ -78,6 +83,34 @@ private:
     Vector<ParseError> m_parse_errors;
 };
 
+struct ParserContext;
+
+// Parses a document that arrives in chunks, such as over the network, and reports it to a listener as it goes. Neither
+// the whole source nor a Document is ever kept around.
+class XML_API IncrementalParser {
+    AK_MAKE_NONCOPYABLE(IncrementalParser);
+    AK_MAKE_NONMOVABLE(IncrementalParser);
+
+public:
+    static ErrorOr<NonnullOwnPtr<IncrementalParser>, ParseError> create(Listener&, Parser::Options = {});
+    ~IncrementalParser();
+
+    // Chunks may end in the middle of a UTF-8 sequence or a token; the parser picks up where the chunk left off once
+    // the next one arrives.
+    ErrorOr<void, ParseError> feed(StringView chunk);
+    ErrorOr<void, ParseError> finish();
+
+    Vector<ParseError> const& parse_error_causes() const { return m_parse_errors; }
+
+private:
+    IncrementalParser(Listener&, Parser::Options);
+
+    Parser::Options m_options;
+    NonnullOwnPtr<ParserContext> m_context;
+    _xmlParserCtxt* m_parser_context { nullptr };
+    Vector<ParseError> m_parse_errors;
+};
+
 }
 
 template<>
@@ -35,6 +35,7 @@ set(IMAGE_LOADER_DEBUG ON)
 set(JOB_DEBUG ON)
 set(JS_BYTECODE_DEBUG ON)
 set(JS_MODULE_DEBUG ON)
+set(JS_PROPERTY_LOOKUP_CACHE_DEBUG ON)
 set(LEXER_DEBUG ON)
 set(LIBWEB_CSS_ANIMATION_DEBUG ON)
 set(LIBWEB_CSS_DEBUG ON)
@@ -44,6 +45,7 @@ set(LZW_DEBUG ON)
 set(MACH_PORT_DEBUG ON)
 set(MATROSKA_DEBUG ON)
 set(MATROSKA_TRACE_DEBUG ON)
+set(MEMORY_PRESSURE_DEBUG ON)
 set(NETWORKJOB_DEBUG ON)
 set(NT_DEBUG ON)
 set(OPENTYPE_GPOS_DEBUG ON)
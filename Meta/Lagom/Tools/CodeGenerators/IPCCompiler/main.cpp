@@ -791,7 +791,7 @@ public:
     virtual u32 magic() const override { return @endpoint.magic@; }
     virtual ByteString name() const override { return "@endpoint.name@"; }
 
-    virtual ErrorOr<OwnPtr<IPC::MessageBuffer>> handle(NonnullOwnPtr<IPC::Message> message) override
+    virtual ErrorOr<Optional<IPC::MessageBuffer>> handle(NonnullOwnPtr<IPC::Message> message) override
     {
         switch (message->message_id()) {)~~~");
     for (auto const& message : endpoint.messages) {
@@ -823,18 +823,18 @@ public:
             [[maybe_unused]] auto& request = static_cast<Messages::@endpoint.name@::@message.pascal_name@&>(*message);
             @handler_name@(@arguments@);
             auto response = Messages::@endpoint.name@::@message.response_type@ { };
-            return make<IPC::MessageBuffer>(TRY(response.encode()));)~~~");
+            return TRY(response.encode());)~~~");
                 } else {
                     message_generator.append(R"~~~(
             [[maybe_unused]] auto& request = static_cast<Messages::@endpoint.name@::@message.pascal_name@&>(*message);
             auto response = @handler_name@(@arguments@);
-            return make<IPC::MessageBuffer>(TRY(response.encode()));)~~~");
+            return TRY(response.encode());)~~~");
                 }
             } else {
                 message_generator.append(R"~~~(
             [[maybe_unused]] auto& request = static_cast<Messages::@endpoint.name@::@message.pascal_name@&>(*message);
             @handler_name@(@arguments@);
-            return nullptr;)~~~");
+            return OptionalNone {};)~~~");
             }
             message_generator.append(R"~~~(
         })~~~");
@@ -475,8 +475,10 @@ static void generate_to_string(SourceGenerator& scoped_generator, ParameterType
         scoped_generator.set("to_string", is_utf16_string ? "to_utf16_usv_string"sv : "to_usv_string"sv);
     else if (parameter.type->name() == "ByteString")
         scoped_generator.set("to_string", "to_byte_string"sv);
+    else if (is_utf16_string)
+        scoped_generator.set("to_string", "to_utf16_string"sv);
     else
-        scoped_generator.set("to_string", is_utf16_string ? "to_utf16_string"sv : "to_string"sv);
+        scoped_generator.set("to_string", is_fly_string ? "to_fly_string"sv : "to_string"sv);
 
     if (variadic) {
         scoped_generator.append(R"~~~(
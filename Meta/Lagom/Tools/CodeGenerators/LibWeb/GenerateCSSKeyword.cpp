@@ -51,6 +51,7 @@ ErrorOr<void> generate_header_file(JsonArray& keyword_data, Core::File& file)
     StringBuilder builder;
     SourceGenerator generator { builder };
     generator.set("keyword_underlying_type", underlying_type_for_enum(keyword_data.size()));
+    generator.set("keyword_count", String::number(keyword_data.size() + 1));
     generator.append(R"~~~(
 #pragma once
 
@@ -76,6 +77,9 @@ enum class Keyword : @keyword_underlying_type@ {
     generator.append(R"~~~(
 };
 
+// NOTE: This includes Keyword::Invalid.
+constexpr size_t keyword_count = @keyword_count@;
+
 WEB_API Optional<Keyword> keyword_from_string(StringView);
 StringView string_from_keyword(Keyword);
 
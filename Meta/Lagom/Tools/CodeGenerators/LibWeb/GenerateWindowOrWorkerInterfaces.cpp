@@ -336,18 +336,16 @@ static ErrorOr<void> generate_exposed_interface_implementation(StringView class_
         }
     }
 
-    generator.append(R"~~~(
-namespace Web::Bindings {
-
-void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
-{
-    static constexpr u8 attr = JS::Attribute::Writable | JS::Attribute::Configurable;
-)~~~");
+    // The accessors are generated separately, so the global object can be told how many to expect first.
+    StringBuilder accessors_builder;
+    SourceGenerator accessors_generator(accessors_builder);
+    size_t accessor_count = 0;
 
-    auto add_interface = [](SourceGenerator& gen, StringView name, StringView prototype_class, Optional<LegacyConstructor> const& legacy_constructor, Optional<ByteString const&> legacy_alias_name) {
+    auto add_interface = [&](SourceGenerator& gen, StringView name, StringView prototype_class, Optional<LegacyConstructor> const& legacy_constructor, Optional<ByteString const&> legacy_alias_name) {
         gen.set("interface_name", name);
         gen.set("prototype_class", prototype_class);
 
+        ++accessor_count;
         gen.append(R"~~~(
     global.define_intrinsic_accessor("@interface_name@"_utf16_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
 
@@ -357,11 +355,13 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
                 auto legacy_alias_names = legacy_alias_name->substring_view(1).split_view(',');
                 for (auto legacy_alias_name : legacy_alias_names) {
                     gen.set("interface_alias_name", legacy_alias_name.trim_whitespace());
+                    ++accessor_count;
                     gen.append(R"~~~(
     global.define_intrinsic_accessor("@interface_alias_name@"_utf16_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
                 }
             } else {
                 gen.set("interface_alias_name", *legacy_alias_name);
+                ++accessor_count;
                 gen.append(R"~~~(
     global.define_intrinsic_accessor("@interface_alias_name@"_utf16_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@interface_name@"_fly_string); });)~~~");
             }
@@ -369,21 +369,23 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
 
         if (legacy_constructor.has_value()) {
             gen.set("legacy_interface_name", legacy_constructor->name);
+            ++accessor_count;
             gen.append(R"~~~(
     global.define_intrinsic_accessor("@legacy_interface_name@"_utf16_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_constructor<@prototype_class@>(realm, "@legacy_interface_name@"_fly_string); });)~~~");
         }
     };
 
-    auto add_namespace = [](SourceGenerator& gen, StringView name, StringView namespace_class) {
+    auto add_namespace = [&](SourceGenerator& gen, StringView name, StringView namespace_class) {
         gen.set("interface_name", name);
         gen.set("namespace_class", namespace_class);
 
+        ++accessor_count;
         gen.append(R"~~~(
     global.define_intrinsic_accessor("@interface_name@"_utf16_fly_string, attr, [](auto& realm) -> JS::Value { return &ensure_web_namespace<@namespace_class@>(realm, "@interface_name@"_fly_string); });)~~~");
     };
 
     for (auto& interface : exposed_interfaces) {
-        auto gen = generator.fork();
+        auto gen = accessors_generator.fork();
 
         if (interface.is_namespace) {
             add_namespace(gen, interface.name, interface.namespace_class);
@@ -399,6 +401,19 @@ void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
         }
     }
 
+    generator.set("accessor_count", String::number(accessor_count));
+    generator.append(R"~~~(
+namespace Web::Bindings {
+
+void add_@global_object_snake_name@_exposed_interfaces(JS::Object& global)
+{
+    static constexpr u8 attr = JS::Attribute::Writable | JS::Attribute::Configurable;
+
+    global.ensure_intrinsic_accessor_capacity(@accessor_count@);
+)~~~");
+
+    builder.append(accessors_builder.string_view());
+
     generator.append(R"~~~(
 }
 
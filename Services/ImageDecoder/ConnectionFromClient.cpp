@@ -7,8 +7,11 @@
 #include <AK/Debug.h>
 #include <AK/IDAllocator.h>
 #include <ImageDecoder/ConnectionFromClient.h>
+#include <ImageDecoder/DecodedImageCache.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
@@ -30,6 +33,11 @@ void ConnectionFromClient::die()
         job->cancel();
     }
     m_pending_jobs.clear();
+    for (auto& [_, animation] : m_streamed_animations) {
+        if (animation.pending_job)
+            animation.pending_job->cancel();
+    }
+    m_streamed_animations.clear();
 
     auto client_id = this->client_id();
     s_connections.remove(client_id);
@@ -85,19 +93,32 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+// Animations whose frames would add up to more than this are streamed to the client a few frames at a time.
+static constexpr size_t streamed_animation_size_threshold = 32 * MiB;
+static constexpr size_t initial_streamed_frame_count = 4;
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations, bool& is_streamed)
 {
+    is_streamed = false;
     bitmaps.ensure_capacity(decoder.frame_count());
     durations.ensure_capacity(decoder.frame_count());
     for (size_t i = 0; i < decoder.frame_count(); ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
-            bitmaps.unchecked_append({});
+            if (!is_streamed || i < initial_streamed_frame_count)
+                bitmaps.unchecked_append({});
             durations.unchecked_append(0);
         } else {
             auto frame = frame_or_error.release_value();
-            frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
-            bitmaps.unchecked_append(frame.image);
+
+            // NB: We still have to decode every frame to learn its duration, but we only keep the first few bitmaps.
+            if (i == 0 && decoder.is_animated() && decoder.frame_count() > initial_streamed_frame_count)
+                is_streamed = frame.image->size_in_bytes() * decoder.frame_count() > streamed_animation_size_threshold;
+
+            if (!is_streamed || i < initial_streamed_frame_count) {
+                frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+                bitmaps.unchecked_append(frame.image);
+            }
             durations.unchecked_append(frame.duration);
         }
     }
@@ -105,6 +126,8 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
 
 static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
 {
+    TRACE_EVENT(ImageDecoding, "ImageDecoder: decode image");
+
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
 
     if (!decoder)
@@ -136,11 +159,20 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    bool is_streamed = false;
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, bitmaps, result.durations, is_streamed);
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
 
+    // OPTIMIZATION: Sending every frame of a large animation at once would make the client hold all of them in memory.
+    //               Instead, we keep the decoder around and let the client request the rest of the frames as it
+    //               plays the animation.
+    if (is_streamed) {
+        result.streamed_decoder = decoder;
+        result.encoded_buffer = encoded_buffer;
+    }
+
     result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
 
     return result;
@@ -149,11 +181,16 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
 NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
 {
     return Job::construct(
-        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
+        [encoded_buffer, ideal_size, mime_type](auto&) -> ErrorOr<DecodeResult> {
             return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
         },
-        [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
+        [strong_this = NonnullRefPtr(*this), image_id, encoded_buffer, ideal_size, mime_type](DecodeResult result) -> ErrorOr<void> {
+            DecodedImageCache::the().set(encoded_buffer, ideal_size, mime_type, result);
+
+            bool is_streamed = result.streamed_decoder;
+            if (is_streamed)
+                strong_this->m_streamed_animations.set(image_id, { result.streamed_decoder.release_nonnull(), move(result.encoded_buffer), ideal_size });
+            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile), is_streamed);
             strong_this->m_pending_jobs.remove(image_id);
             return {};
         },
@@ -174,6 +211,16 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return image_id;
     }
 
+    // OPTIMIZATION: Many clients tend to decode the same images, so we may already have the result at hand.
+    if (auto cached_result = DecodedImageCache::the().get(encoded_buffer, ideal_size, mime_type); cached_result.has_value()) {
+        // NB: The client only learns about the image ID once we've responded, so we can't send the result right away.
+        Core::deferred_invoke([strong_this = NonnullRefPtr(*this), image_id, result = cached_result.release_value()] mutable {
+            if (strong_this->is_open())
+                strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile), false);
+        });
+        return image_id;
+    }
+
     m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type)));
 
     return image_id;
@@ -186,4 +233,84 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     }
 }
 
+
+void ConnectionFromClient::request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count)
+{
+    auto it = m_streamed_animations.find(image_id);
+    if (it == m_streamed_animations.end()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No streamed animation with ID {}", image_id);
+        // NB: The client waits for a response before it asks for more frames, so it has to hear back either way.
+        async_did_fail_to_decode_animation_frames(image_id, first_frame_index);
+        return;
+    }
+
+    it->value.queued_frame_ranges.append({ first_frame_index, frame_count });
+    if (!it->value.pending_job)
+        decode_next_animation_frames(image_id);
+}
+
+void ConnectionFromClient::decode_next_animation_frames(i64 image_id)
+{
+    auto& animation = m_streamed_animations.get(image_id).value();
+    if (animation.queued_frame_ranges.is_empty())
+        return;
+    auto range = animation.queued_frame_ranges.take_first();
+
+    animation.pending_job = AnimationFramesJob::construct(
+        // NB: The job holds on to the decoder and its buffer, in case the client stops streaming while it runs.
+        [decoder = animation.decoder, encoded_buffer = animation.encoded_buffer, ideal_size = animation.ideal_size, range](auto& job) -> ErrorOr<DecodedAnimationFrames> {
+            TRACE_EVENT(ImageDecoding, "ImageDecoder: decode animation frames");
+
+            auto end_frame_index = min(static_cast<size_t>(range.first_frame_index) + range.frame_count, decoder->frame_count());
+
+            DecodedAnimationFrames result;
+            result.first_frame_index = range.first_frame_index;
+            for (size_t i = range.first_frame_index; i < end_frame_index; ++i) {
+                if (job.is_canceled())
+                    return Error::from_errno(ECANCELED);
+
+                auto frame_or_error = decoder->frame(i, ideal_size);
+                if (frame_or_error.is_error()) {
+                    result.bitmaps.append({});
+                    continue;
+                }
+                auto frame = frame_or_error.release_value();
+                frame.image->set_alpha_type_destructive(Gfx::AlphaType::Premultiplied);
+                result.bitmaps.append(move(frame.image));
+            }
+            return result;
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](DecodedAnimationFrames result) -> ErrorOr<void> {
+            // NB: If the client stopped streaming in the meantime, nobody is waiting for these frames anymore.
+            if (!strong_this->m_streamed_animations.contains(image_id))
+                return {};
+
+            strong_this->m_streamed_animations.get(image_id)->pending_job = nullptr;
+            if (strong_this->is_open())
+                strong_this->async_did_decode_animation_frames(image_id, result.first_frame_index, Gfx::BitmapSequence { move(result.bitmaps) });
+            strong_this->decode_next_animation_frames(image_id);
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), image_id, range](Error) -> void {
+            if (!strong_this->m_streamed_animations.contains(image_id))
+                return;
+
+            strong_this->m_streamed_animations.get(image_id)->pending_job = nullptr;
+            if (strong_this->is_open())
+                strong_this->async_did_fail_to_decode_animation_frames(image_id, range.first_frame_index);
+            strong_this->decode_next_animation_frames(image_id);
+        });
+}
+
+void ConnectionFromClient::stop_streaming_animation(i64 image_id)
+{
+    if (auto animation = m_streamed_animations.take(image_id); animation.has_value() && animation->pending_job)
+        animation->pending_job->cancel();
+}
+
+void ConnectionFromClient::purge_decoded_image_cache()
+{
+    DecodedImageCache::the().clear();
+}
+
 }
@@ -11,7 +11,9 @@
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
 
@@ -33,24 +35,55 @@ public:
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+
+        // Set if only the first few frames of the animation were decoded into bitmaps, and the rest will be decoded as
+        // the client requests them.
+        RefPtr<Gfx::ImageDecoder> streamed_decoder;
+        Core::AnonymousBuffer encoded_buffer;
+    };
+
+    struct DecodedAnimationFrames {
+        u32 first_frame_index { 0 };
+        Vector<RefPtr<Gfx::Bitmap>> bitmaps;
     };
 
 private:
     using Job = Threading::BackgroundAction<DecodeResult>;
+    using AnimationFramesJob = Threading::BackgroundAction<DecodedAnimationFrames>;
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
     virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void request_animation_frames(i64 image_id, u32 first_frame_index, u32 frame_count) override;
+    virtual void stop_streaming_animation(i64 image_id) override;
+    virtual void purge_decoded_image_cache() override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::File> connect_new_client();
 
     NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    void decode_next_animation_frames(i64 image_id);
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+
+    struct StreamedAnimation {
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+        // NB: The decoder reads straight from this buffer, so it has to be kept alive alongside it.
+        Core::AnonymousBuffer encoded_buffer;
+        Optional<Gfx::IntSize> ideal_size;
+
+        struct FrameRange {
+            u32 first_frame_index { 0 };
+            u32 frame_count { 0 };
+        };
+        // NB: The decoder isn't thread-safe, so only one batch of frames is decoded at a time. The rest wait here.
+        Vector<FrameRange> queued_frame_ranges;
+        RefPtr<AnimationFramesJob> pending_job;
+    };
+    HashMap<i64, StreamedAnimation> m_streamed_animations;
 };
 
 }
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringHash.h>
+#include <ImageDecoder/DecodedImageCache.h>
+#include <LibGfx/Bitmap.h>
+
+namespace ImageDecoder {
+
+static constexpr size_t cache_byte_size_budget = 128 * MiB;
+
+// NB: Every lookup walks all entries, so we also cap how many images we remember.
+static constexpr size_t max_entry_count = 1024;
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache cache;
+    return cache;
+}
+
+static u32 hash_encoded_buffer(Core::AnonymousBuffer const& encoded_buffer)
+{
+    return string_hash(encoded_buffer.data<char>(), encoded_buffer.size());
+}
+
+Optional<size_t> DecodedImageCache::find(u32 hash, Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type) const
+{
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto const& entry = m_entries[i];
+        if (entry.hash != hash || entry.ideal_size != ideal_size || entry.mime_type != mime_type)
+            continue;
+        // NB: The hash isn't collision resistant, so we have to compare the whole encoded image to be sure.
+        if (entry.encoded_buffer.size() != encoded_buffer.size())
+            continue;
+        if (memcmp(entry.encoded_buffer.data<void>(), encoded_buffer.data<void>(), encoded_buffer.size()) != 0)
+            continue;
+        return i;
+    }
+    return {};
+}
+
+Optional<ConnectionFromClient::DecodeResult> DecodedImageCache::get(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type)
+{
+    auto index = find(hash_encoded_buffer(encoded_buffer), encoded_buffer, ideal_size, mime_type);
+    if (!index.has_value())
+        return {};
+
+    auto& entry = m_entries[*index];
+    entry.last_used = m_next_use++;
+    return entry.result;
+}
+
+void DecodedImageCache::set(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ConnectionFromClient::DecodeResult const& result)
+{
+    // NB: Streamed animations hold on to a decoder whose state belongs to a single client.
+    if (result.streamed_decoder)
+        return;
+
+    auto hash = hash_encoded_buffer(encoded_buffer);
+    if (find(hash, encoded_buffer, ideal_size, mime_type).has_value())
+        return;
+
+    size_t byte_size = encoded_buffer.size();
+    for (auto const& bitmap : result.bitmaps.bitmaps) {
+        if (bitmap)
+            byte_size += bitmap->size_in_bytes();
+    }
+
+    // NB: Don't let a single huge image push everything else out.
+    if (byte_size > cache_byte_size_budget / 4)
+        return;
+
+    evict_until_within_budget(byte_size);
+
+    m_byte_size += byte_size;
+    m_entries.append({
+        .hash = hash,
+        .encoded_buffer = move(encoded_buffer),
+        .ideal_size = ideal_size,
+        .mime_type = move(mime_type),
+        .result = result,
+        .byte_size = byte_size,
+        .last_used = m_next_use++,
+    });
+}
+
+void DecodedImageCache::clear()
+{
+    m_entries.clear();
+    m_byte_size = 0;
+}
+
+void DecodedImageCache::evict_until_within_budget(size_t incoming_byte_size)
+{
+    while (!m_entries.is_empty() && (m_byte_size + incoming_byte_size > cache_byte_size_budget || m_entries.size() >= max_entry_count)) {
+        size_t least_recently_used = 0;
+        for (size_t i = 1; i < m_entries.size(); ++i) {
+            if (m_entries[i].last_used < m_entries[least_recently_used].last_used)
+                least_recently_used = i;
+        }
+        m_byte_size -= m_entries[least_recently_used].byte_size;
+        m_entries.remove(least_recently_used);
+    }
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <ImageDecoder/ConnectionFromClient.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibGfx/Size.h>
+
+namespace ImageDecoder {
+
+// Remembers the results of recent decodes for all clients, so that an image that's requested many times (e.g. the same
+// sprite sheet in many tabs) is only decoded once. The least recently used results are evicted once they take up more
+// memory than our budget.
+class DecodedImageCache {
+public:
+    static DecodedImageCache& the();
+
+    Optional<ConnectionFromClient::DecodeResult> get(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type);
+    void set(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, ConnectionFromClient::DecodeResult const&);
+    void clear();
+
+private:
+    struct Entry {
+        u32 hash { 0 };
+        Core::AnonymousBuffer encoded_buffer;
+        Optional<Gfx::IntSize> ideal_size;
+        Optional<ByteString> mime_type;
+        ConnectionFromClient::DecodeResult result;
+        size_t byte_size { 0 };
+        u64 last_used { 0 };
+    };
+
+    Optional<size_t> find(u32 hash, Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& mime_type) const;
+    void evict_until_within_budget(size_t incoming_byte_size);
+
+    Vector<Entry> m_entries;
+    size_t m_byte_size { 0 };
+    u64 m_next_use { 0 };
+};
+
+}
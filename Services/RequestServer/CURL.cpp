@@ -5,30 +5,60 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/Enumerate.h>
 #include <RequestServer/CURL.h>
 
 namespace RequestServer {
 
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port)
 {
+    Vector<ByteString> ipv6_addresses;
+    Vector<ByteString> ipv4_addresses;
+
+    for (auto const& address : dns_result.cached_addresses()) {
+        address.visit(
+            [&](IPv4Address const& ipv4) { ipv4_addresses.append(ipv4.to_byte_string()); },
+            [&](IPv6Address const& ipv6) { ipv6_addresses.append(MUST(ipv6.to_string()).to_byte_string()); });
+    }
+
     StringBuilder resolve_opt_builder;
     resolve_opt_builder.appendff("{}:{}:", host, port);
 
-    for (auto const& [i, addr] : enumerate(dns_result.cached_addresses())) {
-        auto formatted_address = addr.visit(
-            [&](IPv4Address const& ipv4) { return ipv4.to_byte_string(); },
-            [&](IPv6Address const& ipv6) { return MUST(ipv6.to_string()).to_byte_string(); });
-
-        if (i > 0)
+    // RFC 8305 section 4: Interleave the address families, starting with IPv6. curl races the family of the first
+    //                     address against the other one (happy eyeballs), so this makes it prefer IPv6 while still
+    //                     falling back to IPv4 quickly when IPv6 connectivity is broken.
+    auto append_address = [&, first = true](ByteString const& address) mutable {
+        if (!first)
             resolve_opt_builder.append(',');
-        resolve_opt_builder.append(formatted_address);
+        resolve_opt_builder.append(address);
+        first = false;
+    };
+
+    for (size_t i = 0; i < max(ipv6_addresses.size(), ipv4_addresses.size()); ++i) {
+        if (i < ipv6_addresses.size())
+            append_address(ipv6_addresses[i]);
+        if (i < ipv4_addresses.size())
+            append_address(ipv4_addresses[i]);
     }
 
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: Resolve list: {}", resolve_opt_builder.string_view());
     return resolve_opt_builder.to_byte_string();
 }
 
+CURLSH* shared_curl_state()
+{
+    // OPTIMIZATION: Sharing TLS sessions lets a connection for one client resume a session that was negotiated for
+    //               another, saving a full handshake. The same goes for curl's own DNS cache.
+    // NB: RequestServer drives curl from a single thread, so the share doesn't need any lock callbacks.
+    static CURLSH* share = [] {
+        auto* share = curl_share_init();
+        VERIFY(share);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        return share;
+    }();
+    return share;
+}
+
 Requests::NetworkError curl_code_to_network_error(int code)
 {
     switch (code) {
@@ -26,4 +26,7 @@ namespace RequestServer {
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port);
 Requests::NetworkError curl_code_to_network_error(int code);
 
+// State that all of our curl handles share, regardless of which client they belong to.
+CURLSH* shared_curl_state();
+
 }
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/CharacterTypes.h>
+#include <AK/Hex.h>
+#include <AK/Vector.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA1.h>
+#include <LibFileSystem/FileSystem.h>
+#include <RequestServer/CacheStorageBodyStore.h>
+
+namespace RequestServer {
+
+// Body IDs are chosen by the WebContent process, so we make sure that they cannot escape the storage key's directory.
+static bool is_valid_body_id(StringView body_id)
+{
+    if (body_id.is_empty() || body_id.length() > 64)
+        return false;
+    return all_of(body_id, [](auto ch) { return is_ascii_alphanumeric(ch) || ch == '-'; });
+}
+
+CacheStorageBodyStore::CacheStorageBodyStore(Optional<LexicalPath> directory)
+    : m_directory(move(directory))
+{
+}
+
+LexicalPath CacheStorageBodyStore::directory_for_storage_key(StringView storage_key) const
+{
+    // Storage keys are serialized origins, which may contain characters that are not allowed in file names.
+    auto digest = Crypto::Hash::SHA1::hash(storage_key);
+    return m_directory->append(encode_hex(digest.bytes()));
+}
+
+u64 CacheStorageBodyStore::size_of_storage_key(StringView storage_key) const
+{
+    u64 size = 0;
+
+    if (!m_directory.has_value()) {
+        if (auto bodies = m_transient_bodies.get(storage_key); bodies.has_value()) {
+            for (auto const& [body_id, transient_body] : *bodies)
+                size += transient_body.body.size();
+        }
+        return size;
+    }
+
+    auto directory = directory_for_storage_key(storage_key);
+    if (!FileSystem::is_directory(directory.string()))
+        return size;
+
+    (void)Core::Directory::for_each_entry(directory.string(), Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        if (auto file_size = FileSystem::size_from_stat(directory.append(entry.name).string()); !file_size.is_error())
+            size += file_size.value();
+        return IterationDecision::Continue;
+    });
+
+    return size;
+}
+
+ErrorOr<void> CacheStorageBodyStore::store(StringView storage_key, StringView body_id, ReadonlyBytes body)
+{
+    if (!is_valid_body_id(body_id))
+        return Error::from_string_literal("Invalid cache storage body ID");
+
+    if (size_of_storage_key(storage_key) + body.size() > QUOTA_PER_STORAGE_KEY)
+        return Error::from_string_literal("Cache storage quota exceeded");
+
+    if (!m_directory.has_value()) {
+        auto& bodies = m_transient_bodies.ensure(ByteString { storage_key });
+        bodies.set(ByteString { body_id }, { TRY(ByteBuffer::copy(body)), UnixDateTime::now() });
+        return {};
+    }
+
+    auto directory = directory_for_storage_key(storage_key);
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    auto path = directory.append(body_id).string();
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+
+    if (auto result = file->write_until_depleted(body); result.is_error()) {
+        (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+        return result.release_error();
+    }
+
+    return {};
+}
+
+Optional<ByteBuffer> CacheStorageBodyStore::retrieve(StringView storage_key, StringView body_id) const
+{
+    if (!is_valid_body_id(body_id))
+        return {};
+
+    if (!m_directory.has_value()) {
+        auto bodies = m_transient_bodies.get(storage_key);
+        if (!bodies.has_value())
+            return {};
+
+        auto transient_body = bodies->get(body_id);
+        if (!transient_body.has_value())
+            return {};
+
+        auto body = ByteBuffer::copy(transient_body->body);
+        if (body.is_error())
+            return {};
+        return body.release_value();
+    }
+
+    auto path = directory_for_storage_key(storage_key).append(body_id).string();
+
+    auto file = Core::File::open(path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return {};
+
+    auto body = file.value()->read_until_eof();
+    if (body.is_error()) {
+        dbgln("CacheStorageBodyStore: Unable to read {}: {}", path, body.error());
+        return {};
+    }
+
+    return body.release_value();
+}
+
+void CacheStorageBodyStore::remove(StringView storage_key, StringView body_id)
+{
+    if (!is_valid_body_id(body_id))
+        return;
+
+    if (!m_directory.has_value()) {
+        if (auto bodies = m_transient_bodies.get(storage_key); bodies.has_value())
+            bodies->remove(body_id);
+        return;
+    }
+
+    auto path = directory_for_storage_key(storage_key).append(body_id).string();
+    (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+}
+
+// NB: Bodies are never modified once they were stored, so their modification time is when they were stored.
+void CacheStorageBodyStore::remove_bodies_stored_since(UnixDateTime since)
+{
+    if (!m_directory.has_value()) {
+        for (auto& [storage_key, bodies] : m_transient_bodies)
+            bodies.remove_all_matching([&](auto const&, auto const& transient_body) { return transient_body.stored_time >= since; });
+        return;
+    }
+
+    if (!FileSystem::is_directory(m_directory->string()))
+        return;
+
+    Vector<ByteString> paths_to_remove;
+
+    (void)Core::Directory::for_each_entry(m_directory->string(), Core::DirIterator::SkipParentAndBaseDir, [&](auto const& storage_key_entry, auto const&) -> ErrorOr<IterationDecision> {
+        auto directory = m_directory->append(storage_key_entry.name);
+
+        TRY(Core::Directory::for_each_entry(directory.string(), Core::DirIterator::SkipParentAndBaseDir, [&](auto const& body_entry, auto const&) -> ErrorOr<IterationDecision> {
+            auto path = directory.append(body_entry.name).string();
+            auto stat = TRY(Core::System::stat(path));
+
+            if (UnixDateTime::from_seconds_since_epoch(stat.st_mtime) >= since)
+                paths_to_remove.append(move(path));
+            return IterationDecision::Continue;
+        }));
+
+        return IterationDecision::Continue;
+    });
+
+    for (auto const& path : paths_to_remove)
+        (void)FileSystem::remove(path, FileSystem::RecursionMode::Disallowed);
+}
+
+}
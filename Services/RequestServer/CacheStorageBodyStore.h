@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/LexicalPath.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+
+namespace RequestServer {
+
+// Holds the bodies of the responses that pages store with the Cache API. The request response lists that reference
+// them live in the UI process' storage jar, which would otherwise have to store every body as a text item, and send it
+// over a synchronous IPC call whenever a response is read.
+class CacheStorageBodyStore {
+public:
+    // NB: The specification does not recommend a quota for the Cache API. We limit the bodies of each storage key to the
+    //     same size as the "caches" storage bottles, so that a single site cannot fill the user's disk.
+    static constexpr u64 QUOTA_PER_STORAGE_KEY = 50 * MiB;
+
+    // Bodies are written below the given directory, or are only kept in memory if there is none.
+    explicit CacheStorageBodyStore(Optional<LexicalPath> directory);
+
+    ErrorOr<void> store(StringView storage_key, StringView body_id, ReadonlyBytes body);
+    Optional<ByteBuffer> retrieve(StringView storage_key, StringView body_id) const;
+    void remove(StringView storage_key, StringView body_id);
+
+    void remove_bodies_stored_since(UnixDateTime since);
+
+private:
+    LexicalPath directory_for_storage_key(StringView storage_key) const;
+    u64 size_of_storage_key(StringView storage_key) const;
+
+    Optional<LexicalPath> m_directory;
+
+    struct TransientBody {
+        ByteBuffer body;
+        UnixDateTime stored_time;
+    };
+    HashMap<ByteString, HashMap<ByteString, TransientBody>> m_transient_bodies;
+};
+
+}
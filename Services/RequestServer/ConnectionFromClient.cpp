@@ -5,6 +5,7 @@
  */
 
 #include <AK/IDAllocator.h>
+#include <AK/JsonObject.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Proxy.h>
@@ -16,6 +17,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/CURL.h>
+#include <RequestServer/CacheStorageBodyStore.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Request.h>
 #include <RequestServer/Resolver.h>
@@ -27,6 +29,9 @@ static HashMap<int, NonnullRefPtr<ConnectionFromClient>>* g_connections;
 static IDAllocator s_client_ids;
 
 Optional<HTTP::DiskCache> g_disk_cache;
+Optional<CacheStorageBodyStore> g_cache_storage_body_store;
+
+static constexpr long max_connections_per_host = 6;
 
 void ConnectionFromClient::set_connections(HashMap<int, NonnullRefPtr<ConnectionFromClient>>& connections)
 {
@@ -52,6 +57,11 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
     set_option(CURLMOPT_TIMERFUNCTION, &on_timeout_callback);
     set_option(CURLMOPT_TIMERDATA, this);
 
+    // Multiplex requests over a single HTTP/2 or HTTP/3 connection whenever the server allows it. Otherwise, cap how
+    // many connections we open to the same host like other browsers do, and queue the rest of the requests.
+    set_option(CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    set_option(CURLMOPT_MAX_HOST_CONNECTIONS, max_connections_per_host);
+
     m_timer = Core::Timer::create_single_shot(0, [this] {
         auto result = curl_multi_socket_action(m_curl_multi, CURL_SOCKET_TIMEOUT, 0, nullptr);
         VERIFY(result == CURLM_OK);
@@ -157,7 +167,7 @@ void ConnectionFromClient::set_dns_server(ByteString host_or_address, u16 port,
 {
     auto& dns_info = DNSInfo::the();
 
-    if (host_or_address == dns_info.server_hostname && port == dns_info.port && use_tls == dns_info.use_dns_over_tls && validate_dnssec_locally == dns_info.validate_dnssec_locally)
+    if (host_or_address == dns_info.server_hostname && port == dns_info.port && use_tls == dns_info.use_dns_over_tls && !dns_info.use_dns_over_https && validate_dnssec_locally == dns_info.validate_dnssec_locally)
         return;
 
     auto result = [&] -> ErrorOr<void> {
@@ -173,14 +183,37 @@ void ConnectionFromClient::set_dns_server(ByteString host_or_address, u16 port,
         dns_info.server_hostname = host_or_address;
         dns_info.port = port;
         dns_info.use_dns_over_tls = use_tls;
+        dns_info.use_dns_over_https = false;
         dns_info.validate_dnssec_locally = validate_dnssec_locally;
         return {};
     }();
 
-    if (result.is_error())
+    if (result.is_error()) {
         dbgln("Failed to set DNS server: {}", result.error());
-    else
+    } else {
+        m_resolver->set_dns_over_https_url({});
         m_resolver->dns.reset_connection();
+    }
+}
+
+void ConnectionFromClient::set_dns_over_https_server(ByteString host, u16 port, bool validate_dnssec_locally)
+{
+    auto& dns_info = DNSInfo::the();
+
+    if (host == dns_info.server_hostname && port == dns_info.port && dns_info.use_dns_over_https && validate_dnssec_locally == dns_info.validate_dnssec_locally)
+        return;
+
+    // NB: curl resolves the server's own hostname, so we don't need to look it up before we can use it.
+    dns_info.server_address = {};
+    dns_info.server_hostname = host;
+    dns_info.port = port;
+    dns_info.use_dns_over_tls = false;
+    dns_info.use_dns_over_https = true;
+    dns_info.validate_dnssec_locally = validate_dnssec_locally;
+
+    auto formatted_host = IPv6Address::from_string(host).has_value() ? ByteString::formatted("[{}]", host) : host;
+    m_resolver->set_dns_over_https_url(ByteString::formatted("https://{}:{}/dns-query", formatted_host, port));
+    m_resolver->dns.reset_connection();
 }
 
 void ConnectionFromClient::set_use_system_dns()
@@ -188,18 +221,115 @@ void ConnectionFromClient::set_use_system_dns()
     auto& dns_info = DNSInfo::the();
     dns_info.server_hostname = {};
     dns_info.server_address = {};
+    dns_info.use_dns_over_https = false;
 
+    m_resolver->set_dns_over_https_url({});
     m_resolver->dns.reset_connection();
 }
 
-void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(u64 request_id, ByteString method, URL::URL url, Vector<HTTP::Header> request_headers, ByteBuffer request_body, HTTP::CacheMode cache_mode, Core::ProxyData proxy_data, RequestPriority priority)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
 
-    auto request = Request::fetch(request_id, g_disk_cache, cache_mode, *this, m_curl_multi, m_resolver, move(url), move(method), HTTP::HeaderList::create(move(request_headers)), move(request_body), m_alt_svc_cache_path, proxy_data);
+    auto request = Request::fetch(request_id, g_disk_cache, cache_mode, priority, *this, m_curl_multi, m_resolver, move(url), move(method), HTTP::HeaderList::create(move(request_headers)), move(request_body), m_alt_svc_cache_path, proxy_data);
     m_active_requests.set(request_id, move(request));
 }
 
+void ConnectionFromClient::set_request_priority(u64 request_id, RequestPriority priority)
+{
+    auto request = m_active_requests.get(request_id);
+    if (!request.has_value())
+        return;
+
+    (*request)->set_priority(priority);
+    start_deferred_requests_if_possible();
+}
+
+struct NetworkFetchCounts {
+    size_t delayable { 0 };
+    size_t render_blocking { 0 };
+};
+
+// Requests below this priority do not hold up rendering, and may be held back while more important requests are loading.
+static constexpr auto minimum_non_delayable_priority = RequestPriority::Medium;
+
+// OPTIMIZATION: A document may request dozens of images before it discovers its stylesheets and scripts. Letting all of
+//               those images onto the network at once leaves render-blocking resources fighting them for bandwidth, so
+//               we limit how many delayable requests may be in flight, and limit them further while render-blocking
+//               requests are still loading.
+static constexpr size_t max_delayable_requests_in_flight = 10;
+static constexpr size_t max_delayable_requests_in_flight_while_render_blocked = 2;
+
+static NetworkFetchCounts count_network_fetches(HashMap<u64, NonnullOwnPtr<Request>> const& requests)
+{
+    NetworkFetchCounts counts;
+
+    for (auto const& [_, request] : requests) {
+        if (!request->is_fetching_from_network())
+            continue;
+
+        if (request->priority() < minimum_non_delayable_priority)
+            ++counts.delayable;
+        else if (request->priority() == RequestPriority::Highest)
+            ++counts.render_blocking;
+    }
+
+    return counts;
+}
+
+static bool has_room_for_delayable_request(NetworkFetchCounts counts)
+{
+    auto limit = counts.render_blocking > 0 ? max_delayable_requests_in_flight_while_render_blocked : max_delayable_requests_in_flight;
+    return counts.delayable < limit;
+}
+
+bool ConnectionFromClient::defer_network_fetch_if_needed(Badge<Request>, Request const& request)
+{
+    if (request.priority() >= minimum_non_delayable_priority)
+        return false;
+
+    // Requests that are already waiting go first, so that they are started in priority order.
+    if (m_deferred_requests.is_empty() && has_room_for_delayable_request(count_network_fetches(m_active_requests)))
+        return false;
+
+    m_deferred_requests.append(request.request_id());
+    return true;
+}
+
+void ConnectionFromClient::start_deferred_requests_if_possible()
+{
+    while (!m_deferred_requests.is_empty()) {
+        size_t next_index = 0;
+        Request* next_request = nullptr;
+
+        for (size_t i = 0; i < m_deferred_requests.size();) {
+            auto request = m_active_requests.get(m_deferred_requests[i]);
+
+            // The request was stopped while it was waiting.
+            if (!request.has_value()) {
+                m_deferred_requests.remove(i);
+                continue;
+            }
+
+            // A request may have been reprioritized out of the delayable range, in which case it may start right away.
+            if (!next_request || (*request)->priority() > next_request->priority()) {
+                next_index = i;
+                next_request = *request;
+            }
+
+            ++i;
+        }
+
+        if (!next_request)
+            return;
+        if (next_request->priority() < minimum_non_delayable_priority && !has_room_for_delayable_request(count_network_fetches(m_active_requests)))
+            return;
+
+        m_deferred_requests.remove(next_index);
+        next_request->start_deferred_fetch({});
+    }
+}
+
 void ConnectionFromClient::start_revalidation_request(Badge<Request>, ByteString method, URL::URL url, NonnullRefPtr<HTTP::HeaderList> request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
 {
     auto request_id = m_next_revalidation_request_id++;
@@ -294,6 +424,8 @@ void ConnectionFromClient::check_active_requests()
         auto* request = static_cast<Request*>(application_private);
         request->notify_fetch_complete({}, msg->data.result);
     }
+
+    start_deferred_requests_if_possible();
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(u64 request_id)
@@ -304,6 +436,7 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         return false;
     }
 
+    start_deferred_requests_if_possible();
     return true;
 }
 
@@ -337,6 +470,74 @@ void ConnectionFromClient::remove_cache_entries_accessed_since(UnixDateTime sinc
         g_disk_cache->remove_entries_accessed_since(since);
 }
 
+void ConnectionFromClient::store_cache_storage_body(u64 cache_storage_request_id, ByteString storage_key, ByteString body_id, ByteBuffer body)
+{
+    if (!g_cache_storage_body_store.has_value()) {
+        async_cache_storage_body_stored(cache_storage_request_id, false);
+        return;
+    }
+
+    auto result = g_cache_storage_body_store->store(storage_key, body_id, body);
+    if (result.is_error())
+        dbgln("Unable to store cache storage body {}: {}", body_id, result.error());
+
+    async_cache_storage_body_stored(cache_storage_request_id, !result.is_error());
+}
+
+void ConnectionFromClient::retrieve_cache_storage_body(u64 cache_storage_request_id, ByteString storage_key, ByteString body_id)
+{
+    Optional<ByteBuffer> body;
+
+    if (g_cache_storage_body_store.has_value())
+        body = g_cache_storage_body_store->retrieve(storage_key, body_id);
+
+    async_cache_storage_body_retrieved(cache_storage_request_id, move(body));
+}
+
+void ConnectionFromClient::remove_cache_storage_body(ByteString storage_key, ByteString body_id)
+{
+    if (g_cache_storage_body_store.has_value())
+        g_cache_storage_body_store->remove(storage_key, body_id);
+}
+
+void ConnectionFromClient::remove_cache_storage_bodies_stored_since(UnixDateTime since)
+{
+    if (g_cache_storage_body_store.has_value())
+        g_cache_storage_body_store->remove_bodies_stored_since(since);
+}
+
+void ConnectionFromClient::request_memory_report(u64 memory_report_id)
+{
+    size_t active_request_count = 0;
+    size_t revalidation_request_count = 0;
+    size_t websocket_count = 0;
+
+    for (auto const& it : *g_connections) {
+        active_request_count += it.value->m_active_requests.size();
+        revalidation_request_count += it.value->m_active_revalidation_requests.size();
+        websocket_count += it.value->m_websockets.size();
+    }
+
+    JsonObject requests;
+    requests.set("connections"sv, g_connections->size());
+    requests.set("active"sv, active_request_count);
+    requests.set("revalidations"sv, revalidation_request_count);
+    requests.set("websockets"sv, websocket_count);
+
+    JsonObject report;
+    report.set("pid"sv, Core::System::getpid());
+    report.set("requests"sv, move(requests));
+
+    if (g_disk_cache.has_value()) {
+        JsonObject disk_cache;
+        disk_cache.set("total_bytes"sv, g_disk_cache->estimated_total_size());
+        disk_cache.set("open_entries"sv, g_disk_cache->open_entry_count());
+        report.set("disk_cache"sv, move(disk_cache));
+    }
+
+    async_did_produce_memory_report(memory_report_id, move(report));
+}
+
 void ConnectionFromClient::websocket_connect(u64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, Vector<HTTP::Header> additional_request_headers)
 {
     auto host = url.serialized_host().to_byte_string();
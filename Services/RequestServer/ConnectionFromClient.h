@@ -12,6 +12,7 @@
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/Forward.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -31,6 +32,10 @@ public:
     void start_revalidation_request(Badge<Request>, ByteString method, URL::URL, NonnullRefPtr<HTTP::HeaderList> request_headers, ByteBuffer request_body, Core::ProxyData proxy_data);
     void request_complete(Badge<Request>, Request const&);
 
+    // Returns true if the request must wait for higher-priority requests to finish before it may reach the network. The
+    // request is then started via Request::start_deferred_fetch once there is room for it.
+    bool defer_network_fetch_if_needed(Badge<Request>, Request const&);
+
 private:
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
@@ -40,8 +45,10 @@ private:
 
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
+    virtual void set_dns_over_https_server(ByteString host, u16 port, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, Core::ProxyData) override;
+    virtual void start_request(u64 request_id, ByteString, URL::URL, Vector<HTTP::Header>, ByteBuffer, HTTP::CacheMode, Core::ProxyData, RequestPriority) override;
+    virtual void set_request_priority(u64 request_id, RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(u64 request_id) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(u64 request_id, ByteString, ByteString) override;
     virtual void ensure_connection(u64 request_id, URL::URL url, ::RequestServer::CacheLevel cache_level) override;
@@ -49,6 +56,13 @@ private:
     virtual void estimate_cache_size_accessed_since(u64 cache_size_estimation_id, UnixDateTime since) override;
     virtual void remove_cache_entries_accessed_since(UnixDateTime since) override;
 
+    virtual void store_cache_storage_body(u64 cache_storage_request_id, ByteString storage_key, ByteString body_id, ByteBuffer body) override;
+    virtual void retrieve_cache_storage_body(u64 cache_storage_request_id, ByteString storage_key, ByteString body_id) override;
+    virtual void remove_cache_storage_body(ByteString storage_key, ByteString body_id) override;
+    virtual void remove_cache_storage_bodies_stored_since(UnixDateTime since) override;
+
+    virtual void request_memory_report(u64 memory_report_id) override;
+
     virtual void websocket_connect(u64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, Vector<HTTP::Header>) override;
     virtual void websocket_send(u64 websocket_id, bool, ByteBuffer) override;
     virtual void websocket_close(u64 websocket_id, u16, ByteString) override;
@@ -57,6 +71,7 @@ private:
     static int on_socket_callback(void*, int sockfd, int what, void* user_data, void*);
     static int on_timeout_callback(void*, long timeout_ms, void* user_data);
     void check_active_requests();
+    void start_deferred_requests_if_possible();
 
     static ErrorOr<IPC::File> create_client_socket();
 
@@ -64,6 +79,7 @@ private:
 
     HashMap<u64, NonnullOwnPtr<Request>> m_active_requests;
     HashMap<u64, NonnullOwnPtr<Request>> m_active_revalidation_requests;
+    Vector<u64> m_deferred_requests;
     HashMap<u64, RefPtr<WebSocket::WebSocket>> m_websockets;
 
     RefPtr<Core::Timer> m_timer;
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Notifier.h>
+#include <LibCore/Timer.h>
+#include <RequestServer/CURL.h>
+#include <RequestServer/DNSOverHTTPS.h>
+#include <RequestServer/Resolver.h>
+
+namespace RequestServer {
+
+// RFC 1035 section 4.2.2: DNS messages are limited to 65535 bytes, so anything larger is not a DNS response.
+static constexpr size_t maximum_response_size = 65535;
+
+static constexpr long query_timeout_seconds = 10L;
+
+NonnullOwnPtr<DNSOverHTTPS> DNSOverHTTPS::create(ByteString url)
+{
+    return adopt_own(*new DNSOverHTTPS(move(url)));
+}
+
+DNSOverHTTPS::DNSOverHTTPS(ByteString url)
+    : m_url(move(url))
+{
+    m_curl_multi = curl_multi_init();
+
+    auto set_option = [this](auto option, auto value) {
+        auto result = curl_multi_setopt(m_curl_multi, option, value);
+        VERIFY(result == CURLM_OK);
+    };
+    set_option(CURLMOPT_SOCKETFUNCTION, &on_socket_callback);
+    set_option(CURLMOPT_SOCKETDATA, this);
+    set_option(CURLMOPT_TIMERFUNCTION, &on_timeout_callback);
+    set_option(CURLMOPT_TIMERDATA, this);
+    set_option(CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+    m_headers = curl_slist_append(m_headers, "Content-Type: application/dns-message");
+    m_headers = curl_slist_append(m_headers, "Accept: application/dns-message");
+    VERIFY(m_headers);
+
+    m_timer = Core::Timer::create_single_shot(0, [this] {
+        auto result = curl_multi_socket_action(m_curl_multi, CURL_SOCKET_TIMEOUT, 0, nullptr);
+        VERIFY(result == CURLM_OK);
+        check_completed_queries();
+    });
+}
+
+DNSOverHTTPS::~DNSOverHTTPS()
+{
+    // NB: Pending queries are dropped without invoking their callbacks, as their owner is going away with us.
+    for (auto& it : m_queries) {
+        curl_multi_remove_handle(m_curl_multi, it.key);
+        curl_easy_cleanup(it.key);
+    }
+    m_queries.clear();
+
+    m_timer = nullptr;
+    curl_multi_cleanup(m_curl_multi);
+    curl_slist_free_all(m_headers);
+}
+
+void DNSOverHTTPS::send_query(ByteBuffer query_bytes, Function<void(ErrorOr<ByteBuffer>)> on_response)
+{
+    auto* easy_handle = curl_easy_init();
+    if (!easy_handle) {
+        on_response(Error::from_string_literal("Failed to initialize curl easy handle"));
+        return;
+    }
+
+    auto query = adopt_own(*new Query { easy_handle, move(query_bytes), {}, move(on_response) });
+
+    auto set_option = [&](auto option, auto value) {
+        if (auto result = curl_easy_setopt(easy_handle, option, value); result != CURLE_OK)
+            dbgln("DNSOverHTTPS::send_query: Failed to set curl option: {}", curl_easy_strerror(result));
+    };
+
+    set_option(CURLOPT_PRIVATE, query.ptr());
+
+    set_option(CURLOPT_NOSIGNAL, 1L);
+    set_option(CURLOPT_SHARE, shared_curl_state());
+
+    if (auto const& path = default_certificate_path(); !path.is_empty())
+        set_option(CURLOPT_CAINFO, path.characters());
+
+    set_option(CURLOPT_URL, m_url.characters());
+    set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+    set_option(CURLOPT_TIMEOUT, query_timeout_seconds);
+    set_option(CURLOPT_FOLLOWLOCATION, 0L);
+
+    // OPTIMIZATION: Wait for the connection that is already being set up instead of opening one per query, so that
+    //               concurrent queries are multiplexed over it.
+    set_option(CURLOPT_PIPEWAIT, 1L);
+
+    // RFC 8484 section 4.1: The query is sent as the body of a POST request, in DNS wire format.
+    set_option(CURLOPT_POST, 1L);
+    set_option(CURLOPT_POSTFIELDSIZE, query->query.size());
+    set_option(CURLOPT_POSTFIELDS, query->query.data());
+    set_option(CURLOPT_HTTPHEADER, m_headers);
+
+    set_option(CURLOPT_WRITEFUNCTION, &on_data_received);
+    set_option(CURLOPT_WRITEDATA, query.ptr());
+
+    m_queries.set(easy_handle, move(query));
+
+    auto result = curl_multi_add_handle(m_curl_multi, easy_handle);
+    VERIFY(result == CURLM_OK);
+}
+
+size_t DNSOverHTTPS::on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data)
+{
+    auto& query = *static_cast<Query*>(user_data);
+    auto total_size = size * nmemb;
+
+    if (query.response.size() + total_size > maximum_response_size)
+        return CURL_WRITEFUNC_ERROR;
+    if (query.response.try_append(buffer, total_size).is_error())
+        return CURL_WRITEFUNC_ERROR;
+
+    return total_size;
+}
+
+int DNSOverHTTPS::on_socket_callback(CURL*, int sockfd, int what, void* user_data, void*)
+{
+    auto* transport = static_cast<DNSOverHTTPS*>(user_data);
+
+    if (what == CURL_POLL_REMOVE) {
+        transport->m_read_notifiers.remove(sockfd);
+        transport->m_write_notifiers.remove(sockfd);
+        return 0;
+    }
+
+    auto ensure_notifier = [&](auto& notifiers, Core::NotificationType type, int action) {
+        notifiers.ensure(sockfd, [&] {
+            auto notifier = Core::Notifier::construct(sockfd, type);
+            notifier->on_activation = [transport, sockfd, action] {
+                auto result = curl_multi_socket_action(transport->m_curl_multi, sockfd, action, nullptr);
+                VERIFY(result == CURLM_OK);
+
+                transport->check_completed_queries();
+            };
+
+            notifier->set_enabled(true);
+            return notifier;
+        });
+    };
+
+    if (what & CURL_POLL_IN)
+        ensure_notifier(transport->m_read_notifiers, Core::NotificationType::Read, CURL_CSELECT_IN);
+    if (what & CURL_POLL_OUT)
+        ensure_notifier(transport->m_write_notifiers, Core::NotificationType::Write, CURL_CSELECT_OUT);
+
+    return 0;
+}
+
+int DNSOverHTTPS::on_timeout_callback(CURLM*, long timeout_ms, void* user_data)
+{
+    auto* transport = static_cast<DNSOverHTTPS*>(user_data);
+    if (!transport->m_timer)
+        return 0;
+
+    if (timeout_ms < 0)
+        transport->m_timer->stop();
+    else
+        transport->m_timer->restart(timeout_ms);
+
+    return 0;
+}
+
+void DNSOverHTTPS::check_completed_queries()
+{
+    int msgs_in_queue = 0;
+    while (auto* msg = curl_multi_info_read(m_curl_multi, &msgs_in_queue)) {
+        if (msg->msg != CURLMSG_DONE)
+            continue;
+
+        auto query = m_queries.take(msg->easy_handle);
+        if (!query.has_value())
+            continue;
+
+        long status_code = 0;
+        (void)curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &status_code);
+
+        ErrorOr<ByteBuffer> response = move((*query)->response);
+        if (msg->data.result != CURLE_OK) {
+            dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: DNS-over-HTTPS query failed: {}", curl_easy_strerror(msg->data.result));
+            response = Error::from_string_literal("DNS-over-HTTPS query failed");
+        } else if (status_code != 200) {
+            response = Error::from_string_literal("DNS-over-HTTPS server did not respond with HTTP 200");
+        }
+
+        curl_multi_remove_handle(m_curl_multi, msg->easy_handle);
+        curl_easy_cleanup(msg->easy_handle);
+
+        (*query)->on_response(move(response));
+    }
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibCore/Forward.h>
+
+typedef void CURL;
+typedef void CURLM;
+struct curl_slist;
+
+namespace RequestServer {
+
+// Sends DNS queries to a DNS-over-HTTPS server (RFC 8484). All queries go through one curl multi handle, so they are
+// multiplexed over a single HTTP/2 connection that stays open between lookups.
+class DNSOverHTTPS {
+    AK_MAKE_NONCOPYABLE(DNSOverHTTPS);
+    AK_MAKE_NONMOVABLE(DNSOverHTTPS);
+
+public:
+    static NonnullOwnPtr<DNSOverHTTPS> create(ByteString url);
+    ~DNSOverHTTPS();
+
+    void send_query(ByteBuffer query, Function<void(ErrorOr<ByteBuffer>)> on_response);
+
+private:
+    explicit DNSOverHTTPS(ByteString url);
+
+    struct Query {
+        CURL* easy_handle { nullptr };
+        ByteBuffer query;
+        ByteBuffer response;
+        Function<void(ErrorOr<ByteBuffer>)> on_response;
+    };
+
+    static int on_socket_callback(CURL*, int sockfd, int what, void* user_data, void*);
+    static int on_timeout_callback(CURLM*, long timeout_ms, void* user_data);
+    static size_t on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data);
+
+    void check_completed_queries();
+
+    ByteString m_url;
+
+    CURLM* m_curl_multi { nullptr };
+    curl_slist* m_headers { nullptr };
+    HashMap<CURL*, NonnullOwnPtr<Query>> m_queries;
+
+    RefPtr<Core::Timer> m_timer;
+    HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
+    HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
+};
+
+}
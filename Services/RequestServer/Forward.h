@@ -8,6 +8,7 @@
 
 namespace RequestServer {
 
+class CacheStorageBodyStore;
 class ConnectionFromClient;
 class Request;
 class RequestPipe;
@@ -9,6 +9,7 @@
 #include <LibCore/File.h>
 #include <LibCore/MimeData.h>
 #include <LibCore/Notifier.h>
+#include <LibCore/TraceEvent.h>
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibHTTP/Cache/Utilities.h>
 #include <LibHTTP/Status.h>
@@ -25,10 +26,49 @@ extern OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
 
 static long s_connect_timeout_seconds = 90L;
 
+// Mirrors the HTTP/2 weights that other browsers use for their equivalent priorities. curl's default weight is 16.
+static long stream_weight_for_priority(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Lowest:
+        return 110L;
+    case RequestPriority::Low:
+        return 147L;
+    case RequestPriority::Medium:
+        return 183L;
+    case RequestPriority::High:
+        return 220L;
+    case RequestPriority::Highest:
+        return 256L;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// https://www.rfc-editor.org/rfc/rfc9218.html#name-urgency
+static constexpr u8 default_urgency = 3;
+
+static u8 urgency_for_priority(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Lowest:
+        return 4;
+    case RequestPriority::Low:
+        return 3;
+    case RequestPriority::Medium:
+        return 2;
+    case RequestPriority::High:
+        return 1;
+    case RequestPriority::Highest:
+        return 0;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 NonnullOwnPtr<Request> Request::fetch(
     u64 request_id,
     Optional<HTTP::DiskCache&> disk_cache,
     HTTP::CacheMode cache_mode,
+    RequestPriority priority,
     ConnectionFromClient& client,
     void* curl_multi,
     Resolver& resolver,
@@ -39,7 +79,7 @@ NonnullOwnPtr<Request> Request::fetch(
     ByteString alt_svc_cache_path,
     Core::ProxyData proxy_data)
 {
-    auto request = adopt_own(*new Request { request_id, Type::Fetch, disk_cache, cache_mode, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), move(alt_svc_cache_path), proxy_data });
+    auto request = adopt_own(*new Request { request_id, Type::Fetch, disk_cache, cache_mode, priority, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), move(alt_svc_cache_path), proxy_data });
     request->process();
 
     return request;
@@ -80,7 +120,7 @@ NonnullOwnPtr<Request> Request::revalidate(
     ByteString alt_svc_cache_path,
     Core::ProxyData proxy_data)
 {
-    auto request = adopt_own(*new Request { request_id, Type::BackgroundRevalidation, disk_cache, HTTP::CacheMode::Default, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), move(alt_svc_cache_path), proxy_data });
+    auto request = adopt_own(*new Request { request_id, Type::BackgroundRevalidation, disk_cache, HTTP::CacheMode::Default, RequestPriority::Lowest, client, curl_multi, resolver, move(url), move(method), move(request_headers), move(request_body), move(alt_svc_cache_path), proxy_data });
     request->process();
 
     return request;
@@ -91,6 +131,7 @@ Request::Request(
     Type type,
     Optional<HTTP::DiskCache&> disk_cache,
     HTTP::CacheMode cache_mode,
+    RequestPriority priority,
     ConnectionFromClient& client,
     void* curl_multi,
     Resolver& resolver,
@@ -104,6 +145,7 @@ Request::Request(
     , m_type(type)
     , m_disk_cache(disk_cache)
     , m_cache_mode(cache_mode)
+    , m_priority(priority)
     , m_client(client)
     , m_curl_multi_handle(curl_multi)
     , m_resolver(resolver)
@@ -136,6 +178,8 @@ Request::Request(
 
 Request::~Request()
 {
+    record_trace_event_for_current_state();
+
     if (!m_response_buffer.is_eof())
         dbgln("Warning: Request destroyed with buffered data (it's likely that the client disappeared or the request was cancelled)");
 
@@ -149,6 +193,10 @@ Request::~Request()
     for (auto* string_list : m_curl_string_lists)
         curl_slist_free_all(string_list);
 
+    // NB: The notifier has to stop watching the pipe before the pipe is closed.
+    if (m_client_writer_notifier)
+        m_client_writer_notifier->close();
+
     if (m_cache_entry_writer.has_value()) {
         if (m_state == State::Complete)
             (void)m_cache_entry_writer->flush(m_request_headers, m_response_headers);
@@ -166,8 +214,12 @@ void Request::notify_request_unblocked(Badge<HTTP::DiskCache>)
 
 void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code)
 {
+    record_secure_connection_statistics();
+
     if (is_revalidation_request()) {
-        if (acquire_status_code() == 304) {
+        auto status_code = acquire_status_code();
+
+        if (status_code == 304) {
             if (m_type == Type::BackgroundRevalidation && m_disk_cache->mode() == HTTP::DiskCache::Mode::Testing)
                 m_response_headers->set({ HTTP::TEST_CACHE_REVALIDATION_STATUS_HEADER, "fresh"sv });
 
@@ -176,6 +228,9 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
             return;
         }
 
+        if ((result_code != CURLE_OK || is_server_error_eligible_for_stale_response(status_code)) && serve_stale_response_if_permitted())
+            return;
+
         if (revalidation_failed().is_error())
             return;
 
@@ -188,9 +243,110 @@ void Request::notify_fetch_complete(Badge<ConnectionFromClient>, int result_code
         transition_to_state(State::Complete);
 }
 
+void Request::record_secure_connection_statistics() const
+{
+    static u64 s_secure_connections = 0;
+    static u64 s_secure_connections_with_early_data = 0;
+
+    if (!m_curl_easy_handle || m_url.scheme() != "https"sv)
+        return;
+
+    // NB: Transfers that were multiplexed onto, or reused, an existing connection did not perform a handshake at all.
+    long new_connections = 0;
+    if (curl_easy_getinfo(m_curl_easy_handle, CURLINFO_NUM_CONNECTS, &new_connections) != CURLE_OK || new_connections == 0)
+        return;
+
+    curl_off_t early_data_sent = 0;
+    if (curl_easy_getinfo(m_curl_easy_handle, CURLINFO_EARLYDATA_SENT_T, &early_data_sent) != CURLE_OK)
+        early_data_sent = 0;
+
+    ++s_secure_connections;
+    if (early_data_sent > 0)
+        ++s_secure_connections_with_early_data;
+
+    dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: {} of {} TLS connections resumed a session with early data ({}%)",
+        s_secure_connections_with_early_data, s_secure_connections, s_secure_connections_with_early_data * 100 / s_secure_connections);
+}
+
+// https://httpwg.org/specs/rfc5861.html#n-the-stale-if-error-cache-control-extension
+bool Request::is_server_error_eligible_for_stale_response(u32 status_code)
+{
+    // In this context, an error is any situation that would result in a 500, 502, 503, or 504 HTTP response status code
+    // being returned.
+    return first_is_one_of(status_code, 500u, 502u, 503u, 504u);
+}
+
+bool Request::serve_stale_response_if_permitted()
+{
+    if (m_type != Type::Fetch || !is_revalidation_request() || !m_cache_entry_reader->may_serve_stale_on_error())
+        return false;
+
+    dbgln_if(REQUESTSERVER_DEBUG, "Request::serve_stale_response_if_permitted[{}]: Revalidation failed, serving stale response for {}", m_request_id, m_url);
+
+    // NB: Reading the cache entry replaces any status and headers we received from the failed revalidation.
+    m_network_error.clear();
+    transition_to_state(State::ReadCache);
+    return true;
+}
+
+void Request::set_priority(RequestPriority priority)
+{
+    m_priority = priority;
+
+    // curl sends the new weight of an open HTTP/2 stream to the server the next time it services the connection.
+    if (m_curl_easy_handle)
+        (void)curl_easy_setopt(m_curl_easy_handle, CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(m_priority));
+}
+
+void Request::start_deferred_fetch(Badge<ConnectionFromClient>)
+{
+    VERIFY(m_state == State::WaitForNetwork);
+    transition_to_state(State::Fetch);
+}
+
+char const* Request::trace_event_name(State state)
+{
+    switch (state) {
+    case State::Init:
+        return "Request: Init";
+    case State::ReadCache:
+        return "Request: ReadCache";
+    case State::WaitForCache:
+        return "Request: WaitForCache";
+    case State::FailedCacheOnly:
+        return "Request: FailedCacheOnly";
+    case State::ServeSubstitution:
+        return "Request: ServeSubstitution";
+    case State::DNSLookup:
+        return "Request: DNSLookup";
+    case State::Connect:
+        return "Request: Connect";
+    case State::WaitForNetwork:
+        return "Request: WaitForNetwork";
+    case State::Fetch:
+        return "Request: Fetch";
+    case State::Complete:
+        return "Request: Complete";
+    case State::Error:
+        return "Request: Error";
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void Request::record_trace_event_for_current_state()
+{
+    if (!Core::is_tracing_enabled(Core::TraceCategory::Network))
+        return;
+
+    auto now = MonotonicTime::now();
+    Core::record_async_trace_event(Core::TraceCategory::Network, trace_event_name(m_state), m_request_id, m_state_start_time, now);
+    m_state_start_time = now;
+}
+
 void Request::transition_to_state(State state)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "Request::Transition[{}]: {} -> {} ({} {})", m_request_id, state_name(m_state), state_name(state), m_method, m_url);
+    record_trace_event_for_current_state();
     m_state = state;
     process();
 }
@@ -219,6 +375,9 @@ void Request::process()
     case State::Connect:
         handle_connect_state();
         break;
+    case State::WaitForNetwork:
+        // Do nothing; we are waiting for the client connection to let us proceed.
+        break;
     case State::Fetch:
         handle_fetch_state();
         break;
@@ -420,17 +579,27 @@ void Request::handle_dns_lookup_state()
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = dns_info.validate_dnssec_locally })
         ->when_rejected([this, host](auto const& error) {
             dbgln("Request::handle_dns_lookup_state: DNS lookup failed for '{}': {}", host, error);
+            if (serve_stale_response_if_permitted())
+                return;
+
             m_network_error = Requests::NetworkError::UnableToResolveHost;
             transition_to_state(State::Error);
         })
         .when_resolved([this, host](NonnullRefPtr<DNS::LookupResult const> dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("Request::handle_dns_lookup_state: DNS lookup failed for '{}'", host);
+                if (serve_stale_response_if_permitted())
+                    return;
+
                 m_network_error = Requests::NetworkError::UnableToResolveHost;
                 transition_to_state(State::Error);
             } else if (m_type == Type::Fetch || m_type == Type::BackgroundRevalidation) {
                 m_dns_result = move(dns_result);
-                transition_to_state(State::Fetch);
+
+                if (m_type == Type::Fetch && m_client.defer_network_fetch_if_needed({}, *this))
+                    transition_to_state(State::WaitForNetwork);
+                else
+                    transition_to_state(State::Fetch);
             } else {
                 transition_to_state(State::Complete);
             }
@@ -453,6 +622,11 @@ void Request::handle_connect_state()
     set_option(CURLOPT_PRIVATE, this);
 
     set_option(CURLOPT_NOSIGNAL, 1L);
+    set_option(CURLOPT_SHARE, shared_curl_state());
+
+    // NB: Without verifying the certificate, the TLS session we warm up here couldn't be resumed by later requests.
+    if (auto const& path = default_certificate_path(); !path.is_empty())
+        set_option(CURLOPT_CAINFO, path.characters());
 
     set_option(CURLOPT_URL, m_url.to_byte_string().characters());
     set_option(CURLOPT_PORT, m_url.port_or_default());
@@ -489,6 +663,7 @@ void Request::handle_fetch_state()
     set_option(CURLOPT_PRIVATE, this);
 
     set_option(CURLOPT_NOSIGNAL, 1L);
+    set_option(CURLOPT_SHARE, shared_curl_state());
 
     if (auto const& path = default_certificate_path(); !path.is_empty())
         set_option(CURLOPT_CAINFO, path.characters());
@@ -498,6 +673,7 @@ void Request::handle_fetch_state()
     set_option(CURLOPT_PORT, m_url.port_or_default());
     set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
     set_option(CURLOPT_PIPEWAIT, 1L);
+    set_option(CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(m_priority));
     set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
     set_option(CURLOPT_CUSTOMREQUEST, m_method.characters());
@@ -506,11 +682,21 @@ void Request::handle_fetch_state()
         set_option(CURLOPT_VERBOSE, 1);
     }
 
+    long ssl_options = 0;
 #if defined(AK_OS_WINDOWS)
     // Without explicitly using the OS Native CA cert store on Windows, https requests timeout with CURLE_PEER_FAILED_VERIFICATION
-    set_option(CURLOPT_SSL_OPTIONS, CURLSSLOPT_NATIVE_CA);
+    ssl_options |= CURLSSLOPT_NATIVE_CA;
 #endif
 
+    // OPTIMIZATION: When a TLS 1.3 session is resumed, let curl send the request as early data instead of waiting a round
+    //               trip for the handshake to complete. Early data may be replayed by an attacker, so we only allow it
+    //               for safe methods without a body (RFC 8470 section 2.1).
+    if (m_method.is_one_of("GET"sv, "HEAD"sv) && m_request_body.is_empty())
+        ssl_options |= CURLSSLOPT_EARLYDATA;
+
+    if (ssl_options != 0)
+        set_option(CURLOPT_SSL_OPTIONS, ssl_options);
+
     curl_slist* curl_headers = nullptr;
 
     if (m_method.is_one_of("POST"sv, "PUT"sv, "PATCH"sv, "DELETE"sv)) {
@@ -555,6 +741,15 @@ void Request::handle_fetch_state()
         }
     }
 
+    // HTTP/3 has no stream weights, so also signal the priority with an RFC 9218 Priority header. Servers that do not
+    // understand it ignore it. We only send it over TLS, which is the only place curl negotiates HTTP/2 or HTTP/3.
+    if (m_url.scheme() == "https"sv && !m_request_headers->contains("Priority"sv)) {
+        if (auto urgency = urgency_for_priority(m_priority); urgency != default_urgency) {
+            auto header_string = ByteString::formatted("Priority: u={}", urgency);
+            curl_headers = curl_slist_append(curl_headers, header_string.characters());
+        }
+    }
+
     if (curl_headers) {
         set_option(CURLOPT_HTTPHEADER, curl_headers);
         m_curl_string_lists.append(curl_headers);
@@ -660,11 +855,21 @@ size_t Request::on_header_received(void* buffer, size_t size, size_t nmemb, void
     return total_size;
 }
 
+// We pause the transfer once this much data is waiting to be sent to the client, and resume it once the client has
+// caught up enough. This keeps memory use bounded when the client reads slower than the network delivers.
+static constexpr size_t pause_transfer_buffered_byte_count = 8 * MiB;
+static constexpr size_t resume_transfer_buffered_byte_count = 1 * MiB;
+
 size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void* user_data)
 {
     auto& request = *static_cast<Request*>(user_data);
 
     if (request.is_revalidation_request()) {
+        // If the server failed and the cached response permits it, we abort the transfer here and serve the stale
+        // response once curl has finished with the request.
+        if (request.m_type == Type::Fetch && request.m_cache_entry_reader->may_serve_stale_on_error() && is_server_error_eligible_for_stale_response(request.acquire_status_code()))
+            return CURL_WRITEFUNC_ERROR;
+
         // If we arrive here, we did not receive an HTTP 304 response code. We must remove the cache entry and inform
         // the client of the new response headers and data.
         if (request.revalidation_failed().is_error())
@@ -683,6 +888,12 @@ size_t Request::on_data_received(void* buffer, size_t size, size_t nmemb, void*
 
     request.transfer_headers_to_client_if_needed();
 
+    // NB: Curl will hand us the same data again once we resume the transfer.
+    if (request.m_type != Type::BackgroundRevalidation && request.m_response_buffer.used_buffer_size() >= pause_transfer_buffered_byte_count) {
+        request.m_transfer_paused = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+
     auto total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
@@ -759,25 +970,33 @@ void Request::transfer_headers_to_client_if_needed()
 
 ErrorOr<void> Request::write_queued_bytes_without_blocking()
 {
-    Vector<u8> bytes_to_send;
-    bytes_to_send.resize(m_response_buffer.used_buffer_size());
-    m_response_buffer.peek_some(bytes_to_send);
+    // OPTIMIZATION: Only copy out as much of the queue as the socket can plausibly take in one go. Copying the whole queue
+    //               each time would make streaming a large response to a slow client quadratic.
+    static constexpr size_t buffer_size = 256 * KiB;
+    static u8 buffer[buffer_size];
+
+    auto peek_queued_bytes = [&]() -> ReadonlyBytes {
+        Bytes bytes_to_send { buffer, min(m_response_buffer.used_buffer_size(), buffer_size) };
+        m_response_buffer.peek_some(bytes_to_send);
+        return bytes_to_send;
+    };
 
-    auto write_bytes_to_disk_cache = [&](size_t byte_count) {
+    auto write_bytes_to_disk_cache = [&](ReadonlyBytes bytes_to_write) {
         if (!m_cache_entry_writer.has_value())
             return;
 
-        auto bytes_to_write = bytes_to_send.span().slice(0, byte_count);
-
         if (m_cache_entry_writer->write_data(bytes_to_write).is_error())
             m_cache_entry_writer.clear();
     };
 
     if (m_type == Type::BackgroundRevalidation) {
-        write_bytes_to_disk_cache(bytes_to_send.size());
-        MUST(m_response_buffer.discard(bytes_to_send.size()));
+        while (!m_response_buffer.is_eof()) {
+            auto bytes_to_send = peek_queued_bytes();
+            write_bytes_to_disk_cache(bytes_to_send);
+            MUST(m_response_buffer.discard(bytes_to_send.size()));
+        }
 
-        if (m_response_buffer.is_eof() && m_curl_result_code.has_value())
+        if (m_curl_result_code.has_value())
             transition_to_state(State::Complete);
 
         return {};
@@ -793,23 +1012,37 @@ ErrorOr<void> Request::write_queued_bytes_without_blocking()
         };
     }
 
-    auto result = m_client_request_pipe->write(bytes_to_send);
-    if (result.is_error()) {
-        if (!first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
-            return result.release_error();
+    while (!m_response_buffer.is_eof()) {
+        auto bytes_to_send = peek_queued_bytes();
 
-        m_client_writer_notifier->set_enabled(true);
-        return {};
-    }
+        auto result = m_client_request_pipe->write(bytes_to_send);
+        if (result.is_error()) {
+            if (!first_is_one_of(result.error().code(), EAGAIN, EWOULDBLOCK))
+                return result.release_error();
+            break;
+        }
+
+        write_bytes_to_disk_cache(bytes_to_send.slice(0, result.value()));
+        MUST(m_response_buffer.discard(result.value()));
 
-    write_bytes_to_disk_cache(result.value());
-    MUST(m_response_buffer.discard(result.value()));
+        m_bytes_transferred_to_client += result.value();
 
-    m_bytes_transferred_to_client += result.value();
+        // The socket is full, so we'll wait for the notifier to tell us when we can write more.
+        if (result.value() < bytes_to_send.size())
+            break;
+    }
 
     m_client_writer_notifier->set_enabled(!m_response_buffer.is_eof());
-    if (m_response_buffer.is_eof() && m_curl_result_code.has_value())
+    if (m_response_buffer.is_eof() && m_curl_result_code.has_value()) {
         transition_to_state(State::Complete);
+        return {};
+    }
+
+    // NB: Resuming the transfer may call on_data_received() right away, so this has to come last.
+    if (m_transfer_paused && m_response_buffer.used_buffer_size() <= resume_transfer_buffered_byte_count) {
+        m_transfer_paused = false;
+        curl_easy_pause(m_curl_easy_handle, CURLPAUSE_CONT);
+    }
 
     return {};
 }
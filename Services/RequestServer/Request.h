@@ -22,6 +22,7 @@
 #include <RequestServer/CacheLevel.h>
 #include <RequestServer/Forward.h>
 #include <RequestServer/RequestPipe.h>
+#include <RequestServer/RequestPriority.h>
 
 struct curl_slist;
 
@@ -33,6 +34,7 @@ public:
         u64 request_id,
         Optional<HTTP::DiskCache&> disk_cache,
         HTTP::CacheMode cache_mode,
+        RequestPriority priority,
         ConnectionFromClient& client,
         void* curl_multi,
         Resolver& resolver,
@@ -75,6 +77,12 @@ public:
     u64 request_id() const { return m_request_id; }
     Type type() const { return m_type; }
 
+    RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestPriority);
+
+    bool is_fetching_from_network() const { return m_state == State::Fetch && !m_curl_result_code.has_value(); }
+    void start_deferred_fetch(Badge<ConnectionFromClient>);
+
     virtual void notify_request_unblocked(Badge<HTTP::DiskCache>) override;
     void notify_fetch_complete(Badge<ConnectionFromClient>, int result_code);
 
@@ -87,6 +95,7 @@ private:
         ServeSubstitution, // Serve content from a local file substitution.
         DNSLookup,         // Resolve the URL's host.
         Connect,           // Issue a network request to connect to the URL.
+        WaitForNetwork,    // Wait for higher-priority requests to make room for this one on the network.
         Fetch,             // Issue a network request to fetch the URL.
         Complete,          // Finalize the request with the client.
         Error,             // Any error occured during the request's lifetime.
@@ -109,6 +118,8 @@ private:
             return "DNSLookup"sv;
         case State::Connect:
             return "Connect"sv;
+        case State::WaitForNetwork:
+            return "WaitForNetwork"sv;
         case State::Fetch:
             return "Fetch"sv;
         case State::Complete:
@@ -124,6 +135,7 @@ private:
         Type type,
         Optional<HTTP::DiskCache&> disk_cache,
         HTTP::CacheMode cache_mode,
+        RequestPriority priority,
         ConnectionFromClient& client,
         void* curl_multi,
         Resolver& resolver,
@@ -164,17 +176,26 @@ private:
     virtual bool is_revalidation_request() const override;
     ErrorOr<void> revalidation_failed();
 
+    static bool is_server_error_eligible_for_stale_response(u32 status_code);
+    void record_secure_connection_statistics() const;
+    bool serve_stale_response_if_permitted();
+
     bool is_cache_only_request() const;
 
+    static char const* trace_event_name(State);
+    void record_trace_event_for_current_state();
+
     u32 acquire_status_code() const;
     Requests::RequestTimingInfo acquire_timing_info() const;
 
     u64 m_request_id { 0 };
     Type m_type { Type::Fetch };
     State m_state { State::Init };
+    MonotonicTime m_state_start_time { MonotonicTime::now() };
 
     Optional<HTTP::DiskCache&> m_disk_cache;
     HTTP::CacheMode m_cache_mode { HTTP::CacheMode::Default };
+    RequestPriority m_priority { RequestPriority::Medium };
     ConnectionFromClient& m_client;
 
     void* m_curl_multi_handle { nullptr };
@@ -205,6 +226,7 @@ private:
     RefPtr<Core::Notifier> m_client_writer_notifier;
     Optional<RequestPipe> m_client_request_pipe;
     size_t m_bytes_transferred_to_client { 0 };
+    bool m_transfer_paused { false };
 
     Optional<Requests::NetworkError> m_network_error;
 };
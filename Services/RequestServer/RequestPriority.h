@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+enum class RequestPriority : u8 {
+    Lowest,  // Speculative fetches that may never be used, e.g. prefetches.
+    Low,     // Resources that do not block rendering, e.g. images and media.
+    Medium,  // Resources with no better classification.
+    High,    // Resources that block parsing, e.g. scripts, fonts, and fetch() calls.
+    Highest, // Resources that block rendering, e.g. documents and stylesheets.
+};
+
+}
@@ -77,4 +77,18 @@ Resolver::Resolver(Function<ErrorOr<DNS::Resolver::SocketResult>()> create_socke
 {
 }
 
+void Resolver::set_dns_over_https_url(Optional<ByteString> url)
+{
+    dns.set_https_transport({});
+    m_dns_over_https = nullptr;
+
+    if (!url.has_value())
+        return;
+
+    m_dns_over_https = DNSOverHTTPS::create(url.release_value());
+    dns.set_https_transport([this](ByteBuffer query, Function<void(ErrorOr<ByteBuffer>)> on_response) {
+        m_dns_over_https->send_query(move(query), move(on_response));
+    });
+}
+
 }
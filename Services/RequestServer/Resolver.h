@@ -8,10 +8,12 @@
 #pragma once
 
 #include <AK/Optional.h>
+#include <AK/OwnPtr.h>
 #include <AK/RefCounted.h>
 #include <AK/Weakable.h>
 #include <LibCore/Forward.h>
 #include <LibDNS/Resolver.h>
+#include <RequestServer/DNSOverHTTPS.h>
 
 namespace RequestServer {
 
@@ -22,6 +24,7 @@ struct DNSInfo {
     Optional<ByteString> server_hostname;
     u16 port { 0 };
     bool use_dns_over_tls { true };
+    bool use_dns_over_https { false };
     bool validate_dnssec_locally { false };
 
 private:
@@ -33,10 +36,16 @@ struct Resolver
     , public Weakable<Resolver> {
     static NonnullRefPtr<Resolver> default_resolver();
 
+    // Sends all lookups to the given DNS-over-HTTPS endpoint, or goes back to the configured socket if there is none.
+    void set_dns_over_https_url(Optional<ByteString>);
+
     DNS::Resolver dns;
 
 private:
     explicit Resolver(Function<ErrorOr<DNS::Resolver::SocketResult>()> create_socket);
+
+    // NB: This must be destroyed before the DNS resolver, which is handed the responses to its queries.
+    OwnPtr<DNSOverHTTPS> m_dns_over_https;
 };
 
 ByteString const& default_certificate_path();
@@ -16,6 +16,7 @@
 #include <LibHTTP/Cache/DiskCache.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
+#include <RequestServer/CacheStorageBodyStore.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/Resolver.h>
 #include <RequestServer/ResourceSubstitutionMap.h>
@@ -27,6 +28,7 @@
 namespace RequestServer {
 
 extern Optional<HTTP::DiskCache> g_disk_cache;
+extern Optional<CacheStorageBodyStore> g_cache_storage_body_store;
 OwnPtr<ResourceSubstitutionMap> g_resource_substitution_map;
 
 }
@@ -46,14 +48,18 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     Vector<ByteString> certificates;
     StringView mach_server_name;
     StringView http_disk_cache_mode;
+    u64 http_disk_cache_size_in_mib = HTTP::DiskCache::DEFAULT_MAXIMUM_SIZE / MiB;
     StringView resource_map_path;
+    StringView cache_storage_path;
     bool wait_for_debugger = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
     args_parser.add_option(http_disk_cache_mode, "HTTP disk cache mode", "http-disk-cache-mode", 0, "mode");
+    args_parser.add_option(http_disk_cache_size_in_mib, "Maximum size of the HTTP disk cache in MiB", "http-disk-cache-size", 0, "size");
     args_parser.add_option(resource_map_path, "Path to JSON file mapping URLs to local files", "resource-map", 0, "path");
+    args_parser.add_option(cache_storage_path, "Path to store Cache API response bodies in, instead of keeping them in memory", "cache-storage-path", 0, "path");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.parse(arguments);
 
@@ -99,12 +105,17 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             return Error::from_string_literal("Unrecognized disk cache mode");
         }());
 
-        if (auto cache = HTTP::DiskCache::create(mode); cache.is_error())
+        if (auto cache = HTTP::DiskCache::create(mode, http_disk_cache_size_in_mib * MiB); cache.is_error())
             warnln("Unable to create disk cache: {}", cache.error());
         else
             RequestServer::g_disk_cache = cache.release_value();
     }
 
+    if (cache_storage_path.is_empty())
+        RequestServer::g_cache_storage_body_store = RequestServer::CacheStorageBodyStore { {} };
+    else
+        RequestServer::g_cache_storage_body_store = RequestServer::CacheStorageBodyStore { LexicalPath { cache_storage_path } };
+
     // Connections are stored on the stack to ensure they are destroyed before
     // static destruction begins. This prevents crashes from notifiers trying to
     // unregister from already-destroyed thread data during process exit.
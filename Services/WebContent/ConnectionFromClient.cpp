@@ -9,13 +9,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/System.h>
 #include <LibGC/Heap.h>
+#include <LibGC/HeapBlock.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
@@ -25,6 +28,7 @@
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/Parser/ErrorReporter.h>
 #include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/CookieStore/CookieStore.h>
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/CharacterData.h>
@@ -37,6 +41,8 @@
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/BrowsingContext.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
+#include <LibWeb/HTML/ListOfAvailableImages.h>
+#include <LibWeb/HTML/Scripting/PythonEngine.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
@@ -48,6 +54,7 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Loader/UserAgent.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Painting/BackingStoreManager.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
@@ -1021,6 +1028,47 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static JsonArray serialize_allocator_statistics(GC::HeapStatistics const& statistics)
+{
+    JsonArray allocators;
+    for (auto const& allocator : statistics.allocators) {
+        JsonObject allocator_object;
+        if (allocator.class_name.is_null())
+            allocator_object.set("class_name"sv, JsonValue {});
+        else
+            allocator_object.set("class_name"sv, allocator.class_name);
+        allocator_object.set("cell_size"sv, allocator.cell_size);
+        allocator_object.set("live_cells"sv, allocator.live_cells);
+        allocator_object.set("free_cells"sv, allocator.free_cells);
+        allocator_object.set("live_bytes"sv, allocator.live_bytes());
+        allocator_object.set("block_count"sv, allocator.block_count);
+        allocator_object.set("reserved_block_count"sv, allocator.reserved_block_count);
+        allocators.must_append(move(allocator_object));
+    }
+    return allocators;
+}
+
+static void append_heap_statistics(StringBuilder& builder)
+{
+    auto statistics = Web::Bindings::main_thread_vm().heap().statistics();
+
+    JsonObject last_collection;
+    last_collection.set("mark_us"sv, statistics.last_collection.mark.to_microseconds());
+    last_collection.set("finalize_us"sv, statistics.last_collection.finalize.to_microseconds());
+    last_collection.set("sweep_us"sv, statistics.last_collection.sweep.to_microseconds());
+
+    JsonArray pause_histogram;
+    for (auto count : statistics.pause_histogram)
+        pause_histogram.must_append(count);
+
+    JsonObject heap_statistics;
+    heap_statistics.set("allocators"sv, serialize_allocator_statistics(statistics));
+    heap_statistics.set("collection_count"sv, statistics.collection_count);
+    heap_statistics.set("last_collection"sv, move(last_collection));
+    heap_statistics.set("pause_histogram"sv, move(pause_histogram));
+    heap_statistics.serialize(builder);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -1059,6 +1107,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::HeapStatistics)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_heap_statistics(builder);
+    }
+
     auto buffer = MUST(Core::AnonymousBuffer::create_with_size(builder.length()));
     memcpy(buffer.data<void>(), builder.string_view().characters_without_null_termination(), builder.length());
     async_did_get_internal_page_info(page_id, type, buffer);
@@ -1248,8 +1302,10 @@ void ConnectionFromClient::request_file(u64 page_id, Web::FileRequest file_reque
 
 void ConnectionFromClient::set_system_visibility_state(u64 page_id, Web::HTML::VisibilityState visibility_state)
 {
-    if (auto page = this->page(page_id); page.has_value())
+    if (auto page = this->page(page_id); page.has_value()) {
         page->page().top_level_traversable()->set_system_visibility_state(visibility_state);
+        page->set_is_hidden(visibility_state == Web::HTML::VisibilityState::Hidden);
+    }
 }
 
 void ConnectionFromClient::reset_zoom(u64 page_id)
@@ -1357,6 +1413,113 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::memory_pressure_changed(WebView::MemoryPressureLevel level)
+{
+    if (level == WebView::MemoryPressureLevel::None)
+        return;
+
+    // Everything dropped here is a cache, and is recreated on demand.
+    Web::Fetch::Fetching::clear_http_memory_cache();
+    Gfx::FontDatabase::the().purge_caches();
+
+    m_page_host->for_each_page([&](PageClient& page_client) {
+        auto traversable = page_client.page().top_level_traversable();
+
+        if (auto skia_backend_context = traversable->skia_backend_context())
+            skia_backend_context->purge_unused_resources();
+
+        traversable->prune_back_forward_cache(0);
+
+        // Hidden pages reallocate their backing stores once they become visible again.
+        if (level == WebView::MemoryPressureLevel::Critical && traversable->system_visibility_state() == Web::HTML::VisibilityState::Hidden)
+            traversable->backing_store_manager().release_backing_stores();
+    });
+
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([] {
+        Web::Bindings::main_thread_vm().heap().collect_garbage(GC::Heap::CollectionType::CollectGarbage);
+    });
+}
+
+void ConnectionFromClient::request_memory_report(u64 memory_report_id)
+{
+    auto heap_statistics = Web::Bindings::main_thread_vm().heap().statistics();
+
+    size_t gc_live_bytes = 0;
+    size_t gc_block_count = 0;
+    for (auto const& allocator : heap_statistics.allocators) {
+        gc_live_bytes += allocator.live_bytes();
+        gc_block_count += allocator.block_count;
+    }
+
+    JsonObject gc_heap;
+    gc_heap.set("live_bytes"sv, gc_live_bytes);
+    gc_heap.set("block_bytes"sv, gc_block_count * GC::HeapBlock::BLOCK_SIZE);
+    gc_heap.set("allocators"sv, serialize_allocator_statistics(heap_statistics));
+
+    JsonArray documents;
+    for (auto navigable : Web::HTML::all_navigables()) {
+        auto document = navigable->active_document();
+        if (!document)
+            continue;
+
+        size_t dom_node_count = 0;
+        document->for_each_shadow_including_inclusive_descendant([&](auto&) {
+            ++dom_node_count;
+            return TraversalDecision::Continue;
+        });
+
+        size_t layout_node_count = 0;
+        if (auto* layout_root = document->layout_node()) {
+            layout_root->for_each_in_inclusive_subtree([&](auto&) {
+                ++layout_node_count;
+                return TraversalDecision::Continue;
+            });
+        }
+
+        JsonObject document_object;
+        document_object.set("url"sv, document->url().serialize());
+        document_object.set("dom_nodes"sv, dom_node_count);
+        document_object.set("layout_nodes"sv, layout_node_count);
+        document_object.set("style_sheets"sv, document->style_sheets().length());
+        document_object.set("available_images"sv, document->list_of_available_images().size());
+        documents.must_append(move(document_object));
+    }
+
+    auto http_cache_statistics = Web::Fetch::Fetching::http_memory_cache_statistics();
+
+    JsonObject http_memory_cache;
+    http_memory_cache.set("partitions"sv, http_cache_statistics.partition_count);
+    http_memory_cache.set("entries"sv, http_cache_statistics.entry_count);
+    http_memory_cache.set("pending_entries"sv, http_cache_statistics.pending_entry_count);
+    http_memory_cache.set("body_bytes"sv, http_cache_statistics.body_size);
+
+    auto font_cache_statistics = Gfx::FontDatabase::the().cache_statistics();
+
+    JsonObject font_cache;
+    font_cache.set("fonts"sv, font_cache_statistics.cached_font_count);
+    font_cache.set("code_point_fallbacks"sv, font_cache_statistics.code_point_fallback_count);
+
+    JsonObject report;
+    report.set("pid"sv, Core::System::getpid());
+    report.set("gc_heap"sv, move(gc_heap));
+    report.set("documents"sv, move(documents));
+    report.set("http_memory_cache"sv, move(http_memory_cache));
+    report.set("font_cache"sv, move(font_cache));
+
+    if (auto python_statistics = Web::HTML::PythonEngine::memory_statistics(); python_statistics.has_value()) {
+        JsonObject python_heap;
+        python_heap.set("allocated_blocks"sv, python_statistics->allocated_blocks);
+        if (python_statistics->traced_bytes.has_value())
+            python_heap.set("traced_bytes"sv, *python_statistics->traced_bytes);
+        if (python_statistics->peak_traced_bytes.has_value())
+            python_heap.set("peak_traced_bytes"sv, *python_statistics->peak_traced_bytes);
+        report.set("python_heap"sv, move(python_heap));
+    }
+
+    async_did_produce_memory_report(memory_report_id, move(report));
+}
+
 void ConnectionFromClient::set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -163,6 +163,9 @@ private:
 
     virtual void system_time_zone_changed() override;
 
+    virtual void memory_pressure_changed(WebView::MemoryPressureLevel) override;
+    virtual void request_memory_report(u64 memory_report_id) override;
+
     virtual void set_document_cookie_version_buffer(u64 page_id, Core::AnonymousBuffer document_cookie_version_buffer) override;
     virtual void set_document_cookie_version_index(u64 page_id, i64 document_id, Core::SharedVersionIndex document_index) override;
     virtual void cookies_changed(u64 page_id, Vector<Web::Cookie::Cookie>) override;
@@ -71,12 +71,7 @@ PageClient::PageClient(PageHost& owner, u64 id)
 {
     setup_palette();
 
-    // FIXME: This removes the decimal part, so the refresh interval will actually be higher than the maximum FPS.
-    //        For example, 60 FPS = 1000ms / 60 = 16.6666...ms, but it will become 16ms, making the interval equivalent
-    //        to 62.5 FPS.
-    int refresh_interval = static_cast<int>(1000.0 / m_maximum_frames_per_second);
-
-    m_paint_refresh_timer = Core::Timer::create_repeating(refresh_interval, [] {
+    m_paint_refresh_timer = Core::Timer::create_repeating(paint_refresh_interval(), [] {
         Web::HTML::main_thread_event_loop().queue_task_to_update_the_rendering();
     });
 
@@ -225,17 +220,35 @@ void PageClient::set_device_pixel_ratio(double device_pixel_ratio)
     }
 }
 
-void PageClient::set_maximum_frames_per_second(u64 maximum_frames_per_second)
+int PageClient::paint_refresh_interval() const
 {
-    m_maximum_frames_per_second = maximum_frames_per_second;
+    // NB: Hidden pages don't have rendering opportunities, so there is no point in waking up for every frame.
+    if (m_is_hidden)
+        return 1000;
 
     // FIXME: This removes the decimal part, so the refresh interval will actually be higher than the maximum FPS.
     //        For example, 60 FPS = 1000ms / 60 = 16.6666...ms, but it will become 16ms, making the interval equivalent
     //        to 62.5 FPS.
-    int refresh_interval = static_cast<int>(1000.0 / m_maximum_frames_per_second);
+    return static_cast<int>(1000.0 / m_maximum_frames_per_second);
+}
+
+void PageClient::set_maximum_frames_per_second(u64 maximum_frames_per_second)
+{
+    m_maximum_frames_per_second = maximum_frames_per_second;
+
+    VERIFY(m_paint_refresh_timer);
+    m_paint_refresh_timer->set_interval(paint_refresh_interval());
+}
+
+void PageClient::set_is_hidden(bool is_hidden)
+{
+    if (m_is_hidden == is_hidden)
+        return;
+    m_is_hidden = is_hidden;
 
+    // NB: Restarting the timer keeps a page that becomes visible again from waiting out the slow refresh interval.
     VERIFY(m_paint_refresh_timer);
-    m_paint_refresh_timer->set_interval(refresh_interval);
+    m_paint_refresh_timer->restart(paint_refresh_interval());
 }
 
 void PageClient::page_did_request_cursor_change(Gfx::Cursor const& cursor)
@@ -726,6 +739,11 @@ void PageClient::page_did_allocate_backing_stores(i32 front_bitmap_id, Gfx::Shar
     client().async_did_allocate_backing_stores(m_id, front_bitmap_id, front_bitmap, back_bitmap_id, back_bitmap);
 }
 
+void PageClient::page_did_release_backing_stores()
+{
+    client().async_did_release_backing_stores(m_id);
+}
+
 IPC::File PageClient::request_worker_agent(Web::Bindings::AgentType type)
 {
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::RequestWorkerAgent>(m_id, type);
@@ -25,6 +25,7 @@ public:
     virtual ~PageHost();
 
     Optional<PageClient&> page(u64 index);
+    void for_each_page(Function<void(PageClient&)> const&);
     PageClient& create_page();
     void remove_page(Badge<PageClient>, u64 index);
 
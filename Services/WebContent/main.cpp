@@ -202,9 +202,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     TRY(initialize_resource_loader(Web::Bindings::main_thread_vm().heap(), request_server_socket));
 
-    // Initialize Python engine for <script type="text/python"> support
-    Web::Bindings::initialize_python_engine();
-
+    // The Python engine is initialized on demand by the first <script type="text/python">.
     // Set up cleanup handler for Python engine
     auto cleanup_handler = []() {
         Web::Bindings::shutdown_python_engine();
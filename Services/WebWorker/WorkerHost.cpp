@@ -15,6 +15,7 @@
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/Scripting/EnvironmentSettingsSnapshot.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
+#include <LibWeb/HTML/Scripting/PythonScript.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Scripting/WorkerEnvironmentSettingsObject.h>
 #include <LibWeb/HTML/SharedWorkerGlobalScope.h>
@@ -234,6 +235,9 @@ void WorkerHost::run(GC::Ref<Web::Page> page, Web::HTML::TransferDataEncoder mes
         //     Otherwise, it is a module script; run the module script script.
         if (auto* classic_script = as_if<Web::HTML::ClassicScript>(*script))
             (void)classic_script->run();
+        // NON-STANDARD: Python worker scripts are fetched like classic scripts, but run on the worker's own interpreter.
+        else if (auto* python_script = as_if<Web::HTML::PythonScript>(*script))
+            (void)python_script->run();
         else
             (void)as<Web::HTML::JavaScriptModuleScript>(*script).run();
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Arena.h>
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/Vector.h>
+
+TEST_CASE(make_constructs_in_place)
+{
+    Arena<> arena;
+    auto& string = arena.make<ByteString>("Hello, friends!"sv);
+    auto& number = arena.make<int>(42);
+    EXPECT_EQ(string, "Hello, friends!"sv);
+    EXPECT_EQ(number, 42);
+}
+
+TEST_CASE(objects_are_destroyed_in_reverse_order)
+{
+    struct Recorder {
+        Recorder(Vector<int>& order, int id)
+            : order(order)
+            , id(id)
+        {
+        }
+        ~Recorder() { order.append(id); }
+
+        Vector<int>& order;
+        int id { 0 };
+    };
+
+    Vector<int> order;
+    {
+        Arena<> arena;
+        for (int i = 0; i < 3; ++i)
+            (void)arena.make<Recorder>(order, i);
+        EXPECT(order.is_empty());
+    }
+    EXPECT_EQ(order, (Vector<int> { 2, 1, 0 }));
+}
+
+TEST_CASE(clear_allows_reuse)
+{
+    Arena<> arena;
+    (void)arena.make<ByteString>("first"sv);
+    arena.clear();
+
+    auto& string = arena.make<ByteString>("second"sv);
+    EXPECT_EQ(string, "second"sv);
+}
+
+TEST_CASE(many_and_large_allocations)
+{
+    Arena<1 * KiB> arena;
+
+    Vector<u64*> small_values;
+    for (u64 i = 0; i < 1000; ++i)
+        small_values.append(&arena.make<u64>(i));
+
+    auto* large = static_cast<u8*>(arena.allocate(64 * KiB, 64));
+    EXPECT_EQ(reinterpret_cast<FlatPtr>(large) % 64, 0u);
+    __builtin_memset(large, 0xaa, 64 * KiB);
+
+    for (u64 i = 0; i < 1000; ++i)
+        EXPECT_EQ(*small_values[i], i);
+}
+
+TEST_CASE(copy_span)
+{
+    Arena<> arena;
+    Array<u32, 4> values { 1, 2, 3, 4 };
+    auto copy = arena.copy<u32>(values.span());
+    values.fill(0);
+    EXPECT_EQ(copy.size(), 4u);
+    EXPECT_EQ(copy[0], 1u);
+    EXPECT_EQ(copy[3], 4u);
+}
@@ -6,9 +6,12 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Array.h>
 #include <AK/FlyString.h>
 #include <AK/String.h>
 #include <AK/Try.h>
+#include <AK/Vector.h>
+#include <pthread.h>
 
 TEST_CASE(empty_string)
 {
@@ -134,3 +137,68 @@ TEST_CASE(is_one_of)
     EXPECT(bar.is_one_of("bar"sv, "foo"sv));
     EXPECT(bar.is_one_of("bar"sv));
 }
+
+static constexpr size_t interning_thread_count = 4;
+static constexpr size_t strings_per_interning_thread = 1'000;
+
+static void* intern_strings(void* argument)
+{
+    auto thread_index = *static_cast<size_t*>(argument);
+
+    Vector<String> strings;
+    Vector<FlyString> fly_strings;
+    for (size_t i = 0; i < strings_per_interning_thread; ++i) {
+        strings.append(MUST(String::formatted("thread {} string {}", thread_index, i)));
+        fly_strings.append(strings.last());
+    }
+
+    // NB: LibTest's EXPECT isn't thread-safe, so just crash if interning went wrong.
+    for (size_t i = 0; i < strings_per_interning_thread; ++i)
+        VERIFY(MUST(FlyString::from_utf8(strings[i].bytes_as_string_view())) == fly_strings[i]);
+    return nullptr;
+}
+
+TEST_CASE(intern_from_many_threads)
+{
+    Array<size_t, interning_thread_count> thread_indices;
+    Array<pthread_t, interning_thread_count> threads;
+    for (size_t i = 0; i < interning_thread_count; ++i) {
+        thread_indices[i] = i;
+        EXPECT_EQ(pthread_create(&threads[i], nullptr, intern_strings, &thread_indices[i]), 0);
+    }
+    for (auto thread : threads)
+        EXPECT_EQ(pthread_join(thread, nullptr), 0);
+
+    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+}
+
+static constexpr size_t shared_string_count = 16;
+static constexpr size_t shared_string_rounds = 10'000;
+
+static void* intern_and_drop_shared_strings(void*)
+{
+    for (size_t round = 0; round < shared_string_rounds; ++round) {
+        for (size_t i = 0; i < shared_string_count; ++i) {
+            auto string = MUST(String::formatted("shared string {}", i));
+
+            // NB: Every thread interns the same strings and drops them right away, so lookups keep racing with the
+            //     last reference to an entry being dropped on another thread.
+            auto fly_string = MUST(FlyString::from_utf8(string.bytes_as_string_view()));
+            FlyString fly_string_from_string { string };
+            VERIFY(fly_string == fly_string_from_string);
+            VERIFY(fly_string.bytes_as_string_view() == string.bytes_as_string_view());
+        }
+    }
+    return nullptr;
+}
+
+TEST_CASE(intern_and_drop_same_strings_from_many_threads)
+{
+    Array<pthread_t, interning_thread_count> threads;
+    for (auto& thread : threads)
+        EXPECT_EQ(pthread_create(&thread, nullptr, intern_and_drop_shared_strings, nullptr), 0);
+    for (auto thread : threads)
+        EXPECT_EQ(pthread_join(thread, nullptr), 0);
+
+    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+}
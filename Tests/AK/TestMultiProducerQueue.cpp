@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/MultiProducerQueue.h>
+#include <AK/Vector.h>
+#include <pthread.h>
+
+TEST_CASE(take_all_is_oldest_first)
+{
+    MultiProducerQueue<int> ints;
+    EXPECT(ints.is_empty());
+
+    EXPECT(ints.push(1));
+    EXPECT(!ints.push(2));
+    EXPECT(!ints.push(3));
+    EXPECT(!ints.is_empty());
+
+    Vector<int> taken;
+    EXPECT_EQ(ints.take_all([&](int value) { taken.append(value); }), 3u);
+    EXPECT_EQ(taken, (Vector<int> { 1, 2, 3 }));
+    EXPECT(ints.is_empty());
+}
+
+TEST_CASE(values_pushed_while_taking_are_left_for_later)
+{
+    MultiProducerQueue<ByteString> strings;
+    strings.push("ABC");
+
+    Vector<ByteString> taken;
+    EXPECT_EQ(strings.take_all([&](ByteString&& value) {
+        taken.append(move(value));
+        strings.push("DEF");
+    }),
+        1u);
+    EXPECT_EQ(taken, (Vector<ByteString> { "ABC" }));
+
+    EXPECT_EQ(strings.take_all([&](ByteString&& value) { taken.append(move(value)); }), 1u);
+    EXPECT_EQ(taken, (Vector<ByteString> { "ABC", "DEF" }));
+}
+
+TEST_CASE(pending_values_are_destroyed_with_the_queue)
+{
+    struct Counted {
+        explicit Counted(int& count)
+            : count(&count)
+        {
+            ++*this->count;
+        }
+        Counted(Counted&& other)
+            : count(exchange(other.count, nullptr))
+        {
+        }
+        ~Counted()
+        {
+            if (count)
+                --*count;
+        }
+        int* count { nullptr };
+    };
+
+    int live_count = 0;
+    {
+        MultiProducerQueue<Counted> queue;
+        queue.push(live_count);
+        queue.push(live_count);
+        EXPECT_EQ(live_count, 2);
+    }
+    EXPECT_EQ(live_count, 0);
+}
+
+static constexpr size_t producer_count = 4;
+static constexpr int values_per_producer = 10'000;
+
+struct ProducerContext {
+    MultiProducerQueue<int>* queue { nullptr };
+    int first_value { 0 };
+};
+
+static void* produce(void* argument)
+{
+    auto& context = *static_cast<ProducerContext*>(argument);
+    for (int i = 0; i < values_per_producer; ++i)
+        context.queue->push(context.first_value + i);
+    return nullptr;
+}
+
+TEST_CASE(concurrent_producers)
+{
+    MultiProducerQueue<int> queue;
+
+    Array<ProducerContext, producer_count> contexts;
+    Array<pthread_t, producer_count> threads;
+    for (size_t i = 0; i < producer_count; ++i) {
+        contexts[i] = { .queue = &queue, .first_value = static_cast<int>(i) * values_per_producer };
+        EXPECT_EQ(pthread_create(&threads[i], nullptr, produce, &contexts[i]), 0);
+    }
+
+    // Every producer's values must arrive exactly once, and in the order that producer pushed them.
+    Array<int, producer_count> next_expected {};
+    for (size_t i = 0; i < producer_count; ++i)
+        next_expected[i] = static_cast<int>(i) * values_per_producer;
+
+    size_t total = 0;
+    auto consume = [&](int value) {
+        auto producer = static_cast<size_t>(value / values_per_producer);
+        EXPECT_EQ(value, next_expected[producer]);
+        ++next_expected[producer];
+    };
+
+    while (total < producer_count * values_per_producer)
+        total += queue.take_all(consume);
+
+    for (auto thread : threads)
+        EXPECT_EQ(pthread_join(thread, nullptr), 0);
+
+    EXPECT(queue.is_empty());
+}
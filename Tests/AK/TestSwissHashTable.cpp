@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/QuickSort.h>
+#include <AK/SwissHashTable.h>
+#include <AK/Vector.h>
+
+TEST_CASE(construct)
+{
+    using IntTable = SwissHashTable<int>;
+    EXPECT(IntTable().is_empty());
+    EXPECT_EQ(IntTable().size(), 0u);
+    EXPECT(IntTable().begin() == IntTable().end());
+}
+
+TEST_CASE(basic_move)
+{
+    SwissHashTable<int> foo;
+    foo.set(1);
+    auto bar = move(foo);
+    EXPECT_EQ(bar.size(), 1u);
+    EXPECT_EQ(foo.size(), 0u);
+    EXPECT(bar.contains(1));
+    foo = move(bar);
+    EXPECT_EQ(bar.size(), 0u);
+    EXPECT_EQ(foo.size(), 1u);
+}
+
+TEST_CASE(copy)
+{
+    SwissHashTable<ByteString> strings;
+    strings.set("One");
+    strings.set("Two");
+
+    auto copy = strings;
+    strings.remove("One");
+    EXPECT_EQ(copy.size(), 2u);
+    EXPECT(copy.contains("One"sv));
+    EXPECT(copy.contains("Two"sv));
+}
+
+TEST_CASE(populate)
+{
+    SwissHashTable<ByteString> strings;
+    EXPECT_EQ(strings.set("One"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.set("Two"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.set("Two"), AK::HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(strings.set("Two", AK::HashSetExistingEntryBehavior::Keep), AK::HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(strings.size(), 2u);
+}
+
+TEST_CASE(range_loop)
+{
+    SwissHashTable<int> ints;
+    for (int i = 0; i < 100; ++i)
+        ints.set(i);
+
+    int sum = 0;
+    int loop_counter = 0;
+    for (auto value : ints) {
+        sum += value;
+        ++loop_counter;
+    }
+    EXPECT_EQ(loop_counter, 100);
+    EXPECT_EQ(sum, 4950);
+}
+
+TEST_CASE(many_strings)
+{
+    SwissHashTable<ByteString> strings;
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 999u);
+    for (int i = 0; i < 999; ++i)
+        EXPECT(strings.contains(ByteString::number(i)));
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.remove(ByteString::number(i)), true);
+    EXPECT_EQ(strings.is_empty(), true);
+}
+
+TEST_CASE(many_collisions)
+{
+    struct StringCollisionTraits : public DefaultTraits<ByteString> {
+        static unsigned hash(ByteString const&) { return 0; }
+    };
+
+    SwissHashTable<ByteString, StringCollisionTraits> strings;
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+
+    EXPECT_EQ(strings.set("foo"), AK::HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(strings.size(), 1000u);
+
+    for (int i = 0; i < 999; ++i)
+        EXPECT_EQ(strings.remove(ByteString::number(i)), true);
+
+    EXPECT(strings.find("foo") != strings.end());
+}
+
+TEST_CASE(space_reuse)
+{
+    struct StringCollisionTraits : public DefaultTraits<ByteString> {
+        static unsigned hash(ByteString const&) { return 0; }
+    };
+
+    SwissHashTable<ByteString, StringCollisionTraits> strings;
+
+    EXPECT_EQ(strings.set("0"), AK::HashSetResult::InsertedNewEntry);
+    auto capacity = strings.capacity();
+
+    // Tombstones left behind by removals must be cleaned up without growing the table.
+    for (int i = 1; i < 999; ++i) {
+        EXPECT_EQ(strings.set(ByteString::number(i)), AK::HashSetResult::InsertedNewEntry);
+        EXPECT_EQ(strings.remove(ByteString::number(i - 1)), true);
+    }
+
+    EXPECT_EQ(strings.capacity(), capacity);
+    EXPECT_EQ(strings.size(), 1u);
+    EXPECT(strings.contains("998"sv));
+}
+
+TEST_CASE(remove_all_matching)
+{
+    SwissHashTable<int> ints;
+    for (int i = 1; i <= 4; ++i)
+        ints.set(i);
+
+    EXPECT(ints.remove_all_matching([&](int value) { return value > 2; }));
+    EXPECT(!ints.remove_all_matching([&](int) { return false; }));
+    EXPECT_EQ(ints.size(), 2u);
+    EXPECT(ints.contains(1));
+    EXPECT(ints.contains(2));
+}
+
+TEST_CASE(take_all_matching)
+{
+    SwissHashTable<int> ints;
+    for (int i = 1; i <= 4; ++i)
+        ints.set(i);
+
+    auto evens = ints.take_all_matching([&](int value) { return value % 2 == 0; });
+    quick_sort(evens);
+    EXPECT_EQ(evens, (Vector<int> { 2, 4 }));
+    EXPECT_EQ(ints.size(), 2u);
+}
+
+TEST_CASE(iterator_removal)
+{
+    SwissHashTable<int> ints;
+    ints.set(0);
+    ints.set(1);
+
+    auto it = ints.find(0);
+    auto other = ints.find(1);
+    ints.remove(it);
+    EXPECT_EQ(ints.size(), 1u);
+
+    // Removing an entry doesn't move any other entries.
+    EXPECT_EQ(*other, 1);
+    EXPECT(ints.find(1) == other);
+}
+
+TEST_CASE(clear_with_capacity)
+{
+    SwissHashTable<ByteString> strings;
+    for (int i = 0; i < 100; ++i)
+        strings.set(ByteString::number(i));
+
+    auto capacity = strings.capacity();
+    strings.clear_with_capacity();
+    EXPECT(strings.is_empty());
+    EXPECT(strings.begin() == strings.end());
+    EXPECT_EQ(strings.capacity(), capacity);
+
+    strings.set("foo");
+    EXPECT(strings.contains("foo"sv));
+}
+
+TEST_CASE(non_trivial_type_table)
+{
+    SwissHashTable<NonnullOwnPtr<int>> table;
+
+    table.set(make<int>(3));
+    table.set(make<int>(11));
+
+    for (int i = 0; i < 1'000; ++i) {
+        table.set(make<int>(-i));
+    }
+    for (int i = 0; i < 10'000; ++i) {
+        table.set(make<int>(i));
+        table.remove(make<int>(i));
+    }
+
+    EXPECT_EQ(table.remove_all_matching([&](auto&) { return true; }), true);
+    EXPECT(table.is_empty());
+}
+
+TEST_CASE(swiss_hash_map)
+{
+    SwissHashMap<ByteString, int> map;
+    map.set("One", 1);
+    map.set("Two", 2);
+    map.ensure("Three", [] { return 3; });
+
+    EXPECT_EQ(map.size(), 3u);
+    EXPECT_EQ(map.get("Two"sv), 2);
+    EXPECT_EQ(map.get("Three"sv), 3);
+    EXPECT(!map.get("Four"sv).has_value());
+
+    EXPECT(map.remove("One"sv));
+    EXPECT(!map.contains("One"sv));
+
+    auto clone = MUST(map.clone());
+    EXPECT_EQ(clone, map);
+}
+
+static constexpr int benchmark_entry_count = 100'000;
+
+template<typename Table>
+static void populate_and_look_up()
+{
+    Table table;
+    for (int i = 0; i < benchmark_entry_count; ++i)
+        table.set(i * 7);
+
+    size_t found = 0;
+    for (int i = 0; i < benchmark_entry_count * 7; ++i)
+        found += table.contains(i);
+    EXPECT_EQ(found, static_cast<size_t>(benchmark_entry_count));
+}
+
+BENCHMARK_CASE(hash_table_populate_and_look_up)
+{
+    populate_and_look_up<HashTable<int>>();
+}
+
+BENCHMARK_CASE(swiss_hash_table_populate_and_look_up)
+{
+    populate_and_look_up<SwissHashTable<int>>();
+}
+
+template<typename Map>
+static void churn_string_keys()
+{
+    Vector<ByteString> keys;
+    for (int i = 0; i < benchmark_entry_count; ++i)
+        keys.append(ByteString::formatted("key-{}", i));
+
+    Map map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        map.set(keys[i], i);
+        if (i >= 1'000)
+            map.remove(keys[i - 1'000]);
+    }
+    EXPECT_EQ(map.size(), 1'000u);
+}
+
+BENCHMARK_CASE(hash_map_churn_string_keys)
+{
+    churn_string_keys<HashMap<ByteString, size_t>>();
+}
+
+BENCHMARK_CASE(swiss_hash_map_churn_string_keys)
+{
+    churn_string_keys<SwissHashMap<ByteString, size_t>>();
+}
@@ -833,6 +833,17 @@ TEST_CASE(find_code_unit_offset)
     EXPECT_EQ(7u, view.find_code_unit_offset(u"bar"sv).value());
 
     EXPECT(!view.find_code_unit_offset(u"baz"sv).has_value());
+
+    // Mixed ASCII and UTF-16 storage.
+    auto ascii_needle = Utf16String::from_utf8("bar"sv);
+    EXPECT(ascii_needle.has_ascii_storage());
+    EXPECT_EQ(7u, view.find_code_unit_offset(ascii_needle).value());
+    EXPECT(!view.find_code_unit_offset(ascii_needle, 8).has_value());
+
+    auto ascii_haystack = Utf16String::from_utf8("aaabaaab"sv);
+    EXPECT_EQ(1u, ascii_haystack.utf16_view().find_code_unit_offset(u"aab"sv).value());
+    EXPECT_EQ(5u, ascii_haystack.utf16_view().find_code_unit_offset(u"aab"sv, 2).value());
+    EXPECT(!ascii_haystack.utf16_view().find_code_unit_offset(u"😀"sv).has_value());
 }
 
 TEST_CASE(find_code_unit_offset_ignoring_case)
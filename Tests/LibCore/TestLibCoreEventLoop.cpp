@@ -5,11 +5,127 @@
  */
 
 #include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
 #include <LibTest/TestCase.h>
 
+#if !defined(AK_OS_WINDOWS)
+#    include <fcntl.h>
+#    include <sys/socket.h>
+#    include <unistd.h>
+#endif
+
 TEST_CASE(test_poll_for_events)
 {
     Core::EventLoop event_loop;
 
     event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
 }
+
+#if !defined(AK_OS_WINDOWS)
+static void write_byte(int fd)
+{
+    u8 byte = 0;
+    MUST(Core::System::write(fd, { &byte, 1 }));
+}
+
+TEST_CASE(notifier_activates_when_fd_becomes_readable)
+{
+    Core::EventLoop event_loop;
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    size_t activations = 0;
+    auto notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    notifier->on_activation = [&] { ++activations; };
+
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(activations, 0u);
+
+    write_byte(fds[1]);
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(activations, 1u);
+
+    notifier->close();
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
+
+TEST_CASE(disabled_notifier_does_not_activate)
+{
+    Core::EventLoop event_loop;
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    size_t activations = 0;
+    auto notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    notifier->on_activation = [&] { ++activations; };
+
+    write_byte(fds[1]);
+    notifier->set_enabled(false);
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(activations, 0u);
+
+    notifier->set_enabled(true);
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(activations, 1u);
+
+    notifier->close();
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
+
+TEST_CASE(notifiers_sharing_an_fd_are_watched_independently)
+{
+    Core::EventLoop event_loop;
+    int fds[2];
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    size_t read_activations = 0;
+    auto read_notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    read_notifier->on_activation = [&] { ++read_activations; };
+
+    size_t write_activations = 0;
+    auto write_notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Write);
+    write_notifier->on_activation = [&] { ++write_activations; };
+
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(read_activations, 0u);
+    EXPECT_EQ(write_activations, 1u);
+
+    // Unwatching one of the notifiers must keep the file descriptor watched for the other one.
+    write_notifier->close();
+    write_byte(fds[1]);
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(read_activations, 1u);
+    EXPECT_EQ(write_activations, 1u);
+
+    read_notifier->close();
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
+
+TEST_CASE(forked_child_does_not_unwatch_fds_of_its_parent)
+{
+    Core::EventLoop event_loop;
+    auto fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    size_t activations = 0;
+    auto notifier = Core::Notifier::construct(fds[0], Core::Notifier::Type::Read);
+    notifier->on_activation = [&] { ++activations; };
+
+    auto pid = fork();
+    VERIFY(pid >= 0);
+    if (pid == 0) {
+        notifier->set_enabled(false);
+        _exit(0);
+    }
+    MUST(Core::System::waitpid(pid));
+
+    write_byte(fds[1]);
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(activations, 1u);
+
+    notifier->close();
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
+#endif
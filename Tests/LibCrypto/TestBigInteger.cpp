@@ -558,6 +558,55 @@ TEST_CASE(test_i32_limits)
     EXPECT(max.unsigned_value().to_u64() == AK::NumericLimits<i32>::max());
 }
 
+TEST_CASE(test_signed_small_division_signs)
+{
+    auto check = [](i64 dividend, i64 divisor, i64 quotient, i64 remainder) {
+        auto result = Crypto::SignedBigInteger { dividend }.divided_by(Crypto::SignedBigInteger { divisor });
+        EXPECT_EQ(result.quotient, Crypto::SignedBigInteger { quotient });
+        EXPECT_EQ(result.remainder, Crypto::SignedBigInteger { remainder });
+    };
+
+    check(7, 2, 3, 1);
+    check(-7, 2, -3, -1);
+    check(7, -2, -3, 1);
+    check(-7, -2, 3, -1);
+    check(-1, 5, 0, -1);
+}
+
+TEST_CASE(test_small_results_that_outgrow_native_integers)
+{
+    Crypto::SignedBigInteger max { AK::NumericLimits<i64>::max() };
+    Crypto::SignedBigInteger min { AK::NumericLimits<i64>::min() };
+    EXPECT_EQ(MUST(max.plus(Crypto::SignedBigInteger { 1 }).to_base(10)), "9223372036854775808"sv);
+    EXPECT_EQ(MUST(min.minus(Crypto::SignedBigInteger { 1 }).to_base(10)), "-9223372036854775809"sv);
+
+    Crypto::SignedBigInteger large { 1ll << 59 };
+    EXPECT_EQ(MUST(large.multiplied_by(large).to_base(10)), "332306998946228968225951765070086144"sv);
+    EXPECT_EQ(MUST(large.multiplied_by(large.negated_value()).to_base(10)), "-332306998946228968225951765070086144"sv);
+
+    Crypto::UnsignedBigInteger unsigned_large { 1ull << 59 };
+    EXPECT_EQ(MUST(unsigned_large.multiplied_by(unsigned_large).to_base(10)), "332306998946228968225951765070086144"sv);
+    EXPECT(Crypto::UnsignedBigInteger { 1 }.minus(Crypto::UnsignedBigInteger { 2 }).is_error());
+}
+
+BENCHMARK_CASE(bench_signed_bigint_small_arithmetic)
+{
+    Crypto::SignedBigInteger total { 0 };
+    for (i64 i = 1; i < 1'000'000; ++i) {
+        Crypto::SignedBigInteger price { i };
+        total = total.plus(price.multiplied_by(Crypto::SignedBigInteger { 3 }).divided_by(Crypto::SignedBigInteger { 7 }).quotient);
+    }
+    (void)total;
+}
+
+BENCHMARK_CASE(bench_bigint_large_multiplication_and_division)
+{
+    auto number = bigint_fibonacci(100000);
+    auto square = number.multiplied_by(number);
+    auto result = square.divided_by(number.plus(Crypto::UnsignedBigInteger { 1 }));
+    (void)result;
+}
+
 TEST_CASE(double_comparisons)
 {
 #define EXPECT_LESS_THAN(bigint, double_value) EXPECT_EQ(bigint.compare_to_double(double_value), Crypto::UnsignedBigInteger::CompareResult::DoubleGreaterThanBigInt)
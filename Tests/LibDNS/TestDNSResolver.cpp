@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/EventLoop.h>
 #include <LibCore/Socket.h>
 #include <LibDNS/Resolver.h>
 #include <LibTLS/TLSv12.h>
@@ -102,3 +103,52 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+// Answers the A and AAAA questions of a query with fixed addresses, pointing back at the name of the first question.
+static ByteBuffer make_response_to_query(ByteBuffer const& query)
+{
+    auto response = MUST(ByteBuffer::copy(query));
+    response[2] |= 0x80; // QR: This message is a response.
+
+    auto& header = *reinterpret_cast<DNS::Messages::Header*>(response.data());
+    header.answer_count = 2;
+
+    u8 const a_record[] = { 0xc0, 0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x04, 192, 0, 2, 1 };
+    u8 const aaaa_record[] = { 0xc0, 0x0c, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x10, 0x00, 0x10, 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+    response.append(a_record, sizeof(a_record));
+    response.append(aaaa_record, sizeof(aaaa_record));
+
+    return response;
+}
+
+TEST_CASE(test_https_transport)
+{
+    Core::EventLoop loop;
+
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("Lookups must go through the HTTPS transport");
+        }
+    };
+
+    size_t queries_sent = 0;
+    resolver.set_https_transport([&](ByteBuffer query, Function<void(ErrorOr<ByteBuffer>)> on_response) {
+        ++queries_sent;
+        Core::deferred_invoke([query = move(query), on_response = move(on_response)] {
+            on_response(make_response_to_query(query));
+        });
+    });
+
+    auto lookup = [&] {
+        return resolver.lookup("example.com", DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })->await();
+    };
+
+    auto result = TRY_OR_FAIL(lookup());
+    EXPECT_EQ(result->records().size(), 2u);
+    EXPECT_EQ(queries_sent, 1u);
+
+    // The answer is now cached, so the second lookup must not send another query.
+    result = TRY_OR_FAIL(lookup());
+    EXPECT_EQ(result->records().size(), 2u);
+    EXPECT_EQ(queries_sent, 1u);
+}
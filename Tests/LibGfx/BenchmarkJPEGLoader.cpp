@@ -14,6 +14,8 @@ auto small_image = Core::File::open(TEST_INPUT("jpg/rgb24.jpg"sv), Core::File::O
 auto big_image = Core::File::open(TEST_INPUT("jpg/big_image.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
 auto rgb_image = Core::File::open(TEST_INPUT("jpg/rgb_components.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
 auto several_scans = Core::File::open(TEST_INPUT("jpg/several_scans.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto cmyk_image = Core::File::open(TEST_INPUT("jpg/cmyk-no-adobe-marker.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
+auto ycck_image = Core::File::open(TEST_INPUT("jpg/ycck-1111.jpg"sv), Core::File::OpenMode::Read).release_value()->read_until_eof().release_value();
 
 BENCHMARK_CASE(small_image)
 {
@@ -38,3 +40,22 @@ BENCHMARK_CASE(several_scans)
     auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(several_scans));
     MUST(plugin_decoder->frame(0));
 }
+
+BENCHMARK_CASE(cmyk_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(cmyk_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(ycck_image)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(ycck_image));
+    MUST(plugin_decoder->frame(0));
+}
+
+BENCHMARK_CASE(big_image_at_quarter_size)
+{
+    auto plugin_decoder = MUST(Gfx::JPEGImageDecoderPlugin::create(big_image));
+    auto size = plugin_decoder->size();
+    MUST(plugin_decoder->frame(0, Gfx::IntSize { size.width() / 4, size.height() / 4 }));
+}
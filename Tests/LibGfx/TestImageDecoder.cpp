@@ -284,6 +284,19 @@ TEST_CASE(test_jpeg_sof0_several_scans)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 592, 800 }));
 }
 
+TEST_CASE(test_jpeg_decode_to_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 148, 200 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(592, 800));
+}
+
 TEST_CASE(test_odd_mcu_restart_interval)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/odd-restart.jpg"sv)));
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/QuickSort.h>
+#include <LibCore/System.h>
+#include <LibDatabase/Database.h>
+#include <LibFileSystem/TempFile.h>
+#include <LibHTTP/Cache/CacheIndex.h>
+#include <LibHTTP/Cache/Utilities.h>
+#include <LibHTTP/HeaderList.h>
+
+static constexpr u64 ENTRY_SIZE = 100;
+
+static void create_entry(HTTP::CacheIndex& index, u64 cache_key)
+{
+    auto vary_key = HTTP::create_vary_key(HTTP::HeaderList::create(), HTTP::HeaderList::create());
+    auto now = UnixDateTime::now();
+
+    index.create_entry(cache_key, vary_key, "https://example.com/"_string, HTTP::HeaderList::create(), HTTP::HeaderList::create(), ENTRY_SIZE, now, now);
+
+    // NB: Last access times are stored with millisecond precision, so make sure no two entries share one.
+    MUST(Core::System::sleep_ms(2));
+}
+
+static bool has_entry(HTTP::CacheIndex& index, u64 cache_key)
+{
+    return index.find_entry(cache_key, HTTP::HeaderList::create()).has_value();
+}
+
+TEST_CASE(remove_least_recently_accessed_entries)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto database = TRY_OR_FAIL(Database::Database::create(directory->path().to_byte_string(), "Cache"sv));
+    auto index = TRY_OR_FAIL(HTTP::CacheIndex::create(*database));
+
+    static constexpr u64 entry_count = 20;
+    for (u64 cache_key = 1; cache_key <= entry_count; ++cache_key)
+        create_entry(index, cache_key);
+
+    EXPECT_EQ(index.estimated_total_size(), entry_count * ENTRY_SIZE);
+
+    // Touching the oldest entry makes it the most recently accessed one.
+    auto vary_key = HTTP::create_vary_key(HTTP::HeaderList::create(), HTTP::HeaderList::create());
+    index.update_last_access_time(1, vary_key);
+
+    static constexpr u64 target_size = 15 * ENTRY_SIZE;
+
+    Vector<u64> removed_cache_keys;
+    index.remove_least_recently_accessed_entries(target_size, [&](u64 cache_key, u64) {
+        removed_cache_keys.append(cache_key);
+    });
+
+    EXPECT(!removed_cache_keys.is_empty());
+    EXPECT(index.estimated_total_size() <= target_size);
+    EXPECT_EQ(index.estimated_total_size(), (entry_count - removed_cache_keys.size()) * ENTRY_SIZE);
+
+    // Entries must have been removed oldest first, skipping the one that was just accessed.
+    quick_sort(removed_cache_keys);
+    for (size_t i = 0; i < removed_cache_keys.size(); ++i)
+        EXPECT_EQ(removed_cache_keys[i], i + 2);
+
+    EXPECT(has_entry(index, 1));
+    for (u64 cache_key = 2; cache_key <= entry_count; ++cache_key)
+        EXPECT_EQ(has_entry(index, cache_key), !removed_cache_keys.contains_slow(cache_key));
+}
+
+TEST_CASE(remove_least_recently_accessed_entries_under_target_size)
+{
+    auto directory = TRY_OR_FAIL(FileSystem::TempFile::create_temp_directory());
+    auto database = TRY_OR_FAIL(Database::Database::create(directory->path().to_byte_string(), "Cache"sv));
+    auto index = TRY_OR_FAIL(HTTP::CacheIndex::create(*database));
+
+    for (u64 cache_key = 1; cache_key <= 3; ++cache_key)
+        create_entry(index, cache_key);
+
+    auto removed_entries = 0uz;
+    index.remove_least_recently_accessed_entries(3 * ENTRY_SIZE, [&](u64, u64) { ++removed_entries; });
+
+    EXPECT_EQ(removed_entries, 0uz);
+    EXPECT_EQ(index.estimated_total_size(), 3 * ENTRY_SIZE);
+    for (u64 cache_key = 1; cache_key <= 3; ++cache_key)
+        EXPECT(has_entry(index, cache_key));
+}
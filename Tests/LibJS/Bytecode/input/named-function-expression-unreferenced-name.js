@@ -0,0 +1,8 @@
+// Test that a named function expression whose name is never read inside it
+// doesn't get a lexical environment for the name binding.
+
+Oops = function Oops() {
+    return 1;
+};
+
+Oops.x;
@@ -13,3 +13,43 @@ test("basic arguments object", () => {
     expect(bar("hello", "friends", ":^)")).toBe("friends");
     expect(bar("hello")).toBe(undefined);
 });
+
+test("length and elements after the arguments object escapes", () => {
+    function escape() {
+        const length = arguments.length;
+        const args = arguments;
+        args[0] = "changed";
+        args.length = 5;
+        return [length, arguments[0], arguments.length, args === arguments];
+    }
+    expect(escape("original")).toEqual([1, "changed", 5, true]);
+
+    function reassign() {
+        arguments = "xy";
+        return [arguments.length, arguments[1]];
+    }
+    expect(reassign(1, 2, 3)).toEqual([2, "y"]);
+});
+
+test("non-index properties of the arguments object", () => {
+    function sloppy() {
+        return [arguments["callee"] === sloppy, arguments[-1], arguments[1.5], arguments[Symbol.iterator] === Array.prototype.values];
+    }
+    expect(sloppy(1, 2)).toEqual([true, undefined, undefined, true]);
+
+    function strict() {
+        "use strict";
+        return arguments["callee"];
+    }
+    expect(() => strict()).toThrow(TypeError);
+
+    Object.prototype[3] = "inherited";
+    try {
+        function inherited() {
+            return [arguments[0], arguments[3]];
+        }
+        expect(inherited("own")).toEqual(["own", "inherited"]);
+    } finally {
+        delete Object.prototype[3];
+    }
+});
@@ -17,6 +17,23 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("holes read as undefined", () => {
+    expect([1, , 3].includes(undefined)).toBeTrue();
+    expect([1, 2, 3].includes(undefined)).toBeFalse();
+});
+
+test("array shrunk by fromIndex conversion", () => {
+    var array = [1, 2, 3, 4];
+    var fromIndex = {
+        valueOf() {
+            array.length = 1;
+            return 0;
+        },
+    };
+    expect(array.includes(4, fromIndex)).toBeFalse();
+    expect(array.includes(undefined, fromIndex)).toBeTrue();
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
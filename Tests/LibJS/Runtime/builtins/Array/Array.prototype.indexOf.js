@@ -23,3 +23,23 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("holes are skipped", () => {
+    var array = [1, , 3];
+    expect(array.indexOf(undefined)).toBe(-1);
+    expect(array.indexOf(3)).toBe(2);
+    expect(array.lastIndexOf(undefined)).toBe(-1);
+    expect(array.lastIndexOf(1)).toBe(0);
+});
+
+test("array shrunk by fromIndex conversion", () => {
+    var array = [1, 2, 3, 4];
+    var fromIndex = {
+        valueOf() {
+            array.length = 1;
+            return 0;
+        },
+    };
+    expect(array.indexOf(4, fromIndex)).toBe(-1);
+    expect(array.indexOf(1, fromIndex)).toBe(0);
+});
@@ -89,6 +89,58 @@ describe("Array.prototype.sort", () => {
         expect(arr[2].other_property == 2);
     });
 
+    test("larger arrays", () => {
+        const values = [];
+        for (let i = 0; i < 1000; ++i) values.push({ key: (i * 7919) % 100, index: i });
+
+        const sorted = values.slice().sort((a, b) => a.key - b.key);
+        for (let i = 1; i < sorted.length; ++i) {
+            expect(sorted[i - 1].key <= sorted[i].key).toBeTrue();
+            if (sorted[i - 1].key === sorted[i].key) expect(sorted[i - 1].index < sorted[i].index).toBeTrue();
+        }
+
+        const ascending = [];
+        for (let i = 0; i < 1000; ++i) ascending.push(i);
+        let calls = 0;
+        ascending.sort((a, b) => {
+            ++calls;
+            return a - b;
+        });
+        expect(calls < 2000).toBeTrue();
+        for (let i = 0; i < 1000; ++i) expect(ascending[i]).toBe(i);
+
+        const descending = [];
+        for (let i = 0; i < 1000; ++i) descending.push(999 - i);
+        descending.sort();
+        expect(descending[0]).toBe(0);
+        expect(descending[1]).toBe(1);
+        expect(descending[2]).toBe(10);
+        expect(descending[3]).toBe(100);
+        expect(descending[999]).toBe(999);
+    });
+
+    test("default comparison of mixed primitives", () => {
+        expect([10, "9", true, null, undefined, 1n, -1, "\u{1F600}", "\uFFFF"].sort()).toEqual([
+            -1,
+            1n,
+            10,
+            "9",
+            null,
+            true,
+            "\u{1F600}",
+            "\uFFFF",
+            undefined,
+        ]);
+
+        const sortedWithObject = [3, { toString: () => "2" }, 1].sort();
+        expect(sortedWithObject[0]).toBe(1);
+        expect(sortedWithObject[1].toString()).toBe("2");
+        expect(sortedWithObject[2]).toBe(3);
+
+        expect([Symbol.iterator].sort()).toEqual([Symbol.iterator]);
+        expect(() => [Symbol.iterator, 1].sort()).toThrow(TypeError);
+    });
+
     test("that it makes no unnecessary calls to compare function", () => {
         expectNoCallCompareFunction = function (a, b) {
             expect().fail();
@@ -70,4 +70,23 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value does not match", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[1] = 42;
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+
+        const bigIntArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        bigIntArray[2] = 42n;
+        expect(Atomics.wait(bigIntArray, 2, 0n)).toBe("not-equal");
+    });
+
+    test("times out", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(typedArray, 0, 0, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 0, 0, 1)).toBe("timed-out");
+
+        const bigIntArray = new BigInt64Array(new SharedArrayBuffer(4 * BigInt64Array.BYTES_PER_ELEMENT));
+        expect(Atomics.wait(bigIntArray, 0, 0n, 1)).toBe("timed-out");
+    });
 });
@@ -70,4 +70,17 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.waitAsync).toHaveLength(4);
     });
+
+    test("resolves synchronously", () => {
+        const typedArray = new Int32Array(new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT));
+        typedArray[0] = 42;
+
+        let result = Atomics.waitAsync(typedArray, 0, 0, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("not-equal");
+
+        result = Atomics.waitAsync(typedArray, 0, 42, 0);
+        expect(result.async).toBeFalse();
+        expect(result.value).toBe("timed-out");
+    });
 });
@@ -144,3 +144,12 @@ test("whitespace handling", () => {
     expect(JSON.parse("  {  }  ")).toEqual({});
     expect(JSON.parse("  [  ]  ")).toEqual([]);
 });
+
+test("repeated keys across objects", () => {
+    const parsed = JSON.parse('[{"a":1,"\\u0062":2,"0":3},{"a":4,"b":5,"0":6},{"b":7,"a":8}]');
+    expect(parsed).toHaveLength(3);
+    expect(Object.keys(parsed[0])).toEqual(["0", "a", "b"]);
+    expect(parsed[1]).toEqual({ a: 4, b: 5, 0: 6 });
+    expect(parsed[1][0]).toBe(6);
+    expect(Object.keys(parsed[2])).toEqual(["b", "a"]);
+});
@@ -51,6 +51,30 @@ describe("correct behavior", () => {
         delete BigInt.prototype.toJSON;
     });
 
+    test("toJSON on the prototype chain", () => {
+        class Point {
+            constructor(x, y) {
+                this.x = x;
+                this.y = y;
+            }
+        }
+        const point = new Point(1, 2);
+        expect(JSON.stringify({ point })).toBe('{"point":{"x":1,"y":2}}');
+
+        Point.prototype.toJSON = function () {
+            return [this.x, this.y];
+        };
+        expect(JSON.stringify({ point })).toBe('{"point":[1,2]}');
+
+        Object.prototype.toJSON = () => "patched";
+        try {
+            expect(JSON.stringify({ a: [] })).toBe('"patched"');
+        } finally {
+            delete Object.prototype.toJSON;
+        }
+        expect(JSON.stringify({ a: [] })).toBe('{"a":[]}');
+    });
+
     test("ignores non-enumerable properties", () => {
         let o = { foo: "bar" };
         Object.defineProperty(o, "baz", { value: "qux", enumerable: false });
@@ -10,3 +10,19 @@ test("basic functionality", () => {
     map.clear();
     expect(map).toHaveSize(0);
 });
+
+test("active iterators continue with elements added after clearing", () => {
+    const map = new Map([
+        ["a", 0],
+        ["b", 1],
+        ["c", 2],
+    ]);
+    const iterator = map.keys();
+    expect(iterator.next()).toBeIteratorResultWithValue("a");
+
+    map.clear();
+    map.set("d", 3);
+
+    expect(iterator.next()).toBeIteratorResultWithValue("d");
+    expect(iterator.next()).toBeIteratorResultDone();
+});
@@ -82,4 +82,32 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
         expect(iterator.next()).toBeIteratorResultDone();
     });
+
+    test("iterators keep their position when many elements are deleted", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        for (let i = 0; i < 50; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+
+        for (let i = 0; i < 100; i += 2) expect(map.delete(i)).toBeTrue();
+        for (let i = 25; i < 50; ++i) map.delete(i);
+        map.set("new", "new");
+
+        for (let i = 51; i < 100; i += 2) expect(iterator.next()).toBeIteratorResultWithValue(i);
+        expect(iterator.next()).toBeIteratorResultWithValue("new");
+        expect(iterator.next()).toBeIteratorResultDone();
+        expect(map).toHaveSize(38);
+    });
+
+    test("deleting and re-adding keeps insertion order", () => {
+        const map = new Map();
+        for (let i = 0; i < 1000; ++i) {
+            map.set(i, i);
+            if (i >= 10) map.delete(i - 10);
+        }
+        expect(Array.from(map.keys())).toEqual([990, 991, 992, 993, 994, 995, 996, 997, 998, 999]);
+        map.set(990, "updated");
+        expect(Array.from(map.values())[0]).toBe("updated");
+    });
 });
@@ -15,6 +15,9 @@ test("constructor without new", () => {
     expect(Number("00123")).toBe(123);
     expect(Number("123n")).toBeNaN();
     expect(Number("42")).toBe(42);
+    expect(Number("123456789012345")).toBe(123456789012345);
+    expect(Number("9007199254740993")).toBe(9007199254740992);
+    expect(Number(" 42 ")).toBe(42);
     expect(Number(null)).toBe(0);
     expect(Number(true)).toBe(1);
     expect(Number("Infinity")).toBe(Infinity);
@@ -17,6 +17,11 @@ describe("correct behavior", () => {
             [2147483648, "2147483648"], // 2 ** 31
             [4294967295, "4294967295"], // 2 ** 32 - 1
             [18014398509481984, "18014398509481984"], // 2 ** 54
+            [-93465, "-93465"],
+            [9007199254740991, "9007199254740991"], // 2 ** 53 - 1
+            [-9007199254740991, "-9007199254740991"],
+            [1e21, "1e+21"],
+            [123.5, "123.5"],
         ].forEach(testCase => {
             expect(testCase[0].toString()).toBe(testCase[1]);
         });
@@ -25,3 +25,15 @@ test("UTF-16", () => {
     expect(s.slice(0, 1)).toBe("\ud83d");
     expect(s.slice(0, 2)).toBe("😀");
 });
+
+test("long slices", () => {
+    var s = "a".repeat(500) + "😀" + "b".repeat(500);
+    var slice = s.slice(1, 1000);
+    expect(slice).toHaveLength(999);
+    expect(slice.slice(498, 501)).toBe("a😀");
+    expect(slice.slice(300, 998).slice(200, 202)).toBe("😀");
+    expect(slice === "a".repeat(499) + "😀" + "b".repeat(498)).toBeTrue();
+    expect(slice + "!").toBe("a".repeat(499) + "😀" + "b".repeat(498) + "!");
+    expect(slice.indexOf("😀")).toBe(499);
+    expect({ [slice]: 1 }[slice]).toBe(1);
+});
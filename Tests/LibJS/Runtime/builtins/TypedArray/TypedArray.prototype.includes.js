@@ -63,3 +63,53 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("NaN", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([1, NaN, 3]);
+        expect(typedArray.includes(NaN)).toBe(true);
+        expect(typedArray.includes(NaN, 2)).toBe(false);
+        expect(new T([1, 2, 3]).includes(NaN)).toBe(false);
+    });
+
+    [Uint8Array, Uint8ClampedArray, Int8Array, Int16Array, Int32Array, Uint16Array, Uint32Array].forEach(T => {
+        expect(new T([0, 1]).includes(NaN)).toBe(false);
+    });
+});
+
+test("negative zero", () => {
+    TYPED_ARRAYS.forEach(T => {
+        expect(new T([1, -0]).includes(0)).toBe(true);
+        expect(new T([1, 0]).includes(-0)).toBe(true);
+    });
+});
+
+test("values that can't be represented by the element type", () => {
+    expect(new Uint8Array([255, 0]).includes(256)).toBe(false);
+    expect(new Uint8Array([255, 0]).includes(-1)).toBe(false);
+    expect(new Uint8Array([255, 0]).includes(255)).toBe(true);
+    expect(new Uint8Array([1, 2]).includes(1.5)).toBe(false);
+    expect(new Uint8ClampedArray([255]).includes(300)).toBe(false);
+    expect(new Int8Array([-128, 127]).includes(128)).toBe(false);
+    expect(new Int8Array([-128, 127]).includes(-129)).toBe(false);
+    expect(new Int8Array([-128, 127]).includes(-128)).toBe(true);
+    expect(new Uint16Array([65535]).includes(-1)).toBe(false);
+    expect(new Uint16Array([65535]).includes(65536)).toBe(false);
+    expect(new Int32Array([2147483647]).includes(2147483648)).toBe(false);
+    expect(new Uint32Array([4294967295]).includes(4294967295)).toBe(true);
+    expect(new Uint32Array([4294967295]).includes(-1)).toBe(false);
+
+    expect(new Float16Array([65504]).includes(65504)).toBe(true);
+    expect(new Float16Array([65504]).includes(65505)).toBe(false);
+    expect(new Float16Array([65504]).includes(Infinity)).toBe(false);
+    expect(new Float16Array([Infinity]).includes(Infinity)).toBe(true);
+    expect(new Float16Array([0.1]).includes(0.1)).toBe(false);
+    expect(new Float16Array([0.5]).includes(0.5)).toBe(true);
+    expect(new Float32Array([0.1]).includes(0.1)).toBe(false);
+    expect(new Float32Array([0.1]).includes(Math.fround(0.1))).toBe(true);
+
+    TYPED_ARRAYS.forEach(T => {
+        expect(new T([1]).includes("1")).toBe(false);
+        expect(new T([1]).includes(1n)).toBe(false);
+    });
+});
@@ -63,3 +63,38 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("NaN", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        expect(new T([1, NaN, 3]).indexOf(NaN)).toBe(-1);
+    });
+});
+
+test("negative zero", () => {
+    TYPED_ARRAYS.forEach(T => {
+        expect(new T([1, -0]).indexOf(0)).toBe(1);
+        expect(new T([1, 0]).indexOf(-0)).toBe(1);
+    });
+});
+
+test("values that can't be represented by the element type", () => {
+    expect(new Uint8Array([255, 0]).indexOf(256)).toBe(-1);
+    expect(new Uint8Array([255, 0]).indexOf(-1)).toBe(-1);
+    expect(new Uint8Array([0, 255]).indexOf(255)).toBe(1);
+    expect(new Uint8Array([1, 2]).indexOf(1.5)).toBe(-1);
+    expect(new Int8Array([-128, 127]).indexOf(128)).toBe(-1);
+    expect(new Int8Array([127, -128]).indexOf(-128)).toBe(1);
+    expect(new Uint16Array([65535]).indexOf(-1)).toBe(-1);
+    expect(new Int32Array([2147483647]).indexOf(2147483648)).toBe(-1);
+    expect(new Uint32Array([0, 4294967295]).indexOf(4294967295)).toBe(1);
+
+    expect(new Float16Array([65504]).indexOf(65505)).toBe(-1);
+    expect(new Float16Array([1, 0.5]).indexOf(0.5)).toBe(1);
+    expect(new Float16Array([0.1]).indexOf(0.1)).toBe(-1);
+    expect(new Float32Array([0.1]).indexOf(0.1)).toBe(-1);
+    expect(new Float32Array([1, 0.1]).indexOf(Math.fround(0.1))).toBe(1);
+
+    TYPED_ARRAYS.forEach(T => {
+        expect(new T([1]).indexOf("1")).toBe(-1);
+    });
+});
@@ -73,6 +73,25 @@ test("basic functionality", () => {
     });
 });
 
+test("NaN and signed zeros", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 1, 0, -Infinity, -0, NaN, -1, Infinity, 0, -0]);
+        expect(typedArray.sort()).toBe(typedArray);
+        expect(Array.from(typedArray)).toEqual([-Infinity, -1, -0, -0, 0, 0, 1, Infinity, NaN, NaN]);
+        expect(Object.is(typedArray[2], -0)).toBeTrue();
+        expect(Object.is(typedArray[4], 0)).toBeTrue();
+    });
+});
+
+test("larger arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < typedArray.length; ++i) typedArray[i] = (i * 37) % 101;
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+});
+
 test("detached buffer", () => {
     TYPED_ARRAYS.forEach(T => {
         const typedArray = new T(3);
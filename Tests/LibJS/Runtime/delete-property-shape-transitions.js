@@ -0,0 +1,41 @@
+describe("deleting properties from objects with transition shapes", () => {
+    test("deleting the most recently added property", () => {
+        const a = { x: 1, y: 2 };
+        delete a.y;
+        expect(Object.keys(a)).toEqual(["x"]);
+        expect(a.y).toBeUndefined();
+        a.y = 3;
+        expect(Object.keys(a)).toEqual(["x", "y"]);
+        expect(a.y).toBe(3);
+
+        const b = { x: 4 };
+        b.y = 5;
+        expect(b.x).toBe(4);
+        expect(b.y).toBe(5);
+    });
+
+    test("deleting an earlier property keeps insertion order", () => {
+        const o = { a: 1, b: 2, c: 3 };
+        delete o.a;
+        expect(Object.keys(o)).toEqual(["b", "c"]);
+        expect(o.b).toBe(2);
+        expect(o.c).toBe(3);
+        o.a = 4;
+        expect(Object.keys(o)).toEqual(["b", "c", "a"]);
+        expect(o.a).toBe(4);
+    });
+
+    test("objects used as hash maps", () => {
+        const map = {};
+        for (let i = 0; i < 50; ++i) {
+            map["key" + i] = i;
+            if (i % 3 === 0) delete map["key" + (i >> 1)];
+        }
+        for (let i = 0; i < 50; ++i) {
+            const key = "key" + i;
+            if (key in map) expect(map[key]).toBe(i);
+        }
+        expect("key0" in map).toBeFalse();
+        expect(map.key49).toBe(49);
+    });
+});
@@ -68,4 +68,31 @@ describe("named function expression scoping", () => {
         expect(result[0]).toBe(0); // outer sameName
         expect(result[1]).toBe(0); // inner sameName (shadows outer)
     });
+
+    test("name is visible to direct eval and nested closures", () => {
+        const viaEval = function evalName() {
+            return eval("typeof evalName");
+        };
+        expect(viaEval()).toBe("function");
+
+        const viaNestedEval = function nestedEvalName() {
+            return (() => eval("typeof nestedEvalName"))();
+        };
+        expect(viaNestedEval()).toBe("function");
+
+        const viaArrow = function arrowName() {
+            return () => arrowName;
+        };
+        expect(viaArrow()()).toBe(viaArrow);
+    });
+
+    test("unreferenced name does not leak or shadow", () => {
+        let unused = "outer";
+        const f = function unused() {
+            return 42;
+        };
+        expect(f()).toBe(42);
+        expect(f.name).toBe("unused");
+        expect(unused).toBe("outer");
+    });
 });
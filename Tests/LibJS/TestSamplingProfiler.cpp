@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// NB: outer() keeps calling inner() for a while, so that the profiler is guaranteed to sample both of them.
+static constexpr auto source = R"(function inner() { let x = 0; for (let i = 0; i < 1000; ++i) x += i; return x; }
+function outer() {
+    const start = Date.now();
+    let result = 0;
+    while (Date.now() - start < 100)
+        result += inner();
+    return result;
+}
+outer();
+)"sv;
+
+static Optional<JsonObject const&> find_node(JsonArray const& nodes, StringView function_name)
+{
+    for (auto const& node : nodes.values()) {
+        if (node.as_object().get_object("callFrame"sv)->get_string("functionName"sv) == function_name)
+            return node.as_object();
+    }
+    return {};
+}
+
+TEST_CASE(sample_call_stacks)
+{
+    auto vm = JS::VM::create();
+    auto root_execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *root_execution_context->realm;
+
+    auto script = JS::Script::parse(source, realm, "profile-test.js"sv);
+    if (script.is_error()) {
+        FAIL("Unable to parse the profiled script");
+        return;
+    }
+
+    JS::SamplingProfiler profiler { *vm };
+    profiler.start();
+    EXPECT(profiler.is_running());
+    auto result = vm->bytecode_interpreter().run(script.value());
+    profiler.stop();
+
+    EXPECT(!result.is_error());
+    EXPECT(!profiler.is_running());
+    EXPECT(profiler.sample_count() > 0);
+
+    auto profile = profiler.to_cpu_profile();
+    auto const& nodes = *profile.get_array("nodes"sv);
+    auto const& samples = *profile.get_array("samples"sv);
+    auto const& time_deltas = *profile.get_array("timeDeltas"sv);
+
+    EXPECT_EQ(samples.size(), profiler.sample_count());
+    EXPECT_EQ(time_deltas.size(), profiler.sample_count());
+    EXPECT(*profile.get_i64("startTime"sv) <= *profile.get_i64("endTime"sv));
+
+    auto const& root = nodes.at(0).as_object();
+    EXPECT_EQ(*root.get_u64("id"sv), 1u);
+    EXPECT_EQ(*root.get_object("callFrame"sv)->get_string("functionName"sv), "(root)"sv);
+
+    // Every sample refers to a node, and each node was hit as often as it shows up in the samples.
+    u64 total_hit_count = 0;
+    for (auto const& node : nodes.values())
+        total_hit_count += *node.as_object().get_u64("hitCount"sv);
+    EXPECT_EQ(total_hit_count, samples.size());
+    for (auto const& sample : samples.values()) {
+        auto node_id = *sample.get_u64();
+        EXPECT(node_id >= 1 && node_id <= nodes.size());
+    }
+
+    auto outer = find_node(nodes, "outer"sv);
+    auto inner = find_node(nodes, "inner"sv);
+    EXPECT(outer.has_value());
+    EXPECT(inner.has_value());
+
+    // inner() is only ever called from outer(), so its node must be a child of outer()'s node.
+    auto inner_id = *inner->get_u64("id"sv);
+    auto outer_children = outer->get_array("children"sv);
+    EXPECT(outer_children.has_value());
+    EXPECT(any_of(outer_children->values(), [&](auto const& child) { return child.get_u64() == inner_id; }));
+
+    auto const& inner_call_frame = *inner->get_object("callFrame"sv);
+    EXPECT_EQ(*inner_call_frame.get_string("url"sv), "profile-test.js"sv);
+    EXPECT_EQ(*inner_call_frame.get_i64("lineNumber"sv), 0);
+
+    // All of inner() is on the first line, so that's where all of its ticks must be.
+    if (auto position_ticks = inner->get_array("positionTicks"sv); position_ticks.has_value()) {
+        for (auto const& position_tick : position_ticks->values())
+            EXPECT_EQ(*position_tick.as_object().get_u64("line"sv), 1u);
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NumericLimits.h>
+#include <LibCore/System.h>
+#include <LibJS/Runtime/WaiterLists.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Thread.h>
+
+using WaitResult = JS::WaiterLists::WaitResult;
+
+static NonnullRefPtr<Threading::Thread> start_waiter(void const* waiter_list, Optional<WaitResult>& result)
+{
+    auto thread = Threading::Thread::construct("Waiter"sv, [waiter_list, &result] {
+        auto& waiter_lists = JS::WaiterLists::the();
+        Threading::MutexLocker locker { waiter_lists.critical_section() };
+        result = waiter_lists.add_waiter_and_suspend(waiter_list, {});
+        return static_cast<intptr_t>(0);
+    });
+    thread->start();
+    return thread;
+}
+
+static void wait_for_waiter_count(void const* waiter_list, size_t count)
+{
+    auto& waiter_lists = JS::WaiterLists::the();
+    while (true) {
+        {
+            Threading::MutexLocker locker { waiter_lists.critical_section() };
+            if (waiter_lists.waiter_count(waiter_list) == count)
+                return;
+        }
+        MUST(Core::System::sleep_ms(1));
+    }
+}
+
+static size_t notify_waiters(void const* waiter_list, size_t count)
+{
+    auto& waiter_lists = JS::WaiterLists::the();
+    Threading::MutexLocker locker { waiter_lists.critical_section() };
+    return waiter_lists.notify_waiters(waiter_list, count);
+}
+
+TEST_CASE(notify_wakes_a_waiter)
+{
+    i32 element = 0;
+
+    Optional<WaitResult> result;
+    auto thread = start_waiter(&element, result);
+    wait_for_waiter_count(&element, 1);
+
+    EXPECT_EQ(notify_waiters(&element, 1), 1u);
+    (void)thread->join();
+
+    EXPECT(result == WaitResult::Ok);
+    EXPECT_EQ(notify_waiters(&element, 1), 0u);
+}
+
+TEST_CASE(notify_wakes_waiters_in_order)
+{
+    i32 element = 0;
+
+    Optional<WaitResult> first_result;
+    auto first_thread = start_waiter(&element, first_result);
+    wait_for_waiter_count(&element, 1);
+
+    Optional<WaitResult> second_result;
+    auto second_thread = start_waiter(&element, second_result);
+    wait_for_waiter_count(&element, 2);
+
+    // Only the waiter that has been waiting the longest must be woken up.
+    EXPECT_EQ(notify_waiters(&element, 1), 1u);
+    (void)first_thread->join();
+    EXPECT(first_result == WaitResult::Ok);
+    wait_for_waiter_count(&element, 1);
+
+    EXPECT_EQ(notify_waiters(&element, NumericLimits<size_t>::max()), 1u);
+    (void)second_thread->join();
+    EXPECT(second_result == WaitResult::Ok);
+}
+
+TEST_CASE(notify_only_wakes_waiters_of_the_same_element)
+{
+    i32 elements[2] {};
+
+    Optional<WaitResult> result;
+    auto thread = start_waiter(&elements[0], result);
+    wait_for_waiter_count(&elements[0], 1);
+
+    EXPECT_EQ(notify_waiters(&elements[1], 1), 0u);
+    wait_for_waiter_count(&elements[0], 1);
+
+    EXPECT_EQ(notify_waiters(&elements[0], 1), 1u);
+    (void)thread->join();
+    EXPECT(result == WaitResult::Ok);
+}
+
+TEST_CASE(wait_times_out)
+{
+    i32 element = 0;
+
+    auto& waiter_lists = JS::WaiterLists::the();
+    Threading::MutexLocker locker { waiter_lists.critical_section() };
+
+    auto result = waiter_lists.add_waiter_and_suspend(&element, UnixDateTime::now() + AK::Duration::from_milliseconds(10));
+    EXPECT(result == WaitResult::TimedOut);
+    EXPECT_EQ(waiter_lists.waiter_count(&element), 0u);
+}
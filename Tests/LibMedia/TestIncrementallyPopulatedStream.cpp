@@ -290,3 +290,78 @@ TEST_CASE(data_request_callback_invoked)
 
     MUST(thread->join());
 }
+
+TEST_CASE(discard_played_back_data)
+{
+    Core::EventLoop loop;
+
+    static constexpr u64 stream_size = 160 * MiB;
+    static constexpr u64 cursor_position = 150 * MiB;
+
+    auto stream = Media::IncrementallyPopulatedStream::create_empty();
+    stream->set_expected_size(stream_size);
+    stream->set_data_request_callback([](u64) { });
+    stream->set_data_can_be_requested_again(true);
+
+    auto header_cursor = stream->create_cursor();
+    auto cursor = stream->create_cursor();
+    MUST(cursor->seek(cursor_position, SeekMode::SetPosition));
+    MUST(header_cursor->seek(cursor_position, SeekMode::SetPosition));
+
+    // NB: Every chunk starts at a multiple of 256, so a byte's value always matches its position.
+    auto data = make_test_data(1 * MiB);
+    for (u64 offset = 0; offset < stream_size; offset += data.size())
+        stream->add_chunk_at(offset, data.bytes());
+
+    // Data around the cursor is kept, and reads across the boundaries between blocks still see the right bytes.
+    MUST(cursor->seek(cursor_position - 5, SeekMode::SetPosition));
+    Array<u8, 10> buffer;
+    EXPECT_EQ(MUST(cursor->read_into(buffer)), 10u);
+    for (size_t i = 0; i < buffer.size(); i++)
+        EXPECT_EQ(buffer[i], static_cast<u8>(cursor_position - 5 + i));
+
+    // The header data is always kept.
+    MUST(header_cursor->seek(0, SeekMode::SetPosition));
+    EXPECT_EQ(MUST(header_cursor->read_into(buffer)), 10u);
+    for (size_t i = 0; i < buffer.size(); i++)
+        EXPECT_EQ(buffer[i], static_cast<u8>(i));
+}
+
+TEST_CASE(read_ahead_limit_callback_invoked)
+{
+    Core::EventLoop loop;
+
+    // Read-ahead stops once more than 64 MiB is buffered ahead of the furthest cursor.
+    static constexpr u64 buffered_size = 65 * MiB;
+
+    auto stream = Media::IncrementallyPopulatedStream::create_empty();
+    stream->set_expected_size(128 * MiB);
+    stream->set_data_can_be_requested_again(true);
+
+    Optional<u64> requested_offset;
+    stream->set_data_request_callback([&](u64 offset) {
+        requested_offset = offset;
+    });
+    bool read_ahead_limit_reached { false };
+    stream->set_read_ahead_limit_callback([&] {
+        read_ahead_limit_reached = true;
+    });
+
+    auto cursor = stream->create_cursor();
+
+    auto data = make_test_data(1 * MiB);
+    for (u64 offset = 0; offset < buffered_size; offset += data.size())
+        stream->add_chunk_at(offset, data.bytes());
+
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(read_ahead_limit_reached);
+    EXPECT(!requested_offset.has_value());
+
+    // Once the cursor gets close to the end of the buffered data, the rest of the data is requested again.
+    MUST(cursor->seek(buffered_size - 1 * MiB, SeekMode::SetPosition));
+    Array<u8, 10> buffer;
+    EXPECT_EQ(MUST(cursor->read_into(buffer)), 10u);
+
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT_EQ(requested_offset.value_or(0), buffered_size);
+}
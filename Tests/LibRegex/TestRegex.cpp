@@ -1875,3 +1875,38 @@ TEST_CASE(optimizer_simple_compare_char_class)
         EXPECT_EQ(re.match("abc"sv).success, false);
     }
 }
+
+TEST_CASE(pure_substring_search_scans_for_occurrences)
+{
+    Regex<ECMA262> re("foo", (ECMAScriptFlags)regex::AllFlags::Global);
+    EXPECT(re.parser_result.optimization_data.pure_substring_search.has_value());
+
+    auto subject = Utf16String::from_utf8("xxfooyfofoo\xf0\x9f\x98\x80foo"sv);
+    auto result = re.match(Utf16View { subject });
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(result.count, 3u);
+    EXPECT_EQ(result.matches[0].column, 2u);
+    EXPECT_EQ(result.matches[1].column, 8u);
+    EXPECT_EQ(result.matches[2].column, 13u);
+
+    auto no_match = Utf16String::from_utf8("fofofo"sv);
+    EXPECT_EQ(re.match(Utf16View { no_match }).success, false);
+}
+
+TEST_CASE(literal_prefix_scans_for_candidates)
+{
+    Regex<ECMA262> re("foo(bar|baz)\\d", (ECMAScriptFlags)regex::AllFlags::Global);
+    EXPECT(re.parser_result.optimization_data.literal_prefix.has_value());
+
+    auto subject = Utf16String::from_utf8("foobaz foobar1 fooqux foobaz2"sv);
+    auto result = re.match(Utf16View { subject });
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(result.count, 2u);
+    EXPECT_EQ(result.matches[0].column, 7u);
+    EXPECT_EQ(result.matches[1].column, 22u);
+    EXPECT_EQ(result.capture_group_matches[1][0].view.to_byte_string(), "baz"sv);
+
+    Regex<ECMA262> insensitive("foo\\d", (ECMAScriptFlags)regex::AllFlags::Global | ECMAScriptFlags::Insensitive);
+    auto mixed_case = Utf16String::from_utf8("xFoO1 foo2"sv);
+    EXPECT_EQ(insensitive.match(Utf16View { mixed_case }).count, 2u);
+}
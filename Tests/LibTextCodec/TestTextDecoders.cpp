@@ -48,3 +48,22 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_windows1252_decode)
+{
+    auto decoder = TextCodec::decoder_for("windows-1252"sv);
+    EXPECT(decoder.has_value());
+
+    // The ASCII run is longer than 32 bytes, so it spans a whole chunk of the fast ASCII scan.
+    auto test_string = "\x80 caf\xe9 - the quick brown fox jumps over the lazy dog \x93quoted\x94"sv;
+    auto utf8 = MUST(decoder->to_utf8(test_string));
+    EXPECT_EQ(utf8, "€ café - the quick brown fox jumps over the lazy dog “quoted”"sv);
+}
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    auto test_string = "s\xe4k and a long run of ASCII text that follows it \xff"sv;
+    auto utf8 = MUST(decoder.to_utf8(test_string));
+    EXPECT_EQ(utf8, "säk and a long run of ASCII text that follows it ÿ"sv);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/ThreadPool.h>
+#include <pthread.h>
+
+using namespace AK::TimeLiterals;
+
+static void wait_until(Function<bool()> condition, AK::Duration timeout = 2000_ms)
+{
+    i64 const timeout_ms = timeout.to_milliseconds();
+    for (i64 elapsed_ms = 0; elapsed_ms < timeout_ms; elapsed_ms += 5) {
+        if (condition())
+            return;
+        MUST(Core::System::sleep_ms(5));
+    }
+
+    FAIL("Timed out waiting for condition");
+}
+
+TEST_CASE(thread_pool_runs_every_task_off_the_submitting_thread)
+{
+    auto pool = Threading::ThreadPool::create("TestPool"sv, 3);
+
+    pthread_t const submitting_thread_id = pthread_self();
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> completed = 0;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> ran_on_submitting_thread = 0;
+
+    for (int i = 0; i < 100; ++i) {
+        pool->submit([&] {
+            if (pthread_equal(pthread_self(), submitting_thread_id))
+                ran_on_submitting_thread.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            completed.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+        });
+    }
+
+    wait_until([&] { return completed.load(AK::MemoryOrder::memory_order_relaxed) == 100; });
+    EXPECT_EQ(ran_on_submitting_thread.load(AK::MemoryOrder::memory_order_relaxed), 0);
+}
+
+TEST_CASE(thread_pool_steals_work_submitted_from_a_worker)
+{
+    auto pool = Threading::ThreadPool::create("TestPool"sv, 2);
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> running = 0;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> ran_concurrently = false;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> completed = 0;
+
+    auto blocking_task = [&] {
+        if (running.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) > 0)
+            ran_concurrently.store(true, AK::MemoryOrder::memory_order_relaxed);
+        wait_until([&] { return ran_concurrently.load(AK::MemoryOrder::memory_order_relaxed); });
+        completed.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    };
+
+    // Both tasks land on the queue of the worker that runs the outer task, so the other worker has to steal one.
+    pool->submit([&] {
+        pool->submit(blocking_task);
+        pool->submit(blocking_task);
+    });
+
+    wait_until([&] { return completed.load(AK::MemoryOrder::memory_order_relaxed) == 2; });
+    EXPECT(ran_concurrently.load(AK::MemoryOrder::memory_order_relaxed));
+}
+
+TEST_CASE(thread_pool_runs_higher_priorities_first)
+{
+    auto pool = Threading::ThreadPool::create("TestPool"sv, 1);
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<bool> release_worker = false;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Threading::Mutex order_mutex;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Vector<Threading::TaskPriority> order;
+
+    // Keep the only worker busy until everything has been queued.
+    pool->submit([&] {
+        wait_until([&] { return release_worker.load(AK::MemoryOrder::memory_order_relaxed); });
+    });
+
+    auto record = [&](Threading::TaskPriority priority) {
+        return [&, priority] {
+            Threading::MutexLocker const locker { order_mutex };
+            order.append(priority);
+        };
+    };
+
+    pool->submit(record(Threading::TaskPriority::Low), Threading::TaskPriority::Low);
+    pool->submit(record(Threading::TaskPriority::Normal), Threading::TaskPriority::Normal);
+    pool->submit(record(Threading::TaskPriority::High), Threading::TaskPriority::High);
+
+    release_worker.store(true, AK::MemoryOrder::memory_order_relaxed);
+
+    wait_until([&] {
+        Threading::MutexLocker const locker { order_mutex };
+        return order.size() == 3;
+    });
+
+    EXPECT_EQ(order[0], Threading::TaskPriority::High);
+    EXPECT_EQ(order[1], Threading::TaskPriority::Normal);
+    EXPECT_EQ(order[2], Threading::TaskPriority::Low);
+}
@@ -57,6 +57,29 @@ TEST_CASE(grapheme_segmentation)
     test_grapheme_segmentation("a👩🏼‍❤️‍👨🏻b"sv, { 0u, 1u, 29u, 30u });
 }
 
+template<size_t N>
+static void test_utf16_grapheme_segmentation(Utf16View const& string, size_t const (&expected_boundaries)[N])
+{
+    Vector<size_t> boundaries;
+    auto segmenter = Unicode::Segmenter::create(Unicode::SegmenterGranularity::Grapheme);
+
+    segmenter->for_each_boundary(string, [&](auto boundary) {
+        boundaries.append(boundary);
+        return IterationDecision::Continue;
+    });
+
+    EXPECT_EQ(boundaries, ReadonlySpan<size_t> { expected_boundaries });
+}
+
+TEST_CASE(grapheme_segmentation_latin1)
+{
+    test_utf16_grapheme_segmentation(u"caf\u00E9"_utf16, { 0u, 1u, 2u, 3u, 4u });
+    test_utf16_grapheme_segmentation(u"\u00E9\u00AD\u00A9"_utf16, { 0u, 1u, 2u, 3u });
+    test_utf16_grapheme_segmentation(u"\u00E9\n\rb"_utf16, { 0u, 1u, 2u, 3u, 4u });
+    test_utf16_grapheme_segmentation(u"\u00E9\r\nb"_utf16, { 0u, 1u, 3u, 4u });
+    test_utf16_grapheme_segmentation(u"e\u0301\u00E9"_utf16, { 0u, 2u, 3u });
+}
+
 TEST_CASE(grapheme_segmentation_indic_conjunct_break)
 {
     test_grapheme_segmentation("\u0915"sv, { 0u, 3u });
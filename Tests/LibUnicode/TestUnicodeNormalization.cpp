@@ -43,6 +43,9 @@ TEST_CASE(normalize_nfc)
 
     EXPECT_EQ(normalize("Office"sv, NormalizationForm::NFC), "Office"sv);
 
+    EXPECT_EQ(normalize("Amélie"sv, NormalizationForm::NFC), "Amélie"sv);
+    EXPECT_EQ(normalize("Ame\u0301lie"sv, NormalizationForm::NFC), "Amélie"sv);
+
     EXPECT_EQ(normalize("\u1E9B\u0323"sv, NormalizationForm::NFC), "\u1E9B\u0323"sv);
     EXPECT_EQ(normalize("\u0044\u0307"sv, NormalizationForm::NFC), "\u1E0A"sv);
 
@@ -136,6 +136,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
 
         is_revalidation_request = "If-Modified-Since" in self.headers
         send_not_modified = is_revalidation_request and "X-Ladybird-Respond-With-Not-Modified" in self.headers
+        send_server_error = is_revalidation_request and "X-Ladybird-Respond-With-Server-Error" in self.headers
 
         send_incomplete_response = "X-Ladybird-Respond-With-Incomplete-Response" in self.headers
 
@@ -150,6 +151,8 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
 
             if send_not_modified:
                 self.send_response(304)
+            elif send_server_error:
+                self.send_response_only(503)
             else:
                 self.send_response_only(echo.status, echo.reason_phrase)
 
@@ -275,3 +275,37 @@ TEST_CASE(ambiguous_ampersand_offset)
     EXPECT_EQ(token.start_position().line, 0u);
     EXPECT_EQ(token.start_position().column, 1u);
 }
+
+TEST_CASE(character_runs)
+{
+    Tokenizer tokenizer { "<p>Some text&amp;more\r\ntext<a title=\"a long title\">x</a></p>"sv, "UTF-8"sv };
+    tokenizer.set_emits_character_runs(true);
+
+    auto next_character_data = [&] {
+        auto token = tokenizer.next_token();
+        VERIFY(token.has_value() && token->is_character());
+        StringBuilder builder;
+        if (token->is_character_run()) {
+            for (auto code_point : token->character_run())
+                builder.append_code_point(code_point);
+        } else {
+            builder.append_code_point(token->code_point());
+        }
+        return builder.to_byte_string();
+    };
+
+    EXPECT(tokenizer.next_token()->is_start_tag());
+    EXPECT_EQ(next_character_data(), "Some text"sv);
+    EXPECT_EQ(next_character_data(), "&"sv);
+    EXPECT_EQ(next_character_data(), "more"sv);
+    EXPECT_EQ(next_character_data(), "\ntext"sv);
+
+    auto anchor = tokenizer.next_token();
+    EXPECT(anchor->is_start_tag());
+    EXPECT_EQ(anchor->attribute("title"_fly_string).value(), "a long title"sv);
+
+    EXPECT_EQ(next_character_data(), "x"sv);
+    EXPECT(tokenizer.next_token()->is_end_tag());
+    EXPECT(tokenizer.next_token()->is_end_tag());
+    EXPECT(tokenizer.next_token()->is_end_of_file());
+}
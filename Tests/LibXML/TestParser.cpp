@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/StringBuilder.h>
 #include <LibTest/TestCase.h>
 #include <LibXML/Parser/Parser.h>
 
@@ -45,3 +46,121 @@ TEST_CASE(unicode_name)
     XML::Parser parser("<div 中文=\"\"></div>"sv);
     TRY_OR_FAIL(parser.parse());
 }
+
+// Records the events a parser reports, merging adjacent text, which may be split up differently depending on where
+// the chunks of the source end.
+struct RecordingListener final : public XML::Listener {
+    virtual void document_start() override { events.append("document_start"); }
+    virtual void document_end() override { events.append("document_end"); }
+
+    virtual void element_start(XML::Name const& name, OrderedHashMap<XML::Name, ByteString> const& attributes) override
+    {
+        StringBuilder builder;
+        builder.appendff("element_start {}", name);
+        for (auto const& [attribute_name, value] : attributes)
+            builder.appendff(" {}=\"{}\"", attribute_name, value);
+        events.append(builder.to_byte_string());
+    }
+
+    virtual void element_end(XML::Name const& name) override { events.append(ByteString::formatted("element_end {}", name)); }
+
+    virtual void text(StringView text) override
+    {
+        if (!events.is_empty() && events.last().starts_with("text "sv))
+            events.last() = ByteString::formatted("{}{}", events.last(), text);
+        else
+            events.append(ByteString::formatted("text {}", text));
+    }
+
+    virtual void cdata_section(StringView data) override { events.append(ByteString::formatted("cdata_section {}", data)); }
+    virtual void processing_instruction(StringView target, StringView data) override { events.append(ByteString::formatted("processing_instruction {} {}", target, data)); }
+    virtual void comment(StringView data) override { events.append(ByteString::formatted("comment {}", data)); }
+
+    Vector<ByteString> events;
+};
+
+static constexpr auto incremental_parser_source = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                                  "<?style type=\"text/css\"?>\n"
+                                                  "<root xmlns:x=\"urn:x\" lang=\"中文\">\n"
+                                                  "  <x:item id=\"1\">Grüße, 世界 &amp; 🐞!</x:item>\n"
+                                                  "  <!-- Ein Kommentar über Ümlaute -->\n"
+                                                  "  <data><![CDATA[<not> an & element, ñ]]></data>\n"
+                                                  "  <empty attribute='é'/>\n"
+                                                  "  <number>&#x1F41E;&#233;</number>\n"
+                                                  "</root>\n"sv;
+
+static ErrorOr<Vector<ByteString>, XML::ParseError> events_from_whole_source(StringView source, XML::Parser::Options options = {})
+{
+    RecordingListener listener;
+    XML::Parser parser(source, move(options));
+    TRY(parser.parse_with_listener(listener));
+    return move(listener.events);
+}
+
+static ErrorOr<Vector<ByteString>, XML::ParseError> events_from_chunks(StringView source, size_t chunk_size, XML::Parser::Options options = {})
+{
+    RecordingListener listener;
+    auto parser = TRY(XML::IncrementalParser::create(listener, move(options)));
+    for (size_t offset = 0; offset < source.length(); offset += chunk_size)
+        TRY(parser->feed(source.substring_view(offset, min(chunk_size, source.length() - offset))));
+    TRY(parser->finish());
+    return move(listener.events);
+}
+
+TEST_CASE(incremental_parser_matches_whole_source_parsing)
+{
+    auto expected = TRY_OR_FAIL(events_from_whole_source(incremental_parser_source));
+    EXPECT(!expected.is_empty());
+
+    // NB: Chunks of one to a few bytes end both inside multi-byte UTF-8 sequences and inside every kind of token.
+    for (size_t chunk_size : { 1uz, 2uz, 3uz, 5uz, 7uz, 64uz, incremental_parser_source.length() })
+        EXPECT_EQ(TRY_OR_FAIL(events_from_chunks(incremental_parser_source, chunk_size)), expected);
+}
+
+TEST_CASE(incremental_parser_matches_whole_source_parsing_with_comments)
+{
+    auto expected = TRY_OR_FAIL(events_from_whole_source(incremental_parser_source, { .preserve_comments = true }));
+    EXPECT(expected.contains_slow("comment  Ein Kommentar über Ümlaute "sv));
+
+    for (size_t chunk_size : { 1uz, 2uz, 3uz })
+        EXPECT_EQ(TRY_OR_FAIL(events_from_chunks(incremental_parser_source, chunk_size, { .preserve_comments = true })), expected);
+}
+
+TEST_CASE(incremental_parser_splits_inside_utf8_sequences)
+{
+    // NB: "𝄞" is four bytes long, so every split point inside it is covered by feeding the bytes before and after it
+    //     in two chunks.
+    auto source = "<a>x𝄞y</a>"sv;
+    auto expected = TRY_OR_FAIL(events_from_whole_source(source));
+
+    for (size_t split = 1; split < source.length(); ++split) {
+        RecordingListener listener;
+        auto parser = TRY_OR_FAIL(XML::IncrementalParser::create(listener));
+        TRY_OR_FAIL(parser->feed(source.substring_view(0, split)));
+        TRY_OR_FAIL(parser->feed(source.substring_view(split)));
+        TRY_OR_FAIL(parser->finish());
+        EXPECT_EQ(listener.events, expected);
+    }
+}
+
+TEST_CASE(incremental_parser_reports_errors)
+{
+    auto source = "<a><b></a>"sv;
+
+    RecordingListener whole_source_listener;
+    XML::Parser parser(source);
+    EXPECT(parser.parse_with_listener(whole_source_listener).is_error());
+
+    for (size_t chunk_size : { 1uz, 3uz }) {
+        RecordingListener listener;
+        auto incremental_parser = TRY_OR_FAIL(XML::IncrementalParser::create(listener));
+
+        auto failed = false;
+        for (size_t offset = 0; offset < source.length() && !failed; offset += chunk_size)
+            failed = incremental_parser->feed(source.substring_view(offset, min(chunk_size, source.length() - offset))).is_error();
+        if (!failed)
+            failed = incremental_parser->finish().is_error();
+
+        EXPECT(failed);
+    }
+}
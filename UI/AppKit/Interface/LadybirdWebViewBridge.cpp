@@ -37,7 +37,9 @@ WebViewBridge::~WebViewBridge() = default;
 void WebViewBridge::set_device_pixel_ratio(double device_pixel_ratio)
 {
     m_device_pixel_ratio = device_pixel_ratio;
-    client().async_set_device_pixel_ratio(m_client_state.page_index, m_device_pixel_ratio);
+
+    if (has_client())
+        client().async_set_device_pixel_ratio(m_client_state.page_index, m_device_pixel_ratio);
 }
 
 void WebViewBridge::set_zoom_level(double zoom_level)
@@ -57,11 +59,16 @@ void WebViewBridge::set_viewport_rect(Gfx::IntRect viewport_rect)
 void WebViewBridge::set_maximum_frames_per_second(u64 maximum_frames_per_second)
 {
     m_maximum_frames_per_second = static_cast<double>(maximum_frames_per_second);
-    client().async_set_maximum_frames_per_second(m_client_state.page_index, maximum_frames_per_second);
+
+    if (has_client())
+        client().async_set_maximum_frames_per_second(m_client_state.page_index, maximum_frames_per_second);
 }
 
 void WebViewBridge::update_palette()
 {
+    if (!has_client())
+        return;
+
     auto theme = create_system_palette();
     client().async_update_system_theme(m_client_state.page_index, move(theme));
 }
@@ -497,11 +497,17 @@ void WebContentView::dropEvent(QDropEvent* event)
 
 void WebContentView::focusInEvent(QFocusEvent*)
 {
+    if (!has_client())
+        return;
+
     client().async_set_has_focus(m_client_state.page_index, true);
 }
 
 void WebContentView::focusOutEvent(QFocusEvent*)
 {
+    if (!has_client())
+        return;
+
     client().async_set_has_focus(m_client_state.page_index, false);
 }
 
@@ -549,13 +555,17 @@ void WebContentView::resizeEvent(QResizeEvent* event)
 void WebContentView::set_viewport_rect(Gfx::IntRect rect)
 {
     m_viewport_size = rect.size();
-    client().async_set_viewport_size(m_client_state.page_index, rect.size().to_type<Web::DevicePixels>());
+
+    if (has_client())
+        client().async_set_viewport_size(m_client_state.page_index, rect.size().to_type<Web::DevicePixels>());
 }
 
 void WebContentView::set_device_pixel_ratio(double device_pixel_ratio)
 {
     m_device_pixel_ratio = device_pixel_ratio;
-    client().async_set_device_pixel_ratio(m_client_state.page_index, m_device_pixel_ratio);
+
+    if (has_client())
+        client().async_set_device_pixel_ratio(m_client_state.page_index, m_device_pixel_ratio);
     update_viewport_size();
     handle_resize();
 }
@@ -563,14 +573,15 @@ void WebContentView::set_device_pixel_ratio(double device_pixel_ratio)
 void WebContentView::set_zoom_level(double zoom_level)
 {
     m_zoom_level = zoom_level;
-    client().async_set_zoom_level(m_client_state.page_index, m_zoom_level);
     update_zoom();
 }
 
 void WebContentView::set_maximum_frames_per_second(double maximum_frames_per_second)
 {
     m_maximum_frames_per_second = maximum_frames_per_second;
-    client().async_set_maximum_frames_per_second(m_client_state.page_index, m_maximum_frames_per_second);
+
+    if (has_client())
+        client().async_set_maximum_frames_per_second(m_client_state.page_index, m_maximum_frames_per_second);
 }
 
 void WebContentView::update_viewport_size()
@@ -634,11 +645,17 @@ static Core::AnonymousBuffer make_system_theme_from_qt_palette(QWidget& widget,
 
 void WebContentView::update_palette(PaletteMode mode)
 {
+    if (!has_client())
+        return;
+
     client().async_update_system_theme(m_client_state.page_index, make_system_theme_from_qt_palette(*this, mode));
 }
 
 void WebContentView::update_screen_rects()
 {
+    if (!has_client())
+        return;
+
     auto screens = QGuiApplication::screens();
 
     if (!screens.empty()) {
@@ -24,6 +24,7 @@
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -821,6 +822,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     bool parse_only = false;
     StringView evaluate_script;
+    StringView cpu_profile_path;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
@@ -828,6 +830,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_disable_jump_threading, "Disable bytecode jump threading", "disable-jump-threading");
+    args_parser.add_option(JS::Bytecode::g_disable_unreachable_block_elimination, "Disable bytecode unreachable block elimination", "disable-unreachable-block-elimination");
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -838,6 +842,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_debug_printing, "Disable debug output", "disable-debug-output", {});
     args_parser.add_option(evaluate_script, "Evaluate argument as a script", "evaluate", 'c', "script");
     args_parser.add_option(use_test262_global, "Use test262 global ($262)", "use-test262-global", {});
+    args_parser.add_option(cpu_profile_path, "Sample the script's call stacks and write them to a .cpuprofile file", "cpu-profile", {}, "path");
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
@@ -920,9 +925,23 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             source_name = "eval"sv;
         }
 
+        OwnPtr<JS::SamplingProfiler> profiler;
+        if (!cpu_profile_path.is_empty()) {
+            profiler = make<JS::SamplingProfiler>(*g_vm);
+            profiler->start();
+        }
+
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only)))
+        auto did_run = TRY(parse_and_run(realm, builder.string_view(), source_name, parse_only));
+
+        if (profiler) {
+            profiler->stop();
+            auto profile_file = TRY(Core::File::open(cpu_profile_path, Core::File::OpenMode::Write));
+            TRY(profile_file->write_until_depleted(profiler->to_cpu_profile().serialized().bytes()));
+        }
+
+        if (!did_run)
             return 1;
     }
 
@@ -7,6 +7,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/Queue.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/File.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibMain/Main.h>
@@ -486,16 +487,74 @@ static void do_run_tests(XML::Document& document)
     }
 }
 
+// Counts the nodes a listener is told about, so that parsing into a listener can't be optimized away in benchmarks.
+struct CountingListener final : public XML::Listener {
+    virtual void element_start(XML::Name const&, OrderedHashMap<XML::Name, ByteString> const&) override { ++node_count; }
+    virtual void text(StringView) override { ++node_count; }
+    virtual void cdata_section(StringView) override { ++node_count; }
+    virtual void comment(StringView) override { ++node_count; }
+    virtual void processing_instruction(StringView, StringView) override { ++node_count; }
+
+    size_t node_count { 0 };
+};
+
+static ErrorOr<void> run_benchmark(StringView contents, size_t iterations)
+{
+    static constexpr size_t chunk_size = 64 * KiB;
+
+    auto report = [&](StringView mode, AK::Duration elapsed) {
+        outln("{:>12}: {} ms per parse over {} iterations", mode, elapsed.to_milliseconds() / static_cast<i64>(iterations), iterations);
+    };
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (size_t i = 0; i < iterations; ++i) {
+        auto parser = parse(contents);
+        if (auto result = parser.parse(); result.is_error())
+            return Error::from_string_literal("Failed to parse document");
+    }
+    report("document"sv, timer.elapsed_time());
+
+    timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (size_t i = 0; i < iterations; ++i) {
+        CountingListener listener;
+        auto parser = parse(contents);
+        if (auto result = parser.parse_with_listener(listener); result.is_error())
+            return Error::from_string_literal("Failed to parse document");
+    }
+    report("listener"sv, timer.elapsed_time());
+
+    timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    for (size_t i = 0; i < iterations; ++i) {
+        CountingListener listener;
+        auto parser_or_error = XML::IncrementalParser::create(listener, { .preserve_comments = true });
+        if (parser_or_error.is_error())
+            return Error::from_string_literal("Failed to create incremental parser");
+        auto parser = parser_or_error.release_value();
+
+        for (size_t offset = 0; offset < contents.length(); offset += chunk_size) {
+            if (auto result = parser->feed(contents.substring_view(offset, min(chunk_size, contents.length() - offset))); result.is_error())
+                return Error::from_string_literal("Failed to parse document");
+        }
+        if (auto result = parser->finish(); result.is_error())
+            return Error::from_string_literal("Failed to parse document");
+    }
+    report("incremental"sv, timer.elapsed_time());
+
+    return {};
+}
+
 ErrorOr<int> ladybird_main(Main::Arguments arguments)
 {
     StringView filename;
     bool run_tests { false };
+    size_t benchmark_iterations { 0 };
 
     Core::ArgsParser parser;
     parser.set_general_help("Parse and dump XML files");
     parser.add_option(g_color, "Syntax highlight the output", "color", 'c');
     parser.add_option(g_only_contents, "Only display markup and text", "only-contents", 'o');
     parser.add_option(run_tests, "Run tests", "run-tests", 't');
+    parser.add_option(benchmark_iterations, "Time parsing the file into a document, a listener, and incrementally into a listener", "benchmark", 'b', "iterations");
     parser.add_positional_argument(filename, "File to read from", "file");
     parser.parse(arguments);
 
@@ -503,6 +562,11 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     auto file = TRY(Core::File::open(s_path, Core::File::OpenMode::Read));
     auto contents = TRY(file->read_until_eof());
 
+    if (benchmark_iterations > 0) {
+        TRY(run_benchmark(contents, benchmark_iterations));
+        return 0;
+    }
+
     auto xml_parser = parse(contents);
     auto result = xml_parser.parse();
     if (result.is_error()) {
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+// Benchmarks LibIPC::Connection over a TransportSocket: sync round-trip latency, async throughput for payloads from
+// 16 bytes to 64 MiB, and file descriptor passing. Pass --benchmark_format=json (or --benchmark_out=<file>
+// --benchmark_out_format=json) to emit machine-readable results.
+//
+// Setting IPC_BENCHMARK_REPLAY_FILE to a trace with one "<sync|async> <payload size>" pair per line additionally
+// replays that sequence of messages, e.g. one recorded from a WebContent <-> UI process session.
+
+#include <AK/ByteBuffer.h>
+#include <AK/GenericLexer.h>
+#include <AK/Vector.h>
+#include <LibCore/Environment.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibIPC/ConnectionFromClient.h>
+#include <LibIPC/ConnectionToServer.h>
+#include <LibIPC/File.h>
+#include <LibIPC/Transport.h>
+#include <LibThreading/Thread.h>
+
+#include <IPCBenchmarkClientEndpoint.h>
+#include <IPCBenchmarkServerEndpoint.h>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+class BenchmarkServerConnection final
+    : public IPC::ConnectionFromClient<IPCBenchmarkClientEndpoint, IPCBenchmarkServerEndpoint> {
+    C_OBJECT(BenchmarkServerConnection);
+
+public:
+    virtual void die() override { Core::EventLoop::current().quit(0); }
+
+private:
+    explicit BenchmarkServerConnection(NonnullOwnPtr<IPC::Transport> transport)
+        : IPC::ConnectionFromClient<IPCBenchmarkClientEndpoint, IPCBenchmarkServerEndpoint>(*this, move(transport), 1)
+    {
+    }
+
+    virtual Messages::IPCBenchmarkServer::PingResponse ping(u64 sequence) override { return sequence; }
+    virtual void send_bytes(ByteBuffer) override { }
+    virtual void flush() override { }
+    virtual void send_file(IPC::File) override { }
+};
+
+class BenchmarkClientConnection final
+    : public IPC::ConnectionToServer<IPCBenchmarkClientEndpoint, IPCBenchmarkServerEndpoint> {
+    C_OBJECT(BenchmarkClientConnection);
+
+public:
+    // NB: The benchmark tears the connection down itself, so losing the server must not exit the process.
+    virtual void die() override { }
+
+private:
+    explicit BenchmarkClientConnection(NonnullOwnPtr<IPC::Transport> transport)
+        : IPC::ConnectionToServer<IPCBenchmarkClientEndpoint, IPCBenchmarkServerEndpoint>(*this, move(transport))
+    {
+    }
+};
+
+// Connects a client on the calling thread to a server running its own event loop on a separate thread, so that both
+// ends of the socket are serviced concurrently, as they would be in two processes.
+class BenchmarkConnection {
+public:
+    static ErrorOr<BenchmarkConnection> create()
+    {
+        int socket_fds[2] {};
+        TRY(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, socket_fds));
+
+        auto client_socket = TRY(Core::LocalSocket::adopt_fd(socket_fds[0]));
+        TRY(client_socket->set_blocking(true));
+
+        auto server_fd = socket_fds[1];
+        auto server_thread = Threading::Thread::construct("IPCBenchmarkServer"sv, [server_fd] {
+            Core::EventLoop event_loop;
+
+            auto server_socket = MUST(Core::LocalSocket::adopt_fd(server_fd));
+            MUST(server_socket->set_blocking(true));
+            auto connection = BenchmarkServerConnection::construct(make<IPC::Transport>(move(server_socket)));
+
+            return static_cast<intptr_t>(event_loop.exec());
+        });
+        server_thread->start();
+
+        auto client = BenchmarkClientConnection::construct(make<IPC::Transport>(move(client_socket)));
+        return BenchmarkConnection { move(client), move(server_thread) };
+    }
+
+    BenchmarkConnection(BenchmarkConnection&&) = default;
+
+    ~BenchmarkConnection()
+    {
+        if (!m_client)
+            return;
+        m_client->shutdown();
+        (void)m_server_thread->join();
+    }
+
+    BenchmarkClientConnection& client() { return *m_client; }
+
+private:
+    BenchmarkConnection(NonnullRefPtr<BenchmarkClientConnection> client, NonnullRefPtr<Threading::Thread> server_thread)
+        : m_client(move(client))
+        , m_server_thread(move(server_thread))
+    {
+    }
+
+    RefPtr<BenchmarkClientConnection> m_client;
+    RefPtr<Threading::Thread> m_server_thread;
+};
+
+Optional<BenchmarkConnection> connect_or_skip(benchmark::State& state)
+{
+    auto connection = BenchmarkConnection::create();
+    if (connection.is_error()) {
+        state.SkipWithError(ByteString::formatted("Unable to connect: {}", connection.error()).characters());
+        return {};
+    }
+    return connection.release_value();
+}
+
+ByteBuffer make_payload(size_t size)
+{
+    auto payload = MUST(ByteBuffer::create_uninitialized(size));
+    for (size_t i = 0; i < size; ++i)
+        payload[i] = static_cast<u8>(i);
+    return payload;
+}
+
+void BM_IPCRoundTripLatency(benchmark::State& state)
+{
+    auto connection = connect_or_skip(state);
+    if (!connection.has_value())
+        return;
+
+    u64 sequence = 0;
+    for (auto _ : state) {
+        auto response = connection->client().ping(++sequence);
+        if (response != sequence) {
+            state.SkipWithError("Received an out-of-order response");
+            return;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IPCRoundTripLatency);
+
+void BM_IPCAsyncThroughput(benchmark::State& state)
+{
+    auto connection = connect_or_skip(state);
+    if (!connection.has_value())
+        return;
+
+    auto payload_size = static_cast<size_t>(state.range(0));
+    auto payload = make_payload(payload_size);
+
+    // NB: Small messages are sent in batches that are each followed by a round trip, so that the measurement covers the
+    //     server actually handling them rather than just how fast they can be queued for sending.
+    auto messages_per_batch = clamp<size_t>(MiB / max<size_t>(payload_size, 1), 1, 1024);
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < messages_per_batch; ++i)
+            connection->client().async_send_bytes(payload.bytes());
+        connection->client().flush();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages_per_batch);
+    state.SetBytesProcessed(state.iterations() * messages_per_batch * payload_size);
+}
+BENCHMARK(BM_IPCAsyncThroughput)->RangeMultiplier(8)->Range(16, 64 * MiB);
+
+void BM_IPCFileDescriptorPassing(benchmark::State& state)
+{
+    auto connection = connect_or_skip(state);
+    if (!connection.has_value())
+        return;
+
+    auto pipe_fds = Core::System::pipe2(O_CLOEXEC);
+    if (pipe_fds.is_error()) {
+        state.SkipWithError(ByteString::formatted("Unable to create a pipe: {}", pipe_fds.error()).characters());
+        return;
+    }
+    auto read_fd = pipe_fds.value()[0];
+    auto write_fd = pipe_fds.value()[1];
+
+    for (auto _ : state) {
+        auto file = IPC::File::clone_fd(read_fd);
+        if (file.is_error()) {
+            state.SkipWithError(ByteString::formatted("Unable to clone the pipe: {}", file.error()).characters());
+            break;
+        }
+        connection->client().send_file(file.release_value());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    (void)Core::System::close(read_fd);
+    (void)Core::System::close(write_fd);
+}
+BENCHMARK(BM_IPCFileDescriptorPassing);
+
+struct ReplayedMessage {
+    bool is_synchronous { false };
+    size_t payload_size { 0 };
+};
+
+ErrorOr<Vector<ReplayedMessage>> load_replay_trace(StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    Vector<ReplayedMessage> messages;
+    for (auto line : StringView { contents }.lines()) {
+        GenericLexer lexer { line.trim_whitespace() };
+        if (lexer.is_eof() || lexer.next_is('#'))
+            continue;
+
+        ReplayedMessage message;
+        if (lexer.consume_specific("sync"sv))
+            message.is_synchronous = true;
+        else if (!lexer.consume_specific("async"sv))
+            return Error::from_string_literal("Expected each message to start with 'sync' or 'async'");
+
+        lexer.ignore_while(is_ascii_space);
+        auto payload_size = lexer.consume_decimal_integer<size_t>();
+        if (payload_size.is_error() || !lexer.is_eof())
+            return Error::from_string_literal("Expected each message to end with its payload size");
+        message.payload_size = payload_size.value();
+
+        messages.append(message);
+    }
+    return messages;
+}
+
+void BM_IPCReplay(benchmark::State& state, Vector<ReplayedMessage> const& messages)
+{
+    auto connection = connect_or_skip(state);
+    if (!connection.has_value())
+        return;
+
+    size_t largest_payload_size = 0;
+    size_t total_payload_size = 0;
+    for (auto const& message : messages) {
+        largest_payload_size = max(largest_payload_size, message.payload_size);
+        total_payload_size += message.payload_size;
+    }
+    auto payload = make_payload(largest_payload_size);
+
+    for (auto _ : state) {
+        for (auto const& message : messages) {
+            auto bytes = payload.bytes().trim(message.payload_size);
+            connection->client().async_send_bytes(bytes);
+            if (message.is_synchronous)
+                connection->client().flush();
+        }
+        connection->client().flush();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messages.size());
+    state.SetBytesProcessed(state.iterations() * total_payload_size);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    // NB: The client connection lives on the main thread, which needs an event loop of its own.
+    Core::EventLoop event_loop;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    static Vector<ReplayedMessage> replayed_messages;
+    if (auto replay_path = Core::Environment::get("IPC_BENCHMARK_REPLAY_FILE"sv); replay_path.has_value()) {
+        auto messages = load_replay_trace(*replay_path);
+        if (messages.is_error()) {
+            warnln("Unable to load IPC replay trace {}: {}", *replay_path, messages.error());
+            return 1;
+        }
+        replayed_messages = messages.release_value();
+        benchmark::RegisterBenchmark("BM_IPCReplay", [](benchmark::State& state) { BM_IPCReplay(state, replayed_messages); });
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -1,24 +1,374 @@
-#include <benchmark/benchmark.h>
-// Benchmark CPython execution using embedded interpreter
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+// Benchmarks the Python integration in LibWeb rather than raw CPython: compiling and running PythonScripts, converting
+// values across PythonJSBridge, DOM query and mutation loops through PythonDOMBindings, the DOM wrapper cache, and the
+// cost of PythonSecurityModel's sandbox setup. Everything runs against a headless page with an about:blank document,
+// so scripts take the same code paths as in WebContent. Pass --benchmark_format=json (or --benchmark_out=<file>
+// --benchmark_out_format=json) to emit machine-readable results for regression tracking.
+
+#include <AK/Queue.h>
+#include <LibCore/EventLoop.h>
+#include <LibGC/Root.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/Bindings/PythonDOMBindings.h>
+#include <LibWeb/Bindings/PythonJSBridge.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/PythonEngine.h>
+#include <LibWeb/HTML/Scripting/PythonScript.h>
+#include <LibWeb/HTML/Scripting/PythonSecurityModel.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/Platform/EventLoopPluginSerenity.h>
+#include <LibWebView/Plugins/FontPlugin.h>
 #include <Python.h>
 
-static void BM_PythonFibonacci(benchmark::State& state)
+#include <benchmark/benchmark.h>
+
+namespace {
+
+class BenchmarkPageClient final : public Web::PageClient {
+    GC_CELL(BenchmarkPageClient, Web::PageClient);
+
+public:
+    static GC::Ref<BenchmarkPageClient> create(JS::VM& vm)
+    {
+        return vm.heap().allocate<BenchmarkPageClient>();
+    }
+
+    virtual ~BenchmarkPageClient() override = default;
+
+    GC::Ptr<Web::Page> m_page;
+
+    virtual u64 id() const override { return 0; }
+    virtual Web::Page& page() override { return *m_page; }
+    virtual Web::Page const& page() const override { return *m_page; }
+    virtual bool is_connection_open() const override { return false; }
+    // NB: Nothing is ever laid out or painted, so there is no need for a theme.
+    virtual Gfx::Palette palette() const override { VERIFY_NOT_REACHED(); }
+    virtual Web::DevicePixelRect screen_rect() const override { return {}; }
+    virtual double zoom_level() const override { return 1.0; }
+    virtual double device_pixel_ratio() const override { return 1.0; }
+    virtual double device_pixels_per_css_pixel() const override { return 1.0; }
+    virtual Web::CSS::PreferredColorScheme preferred_color_scheme() const override { return Web::CSS::PreferredColorScheme::Auto; }
+    virtual Web::CSS::PreferredContrast preferred_contrast() const override { return Web::CSS::PreferredContrast::Auto; }
+    virtual Web::CSS::PreferredMotion preferred_motion() const override { return Web::CSS::PreferredMotion::Auto; }
+    virtual size_t screen_count() const override { return 1; }
+    virtual void request_file(Web::FileRequest) override { }
+    virtual Queue<Web::QueuedInputEvent>& input_event_queue() override { return m_input_event_queue; }
+    virtual void report_finished_handling_input_event(u64, Web::EventResult) override { }
+    virtual Web::DisplayListPlayerType display_list_player_type() const override { return Web::DisplayListPlayerType::SkiaCPU; }
+    virtual bool is_headless() const override { return true; }
+
+private:
+    BenchmarkPageClient() = default;
+
+    virtual void visit_edges(Visitor& visitor) override
+    {
+        Base::visit_edges(visitor);
+        visitor.visit(m_page);
+    }
+
+    Queue<Web::QueuedInputEvent> m_input_event_queue;
+};
+
+GC::Root<Web::Page> s_page;
+GC::Root<Web::DOM::Document> s_document;
+
+// Populates the document with a list that the DOM benchmarks query and mutate.
+constexpr auto setup_source = R"~~~(
+items = [("li", {"class": "item", "data-index": str(i)}, "Item " + str(i), []) for i in range(100)]
+document.append_elements([("ul", {"id": "list"}, None, items)])
+)~~~"sv;
+
+void create_benchmark_page()
 {
-    if (!Py_IsInitialized())
-        Py_Initialize();
+    auto& vm = Web::Bindings::main_thread_vm();
+
+    auto page_client = BenchmarkPageClient::create(vm);
+    auto page = Web::Page::create(vm, *page_client);
+    page_client->m_page = page.ptr();
+    page->set_top_level_traversable(MUST(Web::HTML::TraversableNavigable::create_a_new_top_level_traversable(*page, nullptr, {})));
 
-    const char* python_code = R"(
+    s_page = GC::make_root(page);
+    s_document = GC::make_root(*page->top_level_traversable()->active_document());
+}
+
+JS::Realm& document_realm()
+{
+    return Web::HTML::relevant_realm(*s_document);
+}
+
+GC::Ref<Web::HTML::PythonScript> create_script(StringView source)
+{
+    return Web::HTML::PythonScript::create("benchmark.py", source, document_realm(), s_document->url());
+}
+
+Web::DOM::Element& list_element()
+{
+    return *s_document->get_element_by_id("list"_fly_string);
+}
+
+// Raw CPython with none of our integration, as a baseline for the benchmarks below.
+void BM_PythonFibonacci(benchmark::State& state)
+{
+    constexpr auto python_code = R"(
 def fib(n):
     return n if n < 2 else fib(n-1) + fib(n-2)
 result = fib(20)
 )";
 
-    for (auto _ : state) {
-        // Execute the Python code in the embedded interpreter
+    auto gil_state = PyGILState_Ensure();
+    for (auto _ : state)
         PyRun_SimpleString(python_code);
-    }
+    PyGILState_Release(gil_state);
 }
 
 BENCHMARK(BM_PythonFibonacci);
 
-BENCHMARK_MAIN();
+void BM_PythonScriptCreate(benchmark::State& state)
+{
+    constexpr auto source = "total = sum(range(100))\n"sv;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(create_script(source));
+}
+
+BENCHMARK(BM_PythonScriptCreate);
+
+// Every iteration compiles a distinct source, so the compiled code cache never hits.
+void BM_PythonScriptCreateUncached(benchmark::State& state)
+{
+    size_t counter = 0;
+    for (auto _ : state) {
+        auto source = ByteString::formatted("# {}\ntotal = sum(range(100))\n", counter++);
+        benchmark::DoNotOptimize(create_script(source));
+    }
+}
+
+BENCHMARK(BM_PythonScriptCreateUncached);
+
+void BM_PythonScriptRun(benchmark::State& state)
+{
+    auto script = create_script("total = sum(range(100))\n"sv);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(script->run());
+}
+
+BENCHMARK(BM_PythonScriptRun);
+
+void run_bridge_round_trip(benchmark::State& state, char const* python_expression)
+{
+    auto& realm = document_realm();
+    Web::HTML::TemporaryExecutionContext execution_context { realm };
+    auto gil_state = PyGILState_Ensure();
+
+    auto* globals = PyDict_New();
+    PyDict_SetItemString(globals, "__builtins__", PyEval_GetBuiltins());
+    auto* value = PyRun_String(python_expression, Py_eval_input, globals, globals);
+    VERIFY(value);
+
+    for (auto _ : state) {
+        auto js_value = Web::Bindings::PythonJSBridge::python_to_js(value, realm);
+        auto* round_tripped = Web::Bindings::PythonJSBridge::js_to_python(js_value, realm.vm());
+        benchmark::DoNotOptimize(round_tripped);
+        Py_XDECREF(round_tripped);
+    }
+
+    Py_DECREF(value);
+    Py_DECREF(globals);
+    PyGILState_Release(gil_state);
+}
+
+void BM_PythonBridgePrimitives(benchmark::State& state)
+{
+    run_bridge_round_trip(state, "(42, 3.5, 'hello', True, None)");
+}
+
+BENCHMARK(BM_PythonBridgePrimitives);
+
+void BM_PythonBridgeArray(benchmark::State& state)
+{
+    run_bridge_round_trip(state, "list(range(1000))");
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+
+BENCHMARK(BM_PythonBridgeArray);
+
+void BM_PythonBridgeDict(benchmark::State& state)
+{
+    run_bridge_round_trip(state, "{'key' + str(i): i for i in range(100)}");
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK(BM_PythonBridgeDict);
+
+void BM_PythonBridgeDOMNode(benchmark::State& state)
+{
+    auto& realm = document_realm();
+    Web::HTML::TemporaryExecutionContext execution_context { realm };
+    auto gil_state = PyGILState_Ensure();
+
+    JS::Value element { &list_element() };
+
+    for (auto _ : state) {
+        auto* py_element = Web::Bindings::PythonJSBridge::js_to_python(element, realm.vm());
+        benchmark::DoNotOptimize(Web::Bindings::PythonJSBridge::python_to_js(py_element, realm));
+        Py_XDECREF(py_element);
+    }
+
+    PyGILState_Release(gil_state);
+}
+
+BENCHMARK(BM_PythonBridgeDOMNode);
+
+void BM_PythonDOMQuery(benchmark::State& state)
+{
+    auto script = create_script(R"~~~(
+for _ in range(100):
+    document.select(".item")
+    document.find("#list")
+    document.get_element_by_id("list")
+)~~~"sv);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(script->run());
+    state.SetItemsProcessed(state.iterations() * 300);
+}
+
+BENCHMARK(BM_PythonDOMQuery);
+
+void BM_PythonDOMMutate(benchmark::State& state)
+{
+    auto script = create_script(R"~~~(
+container = document.find("#list")
+for i in range(100):
+    item = document.create_element("li")
+    item.set_attribute("data-index", str(i))
+    item.text = "Added"
+    container.append_child(item)
+    container.remove_child(item)
+)~~~"sv);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(script->run());
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK(BM_PythonDOMMutate);
+
+void BM_PythonDOMBatchedRead(benchmark::State& state)
+{
+    auto script = create_script(R"~~~(
+rows = document.select_attributes(".item", ["class", "data-index"])
+)~~~"sv);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(script->run());
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK(BM_PythonDOMBatchedRead);
+
+// An existing wrapper is kept alive, so every lookup is served from the document's wrapper cache.
+void BM_PythonWrapperCacheHit(benchmark::State& state)
+{
+    auto gil_state = PyGILState_Ensure();
+    auto& element = list_element();
+    auto* kept_alive = Web::Bindings::PythonElement::create_from_cpp_element(element);
+
+    for (auto _ : state) {
+        auto* wrapper = Web::Bindings::PythonElement::create_from_cpp_element(element);
+        benchmark::DoNotOptimize(wrapper);
+        Py_DECREF(wrapper);
+    }
+
+    Py_DECREF(kept_alive);
+    PyGILState_Release(gil_state);
+}
+
+BENCHMARK(BM_PythonWrapperCacheHit);
+
+// Each wrapper dies before the next lookup, so every iteration allocates and registers a new one.
+void BM_PythonWrapperCacheMiss(benchmark::State& state)
+{
+    auto gil_state = PyGILState_Ensure();
+    auto& element = list_element();
+
+    for (auto _ : state) {
+        auto* wrapper = Web::Bindings::PythonElement::create_from_cpp_element(element);
+        benchmark::DoNotOptimize(wrapper);
+        Py_DECREF(wrapper);
+    }
+
+    PyGILState_Release(gil_state);
+}
+
+BENCHMARK(BM_PythonWrapperCacheMiss);
+
+void BM_PythonRestrictBuiltins(benchmark::State& state)
+{
+    auto gil_state = PyGILState_Ensure();
+
+    for (auto _ : state) {
+        auto* globals = PyDict_New();
+        MUST(Web::HTML::PythonSecurityModel::restrict_builtins(globals));
+        Py_DECREF(globals);
+    }
+
+    PyGILState_Release(gil_state);
+}
+
+BENCHMARK(BM_PythonRestrictBuiltins);
+
+void BM_PythonSetupSandboxedEnvironment(benchmark::State& state)
+{
+    auto gil_state = PyGILState_Ensure();
+    auto origin = s_document->url();
+
+    for (auto _ : state) {
+        auto* globals = PyDict_New();
+        MUST(Web::HTML::PythonSecurityModel::setup_sandboxed_environment(globals, origin));
+        Py_DECREF(globals);
+    }
+
+    PyGILState_Release(gil_state);
+}
+
+BENCHMARK(BM_PythonSetupSandboxedEnvironment);
+
+}
+
+int main(int argc, char** argv)
+{
+    Core::EventLoop event_loop;
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    Web::Platform::EventLoopPlugin::install(*new Web::Platform::EventLoopPluginSerenity);
+    Web::Platform::FontPlugin::install(*new WebView::FontPlugin(false));
+    Web::Bindings::initialize_main_thread_vm(Web::Bindings::AgentType::SimilarOriginWindow);
+
+    Web::HTML::PythonEngine::ensure_initialized();
+    MUST(Web::HTML::PythonSecurityModel::initialize_security());
+    Web::Bindings::PythonJSBridge::initialize_bridge();
+
+    create_benchmark_page();
+    auto setup_completion = create_script(setup_source)->run();
+    VERIFY(!setup_completion.is_abrupt());
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}